@@ -0,0 +1,132 @@
+// bdlcc_concurrenthashmap.cpp                                        -*-C++-*-
+#include <bdlcc_concurrenthashmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_concurrenthashmap_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// 'ConcurrentHashMap_ShardLock::d_state' holds the number of readers that
+// have entered (or are attempting to enter) the lock, plus 'k_WRITER' while a
+// writer holds 'd_writerMutex'.  A reader adds 1 to the state, and has entered
+// if the value it added to did not include 'k_WRITER'.  Otherwise, the reader
+// backs out by subtracting 1, waits for the writer by acquiring and releasing
+// 'd_writerMutex', and tries again.
+//
+// A writer acquires 'd_writerMutex' (which excludes other writers), adds
+// 'k_WRITER' to the state, and then spins until the state equals 'k_WRITER';
+// that is, until all readers that entered before it have left, and all readers
+// that raced with it have backed out.  No reader can enter after the writer
+// has added 'k_WRITER', so that the spin terminates once the readers already
+// inside, whose critical sections are short, have left.
+//
+// The writer spins briefly, then yields the processor between polls, since a
+// reader that was preempted inside the lock cannot leave until it is
+// rescheduled.
+//
+// 'k_WRITER' exceeds any plausible number of concurrent readers, so that the
+// reader count never carries into it.
+
+namespace {
+
+// CONSTANTS
+enum {
+    k_SPIN_COUNT = 64  // number of polls before a waiting writer yields
+};
+
+void yieldProcessor()
+    // Offer the remainder of the time slice of the calling thread to other
+    // threads.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // ---------------------------------
+                     // class ConcurrentHashMap_ShardLock
+                     // ---------------------------------
+
+// PRIVATE MANIPULATORS
+void ConcurrentHashMap_ShardLock::lockReadSlow()
+{
+    do {
+        d_state.add(-1);
+
+        d_writerMutex.lock();
+        d_writerMutex.unlock();
+    } while (d_state.add(1) & k_WRITER);
+}
+
+// MANIPULATORS
+void ConcurrentHashMap_ShardLock::lockWrite()
+{
+    d_writerMutex.lock();
+
+    d_state.add(k_WRITER);
+
+    int numPolls = 0;
+    while (k_WRITER != d_state.loadAcquire()) {
+        if (++numPolls >= k_SPIN_COUNT) {
+            yieldProcessor();
+        }
+    }
+}
+
+                       // -----------------------------
+                       // struct ConcurrentHashMap_Util
+                       // -----------------------------
+
+// CLASS METHODS
+int ConcurrentHashMap_Util::numShardBits(int numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+    BSLS_ASSERT(0 == (numShards & (numShards - 1)));
+
+    int result = 0;
+    while (1 < numShards) {
+        numShards >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,927 @@
+// bdlcc_concurrenthashmap.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLCC_CONCURRENTHASHMAP
+#define INCLUDED_BDLCC_CONCURRENTHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hash map of independently locked shards.
+//
+//@CLASSES:
+//  bdlcc::ConcurrentHashMap: thread-safe hash map of locked shards
+//
+//@SEE_ALSO: bsl+bslhdrs
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::ConcurrentHashMap', implementing a hash map from unique keys to
+// values whose methods may be invoked concurrently from multiple threads.  A
+// 'bdlcc::ConcurrentHashMap' is intended to replace a 'bsl::unordered_map'
+// protected by a single mutex, such as a cache shared by many threads, where
+// that mutex becomes a point of contention.
+//
+///Shards
+///------
+// A 'bdlcc::ConcurrentHashMap' holds a fixed number of *shards*, specified at
+// construction, each of which is a 'bsl::unordered_map' protected by its own
+// lock.  Each key is assigned to a shard by the high-order bits of its hash
+// value, after mixing by Fibonacci hashing, so that keys are spread across
+// shards even by the identity hash functions 'bsl::hash' provides for integral
+// types; the 'bsl::unordered_map' of the shard then selects a bucket from the
+// same hash value.  Operations on keys in different shards never contend.
+//
+// Each shard grows its bucket array independently, while holding only its own
+// lock, so that a rehash never stalls operations on the other shards.  The
+// 'rehash' and 'reserve' methods likewise lock one shard at a time.
+//
+///Reader-Biased Locking
+///---------------------
+// The lock of each shard is a reader-writer lock biased toward readers:
+// acquiring or releasing it for reading costs one atomic addition, and any
+// number of threads may hold it for reading at once, so that lookups of keys
+// in the same shard proceed in parallel.  A writer first acquires a mutex,
+// then announces itself, which causes new readers to wait on that mutex
+// instead of entering, and spins until the readers already inside the shard
+// leave.  Consequently, writers are not starved by a steady stream of
+// readers, but visitors (see below) holding a shard for reading should be
+// brief.
+//
+// Note that lookups are not *optimistic* (i.e., performed without any lock
+// and validated afterwards, as by a sequence lock): the elements of a shard
+// are reached through pointers to nodes that a concurrent 'erase' may free,
+// and through a bucket array that a concurrent rehash may free, so that an
+// unlocked reader could dereference freed memory before detecting the
+// conflict.
+//
+///Visiting and Updating
+///---------------------
+// Since an element may be modified or erased by another thread at any time,
+// 'bdlcc::ConcurrentHashMap' provides no iterators, and no references to its
+// elements.  Instead, 'getValue' copies the value associated with a key, and
+// the 'visit', 'visitAll', and 'update' method templates invoke a
+// caller-supplied functor on elements *while* *holding* the lock of their
+// shard: for reading in the case of 'visit' and 'visitAll', and for writing
+// in the case of 'update'.  A 'VISITOR' is invoked as if by
+//..
+//  visitor(key, value);  // 'const KEY&', 'const VALUE&'
+//..
+// and an 'UPDATER' as if by
+//..
+//  updater(&value, key);  // 'VALUE *', 'const KEY&'
+//..
+// The behavior is undefined if a visitor or updater invokes any method on the
+// same 'bdlcc::ConcurrentHashMap' object.
+//
+///Thread Safety
+///-------------
+// All methods of 'bdlcc::ConcurrentHashMap', except the destructor, are
+// *fully* *thread-safe*.  The results of 'size', 'isEmpty', and 'numBuckets'
+// are computed one shard at a time, so that they may be stale by the time they
+// are returned if other threads are modifying the map concurrently.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Cache Shared by Many Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads price orders using instrument reference data,
+// which is loaded on first use and then read far more often than it is
+// modified.
+//
+// First, we define the reference data, and a functor that adds a traded
+// quantity to it:
+//..
+//  struct InstrumentData {
+//      double d_tickSize;      // minimum price increment
+//      int    d_tradedVolume;  // volume traded today
+//  };
+//
+//  struct AddVolume {
+//      int d_quantity;  // quantity to add
+//
+//      explicit AddVolume(int quantity) : d_quantity(quantity) {}
+//
+//      void operator()(InstrumentData *data, int) const
+//      {
+//          data->d_tradedVolume += d_quantity;
+//      }
+//  };
+//..
+// Then, we create the cache, keyed by instrument identifier, shared by all
+// threads (the thread creation code is elided):
+//..
+//  bdlcc::ConcurrentHashMap<int, InstrumentData> cache;
+//..
+// Next, a thread that finds an instrument missing from the cache loads its
+// data and inserts it.  Should another thread have inserted the same
+// instrument in the meantime, 'insert' keeps the existing value and returns 0:
+//..
+//  InstrumentData loaded = { 0.01, 0 };
+//  bsl::size_t    numInserted = cache.insert(1234, loaded);
+//  assert(1 == numInserted);
+//..
+// Then, pricing threads copy the data out, holding the lock of the shard only
+// for the duration of the copy:
+//..
+//  InstrumentData data;
+//  if (cache.getValue(&data, 1234)) {
+//      assert(0.01 == data.d_tickSize);
+//  }
+//..
+// Finally, a thread recording a trade updates the value in place, under the
+// lock of its shard, so that no concurrent update is lost:
+//..
+//  cache.update(1234, AddVolume(100));
+//  cache.update(1234, AddVolume(50));
+//
+//  cache.getValue(&data, 1234);
+//  assert(150 == data.d_tradedVolume);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_AUTODESTRUCTOR
+#include <bslma_autodestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>        // for 'bsl::size_t'
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UNORDERED_MAP
+#include <bsl_unordered_map.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // =================================
+                     // class ConcurrentHashMap_ShardLock
+                     // =================================
+
+class ConcurrentHashMap_ShardLock {
+    // This component-private class implements a reader-writer lock biased
+    // toward readers: 'lockRead' and 'unlockRead' each perform a single atomic
+    // addition unless a writer is present.  Writers are serialized by a mutex,
+    // and a writer holding that mutex causes new readers to block on it, so
+    // that writers are not starved by readers.
+
+    // PRIVATE TYPES
+    enum { k_WRITER = 0x40000000 };  // added to 'd_state' by the writer
+
+    // DATA
+    bsls::AtomicInt d_state;        // number of readers inside, plus
+                                    // 'k_WRITER' if a writer is present
+
+    bsls::BslLock   d_writerMutex;  // serializes writers, and blocks readers
+                                    // while a writer is present
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentHashMap_ShardLock(const ConcurrentHashMap_ShardLock&);
+    ConcurrentHashMap_ShardLock& operator=(
+                                           const ConcurrentHashMap_ShardLock&);
+
+    // PRIVATE MANIPULATORS
+    void lockReadSlow();
+        // Acquire this lock for reading, after a writer was observed to be
+        // present.
+
+  public:
+    // CREATORS
+    ConcurrentHashMap_ShardLock();
+        // Create a lock in the unlocked state.
+
+    // ~ConcurrentHashMap_ShardLock() = default;
+        // Destroy this object.  The behavior is undefined unless this lock is
+        // unlocked.
+
+    // MANIPULATORS
+    void lockRead();
+        // Acquire this lock for reading, blocking while a writer holds it.
+
+    void lockWrite();
+        // Acquire this lock for writing, blocking until no other thread holds
+        // it.
+
+    void unlockRead();
+        // Release this lock, which the calling thread holds for reading.
+
+    void unlockWrite();
+        // Release this lock, which the calling thread holds for writing.
+};
+
+                     // =================================
+                     // class ConcurrentHashMap_ReadGuard
+                     // =================================
+
+class ConcurrentHashMap_ReadGuard {
+    // This component-private class holds a 'ConcurrentHashMap_ShardLock' for
+    // reading during its lifetime.
+
+    // DATA
+    ConcurrentHashMap_ShardLock *d_lock_p;  // guarded lock (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentHashMap_ReadGuard(const ConcurrentHashMap_ReadGuard&);
+    ConcurrentHashMap_ReadGuard& operator=(
+                                           const ConcurrentHashMap_ReadGuard&);
+
+  public:
+    // CREATORS
+    explicit ConcurrentHashMap_ReadGuard(ConcurrentHashMap_ShardLock *lock);
+        // Create a guard that acquires the specified 'lock' for reading, and
+        // releases it upon destruction.
+
+    ~ConcurrentHashMap_ReadGuard();
+        // Release the lock held by this guard, and destroy this object.
+};
+
+                     // ==================================
+                     // class ConcurrentHashMap_WriteGuard
+                     // ==================================
+
+class ConcurrentHashMap_WriteGuard {
+    // This component-private class holds a 'ConcurrentHashMap_ShardLock' for
+    // writing during its lifetime.
+
+    // DATA
+    ConcurrentHashMap_ShardLock *d_lock_p;  // guarded lock (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentHashMap_WriteGuard(const ConcurrentHashMap_WriteGuard&);
+    ConcurrentHashMap_WriteGuard& operator=(
+                                          const ConcurrentHashMap_WriteGuard&);
+
+  public:
+    // CREATORS
+    explicit ConcurrentHashMap_WriteGuard(ConcurrentHashMap_ShardLock *lock);
+        // Create a guard that acquires the specified 'lock' for writing, and
+        // releases it upon destruction.
+
+    ~ConcurrentHashMap_WriteGuard();
+        // Release the lock held by this guard, and destroy this object.
+};
+
+                       // =============================
+                       // struct ConcurrentHashMap_Util
+                       // =============================
+
+struct ConcurrentHashMap_Util {
+    // This component-private 'struct' provides a namespace for the
+    // non-template computations of 'ConcurrentHashMap'.
+
+    // CLASS METHODS
+    static int numShardBits(int numShards);
+        // Return the base-2 logarithm of the specified 'numShards'.  The
+        // behavior is undefined unless 'numShards' is a positive power of 2.
+
+    static int shardIndex(bsl::size_t hashValue, int numShardBits);
+        // Return the index of the shard, among '2 ^ numShardBits' shards, to
+        // which a key having the specified 'hashValue' is assigned, computed
+        // from the high-order bits of the product of 'hashValue' and a
+        // constant derived from the golden ratio.  The behavior is undefined
+        // unless '0 <= numShardBits <= 16'.
+};
+
+                          // =======================
+                          // class ConcurrentHashMap
+                          // =======================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ConcurrentHashMap {
+    // This class template implements a thread-safe hash map from unique keys
+    // of the (template parameter) type 'KEY' to values of the (template
+    // parameter) type 'VALUE', using the (template parameter) types 'HASH' and
+    // 'EQUAL' to hash and compare keys.  The map is divided into a number of
+    // independently locked shards, fixed at construction, each of which is a
+    // 'bsl::unordered_map'.  'KEY' and 'VALUE' shall be copy-constructible,
+    // and 'VALUE' shall be copy-assignable.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16,    // number of shards by default
+        k_MAX_NUM_SHARDS     = 1024   // maximum number of shards
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<KEY, VALUE, HASH, EQUAL> Table;
+    typedef typename Table::iterator                    Iterator;
+    typedef typename Table::const_iterator              ConstIterator;
+
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line
+
+    struct Shard {
+        // This 'struct' holds one independently locked hash table.  The
+        // trailing padding keeps the locks of adjacent shards on distinct
+        // cache lines.
+
+        // DATA
+        ConcurrentHashMap_ShardLock d_lock;   // protects 'd_table'
+        Table                       d_table;  // elements of this shard
+        char                        d_padding[k_CACHE_LINE_SIZE];
+                                              // avoids false sharing
+
+        // CREATORS
+        Shard(const HASH&       hash,
+              const EQUAL&      equal,
+              bslma::Allocator *basicAllocator)
+            // Create an empty shard using the specified 'hash' and 'equal'
+            // functors, and the specified 'basicAllocator' to supply memory.
+        : d_table(0, hash, equal, basicAllocator)
+        {
+        }
+    };
+
+    // DATA
+    Shard            *d_shards_p;      // array of 'numShards()' shards
+    int               d_numShards;     // number of shards
+    int               d_numShardBits;  // base-2 logarithm of 'd_numShards'
+    HASH              d_hasher;        // hash functor selecting shards
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentHashMap(const ConcurrentHashMap&);
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&);
+
+    // PRIVATE MANIPULATORS
+    void init(const HASH& hash, const EQUAL& equal);
+        // Allocate and construct the shards of this map, using the specified
+        // 'hash' and 'equal' functors.
+
+    // PRIVATE ACCESSORS
+    Shard& shardForKey(const KEY& key) const;
+        // Return a reference providing modifiable access to the shard to
+        // which the specified 'key' is assigned.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ConcurrentHashMap,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ConcurrentHashMap(bslma::Allocator *basicAllocator = 0);
+        // Create an empty map having 'k_DEFAULT_NUM_SHARDS' shards, and using
+        // default-constructed 'HASH' and 'EQUAL' functors.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    explicit ConcurrentHashMap(int               numShards,
+                               bslma::Allocator *basicAllocator = 0);
+    ConcurrentHashMap(int               numShards,
+                      const HASH&       hash,
+                      const EQUAL&      equal,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create an empty map having the specified 'numShards' shards, and
+        // using the optionally specified 'hash' and 'equal' functors (or
+        // default-constructed ones, if not specified).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'numShards' is a power of 2, and
+        // '1 <= numShards <= k_MAX_NUM_SHARDS'.  Note that a number of shards
+        // several times the number of threads accessing the map keeps the
+        // probability of two threads contending for a shard low.
+
+    ~ConcurrentHashMap();
+        // Destroy this object.  The behavior is undefined unless no other
+        // thread is invoking a method on this object.
+
+    // MANIPULATORS
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element having the specified 'key', if
+        // any.  Return the number of elements removed (0 or 1).
+
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+        // Insert into this map an element having the specified 'key' and
+        // 'value', if this map contains no element having 'key'.  Return the
+        // number of elements inserted (0 or 1).  Note that, if 'key' is
+        // already present, its value is left unchanged.
+
+    void rehash(bsl::size_t numBuckets);
+        // Grow the bucket arrays of the shards of this map so that they total
+        // at least the specified 'numBuckets', locking one shard at a time.
+
+    void removeAll();
+        // Remove all elements from this map, locking one shard at a time.
+
+    void reserve(bsl::size_t numElements);
+        // Grow the bucket arrays of the shards of this map, and reserve nodes,
+        // so that the map can hold the specified 'numElements' elements,
+        // evenly distributed among the shards, without rehashing.  Lock one
+        // shard at a time.
+
+    bsl::size_t setValue(const KEY& key, const VALUE& value);
+        // Set the value of the element having the specified 'key' in this map
+        // to the specified 'value', inserting such an element if none exists.
+        // Return the number of elements inserted (0 or 1).
+
+    template <class UPDATER>
+    bsl::size_t update(const KEY& key, const UPDATER& updater);
+        // Invoke the specified 'updater' on the value of the element having
+        // the specified 'key' in this map, if any, as if by
+        // 'updater(&value, key)', while holding the lock of its shard for
+        // writing.  Return the number of elements updated (0 or 1).  The
+        // behavior is undefined if 'updater' invokes a method on this map.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        // Load into the specified 'value' a copy of the value of the element
+        // having the specified 'key' in this map, if any.  Return the number
+        // of elements found (0 or 1).  'value' is unchanged if 'key' is not
+        // found.
+
+    bool isEmpty() const;
+        // Return 'true' if this map was observed to contain no elements, and
+        // 'false' otherwise.
+
+    int numShards() const;
+        // Return the number of shards of this map.
+
+    bsl::size_t numBuckets() const;
+        // Return the total number of buckets of the shards of this map.
+
+    bsl::size_t size() const;
+        // Return the number of elements observed in this map.
+
+    template <class VISITOR>
+    bsl::size_t visit(const KEY& key, const VISITOR& visitor) const;
+        // Invoke the specified 'visitor' on the element having the specified
+        // 'key' in this map, if any, as if by 'visitor(key, value)', while
+        // holding the lock of its shard for reading.  Return the number of
+        // elements visited (0 or 1).  The behavior is undefined if 'visitor'
+        // invokes a method on this map.
+
+    template <class VISITOR>
+    bsl::size_t visitAll(const VISITOR& visitor) const;
+        // Invoke the specified 'visitor' on each element of this map, as if by
+        // 'visitor(key, value)', holding the lock of one shard at a time for
+        // reading.  Return the number of elements visited.  The behavior is
+        // undefined if 'visitor' invokes a method on this map.  Note that
+        // elements inserted or removed concurrently in other shards may or may
+        // not be visited.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // class ConcurrentHashMap_ShardLock
+                     // ---------------------------------
+
+// CREATORS
+inline
+ConcurrentHashMap_ShardLock::ConcurrentHashMap_ShardLock()
+: d_state(0)
+{
+}
+
+// MANIPULATORS
+inline
+void ConcurrentHashMap_ShardLock::lockRead()
+{
+    if (d_state.add(1) & k_WRITER) {
+        lockReadSlow();
+    }
+}
+
+inline
+void ConcurrentHashMap_ShardLock::unlockRead()
+{
+    d_state.add(-1);
+}
+
+inline
+void ConcurrentHashMap_ShardLock::unlockWrite()
+{
+    d_state.add(-k_WRITER);
+    d_writerMutex.unlock();
+}
+
+                     // ---------------------------------
+                     // class ConcurrentHashMap_ReadGuard
+                     // ---------------------------------
+
+// CREATORS
+inline
+ConcurrentHashMap_ReadGuard::ConcurrentHashMap_ReadGuard(
+                                             ConcurrentHashMap_ShardLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockRead();
+}
+
+inline
+ConcurrentHashMap_ReadGuard::~ConcurrentHashMap_ReadGuard()
+{
+    d_lock_p->unlockRead();
+}
+
+                     // ----------------------------------
+                     // class ConcurrentHashMap_WriteGuard
+                     // ----------------------------------
+
+// CREATORS
+inline
+ConcurrentHashMap_WriteGuard::ConcurrentHashMap_WriteGuard(
+                                             ConcurrentHashMap_ShardLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lockWrite();
+}
+
+inline
+ConcurrentHashMap_WriteGuard::~ConcurrentHashMap_WriteGuard()
+{
+    d_lock_p->unlockWrite();
+}
+
+                       // -----------------------------
+                       // struct ConcurrentHashMap_Util
+                       // -----------------------------
+
+// CLASS METHODS
+inline
+int ConcurrentHashMap_Util::shardIndex(bsl::size_t hashValue,
+                                       int         numShardBits)
+{
+    BSLS_ASSERT_SAFE(0 <= numShardBits);
+    BSLS_ASSERT_SAFE(     numShardBits <= 16);
+
+    if (0 == numShardBits) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Uint64 product =
+                                    static_cast<bsls::Types::Uint64>(hashValue)
+                                  * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>(product >> (64 - numShardBits));
+}
+
+                          // -----------------------
+                          // class ConcurrentHashMap
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::init(const HASH&  hash,
+                                                      const EQUAL& equal)
+{
+    d_shards_p = static_cast<Shard *>(
+                        d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(d_shards_p,
+                                                            d_allocator_p);
+    bslma::AutoDestructor<Shard> destructor(d_shards_p, 0);
+
+    for (int i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard(hash, equal, d_allocator_p);
+        ++destructor;
+    }
+
+    destructor.release();
+    deallocator.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::shardForKey(const KEY& key) const
+{
+    return d_shards_p[ConcurrentHashMap_Util::shardIndex(d_hasher(key),
+                                                         d_numShardBits)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_numShardBits(ConcurrentHashMap_Util::numShardBits(k_DEFAULT_NUM_SHARDS))
+, d_hasher()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentHashMap(
+                                              int               numShards,
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(numShards)
+, d_numShardBits(ConcurrentHashMap_Util::numShardBits(numShards))
+, d_hasher()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(numShards <= k_MAX_NUM_SHARDS);
+
+    init(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentHashMap(
+                                              int               numShards,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(numShards)
+, d_numShardBits(ConcurrentHashMap_Util::numShardBits(numShards))
+, d_hasher(hash)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(numShards <= k_MAX_NUM_SHARDS);
+
+    init(hash, equal);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::~ConcurrentHashMap()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Shard&                       shard = shardForKey(key);
+    ConcurrentHashMap_WriteGuard guard(&shard.d_lock);
+
+    return shard.d_table.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                                        const KEY&   key,
+                                                        const VALUE& value)
+{
+    Shard&                       shard = shardForKey(key);
+    ConcurrentHashMap_WriteGuard guard(&shard.d_lock);
+
+    return shard.d_table.insert(
+                     typename Table::value_type(key, value)).second ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t numBuckets)
+{
+    const bsl::size_t perShard = (numBuckets + d_numShards - 1) / d_numShards;
+
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_WriteGuard guard(&d_shards_p[i].d_lock);
+        d_shards_p[i].d_table.rehash(perShard);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::removeAll()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_WriteGuard guard(&d_shards_p[i].d_lock);
+        d_shards_p[i].d_table.clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::reserve(
+                                                       bsl::size_t numElements)
+{
+    const bsl::size_t perShard = (numElements + d_numShards - 1)
+                               / d_numShards;
+
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_WriteGuard guard(&d_shards_p[i].d_lock);
+        d_shards_p[i].d_table.reserve(perShard);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::setValue(
+                                                        const KEY&   key,
+                                                        const VALUE& value)
+{
+    Shard&                       shard = shardForKey(key);
+    ConcurrentHashMap_WriteGuard guard(&shard.d_lock);
+
+    bsl::pair<Iterator, bool> result = shard.d_table.insert(
+                                       typename Table::value_type(key, value));
+    if (!result.second) {
+        result.first->second = value;
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class UPDATER>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::update(
+                                                      const KEY&     key,
+                                                      const UPDATER& updater)
+{
+    Shard&                       shard = shardForKey(key);
+    ConcurrentHashMap_WriteGuard guard(&shard.d_lock);
+
+    Iterator it = shard.d_table.find(key);
+    if (shard.d_table.end() == it) {
+        return 0;                                                     // RETURN
+    }
+
+    updater(&it->second, it->first);
+    return 1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                        VALUE      *value,
+                                                        const KEY&  key) const
+{
+    BSLS_ASSERT_SAFE(value);
+
+    Shard&                      shard = shardForKey(key);
+    ConcurrentHashMap_ReadGuard guard(&shard.d_lock);
+
+    ConstIterator it = shard.d_table.find(key);
+    if (shard.d_table.end() == it) {
+        return 0;                                                     // RETURN
+    }
+    *value = it->second;
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::isEmpty() const
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_ReadGuard guard(&d_shards_p[i].d_lock);
+        if (!d_shards_p[i].d_table.empty()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::numBuckets() const
+{
+    bsl::size_t result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_ReadGuard guard(&d_shards_p[i].d_lock);
+        result += d_shards_p[i].d_table.bucket_count();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_ReadGuard guard(&d_shards_p[i].d_lock);
+        result += d_shards_p[i].d_table.size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::visit(
+                                                 const KEY&     key,
+                                                 const VISITOR& visitor) const
+{
+    Shard&                      shard = shardForKey(key);
+    ConcurrentHashMap_ReadGuard guard(&shard.d_lock);
+
+    ConstIterator it = shard.d_table.find(key);
+    if (shard.d_table.end() == it) {
+        return 0;                                                     // RETURN
+    }
+
+    visitor(it->first, it->second);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bsl::size_t ConcurrentHashMap<KEY, VALUE, HASH, EQUAL>::visitAll(
+                                                 const VISITOR& visitor) const
+{
+    bsl::size_t result = 0;
+    for (int i = 0; i < d_numShards; ++i) {
+        ConcurrentHashMap_ReadGuard guard(&d_shards_p[i].d_lock);
+
+        const Table& table = d_shards_p[i].d_table;
+        for (ConstIterator it = table.begin(); table.end() != it; ++it) {
+            visitor(it->first, it->second);
+            ++result;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1224 @@
+// bdlcc_concurrenthashmap.t.cpp                                      -*-C++-*-
+#include <bdlcc_concurrenthashmap.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsllock.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlcc::ConcurrentHashMap' is a thread-safe hash map built from a fixed
+// number of 'bslstl::HashTable' shards, each protected by a reader-biased
+// lock.  The primary concerns are that the map behaves as a map of unique keys
+// when used from a single thread, that keys are spread over all shards, that
+// every method holds the lock of the shard it touches (so that concurrent
+// modifications are neither lost nor corrupt the shards), that the shard lock
+// admits concurrent readers but excludes writers, and that all memory is
+// supplied by the allocator of the map.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentHashMap(Allocator *ba = 0);
+// [ 2] ConcurrentHashMap(int numShards, Allocator *ba = 0);
+// [ 2] ConcurrentHashMap(int ns, const HASH&, const EQUAL&, Allocator *);
+// [ 2] ~ConcurrentHashMap();
+//
+// MANIPULATORS
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] bsl::size_t insert(const KEY& key, const VALUE& value);
+// [ 4] void rehash(bsl::size_t numBuckets);
+// [ 3] void removeAll();
+// [ 4] void reserve(bsl::size_t numElements);
+// [ 3] bsl::size_t setValue(const KEY& key, const VALUE& value);
+// [ 3] bsl::size_t update(const KEY& key, const UPDATER& updater);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 2] bool isEmpty() const;
+// [ 2] int numShards() const;
+// [ 4] bsl::size_t numBuckets() const;
+// [ 2] bsl::size_t size() const;
+// [ 3] bsl::size_t visit(const KEY& key, const VISITOR& visitor) const;
+// [ 3] bsl::size_t visitAll(const VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: keys are spread over all shards.
+// [ 5] CONCERN: the shard lock admits readers and excludes writers.
+// [ 6] CONCERN: all methods are thread-safe.
+// [-1] PERFORMANCE: read-mostly throughput versus thread count
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlcc::ConcurrentHashMap<int, int>  Obj;
+typedef bdlcc::ConcurrentHashMap_ShardLock  ShardLock;
+typedef bdlcc::ConcurrentHashMap_Util       Util;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+struct ModuloHash {
+    // This 'struct' hashes integers to their residue modulo a divisor, so
+    // that distinct keys may be made to collide.
+
+    int d_divisor;
+
+    explicit ModuloHash(int divisor = 1000000) : d_divisor(divisor) {}
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+struct ModuloEqual {
+    // This 'struct' compares integers for equality modulo a divisor.
+
+    int d_divisor;
+
+    explicit ModuloEqual(int divisor = 1000000) : d_divisor(divisor) {}
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+struct AddTo {
+    // This 'struct' adds an amount to the value it is invoked on.
+
+    int d_amount;
+
+    explicit AddTo(int amount) : d_amount(amount) {}
+
+    void operator()(int *value, int) const
+    {
+        *value += d_amount;
+    }
+};
+
+struct KeyValueSummer {
+    // This 'struct' accumulates the keys and values it visits.
+
+    int *d_keySum_p;
+    int *d_valueSum_p;
+
+    KeyValueSummer(int *keySum, int *valueSum)
+    : d_keySum_p(keySum)
+    , d_valueSum_p(valueSum)
+    {
+    }
+
+    void operator()(int key, int value) const
+    {
+        *d_keySum_p   += key;
+        *d_valueSum_p += value;
+    }
+};
+
+namespace TestCase5 {
+
+struct ThreadInfo {
+    ShardLock       *d_lock_p;
+    bsls::AtomicInt *d_numReadersInside_p;
+    bsls::AtomicInt *d_maxReadersInside_p;
+    bsls::AtomicInt *d_numWritersInside_p;
+    int             *d_counter_p;
+    int              d_numIterations;
+};
+
+extern "C" void *readerThread(void *arg)
+{
+    // Repeatedly acquire the lock for reading, and verify that no writer is
+    // inside, while recording the maximum number of readers inside at once.
+
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        bdlcc::ConcurrentHashMap_ReadGuard guard(info->d_lock_p);
+
+        const int numReaders = info->d_numReadersInside_p->add(1);
+        ASSERT(0 == info->d_numWritersInside_p->loadAcquire());
+
+        int max = info->d_maxReadersInside_p->loadAcquire();
+        while (numReaders > max) {
+            max = info->d_maxReadersInside_p->testAndSwap(max, numReaders);
+        }
+
+        for (volatile int j = 0; j < 100; ++j) {
+        }
+        info->d_numReadersInside_p->add(-1);
+    }
+    return arg;
+}
+
+extern "C" void *writerThread(void *arg)
+{
+    // Repeatedly acquire the lock for writing, verify that no other thread is
+    // inside, and increment the counter without synchronization.
+
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        bdlcc::ConcurrentHashMap_WriteGuard guard(info->d_lock_p);
+
+        ASSERT(1 == info->d_numWritersInside_p->add(1));
+        ASSERT(0 == info->d_numReadersInside_p->loadAcquire());
+
+        ++*info->d_counter_p;
+
+        info->d_numWritersInside_p->add(-1);
+    }
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+namespace TestCase6 {
+
+enum { NUM_THREADS = 8, NUM_KEYS_PER_THREAD = 2000, NUM_SHARED_KEYS = 16 };
+
+struct ThreadInfo {
+    int  d_id;
+    Obj *d_obj_p;
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    // Insert a range of keys private to this thread, verify them, and erase
+    // every other one, while interleaving updates of keys shared by all
+    // threads, and lookups of keys private to other threads.
+
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+    Obj&        mX   = *info->d_obj_p;
+
+    const int BASE = (info->d_id + 1) * 100000;
+
+    for (int i = 0; i < NUM_KEYS_PER_THREAD; ++i) {
+        ASSERT(1 == mX.insert(BASE + i, i));
+        ASSERT(1 == mX.update(i % NUM_SHARED_KEYS, AddTo(1)));
+
+        int value = -1;
+        const int otherKey = (info->d_id + 1) % NUM_THREADS * 100000
+                           + 100000 + i;
+        if (mX.getValue(&value, otherKey)) {
+            // The other thread may have already assigned to its odd keys.
+
+            LOOP2_ASSERT(otherKey, value,
+                         i == value || (1 == i % 2 && 1 - i == value));
+        }
+    }
+    for (int i = 0; i < NUM_KEYS_PER_THREAD; ++i) {
+        int value = -1;
+        ASSERT(1 == mX.getValue(&value, BASE + i));
+        LOOP2_ASSERT(i, value, i == value);
+    }
+    for (int i = 0; i < NUM_KEYS_PER_THREAD; i += 2) {
+        ASSERT(1 == mX.erase(BASE + i));
+        ASSERT(0 == mX.setValue(BASE + i + 1, -i));
+    }
+    return arg;
+}
+
+}  // close namespace TestCase6
+
+namespace TestCaseMinus1 {
+
+struct LockedMap {
+    // This 'struct' serializes access to a 'bsl::unordered_map' with a single
+    // lock, the conventional alternative to a concurrent hash map.
+
+    bsl::unordered_map<int, int> d_map;
+    bsls::BslLock                d_lock;
+
+    bsl::size_t getValue(int *value, int key)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        bsl::unordered_map<int, int>::const_iterator it = d_map.find(key);
+        if (it == d_map.end()) {
+            return 0;                                                 // RETURN
+        }
+        *value = it->second;
+        return 1;
+    }
+
+    bsl::size_t setValue(int key, int value)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        d_map[key] = value;
+        return 1;
+    }
+};
+
+enum { NUM_KEYS = 1 << 16, WRITE_PERIOD = 16 };
+
+template <class MAP>
+struct ThreadInfo {
+    int  d_id;
+    int  d_numIterations;
+    MAP *d_map_p;
+};
+
+template <class MAP>
+void *benchmarkThread(void *arg)
+{
+    // Look up pseudo-random keys, setting the value of one key in every
+    // 'WRITE_PERIOD' operations.
+
+    ThreadInfo<MAP> *info = static_cast<ThreadInfo<MAP> *>(arg);
+    MAP&             map  = *info->d_map_p;
+
+    unsigned int seed  = info->d_id * 7919 + 1;
+    int          value = 0;
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const int key = static_cast<int>((seed >> 8) % NUM_KEYS);
+        if (0 == i % WRITE_PERIOD) {
+            map.setValue(key, i);
+        }
+        else {
+            map.getValue(&value, key);
+        }
+    }
+    return arg;
+}
+
+template <class MAP>
+double runBenchmark(MAP *map, int numThreads, int numIterations)
+    // Return the elapsed wall time (in seconds) for the specified
+    // 'numThreads' threads to each perform the specified 'numIterations'
+    // operations on the specified 'map'.
+{
+    enum { MAX_THREADS = 64 };
+
+    ThreadInfo<MAP> info[MAX_THREADS];
+    ThreadId        ids[MAX_THREADS];
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numThreads; ++i) {
+        ThreadInfo<MAP> ti = { i, numIterations, map };
+        info[i] = ti;
+        ids[i]  = createThread(&benchmarkThread<MAP>, &info[i]);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace TestCaseMinus1
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Cache Shared by Many Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads price orders using instrument reference data,
+// which is loaded on first use and then read far more often than it is
+// modified.
+//
+// First, we define the reference data, and a functor that adds a traded
+// quantity to it:
+//..
+    struct InstrumentData {
+        double d_tickSize;      // minimum price increment
+        int    d_tradedVolume;  // volume traded today
+    };
+
+    struct AddVolume {
+        int d_quantity;  // quantity to add
+
+        explicit AddVolume(int quantity) : d_quantity(quantity) {}
+
+        void operator()(InstrumentData *data, int) const
+        {
+            data->d_tradedVolume += d_quantity;
+        }
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create the cache, keyed by instrument identifier, shared by all
+// threads (the thread creation code is elided):
+//..
+    bdlcc::ConcurrentHashMap<int, InstrumentData> cache;
+//..
+// Next, a thread that finds an instrument missing from the cache loads its
+// data and inserts it.  Should another thread have inserted the same
+// instrument in the meantime, 'insert' keeps the existing value and returns 0:
+//..
+    InstrumentData loaded = { 0.01, 0 };
+    bsl::size_t    numInserted = cache.insert(1234, loaded);
+    ASSERT(1 == numInserted);
+//..
+// Then, pricing threads copy the data out, holding the lock of the shard only
+// for the duration of the copy:
+//..
+    InstrumentData data;
+    if (cache.getValue(&data, 1234)) {
+        ASSERT(0.01 == data.d_tickSize);
+    }
+//..
+// Finally, a thread recording a trade updates the value in place, under the
+// lock of its shard, so that no concurrent update is lost:
+//..
+    cache.update(1234, AddVolume(100));
+    cache.update(1234, AddVolume(50));
+
+    cache.getValue(&data, 1234);
+    ASSERT(150 == data.d_tradedVolume);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that all methods are thread-safe.
+        //
+        // Concerns:
+        //: 1 Elements inserted concurrently by several threads into the same
+        //:   shards are all present afterwards, with their values intact.
+        //:
+        //: 2 Concurrent updates of the same element are not lost.
+        //:
+        //: 3 Lookups concurrent with insertions and rehashes of the same shard
+        //:   find either nothing or the inserted value.
+        //:
+        //: 4 Concurrent erasures and assignments are applied exactly once.
+        //
+        // Plan:
+        //: 1 Run several threads, each of which inserts a range of private
+        //:   keys into a map having few shards and a single initial bucket
+        //:   per shard (so that shards are rehashed under contention),
+        //:   increments the values of keys shared by all threads, looks up
+        //:   the keys of another thread, and finally erases or assigns its own
+        //:   keys.  (C-1..4)
+        //:
+        //: 2 After joining the threads, verify the size of the map, and the
+        //:   values of the shared and the surviving private keys.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: all methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase6;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int numShards = 1; numShards <= 16; numShards *= 4) {
+            if (veryVerbose) { P(numShards); }
+
+            Obj mX(numShards, &sa);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_SHARED_KEYS; ++i) {
+                mX.insert(i, 0);
+            }
+
+            ThreadInfo info[NUM_THREADS];
+            ThreadId   ids[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ThreadInfo ti = { i, &mX };
+                info[i] = ti;
+                ids[i]  = createThread(&workerThread, &info[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+            }
+
+            LOOP_ASSERT(X.size(),
+                        NUM_SHARED_KEYS + NUM_THREADS * NUM_KEYS_PER_THREAD / 2
+                                                                 == X.size());
+
+            for (int i = 0; i < NUM_SHARED_KEYS; ++i) {
+                int value = -1;
+                ASSERT(1 == X.getValue(&value, i));
+                LOOP2_ASSERT(i, value,
+                       NUM_THREADS * NUM_KEYS_PER_THREAD / NUM_SHARED_KEYS
+                                                                    == value);
+            }
+            for (int t = 0; t < NUM_THREADS; ++t) {
+                const int BASE = (t + 1) * 100000;
+                for (int i = 0; i < NUM_KEYS_PER_THREAD; i += 2) {
+                    int value = 1;
+                    LOOP2_ASSERT(t, i, 0 == X.getValue(&value, BASE + i));
+                    LOOP2_ASSERT(t, i, 1 == X.getValue(&value, BASE + i + 1));
+                    LOOP3_ASSERT(t, i, value, -i == value);
+                }
+            }
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SHARD LOCK
+        //   Ensure that the shard lock admits concurrent readers and excludes
+        //   writers.
+        //
+        // Concerns:
+        //: 1 The lock may be acquired and released repeatedly, for reading
+        //:   and for writing, by a single thread.
+        //:
+        //: 2 No reader is inside the lock while a writer is, and no two
+        //:   writers are inside the lock at once.
+        //:
+        //: 3 Several readers may be inside the lock at once.
+        //:
+        //: 4 Writers make progress while readers continually acquire the
+        //:   lock.
+        //
+        // Plan:
+        //: 1 Acquire and release the lock in a single thread using the guard
+        //:   classes.  (C-1)
+        //:
+        //: 2 Run reader and writer threads concurrently, tracking the number
+        //:   of threads of each kind inside the lock, and having writers
+        //:   increment a counter without further synchronization.  Verify the
+        //:   counter after joining the threads.  (C-2, 4)
+        //:
+        //: 3 Verify that more than one reader was observed inside the lock at
+        //:   once, if the readers ran by themselves.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: the shard lock admits readers and excludes writers.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARD LOCK" << endl
+                          << "==========" << endl;
+
+        using namespace TestCase5;
+
+        {
+            ShardLock lock;
+            for (int i = 0; i < 3; ++i) {
+                {
+                    bdlcc::ConcurrentHashMap_ReadGuard g1(&lock);
+                    bdlcc::ConcurrentHashMap_ReadGuard g2(&lock);
+                }
+                {
+                    bdlcc::ConcurrentHashMap_WriteGuard guard(&lock);
+                }
+            }
+        }
+
+        enum { NUM_READERS = 4, NUM_WRITERS = 4, NUM_ITERATIONS = 20000 };
+
+        for (int withWriters = 0; withWriters < 2; ++withWriters) {
+            ShardLock       lock;
+            bsls::AtomicInt numReadersInside(0);
+            bsls::AtomicInt maxReadersInside(0);
+            bsls::AtomicInt numWritersInside(0);
+            int             counter = 0;
+
+            ThreadInfo info = { &lock,
+                                &numReadersInside,
+                                &maxReadersInside,
+                                &numWritersInside,
+                                &counter,
+                                NUM_ITERATIONS };
+
+            ThreadId ids[NUM_READERS + NUM_WRITERS];
+            int      numThreads = 0;
+
+            for (int i = 0; i < NUM_READERS; ++i) {
+                ids[numThreads++] = createThread(&readerThread, &info);
+                if (withWriters) {
+                    ids[numThreads++] = createThread(&writerThread, &info);
+                }
+            }
+            for (int i = 0; i < numThreads; ++i) {
+                joinThread(ids[i]);
+            }
+
+            if (veryVerbose) { P_(withWriters); P(maxReadersInside); }
+
+            LOOP_ASSERT(counter,
+                        withWriters * NUM_WRITERS * NUM_ITERATIONS == counter);
+            ASSERT(0 == numReadersInside);
+            ASSERT(0 == numWritersInside);
+            if (!withWriters) {
+                ASSERT(1 < maxReadersInside);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SHARDING AND REHASHING
+        //   Ensure that keys are spread over all shards, and that 'rehash' and
+        //   'reserve' grow the bucket arrays of the shards.
+        //
+        // Concerns:
+        //: 1 'Util::numShardBits' returns the base-2 logarithm of its
+        //:   argument.
+        //:
+        //: 2 'Util::shardIndex' returns 0 if there is a single shard, and
+        //:   otherwise spreads consecutive hash values (as produced by the
+        //:   identity hash of 'bsl::hash<int>') evenly over all shards.
+        //:
+        //: 3 'numBuckets' returns the total over all shards, and grows as
+        //:   elements are inserted.
+        //:
+        //: 4 'rehash' and 'reserve' give each shard its share of the
+        //:   requested buckets, and do not alter the elements.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify 'numShardBits' for every power of 2 up to the maximum
+        //:   number of shards.  (C-1)
+        //:
+        //: 2 For several numbers of shards, count the shard indices of a
+        //:   sequence of consecutive hash values, and verify that every shard
+        //:   receives a share within 20% of the mean.  (C-2)
+        //:
+        //: 3 Insert elements, then invoke 'rehash' and 'reserve', verifying
+        //:   'numBuckets' and the elements after each step.  (C-3..4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid numbers of shards.  (C-5)
+        //
+        // Testing:
+        //   void rehash(bsl::size_t numBuckets);
+        //   void reserve(bsl::size_t numElements);
+        //   bsl::size_t numBuckets() const;
+        //   CONCERN: keys are spread over all shards.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARDING AND REHASHING" << endl
+                          << "======================" << endl;
+
+        if (verbose) cout << "\nTesting 'numShardBits'." << endl;
+
+        for (int bits = 0; (1 << bits) <= Obj::k_MAX_NUM_SHARDS; ++bits) {
+            LOOP_ASSERT(bits, bits == Util::numShardBits(1 << bits));
+        }
+
+        if (verbose) cout << "\nTesting 'shardIndex'." << endl;
+
+        ASSERT(0 == Util::shardIndex(0,    0));
+        ASSERT(0 == Util::shardIndex(1234, 0));
+
+        for (int bits = 1; bits <= 6; ++bits) {
+            enum { NUM_HASHES = 64 * 1024 };
+
+            const int NUM_SHARDS = 1 << bits;
+            int       counts[64] = { 0 };
+
+            for (int h = 0; h < NUM_HASHES; ++h) {
+                const int index = Util::shardIndex(h, bits);
+                LOOP2_ASSERT(bits, index, 0 <= index && index < NUM_SHARDS);
+                ++counts[index];
+            }
+
+            const int MEAN = NUM_HASHES / NUM_SHARDS;
+            for (int i = 0; i < NUM_SHARDS; ++i) {
+                LOOP3_ASSERT(bits, i, counts[i],
+                             MEAN * 4 / 5 <= counts[i]
+                          && counts[i]    <= MEAN * 6 / 5);
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'rehash' and 'reserve'." << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            const bsl::size_t INITIAL = X.numBuckets();
+            LOOP_ASSERT(INITIAL, 4 <= INITIAL);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, -i);
+            }
+            LOOP_ASSERT(X.numBuckets(), INITIAL < X.numBuckets());
+            LOOP_ASSERT(X.numBuckets(), 100 <= X.numBuckets());
+
+            mX.rehash(1000);
+            LOOP_ASSERT(X.numBuckets(), 1000 <= X.numBuckets());
+
+            const bsl::size_t AFTER_REHASH = X.numBuckets();
+            mX.rehash(10);
+            LOOP_ASSERT(X.numBuckets(), AFTER_REHASH == X.numBuckets());
+
+            mX.reserve(5000);
+            LOOP_ASSERT(X.numBuckets(), 5000 <= X.numBuckets());
+
+            ASSERT(100 == X.size());
+            for (int i = 0; i < 100; ++i) {
+                int value = 1;
+                LOOP_ASSERT(i, 1 == X.getValue(&value, i));
+                LOOP_ASSERT(i, -i == value);
+            }
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(0, &sa));
+            ASSERT_FAIL(Obj(3, &sa));
+            ASSERT_FAIL(Obj(Obj::k_MAX_NUM_SHARDS * 2, &sa));
+            ASSERT_PASS(Obj(Obj::k_MAX_NUM_SHARDS, &sa));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VISITING AND UPDATING
+        //   Ensure that the methods accessing elements in place, and those
+        //   assigning and removing elements in bulk, behave as documented.
+        //
+        // Concerns:
+        //: 1 'setValue' inserts a missing element, returning 1, and assigns to
+        //:   an existing one, returning 0.
+        //:
+        //: 2 'update' invokes the updater on the value of an existing element
+        //:   (and passes its key), returning 1, and returns 0 otherwise.
+        //:
+        //: 3 'visit' invokes the visitor on an existing element, returning 1,
+        //:   and returns 0 otherwise.
+        //:
+        //: 4 'visitAll' invokes the visitor once on every element of every
+        //:   shard, and returns the number of elements.
+        //:
+        //: 5 'removeAll' removes every element, and the map remains usable.
+        //
+        // Plan:
+        //: 1 Using a map with several shards, exercise each method on present
+        //:   and absent keys, verifying return values and the resulting
+        //:   values with 'getValue'.  (C-1..3)
+        //:
+        //: 2 Accumulate the keys and values visited by 'visitAll', and compare
+        //:   them with the expected sums.  (C-4)
+        //:
+        //: 3 Invoke 'removeAll', verify that the map is empty, and reinsert.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void removeAll();
+        //   bsl::size_t setValue(const KEY& key, const VALUE& value);
+        //   bsl::size_t update(const KEY& key, const UPDATER& updater);
+        //   bsl::size_t visit(const KEY& key, const VISITOR& visitor) const;
+        //   bsl::size_t visitAll(const VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VISITING AND UPDATING" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            int value = 0;
+
+            ASSERT(1 == mX.setValue(1, 10));
+            ASSERT(1 == X.getValue(&value, 1));  ASSERT(10 == value);
+            ASSERT(0 == mX.setValue(1, 11));
+            ASSERT(1 == X.getValue(&value, 1));  ASSERT(11 == value);
+            ASSERT(1 == X.size());
+
+            ASSERT(1 == mX.update(1, AddTo(5)));
+            ASSERT(1 == X.getValue(&value, 1));  ASSERT(16 == value);
+            ASSERT(0 == mX.update(2, AddTo(5)));
+            ASSERT(0 == X.getValue(&value, 2));
+            ASSERT(1 == X.size());
+
+            int keySum   = 0;
+            int valueSum = 0;
+            ASSERT(1 == X.visit(1, KeyValueSummer(&keySum, &valueSum)));
+            ASSERT(1 == keySum);
+            ASSERT(16 == valueSum);
+            ASSERT(0 == X.visit(2, KeyValueSummer(&keySum, &valueSum)));
+            ASSERT(1 == keySum);
+
+            enum { NUM_ELEMENTS = 500 };
+
+            int expectedKeySum   = 0;
+            int expectedValueSum = 0;
+            mX.removeAll();
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERT(1 == mX.setValue(i, 2 * i));
+                expectedKeySum   += i;
+                expectedValueSum += 2 * i;
+            }
+
+            keySum   = 0;
+            valueSum = 0;
+            ASSERT(NUM_ELEMENTS == X.visitAll(KeyValueSummer(&keySum,
+                                                             &valueSum)));
+            LOOP_ASSERT(keySum,   expectedKeySum   == keySum);
+            LOOP_ASSERT(valueSum, expectedValueSum == valueSum);
+
+            mX.removeAll();
+            ASSERT(0 == X.size());
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.visitAll(KeyValueSummer(&keySum, &valueSum)));
+
+            ASSERT(1 == mX.insert(7, 70));
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //   Ensure that a map can be created with each constructor, and that
+        //   'insert', 'erase', and 'getValue' behave as for a map of unique
+        //   keys.
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty map having the requested
+        //:   number of shards, and using the intended allocator.
+        //:
+        //: 2 'insert' adds a missing element, returning 1, and leaves an
+        //:   existing element unchanged, returning 0.
+        //:
+        //: 3 'erase' removes an existing element, returning 1, and returns 0
+        //:   otherwise.
+        //:
+        //: 4 'getValue' loads the value of an existing element, returning 1,
+        //:   and otherwise returns 0, leaving its argument unchanged.
+        //:
+        //: 5 'size' and 'isEmpty' reflect the elements in all shards.
+        //:
+        //: 6 The supplied hash and equality functors are used both to select
+        //:   shards and within shards.
+        //:
+        //: 7 All memory comes from the supplied allocator, and is released by
+        //:   the destructor.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor, with and without an
+        //:   allocator, and verify 'numShards', 'allocator', 'size', and
+        //:   'isEmpty'.  (C-1)
+        //:
+        //: 2 Insert, look up, and erase a set of keys, verifying the return
+        //:   values and 'size' after each operation.  (C-2..5)
+        //:
+        //: 3 Use functors treating keys equal modulo a divisor, and verify
+        //:   that keys so equal are treated as one key.  (C-6)
+        //:
+        //: 4 Use test allocators to verify memory usage.  (C-7)
+        //
+        // Testing:
+        //   ConcurrentHashMap(Allocator *ba = 0);
+        //   ConcurrentHashMap(int numShards, Allocator *ba = 0);
+        //   ConcurrentHashMap(int ns, const HASH&, const EQUAL&, Allocator *);
+        //   ~ConcurrentHashMap();
+        //   bsl::size_t erase(const KEY& key);
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bslma::Allocator *allocator() const;
+        //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        //   bool isEmpty() const;
+        //   int numShards() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(&da == X.allocator());
+            ASSERT(0 == X.size());
+            ASSERT(X.isEmpty());
+            ASSERT(0 < da.numBlocksInUse());
+            ASSERT(0 == sa.numBlocksTotal());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(&sa == X.allocator());
+            ASSERT(0 < sa.numBlocksInUse());
+        }
+        {
+            Obj mX(1, &sa);  const Obj& X = mX;
+            ASSERT(1 == X.numShards());
+            ASSERT(&sa == X.allocator());
+        }
+        {
+            Obj mX(64);  const Obj& X = mX;
+            ASSERT(64 == X.numShards());
+            ASSERT(&da == X.allocator());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+
+        if (verbose) cout << "\nTesting 'insert', 'erase', 'getValue'."
+                          << endl;
+
+        for (int numShards = 1; numShards <= 64; numShards *= 2) {
+            enum { NUM_KEYS = 200 };
+
+            Obj mX(numShards, &sa);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                int value = -1;
+                LOOP2_ASSERT(numShards, i, 0 == X.getValue(&value, i));
+                LOOP2_ASSERT(numShards, i, -1 == value);
+
+                LOOP2_ASSERT(numShards, i, 1 == mX.insert(i, i * i));
+                LOOP2_ASSERT(numShards, i, 0 == mX.insert(i, 0));
+                LOOP2_ASSERT(numShards, i, i + 1 == (int)X.size());
+                LOOP2_ASSERT(numShards, i, !X.isEmpty());
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                int value = -1;
+                LOOP2_ASSERT(numShards, i, 1 == X.getValue(&value, i));
+                LOOP2_ASSERT(numShards, i, i * i == value);
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                LOOP2_ASSERT(numShards, i, 1 == mX.erase(i));
+                LOOP2_ASSERT(numShards, i, 0 == mX.erase(i));
+                LOOP2_ASSERT(numShards, i, NUM_KEYS - i - 1 == (int)X.size());
+
+                int value = -1;
+                LOOP2_ASSERT(numShards, i, 0 == X.getValue(&value, i));
+            }
+            LOOP_ASSERT(numShards, X.isEmpty());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+        if (verbose) cout << "\nTesting supplied functors." << endl;
+        {
+            typedef bdlcc::ConcurrentHashMap<int, int, ModuloHash, ModuloEqual>
+                                                                      ObjMod;
+
+            ObjMod mX(8, ModuloHash(100), ModuloEqual(100), &sa);
+            const ObjMod& X = mX;
+
+            ASSERT(1 == mX.insert(5, 1));
+            ASSERT(0 == mX.insert(105, 2));
+            ASSERT(1 == X.size());
+
+            int value = 0;
+            ASSERT(1 == X.getValue(&value, 205));
+            ASSERT(1 == value);
+            ASSERT(1 == mX.erase(305));
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, look up, update, and erase elements, and
+        //:   verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            bdlcc::ConcurrentHashMap<bsl::string, int> mX(&sa);
+
+            ASSERT(1 == mX.insert("one", 1));
+            ASSERT(1 == mX.insert("two", 2));
+            ASSERT(0 == mX.insert("one", 3));
+            ASSERT(2 == mX.size());
+
+            int value = 0;
+            ASSERT(1 == mX.getValue(&value, "one"));
+            ASSERT(1 == value);
+
+            ASSERT(0 == mX.setValue("two", 22));
+            ASSERT(1 == mX.getValue(&value, "two"));
+            ASSERT(22 == value);
+
+            ASSERT(1 == mX.erase("one"));
+            ASSERT(0 == mX.getValue(&value, "one"));
+            ASSERT(1 == mX.size());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: READ-MOSTLY THROUGHPUT VERSUS THREAD COUNT
+        //   Compare the throughput of a 'ConcurrentHashMap' with that of a
+        //   lock-protected 'bsl::unordered_map' under a read-mostly workload
+        //   as the number of threads grows.
+        //
+        // Concerns:
+        //: 1 The concurrent hash map outperforms the lock-protected map under
+        //:   contention.
+        //
+        // Plan:
+        //: 1 For thread counts of 1 to 32, run a workload of lookups of random
+        //:   keys, with one assignment in every 16 operations, against each
+        //:   map, and report the elapsed wall time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: read-mostly throughput versus thread count
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: READ-MOSTLY THROUGHPUT VERSUS "
+                          << "THREAD COUNT" << endl
+                          << "==========================================="
+                          << "============" << endl;
+
+        using namespace TestCaseMinus1;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        cout << "threads\tconcurrent\tlocked" << endl;
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj       concurrent(64);
+            LockedMap locked;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                concurrent.setValue(i, i);
+                locked.setValue(i, i);
+            }
+
+            const double tc = runBenchmark(&concurrent,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+            const double tl = runBenchmark(&locked,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+
+            cout << numThreads << '\t' << tc << '\t' << tl << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
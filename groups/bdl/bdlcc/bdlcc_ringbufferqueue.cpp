@@ -0,0 +1,47 @@
+// bdlcc_ringbufferqueue.cpp                                          -*-C++-*-
+#include <bdlcc_ringbufferqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_ringbufferqueue_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The design follows the bounded multi-producer/multi-consumer queue of
+// Dmitry Vyukov.  The sequence of the cell of position 'p' takes, in turn, the
+// values 'p' (free for the push of 'p'), 'p + 1' (published, ready for the pop
+// of 'p'), and 'p + capacity' (free for the push of the position of the next
+// lap).  A thread claiming a position compares the sequence of its cell with
+// the value expected for the operation: if the sequence is behind, the queue
+// is full (or empty), and if it is ahead, another thread has already claimed
+// the position, and the cursor must be reread.  Since the sequences of a lap
+// and of the next lap differ by the capacity, the capacity must be at least
+// 2, so that a published cell is never mistaken for a free one.
+//
+// The positions are 64-bit counters that, in practice, never wrap.
+//
+// A batch claims the longest run of consecutive positions, starting at the
+// cursor, whose cells are ready for the operation.  No other thread can make
+// such a cell unready before the cursor is advanced past it, because only the
+// thread that claims a position modifies the sequence of its cell.
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
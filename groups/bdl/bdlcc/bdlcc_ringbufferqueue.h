@@ -0,0 +1,908 @@
+// bdlcc_ringbufferqueue.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLCC_RINGBUFFERQUEUE
+#define INCLUDED_BDLCC_RINGBUFFERQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a bounded lock-free queue passing values between threads.
+//
+//@CLASSES:
+//  bdlcc::RingBufferQueue: bounded lock-free FIFO queue of values
+//  bdlcc::RingBufferQueueMode: namespace for producer/consumer modes
+//
+//@SEE_ALSO: bdlcc_concurrenthashmap
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::RingBufferQueue', implementing a first-in first-out queue of values
+// having a capacity fixed at construction, into which threads push values,
+// and from which threads pop them, without acquiring any lock.  A
+// 'bdlcc::RingBufferQueue' is intended to replace a 'bsl::deque' protected by
+// a mutex wherever values are handed from one set of threads to another, such
+// as from a thread receiving market data to the threads processing it.
+//
+///Storage
+///-------
+// The values in the queue are held in a circular array of *cells*, allocated
+// once, at construction, from the allocator supplied to the queue, so that
+// pushing and popping values never allocates memory (other than what the
+// copy constructor of the value type may allocate).  The capacity of the queue
+// is the requested capacity rounded up to a power of 2 (and at least 2), so
+// that a position in the queue is mapped to a cell by a bitwise AND.
+//
+///Sequence Counters
+///-----------------
+// Each cell holds, besides storage for a value, a *sequence* counter that
+// records which position of the queue the cell may next be used for, and
+// whether a value has been published in it for that position.  Two further
+// counters, the push and pop *cursors*, hold the next position to be pushed
+// and popped.  A producer claims a position by advancing the push cursor
+// (with a compare-and-swap, if several producers may compete for it),
+// provided that the sequence of the cell of the position shows it is free,
+// then constructs the value in the cell, and finally publishes it by storing
+// a new sequence.  Consumers proceed symmetrically.  Consequently, a producer
+// and a consumer touch common memory only in the cell of the value passed
+// between them, and the only contention is among producers (or consumers)
+// for their cursor.  The cursors are kept on separate cache lines, so that
+// producers and consumers do not invalidate each other's caches.
+//
+///Modes
+///-----
+// The (template parameter) 'MODE' of a 'bdlcc::RingBufferQueue' states how
+// many threads may push and pop values concurrently:
+//..
+//  Mode                                 Producers      Consumers
+//  -----------------------------------  -------------  -------------
+//  e_MULTI_PRODUCER_MULTI_CONSUMER      any number     any number
+//  e_MULTI_PRODUCER_SINGLE_CONSUMER     any number     one at a time
+//  e_SINGLE_PRODUCER_SINGLE_CONSUMER    one at a time  one at a time
+//..
+// A side of the queue limited to a single thread at a time advances its
+// cursor with a plain atomic store rather than a compare-and-swap, which is
+// both cheaper and free of retries.  The behavior is undefined if more than
+// one thread concurrently pushes to (or pops from) a side of the queue that
+// its mode limits to a single thread.
+//
+///Batches
+///-------
+// 'tryPushBackBatch' and 'tryPopFrontBatch' claim as many consecutive
+// positions as are available (up to the number requested) with a single
+// advance of the cursor, thus amortizing the cost of contention over the
+// batch.  Note that values pushed in a single batch are popped in order, but
+// may be interleaved with values pushed concurrently by other producers only
+// before or after the batch, never within it.
+//
+///Exception Safety
+///----------------
+// If the copy constructor of 'TYPE' throws while a value is pushed, the
+// exception propagates to the caller, and the position claimed for the value
+// is marked empty; consumers skip it, and the queue remains usable.  Values
+// of a batch following the failed one are not pushed.  If the assignment
+// operator of 'TYPE' throws while a value is popped, the exception propagates
+// to the caller, and that value (and the remaining values claimed by the same
+// batch) are destroyed without being returned.
+//
+///Thread Safety
+///-------------
+// All methods of 'bdlcc::RingBufferQueue', except the destructor, may be
+// invoked concurrently, subject to the limits on concurrent producers and
+// consumers of the mode of the queue.  The results of 'numElements',
+// 'isEmpty', and 'isFull' may be stale by the time they are returned if other
+// threads are modifying the queue concurrently.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Market Data
+///- - - - - - - - - - - - - - - - -
+// Suppose that a thread receives price updates from a network connection, and
+// hands them to a single thread maintaining an order book.
+//
+// First, we define the type of a price update:
+//..
+//  struct PriceUpdate {
+//      int    d_instrumentId;  // identifier of the instrument
+//      double d_price;         // new price of the instrument
+//  };
+//..
+// Then, we create a queue, shared by the two threads, in the mode allowing a
+// single producer and a single consumer (the thread creation code is
+// elided):
+//..
+//  typedef bdlcc::RingBufferQueueMode Mode;
+//
+//  bdlcc::RingBufferQueue<PriceUpdate,
+//                         Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>
+//                                                               queue(1000);
+//  assert(1024 == queue.capacity());
+//..
+// Next, the receiving thread pushes the updates decoded from a network
+// packet as a batch.  Should the queue be full, the receiving thread may
+// retry, drop updates, or apply back pressure, according to its needs:
+//..
+//  PriceUpdate received[3] = { { 1, 10.5 }, { 2, 20.25 }, { 1, 10.75 } };
+//
+//  bsl::size_t numPushed = queue.tryPushBackBatch(received, 3);
+//  assert(3 == numPushed);
+//..
+// Finally, the order book thread pops updates, up to 16 at a time, and
+// processes them in order:
+//..
+//  PriceUpdate updates[16];
+//
+//  bsl::size_t numPopped = queue.tryPopFrontBatch(updates, 16);
+//  assert(3     == numPopped);
+//  assert(1     == updates[0].d_instrumentId);
+//  assert(10.75 == updates[2].d_price);
+//
+//  assert(0 != queue.tryPopFront(updates));  // the queue is empty
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>        // for 'bsl::size_t'
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ==========================
+                        // struct RingBufferQueueMode
+                        // ==========================
+
+struct RingBufferQueueMode {
+    // This 'struct' provides a namespace for enumerating the numbers of
+    // threads that may concurrently push values to, and pop values from, a
+    // 'RingBufferQueue'.
+
+    // TYPES
+    enum Enum {
+        e_MULTI_PRODUCER_MULTI_CONSUMER,    // any number of producers and
+                                            // consumers
+
+        e_MULTI_PRODUCER_SINGLE_CONSUMER,   // any number of producers, and one
+                                            // consumer at a time
+
+        e_SINGLE_PRODUCER_SINGLE_CONSUMER   // one producer and one consumer at
+                                            // a time
+    };
+};
+
+                       // ============================
+                       // class RingBufferQueue_Cursor
+                       // ============================
+
+template <bool IS_SHARED>
+class RingBufferQueue_Cursor {
+    // This component-private class template holds the next position at which
+    // values are pushed to (or popped from) a 'RingBufferQueue'.  If the
+    // (template parameter) 'IS_SHARED' is 'true', the cursor is advanced by a
+    // compare-and-swap, so that several threads may compete to advance it;
+    // otherwise, it is advanced by a plain atomic store, and only one thread
+    // at a time may advance it.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations AtomicOp;
+
+    // DATA
+    AtomicOp::AtomicTypes::Int64 d_position;  // next position
+
+  private:
+    // NOT IMPLEMENTED
+    RingBufferQueue_Cursor(const RingBufferQueue_Cursor&);
+    RingBufferQueue_Cursor& operator=(const RingBufferQueue_Cursor&);
+
+  public:
+    // CREATORS
+    RingBufferQueue_Cursor();
+        // Create a cursor at position 0.
+
+    // MANIPULATORS
+    bool advance(bsls::Types::Int64 *position,
+                 bsls::Types::Int64  numPositions);
+        // Advance this cursor by the specified 'numPositions', provided that
+        // it is at the specified 'position'.  Return 'true' on success, and
+        // otherwise load the current position of this cursor into 'position'
+        // and return 'false'.  The behavior is undefined unless this cursor
+        // was observed at 'position', and, if 'IS_SHARED' is 'false', no
+        // other thread is advancing this cursor.
+
+    // ACCESSORS
+    bsls::Types::Int64 position() const;
+        // Return the current position of this cursor.
+};
+
+                           // =====================
+                           // class RingBufferQueue
+                           // =====================
+
+template <class TYPE,
+          RingBufferQueueMode::Enum MODE =
+                          RingBufferQueueMode::e_MULTI_PRODUCER_MULTI_CONSUMER>
+class RingBufferQueue {
+    // This class template implements a bounded first-in first-out queue of
+    // values of the (template parameter) 'TYPE', stored in a circular array
+    // allocated at construction, into which threads push values, and from
+    // which threads pop them, without acquiring any lock.  The (template
+    // parameter) 'MODE' states how many threads may concurrently push and pop
+    // values (see {Modes}).  'TYPE' shall be copy-constructible and
+    // copy-assignable.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations AtomicOp;
+    typedef bsls::Types::Int64     Int64;
+
+    enum {
+        k_CACHE_LINE_SIZE = 64,  // assumed size of a cache line
+
+        k_SHARED_PUSH = MODE != RingBufferQueueMode::
+                                             e_SINGLE_PRODUCER_SINGLE_CONSUMER,
+                                 // whether producers compete for the cursor
+
+        k_SHARED_POP  = MODE == RingBufferQueueMode::
+                                               e_MULTI_PRODUCER_MULTI_CONSUMER
+                                 // whether consumers compete for the cursor
+    };
+
+    struct Cell {
+        // This 'struct' holds storage for one value of the queue.  A cell
+        // whose 'd_sequence' equals position 'p' is free to be pushed at
+        // 'p', and one whose 'd_sequence' equals 'p + 1' holds the value
+        // pushed at 'p' (if 'd_hasValue' is 'true'), ready to be popped.
+
+        AtomicOp::AtomicTypes::Int64 d_sequence;  // see above
+        bool                         d_hasValue;  // 'false' if the push
+                                                  // failed
+        bsls::ObjectBuffer<TYPE>     d_value;     // value, if any
+    };
+
+    class PushProctor {
+        // This class marks as empty, and publishes, the cells of the claimed
+        // positions remaining in its range upon destruction.
+
+        // DATA
+        RingBufferQueue *d_queue_p;   // queue holding the cells
+        Int64            d_position;  // first position not pushed
+        Int64            d_end;       // end of claimed range
+
+      public:
+        // CREATORS
+        PushProctor(RingBufferQueue *queue, Int64 position, Int64 end);
+            // Create a proctor for the range of positions from the specified
+            // 'position' to the specified 'end' of the specified 'queue'.
+
+        ~PushProctor();
+            // Mark as empty and publish the cells of the positions remaining
+            // in the range of this proctor, and destroy this object.
+
+        // MANIPULATORS
+        void advance();
+            // Remove the first position from the range of this proctor.
+    };
+
+    class PopProctor {
+        // This class destroys the values of, and frees, the cells of the
+        // claimed positions remaining in its range upon destruction.
+
+        // DATA
+        RingBufferQueue *d_queue_p;   // queue holding the cells
+        Int64            d_position;  // first position not popped
+        Int64            d_end;       // end of claimed range
+
+      public:
+        // CREATORS
+        PopProctor(RingBufferQueue *queue, Int64 position, Int64 end);
+            // Create a proctor for the range of positions from the specified
+            // 'position' to the specified 'end' of the specified 'queue'.
+
+        ~PopProctor();
+            // Destroy the values of, and free, the cells of the positions
+            // remaining in the range of this proctor, and destroy this object.
+
+        // MANIPULATORS
+        void advance();
+            // Remove the first position from the range of this proctor.
+    };
+
+    friend class PushProctor;
+    friend class PopProctor;
+
+    // DATA
+    Cell                                *d_cells_p;     // circular array
+    Int64                                d_mask;        // capacity - 1
+    bslma::Allocator                    *d_allocator_p; // memory allocator
+                                                        // (held, not owned)
+
+    char                                 d_pushPadding[k_CACHE_LINE_SIZE];
+    RingBufferQueue_Cursor<k_SHARED_PUSH>
+                                         d_pushCursor;  // next to push
+    char                                 d_popPadding[k_CACHE_LINE_SIZE];
+    RingBufferQueue_Cursor<k_SHARED_POP>
+                                         d_popCursor;   // next to pop
+    char                                 d_trailingPadding[k_CACHE_LINE_SIZE];
+
+  private:
+    // NOT IMPLEMENTED
+    RingBufferQueue(const RingBufferQueue&);
+    RingBufferQueue& operator=(const RingBufferQueue&);
+
+    // PRIVATE MANIPULATORS
+    Int64 claimForPop(Int64 *position, Int64 maxNumPositions);
+        // Claim up to the specified 'maxNumPositions' consecutive positions
+        // of this queue whose cells hold published values, load the first of
+        // them into the specified 'position', and return the number claimed.
+        // Return 0 if this queue was observed to be empty.
+
+    Int64 claimForPush(Int64 *position, Int64 maxNumPositions);
+        // Claim up to the specified 'maxNumPositions' consecutive positions
+        // of this queue whose cells are free, load the first of them into the
+        // specified 'position', and return the number claimed.  Return 0 if
+        // this queue was observed to be full.
+
+    void freeCell(Int64 position);
+        // Make the cell of the specified 'position', whose value (if any) has
+        // been destroyed, free to be pushed to at the next lap of the queue.
+
+    void publishCell(Int64 position, bool hasValue);
+        // Publish the cell of the specified 'position', recording whether it
+        // holds a value according to the specified 'hasValue'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingBufferQueue,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit RingBufferQueue(bsl::size_t       capacity,
+                             bslma::Allocator *basicAllocator = 0);
+        // Create an empty queue able to hold at least the specified
+        // 'capacity' values.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '1 <= capacity'.  Note that the capacity of the queue is rounded up
+        // to a power of 2, and to at least 2.
+
+    ~RingBufferQueue();
+        // Destroy the values remaining in this queue, and destroy this object.
+        // The behavior is undefined unless no other thread is invoking a
+        // method on this object.
+
+    // MANIPULATORS
+    int tryPopFront(TYPE *value);
+        // Assign to the specified 'value' the value at the front of this
+        // queue, and remove it from the queue, if this queue is not empty.
+        // Return 0 on success, and a non-zero value if this queue was
+        // observed to be empty.
+
+    bsl::size_t tryPopFrontBatch(TYPE *values, bsl::size_t maxNumValues);
+        // Assign to the elements of the specified 'values' array, in order,
+        // up to the specified 'maxNumValues' values at the front of this
+        // queue, and remove them from the queue.  Return the number of values
+        // assigned, which is 0 if this queue was observed to be empty.  The
+        // behavior is undefined unless 'values' refers to an array of at
+        // least 'maxNumValues' elements.
+
+    int tryPushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, if this
+        // queue is not full.  Return 0 on success, and a non-zero value if
+        // this queue was observed to be full.
+
+    bsl::size_t tryPushBackBatch(const TYPE  *values,
+                                 bsl::size_t  numValues);
+        // Append to the back of this queue, in order, as many of the
+        // specified 'numValues' values of the specified 'values' array as
+        // fit in the queue.  Return the number of values appended, which is 0
+        // if this queue was observed to be full.  The behavior is undefined
+        // unless 'values' refers to an array of at least 'numValues'
+        // elements.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this queue to supply memory.
+
+    bsl::size_t capacity() const;
+        // Return the maximum number of values this queue can hold.
+
+    bool isEmpty() const;
+        // Return 'true' if this queue was observed to hold no values, and
+        // 'false' otherwise.
+
+    bool isFull() const;
+        // Return 'true' if this queue was observed to hold 'capacity()'
+        // values, and 'false' otherwise.
+
+    bsl::size_t numElements() const;
+        // Return the number of values (including values being pushed or
+        // popped concurrently) observed in this queue.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class RingBufferQueue_Cursor
+                       // ----------------------------
+
+// CREATORS
+template <bool IS_SHARED>
+inline
+RingBufferQueue_Cursor<IS_SHARED>::RingBufferQueue_Cursor()
+{
+    AtomicOp::initInt64(&d_position, 0);
+}
+
+// MANIPULATORS
+template <bool IS_SHARED>
+inline
+bool RingBufferQueue_Cursor<IS_SHARED>::advance(
+                                      bsls::Types::Int64 *position,
+                                      bsls::Types::Int64  numPositions)
+{
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(0 < numPositions);
+
+    if (!IS_SHARED) {
+        AtomicOp::setInt64Release(&d_position, *position + numPositions);
+        return true;                                                  // RETURN
+    }
+
+    const bsls::Types::Int64 previous = AtomicOp::testAndSwapInt64AcqRel(
+                                                     &d_position,
+                                                     *position,
+                                                     *position + numPositions);
+    if (previous == *position) {
+        return true;                                                  // RETURN
+    }
+    *position = previous;
+    return false;
+}
+
+// ACCESSORS
+template <bool IS_SHARED>
+inline
+bsls::Types::Int64 RingBufferQueue_Cursor<IS_SHARED>::position() const
+{
+    return AtomicOp::getInt64Acquire(&d_position);
+}
+
+                   // ----------------------------------
+                   // class RingBufferQueue::PushProctor
+                   // ----------------------------------
+
+// CREATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+RingBufferQueue<TYPE, MODE>::PushProctor::PushProctor(
+                                                     RingBufferQueue *queue,
+                                                     Int64            position,
+                                                     Int64            end)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(end)
+{
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+RingBufferQueue<TYPE, MODE>::PushProctor::~PushProctor()
+{
+    for (; d_position < d_end; ++d_position) {
+        d_queue_p->publishCell(d_position, false);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+void RingBufferQueue<TYPE, MODE>::PushProctor::advance()
+{
+    ++d_position;
+}
+
+                   // ---------------------------------
+                   // class RingBufferQueue::PopProctor
+                   // ---------------------------------
+
+// CREATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+RingBufferQueue<TYPE, MODE>::PopProctor::PopProctor(
+                                                     RingBufferQueue *queue,
+                                                     Int64            position,
+                                                     Int64            end)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(end)
+{
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+RingBufferQueue<TYPE, MODE>::PopProctor::~PopProctor()
+{
+    for (; d_position < d_end; ++d_position) {
+        Cell& cell = d_queue_p->d_cells_p[d_position & d_queue_p->d_mask];
+        if (cell.d_hasValue) {
+            bslalg::ScalarDestructionPrimitives::destroy(
+                                                     &cell.d_value.object());
+        }
+        d_queue_p->freeCell(d_position);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+void RingBufferQueue<TYPE, MODE>::PopProctor::advance()
+{
+    ++d_position;
+}
+
+                           // ---------------------
+                           // class RingBufferQueue
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+bsls::Types::Int64 RingBufferQueue<TYPE, MODE>::claimForPop(
+                                                Int64 *position,
+                                                Int64  maxNumPositions)
+{
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(0 < maxNumPositions);
+
+    Int64 first = d_popCursor.position();
+    for (;;) {
+        Int64 numReady = 0;
+        for (; numReady < maxNumPositions; ++numReady) {
+            const Int64 current = first + numReady;
+            const Int64 lag     = AtomicOp::getInt64Acquire(
+                                       &d_cells_p[current & d_mask].d_sequence)
+                                - (current + 1);
+            if (0 != lag) {
+                if (0 == numReady && 0 < lag) {
+                    // Another consumer popped 'first' since we read the
+                    // cursor.
+
+                    numReady = -1;
+                }
+                break;
+            }
+        }
+
+        if (0 > numReady) {
+            first = d_popCursor.position();
+            continue;
+        }
+        if (0 == numReady) {
+            return 0;                                                 // RETURN
+        }
+        if (d_popCursor.advance(&first, numReady)) {
+            *position = first;
+            return numReady;                                          // RETURN
+        }
+    }
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+bsls::Types::Int64 RingBufferQueue<TYPE, MODE>::claimForPush(
+                                                Int64 *position,
+                                                Int64  maxNumPositions)
+{
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(0 < maxNumPositions);
+
+    Int64 first = d_pushCursor.position();
+    for (;;) {
+        Int64 numFree = 0;
+        for (; numFree < maxNumPositions; ++numFree) {
+            const Int64 current = first + numFree;
+            const Int64 lag     = AtomicOp::getInt64Acquire(
+                                       &d_cells_p[current & d_mask].d_sequence)
+                                - current;
+            if (0 != lag) {
+                if (0 == numFree && 0 < lag) {
+                    // Another producer pushed 'first' since we read the
+                    // cursor.
+
+                    numFree = -1;
+                }
+                break;
+            }
+        }
+
+        if (0 > numFree) {
+            first = d_pushCursor.position();
+            continue;
+        }
+        if (0 == numFree) {
+            return 0;                                                 // RETURN
+        }
+        if (d_pushCursor.advance(&first, numFree)) {
+            *position = first;
+            return numFree;                                           // RETURN
+        }
+    }
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+void RingBufferQueue<TYPE, MODE>::freeCell(Int64 position)
+{
+    AtomicOp::setInt64Release(&d_cells_p[position & d_mask].d_sequence,
+                              position + d_mask + 1);
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+void RingBufferQueue<TYPE, MODE>::publishCell(Int64 position, bool hasValue)
+{
+    Cell& cell = d_cells_p[position & d_mask];
+
+    cell.d_hasValue = hasValue;
+    AtomicOp::setInt64Release(&cell.d_sequence, position + 1);
+}
+
+// CREATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+RingBufferQueue<TYPE, MODE>::RingBufferQueue(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_cells_p(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= capacity);
+
+    bsl::size_t actualCapacity = 2;
+    while (actualCapacity < capacity) {
+        actualCapacity <<= 1;
+    }
+
+    d_cells_p = static_cast<Cell *>(
+                      d_allocator_p->allocate(actualCapacity * sizeof(Cell)));
+    d_mask    = static_cast<Int64>(actualCapacity) - 1;
+
+    for (bsl::size_t i = 0; i < actualCapacity; ++i) {
+        AtomicOp::initInt64(&d_cells_p[i].d_sequence, static_cast<Int64>(i));
+        d_cells_p[i].d_hasValue = false;
+    }
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+RingBufferQueue<TYPE, MODE>::~RingBufferQueue()
+{
+    const Int64 end = d_pushCursor.position();
+    for (Int64 i = d_popCursor.position(); i < end; ++i) {
+        Cell& cell = d_cells_p[i & d_mask];
+        if (cell.d_hasValue) {
+            bslalg::ScalarDestructionPrimitives::destroy(
+                                                     &cell.d_value.object());
+        }
+    }
+    d_allocator_p->deallocate(d_cells_p);
+}
+
+// MANIPULATORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+int RingBufferQueue<TYPE, MODE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT_SAFE(value);
+
+    Int64 position;
+    while (claimForPop(&position, 1)) {
+        Cell& cell = d_cells_p[position & d_mask];
+        if (!cell.d_hasValue) {
+            // The push of this position failed; skip it.
+
+            freeCell(position);
+            continue;
+        }
+
+        // The proctor destroys the value and frees the cell, whether or not
+        // the assignment throws.
+
+        PopProctor proctor(this, position, position + 1);
+        *value = cell.d_value.object();
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+bsl::size_t RingBufferQueue<TYPE, MODE>::tryPopFrontBatch(
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == maxNumValues);
+
+    bsl::size_t numPopped = 0;
+    while (0 < maxNumValues && 0 == numPopped) {
+        Int64       position;
+        const Int64 numClaimed = claimForPop(
+                                         &position,
+                                         static_cast<Int64>(maxNumValues));
+        if (0 == numClaimed) {
+            break;
+        }
+
+        PopProctor proctor(this, position, position + numClaimed);
+        for (Int64 i = position; i < position + numClaimed; ++i) {
+            Cell& cell = d_cells_p[i & d_mask];
+            if (cell.d_hasValue) {
+                values[numPopped++] = cell.d_value.object();
+                bslalg::ScalarDestructionPrimitives::destroy(
+                                                     &cell.d_value.object());
+                cell.d_hasValue = false;
+            }
+            freeCell(i);
+            proctor.advance();
+        }
+    }
+    return numPopped;
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+int RingBufferQueue<TYPE, MODE>::tryPushBack(const TYPE& value)
+{
+    Int64 position;
+    if (0 == claimForPush(&position, 1)) {
+        return 1;                                                     // RETURN
+    }
+
+    PushProctor proctor(this, position, position + 1);
+    bslalg::ScalarPrimitives::copyConstruct(
+                               &d_cells_p[position & d_mask].d_value.object(),
+                                value,
+                                d_allocator_p);
+    proctor.advance();
+    publishCell(position, true);
+    return 0;
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+bsl::size_t RingBufferQueue<TYPE, MODE>::tryPushBackBatch(
+                                                    const TYPE  *values,
+                                                    bsl::size_t  numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+
+    if (0 == numValues) {
+        return 0;                                                     // RETURN
+    }
+
+    Int64       position;
+    const Int64 numClaimed = claimForPush(&position,
+                                          static_cast<Int64>(numValues));
+
+    PushProctor proctor(this, position, position + numClaimed);
+    for (Int64 i = 0; i < numClaimed; ++i) {
+        bslalg::ScalarPrimitives::copyConstruct(
+                         &d_cells_p[(position + i) & d_mask].d_value.object(),
+                          values[i],
+                          d_allocator_p);
+        proctor.advance();
+        publishCell(position + i, true);
+    }
+    return static_cast<bsl::size_t>(numClaimed);
+}
+
+// ACCESSORS
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+bslma::Allocator *RingBufferQueue<TYPE, MODE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+bsl::size_t RingBufferQueue<TYPE, MODE>::capacity() const
+{
+    return static_cast<bsl::size_t>(d_mask + 1);
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+bool RingBufferQueue<TYPE, MODE>::isEmpty() const
+{
+    return 0 == numElements();
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+inline
+bool RingBufferQueue<TYPE, MODE>::isFull() const
+{
+    return capacity() == numElements();
+}
+
+template <class TYPE, RingBufferQueueMode::Enum MODE>
+bsl::size_t RingBufferQueue<TYPE, MODE>::numElements() const
+{
+    // Read the pop cursor first, so that the difference is not negative
+    // unless the cursors move between the reads.
+
+    const Int64 popPosition  = d_popCursor.position();
+    const Int64 pushPosition = d_pushCursor.position();
+    const Int64 difference   = pushPosition - popPosition;
+
+    if (difference <= 0) {
+        return 0;                                                     // RETURN
+    }
+    if (difference > d_mask + 1) {
+        return capacity();                                            // RETURN
+    }
+    return static_cast<bsl::size_t>(difference);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
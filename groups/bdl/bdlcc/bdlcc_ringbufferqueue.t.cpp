@@ -0,0 +1,1344 @@
+// bdlcc_ringbufferqueue.t.cpp                                        -*-C++-*-
+#include <bdlcc_ringbufferqueue.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsllock.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlcc::RingBufferQueue' is a bounded lock-free FIFO queue whose cells carry
+// sequence counters, in three modes differing in the numbers of threads that
+// may push and pop concurrently.  The primary concerns are that, in every
+// mode, the queue behaves as a bounded FIFO queue when used from a single
+// thread (including across many laps of its circular array), that batches
+// push and pop as many values as fit, that a throwing copy or assignment
+// leaves the queue usable, that values are neither lost, duplicated, nor
+// reordered when pushed and popped concurrently, and that all memory is
+// supplied by the allocator of the queue.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RingBufferQueue(bsl::size_t capacity, Allocator *ba = 0);
+// [ 2] ~RingBufferQueue();
+//
+// MANIPULATORS
+// [ 2] int tryPopFront(TYPE *value);
+// [ 3] bsl::size_t tryPopFrontBatch(TYPE *values, bsl::size_t max);
+// [ 2] int tryPushBack(const TYPE& value);
+// [ 3] bsl::size_t tryPushBackBatch(const TYPE *values, bsl::size_t num);
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bool isFull() const;
+// [ 2] bsl::size_t numElements() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: a throwing copy or assignment leaves the queue usable.
+// [ 5] CONCERN: values pushed and popped concurrently are delivered in order.
+// [-1] PERFORMANCE: throughput versus a lock-protected 'bsl::deque'
+// [-2] PERFORMANCE: round-trip latency versus a lock-protected 'bsl::deque'
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlcc::RingBufferQueueMode Mode;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+void yieldThread()
+    // Offer the remainder of the time slice of the calling thread to other
+    // threads.  Note that waiting threads must yield, since the test machine
+    // may have fewer processors than the test has threads.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+static
+bsl::string makeValue(int i)
+    // Return a string, long enough to allocate memory, holding the specified
+    // 'i'.
+{
+    bsl::string result("a value too long for the short string buffer #");
+    result.push_back(static_cast<char>('0' + i % 10));
+    result.push_back(static_cast<char>('0' + i / 10 % 10));
+    result.push_back(static_cast<char>('0' + i / 100 % 10));
+    return result;
+}
+
+class ThrowingValue {
+    // This class holds an 'int' whose copy constructor and assignment
+    // operator throw on demand.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static bool s_throwOnCopy;    // whether the copy constructor throws
+    static bool s_throwOnAssign;  // whether the assignment operator throws
+
+    // CREATORS
+    explicit ThrowingValue(int value = 0) : d_value(value) {}
+
+    ThrowingValue(const ThrowingValue& original)
+    : d_value(original.d_value)
+    {
+        if (s_throwOnCopy) {
+            throw 1;
+        }
+    }
+
+    // MANIPULATORS
+    ThrowingValue& operator=(const ThrowingValue& rhs)
+    {
+        if (s_throwOnAssign) {
+            throw 2;
+        }
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+bool ThrowingValue::s_throwOnCopy   = false;
+bool ThrowingValue::s_throwOnAssign = false;
+
+template <Mode::Enum MODE>
+void testPushPop(bool verbose, bool veryVerbose, bool veryVeryVeryVerbose)
+    // Test 'tryPushBack', 'tryPopFront', and the basic accessors of a queue
+    // in the specified 'MODE'.  Print progress if the specified 'verbose' or
+    // 'veryVerbose' is 'true', and trace allocations if the specified
+    // 'veryVeryVeryVerbose' is 'true'.
+{
+    typedef bdlcc::RingBufferQueue<bsl::string, MODE> Obj;
+
+    if (verbose) { T_ P(MODE); }
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+    bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+
+    static const struct {
+        int         d_line;
+        bsl::size_t d_requested;
+        bsl::size_t d_expected;
+    } DATA[] = {
+        //LINE  REQUESTED  EXPECTED
+        //----  ---------  --------
+        { L_,           1,        2 },
+        { L_,           2,        2 },
+        { L_,           3,        4 },
+        { L_,           8,        8 },
+        { L_,          17,       32 },
+        { L_,        1000,     1024 },
+    };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE     = DATA[ti].d_line;
+        const bsl::size_t CAPACITY = DATA[ti].d_expected;
+
+        if (veryVerbose) { T_ T_ P_(LINE) P(CAPACITY); }
+
+        {
+            Obj mX(DATA[ti].d_requested, &sa);  const Obj& X = mX;
+
+            LOOP_ASSERT(LINE, CAPACITY == X.capacity());
+            LOOP_ASSERT(LINE, &sa      == X.allocator());
+            LOOP_ASSERT(LINE, 0        == X.numElements());
+            LOOP_ASSERT(LINE, X.isEmpty());
+            LOOP_ASSERT(LINE, !X.isFull());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+            // Fill and drain the queue, partially and fully, for several laps
+            // of its circular array.
+
+            int nextPush = 0;
+            int nextPop  = 0;
+            for (bsl::size_t lap = 0; lap < 5; ++lap) {
+                const bsl::size_t NUM_VALUES = lap % 2
+                                             ? CAPACITY
+                                             : CAPACITY / 2 + 1;
+
+                for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                    LOOP2_ASSERT(LINE, i, 0 == mX.tryPushBack(
+                                                       makeValue(nextPush++)));
+                    LOOP2_ASSERT(LINE, i, i + 1 == X.numElements());
+                    LOOP2_ASSERT(LINE, i, !X.isEmpty());
+                }
+                if (CAPACITY == NUM_VALUES) {
+                    LOOP_ASSERT(LINE, X.isFull());
+                    LOOP_ASSERT(LINE, 0 != mX.tryPushBack(makeValue(0)));
+                    LOOP_ASSERT(LINE, CAPACITY == X.numElements());
+                }
+                for (bsl::size_t i = 0; i < NUM_VALUES; ++i) {
+                    bsl::string value;
+                    LOOP2_ASSERT(LINE, i, 0 == mX.tryPopFront(&value));
+                    LOOP2_ASSERT(LINE, i, makeValue(nextPop++) == value);
+                    LOOP2_ASSERT(LINE, i,
+                                 NUM_VALUES - i - 1 == X.numElements());
+                    LOOP2_ASSERT(LINE, i, !X.isFull());
+                }
+
+                bsl::string value("unchanged");
+                LOOP_ASSERT(LINE, 0 != mX.tryPopFront(&value));
+                LOOP_ASSERT(LINE, "unchanged" == value);
+                LOOP_ASSERT(LINE, X.isEmpty());
+            }
+
+            // Every value allocated once, when copied into the queue, and was
+            // released when popped; only the cells remain.
+
+            LOOP_ASSERT(LINE, nextPush + NUM_ALLOCATIONS
+                                                      == sa.numAllocations());
+            LOOP_ASSERT(LINE, 1 == sa.numBlocksInUse());
+
+            // Leave values in the queue for the destructor.
+
+            for (int i = 0; i < 2; ++i) {
+                LOOP_ASSERT(LINE, 0 == mX.tryPushBack(makeValue(i)));
+            }
+        }
+        LOOP_ASSERT(LINE, 0 == sa.numBytesInUse());
+    }
+    ASSERT(0 == da.numBytesInUse());
+}
+
+template <Mode::Enum MODE>
+void testBatches(bool verbose, bool veryVerbose)
+    // Test 'tryPushBackBatch' and 'tryPopFrontBatch' of a queue in the
+    // specified 'MODE'.  Print progress if the specified 'verbose' or
+    // 'veryVerbose' is 'true'.
+{
+    typedef bdlcc::RingBufferQueue<int, MODE> Obj;
+
+    if (verbose) { T_ P(MODE); }
+
+    enum { CAPACITY = 16, MAX_BATCH = 40 };
+
+    bslma::TestAllocator sa("supplied");
+
+    Obj mX(CAPACITY, &sa);  const Obj& X = mX;
+
+    int values[MAX_BATCH];
+    int popped[MAX_BATCH];
+
+    ASSERT(0 == mX.tryPushBackBatch(values, 0));
+    ASSERT(0 == mX.tryPopFrontBatch(popped, 0));
+    ASSERT(0 == mX.tryPopFrontBatch(popped, MAX_BATCH));
+
+    int nextPush = 0;
+    int nextPop  = 0;
+    for (int pushSize = 1; pushSize <= MAX_BATCH; pushSize += 3) {
+        for (int popSize = 1; popSize <= MAX_BATCH; popSize += 5) {
+            if (veryVerbose) { T_ T_ P_(pushSize) P(popSize); }
+
+            const int ROOM = CAPACITY - static_cast<int>(X.numElements());
+
+            for (int i = 0; i < pushSize; ++i) {
+                values[i] = nextPush + i;
+            }
+            const int NUM_PUSHED = static_cast<int>(
+                                       mX.tryPushBackBatch(values, pushSize));
+            LOOP2_ASSERT(pushSize, NUM_PUSHED,
+                         (pushSize < ROOM ? pushSize : ROOM) == NUM_PUSHED);
+            nextPush += NUM_PUSHED;
+
+            const int SIZE = static_cast<int>(X.numElements());
+
+            const int NUM_POPPED = static_cast<int>(
+                                         mX.tryPopFrontBatch(popped, popSize));
+            LOOP2_ASSERT(popSize, NUM_POPPED,
+                         (popSize < SIZE ? popSize : SIZE) == NUM_POPPED);
+            for (int i = 0; i < NUM_POPPED; ++i) {
+                LOOP3_ASSERT(pushSize, popSize, i, nextPop++ == popped[i]);
+            }
+        }
+    }
+
+    // Drain the queue with single pops, which must see the batched values.
+
+    int value;
+    while (0 == mX.tryPopFront(&value)) {
+        ASSERT(nextPop++ == value);
+    }
+    ASSERT(nextPush == nextPop);
+    ASSERT(X.isEmpty());
+}
+
+template <Mode::Enum MODE>
+void testExceptions(bool verbose)
+    // Test that throwing copies and assignments leave a queue in the
+    // specified 'MODE' usable.  Print progress if the specified 'verbose' is
+    // 'true'.
+{
+    typedef bdlcc::RingBufferQueue<ThrowingValue, MODE> Obj;
+
+    if (verbose) { T_ P(MODE); }
+
+    bslma::TestAllocator sa("supplied");
+
+    Obj mX(8, &sa);  const Obj& X = mX;
+
+    ThrowingValue values[5];
+    for (int i = 0; i < 5; ++i) {
+        values[i] = ThrowingValue(i);
+    }
+
+    // A push whose copy throws leaves an empty position that pops skip.
+
+    ASSERT(0 == mX.tryPushBack(values[1]));
+    ThrowingValue::s_throwOnCopy = true;
+    try {
+        mX.tryPushBack(values[2]);
+        ASSERT(!"exception not thrown");
+    }
+    catch (int e) {
+        ASSERT(1 == e);
+    }
+    ThrowingValue::s_throwOnCopy = false;
+    ASSERT(0 == mX.tryPushBack(values[3]));
+
+    ThrowingValue popped[5];
+    ASSERT(0 == mX.tryPopFront(popped));
+    ASSERT(1 == popped[0].value());
+    ASSERT(0 == mX.tryPopFront(popped));
+    ASSERT(3 == popped[0].value());
+    ASSERT(0 != mX.tryPopFront(popped));
+    ASSERT(X.isEmpty());
+
+    // So does a batch, and an all-empty claim does not end a batch pop.
+
+    ThrowingValue::s_throwOnCopy = true;
+    try {
+        mX.tryPushBackBatch(values, 5);
+        ASSERT(!"exception not thrown");
+    }
+    catch (int e) {
+        ASSERT(1 == e);
+    }
+    ThrowingValue::s_throwOnCopy = false;
+    ASSERT(0 == X.numElements() || 5 == X.numElements());
+
+    ASSERT(2 == mX.tryPushBackBatch(values + 3, 2));
+    ASSERT(2 == mX.tryPopFrontBatch(popped, 5));
+    ASSERT(3 == popped[0].value());
+    ASSERT(4 == popped[1].value());
+    ASSERT(X.isEmpty());
+
+    // A pop whose assignment throws removes the value.
+
+    ASSERT(0 == mX.tryPushBack(values[1]));
+    ASSERT(0 == mX.tryPushBack(values[2]));
+    ThrowingValue::s_throwOnAssign = true;
+    try {
+        mX.tryPopFront(popped);
+        ASSERT(!"exception not thrown");
+    }
+    catch (int e) {
+        ASSERT(2 == e);
+    }
+    ThrowingValue::s_throwOnAssign = false;
+    ASSERT(1 == X.numElements());
+    ASSERT(0 == mX.tryPopFront(popped));
+    ASSERT(2 == popped[0].value());
+
+    ASSERT(0 == mX.tryPushBack(values[1]));
+    ASSERT(0 == mX.tryPushBack(values[2]));
+    ThrowingValue::s_throwOnAssign = true;
+    try {
+        mX.tryPopFrontBatch(popped, 5);
+        ASSERT(!"exception not thrown");
+    }
+    catch (int e) {
+        ASSERT(2 == e);
+    }
+    ThrowingValue::s_throwOnAssign = false;
+    ASSERT(X.isEmpty());
+
+    ASSERT(0 == mX.tryPushBack(values[4]));
+    ASSERT(0 == mX.tryPopFront(popped));
+    ASSERT(4 == popped[0].value());
+}
+
+namespace TestCase5 {
+
+enum {
+    NUM_VALUES_PER_PRODUCER = 20000,
+    MAX_THREADS             = 8,
+    BATCH_SIZE              = 7
+};
+
+template <class QUEUE>
+struct ThreadInfo {
+    int              d_id;
+    bool             d_useBatches;
+    QUEUE           *d_queue_p;
+    bsls::AtomicInt *d_numPopped_p;   // total popped by all consumers
+    int              d_numExpected;   // total to be popped
+    bsls::Types::Int64
+                     d_sum;           // sum of values popped by consumer
+};
+
+template <class QUEUE>
+void *producerThread(void *arg)
+{
+    // Push the values 'id * NUM_VALUES_PER_PRODUCER + i', for 'i' in
+    // increasing order, retrying while the queue is full.
+
+    ThreadInfo<QUEUE> *info  = static_cast<ThreadInfo<QUEUE> *>(arg);
+    QUEUE&             queue = *info->d_queue_p;
+
+    const int BASE = info->d_id * NUM_VALUES_PER_PRODUCER;
+
+    int i = 0;
+    while (i < NUM_VALUES_PER_PRODUCER) {
+        if (info->d_useBatches) {
+            int values[BATCH_SIZE];
+            int n = NUM_VALUES_PER_PRODUCER - i;
+            if (n > BATCH_SIZE) {
+                n = BATCH_SIZE;
+            }
+            for (int j = 0; j < n; ++j) {
+                values[j] = BASE + i + j;
+            }
+            const int numPushed = static_cast<int>(
+                                            queue.tryPushBackBatch(values, n));
+            i += numPushed;
+            if (0 == numPushed) {
+                yieldThread();
+            }
+        }
+        else if (0 == queue.tryPushBack(BASE + i)) {
+            ++i;
+        }
+        else {
+            yieldThread();
+        }
+    }
+    return arg;
+}
+
+template <class QUEUE>
+void *consumerThread(void *arg)
+{
+    // Pop values until all producers' values have been popped by some
+    // consumer, verifying that the values of each producer arrive in
+    // increasing order, and summing them.
+
+    ThreadInfo<QUEUE> *info  = static_cast<ThreadInfo<QUEUE> *>(arg);
+    QUEUE&             queue = *info->d_queue_p;
+
+    int lastSeen[MAX_THREADS];
+    for (int i = 0; i < MAX_THREADS; ++i) {
+        lastSeen[i] = -1;
+    }
+
+    while (*info->d_numPopped_p < info->d_numExpected) {
+        int values[BATCH_SIZE];
+        int n;
+        if (info->d_useBatches) {
+            n = static_cast<int>(queue.tryPopFrontBatch(values, BATCH_SIZE));
+        }
+        else {
+            n = 0 == queue.tryPopFront(values) ? 1 : 0;
+        }
+        if (0 == n) {
+            yieldThread();
+            continue;
+        }
+        for (int j = 0; j < n; ++j) {
+            const int producer = values[j] / NUM_VALUES_PER_PRODUCER;
+            const int index    = values[j] % NUM_VALUES_PER_PRODUCER;
+            LOOP2_ASSERT(producer, index, lastSeen[producer] < index);
+            lastSeen[producer] = index;
+            info->d_sum += values[j];
+        }
+        info->d_numPopped_p->add(n);
+    }
+    return arg;
+}
+
+template <Mode::Enum MODE>
+void run(int  numProducers,
+         int  numConsumers,
+         bool useBatches,
+         bool veryVerbose)
+    // Run the specified 'numProducers' producers and 'numConsumers' consumers
+    // on a queue in the specified 'MODE', using batches if the specified
+    // 'useBatches' is 'true', and verify that every value is popped exactly
+    // once.  Print progress if the specified 'veryVerbose' is 'true'.
+{
+    typedef bdlcc::RingBufferQueue<int, MODE> Obj;
+
+    if (veryVerbose) {
+        T_ P_(MODE) P_(numProducers) P_(numConsumers) P(useBatches);
+    }
+
+    bslma::TestAllocator sa("supplied");
+    Obj                  mX(64, &sa);
+    bsls::AtomicInt      numPopped(0);
+
+    const int NUM_EXPECTED = numProducers * NUM_VALUES_PER_PRODUCER;
+
+    ThreadInfo<Obj> info[2 * MAX_THREADS];
+    ThreadId        ids[2 * MAX_THREADS];
+    int             numThreads = 0;
+
+    for (int i = 0; i < numConsumers; ++i) {
+        ThreadInfo<Obj> ti = { i, useBatches, &mX, &numPopped, NUM_EXPECTED,
+                               0 };
+        info[numThreads] = ti;
+        ids[numThreads]  = createThread(&consumerThread<Obj>,
+                                        &info[numThreads]);
+        ++numThreads;
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        ThreadInfo<Obj> ti = { i, useBatches, &mX, &numPopped, NUM_EXPECTED,
+                               0 };
+        info[numThreads] = ti;
+        ids[numThreads]  = createThread(&producerThread<Obj>,
+                                        &info[numThreads]);
+        ++numThreads;
+    }
+
+    bsls::Types::Int64 sum = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+        sum += info[i].d_sum;
+    }
+
+    const bsls::Types::Int64 N = NUM_EXPECTED;
+    LOOP2_ASSERT(NUM_EXPECTED, numPopped, NUM_EXPECTED == numPopped);
+    LOOP2_ASSERT(sum, N, N * (N - 1) / 2 == sum);
+    ASSERT(mX.isEmpty());
+}
+
+}  // close namespace TestCase5
+
+namespace TestCaseMinus1 {
+
+template <class TYPE>
+class LockedQueue {
+    // This class serializes access to a 'bsl::deque' with a single lock, the
+    // conventional alternative to a lock-free queue, bounded to the same
+    // capacity as the queue it is compared with.
+
+    // DATA
+    bsl::deque<TYPE> d_deque;
+    bsl::size_t      d_capacity;
+    bsls::BslLock    d_lock;
+
+  public:
+    // CREATORS
+    explicit LockedQueue(bsl::size_t capacity) : d_capacity(capacity) {}
+
+    // MANIPULATORS
+    int tryPushBack(const TYPE& value)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        if (d_deque.size() == d_capacity) {
+            return 1;                                                 // RETURN
+        }
+        d_deque.push_back(value);
+        return 0;
+    }
+
+    int tryPopFront(TYPE *value)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        if (d_deque.empty()) {
+            return 1;                                                 // RETURN
+        }
+        *value = d_deque.front();
+        d_deque.pop_front();
+        return 0;
+    }
+};
+
+template <class QUEUE>
+struct ThreadInfo {
+    int              d_numValues;   // values per producer
+    int              d_numExpected; // values for all consumers
+    QUEUE           *d_queue_p;
+    bsls::AtomicInt *d_numPopped_p;
+};
+
+template <class QUEUE>
+void *benchmarkProducer(void *arg)
+{
+    ThreadInfo<QUEUE> *info = static_cast<ThreadInfo<QUEUE> *>(arg);
+
+    for (int i = 0; i < info->d_numValues; ) {
+        if (0 == info->d_queue_p->tryPushBack(i)) {
+            ++i;
+        }
+        else {
+            yieldThread();
+        }
+    }
+    return arg;
+}
+
+template <class QUEUE>
+void *benchmarkConsumer(void *arg)
+{
+    ThreadInfo<QUEUE> *info = static_cast<ThreadInfo<QUEUE> *>(arg);
+
+    int value;
+    while (*info->d_numPopped_p < info->d_numExpected) {
+        if (0 == info->d_queue_p->tryPopFront(&value)) {
+            info->d_numPopped_p->add(1);
+        }
+        else {
+            yieldThread();
+        }
+    }
+    return arg;
+}
+
+template <class QUEUE>
+double runBenchmark(QUEUE *queue,
+                    int    numProducers,
+                    int    numConsumers,
+                    int    numValues)
+    // Return the elapsed wall time (in seconds) for the specified
+    // 'numProducers' threads to each push the specified 'numValues' values to
+    // the specified 'queue', while the specified 'numConsumers' threads pop
+    // them.
+{
+    enum { MAX_THREADS = 64 };
+
+    bsls::AtomicInt   numPopped(0);
+    ThreadInfo<QUEUE> info = { numValues,
+                               numValues * numProducers,
+                               queue,
+                               &numPopped };
+    ThreadId          ids[MAX_THREADS];
+    int               numThreads = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numConsumers; ++i) {
+        ids[numThreads++] = createThread(&benchmarkConsumer<QUEUE>, &info);
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        ids[numThreads++] = createThread(&benchmarkProducer<QUEUE>, &info);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace TestCaseMinus1
+
+namespace TestCaseMinus2 {
+
+template <class QUEUE>
+struct PingPongInfo {
+    QUEUE *d_requests_p;
+    QUEUE *d_responses_p;
+    int    d_numRoundTrips;
+};
+
+template <class QUEUE>
+void *echoThread(void *arg)
+{
+    // Pop each request and push it back as a response.
+
+    PingPongInfo<QUEUE> *info = static_cast<PingPongInfo<QUEUE> *>(arg);
+
+    int value;
+    for (int i = 0; i < info->d_numRoundTrips; ++i) {
+        while (0 != info->d_requests_p->tryPopFront(&value)) {
+            yieldThread();
+        }
+        while (0 != info->d_responses_p->tryPushBack(value)) {
+            yieldThread();
+        }
+    }
+    return arg;
+}
+
+template <class QUEUE>
+double runPingPong(QUEUE *requests, QUEUE *responses, int numRoundTrips)
+    // Return the mean time (in nanoseconds) for a value pushed to the
+    // specified 'requests' queue to be echoed back through the specified
+    // 'responses' queue, over the specified 'numRoundTrips'.
+{
+    PingPongInfo<QUEUE> info = { requests, responses, numRoundTrips };
+
+    ThreadId id = createThread(&echoThread<QUEUE>, &info);
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    int value;
+    for (int i = 0; i < numRoundTrips; ++i) {
+        while (0 != requests->tryPushBack(i)) {
+            yieldThread();
+        }
+        while (0 != responses->tryPopFront(&value)) {
+            yieldThread();
+        }
+        ASSERT(i == value);
+    }
+    timer.stop();
+    joinThread(id);
+
+    return timer.elapsedTime() * 1e9 / numRoundTrips;
+}
+
+}  // close namespace TestCaseMinus2
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Market Data
+///- - - - - - - - - - - - - - - - -
+// Suppose that a thread receives price updates from a network connection, and
+// hands them to a single thread maintaining an order book.
+//
+// First, we define the type of a price update:
+//..
+    struct PriceUpdate {
+        int    d_instrumentId;  // identifier of the instrument
+        double d_price;         // new price of the instrument
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create a queue, shared by the two threads, in the mode allowing a
+// single producer and a single consumer (the thread creation code is
+// elided):
+//..
+    typedef bdlcc::RingBufferQueueMode Mode;
+
+    bdlcc::RingBufferQueue<PriceUpdate,
+                           Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>
+                                                                 queue(1000);
+    ASSERT(1024 == queue.capacity());
+//..
+// Next, the receiving thread pushes the updates decoded from a network
+// packet as a batch.  Should the queue be full, the receiving thread may
+// retry, drop updates, or apply back pressure, according to its needs:
+//..
+    PriceUpdate received[3] = { { 1, 10.5 }, { 2, 20.25 }, { 1, 10.75 } };
+
+    bsl::size_t numPushed = queue.tryPushBackBatch(received, 3);
+    ASSERT(3 == numPushed);
+//..
+// Finally, the order book thread pops updates, up to 16 at a time, and
+// processes them in order:
+//..
+    PriceUpdate updates[16];
+
+    bsl::size_t numPopped = queue.tryPopFrontBatch(updates, 16);
+    ASSERT(3     == numPopped);
+    ASSERT(1     == updates[0].d_instrumentId);
+    ASSERT(10.75 == updates[2].d_price);
+
+    ASSERT(0 != queue.tryPopFront(updates));  // the queue is empty
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that values pushed and popped concurrently are delivered
+        //   exactly once, and in order.
+        //
+        // Concerns:
+        //: 1 In each mode, with as many producers and consumers as the mode
+        //:   allows, every value pushed is popped exactly once.
+        //:
+        //: 2 The values pushed by one producer are popped in the order pushed
+        //:   (as observed by each consumer).
+        //:
+        //: 3 The above hold for single values and for batches, and while the
+        //:   queue wraps around many times.
+        //
+        // Plan:
+        //: 1 For each mode, and with and without batches, run producers that
+        //:   each push a distinct range of integers in increasing order, and
+        //:   consumers that verify, for each producer, that the integers they
+        //:   pop increase, and sum them.  Use a small queue so that it is
+        //:   often full and wraps around often.  (C-2..3)
+        //:
+        //: 2 After joining the threads, verify the number of values popped
+        //:   and their sum.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: values pushed and popped concurrently are delivered in
+        //            order.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase5;
+
+        for (int useBatches = 0; useBatches < 2; ++useBatches) {
+            run<Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>(1, 1, useBatches,
+                                                         veryVerbose);
+            run<Mode::e_MULTI_PRODUCER_SINGLE_CONSUMER>(4, 1, useBatches,
+                                                        veryVerbose);
+            run<Mode::e_MULTI_PRODUCER_MULTI_CONSUMER>(4, 4, useBatches,
+                                                       veryVerbose);
+            run<Mode::e_MULTI_PRODUCER_MULTI_CONSUMER>(1, 6, useBatches,
+                                                       veryVerbose);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //   Ensure that a throwing copy or assignment leaves the queue usable.
+        //
+        // Concerns:
+        //: 1 If the copy constructor throws during 'tryPushBack', the
+        //:   exception propagates, and the queue holds the values pushed
+        //:   before and after it, in order.
+        //:
+        //: 2 If the copy constructor throws during 'tryPushBackBatch', the
+        //:   positions claimed by the batch are skipped by later pops, even
+        //:   when a pop claims only skipped positions.
+        //:
+        //: 3 If the assignment operator throws during 'tryPopFront' or
+        //:   'tryPopFrontBatch', the exception propagates, the values claimed
+        //:   are removed, and the queue remains usable.
+        //
+        // Plan:
+        //: 1 Using a value type whose copy constructor and assignment
+        //:   operator throw on demand, push and pop values around throwing
+        //:   operations, in each mode, and verify the values popped.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: a throwing copy or assignment leaves the queue usable.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        testExceptions<Mode::e_MULTI_PRODUCER_MULTI_CONSUMER>(verbose);
+        testExceptions<Mode::e_MULTI_PRODUCER_SINGLE_CONSUMER>(verbose);
+        testExceptions<Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>(verbose);
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BATCHES
+        //   Ensure that batches push and pop as many values as fit.
+        //
+        // Concerns:
+        //: 1 'tryPushBackBatch' pushes the lesser of the number of values
+        //:   supplied and the room left in the queue, in order.
+        //:
+        //: 2 'tryPopFrontBatch' pops the lesser of the number of values
+        //:   requested and the number held, in order.
+        //:
+        //: 3 Empty batches have no effect, and batches wrap around the end of
+        //:   the circular array.
+        //:
+        //: 4 Batches and single values may be mixed.
+        //
+        // Plan:
+        //: 1 In each mode, push and pop batches of many sizes, smaller and
+        //:   larger than the capacity, verifying the numbers of values pushed
+        //:   and popped, and the values.  Then, drain the queue with
+        //:   'tryPopFront'.  (C-1..4)
+        //
+        // Testing:
+        //   bsl::size_t tryPopFrontBatch(TYPE *values, bsl::size_t max);
+        //   bsl::size_t tryPushBackBatch(const TYPE *values, bsl::size_t num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCHES" << endl
+                          << "=======" << endl;
+
+        testBatches<Mode::e_MULTI_PRODUCER_MULTI_CONSUMER>(verbose,
+                                                           veryVerbose);
+        testBatches<Mode::e_MULTI_PRODUCER_SINGLE_CONSUMER>(verbose,
+                                                            veryVerbose);
+        testBatches<Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>(verbose,
+                                                             veryVerbose);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //   Ensure that a queue is a bounded FIFO queue of its capacity.
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   2, and to at least 2.
+        //:
+        //: 2 'tryPushBack' succeeds unless the queue is full, and
+        //:   'tryPopFront' succeeds unless the queue is empty, leaving its
+        //:   argument unchanged on failure.
+        //:
+        //: 3 Values are popped in the order pushed, over many laps of the
+        //:   circular array.
+        //:
+        //: 4 'numElements', 'isEmpty', and 'isFull' reflect the values held.
+        //:
+        //: 5 Values are copied using the allocator of the queue, and popped
+        //:   values are destroyed; the destructor destroys the values left.
+        //:
+        //: 6 All memory comes from the supplied allocator.
+        //:
+        //: 7 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each mode and a table of requested capacities, create a
+        //:   queue of allocating strings, and verify its capacity.  (C-1)
+        //:
+        //: 2 Fill and drain the queue, partially and fully, for several laps,
+        //:   verifying the return values, the values popped, and the
+        //:   accessors after each operation.  (C-2..4)
+        //:
+        //: 3 Use test allocators to verify memory usage, leaving values in
+        //:   the queue for the destructor.  (C-5..6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a zero capacity.  (C-7)
+        //
+        // Testing:
+        //   RingBufferQueue(bsl::size_t capacity, Allocator *ba = 0);
+        //   ~RingBufferQueue();
+        //   int tryPopFront(TYPE *value);
+        //   int tryPushBack(const TYPE& value);
+        //   bslma::Allocator *allocator() const;
+        //   bsl::size_t capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   bsl::size_t numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        testPushPop<Mode::e_MULTI_PRODUCER_MULTI_CONSUMER>(
+                                                         verbose,
+                                                         veryVerbose,
+                                                         veryVeryVeryVerbose);
+        testPushPop<Mode::e_MULTI_PRODUCER_SINGLE_CONSUMER>(
+                                                         verbose,
+                                                         veryVerbose,
+                                                         veryVeryVeryVerbose);
+        testPushPop<Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>(
+                                                         verbose,
+                                                         veryVerbose,
+                                                         veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            typedef bdlcc::RingBufferQueue<int> Obj;
+
+            ASSERT_FAIL(Obj(0, &sa));
+            ASSERT_PASS(Obj(1, &sa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a queue, push and pop values until it is full and empty,
+        //:   and verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            bdlcc::RingBufferQueue<int> mX(4, &sa);
+
+            ASSERT(4 == mX.capacity());
+            ASSERT(mX.isEmpty());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(0 == mX.tryPushBack(i));
+            }
+            ASSERT(mX.isFull());
+            ASSERT(0 != mX.tryPushBack(4));
+
+            int value = -1;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(0 == value);
+            ASSERT(0 == mX.tryPushBack(4));
+
+            for (int i = 1; i <= 4; ++i) {
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(i == value);
+            }
+            ASSERT(0 != mX.tryPopFront(&value));
+            ASSERT(mX.isEmpty());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT
+        //   Compare the throughput of a 'RingBufferQueue' in each mode with
+        //   that of a lock-protected 'bsl::deque'.
+        //
+        // Concerns:
+        //: 1 The lock-free queue moves values between threads faster than the
+        //:   lock-protected deque.
+        //
+        // Plan:
+        //: 1 For each mode, with as many producers and consumers as the mode
+        //:   allows, move a number of values (optionally specified on the
+        //:   command line) through each queue, and report the elapsed wall
+        //:   time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: throughput versus a lock-protected 'bsl::deque'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: THROUGHPUT" << endl
+                          << "=======================" << endl;
+
+        using namespace TestCaseMinus1;
+
+        const int NUM_VALUES = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        enum { CAPACITY = 1024 };
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        cout << "mode\tproducers\tconsumers\tring\tlocked" << endl;
+
+        {
+            bdlcc::RingBufferQueue<int,
+                                   Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>
+                              ring(CAPACITY);
+            LockedQueue<int>  locked(CAPACITY);
+
+            const double tr = runBenchmark(&ring,   1, 1, NUM_VALUES);
+            const double tl = runBenchmark(&locked, 1, 1, NUM_VALUES);
+            cout << "SPSC\t1\t1\t" << tr << '\t' << tl << endl;
+        }
+        for (int numProducers = 2; numProducers <= 8; numProducers *= 2) {
+            bdlcc::RingBufferQueue<int,
+                                   Mode::e_MULTI_PRODUCER_SINGLE_CONSUMER>
+                              ring(CAPACITY);
+            LockedQueue<int>  locked(CAPACITY);
+
+            const int N = NUM_VALUES / numProducers;
+
+            const double tr = runBenchmark(&ring,   numProducers, 1, N);
+            const double tl = runBenchmark(&locked, numProducers, 1, N);
+            cout << "MPSC\t" << numProducers << "\t1\t"
+                 << tr << '\t' << tl << endl;
+        }
+        for (int numThreads = 2; numThreads <= 8; numThreads *= 2) {
+            bdlcc::RingBufferQueue<int> ring(CAPACITY);
+            LockedQueue<int>            locked(CAPACITY);
+
+            const int N = NUM_VALUES / numThreads;
+
+            const double tr = runBenchmark(&ring,
+                                           numThreads,
+                                           numThreads,
+                                           N);
+            const double tl = runBenchmark(&locked,
+                                           numThreads,
+                                           numThreads,
+                                           N);
+            cout << "MPMC\t" << numThreads << '\t' << numThreads << '\t'
+                 << tr << '\t' << tl << endl;
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ROUND-TRIP LATENCY
+        //   Compare the time for a value to make a round trip between two
+        //   threads through a pair of single-producer/single-consumer
+        //   'RingBufferQueue' objects with that through a pair of
+        //   lock-protected 'bsl::deque' objects.
+        //
+        // Concerns:
+        //: 1 The lock-free queue hands values between threads with lower
+        //:   latency than the lock-protected deque.
+        //
+        // Plan:
+        //: 1 Echo a number of values (optionally specified on the command
+        //:   line) from one thread to another and back through each pair of
+        //:   queues, and report the mean round-trip time in nanoseconds.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: round-trip latency versus a lock-protected
+        //                'bsl::deque'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: ROUND-TRIP LATENCY" << endl
+                          << "===============================" << endl;
+
+        using namespace TestCaseMinus1;
+        using namespace TestCaseMinus2;
+
+        const int NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        typedef bdlcc::RingBufferQueue<int,
+                                       Mode::e_SINGLE_PRODUCER_SINGLE_CONSUMER>
+                                                                      Ring;
+
+        Ring             ringRequests(16);
+        Ring             ringResponses(16);
+        LockedQueue<int> lockedRequests(16);
+        LockedQueue<int> lockedResponses(16);
+
+        const double lr = runPingPong(&ringRequests,
+                                      &ringResponses,
+                                      NUM_ROUND_TRIPS);
+        const double ll = runPingPong(&lockedRequests,
+                                      &lockedResponses,
+                                      NUM_ROUND_TRIPS);
+
+        cout << "ring (ns)\tlocked (ns)" << endl;
+        cout << lr << '\t' << ll << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
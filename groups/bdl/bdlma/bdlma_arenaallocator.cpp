@@ -0,0 +1,338 @@
+// bdlma_arenaallocator.cpp                                           -*-C++-*-
+#include <bdlma_arenaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_arenaallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+
+#include <bsl_climits.h>  // 'INT_MAX'
+#include <bsl_cstddef.h>  // 'offsetof'
+
+enum {
+    INITIAL_SIZE  = 256,  // default initial allocation size (in bytes)
+
+    GROWTH_FACTOR =   2   // multiplicative factor by which to grow allocation
+                          // size
+};
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+const bsls::Types::size_type k_UNBOUNDED =
+                                     ~static_cast<bsls::Types::size_type>(0);
+    // value of 'maxRetainedBytes' indicating that the retained buffers are
+    // not bounded
+
+}  // close unnamed namespace
+
+                           // --------------------
+                           // class ArenaAllocator
+                           // --------------------
+
+// PRIVATE MANIPULATORS
+ArenaAllocator::Block *ArenaAllocator::allocateBuffer(int size)
+{
+    BSLS_ASSERT(0 < size);
+
+    Block *block = static_cast<Block *>(d_allocator_p->allocate(
+                                            offsetof(Block, d_memory) + size));
+    block->d_next_p = 0;
+    block->d_size   = size;
+
+    d_retainedBytes += size;
+
+    return block;
+}
+
+void *ArenaAllocator::allocateFromNextBuffer(int size)
+{
+    BSLS_ASSERT(0 < size);
+
+    Block *next;
+    if (d_current_p) {
+        // Count the whole of the buffer being left, including its unused
+        // tail, rounded up so that the next buffer begins at a maximally
+        // aligned offset: the allocations of this generation then fit, with
+        // the same padding, in a single buffer of 'd_usedBytes + d_cursor'
+        // bytes.
+
+        d_usedBytes += bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                                d_bufferSize);
+        next         = d_current_p->d_next_p;
+    }
+    else {
+        next = d_head_p;
+    }
+
+    // Each buffer begins at a maximally-aligned address, so a buffer of at
+    // least 'size' bytes can always satisfy the request.  A retained buffer
+    // that is too small is skipped over, but kept for subsequent generations.
+
+    if (!next || next->d_size < size) {
+        Block *block = allocateBuffer(calculateNextBufferSize(size));
+        block->d_next_p = next;
+        if (d_current_p) {
+            d_current_p->d_next_p = block;
+        }
+        else {
+            d_head_p = block;
+        }
+        next = block;
+    }
+
+    d_current_p  = next;
+    d_buffer_p   = reinterpret_cast<char *>(&next->d_memory);
+    d_bufferSize = next->d_size;
+    d_cursor     = 0;
+
+    void *result = BufferImpUtil::allocateFromBuffer(&d_cursor,
+                                                     d_buffer_p,
+                                                     d_bufferSize,
+                                                     size,
+                                                     d_alignmentStrategy);
+    BSLS_ASSERT(result);
+
+    return result;
+}
+
+void ArenaAllocator::deallocateBuffers(Block *block)
+{
+    while (block) {
+        Block *next = block->d_next_p;
+
+        d_retainedBytes -= block->d_size;
+        d_allocator_p->deallocate(block);
+
+        block = next;
+    }
+}
+
+void ArenaAllocator::resetCursor()
+{
+    d_current_p  = 0;
+    d_buffer_p   = 0;
+    d_bufferSize = 0;
+    d_cursor     = 0;
+    d_usedBytes  = 0;
+}
+
+// PRIVATE ACCESSORS
+int ArenaAllocator::calculateNextBufferSize(int size) const
+{
+    int nextSize = d_current_p ? d_current_p->d_size : d_initialSize;
+    if (!d_current_p && size <= nextSize) {
+        return nextSize;                                              // RETURN
+    }
+
+    int oldSize;
+    do {
+        oldSize   = nextSize;
+        nextSize *= GROWTH_FACTOR;
+    } while (nextSize < size && oldSize < nextSize);
+
+    // If 'nextSize' overflows, use the larger of 'oldSize' and 'size'.
+
+    if (oldSize >= nextSize) {
+        nextSize = oldSize < size ? size : oldSize;
+    }
+
+    return nextSize;
+}
+
+// CREATORS
+ArenaAllocator::ArenaAllocator(bslma::Allocator *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(k_UNBOUNDED)
+, d_initialSize(INITIAL_SIZE)
+, d_alignmentStrategy(bsls::Alignment::BSLS_NATURAL)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ArenaAllocator::ArenaAllocator(bsls::Alignment::Strategy  alignmentStrategy,
+                               bslma::Allocator          *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(k_UNBOUNDED)
+, d_initialSize(INITIAL_SIZE)
+, d_alignmentStrategy(alignmentStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ArenaAllocator::ArenaAllocator(int               initialSize,
+                               bslma::Allocator *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(k_UNBOUNDED)
+, d_initialSize(initialSize)
+, d_alignmentStrategy(bsls::Alignment::BSLS_NATURAL)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+ArenaAllocator::ArenaAllocator(int                        initialSize,
+                               bsls::Alignment::Strategy  alignmentStrategy,
+                               bslma::Allocator          *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(k_UNBOUNDED)
+, d_initialSize(initialSize)
+, d_alignmentStrategy(alignmentStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+ArenaAllocator::ArenaAllocator(int                     initialSize,
+                               bsls::Types::size_type  maxRetainedBytes,
+                               bslma::Allocator       *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(maxRetainedBytes)
+, d_initialSize(initialSize)
+, d_alignmentStrategy(bsls::Alignment::BSLS_NATURAL)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+ArenaAllocator::ArenaAllocator(int                        initialSize,
+                               bsls::Types::size_type     maxRetainedBytes,
+                               bsls::Alignment::Strategy  alignmentStrategy,
+                               bslma::Allocator          *basicAllocator)
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_current_p(0)
+, d_head_p(0)
+, d_usedBytes(0)
+, d_highWaterMark(0)
+, d_retainedBytes(0)
+, d_maxRetainedBytes(maxRetainedBytes)
+, d_initialSize(initialSize)
+, d_alignmentStrategy(alignmentStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    deallocateBuffers(d_head_p);
+}
+
+// MANIPULATORS
+void ArenaAllocator::release()
+{
+    if (!d_current_p) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::size_type usedBytes = d_usedBytes + d_cursor;
+    if (d_highWaterMark < usedBytes) {
+        d_highWaterMark = usedBytes;
+    }
+
+    // If this generation spilled over into more than one buffer, replace the
+    // retained buffers by a single buffer that can hold the high-water mark,
+    // so that subsequent generations are served from contiguous memory.
+
+    if (d_current_p != d_head_p) {
+        bsls::Types::size_type size = d_initialSize;
+        while (size < d_highWaterMark && size <= INT_MAX / GROWTH_FACTOR) {
+            size *= GROWTH_FACTOR;
+        }
+
+        if (d_highWaterMark <= size && size <= d_maxRetainedBytes) {
+            deallocateBuffers(d_head_p);
+            d_head_p = allocateBuffer(static_cast<int>(size));
+        }
+    }
+
+    // Return the buffers beyond the longest prefix whose total size does not
+    // exceed 'd_maxRetainedBytes'.
+
+    if (d_maxRetainedBytes < d_retainedBytes) {
+        bsls::Types::size_type   total = 0;
+        Block                  **link  = &d_head_p;
+        while (*link && total + (*link)->d_size <= d_maxRetainedBytes) {
+            total += (*link)->d_size;
+            link   = &(*link)->d_next_p;
+        }
+        deallocateBuffers(*link);
+        *link = 0;
+    }
+
+    resetCursor();
+}
+
+void ArenaAllocator::purge()
+{
+    deallocateBuffers(d_head_p);
+    d_head_p = 0;
+
+    resetCursor();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,488 @@
+// bdlma_arenaallocator.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLMA_ARENAALLOCATOR
+#define INCLUDED_BDLMA_ARENAALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator that retains its buffers on 'release'.
+//
+//@CLASSES:
+//  bdlma::ArenaAllocator: sequential allocator that rewinds on 'release'
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::ArenaAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and efficiently allocates heterogeneous memory blocks (of varying,
+// user-specified sizes) from a sequence of internal buffers, in the manner of
+// a 'bdlma::SequentialAllocator'.  Unlike a sequential allocator, whose
+// 'release' method returns all of its buffers to the underlying allocator, an
+// arena allocator's 'release' method *rewinds* the arena: all memory allocated
+// from the arena is reclaimed, but the buffers themselves are retained for use
+// by subsequent allocations.
+//
+// An arena allocator is intended to supply the scratch memory of a repeated
+// unit of work (e.g., the processing of a request), calling 'release' when
+// each unit of work is complete.  The period between two calls to 'release'
+// is termed a *generation*.  The number of bytes consumed from the arena's
+// buffers in each generation (including the padding needed for alignment, and
+// the unused end of each buffer that the generation moved past) is tracked,
+// and the largest such number is the *high-water* *mark* of the arena.  If a
+// generation requires more than one buffer, then, on 'release', the retained
+// buffers are replaced by a single buffer large enough to hold the high-water
+// mark.  Consequently, once the high-water mark is reached, each generation
+// is served from one contiguous buffer, and no memory is allocated from (or
+// returned to) the underlying allocator:
+//..
+//  ,--------------------.
+// ( bdlma::ArenaAllocator )
+//  `--------------------'
+//            |         ctor/dtor
+//            |         highWaterMark
+//            |         maxRetainedBytes
+//            |         purge
+//            |         retainedBytes
+//            V
+//   ,----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `----------------------'
+//            |         release
+//            V
+//     ,---------------.
+//    ( bslma::Allocator )
+//     `---------------'
+//                      allocate
+//                      deallocate
+//..
+// As with other managed allocators, the 'deallocate' method has no effect.
+//
+///Optional 'initialSize' Parameter
+///--------------------------------
+// An optional 'initialSize' parameter can be supplied at construction to
+// specify the size of the first internal buffer.  If 'initialSize' is not
+// supplied, an implementation-defined value is used.  The first buffer is not
+// allocated until the first allocation request.  Subsequent buffers grow
+// geometrically, as per 'bsls::BlockGrowth::BSLS_GEOMETRIC'.
+//
+///Optional 'maxRetainedBytes' Parameter
+///-------------------------------------
+// An optional 'maxRetainedBytes' parameter can be supplied at construction to
+// bound the total size of the buffers retained by 'release', so that a single
+// unusually large generation does not pin a large amount of memory for the
+// lifetime of the arena.  If the buffers held at the time of 'release' exceed
+// 'maxRetainedBytes' in total, the buffers following the longest prefix of the
+// sequence of buffers that does not exceed 'maxRetainedBytes' are returned to
+// the underlying allocator.  If 'maxRetainedBytes' is not supplied, the
+// retained buffers are not bounded.  Note that a 'maxRetainedBytes' of 0
+// causes 'release' to return all buffers, making the arena behave like a
+// 'bdlma::SequentialAllocator'.
+//
+///Optional 'alignmentStrategy' Parameter
+///--------------------------------------
+// An optional 'alignmentStrategy' parameter can be supplied at construction to
+// specify the memory alignment strategy.  Allocated memory blocks can either
+// follow maximum alignment, natural alignment, or 1-byte alignment.  If
+// 'alignmentStrategy' is not specified, natural alignment is used.  See
+// 'bsls_alignment' for more details.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ArenaAllocator' is not thread-safe.  Typically, each thread that
+// processes units of work owns an arena of its own.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scratch Memory for Request Processing
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server thread processes a stream of requests, each of which
+// requires a varying amount of temporary memory that is discarded when the
+// request has been processed.  We can supply this memory from an arena owned
+// by the thread, and rewind the arena after each request.
+//
+// First, we define a function that processes a request, using the supplied
+// allocator for all of its temporary memory:
+//..
+//  void processRequest(int numFields, bslma::Allocator *scratch)
+//      // Process a request having the specified 'numFields' fields, using
+//      // the specified 'scratch' allocator to supply temporary memory.
+//  {
+//      bsl::vector<bsl::string> fields(scratch);
+//      for (int i = 0; i < numFields; ++i) {
+//          fields.push_back(bsl::string("a field value that is not short",
+//                                       scratch));
+//      }
+//      // ...
+//  }
+//..
+// Then, we create an arena whose buffers are supplied by a test allocator, so
+// that we can observe its use of the underlying allocator:
+//..
+//  bslma::TestAllocator  upstream;
+//  bdlma::ArenaAllocator arena(&upstream);
+//..
+// Next, we process a few requests of varying sizes, rewinding the arena after
+// each.  The arena grows as needed during the first requests:
+//..
+//  processRequest(10, &arena);
+//  arena.release();
+//
+//  processRequest(100, &arena);
+//  arena.release();
+//
+//  assert(0 < upstream.numBlocksInUse());
+//  assert(0 < arena.highWaterMark());
+//..
+// Now, we process further requests no larger than those already seen, and
+// observe that no further memory is allocated from the underlying allocator:
+//..
+//  const bsls::Types::Int64 numAllocations = upstream.numAllocations();
+//
+//  for (int i = 0; i < 50; ++i) {
+//      processRequest(i, &arena);
+//      arena.release();
+//  }
+//
+//  assert(numAllocations == upstream.numAllocations());
+//..
+// Finally, we return the retained buffers to the underlying allocator when the
+// arena is no longer needed (as the destructor would):
+//..
+//  arena.purge();
+//  assert(0 == upstream.numBlocksInUse());
+//  assert(0 == arena.retainedBytes());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_BUFFERIMPUTIL
+#include <bdlma_bufferimputil.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_MANAGEDALLOCATOR
+#include <bdlma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENT
+#include <bsls_alignment.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                           // ====================
+                           // class ArenaAllocator
+                           // ====================
+
+class ArenaAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a fast
+    // allocator that dispenses heterogeneous blocks of memory (of varying,
+    // user-specified sizes) from a sequence of internal buffers, which are
+    // retained (subject to an optional bound on their total size) when the
+    // allocator is released.  Memory for the internal buffers is supplied by
+    // an (optional) allocator supplied at construction; if no allocator is
+    // supplied, the currently installed default allocator is used.  This
+    // class is *exception* *neutral*: If memory cannot be allocated, the
+    // behavior is defined by the (optional) allocator specified at
+    // construction.
+
+    // PRIVATE TYPES
+    struct Block {
+        // This 'struct' overlays the beginning of each internal buffer,
+        // implementing a singly-linked list of the retained buffers.
+
+        Block                               *d_next_p;  // next buffer
+        int                                  d_size;    // usable bytes
+        bsls::AlignmentUtil::MaxAlignedType  d_memory;  // force alignment
+    };
+
+    // DATA
+    char                      *d_buffer_p;          // usable memory of the
+                                                    // current buffer (or 0)
+
+    int                        d_bufferSize;        // size of the current
+                                                    // buffer
+
+    int                        d_cursor;            // offset of the next
+                                                    // allocation in the
+                                                    // current buffer
+
+    Block                     *d_current_p;         // current buffer (or 0)
+
+    Block                     *d_head_p;            // first retained buffer
+                                                    // (or 0)
+
+    bsls::Types::size_type     d_usedBytes;         // bytes consumed in this
+                                                    // generation from buffers
+                                                    // preceding the current
+                                                    // one, including their
+                                                    // unused tails
+
+    bsls::Types::size_type     d_highWaterMark;     // largest number of bytes
+                                                    // consumed in a completed
+                                                    // generation
+
+    bsls::Types::size_type     d_retainedBytes;     // total size of the
+                                                    // retained buffers
+
+    bsls::Types::size_type     d_maxRetainedBytes;  // bound on
+                                                    // 'd_retainedBytes' after
+                                                    // 'release'
+
+    int                        d_initialSize;       // size of first buffer
+
+    bsls::Alignment::Strategy  d_alignmentStrategy; // alignment strategy
+
+    bslma::Allocator          *d_allocator_p;       // supplies buffers (held,
+                                                    // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ArenaAllocator(const ArenaAllocator&);
+    ArenaAllocator& operator=(const ArenaAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateFromNextBuffer(int size);
+        // Make the buffer following the current one (allocating a new buffer
+        // if there is no such buffer, or if it is too small) the current
+        // buffer, and return the address of a memory block of the specified
+        // 'size' (in bytes) allocated from it.  The behavior is undefined
+        // unless '0 < size'.
+
+    Block *allocateBuffer(int size);
+        // Return the address of a new buffer, having the specified 'size' (in
+        // bytes) of usable memory, allocated from the underlying allocator,
+        // and add 'size' to the number of retained bytes.
+
+    void deallocateBuffers(Block *block);
+        // Return the buffer at the specified 'block', and all buffers
+        // following it, to the underlying allocator, and subtract their sizes
+        // from the number of retained bytes.
+
+    void resetCursor();
+        // Make this arena have no current buffer, so that the next allocation
+        // is made from the first retained buffer (if any).
+
+    // PRIVATE ACCESSORS
+    int calculateNextBufferSize(int size) const;
+        // Return the size (in bytes) of the buffer to be allocated following
+        // the current buffer so as to satisfy an allocation request of the
+        // specified 'size' (in bytes).
+
+  public:
+    // CREATORS
+    explicit
+    ArenaAllocator(bslma::Allocator          *basicAllocator = 0);
+    explicit
+    ArenaAllocator(bsls::Alignment::Strategy  alignmentStrategy,
+                   bslma::Allocator          *basicAllocator = 0);
+        // Create an arena allocator for allocating memory blocks from a
+        // sequence of internal buffers that are retained on 'release'.
+        // Optionally specify an 'alignmentStrategy' used to control alignment
+        // of allocated memory blocks.  If no 'alignmentStrategy' is specified,
+        // natural alignment is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory for the internal buffers.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  An implementation-defined value is used as the size of the
+        // first internal buffer, and the total size of the retained buffers is
+        // not bounded.
+
+    explicit
+    ArenaAllocator(int                        initialSize,
+                   bslma::Allocator          *basicAllocator = 0);
+    ArenaAllocator(int                        initialSize,
+                   bsls::Alignment::Strategy  alignmentStrategy,
+                   bslma::Allocator          *basicAllocator = 0);
+        // Create an arena allocator for allocating memory blocks from a
+        // sequence of internal buffers that are retained on 'release', of
+        // which the first has the specified 'initialSize' (in bytes).
+        // Optionally specify an 'alignmentStrategy' used to control alignment
+        // of allocated memory blocks.  If no 'alignmentStrategy' is specified,
+        // natural alignment is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory for the internal buffers.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The total size of the retained buffers is not bounded.  The
+        // behavior is undefined unless '0 < initialSize'.
+
+    ArenaAllocator(int                        initialSize,
+                   bsls::Types::size_type     maxRetainedBytes,
+                   bslma::Allocator          *basicAllocator = 0);
+    ArenaAllocator(int                        initialSize,
+                   bsls::Types::size_type     maxRetainedBytes,
+                   bsls::Alignment::Strategy  alignmentStrategy,
+                   bslma::Allocator          *basicAllocator = 0);
+        // Create an arena allocator for allocating memory blocks from a
+        // sequence of internal buffers, of which the first has the specified
+        // 'initialSize' (in bytes), and of which at most the specified
+        // 'maxRetainedBytes' (in total) are retained on 'release'.  Optionally
+        // specify an 'alignmentStrategy' used to control alignment of
+        // allocated memory blocks.  If no 'alignmentStrategy' is specified,
+        // natural alignment is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory for the internal buffers.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < initialSize'.
+
+    virtual ~ArenaAllocator();
+        // Destroy this arena allocator, returning all of its buffers to the
+        // underlying allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of memory of the specified
+        // 'size' (in bytes) according to the alignment strategy specified at
+        // construction.  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  If the allocation request exceeds the remaining free
+        // memory space in the current buffer, allocate from the next retained
+        // buffer if it is large enough, and otherwise from a new buffer
+        // supplied by the underlying allocator.  The behavior is undefined
+        // unless 'size <= INT_MAX'.
+
+    virtual void deallocate(void *address);
+        // This method has no effect on the memory block at the specified
+        // 'address' as all memory allocated by this allocator is managed.
+        // The behavior is undefined unless 'address' is 0, or was allocated
+        // by this allocator and has not already been deallocated.  The effect
+        // of using 'address' after this call is undefined.
+
+    virtual void release();
+        // Release all memory allocated through this allocator, retaining the
+        // internal buffers (subject to the bound on their total size supplied
+        // at construction) for use by subsequent allocations.  If more than
+        // one buffer was used since the previous call to 'release' (or since
+        // construction), replace the retained buffers by a single buffer
+        // large enough to hold the high-water mark, provided that its size
+        // does not exceed the bound.  Note that the allocator is left in a
+        // state in which allocations totalling up to the high-water mark can
+        // (typically) be satisfied without allocating from the underlying
+        // allocator.
+
+    void purge();
+        // Release all memory allocated through this allocator, and return all
+        // of its internal buffers to the underlying allocator.  The
+        // high-water mark is retained.
+
+    // ACCESSORS
+    bsls::Types::size_type highWaterMark() const;
+        // Return the largest number of bytes consumed from the internal
+        // buffers (including padding for alignment, and the unused end of
+        // each buffer but the last) in any generation that has been completed
+        // by a call to 'release'.  Note that the allocations of any such
+        // generation fit in a single buffer of this size.
+
+    bsls::Types::size_type maxRetainedBytes() const;
+        // Return the bound on the total size (in bytes) of the internal
+        // buffers retained by 'release' that was supplied at construction, or
+        // the maximum value of 'bsls::Types::size_type' if no bound was
+        // supplied.
+
+    bsls::Types::size_type retainedBytes() const;
+        // Return the total size (in bytes) of the internal buffers currently
+        // held by this allocator.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // --------------------
+                           // class ArenaAllocator
+                           // --------------------
+
+// MANIPULATORS
+inline
+void *ArenaAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != d_buffer_p)) {
+        void *result = BufferImpUtil::allocateFromBuffer(
+                                                       &d_cursor,
+                                                       d_buffer_p,
+                                                       d_bufferSize,
+                                                       static_cast<int>(size),
+                                                       d_alignmentStrategy);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != result)) {
+            return result;                                            // RETURN
+        }
+    }
+    return allocateFromNextBuffer(static_cast<int>(size));
+}
+
+inline
+void ArenaAllocator::deallocate(void *)
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::size_type ArenaAllocator::highWaterMark() const
+{
+    return d_highWaterMark;
+}
+
+inline
+bsls::Types::size_type ArenaAllocator::maxRetainedBytes() const
+{
+    return d_maxRetainedBytes;
+}
+
+inline
+bsls::Types::size_type ArenaAllocator::retainedBytes() const
+{
+    return d_retainedBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1037 @@
+// bdlma_arenaallocator.t.cpp                                         -*-C++-*-
+#include <bdlma_arenaallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// A 'bdlma::ArenaAllocator' is a sequential allocator whose 'release' method
+// rewinds the allocator, retaining its internal buffers (subject to a bound)
+// for subsequent allocations.  The primary concerns are that allocations are
+// correctly sized and aligned, that 'release' makes previously used memory
+// available again without returning it to the underlying allocator, that the
+// retained buffers are consolidated so that a generation no larger than the
+// high-water mark requires no allocation from the underlying allocator, and
+// that the bound on retained bytes is honored.
+//
+// We use a 'bslma::TestAllocator' as the underlying allocator throughout, so
+// that the number of allocations and deallocations made by the arena can be
+// observed directly.  The default and global allocators are also test
+// allocators, to verify that they are not used.
+//-----------------------------------------------------------------------------
+// // CREATORS
+// [ 2] bdlma::ArenaAllocator(Alloc *a = 0);
+// [ 2] bdlma::ArenaAllocator(AS a, Alloc *a = 0);
+// [ 2] bdlma::ArenaAllocator(int i, Alloc *a = 0);
+// [ 2] bdlma::ArenaAllocator(int i, AS a, Alloc *a = 0);
+// [ 2] bdlma::ArenaAllocator(int i, size_type m, Alloc *a = 0);
+// [ 2] bdlma::ArenaAllocator(int i, size_type m, AS a, Alloc *a = 0);
+// [ 2] ~bdlma::ArenaAllocator();
+//
+// // MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 4] void deallocate(void *address);
+// [ 5] void release();
+// [ 7] void purge();
+//
+// // ACCESSORS
+// [ 5] size_type highWaterMark() const;
+// [ 6] size_type maxRetainedBytes() const;
+// [ 2] size_type retainedBytes() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: 'release' honors 'maxRetainedBytes'
+// [ 8] USAGE EXAMPLE
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ArenaAllocator Obj;
+
+typedef bsls::Alignment::Strategy  Strat;
+
+typedef bsls::Types::size_type     size_type;
+
+enum { MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+enum { DEFAULT_SIZE = 256 };
+
+static const size_type UNBOUNDED = ~static_cast<size_type>(0);
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scratch Memory for Request Processing
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server thread processes a stream of requests, each of which
+// requires a varying amount of temporary memory that is discarded when the
+// request has been processed.  We can supply this memory from an arena owned
+// by the thread, and rewind the arena after each request.
+//
+// First, we define a function that processes a request, using the supplied
+// allocator for all of its temporary memory:
+//..
+    void processRequest(int numFields, bslma::Allocator *scratch)
+        // Process a request having the specified 'numFields' fields, using
+        // the specified 'scratch' allocator to supply temporary memory.
+    {
+        bsl::vector<bsl::string> fields(scratch);
+        for (int i = 0; i < numFields; ++i) {
+            fields.push_back(bsl::string("a field value that is not short",
+                                         scratch));
+        }
+        // ...
+    }
+//..
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // As part of our overall allocator testing strategy, we will create
+    // three test allocators.
+
+    // Object Test Allocator.
+    bslma::TestAllocator objectAllocator("Object Allocator",
+                                         veryVeryVeryVerbose);
+
+    // Default Test Allocator.
+    bslma::TestAllocator defaultAllocator("Default Allocator",
+                                          veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    // Global Test Allocator.
+    bslma::TestAllocator globalAllocator("Global Allocator",
+                                         veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create an arena whose buffers are supplied by a test allocator, so
+// that we can observe its use of the underlying allocator:
+//..
+    bslma::TestAllocator  upstream;
+    bdlma::ArenaAllocator arena(&upstream);
+//..
+// Next, we process a few requests of varying sizes, rewinding the arena after
+// each.  The arena grows as needed during the first requests:
+//..
+    processRequest(10, &arena);
+    arena.release();
+
+    processRequest(100, &arena);
+    arena.release();
+
+    ASSERT(0 < upstream.numBlocksInUse());
+    ASSERT(0 < arena.highWaterMark());
+//..
+// Now, we process further requests no larger than those already seen, and
+// observe that no further memory is allocated from the underlying allocator:
+//..
+    const bsls::Types::Int64 numAllocations = upstream.numAllocations();
+
+    for (int i = 0; i < 50; ++i) {
+        processRequest(i, &arena);
+        arena.release();
+    }
+
+    ASSERT(numAllocations == upstream.numAllocations());
+//..
+// Finally, we return the retained buffers to the underlying allocator when the
+// arena is no longer needed (as the destructor would):
+//..
+    arena.purge();
+    ASSERT(0 == upstream.numBlocksInUse());
+    ASSERT(0 == arena.retainedBytes());
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'purge' TEST
+        //
+        // Concerns:
+        //: 1 'purge' returns all buffers to the underlying allocator.
+        //:
+        //: 2 'purge' retains the high-water mark.
+        //:
+        //: 3 The allocator is usable after 'purge'.
+        //:
+        //: 4 'purge' on a newly-constructed allocator has no effect.
+        //
+        // Plan:
+        //: 1 Allocate memory spanning several buffers, then invoke 'purge'
+        //:   and verify, using a test allocator, that all memory is returned.
+        //:   (C-1..2)
+        //:
+        //: 2 Allocate again, and verify that a new buffer is obtained.  (C-3)
+        //:
+        //: 3 Invoke 'purge' on a new allocator.  (C-4)
+        //
+        // Testing:
+        //   void purge();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'purge' TEST" << endl
+                                  << "============" << endl;
+
+        {
+            Obj mX(64, &objectAllocator);  const Obj& X = mX;
+
+            mX.purge();
+            ASSERT(0 == objectAllocator.numBlocksTotal());
+            ASSERT(0 == X.retainedBytes());
+
+            mX.allocate(100);
+            mX.release();
+            const size_type HWM = X.highWaterMark();
+            ASSERT(100 == HWM);
+
+            mX.allocate(60);
+            mX.allocate(60);
+            mX.allocate(200);
+            ASSERT(0 < objectAllocator.numBlocksInUse());
+
+            mX.purge();
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+            ASSERT(0 == X.retainedBytes());
+            ASSERT(HWM == X.highWaterMark());
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+            void *addr = mX.allocate(8);
+            ASSERT(0 != addr);
+            ASSERT(NUM_ALLOC + 1 == objectAllocator.numAllocations());
+            ASSERT(64 == X.retainedBytes());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'maxRetainedBytes' TEST
+        //
+        // Concerns:
+        //: 1 'maxRetainedBytes' returns the bound supplied at construction,
+        //:   or the maximum 'size_type' value if none was supplied.
+        //:
+        //: 2 'release' returns the buffers beyond the longest prefix of
+        //:   retained buffers whose total size does not exceed the bound.
+        //:
+        //: 3 'release' does not consolidate the retained buffers into a
+        //:   buffer larger than the bound.
+        //:
+        //: 4 A bound of 0 causes 'release' to return all buffers.
+        //:
+        //: 5 The bound does not limit the memory available between calls to
+        //:   'release'.
+        //
+        // Plan:
+        //: 1 Construct allocators with and without a bound, and verify the
+        //:   value of 'maxRetainedBytes'.  (C-1)
+        //:
+        //: 2 Using a test allocator, allocate memory spanning several buffers
+        //:   from allocators having various bounds, invoke 'release', and
+        //:   verify the retained buffers.  (C-2..5)
+        //
+        // Testing:
+        //   size_type maxRetainedBytes() const;
+        //   CONCERN: 'release' honors 'maxRetainedBytes'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'maxRetainedBytes' TEST" << endl
+                                  << "=======================" << endl;
+
+        if (verbose) cout << "\nTesting 'maxRetainedBytes'." << endl;
+        {
+            Obj mA(&objectAllocator);
+            Obj mB(64, &objectAllocator);
+            Obj mC(64, 1000, &objectAllocator);
+            Obj mD(64, 0, bsls::Alignment::BSLS_MAXIMUM, &objectAllocator);
+
+            ASSERT(UNBOUNDED == mA.maxRetainedBytes());
+            ASSERT(UNBOUNDED == mB.maxRetainedBytes());
+            ASSERT(1000      == mC.maxRetainedBytes());
+            ASSERT(0         == mD.maxRetainedBytes());
+        }
+
+        if (verbose) cout << "\nTesting trimming of retained buffers."
+                          << endl;
+        {
+            // Buffers of 256 and 512 bytes are allocated; the consolidated
+            // buffer (512 bytes) would exceed the bound, so the prefix
+            // consisting of the first buffer is retained.
+
+            Obj mX(64, 256, &objectAllocator);  const Obj& X = mX;
+
+            ASSERT(0 != mX.allocate(200));
+            ASSERT(0 != mX.allocate(200));
+            ASSERT(768 == X.retainedBytes());
+            ASSERT(2   == objectAllocator.numBlocksInUse());
+
+            mX.release();
+            ASSERT(456 == X.highWaterMark());
+            ASSERT(256 == X.retainedBytes());
+            ASSERT(1   == objectAllocator.numBlocksInUse());
+
+            // A generation that fits in the retained buffer makes no
+            // allocation.
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 != mX.allocate(100));
+                ASSERT(0 != mX.allocate(100));
+                mX.release();
+            }
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+            ASSERT(256       == X.retainedBytes());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        {
+            // The consolidated buffer fits within the bound.
+
+            Obj mX(64, 512, &objectAllocator);  const Obj& X = mX;
+
+            mX.allocate(200);
+            mX.allocate(200);
+            mX.release();
+            ASSERT(512 == X.retainedBytes());
+            ASSERT(1   == objectAllocator.numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+            mX.allocate(200);
+            mX.allocate(200);
+            mX.release();
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        {
+            // A bound of 0 retains nothing.
+
+            Obj mX(64, 0, &objectAllocator);  const Obj& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                mX.allocate(1000);
+                mX.allocate(10);
+                ASSERT(0 < objectAllocator.numBlocksInUse());
+
+                mX.release();
+                ASSERT(0 == X.retainedBytes());
+                ASSERT(0 == objectAllocator.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'release' TEST
+        //
+        // Concerns:
+        //: 1 'release' makes all memory available for reuse without returning
+        //:   any buffer to the underlying allocator.
+        //:
+        //: 2 'highWaterMark' reports the largest number of bytes consumed in
+        //:   a completed generation, including alignment padding.
+        //:
+        //: 3 If a generation uses more than one buffer, 'release' replaces the
+        //:   retained buffers by a single buffer that can hold the high-water
+        //:   mark.
+        //:
+        //: 4 Once the high-water mark has been reached, generations no larger
+        //:   than it make no allocation from the underlying allocator.
+        //:
+        //: 5 'release' on an allocator that has not allocated has no effect.
+        //
+        // Plan:
+        //: 1 Using a test allocator, allocate memory, invoke 'release', and
+        //:   verify that the next allocation returns the same address and
+        //:   that no memory was returned.  (C-1)
+        //:
+        //: 2 Allocate blocks requiring padding and verify 'highWaterMark'.
+        //:   (C-2)
+        //:
+        //: 3 Allocate memory spanning several buffers, invoke 'release', and
+        //:   verify that exactly one buffer is retained.  (C-3)
+        //:
+        //: 4 Repeat generations of varying shapes no larger than the
+        //:   high-water mark, and verify that the number of allocations from
+        //:   the test allocator does not change.  (C-4)
+        //:
+        //: 5 Invoke 'release' on a new allocator.  (C-5)
+        //
+        // Testing:
+        //   void release();
+        //   size_type highWaterMark() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'release' TEST" << endl
+                                  << "==============" << endl;
+
+        if (verbose) cout << "\nTesting rewinding." << endl;
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            mX.release();
+            ASSERT(0 == X.highWaterMark());
+            ASSERT(0 == objectAllocator.numBlocksTotal());
+
+            void *addr1 = mX.allocate(24);
+            void *addr2 = mX.allocate(40);
+            ASSERT(1 == objectAllocator.numAllocations());
+
+            mX.release();
+            ASSERT(0  == objectAllocator.numDeallocations());
+            ASSERT(64 == X.highWaterMark());
+
+            ASSERT(addr1 == mX.allocate(24));
+            ASSERT(addr2 == mX.allocate(40));
+            ASSERT(1 == objectAllocator.numAllocations());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'highWaterMark'." << endl;
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            mX.allocate(1);
+            mX.allocate(8);  // 7 bytes of padding
+            mX.release();
+            ASSERT(16 == X.highWaterMark());
+
+            mX.allocate(4);
+            mX.release();
+            ASSERT(16 == X.highWaterMark());
+
+            mX.allocate(4);
+            mX.allocate(20);
+            mX.release();
+            ASSERT(24 == X.highWaterMark());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting consolidation." << endl;
+        {
+            Obj mX(64, &objectAllocator);  const Obj& X = mX;
+
+            mX.allocate(40);
+            mX.allocate(40);
+            ASSERT(2   == objectAllocator.numBlocksInUse());
+            ASSERT(192 == X.retainedBytes());
+
+            mX.release();
+            ASSERT(104 == X.highWaterMark());
+            ASSERT(1   == objectAllocator.numBlocksInUse());
+            ASSERT(128 == X.retainedBytes());
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+
+            char *addr1 = static_cast<char *>(mX.allocate(40));
+            char *addr2 = static_cast<char *>(mX.allocate(40));
+            ASSERT(addr1 + 40 == addr2);
+            mX.release();
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting consolidation with padding."
+                          << endl;
+        {
+            // A generation spanning several buffers, whose allocations need
+            // alignment padding and leave the ends of buffers unused, is
+            // served from the consolidated buffer when it is repeated.
+
+            static const int SIZES[] = { 3, 16, 5, 8, 1, 32, 7, 24, 2, 64 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int initialSize = 1; initialSize <= 128; ++initialSize) {
+                Obj mX(initialSize, &objectAllocator);
+
+                for (int j = 0; j < NUM_SIZES; ++j) {
+                    mX.allocate(SIZES[j]);
+                }
+                mX.release();
+
+                const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+
+                for (int j = 0; j < NUM_SIZES; ++j) {
+                    mX.allocate(SIZES[j]);
+                }
+                LOOP_ASSERT(initialSize,
+                            NUM_ALLOC == objectAllocator.numAllocations());
+            }
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting steady state." << endl;
+        {
+            static const int SIZES[] = { 1, 7, 8, 13, 16, 24, 100, 3, 250,
+                                         64, 5, 1000, 31, 2, 512, 9 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            Obj mX(32, &objectAllocator);  const Obj& X = mX;
+
+            // Warm up with the largest generation.
+
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                mX.allocate(SIZES[j]);
+            }
+            mX.release();
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            const size_type          HWM         = X.highWaterMark();
+            const bsls::Types::Int64 NUM_ALLOC   =
+                                             objectAllocator.numAllocations();
+            const bsls::Types::Int64 NUM_DEALLOC =
+                                           objectAllocator.numDeallocations();
+            if (veryVerbose) { P_(HWM) P(X.retainedBytes()) }
+
+            // Every contiguous subsequence of 'SIZES' is a generation no
+            // larger than the warm-up generation.
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = i; j < NUM_SIZES; ++j) {
+                    for (int k = i; k <= j; ++k) {
+                        void *addr = mX.allocate(SIZES[k]);
+                        LOOP3_ASSERT(i, j, k, 0 != addr);
+                    }
+                    mX.release();
+                }
+            }
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+            ASSERT(NUM_DEALLOC == objectAllocator.numDeallocations());
+            ASSERT(HWM       <= X.highWaterMark());
+            ASSERT(X.highWaterMark() <= X.retainedBytes());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'deallocate' TEST
+        //
+        // Concerns:
+        //: 1 'deallocate' has no effect.
+        //:
+        //: 2 'deallocate' accepts a null address.
+        //
+        // Plan:
+        //: 1 Using a test allocator, allocate memory, invoke 'deallocate' on
+        //:   it, and verify that no memory is returned to the test allocator
+        //:   and that the next allocation follows the deallocated block.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'deallocate' TEST" << endl
+                                  << "=================" << endl;
+
+        {
+            Obj mX(&objectAllocator);
+
+            char *addr1 = static_cast<char *>(mX.allocate(16));
+            const bsls::Types::Int64 NUM_BYTES =
+                                              objectAllocator.numBytesInUse();
+
+            mX.deallocate(addr1);
+            mX.deallocate(0);
+            ASSERT(NUM_BYTES == objectAllocator.numBytesInUse());
+            ASSERT(0         == objectAllocator.numDeallocations());
+
+            char *addr2 = static_cast<char *>(mX.allocate(16));
+            ASSERT(addr1 + 16 == addr2);
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' TEST
+        //
+        // Concerns:
+        //: 1 'allocate' returns memory aligned according to the alignment
+        //:   strategy supplied at construction.
+        //:
+        //: 2 Blocks returned by 'allocate' do not overlap.
+        //:
+        //: 3 'allocate(0)' returns 0 and allocates no memory.
+        //:
+        //: 4 Requests larger than the current buffer obtain a new buffer that
+        //:   is large enough, and buffers grow geometrically.
+        //
+        // Plan:
+        //: 1 For each alignment strategy, allocate a sequence of blocks of
+        //:   various sizes, verifying the alignment of each, and that it does
+        //:   not overlap the previously allocated block of the same buffer.
+        //:   Write to every byte of each block.  (C-1..2)
+        //:
+        //: 2 Invoke 'allocate(0)'.  (C-3)
+        //:
+        //: 3 Using a test allocator, allocate blocks that exceed the current
+        //:   buffer and verify 'retainedBytes'.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocate' TEST" << endl
+                                  << "===============" << endl;
+
+        if (verbose) cout << "\nTesting alignment." << endl;
+
+        static const int SIZES[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31,
+                                     32, 33, 63, 64, 65, 100, 127, 255, 256,
+                                     257, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        static const Strat STRATEGIES[] = {
+            bsls::Alignment::BSLS_MAXIMUM,
+            bsls::Alignment::BSLS_NATURAL,
+            bsls::Alignment::BSLS_BYTEALIGNED
+        };
+        const int NUM_STRATEGIES = sizeof STRATEGIES / sizeof *STRATEGIES;
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const Strat STRATEGY = STRATEGIES[ti];
+
+            Obj mX(16, STRATEGY, &objectAllocator);  const Obj& X = mX;
+
+            for (int gen = 0; gen < 3; ++gen) {
+                char      *prevEnd      = 0;
+                size_type  prevRetained = X.retainedBytes();
+                for (int i = 0; i < NUM_SIZES; ++i) {
+                    const int SIZE = SIZES[i];
+
+                    char *addr = static_cast<char *>(mX.allocate(SIZE));
+                    LOOP2_ASSERT(ti, i, 0 != addr);
+
+                    int alignment = 1;
+                    if (bsls::Alignment::BSLS_MAXIMUM == STRATEGY) {
+                        alignment = MAX_ALIGN;
+                    }
+                    else if (bsls::Alignment::BSLS_NATURAL == STRATEGY) {
+                        alignment =
+                            bsls::AlignmentUtil::calculateAlignmentFromSize(
+                                                                         SIZE);
+                    }
+                    LOOP3_ASSERT(ti, i, alignment,
+                                 0 == bsls::AlignmentUtil::
+                                     calculateAlignmentOffset(addr,
+                                                              alignment));
+
+                    // Within a buffer, blocks are allocated at increasing
+                    // addresses, separated only by padding.  After the
+                    // first generation, a single buffer is used.
+
+                    if (prevEnd && prevRetained == X.retainedBytes()) {
+                        LOOP2_ASSERT(ti, i, prevEnd <= addr);
+                        LOOP2_ASSERT(ti, i, addr - prevEnd < alignment);
+                    }
+                    LOOP2_ASSERT(ti, i,
+                                 0 == gen || 0 == i ||
+                                 prevRetained < X.retainedBytes() ||
+                                 prevEnd <= addr);
+                    LOOP2_ASSERT(ti, i,
+                                 0 == gen ||
+                                 1 == objectAllocator.numBlocksInUse());
+                    for (int j = 0; j < SIZE; ++j) {
+                        addr[j] = static_cast<char>(j);
+                    }
+                    prevEnd      = addr + SIZE;
+                    prevRetained = X.retainedBytes();
+                }
+                mX.release();
+            }
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'allocate(0)'." << endl;
+        {
+            Obj mX(&objectAllocator);
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\nTesting buffer growth." << endl;
+        {
+            Obj mX(64, &objectAllocator);  const Obj& X = mX;
+
+            mX.allocate(60);
+            ASSERT(64 == X.retainedBytes());
+
+            mX.allocate(60);             // next buffer: 128
+            ASSERT(64 + 128 == X.retainedBytes());
+
+            mX.allocate(100);            // next buffer: 256
+            ASSERT(64 + 128 + 256 == X.retainedBytes());
+
+            mX.allocate(2000);           // next buffer: 2048
+            ASSERT(64 + 128 + 256 + 2048 == X.retainedBytes());
+            ASSERT(4 == objectAllocator.numBlocksInUse());
+
+            mX.allocate(2000);           // next buffer: 4096
+            ASSERT(5 == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        {
+            // A first request larger than the initial size.
+
+            Obj mX(64, &objectAllocator);  const Obj& X = mX;
+
+            mX.allocate(1000);
+            ASSERT(1024 == X.retainedBytes());
+            ASSERT(1    == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR TEST
+        //
+        // Concerns:
+        //: 1 No memory is allocated at construction.
+        //:
+        //: 2 The allocator supplied at construction (or the default allocator
+        //:   if none is supplied) supplies the internal buffers.
+        //:
+        //: 3 The initial size, bound on retained bytes, and alignment
+        //:   strategy are those supplied at construction, or the defaults.
+        //:
+        //: 4 The destructor returns all buffers.
+        //
+        // Plan:
+        //: 1 For each constructor, create an allocator, verify that no memory
+        //:   is allocated, allocate a 1-byte block followed by an 8-byte
+        //:   block, and verify the distance between the blocks (which depends
+        //:   on the alignment strategy), 'retainedBytes' (which reflects the
+        //:   initial size), and 'maxRetainedBytes'.  (C-1..3)
+        //:
+        //: 2 Destroy the allocator and verify that all memory is returned.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bdlma::ArenaAllocator(Alloc *a = 0);
+        //   bdlma::ArenaAllocator(AS a, Alloc *a = 0);
+        //   bdlma::ArenaAllocator(int i, Alloc *a = 0);
+        //   bdlma::ArenaAllocator(int i, AS a, Alloc *a = 0);
+        //   bdlma::ArenaAllocator(int i, size_type m, Alloc *a = 0);
+        //   bdlma::ArenaAllocator(int i, size_type m, AS a, Alloc *a = 0);
+        //   ~bdlma::ArenaAllocator();
+        //   size_type retainedBytes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CTOR TEST" << endl
+                                  << "=========" << endl;
+
+        const Strat MAX = bsls::Alignment::BSLS_MAXIMUM;
+        const Strat BYT = bsls::Alignment::BSLS_BYTEALIGNED;
+
+        for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+            for (int useDefault = 0; useDefault < 2; ++useDefault) {
+                bslma::TestAllocator  localAllocator(veryVeryVeryVerbose);
+                bslma::TestAllocator& da = defaultAllocator;
+                bslma::TestAllocator& sa = useDefault ? da : localAllocator;
+                bslma::Allocator     *xa = useDefault ? 0 : &localAllocator;
+
+                const bsls::Types::Int64 DA_BLOCKS = da.numBlocksTotal();
+
+                Obj       *objPtr = 0;
+                int        expSize;
+                int        expDistance;
+                size_type  expMax;
+
+                switch (cfg) {
+                  case 'a': {
+                    objPtr      = new Obj(xa);
+                    expSize     = DEFAULT_SIZE;
+                    expDistance = 8;
+                    expMax      = UNBOUNDED;
+                  } break;
+                  case 'b': {
+                    objPtr      = new Obj(MAX, xa);
+                    expSize     = DEFAULT_SIZE;
+                    expDistance = MAX_ALIGN;
+                    expMax      = UNBOUNDED;
+                  } break;
+                  case 'c': {
+                    objPtr      = new Obj(100, xa);
+                    expSize     = 100;
+                    expDistance = 8;
+                    expMax      = UNBOUNDED;
+                  } break;
+                  case 'd': {
+                    objPtr      = new Obj(100, BYT, xa);
+                    expSize     = 100;
+                    expDistance = 1;
+                    expMax      = UNBOUNDED;
+                  } break;
+                  case 'e': {
+                    objPtr      = new Obj(100, 5000, xa);
+                    expSize     = 100;
+                    expDistance = 8;
+                    expMax      = 5000;
+                  } break;
+                  case 'f': {
+                    objPtr      = new Obj(100, 5000, MAX, xa);
+                    expSize     = 100;
+                    expDistance = MAX_ALIGN;
+                    expMax      = 5000;
+                  } break;
+                  default: {
+                    LOOP_ASSERT(cfg, !"Bad allocator config.");
+                    return testStatus;                                // RETURN
+                  } break;
+                }
+
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                LOOP2_ASSERT(cfg, useDefault,
+                             0 == localAllocator.numBlocksTotal());
+                LOOP2_ASSERT(cfg, useDefault,
+                             DA_BLOCKS == da.numBlocksTotal());
+                LOOP2_ASSERT(cfg, useDefault, 0 == X.retainedBytes());
+                LOOP2_ASSERT(cfg, useDefault, 0 == X.highWaterMark());
+                LOOP2_ASSERT(cfg, useDefault,
+                             expMax == X.maxRetainedBytes());
+
+                const bsls::Types::Int64 SA_BLOCKS = sa.numBlocksInUse();
+
+                char *addr1 = static_cast<char *>(mX.allocate(1));
+                char *addr2 = static_cast<char *>(mX.allocate(8));
+
+                LOOP2_ASSERT(cfg, useDefault,
+                             SA_BLOCKS + 1 == sa.numBlocksInUse());
+                LOOP2_ASSERT(cfg, useDefault,
+                             static_cast<size_type>(expSize) ==
+                                                          X.retainedBytes());
+                LOOP3_ASSERT(cfg, useDefault, addr2 - addr1,
+                             expDistance == addr2 - addr1);
+
+                delete objPtr;
+
+                LOOP2_ASSERT(cfg, useDefault,
+                             SA_BLOCKS == sa.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate from it, release it, and allocate
+        //:   again, verifying the use of the underlying allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            ASSERT(0 == objectAllocator.numBlocksTotal());
+
+            void *addr1 = mX.allocate(4);
+            void *addr2 = mX.allocate(8);
+            ASSERT(0 != addr1);
+            ASSERT(0 != addr2);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            mX.allocate(1024);
+            ASSERT(2 == objectAllocator.numBlocksInUse());
+
+            mX.release();
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+            ASSERT(0 <  X.highWaterMark());
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                             objectAllocator.numAllocations();
+            mX.allocate(4);
+            mX.allocate(8);
+            mX.allocate(1024);
+            mX.release();
+            ASSERT(NUM_ALLOC == objectAllocator.numAllocations());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,680 @@
+// bdlma_concurrentmultipoolallocator.cpp                             -*-C++-*-
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_concurrentmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_climits.h>
+#include <bsl_new.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// Every block dispensed from a size class is preceded by a maximally-aligned
+// 'Header' recording the index of its size class (or -1 for "large" blocks),
+// exactly as in 'bdlma::Multipool'.  While a block is free, the block
+// (including its header) is overlaid by a 'Link', so that the smallest block
+// (8 bytes of payload plus the header) always has room for two pointers.
+//
+// A depot holds only *full* magazines; partially filled magazines (which
+// arise only when a thread cache is flushed) are returned block by block to
+// the free list of the depot's 'bdlma::Pool', from which new magazines are
+// subsequently carved.  If no thread-specific storage key is available, no
+// thread caches are ever created, and 'allocate' and 'deallocate' operate on
+// the depot's pool directly under the depot's lock.
+//
+// On POSIX platforms, a thread cache is destroyed (and its blocks returned to
+// the depots) when its thread exits, via the destructor registered with the
+// thread-specific storage key.  On Windows, thread-local storage indices do
+// not provide such a notification; the caches of exited threads are reclaimed
+// only by 'release' and the destructor.
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+// LOCAL CONSTANTS
+enum {
+    DEFAULT_NUM_POOLS  =   10,  // default number of size classes
+
+    MIN_BLOCK_SIZE     =    8,  // minimum block size (in bytes)
+
+    MIN_BATCH_SIZE     =    4,  // minimum default blocks per magazine
+
+    MAX_BATCH_SIZE     =   64,  // maximum default blocks per magazine
+
+    DEFAULT_BATCH_BYTES = 4096  // target number of bytes in a default
+                                // magazine
+};
+
+// STATIC HELPER FUNCTIONS
+inline
+int defaultBatchSize(int blockSize)
+    // Return the implementation-defined number of blocks per magazine for
+    // the size class dispensing blocks of the specified 'blockSize' (in
+    // bytes).  The behavior is undefined unless '1 <= blockSize'.
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    const int batchSize = DEFAULT_BATCH_BYTES / blockSize;
+
+    return batchSize < MIN_BATCH_SIZE
+         ? MIN_BATCH_SIZE
+         : batchSize > MAX_BATCH_SIZE
+         ? MAX_BATCH_SIZE
+         : batchSize;
+}
+
+}  // close unnamed namespace
+
+                   // =======================================
+                   // struct ConcurrentMultipoolAllocator_Imp
+                   // =======================================
+
+struct ConcurrentMultipoolAllocator_Imp {
+    // This 'struct' provides a namespace for a function granting the
+    // 'extern "C"' thread-exit callback access to the private interface of
+    // 'ConcurrentMultipoolAllocator'.
+
+    // CLASS METHODS
+    static void destroyThreadCache(void *cache);
+        // Destroy the specified 'cache', which must be the address of a
+        // 'ConcurrentMultipoolAllocator::ThreadCache' whose owning allocator
+        // has not been destroyed.
+};
+
+void ConcurrentMultipoolAllocator_Imp::destroyThreadCache(void *cache)
+{
+    ConcurrentMultipoolAllocator::ThreadCache *threadCache =
+            static_cast<ConcurrentMultipoolAllocator::ThreadCache *>(cache);
+
+    threadCache->d_owner_p->destroyThreadCache(threadCache);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+extern "C"
+void bdlma_ConcurrentMultipoolAllocator_threadExit(void *cache)
+    // Return the blocks held in the specified thread 'cache' to the depots of
+    // its owning allocator and destroy 'cache'.  This function is invoked by
+    // the operating system when a thread having a non-null value for the
+    // thread-specific storage key of a 'ConcurrentMultipoolAllocator' exits.
+{
+    BloombergLP::bdlma::ConcurrentMultipoolAllocator_Imp::destroyThreadCache(
+                                                                        cache);
+}
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+               // ------------------------------------------
+               // struct ConcurrentMultipoolAllocator::Depot
+               // ------------------------------------------
+
+// CREATORS
+ConcurrentMultipoolAllocator::Depot::Depot(int               blockSize,
+                                           int               batchSize,
+                                           bslma::Allocator *basicAllocator)
+: d_batches_p(0)
+, d_batchSize(batchSize)
+, d_pool(blockSize,
+         bsls::BlockGrowth::BSLS_GEOMETRIC,
+         2 * batchSize,
+         basicAllocator)
+{
+}
+
+                  // ----------------------------------
+                  // class ConcurrentMultipoolAllocator
+                  // ----------------------------------
+
+// PRIVATE MANIPULATORS
+void ConcurrentMultipoolAllocator::initialize(int maxBlocksPerBatch)
+{
+    BSLS_ASSERT(0 <= maxBlocksPerBatch);
+
+    d_maxBlockSize = MIN_BLOCK_SIZE;
+
+    d_depots_p = static_cast<Depot *>(
+                     d_allocator_p->allocate(d_numPools * sizeof *d_depots_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoDepotsDeallocator(
+                                                                d_depots_p,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Depot> autoDtor(d_depots_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        const int batchSize = maxBlocksPerBatch
+                            ? maxBlocksPerBatch
+                            : defaultBatchSize(d_maxBlockSize);
+
+        // Round the pooled block size up so that every block carved from
+        // the pool (and hence the address following its header) is
+        // maximally aligned.
+
+        const int blockSize = static_cast<int>(
+                         bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                            d_maxBlockSize + sizeof(Header)));
+
+        new (d_depots_p + i) Depot(blockSize, batchSize, d_allocator_p);
+
+        d_maxBlockSize *= 2;
+        BSLS_ASSERT(d_maxBlockSize > 0);
+    }
+
+    d_maxBlockSize /= 2;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    d_threadCacheKey    = TlsAlloc();
+    d_hasThreadCacheKey = TLS_OUT_OF_INDEXES != d_threadCacheKey;
+#else
+    d_hasThreadCacheKey = 0 == pthread_key_create(
+                               &d_threadCacheKey,
+                               &bdlma_ConcurrentMultipoolAllocator_threadExit);
+#endif
+
+    autoDtor.release();
+    autoDepotsDeallocator.release();
+}
+
+ConcurrentMultipoolAllocator::ThreadCache *
+ConcurrentMultipoolAllocator::createThreadCache()
+{
+    if (!d_hasThreadCacheKey) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(d_allocator_p->allocate(
+                                 sizeof(ThreadCache)
+                                 + (d_numPools - 1) * sizeof(Magazine)
+                                 + Depot::CACHE_LINE_SIZE));
+
+    cache->d_owner_p = this;
+    cache->d_prev_p  = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        Magazine& magazine = cache->d_magazines[i];
+
+        magazine.d_loaded_p    = 0;
+        magazine.d_numLoaded   = 0;
+        magazine.d_previous_p  = 0;
+        magazine.d_numPrevious = 0;
+        magazine.d_capacity    = d_depots_p[i].d_batchSize;
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const int rc = TlsSetValue(d_threadCacheKey, cache) ? 0 : -1;
+#else
+    const int rc = pthread_setspecific(d_threadCacheKey, cache);
+#endif
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_allocator_p->deallocate(cache);
+        return 0;                                                     // RETURN
+    }
+
+    bsls::BslLockGuard guard(&d_registryLock);
+
+    cache->d_next_p = d_threadCaches_p;
+    if (d_threadCaches_p) {
+        d_threadCaches_p->d_prev_p = cache;
+    }
+    d_threadCaches_p = cache;
+    ++d_numThreadCaches;
+
+    return cache;
+}
+
+void ConcurrentMultipoolAllocator::destroyThreadCache(ThreadCache *cache)
+{
+    BSLS_ASSERT(cache);
+    BSLS_ASSERT(this == cache->d_owner_p);
+
+    for (int i = 0; i < d_numPools; ++i) {
+        flushMagazine(i, &cache->d_magazines[i]);
+    }
+
+    {
+        bsls::BslLockGuard guard(&d_registryLock);
+
+        if (cache->d_prev_p) {
+            cache->d_prev_p->d_next_p = cache->d_next_p;
+        }
+        else {
+            d_threadCaches_p = cache->d_next_p;
+        }
+        if (cache->d_next_p) {
+            cache->d_next_p->d_prev_p = cache->d_prev_p;
+        }
+        --d_numThreadCaches;
+    }
+
+    d_allocator_p->deallocate(cache);
+}
+
+void *ConcurrentMultipoolAllocator::allocateFromDepot(int       poolIdx,
+                                                      Magazine *magazine)
+{
+    Depot& depot = d_depots_p[poolIdx];
+
+    bsls::BslLockGuard guard(&depot.d_lock);
+
+    if (!magazine) {
+        return depot.d_pool.allocate();                               // RETURN
+    }
+
+    BSLS_ASSERT(0 == magazine->d_numLoaded);
+    BSLS_ASSERT(0 == magazine->d_numPrevious);
+
+    Link *batch = depot.d_batches_p;
+    if (batch) {
+        depot.d_batches_p = batch->d_nextBatch_p;
+    }
+    else {
+        for (int i = 0; i < depot.d_batchSize; ++i) {
+            Link *block = static_cast<Link *>(depot.d_pool.allocate());
+            block->d_next_p = batch;
+            batch = block;
+        }
+    }
+
+    magazine->d_loaded_p  = batch->d_next_p;
+    magazine->d_numLoaded = depot.d_batchSize - 1;
+
+    return batch;
+}
+
+void ConcurrentMultipoolAllocator::deallocateToDepot(int       poolIdx,
+                                                     Link     *block,
+                                                     Magazine *magazine)
+{
+    Depot& depot = d_depots_p[poolIdx];
+
+    if (!magazine) {
+        bsls::BslLockGuard guard(&depot.d_lock);
+
+        depot.d_pool.deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(depot.d_batchSize == magazine->d_numLoaded);
+    BSLS_ASSERT(depot.d_batchSize == magazine->d_numPrevious);
+
+    Link *batch = magazine->d_previous_p;
+
+    {
+        bsls::BslLockGuard guard(&depot.d_lock);
+
+        batch->d_nextBatch_p = depot.d_batches_p;
+        depot.d_batches_p    = batch;
+    }
+
+    magazine->d_previous_p  = magazine->d_loaded_p;
+    block->d_next_p         = 0;
+    magazine->d_loaded_p    = block;
+    magazine->d_numLoaded   = 1;
+}
+
+void ConcurrentMultipoolAllocator::flushMagazine(int       poolIdx,
+                                                 Magazine *magazine)
+{
+    Depot& depot = d_depots_p[poolIdx];
+
+    bsls::BslLockGuard guard(&depot.d_lock);
+
+    if (magazine->d_numPrevious) {
+        magazine->d_previous_p->d_nextBatch_p = depot.d_batches_p;
+        depot.d_batches_p                     = magazine->d_previous_p;
+    }
+
+    Link *block = magazine->d_loaded_p;
+    while (block) {
+        Link *next = block->d_next_p;
+        depot.d_pool.deallocate(block);
+        block = next;
+    }
+
+    magazine->d_loaded_p    = 0;
+    magazine->d_numLoaded   = 0;
+    magazine->d_previous_p  = 0;
+    magazine->d_numPrevious = 0;
+}
+
+// PRIVATE ACCESSORS
+int ConcurrentMultipoolAllocator::findPool(int size) const
+{
+    BSLS_ASSERT_SAFE(0    <  size);
+    BSLS_ASSERT_SAFE(size <= d_maxBlockSize);
+
+    int accumulator = ((size + MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1;
+
+    accumulator |= accumulator >> 16;
+    accumulator |= accumulator >>  8;
+    accumulator |= accumulator >>  4;
+    accumulator |= accumulator >>  2;
+    accumulator |= accumulator >>  1;
+
+    unsigned input = accumulator;
+
+#if defined(BSLS_PLATFORM_CMP_GNU)
+    return __builtin_popcount(input) - 1;
+#else
+    input -= (input >> 1) & 0x55555555;
+
+    {
+        const int mask = 0x33333333;
+        input = ((input >> 2) & mask) + (input & mask);
+    }
+
+    input = ((input >>  4) + input) & 0x0f0f0f0f;
+    input =  (input >>  8) + input;
+    input =  (input >> 16) + input;
+
+    return (input & 0x000000ff) - 1;
+#endif
+}
+
+// CREATORS
+ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(DEFAULT_NUM_POOLS)
+, d_threadCaches_p(0)
+, d_numThreadCaches(0)
+, d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(0);
+}
+
+ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_threadCaches_p(0)
+, d_numThreadCaches(0)
+, d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numPools);
+
+    initialize(0);
+}
+
+ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
+                                           int               numPools,
+                                           int               maxBlocksPerBatch,
+                                           bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_threadCaches_p(0)
+, d_numThreadCaches(0)
+, d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(1 <= maxBlocksPerBatch);
+
+    initialize(maxBlocksPerBatch);
+}
+
+ConcurrentMultipoolAllocator::~ConcurrentMultipoolAllocator()
+{
+    BSLS_ASSERT(d_depots_p);
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(d_allocator_p);
+
+    if (d_hasThreadCacheKey) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        TlsFree(d_threadCacheKey);
+#else
+        pthread_key_delete(d_threadCacheKey);
+#endif
+    }
+
+    while (d_threadCaches_p) {
+        ThreadCache *next = d_threadCaches_p->d_next_p;
+        d_allocator_p->deallocate(d_threadCaches_p);
+        d_threadCaches_p = next;
+    }
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].d_pool.release();
+        d_depots_p[i].~Depot();
+    }
+    d_allocator_p->deallocate(d_depots_p);
+}
+
+// MANIPULATORS
+void ConcurrentMultipoolAllocator::reserveCapacity(size_type size,
+                                                   size_type numObjects)
+{
+    BSLS_ASSERT(size <= static_cast<size_type>(d_maxBlockSize));
+
+    if (0 == size) {
+        return;                                                       // RETURN
+    }
+
+    Depot& depot = d_depots_p[findPool(static_cast<int>(size))];
+
+    // Thread caches carve whole batches from the pool, so round the request
+    // up to a multiple of the batch size.
+
+    const int batchSize  = depot.d_batchSize;
+    const int numBatches = static_cast<int>(
+                                 (numObjects + batchSize - 1) / batchSize);
+
+    bsls::BslLockGuard guard(&depot.d_lock);
+
+    depot.d_pool.reserveCapacity(numBatches * batchSize);
+}
+
+void *ConcurrentMultipoolAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                             size > static_cast<size_type>(d_maxBlockSize))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The requested size is large and will not be pooled.
+
+        // 'd_blockList' takes an 'int' size.
+
+        BSLS_ASSERT(size <= static_cast<size_type>(INT_MAX) - sizeof(Header));
+
+        Header *p;
+        {
+            bsls::BslLockGuard guard(&d_blockListLock);
+
+            p = static_cast<Header *>(d_blockList.allocate(
+                                   static_cast<int>(size + sizeof(Header))));
+        }
+        p->d_header.d_poolIdx = -1;
+        return p + 1;                                                 // RETURN
+    }
+
+    const int poolIdx = findPool(static_cast<int>(size));
+
+    ThreadCache *cache = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_hasThreadCacheKey)) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        cache = static_cast<ThreadCache *>(TlsGetValue(d_threadCacheKey));
+#else
+        cache = static_cast<ThreadCache *>(
+                                        pthread_getspecific(d_threadCacheKey));
+#endif
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            cache = createThreadCache();
+        }
+    }
+
+    void *block;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        Magazine& magazine = cache->d_magazines[poolIdx];
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(magazine.d_numLoaded)) {
+            Link *link = magazine.d_loaded_p;
+            magazine.d_loaded_p = link->d_next_p;
+            --magazine.d_numLoaded;
+            block = link;
+        }
+        else if (magazine.d_numPrevious) {
+            Link *link = magazine.d_previous_p;
+            magazine.d_loaded_p    = link->d_next_p;
+            magazine.d_numLoaded   = magazine.d_numPrevious - 1;
+            magazine.d_previous_p  = 0;
+            magazine.d_numPrevious = 0;
+            block = link;
+        }
+        else {
+            block = allocateFromDepot(poolIdx, &magazine);
+        }
+    }
+    else {
+        block = allocateFromDepot(poolIdx, 0);
+    }
+
+    Header *p = static_cast<Header *>(block);
+    p->d_header.d_poolIdx = poolIdx;
+    return p + 1;
+}
+
+void ConcurrentMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int poolIdx = h->d_header.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == poolIdx)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bsls::BslLockGuard guard(&d_blockListLock);
+
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0       <= poolIdx);
+    BSLS_ASSERT_SAFE(poolIdx <  d_numPools);
+
+    Link *block = reinterpret_cast<Link *>(h);
+
+    ThreadCache *cache = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_hasThreadCacheKey)) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        cache = static_cast<ThreadCache *>(TlsGetValue(d_threadCacheKey));
+#else
+        cache = static_cast<ThreadCache *>(
+                                        pthread_getspecific(d_threadCacheKey));
+#endif
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            cache = createThreadCache();
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        deallocateToDepot(poolIdx, block, 0);
+        return;                                                       // RETURN
+    }
+
+    Magazine& magazine = cache->d_magazines[poolIdx];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(magazine.d_numLoaded
+                                                      < magazine.d_capacity)) {
+        block->d_next_p     = magazine.d_loaded_p;
+        magazine.d_loaded_p = block;
+        ++magazine.d_numLoaded;
+    }
+    else if (0 == magazine.d_numPrevious) {
+        magazine.d_previous_p  = magazine.d_loaded_p;
+        magazine.d_numPrevious = magazine.d_numLoaded;
+        block->d_next_p        = 0;
+        magazine.d_loaded_p    = block;
+        magazine.d_numLoaded   = 1;
+    }
+    else {
+        deallocateToDepot(poolIdx, block, &magazine);
+    }
+}
+
+void ConcurrentMultipoolAllocator::release()
+{
+    for (ThreadCache *cache = d_threadCaches_p;
+         cache;
+         cache = cache->d_next_p) {
+        for (int i = 0; i < d_numPools; ++i) {
+            Magazine& magazine = cache->d_magazines[i];
+
+            magazine.d_loaded_p    = 0;
+            magazine.d_numLoaded   = 0;
+            magazine.d_previous_p  = 0;
+            magazine.d_numPrevious = 0;
+        }
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].d_batches_p = 0;
+        d_depots_p[i].d_pool.release();
+    }
+    d_blockList.release();
+}
+
+// ACCESSORS
+int ConcurrentMultipoolAllocator::numThreadCaches() const
+{
+    bsls::BslLockGuard guard(&d_registryLock);
+
+    return d_numThreadCaches;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,533 @@
+// bdlma_concurrentmultipoolallocator.h                               -*-C++-*-
+#ifndef INCLUDED_BDLMA_CONCURRENTMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_CONCURRENTMULTIPOOLALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-caching allocator of heterogeneous block sizes.
+//
+//@CLASSES:
+//  bdlma::ConcurrentMultipoolAllocator: thread-caching multipool allocator
+//
+//@SEE_ALSO: bdlma_multipoolallocator, bdlma_multipool, bdlma_pool
+//
+//@DESCRIPTION: This component provides a thread-safe, managed allocator,
+// 'bdlma::ConcurrentMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol.  Like 'bdlma::MultipoolAllocator', it
+// dispenses maximally-aligned memory blocks from a configurable number of
+// size classes, with each successive size class managing memory blocks of a
+// size twice that of the previous one, starting at 8 bytes.  Requests larger
+// than the largest size class are satisfied directly from the underlying
+// allocator (but are still released by 'release' and the destructor).
+//..
+//   ,-----------------------------------.
+//  ( bdlma::ConcurrentMultipoolAllocator )
+//   `-----------------------------------'
+//                    |       ctor/dtor
+//                    |       maxPooledBlockSize
+//                    |       numPools
+//                    |       numThreadCaches
+//                    |       reserveCapacity
+//                    V
+//        ,-----------------------.
+//       ( bdlma::ManagedAllocator )
+//        `-----------------------'
+//                    |       release
+//                    V
+//           ,----------------.
+//          ( bslma::Allocator )
+//           `----------------'
+//                            allocate
+//                            deallocate
+//..
+// Unlike 'bdlma::MultipoolAllocator', whose manipulators must be externally
+// synchronized, 'allocate' and 'deallocate' of a
+// 'bdlma::ConcurrentMultipoolAllocator' may be invoked concurrently from any
+// number of threads, and (in the common case) do so without acquiring a lock
+// or executing an atomic read-modify-write operation.
+//
+///Thread Caches and the Depot
+///---------------------------
+// Each thread that allocates from (or deallocates to) a
+// 'bdlma::ConcurrentMultipoolAllocator' is lazily given its own *thread
+// cache*, holding, for each size class, up to two *magazines* of free memory
+// blocks.  A magazine holds at most a fixed number of blocks, the *batch size*
+// of its size class.  'allocate' pops a block from the calling thread's
+// magazine, and 'deallocate' pushes the block onto the calling thread's
+// magazine; neither touches any state shared with other threads.
+//
+// Only when a thread's magazines for a size class are both empty (on
+// 'allocate') or both full (on 'deallocate') does the thread visit the
+// *depot* for that size class: a lock-protected stack of full magazines
+// shared by all threads.  An entire magazine is then transferred to (or from)
+// the depot in constant time, so that the lock is acquired at most once per
+// batch-size operations in the worst case, and, with two magazines per thread,
+// a thread alternating between allocation and deallocation at a magazine
+// boundary cannot thrash the depot.  When the depot for a size class is itself
+// empty, a fresh magazine is carved from a 'bdlma::Pool' owned by the depot.
+//
+// Memory is therefore never stranded in a thread: blocks freed by one thread
+// flow back, one batch at a time, to the depot, where they are available to
+// all other threads.  When a thread exits, the blocks held in its cache are
+// returned to the depot.
+//
+// The batch size of each size class may be specified at construction.  If it
+// is not, an implementation-defined value is used that decreases as the block
+// size increases, bounding the amount of memory that a thread cache may hold.
+//
+///Thread Safety
+///-------------
+// 'allocate', 'deallocate', 'reserveCapacity', and all accessors are *fully*
+// *thread-safe*: they may be invoked concurrently on the same object from
+// multiple threads.  'release' and the destructor are *not* thread-safe: the
+// behavior is undefined if either is invoked while any other thread is
+// invoking a method on the same object.  In addition, the behavior is
+// undefined if a thread that has used the allocator terminates during the
+// destruction of that allocator.
+//
+// The underlying allocator supplied at construction must itself be fully
+// thread-safe (the default allocator, for example, is).
+//
+// Each 'bdlma::ConcurrentMultipoolAllocator' consumes one thread-specific
+// storage key of the underlying operating system for its lifetime.  If no key
+// is available when the allocator is created, the allocator remains fully
+// functional, but every 'allocate' and 'deallocate' of a pooled block goes
+// directly to the (locked) depot.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service creates and destroys small, variably-sized order
+// objects in each of several worker threads, and that orders created in one
+// thread are frequently destroyed in another.  A single
+// 'bdlma::ConcurrentMultipoolAllocator' can supply the memory for all of the
+// workers without a lock around every operation, and without memory becoming
+// stranded in any one thread.
+//
+// First, we define a simple order type, whose size depends on the number of
+// legs that it holds:
+//..
+//  struct my_Order {
+//      // This 'struct' represents an order having a variable number of legs.
+//
+//      int    d_numLegs;  // number of entries in 'd_legs'
+//      double d_legs[1];  // variable-length array of leg prices
+//  };
+//
+//  my_Order *createOrder(int numLegs, bslma::Allocator *allocator)
+//      // Return a newly created order having the specified 'numLegs', using
+//      // the specified 'allocator' to supply memory.  The behavior is
+//      // undefined unless '1 <= numLegs'.
+//  {
+//      my_Order *order = static_cast<my_Order *>(allocator->allocate(
+//                         sizeof(my_Order) + (numLegs - 1) * sizeof(double)));
+//      order->d_numLegs = numLegs;
+//      for (int i = 0; i < numLegs; ++i) {
+//          order->d_legs[i] = 0.0;
+//      }
+//      return order;
+//  }
+//..
+// Then, we create the allocator that will be shared by all threads:
+//..
+//  bdlma::ConcurrentMultipoolAllocator allocator;
+//..
+// Next, each worker thread creates and destroys orders using 'allocator'
+// directly; no additional synchronization is required (the thread creation
+// code is elided):
+//..
+//  my_Order *order = createOrder(3, &allocator);
+//  assert(3 == order->d_numLegs);
+//
+//  // ... hand 'order' to another thread, which eventually calls:
+//
+//  allocator.deallocate(order);
+//..
+// Finally, note that each thread that used 'allocator' now has a thread cache:
+//..
+//  assert(1 == allocator.numThreadCaches());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_BLOCKLIST
+#include <bdlma_blocklist.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_MANAGEDALLOCATOR
+#include <bdlma_managedallocator.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_POOL
+#include <bdlma_pool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                  // ==================================
+                  // class ConcurrentMultipoolAllocator
+                  // ==================================
+
+class ConcurrentMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // a thread-safe allocator that maintains a configurable number of size
+    // classes, each dispensing memory blocks of a unique size, with each
+    // successive size class managing memory blocks of size twice that of the
+    // previous one.  Each thread using the allocator caches free blocks of
+    // each size class in thread-local magazines, and exchanges whole
+    // magazines with a shared, lock-protected depot only when its own
+    // magazines are exhausted or full.  Both the 'release' method and the
+    // destructor release all memory currently allocated via the object.
+
+    // PRIVATE TYPES
+    struct Header {
+        // This 'struct' provides header information for each allocated memory
+        // block.  The header stores the index of the size class of the block.
+
+        union {
+            int                    d_poolIdx;  // index of the size class of
+                                               // this memory block, or -1 if
+                                               // from 'd_blockList'
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    struct Link {
+        // This 'struct' overlays a free memory block (including its header).
+        // Free blocks of a magazine are linked through 'd_next_p'; the first
+        // block of each full magazine held by a depot links to the first block
+        // of the next such magazine through 'd_nextBatch_p'.
+
+        Link *d_next_p;       // next free block in this magazine
+
+        Link *d_nextBatch_p;  // first block of the next magazine in a depot
+    };
+
+    struct Magazine {
+        // This 'struct' holds the free blocks of one size class cached by one
+        // thread: a "loaded" magazine, from which blocks are allocated and to
+        // which blocks are deallocated, and a "previous" magazine, which is
+        // always either empty or full.
+
+        Link *d_loaded_p;     // blocks available to the owning thread
+
+        int   d_numLoaded;    // number of blocks in 'd_loaded_p'
+
+        Link *d_previous_p;   // full magazine, or 0
+
+        int   d_numPrevious;  // number of blocks in 'd_previous_p'
+
+        int   d_capacity;     // number of blocks in a full magazine (the
+                              // batch size of the size class)
+    };
+
+    struct ThreadCache {
+        // This 'struct' holds the magazines of all size classes for one
+        // thread.  Thread caches are linked in a registry owned by the
+        // allocator so that they can be reclaimed by 'release' and the
+        // destructor.  Note that this 'struct' is allocated with
+        // 'numPools() - 1' additional trailing 'Magazine' objects.
+
+        ConcurrentMultipoolAllocator *d_owner_p;       // allocator owning
+                                                       // this cache
+
+        ThreadCache                  *d_prev_p;        // previous cache in
+                                                       // registry
+
+        ThreadCache                  *d_next_p;        // next cache in
+                                                       // registry
+
+        Magazine                      d_magazines[1];  // one per size class
+    };
+
+    struct Depot {
+        // This 'struct' holds the blocks of one size class shared by all
+        // threads: a stack of full magazines, and a pool from which new
+        // magazines are carved.  Each depot is padded to avoid false sharing
+        // with the depots of adjacent size classes.
+
+        enum { CACHE_LINE_SIZE = 64 };
+
+        bsls::BslLock d_lock;                        // guards this depot
+
+        Link         *d_batches_p;                   // stack of full
+                                                     // magazines
+
+        int           d_batchSize;                   // blocks per magazine
+
+        Pool          d_pool;                        // supplies new blocks
+
+        char          d_padding[CACHE_LINE_SIZE];    // avoid false sharing
+
+        // CREATORS
+        Depot(int               blockSize,
+              int               batchSize,
+              bslma::Allocator *basicAllocator);
+            // Create a depot for blocks of the specified 'blockSize' (in
+            // bytes, including the block header) holding magazines of the
+            // specified 'batchSize' blocks, using the specified
+            // 'basicAllocator' to supply memory.
+    };
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    typedef unsigned long ThreadCacheKey;  // 'DWORD' fiber-local index
+#else
+    typedef pthread_key_t ThreadCacheKey;
+#endif
+
+    // DATA
+    Depot            *d_depots_p;          // array of 'd_numPools' depots
+
+    int               d_numPools;          // number of size classes
+
+    int               d_maxBlockSize;      // largest pooled block size;
+                                           // always a power of 2
+
+    ThreadCacheKey    d_threadCacheKey;    // key of this allocator's
+                                           // thread-specific cache
+
+    bool              d_hasThreadCacheKey; // 'true' if 'd_threadCacheKey'
+                                           // was successfully created
+
+    ThreadCache      *d_threadCaches_p;    // registry of thread caches
+
+    int               d_numThreadCaches;   // number of caches in registry
+
+    mutable bsls::BslLock
+                      d_registryLock;      // guards thread cache registry
+
+    BlockList         d_blockList;         // memory manager for "large"
+                                           // memory blocks
+
+    bsls::BslLock     d_blockListLock;     // guards 'd_blockList'
+
+    bslma::Allocator *d_allocator_p;       // memory allocator (held, not
+                                           // owned)
+
+    // FRIENDS
+    friend struct ConcurrentMultipoolAllocator_Imp;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void initialize(int maxBlocksPerBatch);
+        // Initialize the depots of this allocator, using the specified
+        // 'maxBlocksPerBatch' as the batch size of every size class, or an
+        // implementation-defined batch size for each size class if
+        // 'maxBlocksPerBatch' is 0.
+
+    ThreadCache *createThreadCache();
+        // Create a thread cache for the calling thread, register it with this
+        // allocator, and associate it with the calling thread.  Return the
+        // address of the new cache, or 0 if no thread-specific storage key is
+        // available to this allocator.
+
+    void destroyThreadCache(ThreadCache *cache);
+        // Return all blocks held in the specified 'cache' to the depots of
+        // this allocator, unregister 'cache', and deallocate it.
+
+    void *allocateFromDepot(int poolIdx, Magazine *magazine);
+        // Return the address of a free memory block of the size class having
+        // the specified 'poolIdx', refilling the specified 'magazine' with a
+        // full batch of blocks from the corresponding depot if 'magazine' is
+        // non-zero.  The behavior is undefined unless 'magazine', if
+        // non-zero, is empty.
+
+    void deallocateToDepot(int poolIdx, Link *block, Magazine *magazine);
+        // Return the specified 'block' of the size class having the specified
+        // 'poolIdx' to the specified 'magazine', first transferring the full
+        // "previous" magazine of 'magazine' to the corresponding depot, or, if
+        // 'magazine' is 0, return 'block' to the depot directly.  The behavior
+        // is undefined unless 'magazine', if non-zero, is full.
+
+    void flushMagazine(int poolIdx, Magazine *magazine);
+        // Return all blocks held in the specified 'magazine' to the depot of
+        // the size class having the specified 'poolIdx', leaving 'magazine'
+        // empty.
+
+    // PRIVATE ACCESSORS
+    int findPool(int size) const;
+        // Return the index of the size class in this allocator for an
+        // allocation request of the specified 'size' (in bytes).  The behavior
+        // is undefined unless '1 <= size <= maxPooledBlockSize()'.
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentMultipoolAllocator(const ConcurrentMultipoolAllocator&);
+    ConcurrentMultipoolAllocator& operator=(
+                                          const ConcurrentMultipoolAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    ConcurrentMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ConcurrentMultipoolAllocator(int               numPools,
+                                 bslma::Allocator *basicAllocator = 0);
+    ConcurrentMultipoolAllocator(int               numPools,
+                                 int               maxBlocksPerBatch,
+                                 bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // 'numPools', indicating the number of size classes; the block size of
+        // the first size class is 8 bytes, with the block size of each
+        // additional size class successively doubling.  If 'numPools' is not
+        // specified, an implementation-defined number of size classes 'N' --
+        // covering memory blocks ranging in size from '2^3 = 8' to '2^(N+2)'
+        // -- are created.  If 'numPools' is specified, optionally specify
+        // 'maxBlocksPerBatch', indicating the number of blocks of every size
+        // class that are exchanged at once between a thread cache and the
+        // shared depot (so that each thread caches at most
+        // '2 * maxBlocksPerBatch' blocks of each size class).  If
+        // 'maxBlocksPerBatch' is not specified, an implementation-defined
+        // value, decreasing with block size, is used for each size class.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools',
+        // '1 <= maxBlocksPerBatch', and 'basicAllocator' (or the default
+        // allocator) is fully thread-safe.
+
+    virtual ~ConcurrentMultipoolAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator is
+        // released, and all thread caches are destroyed.  The behavior is
+        // undefined unless no other thread is using this allocator.
+
+    // MANIPULATORS
+    void reserveCapacity(size_type size, size_type numObjects);
+        // Reserve memory from this allocator to satisfy memory requests for at
+        // least the specified 'numObjects' having the specified 'size' (in
+        // bytes) before the depot of the corresponding size class must obtain
+        // more memory from the underlying allocator.  If 'size' is 0, this
+        // method has no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()'.
+
+                                // Virtual Functions
+
+    virtual void *allocate(size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, and will not be pooled.  The
+        // behavior is undefined unless 'size', plus the size of the header
+        // preceding each block, can be represented as an 'int'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator, and has not already been deallocated.  Note that
+        // 'address' may be deallocated by a thread other than the one that
+        // allocated it.
+
+    virtual void release();
+        // Release all memory currently allocated through this allocator, and
+        // empty every thread cache.  The behavior is undefined unless no other
+        // thread is using this allocator.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of size classes managed by this allocator.
+
+    int maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+        // where 'numPools' is either specified at construction, or an
+        // implementation-defined value.
+
+    int batchSize(int poolIndex) const;
+        // Return the number of blocks exchanged at once between a thread cache
+        // and the depot of the size class having the specified 'poolIndex'.
+        // The behavior is undefined unless '0 <= poolIndex < numPools()'.
+
+    int numThreadCaches() const;
+        // Return the number of thread caches currently registered with this
+        // allocator, i.e., the number of live threads that have used this
+        // allocator since it was created.  Note that the value returned may
+        // be out of date by the time it is used.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                  // ----------------------------------
+                  // class ConcurrentMultipoolAllocator
+                  // ----------------------------------
+
+// ACCESSORS
+inline
+int ConcurrentMultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+int ConcurrentMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ConcurrentMultipoolAllocator::batchSize(int poolIndex) const
+{
+    BSLS_ASSERT_SAFE(0         <= poolIndex);
+    BSLS_ASSERT_SAFE(poolIndex <  d_numPools);
+
+    return d_depots_p[poolIndex].d_batchSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
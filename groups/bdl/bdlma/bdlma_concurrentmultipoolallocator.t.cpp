@@ -0,0 +1,1056 @@
+// bdlma_concurrentmultipoolallocator.t.cpp                           -*-C++-*-
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bdlma_multipoolallocator.h>            // for testing only
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsllock.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ConcurrentMultipoolAllocator' is a thread-safe allocator that
+// caches free blocks of each size class in per-thread magazines, and exchanges
+// whole magazines with a shared depot.  The primary concerns are that
+// 'allocate' returns maximally-aligned, distinct memory blocks of sufficient
+// size, that deallocated blocks are reused (in the same and in other threads)
+// without further requests to the underlying allocator, that 'release' and the
+// destructor return all memory to the underlying allocator, and that thread
+// caches are created and reclaimed as threads come and go.  We make heavy use
+// of the 'bslma::TestAllocator' to observe requests to the underlying
+// allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentMultipoolAllocator(Allocator *ba = 0);
+// [ 2] ConcurrentMultipoolAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ConcurrentMultipoolAllocator(int numPools, int mbpb, *ba = 0);
+// [ 2] ~ConcurrentMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 6] void reserveCapacity(size_type size, size_type numObjects);
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 5] void release();
+//
+// ACCESSORS
+// [ 2] int numPools() const;
+// [ 2] int maxPooledBlockSize() const;
+// [ 2] int batchSize(int poolIndex) const;
+// [ 7] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 4] CONCERN: Magazines are exchanged with the depot a batch at a time.
+// [ 7] CONCERN: 'allocate' and 'deallocate' are thread-safe.
+// [ 7] CONCERN: Thread caches are reclaimed when their threads exit.
+// [-1] PERFORMANCE: allocate/deallocate throughput versus thread count
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ConcurrentMultipoolAllocator Obj;
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(address,
+                                                              MAX_ALIGN);
+}
+
+namespace TestCase7 {
+
+enum { NUM_BLOCKS = 64 };
+
+struct ThreadInfo {
+    int    d_numIterations;
+    int    d_seed;
+    Obj   *d_obj_p;
+    void **d_handoff_p;  // 'NUM_BLOCKS' blocks allocated by another thread
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj& mX = *info->d_obj_p;
+
+    void *blocks[NUM_BLOCKS];
+    int   sizes[NUM_BLOCKS];
+
+    // Free the blocks handed off by another thread.
+
+    if (info->d_handoff_p) {
+        for (int i = 0; i < NUM_BLOCKS; ++i) {
+            mX.deallocate(info->d_handoff_p[i]);
+        }
+    }
+
+    unsigned seed = info->d_seed;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        for (int j = 0; j < NUM_BLOCKS; ++j) {
+            seed = seed * 1103515245 + 12345;
+            sizes[j]  = 1 + static_cast<int>((seed >> 16) % 600);
+            blocks[j] = mX.allocate(sizes[j]);
+            LOOP2_ASSERT(sizes[j], blocks[j], isMaximallyAligned(blocks[j]));
+            bsl::memset(blocks[j], j, sizes[j]);
+        }
+        for (int j = 0; j < NUM_BLOCKS; ++j) {
+            const char *p = static_cast<const char *>(blocks[j]);
+            LOOP2_ASSERT(i, j,
+                        static_cast<char>(j) == p[0]
+                     && static_cast<char>(j) == p[sizes[j] - 1]);
+            mX.deallocate(blocks[j]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase7
+
+namespace TestCaseMinus1 {
+
+struct LockedAllocator : public bslma::Allocator {
+    // This 'struct' serializes access to a 'bdlma::MultipoolAllocator' with a
+    // single lock, the conventional alternative to a concurrent allocator.
+
+    bdlma::MultipoolAllocator d_multipool;
+    bsls::BslLock             d_lock;
+
+    explicit
+    LockedAllocator(bslma::Allocator *basicAllocator)
+    : d_multipool(basicAllocator)
+    {
+    }
+
+    virtual void *allocate(size_type size)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+        return d_multipool.allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+        d_multipool.deallocate(address);
+    }
+};
+
+enum { WINDOW = 256 };
+
+struct ThreadInfo {
+    int               d_numIterations;
+    bslma::Allocator *d_allocator_p;
+};
+
+extern "C" void *benchmarkThread(void *arg)
+{
+    // Simulate an order book: keep a sliding window of live blocks of mixed
+    // sizes, replacing the oldest block on every iteration.
+
+    ThreadInfo       *info      = static_cast<ThreadInfo *>(arg);
+    bslma::Allocator *allocator = info->d_allocator_p;
+
+    void     *window[WINDOW] = { 0 };
+    unsigned  seed           = 1;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        void *& slot = window[i % WINDOW];
+        allocator->deallocate(slot);
+        seed = seed * 1103515245 + 12345;
+        slot = allocator->allocate(16 + (seed >> 16) % 240);
+    }
+    for (int i = 0; i < WINDOW; ++i) {
+        allocator->deallocate(window[i]);
+    }
+    return arg;
+}
+
+double runBenchmark(bslma::Allocator *allocator,
+                    int               numThreads,
+                    int               numIterations)
+    // Return the elapsed wall time (in seconds) for the specified
+    // 'numThreads' threads to each perform the specified 'numIterations'
+    // allocate/deallocate pairs on the specified 'allocator'.
+{
+    enum { MAX_THREADS = 64 };
+
+    ThreadInfo info = { numIterations, allocator };
+    ThreadId   ids[MAX_THREADS];
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numThreads; ++i) {
+        ids[i] = createThread(&benchmarkThread, &info);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace TestCaseMinus1
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service creates and destroys small, variably-sized order
+// objects in each of several worker threads, and that orders created in one
+// thread are frequently destroyed in another.  A single
+// 'bdlma::ConcurrentMultipoolAllocator' can supply the memory for all of the
+// workers without a lock around every operation, and without memory becoming
+// stranded in any one thread.
+//
+// First, we define a simple order type, whose size depends on the number of
+// legs that it holds:
+//..
+    struct my_Order {
+        // This 'struct' represents an order having a variable number of legs.
+
+        int    d_numLegs;  // number of entries in 'd_legs'
+        double d_legs[1];  // variable-length array of leg prices
+    };
+
+    my_Order *createOrder(int numLegs, bslma::Allocator *allocator)
+        // Return a newly created order having the specified 'numLegs', using
+        // the specified 'allocator' to supply memory.  The behavior is
+        // undefined unless '1 <= numLegs'.
+    {
+        my_Order *order = static_cast<my_Order *>(allocator->allocate(
+                           sizeof(my_Order) + (numLegs - 1) * sizeof(double)));
+        order->d_numLegs = numLegs;
+        for (int i = 0; i < numLegs; ++i) {
+            order->d_legs[i] = 0.0;
+        }
+        return order;
+    }
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create the allocator that will be shared by all threads:
+//..
+    bdlma::ConcurrentMultipoolAllocator allocator;
+//..
+// Next, each worker thread creates and destroys orders using 'allocator'
+// directly; no additional synchronization is required (the thread creation
+// code is elided):
+//..
+    my_Order *order = createOrder(3, &allocator);
+    ASSERT(3 == order->d_numLegs);
+
+    // ... hand 'order' to another thread, which eventually calls:
+
+    allocator.deallocate(order);
+//..
+// Finally, note that each thread that used 'allocator' now has a thread cache:
+//..
+    ASSERT(1 == allocator.numThreadCaches());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY AND THREAD CACHES
+        //   Ensure that 'allocate' and 'deallocate' are thread-safe, and that
+        //   thread caches are created and reclaimed as expected.
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently by multiple threads are distinct
+        //:   and remain intact while in use.
+        //:
+        //: 2 Blocks allocated in one thread may be deallocated in another.
+        //:
+        //: 3 Each thread using the allocator receives one thread cache, and
+        //:   (on POSIX platforms) the cache is reclaimed when the thread
+        //:   exits.
+        //:
+        //: 4 Blocks cached by an exited thread are available to other threads
+        //:   without further requests to the underlying allocator.
+        //:
+        //: 5 The destructor returns all memory to the underlying allocator.
+        //
+        // Plan:
+        //: 1 In the main thread, allocate a set of blocks to be handed off to
+        //:   worker threads.
+        //:
+        //: 2 Run several worker threads that each free their handed-off
+        //:   blocks, then repeatedly allocate, fill, verify, and deallocate
+        //:   blocks of random sizes.  (C-1..2)
+        //:
+        //: 3 After joining the workers, verify that 'numThreadCaches' is back
+        //:   to its value before the threads were started.  (C-3)
+        //:
+        //: 4 Rerun each worker, one at a time, and verify that the only
+        //:   memory obtained from the underlying allocator is for the new
+        //:   thread caches.  (C-4)
+        //:
+        //: 5 Destroy the allocator and verify that no memory remains
+        //:   outstanding from the underlying allocator.  (C-5)
+        //
+        // Testing:
+        //   int numThreadCaches() const;
+        //   CONCERN: 'allocate' and 'deallocate' are thread-safe.
+        //   CONCERN: Thread caches are reclaimed when their threads exit.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY AND THREAD CACHES" << endl
+                          << "=============================" << endl;
+
+        using namespace TestCase7;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { NUM_THREADS = 4, NUM_ITERATIONS = 200 };
+
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(0 == X.numThreadCaches());
+
+            void *handoff[NUM_THREADS][NUM_BLOCKS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    handoff[i][j] = mX.allocate(1 + j * 7);
+                }
+            }
+
+            ASSERT(1 == X.numThreadCaches());
+
+            ThreadInfo info[NUM_THREADS];
+            ThreadId   ids[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ThreadInfo ti = { NUM_ITERATIONS, i + 1, &mX, handoff[i] };
+                info[i] = ti;
+                ids[i]  = createThread(&workerThread, &info[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+            }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            ASSERTV(X.numThreadCaches(), 1 == X.numThreadCaches());
+#endif
+
+            const bsls::Types::Int64 NUM_BLOCKS_TOTAL = sa.numBlocksTotal();
+
+            // Rerun each worker on its own: the blocks cached by the exited
+            // threads suffice.
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                info[i].d_handoff_p = 0;
+                joinThread(createThread(&workerThread, &info[i]));
+            }
+
+            if (veryVerbose) {
+                P_(NUM_BLOCKS_TOTAL);  P(sa.numBlocksTotal());
+            }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            ASSERTV(X.numThreadCaches(), 1 == X.numThreadCaches());
+
+            // Each worker thread allocates one thread cache; no other memory
+            // is requested from 'sa'.
+
+            ASSERTV(NUM_BLOCKS_TOTAL, sa.numBlocksTotal(),
+                    NUM_BLOCKS_TOTAL + NUM_THREADS == sa.numBlocksTotal());
+#endif
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 After 'reserveCapacity(size, n)', at least 'n' blocks of 'size'
+        //:   bytes can be allocated without further requests to the underlying
+        //:   allocator.
+        //:
+        //: 2 'reserveCapacity' has no effect if 'size' is 0.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of sizes and object counts, reserve capacity, then
+        //:   allocate that many objects and verify that the number of blocks
+        //:   allocated from the underlying allocator is unchanged.  (C-1)
+        //:
+        //: 2 Call 'reserveCapacity' with a 'size' of 0 and verify that no
+        //:   memory is allocated.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a 'size' that is too large.  (C-3)
+        //
+        // Testing:
+        //   void reserveCapacity(size_type size, size_type numObjects);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reserveCapacity'" << endl
+                          << "=================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_size;
+            int d_numObjects;
+        } DATA[] = {
+            //LINE  SIZE  NUM OBJECTS
+            //----  ----  -----------
+            { L_,      1,           1 },
+            { L_,      8,          10 },
+            { L_,     17,         100 },
+            { L_,    100,          33 },
+            { L_,   1024,         200 },
+            { L_,   4096,          65 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE        = DATA[ti].d_line;
+            const int SIZE        = DATA[ti].d_size;
+            const int NUM_OBJECTS = DATA[ti].d_numObjects;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);
+
+            mX.reserveCapacity(SIZE, NUM_OBJECTS);
+
+            // Prime the thread cache.
+
+            mX.deallocate(mX.allocate(1));
+
+            const bsls::Types::Int64 NUM_BLOCKS_TOTAL = sa.numBlocksTotal();
+
+            enum { MAX_OBJECTS = 200 };
+            void *objects[MAX_OBJECTS];
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                objects[i] = mX.allocate(SIZE);
+            }
+            LOOP3_ASSERT(LINE, NUM_BLOCKS_TOTAL, sa.numBlocksTotal(),
+                         NUM_BLOCKS_TOTAL == sa.numBlocksTotal());
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                mX.deallocate(objects[i]);
+            }
+        }
+
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);
+
+            const bsls::Types::Int64 NUM_BLOCKS_TOTAL = sa.numBlocksTotal();
+
+            mX.reserveCapacity(0, 100);
+
+            ASSERT(NUM_BLOCKS_TOTAL == sa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(4, &sa);
+
+            ASSERT_PASS(mX.reserveCapacity(64, 1));
+            ASSERT_FAIL(mX.reserveCapacity(65, 1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory, pooled and non-pooled, to the
+        //:   underlying allocator.
+        //:
+        //: 2 The allocator, and the calling thread's cache, are fully usable
+        //:   after 'release'.
+        //
+        // Plan:
+        //: 1 Allocate blocks of a variety of sizes (including sizes that are
+        //:   not pooled), call 'release', and verify that no memory other than
+        //:   the allocator's internal bookkeeping is outstanding from the
+        //:   underlying allocator.  (C-1)
+        //:
+        //: 2 Allocate and deallocate again after 'release' and verify that
+        //:   the blocks are valid.  (C-2)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release'" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        Obj mX(&sa);  const Obj& X = mX;
+
+        // Create the thread cache, then record the bookkeeping memory.
+
+        mX.deallocate(mX.allocate(1));
+        mX.release();
+
+        const bsls::Types::Int64 NUM_BLOCKS_IN_USE = sa.numBlocksInUse();
+
+        for (int rep = 0; rep < 3; ++rep) {
+            for (int size = 1; size <= 2 * X.maxPooledBlockSize(); size *= 3) {
+                void *p = mX.allocate(size);
+                bsl::memset(p, 0xa5, size);
+                if (size & 1) {
+                    mX.deallocate(p);
+                }
+            }
+
+            ASSERT(NUM_BLOCKS_IN_USE < sa.numBlocksInUse());
+
+            mX.release();
+
+            LOOP2_ASSERT(rep, sa.numBlocksInUse(),
+                         NUM_BLOCKS_IN_USE == sa.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MAGAZINE AND DEPOT EXCHANGE
+        //
+        // Concerns:
+        //: 1 A thread that deallocates more blocks than fit in its magazines
+        //:   transfers full magazines to the depot, from which they are later
+        //:   reloaded by the same (or another) thread.
+        //:
+        //: 2 Once warmed up, a steady-state mix of allocations and
+        //:   deallocations requests no memory from the underlying allocator.
+        //:
+        //: 3 No block is ever dispensed twice.
+        //
+        // Plan:
+        //: 1 Using a small batch size, allocate many more blocks than fit in
+        //:   a thread cache, deallocate them all, and reallocate them all.
+        //:   Verify that the set of addresses dispensed the second time is the
+        //:   same as the first time, and that no additional memory was
+        //:   requested from the underlying allocator.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Magazines are exchanged with the depot a batch at a time.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MAGAZINE AND DEPOT EXCHANGE" << endl
+                          << "===========================" << endl;
+
+        enum { BATCH_SIZE = 4, NUM_OBJECTS = 10 * BATCH_SIZE + 3 };
+
+        for (int size = 8; size <= 64; size *= 2) {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(4, BATCH_SIZE, &sa);
+
+            void *first[NUM_OBJECTS];
+            void *second[NUM_OBJECTS];
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                first[i] = mX.allocate(size);
+                for (int j = 0; j < i; ++j) {
+                    LOOP3_ASSERT(size, i, j, first[i] != first[j]);
+                }
+            }
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                mX.deallocate(first[i]);
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS_TOTAL = sa.numBlocksTotal();
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                second[i] = mX.allocate(size);
+                for (int j = 0; j < i; ++j) {
+                    LOOP3_ASSERT(size, i, j, second[i] != second[j]);
+                }
+                bool found = false;
+                for (int j = 0; j < NUM_OBJECTS; ++j) {
+                    found = found || second[i] == first[j];
+                }
+                LOOP2_ASSERT(size, i, found);
+            }
+            LOOP_ASSERT(size, NUM_BLOCKS_TOTAL == sa.numBlocksTotal());
+
+            for (int rep = 0; rep < 100; ++rep) {
+                const int n = rep % NUM_OBJECTS;
+                mX.deallocate(second[n]);
+                second[n] = mX.allocate(size);
+            }
+            LOOP_ASSERT(size, NUM_BLOCKS_TOTAL == sa.numBlocksTotal());
+
+            for (int i = 0; i < NUM_OBJECTS; ++i) {
+                mX.deallocate(second[i]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block that is writable for
+        //:   (at least) the requested number of bytes.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 A block that is deallocated is the next block dispensed for a
+        //:   request of the same size class.
+        //:
+        //: 4 Blocks larger than 'maxPooledBlockSize()' are obtained directly
+        //:   from the underlying allocator, and returned to it on
+        //:   'deallocate'.
+        //
+        // Plan:
+        //: 1 For every size up to twice 'maxPooledBlockSize()', allocate a
+        //:   block, verify its alignment, write every byte, and deallocate it.
+        //:   Verify that an immediately following allocation of the same size
+        //:   returns the same address.  (C-1, 3)
+        //:
+        //: 2 Verify the behavior of 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Allocate a block larger than 'maxPooledBlockSize()' and verify,
+        //:   using the test allocator, that it is obtained from and returned
+        //:   to the underlying allocator.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(5, &sa);  const Obj& X = mX;
+
+            const int MAX_SIZE = X.maxPooledBlockSize();
+            ASSERT(128 == MAX_SIZE);
+
+            for (int size = 1; size <= 2 * MAX_SIZE; ++size) {
+                void *p = mX.allocate(size);
+                LOOP_ASSERT(size, isMaximallyAligned(p));
+                bsl::memset(p, 0xff, size);
+                mX.deallocate(p);
+
+                void *q = mX.allocate(size);
+                if (size <= MAX_SIZE) {
+                    LOOP_ASSERT(size, p == q);
+                }
+                mX.deallocate(q);
+            }
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            const bsls::Types::Int64 NUM_BLOCKS_IN_USE = sa.numBlocksInUse();
+
+            void *p = mX.allocate(MAX_SIZE + 1);
+            ASSERT(NUM_BLOCKS_IN_USE + 1 == sa.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(NUM_BLOCKS_IN_USE     == sa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of size classes and the
+        //:   batch sizes as specified, or with the documented defaults.
+        //:
+        //: 2 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied.
+        //:
+        //: 3 The destructor returns all memory to the underlying allocator.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without a
+        //:   supplied allocator, and verify the accessors and the source of
+        //:   memory.  (C-1..2)
+        //:
+        //: 2 Verify that, after destruction, no memory is outstanding.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ConcurrentMultipoolAllocator(Allocator *ba = 0);
+        //   ConcurrentMultipoolAllocator(int numPools, Allocator *ba = 0);
+        //   ConcurrentMultipoolAllocator(int numPools, int mbpb, *ba = 0);
+        //   ~ConcurrentMultipoolAllocator();
+        //   int numPools() const;
+        //   int maxPooledBlockSize() const;
+        //   int batchSize(int poolIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(10   == X.numPools());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(0     < da.numBlocksInUse());
+            ASSERT(0    == X.numThreadCaches());
+
+            for (int i = 1; i < X.numPools(); ++i) {
+                LOOP_ASSERT(i, X.batchSize(i) <= X.batchSize(i - 1));
+                LOOP_ASSERT(i, 1              <= X.batchSize(i));
+            }
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            {
+                Obj mX(numPools, &sa);  const Obj& X = mX;
+
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                LOOP_ASSERT(numPools, (4 << numPools) ==
+                                                      X.maxPooledBlockSize());
+                LOOP_ASSERT(numPools, 0 < sa.numBlocksInUse());
+            }
+            {
+                Obj mX(numPools, numPools, &sa);  const Obj& X = mX;
+
+                LOOP_ASSERT(numPools, numPools == X.numPools());
+                for (int i = 0; i < numPools; ++i) {
+                    LOOP2_ASSERT(numPools, i, numPools == X.batchSize(i));
+                }
+            }
+            LOOP_ASSERT(numPools, 0 == sa.numBlocksInUse());
+        }
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj(0, &sa));
+            ASSERT_PASS(Obj(1, &sa));
+            ASSERT_FAIL(Obj(1, 0, &sa));
+            ASSERT_PASS(Obj(1, 1, &sa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and deallocate blocks of several
+        //:   sizes, and verify that memory comes from the supplied allocator.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&sa);
+
+            void *p1 = mX.allocate(1);      bsl::memset(p1, 1,    1);
+            void *p2 = mX.allocate(100);    bsl::memset(p2, 2,  100);
+            void *p3 = mX.allocate(10000);  bsl::memset(p3, 3, 10000);
+
+            ASSERT(p1 != p2);
+            ASSERT(p2 != p3);
+            ASSERT(0 < sa.numBlocksInUse());
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT VERSUS THREAD COUNT
+        //   Compare the allocate/deallocate throughput of a
+        //   'ConcurrentMultipoolAllocator' with that of a lock-protected
+        //   'bdlma::MultipoolAllocator' as the number of threads grows.
+        //
+        // Concerns:
+        //: 1 The elapsed time per thread remains roughly constant as the
+        //:   number of threads increases (up to the number of cores).
+        //
+        // Plan:
+        //: 1 For thread counts of 1 to 32, run an order-book-like workload
+        //:   (a sliding window of live blocks of mixed sizes) against each
+        //:   allocator, and report the elapsed wall time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: allocate/deallocate throughput versus thread count
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: THROUGHPUT VERSUS THREAD COUNT"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        using namespace TestCaseMinus1;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        cout << "threads\tconcurrent\tlocked" << endl;
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            Obj             concurrent;
+            LockedAllocator locked(0);
+
+            const double tc = runBenchmark(&concurrent,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+            const double tl = runBenchmark(&locked,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+
+            cout << numThreads << '\t' << tc << '\t' << tl << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,296 @@
+// bdlma_concurrentpool.cpp                                           -*-C++-*-
+#include <bdlma_concurrentpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_concurrentpool_cpp,"$Id$ $CSID$")
+
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each block dispensed by the pool is preceded by a 'Link' header, padded to
+// maximal alignment, that is never overwritten by clients.  The free list is
+// a Treiber stack of these headers, whose head, 'd_freeList', holds the
+// address of the first free block in its low word and a generation count in
+// its high word.  Every successful push and pop replaces both words with a
+// single 128-bit compare-and-swap and increments the generation count.
+//
+// To pop the head 'p' of the list, a thread reads the head (address and
+// generation count 'g') in one atomic load, then reads 'p->d_next_p', then
+// attempts to swing the head from '(p, g)' to '(p->d_next_p, g + 1)'.  If any
+// other thread has pushed or popped in the meantime, the generation count is
+// no longer 'g', so the compare-and-swap fails even if 'p' is (again) the
+// first block on the list, and the (possibly stale) value read from
+// 'p->d_next_p' is discarded.  Since memory is returned to the underlying
+// allocator only by 'release' and the destructor, which require that no other
+// thread is using the pool, reading 'p->d_next_p' of a block that was popped
+// in the meantime is always safe; 'd_next_p' is atomic because such a read
+// may race with a push of 'p' that writes it.
+//
+// Note that the generation count would have to wrap around (2^64 operations)
+// between a thread's load of the head and its compare-and-swap for the ABA
+// problem to recur.
+
+namespace {
+
+// CONSTANTS
+enum {
+    INITIAL_CHUNK_SIZE =  1,  // default number of blocks per chunk
+
+    GROWTH_FACTOR      =  2,  // multiplicative factor by which to grow pool
+                              // capacity
+
+    MAX_CHUNK_SIZE     = 32   // maximum number of blocks per chunk
+};
+
+typedef BloombergLP::bsls::Types::Uint64  Uint64;
+typedef BloombergLP::bsls::Types::UintPtr UintPtr;
+
+inline
+Uint64 toWord(const void *pointer)
+    // Return the specified 'pointer' as a 64-bit word suitable for storing in
+    // the low word of the head of the free list.
+{
+    return static_cast<Uint64>(reinterpret_cast<UintPtr>(pointer));
+}
+
+template <class TYPE>
+inline
+TYPE *toPointer(Uint64 word)
+    // Return the pointer stored in the specified 'word' by 'toWord'.
+{
+    return reinterpret_cast<TYPE *>(static_cast<UintPtr>(word));
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // --------------------
+                        // class ConcurrentPool
+                        // --------------------
+
+// PRIVATE MANIPULATORS
+void ConcurrentPool::addBlocks(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    char *begin = static_cast<char *>(
+                      d_blockList.allocate(numBlocks * d_internalBlockSize));
+    char *end   = begin + (numBlocks - 1) * d_internalBlockSize;
+
+    for (char *p = begin; p < end; p += d_internalBlockSize) {
+        AtomicOp::initPointer(&reinterpret_cast<Link *>(p)->d_next_p,
+                              p + d_internalBlockSize);
+    }
+    AtomicOp::initPointer(&reinterpret_cast<Link *>(end)->d_next_p, 0);
+
+    pushList(reinterpret_cast<Link *>(begin), reinterpret_cast<Link *>(end));
+}
+
+void ConcurrentPool::pushList(Link *first, Link *last)
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(last);
+
+    Uint64 head;
+    Uint64 generation;
+    AtomicOp::getUint128(&d_freeList, &head, &generation);
+
+    do {
+        AtomicOp::setPtrRelaxed(&last->d_next_p, toPointer<Link>(head));
+    } while (!AtomicOp::testAndSwapUint128(&d_freeList,
+                                           &head,
+                                           &generation,
+                                           toWord(first),
+                                           generation + 1));
+}
+
+void ConcurrentPool::replenish()
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    Uint64 head;
+    Uint64 generation;
+    AtomicOp::getUint128(&d_freeList, &head, &generation);
+
+    if (head) {
+        // Another thread replenished the free list while we were waiting.
+
+        return;                                                       // RETURN
+    }
+
+    addBlocks(d_chunkSize);
+
+    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
+     && d_chunkSize < d_maxBlocksPerChunk) {
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                         d_chunkSize * GROWTH_FACTOR <= d_maxBlocksPerChunk)) {
+            d_chunkSize = d_chunkSize * GROWTH_FACTOR;
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            d_chunkSize = d_maxBlocksPerChunk;
+        }
+    }
+}
+
+// CREATORS
+ConcurrentPool::ConcurrentPool(int               blockSize,
+                               bslma::Allocator *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(MAX_CHUNK_SIZE)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = static_cast<int>(
+                   bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Link))
+                 + bsls::AlignmentUtil::roundUpToMaximalAlignment(blockSize));
+
+    AtomicOp::initUint128(&d_freeList);
+}
+
+ConcurrentPool::ConcurrentPool(int                          blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? MAX_CHUNK_SIZE
+              : INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(MAX_CHUNK_SIZE)
+, d_growthStrategy(growthStrategy)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = static_cast<int>(
+                   bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Link))
+                 + bsls::AlignmentUtil::roundUpToMaximalAlignment(blockSize));
+
+    AtomicOp::initUint128(&d_freeList);
+}
+
+ConcurrentPool::ConcurrentPool(int                          blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? maxBlocksPerChunk
+              : INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(maxBlocksPerChunk)
+, d_growthStrategy(growthStrategy)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    d_internalBlockSize = static_cast<int>(
+                   bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Link))
+                 + bsls::AlignmentUtil::roundUpToMaximalAlignment(blockSize));
+
+    AtomicOp::initUint128(&d_freeList);
+}
+
+ConcurrentPool::~ConcurrentPool()
+{
+    BSLS_ASSERT(static_cast<int>(sizeof(Link)) < d_internalBlockSize);
+    BSLS_ASSERT(0 < d_chunkSize);
+}
+
+// MANIPULATORS
+void *ConcurrentPool::allocate()
+{
+    const int headerSize = static_cast<int>(
+                 bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Link)));
+
+    Uint64 head;
+    Uint64 generation;
+    AtomicOp::getUint128(&d_freeList, &head, &generation);
+
+    for (;;) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!head)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            replenish();
+            AtomicOp::getUint128(&d_freeList, &head, &generation);
+            continue;
+        }
+
+        Link *p    = toPointer<Link>(head);
+        void *next = AtomicOp::getPtrRelaxed(&p->d_next_p);
+
+        // On failure, 'testAndSwapUint128' loads the current head of the free
+        // list into 'head' and 'generation'.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                        AtomicOp::testAndSwapUint128(&d_freeList,
+                                                     &head,
+                                                     &generation,
+                                                     toWord(next),
+                                                     generation + 1))) {
+            return reinterpret_cast<char *>(p) + headerSize;          // RETURN
+        }
+    }
+}
+
+void ConcurrentPool::deallocate(void *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    const int headerSize = static_cast<int>(
+                 bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Link)));
+
+    Link *p = reinterpret_cast<Link *>(static_cast<char *>(address)
+                                                                 - headerSize);
+    pushList(p, p);
+}
+
+void ConcurrentPool::release()
+{
+    d_blockList.release();
+    AtomicOp::setUint128(&d_freeList, 0, 0);
+}
+
+void ConcurrentPool::reserveCapacity(int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    addBlocks(numBlocks);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,418 @@
+// bdlma_concurrentpool.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLMA_CONCURRENTPOOL
+#define INCLUDED_BDLMA_CONCURRENTPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide thread-safe allocation of memory blocks of uniform size.
+//
+//@CLASSES:
+//  bdlma::ConcurrentPool: thread-safe memory manager for uniform-size blocks
+//
+//@SEE_ALSO: bdlma_pool
+//
+//@DESCRIPTION: This component implements a memory pool,
+// 'bdlma::ConcurrentPool', that allocates and manages maximally-aligned memory
+// blocks of some uniform size specified at construction.  A
+// 'bdlma::ConcurrentPool' has the same interface, and the same configuration
+// options, as a 'bdlma::Pool' (see 'bdlma_pool'), but its 'allocate',
+// 'deallocate', and 'reserveCapacity' methods may be invoked concurrently from
+// multiple threads.
+//
+// A 'bdlma::ConcurrentPool' maintains an internal linked list of free memory
+// blocks, and dispenses one block for each 'allocate' method invocation.  When
+// a memory block is deallocated, it is returned to the free list for potential
+// reuse.  Whenever the free list is depleted, the pool replenishes the list by
+// first allocating a large, contiguous "chunk" of memory, then splitting the
+// chunk into multiple memory blocks.  The size of each chunk is governed by
+// the growth strategy and maximum blocks per chunk supplied at construction,
+// exactly as for 'bdlma::Pool'.
+//
+///Lock-Free Free List
+///-------------------
+// The free list of a 'bdlma::ConcurrentPool' is a lock-free (Treiber) stack:
+// 'allocate' pops a block from the list, and 'deallocate' pushes a block onto
+// the list, each with a single compare-and-swap in the absence of contention.
+// Replenishing the free list from a new chunk is the only operation that
+// acquires a lock, and, as the chunk size grows, it is performed only rarely.
+//
+// A naive lock-free stack is subject to the "ABA" problem: a thread that has
+// read the head of the list, 'A', and the link to its successor, 'B', may be
+// preempted while other threads pop 'A', pop 'B', and push 'A' again, after
+// which a compare-and-swap of the head from 'A' to 'B' would succeed and
+// corrupt the list.  'bdlma::ConcurrentPool' avoids this by tagging the head
+// of the list with a generation count that is incremented by every push and
+// pop, and by updating the address of the first block and the generation
+// count together with a double-width compare-and-swap (see the 128-bit
+// operations of 'bsls_atomicoperations').  A thread whose view of the head is
+// stale, even if the head has since returned to the same block, therefore
+// fails its compare-and-swap and retries.  Note that the link to the next
+// free block is kept in a header, padded to maximal alignment, that precedes
+// each block and is never overwritten by clients, and that memory is never
+// returned to the underlying allocator except by 'release' or the destructor,
+// so that a header may always be read safely, even by a thread whose view of
+// the head is stale.
+//
+///Thread Safety
+///-------------
+// 'allocate', 'deallocate', 'reserveCapacity', 'deleteObject',
+// 'deleteObjectRaw', and 'blockSize' are *fully* *thread-safe*.  'release'
+// and the destructor are *not* thread-safe: the behavior is undefined if
+// either is invoked while any other thread is invoking a method on the same
+// object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Message Envelopes from Multiple Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a message dispatcher hands fixed-size envelopes between
+// threads: envelopes are created by the thread that receives a message, and
+// destroyed by whichever worker thread processes it.  A single
+// 'bdlma::ConcurrentPool' can supply the memory for all envelopes without
+// external synchronization.
+//
+// First, we define the envelope type:
+//..
+//  struct my_Envelope {
+//      // This 'struct' holds a message identifier and a small payload.
+//
+//      int  d_messageId;     // identifier of the message
+//      char d_payload[116];  // message payload
+//  };
+//..
+// Then, we create a pool that dispenses blocks of the size of an envelope and
+// is shared by all threads:
+//..
+//  bdlma::ConcurrentPool pool(sizeof(my_Envelope));
+//..
+// Next, a receiving thread creates an envelope for each incoming message (the
+// thread creation code is elided):
+//..
+//  my_Envelope *envelope = new (pool) my_Envelope;
+//  envelope->d_messageId = 42;
+//..
+// Finally, a worker thread destroys the envelope once the message has been
+// processed, returning its memory to the pool:
+//..
+//  assert(42 == envelope->d_messageId);
+//  pool.deleteObject(envelope);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_INFREQUENTDELETEBLOCKLIST
+#include <bdlma_infrequentdeleteblocklist.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DELETERHELPER
+#include <bslma_deleterhelper.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BLOCKGROWTH
+#include <bsls_blockgrowth.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>        // for 'bsl::size_t'
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ====================
+                        // class ConcurrentPool
+                        // ====================
+
+class ConcurrentPool {
+    // This class implements a memory pool that allocates and manages memory
+    // blocks of some uniform size specified at construction.  This memory pool
+    // maintains an internal lock-free linked list of free memory blocks, and
+    // dispenses one block for each 'allocate' method invocation.  When a
+    // memory block is deallocated, it is returned to the free list for
+    // potential reuse.  'allocate', 'deallocate', and 'reserveCapacity' may be
+    // invoked concurrently from multiple threads.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations AtomicOp;
+
+    struct Link {
+        // This 'struct' implements the header of each memory block managed
+        // by this pool.  'd_next_p' links the block into the free list; it is
+        // atomic because a thread popping the block with a stale view of the
+        // head of the list may read it while another thread pushes the block.
+        // Note that each header is padded to maximal alignment.
+
+        AtomicOp::AtomicTypes::Pointer d_next_p;  // pointer to next link
+    };
+
+    // DATA
+    int                  d_blockSize;          // size (in bytes) of each
+                                               // allocated memory block
+                                               // returned to client
+
+    int                  d_internalBlockSize;  // actual size of each block
+                                               // maintained on free list
+                                               // (contains overhead for
+                                               // 'Link')
+
+    int                  d_chunkSize;          // current chunk size (in
+                                               // blocks-per-chunk)
+
+    int                  d_maxBlocksPerChunk;  // maximum chunk size (in
+                                               // blocks-per-chunk)
+
+    bsls::BlockGrowth::Strategy
+                         d_growthStrategy;     // growth strategy of the chunk
+                                               // size
+
+    AtomicOp::AtomicTypes::Uint128
+                         d_freeList;           // lock-free stack of free
+                                               // memory blocks: address of
+                                               // the first block (low word)
+                                               // and generation count (high
+                                               // word)
+
+    bsls::BslLock        d_lock;               // serializes replenishment
+                                               // (guards 'd_blockList' and
+                                               // 'd_chunkSize')
+
+    InfrequentDeleteBlockList
+                         d_blockList;          // memory manager for allocated
+                                               // memory
+
+  private:
+    // PRIVATE MANIPULATORS
+    void addBlocks(int numBlocks);
+        // Allocate a chunk of the specified 'numBlocks' memory blocks from
+        // the underlying block list, and push them onto the free list of this
+        // pool.  The behavior is undefined unless '1 <= numBlocks' and the
+        // calling thread holds 'd_lock'.
+
+    void pushList(Link *first, Link *last);
+        // Atomically push the list of free blocks starting at the specified
+        // 'first' link and ending at the specified 'last' link onto the free
+        // list of this pool, incrementing the generation count of the head of
+        // the free list.
+
+    void replenish();
+        // Dynamically allocate a new chunk using this pool's underlying growth
+        // strategy, and use the chunk to replenish the free memory list of
+        // this pool.  Do nothing if another thread replenished the free list
+        // while this thread was waiting for the lock.
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentPool(const ConcurrentPool&);
+    ConcurrentPool& operator=(const ConcurrentPool&);
+
+  public:
+    // CREATORS
+    explicit
+    ConcurrentPool(int                          blockSize,
+                   bslma::Allocator            *basicAllocator = 0);
+    ConcurrentPool(int                          blockSize,
+                   bsls::BlockGrowth::Strategy  growthStrategy,
+                   bslma::Allocator            *basicAllocator = 0);
+    ConcurrentPool(int                          blockSize,
+                   bsls::BlockGrowth::Strategy  growthStrategy,
+                   int                          maxBlocksPerChunk,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Create a memory pool that returns blocks of contiguous memory of the
+        // specified 'blockSize' (in bytes) for each 'allocate' method
+        // invocation.  Optionally specify a 'growthStrategy' used to control
+        // the growth of internal memory chunks (from which memory blocks are
+        // dispensed).  If 'growthStrategy' is not specified, geometric growth
+        // is used.  Optionally specify 'maxBlocksPerChunk' as the maximum
+        // chunk size if 'growthStrategy' is specified.  If geometric growth is
+        // used, the chunk size grows starting at one block, doubling in size
+        // until the size is exactly 'maxBlocksPerChunk' blocks.  If constant
+        // growth is used, the chunk size is always 'maxBlocksPerChunk' blocks.
+        // If 'maxBlocksPerChunk' is not specified, an implementation-defined
+        // value is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= blockSize' and '1 <= maxBlocksPerChunk'.  Note that
+        // 'basicAllocator' must itself be thread-safe.
+
+    ~ConcurrentPool();
+        // Destroy this pool, releasing all associated memory back to the
+        // underlying allocator.
+
+    // MANIPULATORS
+    void *allocate();
+        // Return the address of a contiguous block of maximally-aligned memory
+        // having the fixed block size specified at construction.
+
+    void deallocate(void *address);
+        // Relinquish the memory block at the specified 'address' back to this
+        // pool object for reuse.  The behavior is undefined unless 'address'
+        // is non-zero, was allocated by this pool, and has not already been
+        // deallocated.
+
+    template <class TYPE>
+    void deleteObject(const TYPE *object);
+        // Destroy the specified 'object' based on its dynamic type and then
+        // use this pool to deallocate its memory footprint.  This method has
+        // no effect if 'object' is 0.  The behavior is undefined unless
+        // 'object', when cast appropriately to 'void *', was allocated using
+        // this pool and has not already been deallocated.  Note that
+        // 'dynamic_cast<void *>(object)' is applied if 'TYPE' is polymorphic,
+        // and 'static_cast<void *>(object)' is applied otherwise.
+
+    template <class TYPE>
+    void deleteObjectRaw(const TYPE *object);
+        // Destroy the specified 'object' and then use this pool to deallocate
+        // its memory footprint.  This method has no effect if 'object' is 0.
+        // The behavior is undefined unless 'object' is !not! a secondary base
+        // class pointer (i.e., the address is (numerically) the same as when
+        // it was originally dispensed by this pool), was allocated using this
+        // pool, and has not already been deallocated.
+
+    void release();
+        // Relinquish all memory currently allocated via this pool object.
+        // The behavior is undefined if this method is invoked concurrently
+        // with any other method of this pool.
+
+    void reserveCapacity(int numBlocks);
+        // Reserve memory from this pool to satisfy memory requests for at
+        // least the specified 'numBlocks' before the pool replenishes (absent
+        // concurrent allocations from other threads).  The behavior is
+        // undefined unless '0 <= numBlocks'.
+
+    // ACCESSORS
+    int blockSize() const;
+        // Return the size (in bytes) of the memory blocks allocated from this
+        // pool object.  Note that all blocks dispensed by this pool have the
+        // same size.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// FREE OPERATORS
+void *operator new(bsl::size_t                        size,
+                   BloombergLP::bdlma::ConcurrentPool& pool);
+    // Return a block of memory of the specified 'size' (in bytes) allocated
+    // from the specified 'pool'.  The behavior is undefined unless 'size' is
+    // the same or smaller than the 'blockSize' with which 'pool' was
+    // constructed.  Note that the analogous version of 'operator delete'
+    // should not be called directly.  Instead, use the 'deleteObject' method
+    // of 'pool' (see 'bdlma_pool').
+
+void operator delete(void *address, BloombergLP::bdlma::ConcurrentPool& pool);
+    // Use the specified 'pool' to deallocate the memory at the specified
+    // 'address'.  The behavior is undefined unless 'address' is non-zero, was
+    // allocated using 'pool', and has not already been deallocated.  Note that
+    // this operator is supplied solely to allow the compiler to arrange for it
+    // to be called in the case of an exception.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // --------------------
+                        // class ConcurrentPool
+                        // --------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void ConcurrentPool::deleteObject(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObject(object, this);
+}
+
+template <class TYPE>
+inline
+void ConcurrentPool::deleteObjectRaw(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObjectRaw(object, this);
+}
+
+// ACCESSORS
+inline
+int ConcurrentPool::blockSize() const
+{
+    return d_blockSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// FREE OPERATORS
+inline
+void *operator new(bsl::size_t                        size,
+                   BloombergLP::bdlma::ConcurrentPool& pool)
+{
+    using namespace BloombergLP;
+
+    BSLS_ASSERT_SAFE(static_cast<int>(size) <= pool.blockSize()
+                  && bsls::AlignmentUtil::calculateAlignmentFromSize(size)
+                       <= bsls::AlignmentUtil::calculateAlignmentFromSize(
+                                                         pool.blockSize()));
+
+    static_cast<void>(size);  // suppress "unused parameter" warnings
+    return pool.allocate();
+}
+
+inline
+void operator delete(void *address, BloombergLP::bdlma::ConcurrentPool& pool)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    pool.deallocate(address);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
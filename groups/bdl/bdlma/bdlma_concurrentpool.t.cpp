@@ -0,0 +1,1149 @@
+// bdlma_concurrentpool.t.cpp                                         -*-C++-*-
+#include <bdlma_concurrentpool.h>
+
+#include <bdlma_pool.h>                          // for testing only
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_bsllock.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ConcurrentPool' is a thread-safe memory pool of uniform-size blocks
+// whose free list is a lock-free stack.  The primary concerns are that
+// 'allocate' returns maximally-aligned, distinct memory blocks of the
+// configured size, that deallocated blocks are reused, that the pool
+// replenishes according to its growth strategy, that 'release' and the
+// destructor return all memory to the underlying allocator, and that
+// 'allocate' and 'deallocate' can be invoked concurrently (in particular,
+// that the free list is not corrupted by the ABA problem).
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentPool(int blockSize, Allocator *ba = 0);
+// [ 3] ConcurrentPool(int blockSize, Strategy gs, Allocator *ba = 0);
+// [ 3] ConcurrentPool(int bs, Strategy gs, int mbpc, Allocator *ba = 0);
+// [ 2] ~ConcurrentPool();
+//
+// MANIPULATORS
+// [ 2] void *allocate();
+// [ 2] void deallocate(void *address);
+// [ 6] void deleteObject(const TYPE *object);
+// [ 6] void deleteObjectRaw(const TYPE *object);
+// [ 5] void release();
+// [ 4] void reserveCapacity(int numBlocks);
+//
+// ACCESSORS
+// [ 2] int blockSize() const;
+//
+// FREE OPERATORS
+// [ 6] void *operator new(bsl::size_t size, bdlma::ConcurrentPool& pool);
+// [ 6] void operator delete(void *address, bdlma::ConcurrentPool& pool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+// [ 7] CONCERN: 'allocate' and 'deallocate' are thread-safe.
+// [ 8] CONCERN: No block is dispensed to two threads at once.
+// [-1] PERFORMANCE: allocate/deallocate throughput versus thread count
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ConcurrentPool       Obj;
+typedef bsls::BlockGrowth::Strategy Strategy;
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(address,
+                                                              MAX_ALIGN);
+}
+
+class my_Class {
+    // This class counts the number of instances destroyed.
+
+    // CLASS DATA
+    static int s_numDestroyed;
+
+  public:
+    // CLASS METHODS
+    static int numDestroyed() { return s_numDestroyed; }
+
+    // CREATORS
+    my_Class() {}
+    ~my_Class() { ++s_numDestroyed; }
+};
+
+int my_Class::s_numDestroyed = 0;
+
+namespace TestCase7 {
+
+enum { NUM_BLOCKS = 32, BLOCK_SIZE = 40 };
+
+struct ThreadInfo {
+    int   d_id;
+    int   d_numIterations;
+    Obj  *d_obj_p;
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    // Repeatedly allocate a batch of blocks, stamp each with a value unique to
+    // this thread and block, verify that no other thread has overwritten the
+    // stamps, and deallocate the blocks in an order different from that in
+    // which they were allocated.  Deallocating out of order, with several
+    // threads contending for the same free list, frequently creates the
+    // conditions for the ABA problem.
+
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj& mX = *info->d_obj_p;
+
+    int *blocks[NUM_BLOCKS];
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        for (int j = 0; j < NUM_BLOCKS; ++j) {
+            blocks[j] = static_cast<int *>(mX.allocate());
+            ASSERT(isMaximallyAligned(blocks[j]));
+
+            const int stamp = info->d_id * NUM_BLOCKS + j;
+            for (int k = 0; k < BLOCK_SIZE / (int)sizeof(int); ++k) {
+                blocks[j][k] = stamp;
+            }
+        }
+        for (int j = 0; j < NUM_BLOCKS; ++j) {
+            const int index = (j * 7 + i) % NUM_BLOCKS;
+            const int stamp = info->d_id * NUM_BLOCKS + index;
+            for (int k = 0; k < BLOCK_SIZE / (int)sizeof(int); ++k) {
+                LOOP3_ASSERT(i, j, k, stamp == blocks[index][k]);
+            }
+            mX.deallocate(blocks[index]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase7
+
+namespace TestCase8 {
+
+typedef bsls::AtomicOperations AtomicOp;
+
+enum { MAX_BATCH = 3, BLOCK_SIZE = sizeof(AtomicOp::AtomicTypes::Int) };
+
+struct ThreadInfo {
+    int   d_id;
+    int   d_numIterations;
+    int   d_numViolations;
+    Obj  *d_obj_p;
+};
+
+extern "C" void *stressThread(void *arg)
+{
+    // Repeatedly allocate a small batch of blocks and deallocate it in
+    // reverse order, claiming each block on allocation by atomically changing
+    // its first word from 0 to a value unique to this thread, and releasing
+    // the claim before deallocation.  A failed claim means that the block is
+    // held by another thread, i.e., that the pool dispensed it twice.  Short
+    // batches keep few blocks on the free list, so that popping threads
+    // frequently observe the same head recycled by other threads.
+
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    Obj& mX = *info->d_obj_p;
+
+    AtomicOp::AtomicTypes::Int *blocks[MAX_BATCH];
+
+    const int owner = info->d_id + 1;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        const int batch = 1 + (i + info->d_id) % MAX_BATCH;
+
+        for (int j = 0; j < batch; ++j) {
+            blocks[j] = static_cast<AtomicOp::AtomicTypes::Int *>(
+                                                              mX.allocate());
+            const int previous = AtomicOp::testAndSwapIntAcqRel(blocks[j],
+                                                                0,
+                                                                owner);
+            if (0 != previous) {
+                ++info->d_numViolations;
+            }
+        }
+        for (int j = batch - 1; 0 <= j; --j) {
+            const int previous = AtomicOp::testAndSwapIntAcqRel(blocks[j],
+                                                                owner,
+                                                                0);
+            if (owner != previous) {
+                ++info->d_numViolations;
+            }
+            mX.deallocate(blocks[j]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase8
+
+namespace TestCaseMinus1 {
+
+struct LockedPool {
+    // This 'struct' serializes access to a 'bdlma::Pool' with a single lock,
+    // the conventional alternative to a concurrent pool.
+
+    bdlma::Pool   d_pool;
+    bsls::BslLock d_lock;
+
+    explicit
+    LockedPool(int blockSize)
+    : d_pool(blockSize)
+    {
+    }
+
+    void *allocate()
+    {
+        bsls::BslLockGuard guard(&d_lock);
+        return d_pool.allocate();
+    }
+
+    void deallocate(void *address)
+    {
+        bsls::BslLockGuard guard(&d_lock);
+        d_pool.deallocate(address);
+    }
+};
+
+enum { WINDOW = 64, BLOCK_SIZE = 64 };
+
+template <class POOL>
+struct ThreadInfo {
+    int   d_numIterations;
+    POOL *d_pool_p;
+};
+
+template <class POOL>
+void *benchmarkThread(void *arg)
+{
+    // Keep a sliding window of live blocks, replacing the oldest block on
+    // every iteration.
+
+    ThreadInfo<POOL> *info = static_cast<ThreadInfo<POOL> *>(arg);
+    POOL&             pool = *info->d_pool_p;
+
+    void *window[WINDOW];
+    for (int i = 0; i < WINDOW; ++i) {
+        window[i] = pool.allocate();
+    }
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        void *& slot = window[i % WINDOW];
+        pool.deallocate(slot);
+        slot = pool.allocate();
+    }
+    for (int i = 0; i < WINDOW; ++i) {
+        pool.deallocate(window[i]);
+    }
+    return arg;
+}
+
+template <class POOL>
+double runBenchmark(POOL *pool, int numThreads, int numIterations)
+    // Return the elapsed wall time (in seconds) for the specified
+    // 'numThreads' threads to each perform the specified 'numIterations'
+    // allocate/deallocate pairs on the specified 'pool'.
+{
+    enum { MAX_THREADS = 64 };
+
+    ThreadInfo<POOL> info = { numIterations, pool };
+    ThreadId         ids[MAX_THREADS];
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numThreads; ++i) {
+        ids[i] = createThread(&benchmarkThread<POOL>, &info);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        joinThread(ids[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close namespace TestCaseMinus1
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Message Envelopes from Multiple Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a message dispatcher hands fixed-size envelopes between
+// threads: envelopes are created by the thread that receives a message, and
+// destroyed by whichever worker thread processes it.  A single
+// 'bdlma::ConcurrentPool' can supply the memory for all envelopes without
+// external synchronization.
+//
+// First, we define the envelope type:
+//..
+    struct my_Envelope {
+        // This 'struct' holds a message identifier and a small payload.
+
+        int  d_messageId;     // identifier of the message
+        char d_payload[116];  // message payload
+    };
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create a pool that dispenses blocks of the size of an envelope and
+// is shared by all threads:
+//..
+    bdlma::ConcurrentPool pool(sizeof(my_Envelope));
+//..
+// Next, a receiving thread creates an envelope for each incoming message (the
+// thread creation code is elided):
+//..
+    my_Envelope *envelope = new (pool) my_Envelope;
+    envelope->d_messageId = 42;
+//..
+// Finally, a worker thread destroys the envelope once the message has been
+// processed, returning its memory to the pool:
+//..
+    ASSERT(42 == envelope->d_messageId);
+    pool.deleteObject(envelope);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that 'allocate' and 'deallocate' are thread-safe.
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently by multiple threads are distinct,
+        //:   maximally aligned, and remain intact while in use.
+        //:
+        //: 2 The free list is not corrupted when several threads concurrently
+        //:   pop and push the same blocks (the ABA problem).
+        //:
+        //: 3 Concurrent replenishment does not lose or duplicate blocks.
+        //:
+        //: 4 Blocks allocated by one thread may be deallocated by another.
+        //
+        // Plan:
+        //: 1 Run several threads that repeatedly allocate a batch of blocks,
+        //:   stamp each block with a value unique to the thread, verify the
+        //:   stamps, and deallocate the blocks out of order.  Use a pool with
+        //:   a small constant chunk size so that replenishment is frequent.
+        //:   (C-1..3)
+        //:
+        //: 2 Allocate blocks in the main thread and deallocate them in the
+        //:   worker threads (and vice versa) between runs.  (C-4)
+        //:
+        //: 3 After all threads are joined, allocate every block that was ever
+        //:   replenished and verify that no block is dispensed twice.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'allocate' and 'deallocate' are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase7;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        enum { NUM_THREADS = 4, NUM_ITERATIONS = 2000 };
+
+        {
+            Obj mX(BLOCK_SIZE, bsls::BlockGrowth::BSLS_CONSTANT, 4, &sa);
+
+            ThreadInfo info[NUM_THREADS];
+            ThreadId   ids[NUM_THREADS];
+
+            for (int run = 0; run < 3; ++run) {
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    ThreadInfo ti = { i, NUM_ITERATIONS, &mX };
+                    info[i] = ti;
+                    ids[i]  = createThread(&workerThread, &info[i]);
+                }
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    joinThread(ids[i]);
+                }
+            }
+
+            // Each chunk holds 4 blocks; allocate all of them, and verify
+            // that no block is dispensed twice.
+
+            const int NUM_CHUNKS = static_cast<int>(sa.numBlocksInUse());
+            const int NUM_FREE   = 4 * NUM_CHUNKS;
+
+            if (veryVerbose) { P(NUM_FREE); }
+
+            void **blocks = static_cast<void **>(
+                                      sa.allocate(NUM_FREE * sizeof(void *)));
+            for (int i = 0; i < NUM_FREE; ++i) {
+                blocks[i] = mX.allocate();
+                bsl::memset(blocks[i], i & 0xff, BLOCK_SIZE);
+            }
+            LOOP2_ASSERT(NUM_CHUNKS, sa.numBlocksInUse(),
+                         NUM_CHUNKS + 1 == sa.numBlocksInUse());
+
+            for (int i = 0; i < NUM_FREE; ++i) {
+                const char *p = static_cast<const char *>(blocks[i]);
+                LOOP_ASSERT(i, static_cast<char>(i & 0xff) == p[0]);
+                LOOP_ASSERT(i, static_cast<char>(i & 0xff) == p[BLOCK_SIZE-1]);
+            }
+            for (int i = 0; i < NUM_FREE; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            sa.deallocate(blocks);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT OWNERSHIP STRESS TEST
+        //   Ensure that no block is dispensed to two threads at once.
+        //
+        // Concerns:
+        //: 1 A block that is on the free list is dispensed by 'allocate' to
+        //:   at most one thread, even when other threads concurrently pop the
+        //:   same block, deallocate it, and push it back (i.e., the free list
+        //:   is immune to the ABA problem).
+        //:
+        //: 2 No block is on the free list more than once after a stress run.
+        //
+        // Plan:
+        //: 1 Run many threads that repeatedly allocate batches of one to three
+        //:   blocks from a pool with a constant chunk size of 2, and claim and
+        //:   release each block using an atomic owner word stored in the
+        //:   block.  Verify that every claim and release succeeds.  (C-1)
+        //:
+        //: 2 After all threads are joined, allocate every block the pool owns
+        //:   and verify that the addresses are distinct.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: No block is dispensed to two threads at once.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT OWNERSHIP STRESS TEST" << endl
+                          << "================================" << endl;
+
+        using namespace TestCase8;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        enum { NUM_THREADS = 16, NUM_ITERATIONS = 100000, CHUNK_SIZE = 2 };
+
+        {
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &sa);
+
+            ThreadInfo info[NUM_THREADS];
+            ThreadId   ids[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ThreadInfo ti = { i, NUM_ITERATIONS, 0, &mX };
+                info[i] = ti;
+                ids[i]  = createThread(&stressThread, &info[i]);
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                joinThread(ids[i]);
+                LOOP2_ASSERT(i, info[i].d_numViolations,
+                             0 == info[i].d_numViolations);
+            }
+
+            const int NUM_CHUNKS = static_cast<int>(sa.numBlocksInUse());
+            const int NUM_FREE   = CHUNK_SIZE * NUM_CHUNKS;
+
+            if (veryVerbose) { P(NUM_FREE); }
+
+            void **blocks = static_cast<void **>(
+                                      sa.allocate(NUM_FREE * sizeof(void *)));
+            for (int i = 0; i < NUM_FREE; ++i) {
+                blocks[i] = mX.allocate();
+            }
+            LOOP2_ASSERT(NUM_CHUNKS, sa.numBlocksInUse(),
+                         NUM_CHUNKS + 1 == sa.numBlocksInUse());
+
+            bsl::sort(blocks, blocks + NUM_FREE);
+            for (int i = 1; i < NUM_FREE; ++i) {
+                LOOP_ASSERT(i, blocks[i - 1] != blocks[i]);
+            }
+            for (int i = 0; i < NUM_FREE; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            sa.deallocate(blocks);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'deleteObject', 'deleteObjectRaw', AND FREE OPERATORS
+        //
+        // Concerns:
+        //: 1 'operator new' dispenses a block from the pool.
+        //:
+        //: 2 'deleteObject' and 'deleteObjectRaw' destroy the object and
+        //:   return its block to the pool, and have no effect when passed 0.
+        //:
+        //: 3 'operator delete' returns the block to the pool.
+        //
+        // Plan:
+        //: 1 Create objects with 'operator new', destroy them with each of
+        //:   the deleting methods, and verify that the destructor ran and that
+        //:   the block is the next one dispensed.  (C-1..3)
+        //
+        // Testing:
+        //   void deleteObject(const TYPE *object);
+        //   void deleteObjectRaw(const TYPE *object);
+        //   void *operator new(bsl::size_t size, bdlma::ConcurrentPool& pool);
+        //   void operator delete(void *address, bdlma::ConcurrentPool& pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'deleteObject', 'deleteObjectRaw', AND FREE "
+                          << "OPERATORS" << endl
+                          << "============================================"
+                          << "=========" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        Obj mX(sizeof(my_Class), &sa);
+
+        my_Class *p = new (mX) my_Class;
+        mX.deleteObject(p);
+        ASSERT(1 == my_Class::numDestroyed());
+
+        my_Class *q = new (mX) my_Class;
+        ASSERT(p == q);
+        mX.deleteObjectRaw(q);
+        ASSERT(2 == my_Class::numDestroyed());
+
+        mX.deleteObject(static_cast<my_Class *>(0));
+        mX.deleteObjectRaw(static_cast<my_Class *>(0));
+        ASSERT(2 == my_Class::numDestroyed());
+
+        void *r = operator new(sizeof(my_Class), mX);
+        ASSERT(p == r);
+        operator delete(r, mX);
+        ASSERT(p == mX.allocate());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory to the underlying allocator.
+        //:
+        //: 2 The pool is fully usable after 'release'.
+        //
+        // Plan:
+        //: 1 Allocate a number of blocks, call 'release', and verify that no
+        //:   memory is outstanding from the underlying allocator.  (C-1)
+        //:
+        //: 2 Allocate again and verify that memory is obtained from the
+        //:   underlying allocator.  (C-2)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release'" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        Obj mX(24, &sa);
+
+        for (int rep = 0; rep < 3; ++rep) {
+            for (int i = 0; i < 100; ++i) {
+                void *p = mX.allocate();
+                if (i & 1) {
+                    mX.deallocate(p);
+                }
+            }
+            ASSERT(0 < sa.numBlocksInUse());
+
+            mX.release();
+            LOOP_ASSERT(rep, 0 == sa.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 After 'reserveCapacity(n)', 'n' blocks can be allocated without
+        //:   further requests to the underlying allocator.
+        //:
+        //: 2 'reserveCapacity(0)' has no effect.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of block counts, reserve capacity, allocate that many
+        //:   blocks, and verify that exactly one request was made to the
+        //:   underlying allocator.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative count.  (C-3)
+        //
+        // Testing:
+        //   void reserveCapacity(int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reserveCapacity'" << endl
+                          << "=================" << endl;
+
+        const int DATA[] = { 0, 1, 2, 5, 32, 100, 1000 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NUM_BLOCKS = DATA[ti];
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(16, &sa);
+
+            mX.reserveCapacity(NUM_BLOCKS);
+            LOOP_ASSERT(NUM_BLOCKS,
+                        (NUM_BLOCKS ? 1 : 0) == sa.numBlocksTotal());
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.allocate();
+            }
+            LOOP_ASSERT(NUM_BLOCKS,
+                        (NUM_BLOCKS ? 1 : 0) == sa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(16, &sa);
+
+            ASSERT_PASS(mX.reserveCapacity( 0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // GROWTH STRATEGY
+        //
+        // Concerns:
+        //: 1 When constant growth is used, the pool replenishes with the
+        //:   specified 'maxBlocksPerChunk' (or an implementation-defined
+        //:   default).
+        //:
+        //: 2 When geometric growth is used, the pool replenishes with a
+        //:   geometrically increasing chunk size, starting at 1, up to the
+        //:   specified 'maxBlocksPerChunk'.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create pools with varying
+        //:   growth strategies and maximum chunk sizes.  Allocate blocks
+        //:   repeatedly, and verify that a request is made to the underlying
+        //:   allocator exactly when the expected chunk is exhausted.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   ConcurrentPool(int blockSize, Strategy gs, Allocator *ba = 0);
+        //   ConcurrentPool(int bs, Strategy gs, int mbpc, Allocator *ba = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROWTH STRATEGY" << endl
+                          << "===============" << endl;
+
+        const Strategy GEO = bsls::BlockGrowth::BSLS_GEOMETRIC;
+        const Strategy CON = bsls::BlockGrowth::BSLS_CONSTANT;
+
+        static const struct {
+            int      d_line;
+            int      d_blockSize;
+            Strategy d_strategy;
+            int      d_maxBlocksPerChunk;  // 0 means "use default"
+        } DATA[] = {
+            // LINE  BLOCK SIZE  STRATEGY  MAX BLOCKS
+            // ----  ----------  --------  ----------
+            {  L_,            1,      CON,          0 },
+            {  L_,            1,      CON,          1 },
+            {  L_,            8,      CON,         16 },
+            {  L_,           30,      CON,         33 },
+            {  L_,            1,      GEO,          0 },
+            {  L_,            1,      GEO,          1 },
+            {  L_,            8,      GEO,         16 },
+            {  L_,           30,      GEO,         33 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int      LINE       = DATA[ti].d_line;
+            const int      BLOCK_SIZE = DATA[ti].d_blockSize;
+            const Strategy STRATEGY   = DATA[ti].d_strategy;
+            const int      MAX_BLOCKS = DATA[ti].d_maxBlocksPerChunk;
+
+            const int      EXP_MAX    = MAX_BLOCKS ? MAX_BLOCKS : 32;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj *pX = MAX_BLOCKS
+                    ? new (sa) Obj(BLOCK_SIZE, STRATEGY, MAX_BLOCKS, &sa)
+                    : new (sa) Obj(BLOCK_SIZE, STRATEGY, &sa);
+
+            ASSERT(BLOCK_SIZE == pX->blockSize());
+
+            int chunkSize = GEO == STRATEGY ? 1 : EXP_MAX;
+
+            for (int chunk = 0; chunk < 8; ++chunk) {
+                const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+                for (int i = 0; i < chunkSize; ++i) {
+                    void *p = pX->allocate();
+                    LOOP2_ASSERT(LINE, chunk, isMaximallyAligned(p));
+                }
+                LOOP2_ASSERT(LINE, chunk,
+                             NUM_ALLOCATIONS + 1 == sa.numAllocations());
+
+                chunkSize = chunkSize * 2 <= EXP_MAX && GEO == STRATEGY
+                          ? chunkSize * 2
+                          : EXP_MAX;
+            }
+
+            sa.deleteObject(pX);
+            LOOP_ASSERT(LINE, 0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj( 1, CON,  1));
+            ASSERT_FAIL(Obj( 0, CON,  1));
+            ASSERT_FAIL(Obj( 1, CON,  0));
+            ASSERT_PASS(Obj( 1, GEO));
+            ASSERT_FAIL(Obj(-1, GEO));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSOR
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned blocks, writable for (at
+        //:   least) 'blockSize()' bytes, that do not overlap.
+        //:
+        //: 2 A block that is deallocated is the next block dispensed.
+        //:
+        //: 3 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied, and all memory is
+        //:   returned on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a variety of block sizes, allocate a number of blocks, write
+        //:   every byte of each, and verify alignment and that the contents of
+        //:   earlier blocks are unchanged.  (C-1)
+        //:
+        //: 2 Deallocate blocks and verify that they are re-dispensed in LIFO
+        //:   order.  (C-2)
+        //:
+        //: 3 Use test allocators to verify the source of memory.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ConcurrentPool(int blockSize, Allocator *ba = 0);
+        //   ~ConcurrentPool();
+        //   void *allocate();
+        //   void deallocate(void *address);
+        //   int blockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSOR" << endl
+                          << "=======================================" << endl;
+
+        const int DATA[] = { 1, 2, 5, 8, 12, 16, 24, 31, 32, 100, 1000 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        enum { NUM_BLOCKS = 50 };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int BLOCK_SIZE = DATA[ti];
+
+            bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                bslma::TestAllocator& oa = cfg ? sa : da;
+                bslma::TestAllocator& na = cfg ? da : sa;
+
+                {
+                    Obj  mXD(BLOCK_SIZE);
+                    Obj  mXS(BLOCK_SIZE, &sa);
+                    Obj& mX = cfg ? mXS : mXD;  const Obj& X = mX;
+
+                    LOOP_ASSERT(BLOCK_SIZE, BLOCK_SIZE == X.blockSize());
+
+                    char *blocks[NUM_BLOCKS];
+                    for (int i = 0; i < NUM_BLOCKS; ++i) {
+                        blocks[i] = static_cast<char *>(mX.allocate());
+                        LOOP2_ASSERT(BLOCK_SIZE, i,
+                                     isMaximallyAligned(blocks[i]));
+                        bsl::memset(blocks[i], i, BLOCK_SIZE);
+                    }
+                    for (int i = 0; i < NUM_BLOCKS; ++i) {
+                        for (int j = 0; j < BLOCK_SIZE; ++j) {
+                            LOOP3_ASSERT(BLOCK_SIZE, i, j,
+                                         static_cast<char>(i) == blocks[i][j]);
+                        }
+                    }
+
+                    LOOP_ASSERT(BLOCK_SIZE, 0 <  oa.numBlocksInUse());
+                    LOOP_ASSERT(BLOCK_SIZE, 0 == na.numBlocksInUse());
+
+                    const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                           oa.numAllocations();
+
+                    mX.deallocate(blocks[3]);
+                    mX.deallocate(blocks[7]);
+                    LOOP_ASSERT(BLOCK_SIZE, blocks[7] == mX.allocate());
+                    LOOP_ASSERT(BLOCK_SIZE, blocks[3] == mX.allocate());
+
+                    LOOP_ASSERT(BLOCK_SIZE,
+                                NUM_ALLOCATIONS == oa.numAllocations());
+                }
+                LOOP_ASSERT(BLOCK_SIZE, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            ASSERT_PASS(Obj( 1, &sa));
+            ASSERT_FAIL(Obj( 0, &sa));
+
+            Obj mX(8, &sa);
+
+            ASSERT_SAFE_FAIL(mX.deallocate(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, allocate and deallocate blocks, and verify that
+        //:   memory comes from the supplied allocator.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(100, &sa);
+
+            void *p1 = mX.allocate();  bsl::memset(p1, 1, 100);
+            void *p2 = mX.allocate();  bsl::memset(p2, 2, 100);
+
+            ASSERT(p1 != p2);
+            ASSERT(0  < sa.numBlocksInUse());
+
+            mX.deallocate(p1);
+            ASSERT(p1 == mX.allocate());
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT VERSUS THREAD COUNT
+        //   Compare the allocate/deallocate throughput of a 'ConcurrentPool'
+        //   with that of a lock-protected 'bdlma::Pool' as the number of
+        //   threads grows.
+        //
+        // Concerns:
+        //: 1 The concurrent pool outperforms the lock-protected pool under
+        //:   contention.
+        //
+        // Plan:
+        //: 1 For thread counts of 1 to 32, run a sliding-window workload
+        //:   against each pool, and report the elapsed wall time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: allocate/deallocate throughput versus thread count
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: THROUGHPUT VERSUS THREAD COUNT"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        using namespace TestCaseMinus1;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        cout << "threads\tconcurrent\tlocked" << endl;
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj        concurrent(BLOCK_SIZE);
+            LockedPool locked(BLOCK_SIZE);
+
+            const double tc = runBenchmark(&concurrent,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+            const double tl = runBenchmark(&locked,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+
+            cout << numThreads << '\t' << tc << '\t' << tl << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,460 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetLargePageMinimum', 'GetSystemInfo',
+                       // 'VirtualAlloc', 'VirtualFree'
+#else
+
+#include <sys/mman.h>  // 'madvise', 'mmap', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslma::Allocator::size_type size_type;
+
+enum {
+    k_DEFAULT_HUGE_PAGE_SIZE  = 2 * 1024 * 1024,  // huge page size assumed
+                                                  // where huge pages are
+                                                  // supported
+
+    k_DEFAULT_REGION_SIZE     = 8 * 1024 * 1024   // default region size
+};
+
+// HELPER FUNCTIONS
+
+size_type roundUp(size_type size, size_type granularity)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'granularity'.  The behavior is undefined unless 'granularity' is a
+    // power of 2.
+{
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+size_type getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return pageSize.loadRelaxed();
+}
+
+size_type getHugePageSize()
+    // Return the size (in bytes) of a huge page, or of a system memory page if
+    // huge pages are not supported on this platform.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    const size_type size = GetLargePageMinimum();
+    return size ? size : getSystemPageSize();
+
+#elif defined(MAP_HUGETLB) || defined(MADV_HUGEPAGE)
+
+    return k_DEFAULT_HUGE_PAGE_SIZE;
+
+#else
+
+    return getSystemPageSize();
+
+#endif
+}
+
+void *systemMapHugeTlb(size_type size)
+    // Map a block of memory of the specified 'size' (in bytes) from the
+    // system's pool of reserved huge pages, and return its address, or return
+    // 0 if the pool is unavailable or exhausted.  The behavior is undefined
+    // unless 'size' is a multiple of 'getHugePageSize()'.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    return VirtualAlloc(0,
+                        size,
+                        MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                        PAGE_READWRITE);
+
+#elif defined(MAP_HUGETLB)
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                         -1,
+                         0);
+    return MAP_FAILED == address ? 0 : address;
+
+#else
+
+    (void)size;
+    return 0;
+
+#endif
+}
+
+void *systemMap(size_type size, size_type alignment)
+    // Map a block of memory of the specified 'size' (in bytes) at an address
+    // that is a multiple of the specified 'alignment', and return its
+    // address, or return 0 if the mapping fails.  The behavior is undefined
+    // unless 'size' and 'alignment' are multiples of 'getSystemPageSize()',
+    // and 'alignment' is a power of 2.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    (void)alignment;
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+#else
+
+    // Over-map by 'alignment - pageSize' bytes, and unmap the misaligned head
+    // and the excess tail.
+
+    const size_type pageSize   = getSystemPageSize();
+    const size_type extra      = alignment > pageSize
+                               ? alignment - pageSize
+                               : 0;
+
+    void *address = mmap(0,
+                         size + extra,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1,
+                         0);
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    char *begin   = static_cast<char *>(address);
+    char *aligned = reinterpret_cast<char *>(
+                     roundUp(reinterpret_cast<bsls::Types::UintPtr>(begin),
+                             alignment));
+    if (aligned != begin) {
+        munmap(begin, aligned - begin);
+    }
+    if (begin + extra != aligned) {
+        munmap(aligned + size, (begin + extra) - aligned);
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (alignment > pageSize) {
+        madvise(aligned, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    return aligned;
+
+#endif
+}
+
+void systemUnmap(void *address, size_type size)
+    // Return the block of memory at the specified 'address' having the
+    // specified 'size' (in bytes) to the system.  The behavior is undefined
+    // unless 'address' and 'size' describe a block returned by 'systemMap' or
+    // 'systemMapHugeTlb'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    (void)size;
+
+    VirtualFree(address, 0, MEM_RELEASE);
+
+#else
+
+    munmap(address, size);
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+HugePageAllocator::Region *HugePageAllocator::mapRegion(size_type minSize)
+{
+    const size_type hugeSize = getHugePageSize();
+
+    size_type  mappedSize = 0;
+    void      *address    = 0;
+    bool       isHugeTlb  = false;
+
+    if (e_EXPLICIT == d_policy) {
+        mappedSize = roundUp(minSize, hugeSize);
+        address    = systemMapHugeTlb(mappedSize);
+        isHugeTlb  = 0 != address;
+    }
+
+    if (!address) {
+        const size_type granularity = e_NO_HUGE_PAGES == d_policy
+                                    ? getSystemPageSize()
+                                    : hugeSize;
+
+        mappedSize = roundUp(minSize, granularity);
+        address    = systemMap(mappedSize, granularity);
+    }
+
+    if (!address) {
+        return 0;                                                     // RETURN
+    }
+
+    Region *region = static_cast<Region *>(address);
+
+    region->d_prev_p     = 0;
+    region->d_next_p     = d_head_p;
+    region->d_begin_p    = static_cast<char *>(address)
+                         + bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                               sizeof(Region));
+    region->d_cursor_p   = region->d_begin_p;
+    region->d_end_p      = static_cast<char *>(address) + mappedSize;
+    region->d_mappedSize = mappedSize;
+    region->d_numBlocks  = 0;
+    region->d_isHugeTlb  = isHugeTlb;
+
+    if (d_head_p) {
+        d_head_p->d_prev_p = region;
+    }
+    d_head_p = region;
+
+    d_numBytesMapped += mappedSize;
+    ++d_numRegions;
+    if (isHugeTlb) {
+        ++d_numHugeTlbRegions;
+    }
+
+    return region;
+}
+
+void HugePageAllocator::unmapRegion(Region *region)
+{
+    BSLS_ASSERT(region);
+
+    if (region->d_prev_p) {
+        region->d_prev_p->d_next_p = region->d_next_p;
+    }
+    else {
+        d_head_p = region->d_next_p;
+    }
+    if (region->d_next_p) {
+        region->d_next_p->d_prev_p = region->d_prev_p;
+    }
+
+    d_numBytesMapped -= region->d_mappedSize;
+    --d_numRegions;
+    if (region->d_isHugeTlb) {
+        --d_numHugeTlbRegions;
+    }
+
+    systemUnmap(region, region->d_mappedSize);
+}
+
+// CLASS METHODS
+HugePageAllocator::size_type HugePageAllocator::hugePageSize()
+{
+    return getHugePageSize();
+}
+
+HugePageAllocator::size_type HugePageAllocator::pageSize()
+{
+    return getSystemPageSize();
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(HugePagePolicy policy)
+: d_head_p(0)
+, d_current_p(0)
+, d_regionSize(roundUp(k_DEFAULT_REGION_SIZE, getHugePageSize()))
+, d_policy(policy)
+, d_numBytesMapped(0)
+, d_numRegions(0)
+, d_numHugeTlbRegions(0)
+{
+}
+
+HugePageAllocator::HugePageAllocator(size_type      regionSize,
+                                     HugePagePolicy policy)
+: d_head_p(0)
+, d_current_p(0)
+, d_regionSize(roundUp(regionSize, getHugePageSize()))
+, d_policy(policy)
+, d_numBytesMapped(0)
+, d_numRegions(0)
+, d_numHugeTlbRegions(0)
+{
+    BSLS_ASSERT(0 < regionSize);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    while (d_head_p) {
+        unmapRegion(d_head_p);
+    }
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const size_type blockSize =
+         sizeof(BlockHeader) + bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                                        size);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    Region *region;
+
+    if (blockSize > d_regionSize / 4) {
+        // Map a region for this block alone, leaving the current region in
+        // place.
+
+        region = mapRegion(sizeof(Region)
+                         + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                         + blockSize);
+    }
+    else if (d_current_p
+          && static_cast<size_type>(d_current_p->d_end_p
+                                              - d_current_p->d_cursor_p)
+                                                               >= blockSize) {
+        region = d_current_p;
+    }
+    else {
+        // The previous current region (if any) still has outstanding blocks,
+        // and is unmapped when the last of them is deallocated.
+
+        region = mapRegion(d_regionSize);
+        if (region) {
+            d_current_p = region;
+        }
+    }
+
+    if (!region) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(region->d_cursor_p);
+    header->d_region_p  = region;
+
+    region->d_cursor_p += blockSize;
+    ++region->d_numBlocks;
+
+    return header + 1;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Region *region = (static_cast<BlockHeader *>(address) - 1)->d_region_p;
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    BSLS_ASSERT(0 < region->d_numBlocks);
+
+    if (0 == --region->d_numBlocks) {
+        if (region == d_current_p) {
+            region->d_cursor_p = region->d_begin_p;
+        }
+        else {
+            unmapRegion(region);
+        }
+    }
+}
+
+// ACCESSORS
+HugePageAllocator::size_type HugePageAllocator::numBytesMapped() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numBytesMapped;
+}
+
+int HugePageAllocator::numHugeTlbRegions() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numHugeTlbRegions;
+}
+
+int HugePageAllocator::numRegions() const
+{
+    bsls::BslLockGuard guard(&d_lock);
+
+    return d_numRegions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,366 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that maps memory, optionally in huge pages.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: thread-safe allocator of mapped memory regions
+//
+//@SEE_ALSO: bdlma_guardingallocator, bdlma_pool, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bslma::Allocator' protocol
+// and obtains its memory directly from the virtual-memory system (using
+// 'mmap' on UNIX platforms and 'VirtualAlloc' on Windows) in large *regions*,
+// which may be backed by huge pages (typically 2MB) rather than by regular
+// pages (typically 4KB):
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         hugePageSize
+//               |         numBytesMapped
+//               |         numHugeTlbRegions
+//               |         numRegions
+//               |         pageSize
+//               |         policy
+//               |         regionSize
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+// A 'bdlma::HugePageAllocator' is intended to be supplied as the underlying
+// allocator of pools and sequential allocators, such as 'bdlma::Pool',
+// 'bdlma::Multipool', and 'bdlma::SequentialAllocator', which request memory
+// from their underlying allocator in large chunks and dispense it in small
+// blocks.  When the blocks of a large node-based container are spread over
+// regular pages, traversing the container incurs frequent TLB misses; backing
+// the chunks with huge pages lets a single TLB entry cover 512 times as much
+// memory.
+//
+///Regions
+///-------
+// Memory is mapped in regions of a size (rounded up to a multiple of the huge
+// page size) that may be supplied at construction.  Blocks returned by
+// 'allocate' are carved sequentially from the *current* region; a region is
+// unmapped (i.e., returned to the system) once all of the blocks carved from
+// it have been deallocated, unless it is the current region, in which case it
+// is reused from its start.  A request that is too large to be carved
+// efficiently from a region (more than one quarter of the region size) is
+// satisfied from a region mapped for that request alone, which is unmapped
+// when the block is deallocated.  Note that a region is reserved but not
+// backed by physical memory until it is first written, so a large region size
+// does not, by itself, increase the resident memory of a process.
+//
+///Huge Page Policy
+///----------------
+// The use of huge pages is controlled by the 'HugePagePolicy' supplied at
+// construction:
+//
+//: 'e_NO_HUGE_PAGES':
+//:   Regions are mapped in regular pages.
+//:
+//: 'e_TRANSPARENT' (the default):
+//:   Regions are aligned on huge-page boundaries, and the system is advised
+//:   that they should be backed by transparent huge pages (on Linux, using
+//:   'madvise(MADV_HUGEPAGE)').  Whether huge pages are actually used is at
+//:   the discretion of the system; if transparent huge pages are unsupported
+//:   or disabled, regular pages are used.
+//:
+//: 'e_EXPLICIT':
+//:   Regions are mapped from the system's pool of reserved huge pages (on
+//:   Linux, using 'mmap' with 'MAP_HUGETLB'; on Windows, using
+//:   'MEM_LARGE_PAGES').  If the pool is exhausted or not configured, or the
+//:   process lacks the necessary privilege, the region is mapped as per
+//:   'e_TRANSPARENT' instead.  The 'numHugeTlbRegions' accessor reports how
+//:   many of the currently mapped regions were obtained from the pool.
+//
+// On platforms that provide no support for huge pages, all policies map
+// regions in regular pages.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HugePageAllocator' is *fully thread-safe*, meaning that any
+// operation on the same object can be safely invoked from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Pool with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large linked structure whose nodes are supplied
+// by a 'bdlma::Pool', and that profiling shows that traversal of the
+// structure is dominated by TLB misses.  We can back the chunks of the pool
+// with huge pages by supplying a 'bdlma::HugePageAllocator' to the pool.
+//
+// First, we define a simple node type:
+//..
+//  struct Node {
+//      Node *d_next_p;
+//      int   d_value;
+//  };
+//..
+// Then, we create a huge-page allocator, and a pool of nodes that obtains its
+// chunks from it:
+//..
+//  bdlma::HugePageAllocator hugePageAllocator;
+//  bdlma::Pool              pool(sizeof(Node),
+//                                bsls::BlockGrowth::BSLS_GEOMETRIC,
+//                                &hugePageAllocator);
+//..
+// Next, we build a list of nodes:
+//..
+//  Node *head = 0;
+//  for (int i = 0; i < 100000; ++i) {
+//      Node *node = static_cast<Node *>(pool.allocate());
+//      node->d_next_p = head;
+//      node->d_value  = i;
+//      head = node;
+//  }
+//..
+// Now, we observe that the chunks of the pool were carved from regions mapped
+// by 'hugePageAllocator', each a multiple of the huge page size:
+//..
+//  assert(0 < hugePageAllocator.numRegions());
+//  assert(0 == hugePageAllocator.numBytesMapped()
+//                                      % hugePageAllocator.hugePageSize());
+//..
+// Finally, we release the pool, which returns its chunks to
+// 'hugePageAllocator', which in turn unmaps all but its current region:
+//..
+//  pool.release();
+//  assert(1 >= hugePageAllocator.numRegions());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, and supplies memory blocks
+    // from regions of memory that are mapped directly from the virtual-memory
+    // system, optionally backed by huge pages according to the
+    // 'HugePagePolicy' supplied at construction.  Note that, unlike many other
+    // allocators, an allocator cannot be (optionally) supplied at
+    // construction.
+
+  public:
+    // TYPES
+    enum HugePagePolicy {
+        // Enumerate the policies governing the use of huge pages that may be
+        // (optionally) supplied at construction.
+
+        e_NO_HUGE_PAGES,  // map regions in regular pages
+
+        e_TRANSPARENT,    // align regions on huge-page boundaries and advise
+                          // the system to back them with huge pages
+
+        e_EXPLICIT        // map regions from the reserved huge page pool, if
+                          // possible, and otherwise as per 'e_TRANSPARENT'
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Region {
+        // This 'struct' overlays the beginning of each mapped region, and
+        // links the region into the doubly-linked list of regions owned by
+        // the allocator.
+
+        Region    *d_prev_p;      // previous region in the list
+        Region    *d_next_p;      // next region in the list
+        char      *d_begin_p;     // first usable byte
+        char      *d_cursor_p;    // first free byte
+        char      *d_end_p;       // one past the last usable byte
+        size_type  d_mappedSize;  // size of the mapping (in bytes)
+        int        d_numBlocks;   // number of blocks outstanding
+        bool       d_isHugeTlb;   // 'true' if mapped from huge page pool
+    };
+
+    union BlockHeader {
+        // This 'union' precedes each block returned by 'allocate', and
+        // identifies the region from which the block was carved.
+
+        Region                              *d_region_p;  // owning region
+        bsls::AlignmentUtil::MaxAlignedType  d_dummy;     // force alignment
+    };
+
+    // DATA
+    mutable bsls::BslLock  d_lock;               // guards all other members
+
+    Region                *d_head_p;             // list of mapped regions
+
+    Region                *d_current_p;          // region from which blocks
+                                                 // are carved (or 0)
+
+    size_type              d_regionSize;         // size of a shared region
+
+    HugePagePolicy         d_policy;             // use of huge pages
+
+    size_type              d_numBytesMapped;     // total size of mappings
+
+    int                    d_numRegions;         // number of mapped regions
+
+    int                    d_numHugeTlbRegions;  // number of mapped regions
+                                                 // from the huge page pool
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+    // PRIVATE MANIPULATORS
+    Region *mapRegion(size_type minSize);
+        // Map a new region of at least the specified 'minSize' (in bytes),
+        // including the region header, link it into the list of regions, and
+        // return its address, or return 0 if the mapping fails.  The
+        // behavior is undefined unless 'd_lock' is held.
+
+    void unmapRegion(Region *region);
+        // Unlink the specified 'region' from the list of regions and return
+        // its memory to the system.  The behavior is undefined unless
+        // 'd_lock' is held.
+
+  public:
+    // CLASS METHODS
+    static size_type hugePageSize();
+        // Return the size (in bytes) of a huge page on this platform, or the
+        // size of a regular page if the platform does not support huge pages.
+
+    static size_type pageSize();
+        // Return the size (in bytes) of a regular page on this platform.
+
+    // CREATORS
+    explicit
+    HugePageAllocator(HugePagePolicy policy = e_TRANSPARENT);
+    explicit
+    HugePageAllocator(size_type      regionSize,
+                      HugePagePolicy policy = e_TRANSPARENT);
+        // Create a huge-page allocator.  Optionally specify a 'regionSize'
+        // (in bytes) indicating the size of the regions from which blocks are
+        // carved; the size is rounded up to a multiple of 'hugePageSize()'.
+        // If 'regionSize' is not specified, an implementation-defined value
+        // is used.  Optionally specify a 'policy' governing the use of huge
+        // pages.  If 'policy' is not specified, 'e_TRANSPARENT' is used.  The
+        // behavior is undefined unless '0 < regionSize'.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator object, and return all of the memory that it
+        // has mapped to the system, regardless of whether blocks allocated
+        // from it remain outstanding.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes).  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If memory cannot be mapped from the
+        // system, 'bsl::bad_alloc' is thrown (or, if exceptions are disabled,
+        // 0 is returned).
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  If
+        // 'address' is the last outstanding block of a region other than the
+        // current region, the region is returned to the system.  The behavior
+        // is undefined unless 'address' was returned by 'allocate' and has not
+        // already been deallocated.
+
+    // ACCESSORS
+    size_type numBytesMapped() const;
+        // Return the total size (in bytes) of the regions currently mapped by
+        // this allocator.
+
+    int numHugeTlbRegions() const;
+        // Return the number of regions currently mapped by this allocator
+        // that were obtained from the system's pool of reserved huge pages.
+        // Note that this number is 0 unless the 'e_EXPLICIT' policy is in
+        // effect and the pool was available.
+
+    int numRegions() const;
+        // Return the number of regions currently mapped by this allocator.
+
+    HugePagePolicy policy() const;
+        // Return the huge page policy of this allocator.
+
+    size_type regionSize() const;
+        // Return the size (in bytes) of the regions from which this allocator
+        // carves blocks.
+};
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+HugePageAllocator::HugePagePolicy HugePageAllocator::policy() const
+{
+    return d_policy;
+}
+
+inline
+HugePageAllocator::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,707 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_multipool.h>
+#include <bdlma_pool.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// A 'bdlma::HugePageAllocator' obtains regions of memory directly from the
+// virtual-memory system, and carves maximally-aligned blocks from them.  The
+// primary concerns are that the blocks are usable, aligned, and disjoint,
+// that regions are unmapped when (and only when) their last block is
+// deallocated, that large requests are satisfied from dedicated regions, and
+// that every huge page policy yields usable memory, falling back when huge
+// pages are unavailable.  Since whether huge pages are available depends on
+// the configuration of the test machine, the tests verify only the behavior
+// that is independent of it.
+//
+// The accessors 'numRegions', 'numBytesMapped', and 'numHugeTlbRegions' are
+// used throughout to observe the mapping of regions.
+//-----------------------------------------------------------------------------
+// // CLASS METHODS
+// [ 2] static size_type hugePageSize();
+// [ 2] static size_type pageSize();
+//
+// // CREATORS
+// [ 2] bdlma::HugePageAllocator(HugePagePolicy p = e_TRANSPARENT);
+// [ 2] bdlma::HugePageAllocator(size_type r, HugePagePolicy p = ...);
+// [ 3] ~bdlma::HugePageAllocator();
+//
+// // MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// // ACCESSORS
+// [ 3] size_type numBytesMapped() const;
+// [ 4] int numHugeTlbRegions() const;
+// [ 3] int numRegions() const;
+// [ 2] HugePagePolicy policy() const;
+// [ 2] size_type regionSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: every huge page policy yields usable memory
+// [ 5] CONCERN: usable as the underlying allocator of pools
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+
+typedef bslma::Allocator::size_type size_type;
+
+enum { MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+static const Obj::HugePagePolicy POLICIES[] = {
+    Obj::e_NO_HUGE_PAGES,
+    Obj::e_TRANSPARENT,
+    Obj::e_EXPLICIT
+};
+const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Pool with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large linked structure whose nodes are supplied
+// by a 'bdlma::Pool', and that profiling shows that traversal of the
+// structure is dominated by TLB misses.  We can back the chunks of the pool
+// with huge pages by supplying a 'bdlma::HugePageAllocator' to the pool.
+//
+// First, we define a simple node type:
+//..
+    struct Node {
+        Node *d_next_p;
+        int   d_value;
+    };
+//..
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Neither the default nor the global allocator should be used.
+
+    bslma::TestAllocator defaultAllocator("Default Allocator",
+                                          veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("Global Allocator",
+                                         veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a huge-page allocator, and a pool of nodes that obtains its
+// chunks from it:
+//..
+    bdlma::HugePageAllocator hugePageAllocator;
+    bdlma::Pool              pool(sizeof(Node),
+                                  bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                  &hugePageAllocator);
+//..
+// Next, we build a list of nodes:
+//..
+    Node *head = 0;
+    for (int i = 0; i < 100000; ++i) {
+        Node *node = static_cast<Node *>(pool.allocate());
+        node->d_next_p = head;
+        node->d_value  = i;
+        head = node;
+    }
+//..
+// Now, we observe that the chunks of the pool were carved from regions mapped
+// by 'hugePageAllocator', each a multiple of the huge page size:
+//..
+    ASSERT(0 < hugePageAllocator.numRegions());
+    ASSERT(0 == hugePageAllocator.numBytesMapped()
+                                        % hugePageAllocator.hugePageSize());
+//..
+// Finally, we release the pool, which returns its chunks to
+// 'hugePageAllocator', which in turn unmaps all but its current region:
+//..
+    pool.release();
+    ASSERT(1 >= hugePageAllocator.numRegions());
+//..
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // UNDERLYING ALLOCATOR OF POOLS
+        //
+        // Concerns:
+        //: 1 A huge-page allocator can supply the memory of a 'bdlma::Pool',
+        //:   a 'bdlma::Multipool', and a 'bdlma::SequentialAllocator'.
+        //:
+        //: 2 When such an object releases its memory, every region other
+        //:   than the current region is unmapped.
+        //
+        // Plan:
+        //: 1 For each huge page policy, allocate many blocks from each kind
+        //:   of object, supplied with a huge-page allocator, write to them,
+        //:   release the object, and verify the regions mapped by the
+        //:   huge-page allocator.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: usable as the underlying allocator of pools
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "UNDERLYING ALLOCATOR OF POOLS" << endl
+                                  << "=============================" << endl;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::HugePagePolicy POLICY = POLICIES[ti];
+
+            if (veryVerbose) { T_ P(POLICY) }
+
+            Obj mX(POLICY);  const Obj& X = mX;
+
+            {
+                bdlma::Pool pool(64, &mX);
+                for (int i = 0; i < 100000; ++i) {
+                    bsl::memset(pool.allocate(), i, 64);
+                }
+                LOOP_ASSERT(ti, 0 < X.numRegions());
+                pool.release();
+                LOOP_ASSERT(ti, 1 >= X.numRegions());
+            }
+            {
+                bdlma::Multipool multipool(&mX);
+                for (int i = 0; i < 50000; ++i) {
+                    const int SIZE = 1 + i % 200;
+                    bsl::memset(multipool.allocate(SIZE), i, SIZE);
+                }
+                LOOP_ASSERT(ti, 0 < X.numRegions());
+                multipool.release();
+                LOOP_ASSERT(ti, 1 >= X.numRegions());
+            }
+            {
+                bdlma::SequentialAllocator sa(&mX);
+                for (int i = 0; i < 20000; ++i) {
+                    const int SIZE = 1 + i % 1000;
+                    bsl::memset(sa.allocate(SIZE), i, SIZE);
+                }
+                LOOP_ASSERT(ti, 0 < X.numRegions());
+                sa.release();
+                LOOP_ASSERT(ti, 1 >= X.numRegions());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // HUGE PAGE POLICIES
+        //
+        // Concerns:
+        //: 1 Every huge page policy yields usable memory, whether or not huge
+        //:   pages are available on the test machine.
+        //:
+        //: 2 Under 'e_TRANSPARENT' and 'e_EXPLICIT', the size of every
+        //:   mapping is a multiple of the huge page size.
+        //:
+        //: 3 Under 'e_NO_HUGE_PAGES', the size of a dedicated mapping is a
+        //:   multiple of the page size, but not necessarily of the huge page
+        //:   size.
+        //:
+        //: 4 'numHugeTlbRegions' is 0 unless the policy is 'e_EXPLICIT', and
+        //:   never exceeds 'numRegions'.
+        //
+        // Plan:
+        //: 1 For each policy, allocate blocks (both small and large) from an
+        //:   allocator, write to every byte, and verify the accessors.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   int numHugeTlbRegions() const;
+        //   CONCERN: every huge page policy yields usable memory
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "HUGE PAGE POLICIES" << endl
+                                  << "==================" << endl;
+
+        const size_type HUGE_SIZE = Obj::hugePageSize();
+        const size_type PAGE_SIZE = Obj::pageSize();
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::HugePagePolicy POLICY = POLICIES[ti];
+
+            Obj mX(POLICY);  const Obj& X = mX;
+
+            char *small = static_cast<char *>(mX.allocate(1000));
+            bsl::memset(small, 'a', 1000);
+
+            const size_type LARGE_SIZE = 3 * X.regionSize() + 100;
+            char *large = static_cast<char *>(mX.allocate(LARGE_SIZE));
+            bsl::memset(large, 'b', LARGE_SIZE);
+
+            LOOP_ASSERT(ti, 2 == X.numRegions());
+            LOOP_ASSERT(ti, X.numHugeTlbRegions() <= X.numRegions());
+            LOOP_ASSERT(ti, Obj::e_EXPLICIT == POLICY
+                                               || 0 == X.numHugeTlbRegions());
+            LOOP_ASSERT(ti, 0 == X.numBytesMapped() % PAGE_SIZE);
+            if (Obj::e_NO_HUGE_PAGES != POLICY) {
+                LOOP_ASSERT(ti, 0 == X.numBytesMapped() % HUGE_SIZE);
+            }
+            else {
+                LOOP_ASSERT(ti, X.numBytesMapped() <
+                                X.regionSize() + LARGE_SIZE + 2 * PAGE_SIZE);
+            }
+
+            if (veryVerbose) {
+                T_ P_(POLICY) P_(X.numHugeTlbRegions()) P(X.numBytesMapped())
+            }
+
+            LOOP_ASSERT(ti, 'a' == small[999]);
+            LOOP_ASSERT(ti, 'b' == large[LARGE_SIZE - 1]);
+
+            mX.deallocate(large);
+            mX.deallocate(small);
+            LOOP_ASSERT(ti, 1 == X.numRegions());
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, disjoint, writable blocks.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 Small blocks are carved from a shared region, and a new region
+        //:   is mapped when the current region is exhausted.
+        //:
+        //: 4 A region other than the current region is unmapped when its last
+        //:   block is deallocated.
+        //:
+        //: 5 The current region is retained, and reused from its start, when
+        //:   its last block is deallocated.
+        //:
+        //: 6 A block larger than a quarter of the region size is allocated
+        //:   from a dedicated region, which is unmapped when the block is
+        //:   deallocated, and the current region is unaffected.
+        //:
+        //: 7 The destructor unmaps all regions, including those having
+        //:   outstanding blocks.
+        //
+        // Plan:
+        //: 1 Using an allocator having the smallest region size, allocate
+        //:   blocks of various sizes, verify their alignment, and write to
+        //:   them.  (C-1)
+        //:
+        //: 2 Invoke 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Allocate blocks until a second region is mapped, deallocate the
+        //:   blocks of the first region, and verify 'numRegions'.  (C-3..4)
+        //:
+        //: 4 Deallocate all blocks of the current region, and verify that the
+        //:   next allocation returns the first block of the region.  (C-5)
+        //:
+        //: 5 Allocate and deallocate a large block, and verify 'numRegions'
+        //:   and 'numBytesMapped'.  (C-6)
+        //:
+        //: 6 Destroy an allocator having outstanding blocks.  (C-7)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   ~bdlma::HugePageAllocator();
+        //   size_type numBytesMapped() const;
+        //   int numRegions() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocate' AND 'deallocate'" << endl
+                                  << "===========================" << endl;
+
+        if (verbose) cout << "\nTesting alignment." << endl;
+        {
+            Obj mX(1, Obj::e_NO_HUGE_PAGES);  const Obj& X = mX;
+
+            static const int SIZES[] = { 1, 2, 3, 7, 8, 15, 16, 17, 100,
+                                         1000, 4095, 4096, 4097 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            char *addrs[NUM_SIZES];
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                addrs[i] = static_cast<char *>(mX.allocate(SIZE));
+                LOOP_ASSERT(i, 0 != addrs[i]);
+                LOOP_ASSERT(i, 0 == bsls::AlignmentUtil::
+                                    calculateAlignmentOffset(addrs[i],
+                                                             MAX_ALIGN));
+                bsl::memset(addrs[i], i, SIZE);
+            }
+            ASSERT(1 == X.numRegions());
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < SIZES[i]; ++j) {
+                    LOOP2_ASSERT(i, j, i == addrs[i][j]);
+                }
+                mX.deallocate(addrs[i]);
+            }
+            ASSERT(1 == X.numRegions());
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(1 == X.numRegions());
+        }
+
+        if (verbose) cout << "\nTesting region lifetime." << endl;
+        {
+            Obj mX(1, Obj::e_NO_HUGE_PAGES);  const Obj& X = mX;
+
+            const size_type REGION_SIZE = X.regionSize();
+            const size_type BLOCK_SIZE  = REGION_SIZE / 16;
+
+            ASSERT(0 == X.numRegions());
+            ASSERT(0 == X.numBytesMapped());
+
+            // Fill the first region.  Each block carries a header, so 16
+            // blocks do not fit in one region.
+
+            void *first[16];
+            for (int i = 0; i < 15; ++i) {
+                first[i] = mX.allocate(BLOCK_SIZE);
+            }
+            ASSERT(1           == X.numRegions());
+            ASSERT(REGION_SIZE == X.numBytesMapped());
+
+            first[15] = mX.allocate(BLOCK_SIZE);
+            ASSERT(2               == X.numRegions());
+            ASSERT(2 * REGION_SIZE == X.numBytesMapped());
+
+            // Deallocating all blocks of the first region unmaps it.
+
+            for (int i = 0; i < 15; ++i) {
+                LOOP_ASSERT(i, 2 == X.numRegions());
+                mX.deallocate(first[i]);
+            }
+            ASSERT(1           == X.numRegions());
+            ASSERT(REGION_SIZE == X.numBytesMapped());
+
+            // Deallocating the last block of the current region retains and
+            // rewinds it.
+
+            mX.deallocate(first[15]);
+            ASSERT(1 == X.numRegions());
+
+            void *addr = mX.allocate(BLOCK_SIZE);
+            ASSERT(first[15] == addr);
+            ASSERT(1 == X.numRegions());
+
+            // A large block is allocated from a dedicated region.
+
+            const size_type LARGE_SIZE = REGION_SIZE / 4 + 1;
+            void *large = mX.allocate(LARGE_SIZE);
+            ASSERT(2 == X.numRegions());
+            ASSERT(REGION_SIZE + LARGE_SIZE < X.numBytesMapped());
+
+            void *next = mX.allocate(BLOCK_SIZE);
+            ASSERT(static_cast<char *>(addr) + BLOCK_SIZE +
+                                 MAX_ALIGN == static_cast<char *>(next));
+            ASSERT(2 == X.numRegions());
+
+            mX.deallocate(large);
+            ASSERT(1           == X.numRegions());
+            ASSERT(REGION_SIZE == X.numBytesMapped());
+
+            mX.deallocate(next);
+            mX.deallocate(addr);
+            ASSERT(1 == X.numRegions());
+        }
+
+        if (verbose) cout << "\nTesting destructor." << endl;
+        {
+            Obj mX(1);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(100000);
+            }
+            ASSERT(1 < mX.numRegions());
+
+            // Outstanding regions are unmapped on destruction.
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS, CTORS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'pageSize' returns a power of 2, and 'hugePageSize' returns a
+        //:   multiple of 'pageSize'.
+        //:
+        //: 2 The policy and region size are those supplied at construction,
+        //:   or the defaults, and the region size is rounded up to a multiple
+        //:   of 'hugePageSize'.
+        //:
+        //: 3 No memory is mapped at construction.
+        //
+        // Plan:
+        //: 1 Verify the values of the class methods.  (C-1)
+        //:
+        //: 2 Construct allocators using each constructor and verify the
+        //:   accessors.  (C-2..3)
+        //
+        // Testing:
+        //   static size_type hugePageSize();
+        //   static size_type pageSize();
+        //   bdlma::HugePageAllocator(HugePagePolicy p = e_TRANSPARENT);
+        //   bdlma::HugePageAllocator(size_type r, HugePagePolicy p = ...);
+        //   HugePagePolicy policy() const;
+        //   size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS, CTORS, AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const size_type HUGE_SIZE = Obj::hugePageSize();
+        const size_type PAGE_SIZE = Obj::pageSize();
+
+        if (veryVerbose) { T_ P_(HUGE_SIZE) P(PAGE_SIZE) }
+
+        ASSERT(0 < PAGE_SIZE);
+        ASSERT(0 == (PAGE_SIZE & (PAGE_SIZE - 1)));
+        ASSERT(PAGE_SIZE <= HUGE_SIZE);
+        ASSERT(0 == HUGE_SIZE % PAGE_SIZE);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT == X.policy());
+            ASSERT(0 <  X.regionSize());
+            ASSERT(0 == X.regionSize() % HUGE_SIZE);
+            ASSERT(0 == X.numRegions());
+            ASSERT(0 == X.numBytesMapped());
+            ASSERT(0 == X.numHugeTlbRegions());
+        }
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::HugePagePolicy POLICY = POLICIES[ti];
+
+            Obj mX(POLICY);  const Obj& X = mX;
+            LOOP_ASSERT(ti, POLICY == X.policy());
+            LOOP_ASSERT(ti, 0 == X.numRegions());
+
+            Obj mY(1, POLICY);  const Obj& Y = mY;
+            LOOP_ASSERT(ti, POLICY    == Y.policy());
+            LOOP_ASSERT(ti, HUGE_SIZE == Y.regionSize());
+            LOOP_ASSERT(ti, 0         == Y.numRegions());
+
+            Obj mZ(3 * HUGE_SIZE + 1, POLICY);  const Obj& Z = mZ;
+            LOOP_ASSERT(ti, 4 * HUGE_SIZE == Z.regionSize());
+        }
+
+        {
+            Obj mX(HUGE_SIZE);  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT == X.policy());
+            ASSERT(HUGE_SIZE          == X.regionSize());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and write to blocks, and deallocate
+        //:   them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.numRegions());
+
+            char *addr1 = static_cast<char *>(mX.allocate(100));
+            char *addr2 = static_cast<char *>(mX.allocate(200));
+            ASSERT(0 != addr1);
+            ASSERT(0 != addr2);
+            ASSERT(1 == X.numRegions());
+
+            bsl::memset(addr1, 'x', 100);
+            bsl::memset(addr2, 'y', 200);
+            ASSERT(addr1 + 100 <= addr2);
+
+            mX.deallocate(addr1);
+            mX.deallocate(addr2);
+            ASSERT(1 == X.numRegions());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -358,6 +358,29 @@ void Multipool::deallocate(void *address)
     }
 }
 
+void Multipool::deallocate(void *address, int size)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(1 <= size);
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    // The pool is taken from the header, as in the unsized 'deallocate', so
+    // that a 'size' differing from the one allocated cannot return the block
+    // to the wrong pool; 'size' is only checked against the header.
+
+    const int pool = h->d_header.d_poolIdx;
+
+    BSLS_ASSERT(pool == (size <= d_maxBlockSize ? findPool(size) : -1));
+
+    if (-1 == pool) {
+        d_blockList.deallocate(h);
+    }
+    else {
+        d_pools_p[pool].deallocate(h);
+    }
+}
+
 void Multipool::release()
 {
     for (int i = 0; i < d_numPools; ++i) {
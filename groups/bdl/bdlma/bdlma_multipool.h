@@ -679,6 +679,16 @@ class Multipool {
         // 'address' is non-zero, was allocated by this multipool object, and
         // has not already been deallocated.
 
+    void deallocate(void *address, int size);
+        // Relinquish the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this multipool object for
+        // reuse.  The behavior is undefined unless 'address' is non-zero, was
+        // allocated by this multipool object by a call to 'allocate' with
+        // the same 'size', and has not already been deallocated.  Note that
+        // the pool from which 'address' was allocated is determined from the
+        // header preceding the block, and that 'size' is used only to check
+        // that the block was allocated with the same 'size'.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -57,6 +57,7 @@ using namespace bsl;
 // [ 2] ~bdlma::Multipool();
 // [ 3] void *allocate(int size);
 // [ 4] void deallocate(void *address);
+// [ 4] void deallocate(void *address, int size);
 // [ 8] template <class TYPE> void deleteObject(const TYPE *object);
 // [ 8] template <class TYPE> void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
@@ -2104,8 +2105,12 @@ int main(int argc, char *argv[])
         //   appropriate assertions that no demands are put on the memory
         //   allocation beyond those attributable to start-up.
         //
+        //   Repeat the test using sized deallocation, and verify that blocks
+        //   are returned to the pool from which they were allocated.
+        //
         // Testing:
         //   void deallocate(void *address);
+        //   void deallocate(void *address, int size);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl << "TESTING DEALLOCATE"
@@ -2168,6 +2173,39 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nTesting sized deallocation." << endl;
+
+        for (int i = 1; i <= MAX_POOLS; ++i) {
+            if (veryVerbose) { T_ cout << "# pools: "; P(i); }
+            Obj mX(i + 1, Z);
+            for (int j = 0; j <= i; ++j) {
+                const int SIZE = j < i ? POOL_QUANTA[j] : OVERFLOW_SIZE;
+
+                char *p = (char *) mX.allocate(SIZE);
+                LOOP2_ASSERT(i, j, p);
+                numBlocks = testAllocator.numBlocksTotal();
+                numBytes  = testAllocator.numBytesInUse();
+
+                int its = NITERS;
+                while (its-- > 0) {
+                    mX.deallocate(p, SIZE);
+                    char *q = (char *) mX.allocate(SIZE);
+                    LOOP2_ASSERT(i, j, j == i || p == q);
+                    p = q;
+                }
+                mX.deallocate(p, SIZE);
+
+                if (j < i) {
+                    LOOP2_ASSERT(i, j, numBlocks ==
+                                               testAllocator.numBlocksTotal());
+                }
+                else {
+                    LOOP2_ASSERT(i, j, numBytes >
+                                                testAllocator.numBytesInUse());
+                }
+            }
+        }
+
         if (verbose) cout << "\nNegative Testing." << endl;
         {
             bsls::AssertFailureHandlerGuard hG(
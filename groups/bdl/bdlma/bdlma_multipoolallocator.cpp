@@ -39,6 +39,14 @@ void MultipoolAllocator::deallocate(void *address)
     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 }
 
+void MultipoolAllocator::sizedDeallocate(void *address, size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(address != 0)) {
+        d_multipool.deallocate(address, static_cast<int>(size));
+    }
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+}
+
 void MultipoolAllocator::reserveCapacity(size_type size, size_type numObjects)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
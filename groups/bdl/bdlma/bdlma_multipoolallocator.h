@@ -779,6 +779,14 @@ class MultipoolAllocator : public ManagedAllocator {
         // The behavior is undefined unless 'address' was allocated by this
         // allocator, and has not already been deallocated.
 
+    virtual void sizedDeallocate(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to this allocator for reuse.  If
+        // 'address' is 0, this method has no effect.  The behavior is
+        // undefined unless 'address' was allocated by this allocator by a
+        // call to 'allocate' with the same 'size', and has not already been
+        // deallocated.
+
     virtual void release();
         // Release all memory currently allocated through this multipool
         // allocator.
@@ -56,6 +56,7 @@ using namespace bsl;
 // [ 6] void reserveCapacity(size_type size, size_type numObjects);
 // [ 2] void *allocate(size);
 // [ 4] void deallocate(address);
+// [ 4] void sizedDeallocate(address, size);
 // [ 5] void release();
 // [ 7] int numPools() const;
 // [ 7] int maxPooledBlockSize() const;
@@ -982,8 +983,12 @@ int main(int argc, char *argv[])
         //   Verify with appropriate assertions that no demands are put on the
         //   memory allocation beyond those attributable to start-up.
         //
+        //   Repeat the test using sized deallocation, and verify that blocks
+        //   are returned to the pool from which they were allocated.
+        //
         // Testing:
         //   void deallocate(void *address);
+        //   void sizedDeallocate(address, size);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl << "TESTING DEALLOCATE"
@@ -1043,6 +1048,39 @@ int main(int argc, char *argv[])
                 mX.deallocate(p);
             }
         }
+
+        if (verbose) cout << "\nTesting sized deallocation." << endl;
+
+        for (int i = 1; i <= MAX_POOLS; ++i) {
+            if (veryVerbose) { T_ cout << "# pools: "; P(i); }
+            Obj mX(i + 1, Z);
+            for (int j = 0; j <= i; ++j) {
+                const int SIZE = j < i ? POOL_QUANTA[j] : OVERFLOW_SIZE;
+
+                char *p = (char *) mX.allocate(SIZE);
+                LOOP2_ASSERT(i, j, p);
+                numBlocks = testAllocator.numBlocksTotal();
+                numBytes  = testAllocator.numBytesInUse();
+
+                int its = NITERS;
+                while (its-- > 0) {
+                    mX.sizedDeallocate(p, SIZE);
+                    char *q = (char *) mX.allocate(SIZE);
+                    LOOP2_ASSERT(i, j, j == i || p == q);
+                    p = q;
+                }
+                mX.sizedDeallocate(p, SIZE);
+
+                if (j < i) {
+                    LOOP2_ASSERT(i, j, numBlocks ==
+                                               testAllocator.numBlocksTotal());
+                }
+                else {
+                    LOOP2_ASSERT(i, j, numBytes >
+                                                testAllocator.numBytesInUse());
+                }
+            }
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
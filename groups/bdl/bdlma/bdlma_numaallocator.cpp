@@ -0,0 +1,514 @@
+// bdlma_numaallocator.cpp                                            -*-C++-*-
+#include <bdlma_numaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numaallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_hugepageallocator.h>
+#include <bdlma_multipool.h>
+
+#include <bslma_default.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsllock.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>  // 'CHAR_BIT'
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>  // 'strtol'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <pthread.h>
+#include <sys/syscall.h>  // 'SYS_getcpu', 'SYS_mbind'
+#include <unistd.h>       // 'syscall'
+
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+#define BDLMA_NUMAALLOCATOR_USE_SYSCALLS 1
+#endif
+#endif
+
+///Implementation Notes
+///--------------------
+// The node of the calling thread is cached in a process-wide thread-specific
+// storage key, together with a countdown of the allocations remaining before
+// the node is re-read with 'getcpu'.  Both are encoded in the pointer value
+// stored for the key (the countdown in the low 16 bits), so no memory is
+// allocated per thread.
+//
+// Chunks obtained by the multipool of a node are bound to the node as they are
+// handed out, since the regions of the underlying huge-page allocator are not
+// visible to this component.  The bound range is rounded out to page
+// boundaries; this is harmless, as every page of the huge-page allocator of a
+// node holds only memory of that node.  The policy is 'MPOL_PREFERRED' (so
+// that an exhausted node does not cause allocation failures), and
+// 'MPOL_MF_MOVE' migrates any pages of the range that were already touched.
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_REFRESH_INTERVAL = 64,  // number of allocations after which the node of
+                              // a thread is re-read from the system
+
+    k_COUNTDOWN_BITS   = 16,  // bits of the thread-specific value holding the
+                              // countdown
+
+    k_MPOL_PREFERRED   = 1,   // 'mbind' mode: prefer the given node
+
+    k_MPOL_MF_MOVE     = 2    // 'mbind' flag: migrate existing pages
+};
+
+// HELPER FUNCTIONS
+int readNumSystemNodes()
+    // Return the number of NUMA nodes of this machine as read from the
+    // operating system, or 1 if it cannot be determined.
+{
+    int numNodes = 1;
+
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+
+    // The file lists the NUMA nodes of the machine, e.g., "0-1".
+
+    FILE *file = fopen("/sys/devices/system/node/possible", "r");
+    if (file) {
+        char buffer[256];
+        if (fgets(buffer, sizeof buffer, file)) {
+            // The file holds a comma-separated list of node ids and ranges of
+            // node ids (e.g., "0-3" or "0,2-3"); the number of nodes is one
+            // more than the largest id.
+
+            const char *cursor = buffer;
+            for (;;) {
+                char *end;
+                const long id = strtol(cursor, &end, 10);
+                if (end == cursor) {
+                    break;
+                }
+                if (id + 1 > numNodes && id < INT_MAX) {
+                    numNodes = static_cast<int>(id + 1);
+                }
+                if ('-' != *end && ',' != *end) {
+                    break;
+                }
+                cursor = end + 1;
+            }
+        }
+        fclose(file);
+    }
+
+#endif
+
+    return numNodes;
+}
+
+void bindToNode(void *address, bsls::Types::size_type size, int node)
+    // Bind the pages spanned by the block of memory at the specified
+    // 'address' having the specified 'size' (in bytes) to the NUMA node
+    // having the specified 'node' index, if supported.  Failure is ignored.
+{
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+
+    typedef bsls::Types::UintPtr UintPtr;
+
+    if (node >= static_cast<int>(sizeof(unsigned long) * CHAR_BIT)) {
+        return;                                                       // RETURN
+    }
+
+    const UintPtr pageMask = bdlma::HugePageAllocator::pageSize() - 1;
+    const UintPtr first    = reinterpret_cast<UintPtr>(address);
+    const UintPtr begin    = first & ~pageMask;
+    const UintPtr end      = (first + size + pageMask) & ~pageMask;
+
+    unsigned long mask = 1UL << node;
+
+    syscall(SYS_mbind,
+            begin,
+            end - begin,
+            static_cast<int>(k_MPOL_PREFERRED),
+            &mask,
+            sizeof mask * CHAR_BIT + 1,
+            static_cast<unsigned>(k_MPOL_MF_MOVE));
+
+#else
+
+    (void)address;
+    (void)size;
+    (void)node;
+
+#endif
+}
+
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+
+pthread_once_t s_keyOnce   = PTHREAD_ONCE_INIT;
+pthread_key_t  s_nodeKey;
+bool           s_hasNodeKey = false;
+
+#endif
+
+}  // close unnamed namespace
+}  // close enterprise namespace
+
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+extern "C"
+void bdlma_NumaAllocator_createNodeKey()
+    // Create the thread-specific storage key caching the node of each thread.
+    // This function is invoked once, by 'pthread_once'.
+{
+    BloombergLP::s_hasNodeKey =
+                        0 == pthread_key_create(&BloombergLP::s_nodeKey, 0);
+}
+#endif
+
+namespace BloombergLP {
+namespace {
+
+int threadNode()
+    // Return the (possibly cached) index of the NUMA node of the processor on
+    // which the calling thread is running.
+{
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+
+    pthread_once(&s_keyOnce, &bdlma_NumaAllocator_createNodeKey);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!s_hasNodeKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bdlma::NumaAllocator::currentNode();                   // RETURN
+    }
+
+    const bsls::Types::UintPtr countdownMask =
+                                           (1 << k_COUNTDOWN_BITS) - 1;
+
+    bsls::Types::UintPtr value = reinterpret_cast<bsls::Types::UintPtr>(
+                                               pthread_getspecific(s_nodeKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == (value & countdownMask))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        value = (static_cast<bsls::Types::UintPtr>(
+                                          bdlma::NumaAllocator::currentNode())
+                                                          << k_COUNTDOWN_BITS)
+              | k_REFRESH_INTERVAL;
+    }
+    --value;
+
+    pthread_setspecific(s_nodeKey, reinterpret_cast<void *>(value));
+
+    return static_cast<int>(value >> k_COUNTDOWN_BITS);
+
+#else
+
+    return 0;
+
+#endif
+}
+
+                           // ====================
+                           // class BoundAllocator
+                           // ====================
+
+class BoundAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to supply memory
+    // mapped by a 'bdlma::HugePageAllocator' and (optionally) bound to a NUMA
+    // node.
+
+    // DATA
+    bdlma::HugePageAllocator d_regions;  // source of memory
+    int                      d_node;     // node to which memory is bound
+    bool                     d_bind;     // 'true' if memory is bound
+
+  private:
+    // NOT IMPLEMENTED
+    BoundAllocator(const BoundAllocator&);
+    BoundAllocator& operator=(const BoundAllocator&);
+
+  public:
+    // CREATORS
+    BoundAllocator(int node, bool bind)
+        // Create an allocator supplying memory that is bound to the specified
+        // 'node' if the specified 'bind' is 'true'.
+    : d_regions()
+    , d_node(node)
+    , d_bind(bind)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        void *address = d_regions.allocate(size);
+        if (d_bind && address) {
+            bindToNode(address, size, d_node);
+        }
+        return address;
+    }
+
+    virtual void deallocate(void *address)
+    {
+        d_regions.deallocate(address);
+    }
+};
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // ========================
+                          // class NumaAllocator_Node
+                          // ========================
+
+class NumaAllocator_Node {
+    // This class holds the pool of one node of a 'NumaAllocator'.
+
+  public:
+    // PUBLIC DATA
+    BoundAllocator d_upstream;  // supplies the chunks of 'd_pool'
+    bsls::BslLock  d_lock;      // guards 'd_pool'
+    Multipool      d_pool;      // pool of this node
+
+  private:
+    // NOT IMPLEMENTED
+    NumaAllocator_Node(const NumaAllocator_Node&);
+    NumaAllocator_Node& operator=(const NumaAllocator_Node&);
+
+  public:
+    // CREATORS
+    NumaAllocator_Node(int node, bool bind)
+        // Create the pool of the specified 'node', whose memory is bound to
+        // the node if the specified 'bind' is 'true'.
+    : d_upstream(node, bind)
+    , d_lock()
+    , d_pool(&d_upstream)
+    {
+    }
+};
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void NumaAllocator::init()
+{
+    BSLS_ASSERT(0 < d_numNodes);
+
+    d_nodes_p = static_cast<NumaAllocator_Node **>(
+                   d_allocator_p->allocate(d_numNodes * sizeof *d_nodes_p));
+
+    const int  systemNodes = numSystemNodes();
+    int        numCreated  = 0;
+
+    BSLS_TRY {
+        for (; numCreated < d_numNodes; ++numCreated) {
+            const bool bind = 1 < systemNodes && numCreated < systemNodes;
+
+            d_nodes_p[numCreated] = new (*d_allocator_p)
+                                          NumaAllocator_Node(numCreated, bind);
+        }
+    }
+    BSLS_CATCH(...) {
+        while (numCreated > 0) {
+            d_allocator_p->deleteObject(d_nodes_p[--numCreated]);
+        }
+        d_allocator_p->deallocate(d_nodes_p);
+        BSLS_RETHROW;
+    }
+}
+
+// CLASS METHODS
+int NumaAllocator::currentNode()
+{
+#ifdef BDLMA_NUMAALLOCATOR_USE_SYSCALLS
+
+    unsigned cpu  = 0;
+    unsigned node = 0;
+    if (0 == syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return static_cast<int>(node);                                // RETURN
+    }
+
+#endif
+
+    return 0;
+}
+
+int NumaAllocator::numSystemNodes()
+{
+    static bsls::AtomicInt numNodes(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == numNodes.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        numNodes = readNumSystemNodes();
+    }
+
+    return numNodes.loadRelaxed();
+}
+
+// CREATORS
+NumaAllocator::NumaAllocator(bslma::Allocator *basicAllocator)
+: d_nodes_p(0)
+, d_numNodes(numSystemNodes())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+NumaAllocator::NumaAllocator(int numNodes, bslma::Allocator *basicAllocator)
+: d_nodes_p(0)
+, d_numNodes(numNodes)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numNodes);
+
+    init();
+}
+
+NumaAllocator::~NumaAllocator()
+{
+    for (int i = 0; i < d_numNodes; ++i) {
+        d_allocator_p->deleteObject(d_nodes_p[i]);
+    }
+    d_allocator_p->deallocate(d_nodes_p);
+}
+
+// MANIPULATORS
+void *NumaAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    int node = threadNode();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(node >= d_numNodes)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        node %= d_numNodes;
+    }
+
+    return allocateOnNode(node, size);
+}
+
+void *NumaAllocator::allocateOnNode(int node, size_type size)
+{
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(node < d_numNodes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_ASSERT(size <= ~static_cast<size_type>(0) - sizeof(Header));
+
+    NumaAllocator_Node *imp       = d_nodes_p[node];
+    const size_type     blockSize = size + sizeof(Header);
+
+    Header *header;
+    bool    isPooled;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                          blockSize > static_cast<size_type>(
+                                          imp->d_pool.maxPooledBlockSize()))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The block is too large to be pooled; obtain it, with its full size,
+        // directly from the (thread-safe) upstream allocator of the node.
+
+        header = static_cast<Header *>(imp->d_upstream.allocate(blockSize));
+        if (!header) {
+            return 0;                                                 // RETURN
+        }
+        isPooled = false;
+    }
+    else {
+        bsls::BslLockGuard guard(&imp->d_lock);
+
+        header = static_cast<Header *>(imp->d_pool.allocate(
+                                               static_cast<int>(blockSize)));
+        isPooled = true;
+    }
+    header->d_info.d_node     = node;
+    header->d_info.d_isPooled = isPooled;
+
+    return header + 1;
+}
+
+void NumaAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    BSLS_ASSERT(0 <= header->d_info.d_node);
+    BSLS_ASSERT(header->d_info.d_node < d_numNodes);
+
+    NumaAllocator_Node *imp = d_nodes_p[header->d_info.d_node];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header->d_info.d_isPooled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        imp->d_upstream.deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    bsls::BslLockGuard guard(&imp->d_lock);
+
+    imp->d_pool.deallocate(header);
+}
+
+void NumaAllocator::sizedDeallocate(void *address, size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    BSLS_ASSERT(0 <= header->d_info.d_node);
+    BSLS_ASSERT(header->d_info.d_node < d_numNodes);
+
+    NumaAllocator_Node *imp = d_nodes_p[header->d_info.d_node];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header->d_info.d_isPooled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        imp->d_upstream.deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    bsls::BslLockGuard guard(&imp->d_lock);
+
+    BSLS_ASSERT(size + sizeof(Header) <= static_cast<size_type>(
+                                           imp->d_pool.maxPooledBlockSize()));
+
+    imp->d_pool.deallocate(header, static_cast<int>(size + sizeof(Header)));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,318 @@
+// bdlma_numaallocator.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMAALLOCATOR
+#define INCLUDED_BDLMA_NUMAALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that supplies memory local to a NUMA node.
+//
+//@CLASSES:
+//  bdlma::NumaAllocator: thread-safe allocator with per-NUMA-node pools
+//
+//@SEE_ALSO: bdlma_hugepageallocator, bdlma_multipool
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::NumaAllocator', that implements the 'bslma::Allocator' protocol and
+// maintains a separate pool of memory for each NUMA node (i.e., each socket,
+// with its locally attached memory) of the machine.  Each call to 'allocate'
+// is served from the pool of the node on which the calling thread is running,
+// so that memory is local to the thread that allocates it:
+//..
+//   ,--------------------.
+//  ( bdlma::NumaAllocator )
+//   `--------------------'
+//               |         ctor/dtor
+//               |         allocateOnNode
+//               |         currentNode
+//               |         nodeOf
+//               |         numNodes
+//               |         numSystemNodes
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//                         sizedDeallocate
+//..
+// The pool of each node is a 'bdlma::Multipool' whose chunks are obtained from
+// a 'bdlma::HugePageAllocator' (using its default huge page policy), and whose
+// memory is bound to the node (on Linux, using the 'mbind' system call, with
+// a *preferred* policy, so that memory is taken from another node rather than
+// failing when the node is exhausted).  A block may be deallocated from any
+// thread; it is returned to the pool of the node from which it was allocated.
+// Note that each block carries a header that identifies its node, in addition
+// to the header that 'bdlma::Multipool' maintains.  Blocks larger than the
+// largest block size pooled by the multipool are mapped directly from the
+// memory regions of the node (bypassing the multipool, and its 'int' block
+// sizes), and are returned to the system when they are deallocated.
+//
+///Node Discovery and Graceful Degradation
+///---------------------------------------
+// The number of NUMA nodes of the machine is obtained from the operating
+// system, and the node of the calling thread is obtained from the 'getcpu'
+// system call; no NUMA support library is required.  On platforms, or
+// machines, without NUMA support, the machine is treated as having a single
+// node, and the allocator behaves as a thread-safe multipool allocator.
+//
+// The number of pools may also be supplied at construction.  If it differs
+// from the number of nodes of the machine, allocations from a thread running
+// on node 'n' are served from pool 'n % numNodes()', and the memory of pools
+// that do not correspond to a node of the machine is not bound.  This allows
+// the routing of allocations to be tested on machines having a single node.
+//
+// Since a thread may be migrated between nodes by the scheduler, the node of
+// a thread is re-read from the system periodically (every few dozen
+// allocations), rather than on every allocation.  'allocateOnNode' may be
+// used to allocate from a specific node without consulting the system.
+//
+///Thread Safety
+///-------------
+// 'bdlma::NumaAllocator' is *fully thread-safe*, meaning that any operation on
+// the same object can be safely invoked from any thread.  Allocations from
+// different nodes do not contend with each other.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Node-Local Memory for Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server runs a set of worker threads on each socket of a
+// multi-socket machine, and that each worker builds data structures that it
+// alone traverses.  We can ensure that the memory of those structures is local
+// to the socket of the worker by supplying a single 'bdlma::NumaAllocator' to
+// all workers.
+//
+// First, we create the allocator, which has one pool for each node of the
+// machine:
+//..
+//  bdlma::NumaAllocator numaAllocator;
+//  assert(bdlma::NumaAllocator::numSystemNodes() == numaAllocator.numNodes());
+//..
+// Then, in the body of a worker, we create a container that uses the
+// allocator; its elements are allocated from the pool of the worker's node:
+//..
+//  bsl::vector<int> values(&numaAllocator);
+//  for (int i = 0; i < 1000; ++i) {
+//      values.push_back(i);
+//  }
+//..
+// Now, we verify that the memory of the container came from the pool of the
+// node on which the worker is running (assuming, as is typical, that the
+// worker was not migrated to a different node in the meantime):
+//..
+//  const int node = bdlma::NumaAllocator::currentNode()
+//                                                  % numaAllocator.numNodes();
+//  assert(node == numaAllocator.nodeOf(&values[0]));
+//..
+// Finally, we observe that memory for a particular node can also be requested
+// explicitly, for example when a thread prepares data for a worker on another
+// socket:
+//..
+//  const int   lastNode = numaAllocator.numNodes() - 1;
+//  void       *buffer   = numaAllocator.allocateOnNode(lastNode, 4096);
+//  assert(lastNode == numaAllocator.nodeOf(buffer));
+//
+//  numaAllocator.deallocate(buffer);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+class NumaAllocator_Node;
+
+                            // ===================
+                            // class NumaAllocator
+                            // ===================
+
+class NumaAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, and supplies memory from a
+    // separate pool for each NUMA node, choosing the pool of the node on which
+    // the calling thread is running.
+
+    // PRIVATE TYPES
+    struct BlockInfo {
+        // This 'struct' identifies the origin of a block.
+
+        int  d_node;      // index of the node
+        bool d_isPooled;  // 'true' if the block is from the pool of the node,
+                          // and 'false' if it is from its upstream allocator
+    };
+
+    union Header {
+        // This 'union' precedes each block returned by 'allocate', and
+        // identifies the node (and the pool) from which the block was
+        // allocated.
+
+        BlockInfo                           d_info;   // origin of the block
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;  // force alignment
+    };
+
+    // DATA
+    NumaAllocator_Node **d_nodes_p;      // array of 'd_numNodes' nodes
+
+    int                  d_numNodes;     // number of nodes (and pools)
+
+    bslma::Allocator    *d_allocator_p;  // allocator for 'd_nodes_p' (held,
+                                         // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    NumaAllocator(const NumaAllocator&);
+    NumaAllocator& operator=(const NumaAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void init();
+        // Create the 'd_numNodes' nodes of this allocator.
+
+  public:
+    // CLASS METHODS
+    static int currentNode();
+        // Return the index of the NUMA node of the processor on which the
+        // calling thread is running, or 0 if it cannot be determined.  Note
+        // that this method makes a system call; the returned value may be
+        // stale by the time it is used if the thread is migrated.
+
+    static int numSystemNodes();
+        // Return the number of NUMA nodes of this machine, or 1 if NUMA is not
+        // supported.
+
+    // CREATORS
+    explicit
+    NumaAllocator(bslma::Allocator *basicAllocator = 0);
+        // Create a NUMA allocator having one pool for each of the
+        // 'numSystemNodes()' nodes of this machine.  Optionally specify a
+        // 'basicAllocator' used to supply memory for the bookkeeping of this
+        // allocator (but not for the pools, which map their memory directly).
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+
+    explicit
+    NumaAllocator(int numNodes, bslma::Allocator *basicAllocator = 0);
+        // Create a NUMA allocator having the specified 'numNodes' pools,
+        // where pool 'n' holds memory bound to node 'n' if the machine has
+        // such a node.  Optionally specify a 'basicAllocator' used to supply
+        // memory for the bookkeeping of this allocator (but not for the
+        // pools).  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < numNodes'.
+
+    virtual ~NumaAllocator();
+        // Destroy this allocator, and return all of the memory of its pools
+        // to the system, regardless of whether blocks allocated from it remain
+        // outstanding.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes) from the pool of the node on which the
+        // calling thread is running.  If 'size' is 0, no memory is allocated
+        // and 0 is returned.  Note that blocks too large for the pool are
+        // obtained directly from the memory regions of the node, and are
+        // returned to the system when they are deallocated.
+
+    void *allocateOnNode(int node, size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes) from the pool of the specified 'node'.
+        // If 'size' is 0, no memory is allocated and 0 is returned.  The
+        // behavior is undefined unless '0 <= node < numNodes()'.  Note that
+        // blocks too large for the pool are obtained directly from the memory
+        // regions of the node, and are returned to the system when they are
+        // deallocated.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the pool of
+        // the node from which it was allocated.  If 'address' is 0, this
+        // method has no effect.  The behavior is undefined unless 'address'
+        // was returned by this allocator and has not already been
+        // deallocated.
+
+    virtual void sizedDeallocate(void *address, size_type size);
+        // Return the memory block at the specified 'address', allocated with
+        // the specified 'size' (in bytes), to the pool of the node from which
+        // it was allocated.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was returned by this
+        // allocator for a request of 'size' bytes and has not already been
+        // deallocated.
+
+    // ACCESSORS
+    int nodeOf(const void *address) const;
+        // Return the index of the node from whose pool the block at the
+        // specified 'address' was allocated.  The behavior is undefined unless
+        // 'address' was returned by this allocator and has not been
+        // deallocated.
+
+    int numNodes() const;
+        // Return the number of nodes (and pools) of this allocator.
+};
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// ACCESSORS
+inline
+int NumaAllocator::nodeOf(const void *address) const
+{
+    BSLS_ASSERT_SAFE(address);
+
+    return (static_cast<const Header *>(address) - 1)->d_info.d_node;
+}
+
+inline
+int NumaAllocator::numNodes() const
+{
+    return d_numNodes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
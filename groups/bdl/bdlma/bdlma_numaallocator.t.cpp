@@ -0,0 +1,752 @@
+// bdlma_numaallocator.t.cpp                                          -*-C++-*-
+#include <bdlma_numaallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// A 'bdlma::NumaAllocator' routes each allocation to the pool of a NUMA node,
+// and records the node in a header preceding the block.  The primary concerns
+// are that the blocks are usable and aligned, that each block is returned to
+// the pool from which it was allocated, that allocations are routed to the
+// node of the calling thread (modulo the number of pools), and that the
+// allocator degrades gracefully on machines without NUMA support.  Since the
+// topology of the test machine is not known in advance, the tests supply the
+// number of pools explicitly, so that routing to several pools is exercised
+// even on a machine having a single node.
+//-----------------------------------------------------------------------------
+// // CLASS METHODS
+// [ 2] static int currentNode();
+// [ 2] static int numSystemNodes();
+//
+// // CREATORS
+// [ 2] bdlma::NumaAllocator(bslma::Allocator *ba = 0);
+// [ 2] bdlma::NumaAllocator(int numNodes, bslma::Allocator *ba = 0);
+// [ 2] ~bdlma::NumaAllocator();
+//
+// // MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 4] void *allocateOnNode(int node, size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void sizedDeallocate(void *address, size_type size);
+//
+// // ACCESSORS
+// [ 3] int nodeOf(const void *address) const;
+// [ 2] int numNodes() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: usable as the allocator of containers
+// [ 6] CONCERN: blocks larger than the largest pooled size
+// [ 7] USAGE EXAMPLE
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::NumaAllocator Obj;
+
+typedef bslma::Allocator::size_type size_type;
+
+enum { MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+static const int SIZES[] = {
+    1, 2, 3, 7, 8, 15, 16, 31, 33, 64, 100, 255, 1000, 4096, 10000, 100000
+};
+const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+enum { MAX_POOLED_SIZE = 1000 };
+    // blocks of at most this size are pooled by the pools of the allocator,
+    // and so are reused immediately after they are deallocated
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Neither the default nor the global allocator should be used.
+
+    bslma::TestAllocator defaultAllocator("Default Allocator",
+                                          veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("Global Allocator",
+                                         veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("bookkeeping", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard usageGuard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Node-Local Memory for Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server runs a set of worker threads on each socket of a
+// multi-socket machine, and that each worker builds data structures that it
+// alone traverses.  We can ensure that the memory of those structures is local
+// to the socket of the worker by supplying a single 'bdlma::NumaAllocator' to
+// all workers.
+//
+// First, we create the allocator, which has one pool for each node of the
+// machine:
+//..
+    bdlma::NumaAllocator numaAllocator;
+    ASSERT(bdlma::NumaAllocator::numSystemNodes() == numaAllocator.numNodes());
+//..
+// Then, in the body of a worker, we create a container that uses the
+// allocator; its elements are allocated from the pool of the worker's node:
+//..
+    bsl::vector<int> values(&numaAllocator);
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+//..
+// Now, we verify that the memory of the container came from the pool of the
+// node on which the worker is running (assuming, as is typical, that the
+// worker was not migrated to a different node in the meantime):
+//..
+    const int node = bdlma::NumaAllocator::currentNode()
+                                                    % numaAllocator.numNodes();
+    ASSERT(node == numaAllocator.nodeOf(&values[0]));
+//..
+// Finally, we observe that memory for a particular node can also be requested
+// explicitly, for example when a thread prepares data for a worker on another
+// socket:
+//..
+    const int   lastNode = numaAllocator.numNodes() - 1;
+    void       *buffer   = numaAllocator.allocateOnNode(lastNode, 4096);
+    ASSERT(lastNode == numaAllocator.nodeOf(buffer));
+
+    numaAllocator.deallocate(buffer);
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BLOCKS LARGER THAN THE LARGEST POOLED SIZE
+        //
+        // Concerns:
+        //: 1 A block larger than the largest size pooled by the multipool of a
+        //:   node, including (on 64-bit platforms) a block larger than
+        //:   'INT_MAX' bytes, is allocated with its full size, and is
+        //:   writable at both ends.
+        //:
+        //: 2 Such a block records the node on which it was requested.
+        //:
+        //: 3 Such a block can be deallocated with and without its size, and
+        //:   its memory is returned to the system.
+        //
+        // Plan:
+        //: 1 For each of several large sizes, allocate a block on each node,
+        //:   write its first and last bytes, and verify its alignment and
+        //:   node.  (C-1..2)
+        //:
+        //: 2 Deallocate the blocks, alternating between 'deallocate' and
+        //:   'sizedDeallocate', and repeat the allocations many times, which
+        //:   would exhaust the address space if the memory were not returned.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: blocks larger than the largest pooled size
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "BLOCKS LARGER THAN THE LARGEST POOLED SIZE" << endl
+                      << "==========================================" << endl;
+
+        const size_type LARGE_SIZES[] = {
+            1 << 16,
+            1 << 20,
+            1 << 24,
+            static_cast<size_type>(INT_MAX) + 4096
+        };
+        const int NUM_LARGE_SIZES = sizeof LARGE_SIZES / sizeof *LARGE_SIZES;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        enum { k_NUM_NODES = 2 };
+
+        Obj mX(k_NUM_NODES, &ta);  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_LARGE_SIZES; ++ti) {
+            const size_type SIZE = LARGE_SIZES[ti];
+
+            if (SIZE <= static_cast<size_type>(INT_MAX)
+             || sizeof(size_type) > sizeof(int)) {
+                for (int i = 0; i < 100; ++i) {
+                    const int NODE = i % k_NUM_NODES;
+
+                    char *block = static_cast<char *>(
+                                                mX.allocateOnNode(NODE, SIZE));
+                    LOOP2_ASSERT(ti, i, 0 != block);
+                    if (!block) {
+                        break;
+                    }
+
+                    const int OFFSET = bsls::AlignmentUtil::
+                                 calculateAlignmentOffset(block, MAX_ALIGN);
+                    LOOP2_ASSERT(ti, i, 0 == OFFSET);
+                    LOOP2_ASSERT(ti, i, NODE == X.nodeOf(block));
+
+                    block[0]        = 'a';
+                    block[SIZE - 1] = 'z';
+                    LOOP2_ASSERT(ti, i, 'a' == block[0]);
+                    LOOP2_ASSERT(ti, i, 'z' == block[SIZE - 1]);
+
+                    if (i % 2) {
+                        mX.deallocate(block);
+                    }
+                    else {
+                        mX.sizedDeallocate(block, SIZE);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ALLOCATOR OF CONTAINERS
+        //
+        // Concerns:
+        //: 1 A NUMA allocator can supply the memory of standard containers,
+        //:   which deallocate with and without the size of the block.
+        //:
+        //: 2 The memory of the containers is not supplied by the bookkeeping
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For several numbers of pools, grow and shrink a 'bsl::vector' and
+        //:   a 'bsl::vector<bsl::string>' using the allocator, verify their
+        //:   contents, and verify that the number of blocks of the bookkeeping
+        //:   allocator does not change.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: usable as the allocator of containers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "ALLOCATOR OF CONTAINERS" << endl
+                                  << "=======================" << endl;
+
+        for (int numNodes = 1; numNodes <= 4; ++numNodes) {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(numNodes, &ta);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+            {
+                bsl::vector<int> mV(&mX);  const bsl::vector<int>& V = mV;
+                for (int i = 0; i < 10000; ++i) {
+                    mV.push_back(i);
+                }
+                LOOP_ASSERT(numNodes, 10000 == V.size());
+                LOOP_ASSERT(numNodes, 9999  == V.back());
+
+                bsl::vector<bsl::string>        mS(&mX);
+                const bsl::vector<bsl::string>& S = mS;
+                for (int i = 0; i < 1000; ++i) {
+                    mS.push_back(bsl::string(i % 100, 'a' + i % 26, &mX));
+                }
+                for (int i = 0; i < 500; ++i) {
+                    mS.pop_back();
+                }
+                mS.shrink_to_fit();
+                LOOP_ASSERT(numNodes, 500 == S.size());
+                LOOP_ASSERT(numNodes, 99 == S[499].size());
+                LOOP_ASSERT(numNodes, 'a' + 499 % 26 == S[499][98]);
+            }
+
+            if (veryVerbose) { T_ P_(numNodes) P(ta.numBlocksTotal()) }
+
+            LOOP_ASSERT(numNodes, NUM_BLOCKS == ta.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'allocateOnNode'
+        //
+        // Concerns:
+        //: 1 'allocateOnNode' supplies a block from the pool of the specified
+        //:   node, whether or not the machine has such a node.
+        //:
+        //: 2 A block may be deallocated by means of 'deallocate' or
+        //:   'sizedDeallocate' irrespective of its node, and the memory of a
+        //:   pooled block is reused by the pool of that node.
+        //:
+        //: 3 'allocateOnNode' with a size of 0 returns 0.
+        //:
+        //: 4 'allocate' routes to pool 'currentNode() % numNodes()'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using an allocator having more pools than the machine has nodes,
+        //:   allocate blocks of various sizes from each pool, write to them,
+        //:   verify 'nodeOf', deallocate them, and verify that allocating
+        //:   pooled blocks of the same sizes from the same pool reuses the
+        //:   memory.
+        //:   (C-1..3)
+        //:
+        //: 2 Allocate with 'allocate' and verify the node of the block.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid node indices.  (C-5)
+        //
+        // Testing:
+        //   void *allocateOnNode(int node, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'allocateOnNode'" << endl
+                                  << "================" << endl;
+
+        const int NUM_NODES = Obj::numSystemNodes() + 3;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        Obj mX(NUM_NODES, &ta);  const Obj& X = mX;
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                char *p = static_cast<char *>(mX.allocateOnNode(node, SIZE));
+                LOOP2_ASSERT(node, ti, 0 != p);
+                LOOP2_ASSERT(node, ti, node == X.nodeOf(p));
+                bsl::memset(p, node, SIZE);
+
+                if (ti % 2) {
+                    mX.deallocate(p);
+                }
+                else {
+                    mX.sizedDeallocate(p, SIZE);
+                }
+
+                char *q = static_cast<char *>(mX.allocateOnNode(node, SIZE));
+                LOOP2_ASSERT(node, ti, SIZE > MAX_POOLED_SIZE || p == q);
+                LOOP2_ASSERT(node, ti, node == X.nodeOf(q));
+                mX.deallocate(q);
+            }
+            LOOP_ASSERT(node, 0 == mX.allocateOnNode(node, 0));
+        }
+
+        {
+            const int NODE = Obj::currentNode() % NUM_NODES;
+
+            void *p = mX.allocate(100);
+            if (veryVerbose) { T_ P_(NODE) P(X.nodeOf(p)) }
+
+            // The calling thread may have been migrated, so the check is
+            // meaningful only on a machine having a single node.
+
+            if (1 == Obj::numSystemNodes()) {
+                ASSERT(NODE == X.nodeOf(p));
+            }
+            mX.deallocate(p);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                         bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(mX.deallocate(mX.allocateOnNode(0, 8)));
+            ASSERT_PASS(mX.deallocate(mX.allocateOnNode(NUM_NODES - 1, 8)));
+            ASSERT_FAIL(mX.allocateOnNode(-1, 8));
+            ASSERT_FAIL(mX.allocateOnNode(NUM_NODES, 8));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate', 'deallocate', AND 'sizedDeallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, disjoint, writable blocks.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' and
+        //:   'sizedDeallocate(0, n)' have no effect.
+        //:
+        //: 3 'nodeOf' returns a node in the range '[0 .. numNodes())'.
+        //:
+        //: 4 The memory of a deallocated pooled block is reused by a
+        //:   subsequent allocation.
+        //:
+        //: 5 Neither the bookkeeping allocator nor the default allocator
+        //:   supplies the memory of the blocks.
+        //
+        // Plan:
+        //: 1 For several numbers of pools, allocate blocks of various sizes,
+        //:   verify their alignment and node, fill them with distinct values,
+        //:   and verify that the values are intact after all blocks have been
+        //:   written.  (C-1, 3)
+        //:
+        //: 2 Deallocate each block (alternating between 'deallocate' and
+        //:   'sizedDeallocate') and reallocate it, verifying that the memory
+        //:   of pooled blocks is reused.  (C-4)
+        //:
+        //: 3 Verify the behavior for a size of 0, and a null address.  (C-2)
+        //:
+        //: 4 Verify the number of blocks of the bookkeeping and default
+        //:   allocators.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void sizedDeallocate(void *address, size_type size);
+        //   int nodeOf(const void *address) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "'allocate', 'deallocate', AND 'sizedDeallocate'" << endl
+                 << "===============================================" << endl;
+
+        for (int numNodes = 1; numNodes <= 3; ++numNodes) {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(numNodes, &ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+            char *blocks[NUM_SIZES];
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                blocks[ti] = static_cast<char *>(mX.allocate(SIZE));
+                LOOP2_ASSERT(numNodes, ti, 0 != blocks[ti]);
+                const int OFFSET = bsls::AlignmentUtil::
+                          calculateAlignmentOffset(blocks[ti], MAX_ALIGN);
+                LOOP2_ASSERT(numNodes, ti, 0 == OFFSET);
+                LOOP2_ASSERT(numNodes, ti, 0 <= X.nodeOf(blocks[ti]));
+                LOOP2_ASSERT(numNodes, ti, numNodes > X.nodeOf(blocks[ti]));
+                bsl::memset(blocks[ti], ti, SIZE);
+            }
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                LOOP2_ASSERT(numNodes, ti, ti == blocks[ti][0]);
+                LOOP2_ASSERT(numNodes, ti, ti == blocks[ti][SIZE - 1]);
+            }
+
+            // A pooled block that is deallocated is reused by the next
+            // allocation of the same size from the pool of its node.
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int SIZE = SIZES[ti];
+                const int NODE = X.nodeOf(blocks[ti]);
+
+                if (ti % 2) {
+                    mX.deallocate(blocks[ti]);
+                }
+                else {
+                    mX.sizedDeallocate(blocks[ti], SIZE);
+                }
+
+                void *p = mX.allocateOnNode(NODE, SIZE);
+                LOOP2_ASSERT(numNodes, ti,
+                             SIZE > MAX_POOLED_SIZE || blocks[ti] == p);
+
+                if (ti % 2) {
+                    mX.sizedDeallocate(p, SIZE);
+                }
+                else {
+                    mX.deallocate(p);
+                }
+            }
+
+            LOOP_ASSERT(numNodes, 0 == mX.allocate(0));
+            mX.deallocate(0);
+            mX.sizedDeallocate(0, 100);
+
+            if (veryVerbose) { T_ P_(numNodes) P(ta.numBlocksTotal()) }
+
+            LOOP_ASSERT(numNodes, NUM_BLOCKS == ta.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS AND CREATORS
+        //
+        // Concerns:
+        //: 1 'numSystemNodes' returns a positive value, and 'currentNode'
+        //:   returns a value in the range '[0 .. numSystemNodes())'.
+        //:
+        //: 2 The default constructor creates one pool for each node of the
+        //:   machine, and the value constructor creates the specified number
+        //:   of pools.
+        //:
+        //: 3 The bookkeeping of the allocator is supplied by the specified
+        //:   allocator, or by the default allocator if none is specified, and
+        //:   all of it is returned on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the values returned by the class methods.  (C-1)
+        //:
+        //: 2 Create allocators using each constructor, with and without a
+        //:   bookkeeping allocator, and verify 'numNodes' and the use of the
+        //:   bookkeeping and default allocators.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an invalid number of nodes.  (C-4)
+        //
+        // Testing:
+        //   static int currentNode();
+        //   static int numSystemNodes();
+        //   bdlma::NumaAllocator(bslma::Allocator *ba = 0);
+        //   bdlma::NumaAllocator(int numNodes, bslma::Allocator *ba = 0);
+        //   ~bdlma::NumaAllocator();
+        //   int numNodes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CLASS METHODS AND CREATORS" << endl
+                                  << "==========================" << endl;
+
+        const int SYSTEM_NODES = Obj::numSystemNodes();
+        const int CURRENT_NODE = Obj::currentNode();
+
+        if (veryVerbose) { T_ P_(SYSTEM_NODES) P(CURRENT_NODE) }
+
+        ASSERT(0 < SYSTEM_NODES);
+        ASSERT(0 <= CURRENT_NODE);
+        ASSERT(CURRENT_NODE < SYSTEM_NODES);
+        ASSERT(SYSTEM_NODES == Obj::numSystemNodes());
+
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+                ASSERT(SYSTEM_NODES == X.numNodes());
+                ASSERT(0 < ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(SYSTEM_NODES == X.numNodes());
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        for (int numNodes = 1; numNodes <= 8; ++numNodes) {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+            {
+                Obj mX(numNodes, &ta);  const Obj& X = mX;
+                LOOP_ASSERT(numNodes, numNodes == X.numNodes());
+            }
+            LOOP_ASSERT(numNodes, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                         bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_FAIL(Obj(-1, &ta));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and write to blocks, and deallocate
+        //:   them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            ASSERT(2 == X.numNodes());
+
+            char *addr1 = static_cast<char *>(mX.allocate(100));
+            char *addr2 = static_cast<char *>(mX.allocateOnNode(1, 200));
+            ASSERT(0 != addr1);
+            ASSERT(0 != addr2);
+            ASSERT(1 == X.nodeOf(addr2));
+
+            bsl::memset(addr1, 'x', 100);
+            bsl::memset(addr2, 'y', 200);
+            ASSERT('x' == addr1[99]);
+            ASSERT('y' == addr2[199]);
+
+            mX.deallocate(addr1);
+            mX.sizedDeallocate(addr2, 200);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
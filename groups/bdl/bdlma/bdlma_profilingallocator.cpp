@@ -0,0 +1,966 @@
+// bdlma_profilingallocator.cpp                                       -*-C++-*-
+#include <bdlma_profilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_profilingallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_bsllock.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>  // 'free'
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+#include <execinfo.h>     // 'backtrace', 'backtrace_symbols'
+#define BDLMA_PROFILINGALLOCATOR_USE_BACKTRACE 1
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLMA_PROFILINGALLOCATOR_NOINLINE __attribute__((noinline))
+#else
+#define BDLMA_PROFILINGALLOCATOR_NOINLINE
+#endif
+
+///Implementation Notes
+///--------------------
+// The sizes, lifetimes, and deallocated bytes are recorded in a *thread
+// profile* belonging to the calling thread, located through a thread-specific
+// storage key of the allocator and created on the thread's first request.
+// Only its own thread writes to a thread profile, so the histograms are
+// 'bsls::LocalLatencyHistogram' objects and the counter of deallocated bytes
+// is updated with a relaxed load and store, so that the common path performs
+// no atomic read-modify-write operation.  The accessors merge the thread
+// profiles, which are linked in a registry guarded by a lock.  The number of
+// bytes in use is the sum of the sizes recorded less the sum of the bytes
+// deallocated, over all thread profiles.
+//
+// A thread profile outlives its thread, since its counts remain part of the
+// profile.  On POSIX platforms, the destructor registered with the key places
+// the profile of an exiting thread on a free list, from which it is reused by
+// the next thread to make its first request, so that the number of thread
+// profiles does not exceed the greatest number of threads using the allocator
+// at once.  On Windows, thread-local storage indices do not provide such a
+// notification, and the profiles of exited threads are not reused.  If no
+// key is available, all threads record into a single shared thread profile
+// under a lock.
+//
+// Each thread profile counts down the allocations to its next sample, the
+// count being drawn uniformly from '[1, 2 * period - 1]' (of mean 'period')
+// by a generator private to the thread profile, so that no state is shared
+// between threads to decide which allocations to sample, and allocations
+// made at regular intervals are not systematically missed.
+//
+// The call sites are held in an array, in the order in which they were first
+// sampled, and are located by the hash of their frames in an open-addressing
+// table of indices into that array, which is never more than half full.  The
+// index of the call site of a sampled block is stored in its header, so that
+// the bytes in use of the call site can be decreased when it is deallocated.
+
+extern "C"
+void bdlma_ProfilingAllocator_threadExit(void *threadProfile);
+    // Retire the specified 'threadProfile' for reuse by another thread.  This
+    // function is invoked by the operating system when a thread having a
+    // non-null value for the thread-specific storage key of a
+    // 'ProfilingAllocator' exits.
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+typedef ProfilingAllocator::CallSite CallSite;
+
+enum {
+    k_NUM_SKIPPED_FRAMES = 2,   // frames of 'captureCallStack' and 'allocate'
+
+    k_TABLE_SIZE         = 2 * ProfilingAllocator::k_MAX_CALL_SITES
+                                // slots of the table of call sites (a power
+                                // of two)
+};
+
+const bsls::Types::Uint64 k_HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+    // odd constant close to '2^64' divided by the golden ratio
+
+BDLMA_PROFILINGALLOCATOR_NOINLINE
+int captureCallStack(void **frames)
+    // Load into the specified 'frames' the return addresses of the call stack
+    // of the caller of the caller of this function, innermost first, and
+    // return the number of addresses loaded, which is at most
+    // 'CallSite::k_MAX_FRAMES'.
+{
+#ifdef BDLMA_PROFILINGALLOCATOR_USE_BACKTRACE
+    void *buffer[k_NUM_SKIPPED_FRAMES + CallSite::k_MAX_FRAMES];
+
+    const int numFrames = backtrace(buffer, sizeof buffer / sizeof *buffer)
+                        - k_NUM_SKIPPED_FRAMES;
+    if (numFrames <= 0) {
+        return 0;                                                     // RETURN
+    }
+    bsl::memcpy(frames,
+                buffer + k_NUM_SKIPPED_FRAMES,
+                numFrames * sizeof *frames);
+    return numFrames;
+#else
+    (void)frames;
+    return 0;
+#endif
+}
+
+bsls::Types::Uint64 hashCallStack(void * const *frames, int numFrames)
+    // Return a hash of the specified 'numFrames' return addresses at the
+    // specified 'frames'.
+{
+    bsls::Types::Uint64 hash = numFrames;
+    for (int i = 0; i < numFrames; ++i) {
+        hash = (hash ^ reinterpret_cast<bsls::Types::UintPtr>(frames[i]))
+             * k_HASH_MULTIPLIER;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+bool isMoreFrequent(const CallSite& lhs, const CallSite& rhs)
+    // Return 'true' if the specified 'lhs' call site has more sampled
+    // allocations than the specified 'rhs' call site, or as many allocations
+    // and more bytes, and 'false' otherwise.
+{
+    return lhs.d_numAllocations != rhs.d_numAllocations
+           ? lhs.d_numAllocations > rhs.d_numAllocations
+           : lhs.d_numBytes > rhs.d_numBytes;
+}
+
+void printHistogram(bsl::ostream&                         stream,
+                    const bsls::LatencyHistogramSnapshot& histogram)
+    // Write a one-line summary of the specified 'histogram' to the specified
+    // 'stream'.
+{
+    if (0 == histogram.count()) {
+        stream << "none\n";
+        return;                                                       // RETURN
+    }
+    stream << "min "   << histogram.min()
+           << ", p50 " << histogram.valueAtPercentile(50.0)
+           << ", p90 " << histogram.valueAtPercentile(90.0)
+           << ", p99 " << histogram.valueAtPercentile(99.0)
+           << ", max " << histogram.max() << "\n";
+}
+
+void printFrames(bsl::ostream& stream, const CallSite& callSite)
+    // Write the frames of the specified 'callSite' to the specified 'stream',
+    // one per line, symbolized if possible.
+{
+    char **symbols = 0;
+
+#ifdef BDLMA_PROFILINGALLOCATOR_USE_BACKTRACE
+    if (0 < callSite.d_numFrames) {
+        symbols = backtrace_symbols(callSite.d_frames, callSite.d_numFrames);
+    }
+#endif
+
+    for (int i = 0; i < callSite.d_numFrames; ++i) {
+        stream << "    ";
+        if (symbols) {
+            stream << symbols[i];
+        }
+        else {
+            stream << callSite.d_frames[i];
+        }
+        stream << "\n";
+    }
+
+    bsl::free(symbols);
+}
+
+}  // close unnamed namespace
+
+class ProfilingAllocator_Profile;
+
+                   // ======================================
+                   // class ProfilingAllocator_ThreadProfile
+                   // ======================================
+
+class ProfilingAllocator_ThreadProfile {
+    // This class holds the part of the profile of a 'ProfilingAllocator'
+    // gathered by one thread.  Only one thread at a time may call the
+    // manipulators of an object of this class, but its accessors may be
+    // called concurrently from any thread.
+
+    // DATA
+    bsls::LocalLatencyHistogram  d_sizes;          // sizes of allocated
+                                                   // blocks
+
+    bsls::LocalLatencyHistogram  d_lifetimes;      // lifetimes of deallocated
+                                                   // blocks
+
+    bsls::AtomicInt64            d_numBytesFreed;  // bytes deallocated
+
+    bsls::Types::Int64           d_countdown;      // allocations remaining
+                                                   // until the next sample
+
+    bsls::Types::Uint64          d_randomState;    // state of the generator
+                                                   // of countdowns
+
+  private:
+    // NOT IMPLEMENTED
+    ProfilingAllocator_ThreadProfile(const ProfilingAllocator_ThreadProfile&);
+    ProfilingAllocator_ThreadProfile& operator=(
+                                      const ProfilingAllocator_ThreadProfile&);
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 nextCountdown(int samplingPeriod)
+        // Return a pseudo-random number of allocations, uniformly distributed
+        // in '[1, 2 * samplingPeriod - 1]', to be made until the next sample
+        // for the specified 'samplingPeriod'.  The behavior is undefined
+        // unless '0 < samplingPeriod'.
+    {
+        // xorshift64 (Marsaglia)
+
+        bsls::Types::Uint64 x = d_randomState;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        d_randomState = x;
+
+        const bsls::Types::Uint64 range =
+                          2 * static_cast<bsls::Types::Uint64>(samplingPeriod)
+                        - 1;
+        return 1 + static_cast<bsls::Types::Int64>((x >> 1) % range);
+    }
+
+  public:
+    // PUBLIC DATA
+    ProfilingAllocator_Profile       *d_owner_p;     // profile of which this
+                                                     // is part (held)
+
+    ProfilingAllocator_ThreadProfile *d_next_p;      // next in the registry
+
+    ProfilingAllocator_ThreadProfile *d_nextFree_p;  // next in the list of
+                                                     // retired thread
+                                                     // profiles
+
+    // CREATORS
+    ProfilingAllocator_ThreadProfile(ProfilingAllocator_Profile *owner,
+                                     int                         period)
+        // Create an empty thread profile that is part of the specified
+        // 'owner' profile, sampling allocations with the specified 'period'.
+    : d_numBytesFreed(0)
+    , d_countdown(0)
+    , d_randomState((reinterpret_cast<bsls::Types::UintPtr>(this)
+                                                        * k_HASH_MULTIPLIER)
+                                                                          | 1)
+    , d_owner_p(owner)
+    , d_next_p(0)
+    , d_nextFree_p(0)
+    {
+        if (period) {
+            d_countdown = nextCountdown(period);
+        }
+    }
+
+    // MANIPULATORS
+    bool recordAllocation(bslma::Allocator::size_type size, int period)
+        // Add an allocation of the specified 'size' to this profile, and
+        // return 'true' if it is to be sampled for the specified 'period',
+        // and 'false' otherwise.
+    {
+        d_sizes.record(static_cast<bsls::Types::Int64>(size));
+
+        if (0 == period || 0 != --d_countdown) {
+            return false;                                             // RETURN
+        }
+        d_countdown = nextCountdown(period);
+        return true;
+    }
+
+    void recordDeallocation(bslma::Allocator::size_type size,
+                            bsls::Types::Int64          lifetime)
+        // Add a deallocation of a block of the specified 'size' having the
+        // specified 'lifetime' to this profile.
+    {
+        d_lifetimes.record(lifetime);
+        d_numBytesFreed.storeRelaxed(d_numBytesFreed.loadRelaxed()
+                                     + static_cast<bsls::Types::Int64>(size));
+    }
+
+    // ACCESSORS
+    void loadLifetimes(bsls::LatencyHistogramSnapshot *result) const
+        // Load into the specified 'result' the lifetimes of the blocks
+        // deallocated.
+    {
+        d_lifetimes.loadSnapshot(result);
+    }
+
+    void loadSizes(bsls::LatencyHistogramSnapshot *result) const
+        // Load into the specified 'result' the sizes of the blocks allocated.
+    {
+        d_sizes.loadSnapshot(result);
+    }
+
+    bsls::Types::Int64 numBytesFreed() const
+        // Return the number of bytes deallocated.
+    {
+        return d_numBytesFreed.loadRelaxed();
+    }
+};
+
+                      // ================================
+                      // class ProfilingAllocator_Profile
+                      // ================================
+
+class ProfilingAllocator_Profile {
+    // This class holds the profile gathered by a 'ProfilingAllocator'.
+
+    // PRIVATE TYPES
+    typedef ProfilingAllocator_ThreadProfile ThreadProfile;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    typedef DWORD         Key;
+#else
+    typedef pthread_key_t Key;
+#endif
+
+    // DATA
+    int                    d_samplingPeriod;  // mean number of allocations
+                                              // per sample, or 0
+
+    Key                    d_key;             // key of the thread profile of
+                                              // the calling thread
+
+    bool                   d_hasKey;          // 'true' if 'd_key' is valid
+
+    mutable bsls::BslLock  d_registryLock;    // guards 'd_registry_p' and
+                                              // 'd_free_p'
+
+    ThreadProfile         *d_registry_p;      // every thread profile, other
+                                              // than 'd_shared'
+
+    ThreadProfile         *d_free_p;          // thread profiles of exited
+                                              // threads
+
+    bsls::BslLock          d_sharedLock;      // serializes recording into
+                                              // 'd_shared'
+
+    ThreadProfile          d_shared;          // thread profile used when no
+                                              // key is available
+
+    mutable bsls::BslLock  d_lock;            // guards the members below
+
+    CallSite               d_callSites[ProfilingAllocator::k_MAX_CALL_SITES];
+                                              // sampled call sites
+
+    bsls::Types::Uint64    d_hashes[ProfilingAllocator::k_MAX_CALL_SITES];
+                                              // hash of each call site
+
+    int                    d_numCallSites;    // number of call sites
+
+    int                    d_slots[k_TABLE_SIZE];
+                                              // 1 + index of a call site, or
+                                              // 0 for an empty slot
+
+    bsls::Types::Int64     d_numDroppedSamples;
+                                              // samples not recorded
+
+    bslma::Allocator      *d_allocator_p;     // memory allocator (held, not
+                                              // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ProfilingAllocator_Profile(const ProfilingAllocator_Profile&);
+    ProfilingAllocator_Profile& operator=(const ProfilingAllocator_Profile&);
+
+    // PRIVATE MANIPULATORS
+    ThreadProfile *createThreadProfile();
+        // Return the address of a thread profile for the calling thread,
+        // reusing a retired thread profile if one is available, and set it as
+        // the value of the thread-specific storage key, or return 0 if the
+        // value of the key could not be set.
+
+  public:
+    // CLASS METHODS
+    static void retireThreadProfile(void *threadProfile);
+        // Add the specified 'threadProfile', of a thread that is exiting, to
+        // the retired thread profiles of its owner.
+
+    // CREATORS
+    ProfilingAllocator_Profile(int               samplingPeriod,
+                               bslma::Allocator *basicAllocator);
+        // Create an empty profile sampling allocations with the specified
+        // 'samplingPeriod', using the specified 'basicAllocator' to supply the
+        // memory of its thread profiles.
+
+    ~ProfilingAllocator_Profile();
+        // Destroy this profile and each of its thread profiles.
+
+    // MANIPULATORS
+    bool recordAllocation(bslma::Allocator::size_type size)
+        // Add an allocation of the specified 'size' to the thread profile of
+        // the calling thread, and return 'true' if it is to be sampled, and
+        // 'false' otherwise.
+    {
+        ThreadProfile *threadProfile = lookupThreadProfile();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != threadProfile)) {
+            return threadProfile->recordAllocation(size,
+                                                   d_samplingPeriod);
+                                                                      // RETURN
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bsls::BslLockGuard guard(&d_sharedLock);
+        return d_shared.recordAllocation(size, d_samplingPeriod);
+    }
+
+    void recordDeallocation(bslma::Allocator::size_type size,
+                            bsls::Types::Int64          lifetime)
+        // Add a deallocation of a block of the specified 'size' having the
+        // specified 'lifetime' to the thread profile of the calling thread.
+    {
+        ThreadProfile *threadProfile = lookupThreadProfile();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != threadProfile)) {
+            threadProfile->recordDeallocation(size, lifetime);
+            return;                                                   // RETURN
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bsls::BslLockGuard guard(&d_sharedLock);
+        d_shared.recordDeallocation(size, lifetime);
+    }
+
+    ThreadProfile *lookupThreadProfile()
+        // Return the address of the thread profile of the calling thread,
+        // creating it if necessary, or 0 if the calling thread must use the
+        // shared thread profile.
+    {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasKey)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return 0;                                                 // RETURN
+        }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        ThreadProfile *threadProfile = static_cast<ThreadProfile *>(
+                                                         TlsGetValue(d_key));
+#else
+        ThreadProfile *threadProfile = static_cast<ThreadProfile *>(
+                                                 pthread_getspecific(d_key));
+#endif
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!threadProfile)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            threadProfile = createThreadProfile();
+        }
+        return threadProfile;
+    }
+
+    int recordSample(void * const                *frames,
+                     int                          numFrames,
+                     bslma::Allocator::size_type  size);
+        // Add an allocation of the specified 'size' to the call site having
+        // the specified 'numFrames' return addresses at the specified
+        // 'frames', and return the index of that call site, or -1 if the call
+        // site could not be recorded.
+
+    void recordSampleDeallocation(int                         index,
+                                  bslma::Allocator::size_type size)
+        // Subtract the specified 'size' from the bytes in use of the call site
+        // having the specified 'index'.
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        d_callSites[index].d_numBytesInUse -=
+                                         static_cast<bsls::Types::Int64>(size);
+    }
+
+    // ACCESSORS
+    void loadCallSites(bsl::vector<CallSite> *result) const;
+        // Load into the specified 'result' the call sites recorded, in the
+        // order in which they were first sampled.  The behavior is undefined
+        // unless the capacity of 'result' is at least
+        // 'ProfilingAllocator::k_MAX_CALL_SITES'.
+
+    void loadTotals(bsls::LatencyHistogramSnapshot *sizes,
+                    bsls::LatencyHistogramSnapshot *lifetimes,
+                    bsls::Types::Int64             *numBytesFreed) const;
+        // Load into the specified 'sizes', 'lifetimes', and 'numBytesFreed',
+        // each of which may be 0, the corresponding totals over all thread
+        // profiles.
+
+    bsls::Types::Int64 numDroppedSamples() const
+        // Return the number of samples not recorded.
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        return d_numDroppedSamples;
+    }
+};
+
+                      // --------------------------------
+                      // class ProfilingAllocator_Profile
+                      // --------------------------------
+
+// PRIVATE MANIPULATORS
+ProfilingAllocator_ThreadProfile *
+ProfilingAllocator_Profile::createThreadProfile()
+{
+    ThreadProfile *threadProfile;
+    {
+        bsls::BslLockGuard guard(&d_registryLock);
+
+        threadProfile = d_free_p;
+        if (threadProfile) {
+            d_free_p = threadProfile->d_nextFree_p;
+        }
+    }
+
+    if (!threadProfile) {
+        threadProfile = new (*d_allocator_p) ThreadProfile(this,
+                                                           d_samplingPeriod);
+
+        bsls::BslLockGuard guard(&d_registryLock);
+
+        threadProfile->d_next_p = d_registry_p;
+        d_registry_p            = threadProfile;
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const int rc = TlsSetValue(d_key, threadProfile) ? 0 : -1;
+#else
+    const int rc = pthread_setspecific(d_key, threadProfile);
+#endif
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Keep the thread profile (whose counts must not be lost) for another
+        // thread, and record into the shared thread profile instead.
+
+        retireThreadProfile(threadProfile);
+        return 0;                                                     // RETURN
+    }
+
+    return threadProfile;
+}
+
+// CLASS METHODS
+void ProfilingAllocator_Profile::retireThreadProfile(void *threadProfile)
+{
+    ThreadProfile *profile = static_cast<ThreadProfile *>(threadProfile);
+    ProfilingAllocator_Profile *owner = profile->d_owner_p;
+
+    bsls::BslLockGuard guard(&owner->d_registryLock);
+
+    profile->d_nextFree_p = owner->d_free_p;
+    owner->d_free_p       = profile;
+}
+
+// CREATORS
+ProfilingAllocator_Profile::ProfilingAllocator_Profile(
+                                            int               samplingPeriod,
+                                            bslma::Allocator *basicAllocator)
+: d_samplingPeriod(samplingPeriod)
+, d_hasKey(false)
+, d_registry_p(0)
+, d_free_p(0)
+, d_shared(this, samplingPeriod)
+, d_numCallSites(0)
+, d_numDroppedSamples(0)
+, d_allocator_p(basicAllocator)
+{
+    bsl::memset(d_slots, 0, sizeof d_slots);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    d_key    = TlsAlloc();
+    d_hasKey = TLS_OUT_OF_INDEXES != d_key;
+#else
+    d_hasKey = 0 == pthread_key_create(&d_key,
+                                       &bdlma_ProfilingAllocator_threadExit);
+#endif
+}
+
+ProfilingAllocator_Profile::~ProfilingAllocator_Profile()
+{
+    if (d_hasKey) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        TlsFree(d_key);
+#else
+        pthread_key_delete(d_key);
+#endif
+    }
+
+    while (d_registry_p) {
+        ThreadProfile *next = d_registry_p->d_next_p;
+        d_allocator_p->deleteObject(d_registry_p);
+        d_registry_p = next;
+    }
+}
+
+// MANIPULATORS
+int ProfilingAllocator_Profile::recordSample(
+                                   void * const                *frames,
+                                   int                          numFrames,
+                                   bslma::Allocator::size_type  size)
+{
+    const bsls::Types::Uint64 hash  = hashCallStack(frames, numFrames);
+    const bsls::Types::Int64  bytes = static_cast<bsls::Types::Int64>(size);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    int slot = static_cast<int>(hash & (k_TABLE_SIZE - 1));
+    for (; d_slots[slot]; slot = (slot + 1) & (k_TABLE_SIZE - 1)) {
+        const int  index    = d_slots[slot] - 1;
+        CallSite&  callSite = d_callSites[index];
+
+        if (d_hashes[index]      == hash
+         && callSite.d_numFrames == numFrames
+         && 0 == bsl::memcmp(callSite.d_frames,
+                             frames,
+                             numFrames * sizeof *frames)) {
+            ++callSite.d_numAllocations;
+            callSite.d_numBytes      += bytes;
+            callSite.d_numBytesInUse += bytes;
+            return index;                                             // RETURN
+        }
+    }
+
+    if (ProfilingAllocator::k_MAX_CALL_SITES == d_numCallSites) {
+        ++d_numDroppedSamples;
+        return -1;                                                    // RETURN
+    }
+
+    const int  index    = d_numCallSites++;
+    CallSite&  callSite = d_callSites[index];
+
+    bsl::memcpy(callSite.d_frames, frames, numFrames * sizeof *frames);
+    callSite.d_numFrames      = numFrames;
+    callSite.d_numAllocations = 1;
+    callSite.d_numBytes       = bytes;
+    callSite.d_numBytesInUse  = bytes;
+
+    d_hashes[index] = hash;
+    d_slots[slot]   = index + 1;
+    return index;
+}
+
+// ACCESSORS
+void ProfilingAllocator_Profile::loadCallSites(
+                                          bsl::vector<CallSite> *result) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(ProfilingAllocator::k_MAX_CALL_SITES <= result->capacity());
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    result->assign(d_callSites, d_callSites + d_numCallSites);
+}
+
+void ProfilingAllocator_Profile::loadTotals(
+                         bsls::LatencyHistogramSnapshot *sizes,
+                         bsls::LatencyHistogramSnapshot *lifetimes,
+                         bsls::Types::Int64             *numBytesFreed) const
+{
+    // Load the bytes deallocated first, so that allocations and deallocations
+    // made while the totals are loaded do not make the bytes in use negative.
+
+    bsls::LatencyHistogramSnapshot snapshot;
+
+    bsls::BslLockGuard guard(&d_registryLock);
+
+    if (numBytesFreed) {
+        *numBytesFreed = d_shared.numBytesFreed();
+        for (const ThreadProfile *p = d_registry_p; p; p = p->d_next_p) {
+            *numBytesFreed += p->numBytesFreed();
+        }
+    }
+
+    if (sizes) {
+        d_shared.loadSizes(sizes);
+        for (const ThreadProfile *p = d_registry_p; p; p = p->d_next_p) {
+            p->loadSizes(&snapshot);
+            sizes->merge(snapshot);
+        }
+    }
+
+    if (lifetimes) {
+        d_shared.loadLifetimes(lifetimes);
+        for (const ThreadProfile *p = d_registry_p; p; p = p->d_next_p) {
+            p->loadLifetimes(&snapshot);
+            lifetimes->merge(snapshot);
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+extern "C"
+void bdlma_ProfilingAllocator_threadExit(void *threadProfile)
+{
+    BloombergLP::bdlma::ProfilingAllocator_Profile::retireThreadProfile(
+                                                                threadProfile);
+}
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // ------------------------
+                          // class ProfilingAllocator
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void ProfilingAllocator::init()
+{
+    BSLS_ASSERT(0 <= d_samplingPeriod);
+    BSLS_ASSERT(d_allocator_p);
+
+    d_profile_p = new (*d_allocator_p) ProfilingAllocator_Profile(
+                                                             d_samplingPeriod,
+                                                             d_allocator_p);
+}
+
+// CREATORS
+ProfilingAllocator::ProfilingAllocator(bslma::Allocator *basicAllocator)
+: d_name_p(0)
+, d_samplingPeriod(k_DEFAULT_SAMPLING_PERIOD)
+, d_profile_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+ProfilingAllocator::ProfilingAllocator(const char       *name,
+                                       bslma::Allocator *basicAllocator)
+: d_name_p(name)
+, d_samplingPeriod(k_DEFAULT_SAMPLING_PERIOD)
+, d_profile_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+ProfilingAllocator::ProfilingAllocator(const char       *name,
+                                       int               samplingPeriod,
+                                       bslma::Allocator *basicAllocator)
+: d_name_p(name)
+, d_samplingPeriod(samplingPeriod)
+, d_profile_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
+}
+
+ProfilingAllocator::~ProfilingAllocator()
+{
+    d_allocator_p->deleteObject(d_profile_p);
+}
+
+// MANIPULATORS
+void *ProfilingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                             d_allocator_p->allocate(sizeof(Header) + size));
+
+    HeaderData& data = header->d_data;
+    data.d_size     = size;
+    data.d_callSite = -1;
+    bsls::TimeUtil::getFastTimerRaw(&data.d_time);
+
+    const bool isSampled = d_profile_p->recordAllocation(size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isSampled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        void      *frames[CallSite::k_MAX_FRAMES];
+        const int  numFrames = captureCallStack(frames);
+
+        data.d_callSite = d_profile_p->recordSample(frames, numFrames, size);
+    }
+
+    return header + 1;
+}
+
+void ProfilingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header           *header = static_cast<Header *>(address) - 1;
+    const HeaderData& data   = header->d_data;
+
+    bsls::TimeUtil::OpaqueFastTime now;
+    bsls::TimeUtil::getFastTimerRaw(&now);
+
+    d_profile_p->recordDeallocation(
+                                 data.d_size,
+                                 bsls::TimeUtil::convertRawTime(now)
+                               - bsls::TimeUtil::convertRawTime(data.d_time));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 <= data.d_callSite)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_profile_p->recordSampleDeallocation(data.d_callSite, data.d_size);
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+void ProfilingAllocator::loadCallSites(bsl::vector<CallSite> *result) const
+{
+    BSLS_ASSERT(result);
+
+    // Reserve the capacity for every call site before taking the lock, as
+    // 'result' may obtain its memory from this allocator.
+
+    result->clear();
+    result->reserve(k_MAX_CALL_SITES);
+    d_profile_p->loadCallSites(result);
+    bsl::stable_sort(result->begin(), result->end(), &isMoreFrequent);
+}
+
+void ProfilingAllocator::loadLifetimeHistogram(
+                                 bsls::LatencyHistogramSnapshot *result) const
+{
+    BSLS_ASSERT(result);
+
+    d_profile_p->loadTotals(0, result, 0);
+}
+
+void ProfilingAllocator::loadSizeHistogram(
+                                 bsls::LatencyHistogramSnapshot *result) const
+{
+    BSLS_ASSERT(result);
+
+    d_profile_p->loadTotals(result, 0, 0);
+}
+
+bsls::Types::Int64 ProfilingAllocator::numAllocations() const
+{
+    bsls::LatencyHistogramSnapshot sizes;
+    d_profile_p->loadTotals(&sizes, 0, 0);
+    return sizes.count();
+}
+
+bsls::Types::Int64 ProfilingAllocator::numBytesInUse() const
+{
+    bsls::LatencyHistogramSnapshot sizes;
+    bsls::Types::Int64             numBytesFreed;
+    d_profile_p->loadTotals(&sizes, 0, &numBytesFreed);
+    return sizes.sum() - numBytesFreed;
+}
+
+bsls::Types::Int64 ProfilingAllocator::numBytesTotal() const
+{
+    bsls::LatencyHistogramSnapshot sizes;
+    d_profile_p->loadTotals(&sizes, 0, 0);
+    return sizes.sum();
+}
+
+bsls::Types::Int64 ProfilingAllocator::numDeallocations() const
+{
+    bsls::LatencyHistogramSnapshot lifetimes;
+    d_profile_p->loadTotals(0, &lifetimes, 0);
+    return lifetimes.count();
+}
+
+bsls::Types::Int64 ProfilingAllocator::numDroppedSamples() const
+{
+    return d_profile_p->numDroppedSamples();
+}
+
+bsl::ostream& ProfilingAllocator::print(bsl::ostream& stream,
+                                        int           maxNumCallSites) const
+{
+    BSLS_ASSERT(0 <= maxNumCallSites);
+
+    bsls::LatencyHistogramSnapshot sizes;
+    bsls::LatencyHistogramSnapshot lifetimes;
+    bsls::Types::Int64             numBytesFreed;
+    d_profile_p->loadTotals(&sizes, &lifetimes, &numBytesFreed);
+
+    bsl::vector<CallSite> callSites(d_allocator_p);
+    loadCallSites(&callSites);
+
+    stream << "----------------------------------------\n"
+           << "        Profiling Allocator State\n"
+           << "----------------------------------------\n";
+
+    if (d_name_p) {
+        stream << "Allocator name: " << name() << "\n";
+    }
+
+    stream << "Allocations:    " << sizes.count() << "\n"
+           << "Deallocations:  " << lifetimes.count() << "\n"
+           << "Bytes in use:   " << sizes.sum() - numBytesFreed << "\n"
+           << "Bytes in total: " << sizes.sum() << "\n"
+           << "Sizes (bytes):  ";
+    printHistogram(stream, sizes);
+    stream << "Lifetimes (ns): ";
+    printHistogram(stream, lifetimes);
+
+    if (0 == d_samplingPeriod) {
+        return stream;                                                // RETURN
+    }
+
+    stream << "Call sites (1 in " << d_samplingPeriod
+           << " allocations sampled, " << numDroppedSamples()
+           << " dropped):\n";
+
+    const int numCallSites = static_cast<int>(callSites.size());
+    for (int i = 0; i < numCallSites && i < maxNumCallSites; ++i) {
+        const CallSite& callSite = callSites[i];
+
+        stream << "#" << i + 1 << ": "
+               << callSite.d_numAllocations << " allocations (~"
+               << callSite.d_numAllocations * d_samplingPeriod << "), "
+               << callSite.d_numBytes << " bytes, "
+               << callSite.d_numBytesInUse << " bytes in use\n";
+        printFrames(stream, callSite);
+    }
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
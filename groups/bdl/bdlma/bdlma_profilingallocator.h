@@ -0,0 +1,454 @@
+// bdlma_profilingallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLMA_PROFILINGALLOCATOR
+#define INCLUDED_BDLMA_PROFILINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that profiles the allocations it forwards.
+//
+//@CLASSES:
+//  bdlma::ProfilingAllocator: allocator gathering sizes, lifetimes, and sites
+//
+//@SEE_ALSO: bdlma_countingallocator, bslma_testallocator,
+//           bsls_latencyhistogram
+//
+//@DESCRIPTION: This component provides a concrete allocator,
+// 'bdlma::ProfilingAllocator', that implements the 'bslma::Allocator' protocol
+// by forwarding each request to an underlying allocator, and that gathers a
+// profile of the requests it forwards, suitable for finding the sources of
+// allocator churn in a production process:
+//..
+//   ,-------------------------.
+//  ( bdlma::ProfilingAllocator )
+//   `-------------------------'
+//                |           ctor/dtor
+//                |           loadCallSites
+//                |           loadLifetimeHistogram
+//                |           loadSizeHistogram
+//                |           name
+//                |           numAllocations
+//                |           numBytesInUse
+//                |           numBytesTotal
+//                |           numDeallocations
+//                |           numDroppedSamples
+//                |           print
+//                |           samplingPeriod
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                            allocate
+//                            deallocate
+//..
+// The profile consists of:
+//
+//: o A histogram of the sizes of all allocations, from which the number of
+//:   allocations and the number of bytes ever allocated are also obtained.
+//:
+//: o A histogram of the lifetimes (in nanoseconds) of all deallocated blocks,
+//:   from which the number of deallocations is also obtained.
+//:
+//: o The number of bytes currently in use.
+//:
+//: o A table of the call stacks of a sample of the allocations, each with the
+//:   number and total size of the sampled allocations made from it, and the
+//:   number of those bytes still in use.
+//
+// Each thread records the sizes, lifetimes, and deallocated bytes of its own
+// requests into a *thread profile* of its own, held in thread-specific
+// storage, so that threads neither lock nor share a counter to record them.
+// The histograms of a thread profile are 'bsls::LocalLatencyHistogram'
+// objects (see 'bsls_latencyhistogram'), whose values are exact to within
+// 1/32, and the accessors merge the thread profiles of all threads.  The
+// lifetime of a block is measured with 'bsls::TimeUtil::getFastTimerRaw'.  A
+// block deallocated by a thread other than the one that allocated it is
+// recorded by the deallocating thread.
+//
+///Sampled Call Sites
+///------------------
+// Capturing a call stack is too expensive to do on every allocation, so, by
+// default, only about one allocation in 'k_DEFAULT_SAMPLING_PERIOD' (1024) is
+// sampled.  Each thread counts down the allocations it makes to its next
+// sample, the count being drawn at random with a mean of 'samplingPeriod()',
+// so no counter is shared between threads to decide which allocations to
+// sample, and allocations made at regular intervals are not systematically
+// missed.  The sampling period may be supplied at construction: a period of
+// 1 samples every allocation, and a period of 0 disables sampling.  The
+// number of allocations made from a call site is estimated by multiplying the
+// number of samples taken there by the sampling period.
+//
+// The call stack of a sampled allocation is captured with 'backtrace' (on
+// Linux and Darwin), omitting the frames of this allocator itself, and is
+// truncated to 'CallSite::k_MAX_FRAMES' frames.  On other platforms no frames
+// are captured, so that all sampled allocations are attributed to a single
+// call site having no frames.  At most 'k_MAX_CALL_SITES' distinct call sites
+// are recorded; samples from further call sites are counted by
+// 'numDroppedSamples'.  Recording a sample, or deallocating a sampled block,
+// takes a lock; otherwise a lock is taken only on the first request of a
+// thread.
+//
+///Overhead
+///--------
+// Each block carries a maximally-aligned header (of 32 bytes on typical 64-bit
+// platforms) holding its size, allocation time, and call site.  Each
+// allocation and deallocation reads the fast timer, looks up the thread
+// profile of the calling thread, and updates a histogram with plain (relaxed)
+// loads and stores, at a cost of some tens of nanoseconds; sampled
+// allocations additionally capture a call stack.  The table of call sites
+// (about 50 kilobytes) is obtained from the underlying allocator at
+// construction, and each thread profile (about 30 kilobytes) on the first
+// request of a thread.  On POSIX platforms the thread profile of an exited
+// thread is reused by the next thread to make a request; on Windows it is
+// retained (unused) until the allocator is destroyed.
+//
+// Note that the number of bytes in use and the number of allocations are
+// computed by merging the histograms of every thread profile, so the
+// accessors returning them are not intended for use on performance-critical
+// paths.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ProfilingAllocator' is *fully thread-safe* (see 'bsldoc_glossary'),
+// provided that the underlying allocator (established at construction) is
+// fully thread-safe.  A profile gathered while other threads are allocating
+// is not a consistent snapshot of a single instant, but each of its counts is
+// no greater than the final count.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Allocations of a Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how often a container allocates as it grows,
+// how large its allocations are, and where in the code they are made.
+//
+// First, we create a profiling allocator that forwards to the default
+// allocator, supplying a name for its report and a sampling period of 1, so
+// that the call stack of every allocation is captured:
+//..
+//  bdlma::ProfilingAllocator profiler("vector growth", 1);
+//..
+// Then, we grow a vector that uses the profiling allocator:
+//..
+//  {
+//      bsl::vector<int> values(&profiler);
+//      for (int i = 0; i < 1000; ++i) {
+//          values.push_back(i);
+//      }
+//      assert(0 < profiler.numBytesInUse());
+//  }
+//..
+// Next, we observe that each of the vector's allocations has been returned,
+// and examine the distribution of their sizes:
+//..
+//  assert(0 < profiler.numAllocations());
+//  assert(profiler.numAllocations() == profiler.numDeallocations());
+//  assert(0                         == profiler.numBytesInUse());
+//
+//  bsls::LatencyHistogramSnapshot sizes;
+//  profiler.loadSizeHistogram(&sizes);
+//  assert(profiler.numAllocations() == sizes.count());
+//  assert(1000 * sizeof(int)        <= sizes.max());
+//..
+// Then, we obtain the call sites of the sampled allocations, the most frequent
+// first, and verify that every allocation was sampled:
+//..
+//  bsl::vector<bdlma::ProfilingAllocator::CallSite> sites;
+//  profiler.loadCallSites(&sites);
+//  assert(1 <= sites.size());
+//
+//  bsls::Types::Int64 numSampled = 0;
+//  for (bsl::size_t i = 0; i < sites.size(); ++i) {
+//      numSampled += sites[i].d_numAllocations;
+//      assert(0 == sites[i].d_numBytesInUse);
+//  }
+//  assert(profiler.numAllocations() == numSampled);
+//..
+// Finally, we write a report of the profile to 'stdout':
+//..
+//  profiler.print(bsl::cout);
+//..
+// which displays something like the following (on Linux, built with
+// '-rdynamic' so that the frames are symbolized):
+//..
+//  ----------------------------------------
+//          Profiling Allocator State
+//  ----------------------------------------
+//  Allocator name: vector growth
+//  Allocations:    11
+//  Deallocations:  11
+//  Bytes in use:   0
+//  Bytes in total: 8188
+//  Sizes (bytes):  min 4, p50 131, p90 2111, p99 4096, max 4096
+//  Lifetimes (ns): min 180, p50 1023, p90 2815, p99 5631, max 5818
+//  Call sites (1 in 1 allocations sampled, 0 dropped):
+//  #1: 11 allocations (~11), 8188 bytes, 0 bytes in use
+//      ./a.out(_ZN5bsl...reserveImp...+0x5c) [0x41f3ac]
+//      ...
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#include <bsls_latencyhistogram.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ProfilingAllocator_Profile;
+
+                          // ========================
+                          // class ProfilingAllocator
+                          // ========================
+
+class ProfilingAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol by forwarding to an
+    // underlying allocator, and gathers histograms of the sizes and lifetimes
+    // of the blocks it supplies, and the call sites of a sample of them.
+
+  public:
+    // PUBLIC TYPES
+    struct CallSite {
+        // This 'struct' describes the call stack of sampled allocations, and
+        // the sampled allocations made from it.
+
+        enum { k_MAX_FRAMES = 16 };  // maximum number of frames captured
+
+        void               *d_frames[k_MAX_FRAMES];
+                                          // return addresses of the frames of
+                                          // the call stack, innermost first
+
+        int                 d_numFrames;  // number of frames in 'd_frames'
+
+        bsls::Types::Int64  d_numAllocations;
+                                          // number of sampled allocations
+
+        bsls::Types::Int64  d_numBytes;   // bytes of sampled allocations
+
+        bsls::Types::Int64  d_numBytesInUse;
+                                          // bytes of sampled allocations that
+                                          // have not been deallocated
+    };
+
+    enum {
+        k_DEFAULT_SAMPLING_PERIOD = 1024,  // default mean number of
+                                           // allocations per sample
+
+        k_MAX_CALL_SITES          = 256    // maximum number of call sites
+                                           // recorded
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct HeaderData {
+        // This 'struct' describes a block supplied by this allocator.
+
+        size_type                         d_size;      // requested size
+
+        bsls::TimeUtil::OpaqueFastTime    d_time;      // time of allocation
+
+        int                               d_callSite;  // index of the call
+                                                       // site, or -1 if not
+                                                       // sampled
+    };
+
+    union Header {
+        // This 'union' precedes each block returned by 'allocate'.
+
+        HeaderData                          d_data;   // description of block
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;  // force alignment
+    };
+
+    // DATA
+    const char                 *d_name_p;             // optionally
+                                                      // specified name (or 0)
+
+    int                         d_samplingPeriod;     // mean number of
+                                                      // allocations per
+                                                      // sample, or 0
+
+    ProfilingAllocator_Profile *d_profile_p;          // profile (owned)
+
+    bslma::Allocator           *d_allocator_p;        // memory allocator
+                                                      // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ProfilingAllocator(const ProfilingAllocator&);
+    ProfilingAllocator& operator=(const ProfilingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void init();
+        // Create the profile of this allocator.
+
+  public:
+    // CREATORS
+    explicit
+    ProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ProfilingAllocator(const char       *name,
+                       bslma::Allocator *basicAllocator = 0);
+    ProfilingAllocator(const char       *name,
+                       int               samplingPeriod,
+                       bslma::Allocator *basicAllocator = 0);
+        // Create a profiling allocator.  Optionally specify a 'name'
+        // (associated with this object) to be included in the output of the
+        // 'print' method.  If 'name' is 0 (or not specified), no name is
+        // included in that output.  Optionally specify a 'samplingPeriod', the
+        // mean number of allocations per sampled allocation, or 0 to sample no
+        // allocations.  If 'samplingPeriod' is not specified,
+        // 'k_DEFAULT_SAMPLING_PERIOD' is used.  Optionally specify a
+        // 'basicAllocator' to which allocations are forwarded, and from which
+        // the memory of the profile is supplied.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= samplingPeriod', and 'basicAllocator' is
+        // fully thread-safe if this object is used by more than one thread.
+
+    virtual ~ProfilingAllocator();
+        // Destroy this allocator object.  The behavior is undefined unless
+        // all blocks allocated from this object have been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes), obtained from the underlying allocator,
+        // and add it to the profile of this allocator.  If 'size' is 0, a null
+        // pointer is returned with no other effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the
+        // underlying allocator, and add its lifetime to the profile of this
+        // allocator.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+    // ACCESSORS
+    void loadCallSites(bsl::vector<CallSite> *result) const;
+        // Load into the specified 'result' the call sites of the sampled
+        // allocations, ordered by decreasing number of sampled allocations
+        // (and by decreasing number of bytes among those having the same
+        // number of allocations).
+
+    void loadLifetimeHistogram(bsls::LatencyHistogramSnapshot *result) const;
+        // Load into the specified 'result' the histogram of the lifetimes, in
+        // nanoseconds, of the blocks deallocated by this object.
+
+    void loadSizeHistogram(bsls::LatencyHistogramSnapshot *result) const;
+        // Load into the specified 'result' the histogram of the sizes, in
+        // bytes, of the blocks allocated from this object.
+
+    const char *name() const;
+        // Return the name of this profiling allocator, or 0 if no name was
+        // specified at construction.
+
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of blocks ever allocated from this object.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently allocated from this object.
+
+    bsls::Types::Int64 numBytesTotal() const;
+        // Return the cumulative number of bytes ever allocated from this
+        // object.
+
+    bsls::Types::Int64 numDeallocations() const;
+        // Return the number of blocks ever deallocated by this object.
+
+    bsls::Types::Int64 numDroppedSamples() const;
+        // Return the number of sampled allocations that were not recorded
+        // because 'k_MAX_CALL_SITES' other call sites had already been
+        // recorded.
+
+    bsl::ostream& print(bsl::ostream& stream, int maxNumCallSites = 10) const;
+        // Write a report of the profile gathered by this allocator to the
+        // specified 'stream' in some reasonable (multi-line) format, and
+        // return a reference to 'stream'.  Optionally specify
+        // 'maxNumCallSites', the maximum number of call sites (those having
+        // the most sampled allocations) to include in the report.  If
+        // 'maxNumCallSites' is not specified, at most 10 call sites are
+        // included.  The behavior is undefined unless '0 <= maxNumCallSites'.
+
+    int samplingPeriod() const;
+        // Return the mean number of allocations per sampled allocation of this
+        // allocator, or 0 if no allocations are sampled.
+};
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class ProfilingAllocator
+                          // ------------------------
+
+// ACCESSORS
+inline
+const char *ProfilingAllocator::name() const
+{
+    return d_name_p;
+}
+
+inline
+int ProfilingAllocator::samplingPeriod() const
+{
+    return d_samplingPeriod;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1196 @@
+// bdlma_profilingallocator.t.cpp                                     -*-C++-*-
+#include <bdlma_profilingallocator.h>
+
+#include <bdlma_countingallocator.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// A 'bdlma::ProfilingAllocator' forwards each request to an underlying
+// allocator, preceding each block with a header, and accumulates histograms of
+// the sizes and lifetimes of the blocks, and a table of the call sites of
+// sampled allocations.  The primary concerns are that the blocks are usable
+// and aligned and are returned to the underlying allocator, that the counts
+// and histograms are exact (including when several threads use the allocator
+// concurrently), that allocations are sampled with the configured period, and
+// that the call sites of sampled allocations are distinguished and are
+// dropped, rather than recorded, once the table is full.  Call stacks are
+// captured only on some platforms, so the tests of call sites that depend on
+// captured frames are performed only on those platforms.
+//-----------------------------------------------------------------------------
+// // CREATORS
+// [ 2] bdlma::ProfilingAllocator(bslma::Allocator *ba = 0);
+// [ 2] bdlma::ProfilingAllocator(const char *name, bslma::Allocator *ba = 0);
+// [ 2] bdlma::ProfilingAllocator(const char *name, int period, *ba = 0);
+// [ 2] ~bdlma::ProfilingAllocator();
+//
+// // MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// // ACCESSORS
+// [ 4] void loadCallSites(bsl::vector<CallSite> *result) const;
+// [ 3] void loadLifetimeHistogram(LatencyHistogramSnapshot *result) const;
+// [ 3] void loadSizeHistogram(LatencyHistogramSnapshot *result) const;
+// [ 2] const char *name() const;
+// [ 3] bsls::Types::Int64 numAllocations() const;
+// [ 3] bsls::Types::Int64 numBytesInUse() const;
+// [ 3] bsls::Types::Int64 numBytesTotal() const;
+// [ 3] bsls::Types::Int64 numDeallocations() const;
+// [ 4] bsls::Types::Int64 numDroppedSamples() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream, int maxNumCallSites) const;
+// [ 2] int samplingPeriod() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: concurrent use is profiled exactly
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD OF PROFILING
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ProfilingAllocator           Obj;
+typedef bdlma::ProfilingAllocator::CallSite CallSite;
+typedef bsls::LatencyHistogramSnapshot      Snapshot;
+typedef bsls::Types::Int64                  Int64;
+
+typedef bslma::Allocator::size_type size_type;
+
+enum { MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+static const int SIZES[] = {
+    1, 2, 3, 7, 8, 15, 16, 31, 33, 64, 100, 255, 1000, 4096, 10000, 100000
+};
+const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+#define U_CAPTURES_CALL_STACKS 1
+    // call stacks of sampled allocations are captured on this platform
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define U_NOINLINE __attribute__((noinline))
+#else
+#define U_NOINLINE
+#endif
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+//=============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace {
+
+int numOddCalls  = 0;  // calls of 'allocateViaOdd'
+int numEvenCalls = 0;  // calls of 'allocateViaEven'
+
+void *allocateVia(bslma::Allocator *allocator, unsigned path, int depth);
+
+U_NOINLINE
+void *allocateViaOdd(bslma::Allocator *allocator, unsigned path, int depth)
+    // Return 'allocateVia(allocator, path, depth)'.
+{
+    void *result = allocateVia(allocator, path, depth);
+    ++numOddCalls;
+    return result;
+}
+
+U_NOINLINE
+void *allocateViaEven(bslma::Allocator *allocator, unsigned path, int depth)
+    // Return 'allocateVia(allocator, path, depth)'.
+{
+    void *result = allocateVia(allocator, path, depth);
+    ++numEvenCalls;
+    return result;
+}
+
+U_NOINLINE
+void *allocateVia(bslma::Allocator *allocator, unsigned path, int depth)
+    // Return a block of 8 bytes allocated from the specified 'allocator'
+    // through a chain of 'depth' calls of 'allocateViaOdd' and
+    // 'allocateViaEven', chosen by the successive bits of the specified
+    // 'path' (from least to most significant), so that the call stack of the
+    // allocation is distinct for each value of the low-order 'depth' bits of
+    // 'path'.
+{
+    if (0 == depth) {
+        return allocator->allocate(8);                                // RETURN
+    }
+    return path & 1 ? allocateViaOdd(allocator, path >> 1, depth - 1)
+                    : allocateViaEven(allocator, path >> 1, depth - 1);
+}
+
+struct ThreadInfo {
+    // This 'struct' describes the work of a thread of test case 6.
+
+    Obj *d_obj_p;          // allocator under test
+    int  d_numIterations;  // number of blocks to allocate
+    int  d_seed;           // distinguishes the sizes of the blocks
+};
+
+extern "C" void *allocatingThread(void *arg)
+    // Allocate and deallocate blocks from the allocator described by the
+    // specified 'arg', which must address a 'ThreadInfo' object, keeping up to
+    // 16 blocks outstanding.
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    enum { k_NUM_OUTSTANDING = 16 };
+
+    void *blocks[k_NUM_OUTSTANDING] = { 0 };
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        const int slot = i % k_NUM_OUTSTANDING;
+        info->d_obj_p->deallocate(blocks[slot]);
+        blocks[slot] = info->d_obj_p->allocate(
+                                   1 + (i * 37 + info->d_seed * 101) % 500);
+    }
+    for (int i = 0; i < k_NUM_OUTSTANDING; ++i) {
+        info->d_obj_p->deallocate(blocks[i]);
+    }
+    return 0;
+}
+
+double timeAllocations(bslma::Allocator *allocator, int numIterations)
+    // Return the mean time, in nanoseconds, of a pair of calls to 'allocate'
+    // and 'deallocate' of the specified 'allocator', measured over the
+    // specified 'numIterations' pairs, keeping 64 blocks of varied sizes
+    // outstanding.
+{
+    enum { k_NUM_OUTSTANDING = 64 };
+
+    void *blocks[k_NUM_OUTSTANDING] = { 0 };
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numIterations; ++i) {
+        const int slot = i % k_NUM_OUTSTANDING;
+        allocator->deallocate(blocks[slot]);
+        blocks[slot] = allocator->allocate(1 + (i * 37) % 256);
+    }
+    timer.stop();
+
+    for (int i = 0; i < k_NUM_OUTSTANDING; ++i) {
+        allocator->deallocate(blocks[i]);
+    }
+    return timer.elapsedTime() * 1e9 / numIterations;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Neither the default nor the global allocator should be used.
+
+    bslma::TestAllocator defaultAllocator("Default Allocator",
+                                          veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("Global Allocator",
+                                         veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Allocations of a Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to know how often a container allocates as it grows,
+// how large its allocations are, and where in the code they are made.
+//
+// First, we create a profiling allocator that forwards to the default
+// allocator, supplying a name for its report and a sampling period of 1, so
+// that the call stack of every allocation is captured:
+//..
+    bdlma::ProfilingAllocator profiler("vector growth", 1);
+//..
+// Then, we grow a vector that uses the profiling allocator:
+//..
+    {
+        bsl::vector<int> values(&profiler);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        ASSERT(0 < profiler.numBytesInUse());
+    }
+//..
+// Next, we observe that each of the vector's allocations has been returned,
+// and examine the distribution of their sizes:
+//..
+    ASSERT(0 < profiler.numAllocations());
+    ASSERT(profiler.numAllocations() == profiler.numDeallocations());
+    ASSERT(0                         == profiler.numBytesInUse());
+
+    bsls::LatencyHistogramSnapshot sizes;
+    profiler.loadSizeHistogram(&sizes);
+    ASSERT(profiler.numAllocations()  == sizes.count());
+    ASSERT(Int64(1000 * sizeof(int)) <= sizes.max());
+//..
+// Then, we obtain the call sites of the sampled allocations, the most frequent
+// first, and verify that every allocation was sampled:
+//..
+    bsl::vector<bdlma::ProfilingAllocator::CallSite> sites;
+    profiler.loadCallSites(&sites);
+    ASSERT(1 <= sites.size());
+
+    bsls::Types::Int64 numSampled = 0;
+    for (bsl::size_t i = 0; i < sites.size(); ++i) {
+        numSampled += sites[i].d_numAllocations;
+        ASSERT(0 == sites[i].d_numBytesInUse);
+    }
+    ASSERT(profiler.numAllocations() == numSampled);
+//..
+// Finally, we write a report of the profile to 'stdout':
+//..
+    if (verbose) {
+    profiler.print(bsl::cout);
+    }
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT USE
+        //
+        // Concerns:
+        //: 1 Allocations and deallocations made concurrently by several
+        //:   threads are all counted, and their bytes are all accounted for.
+        //:
+        //: 2 The bytes in use of each call site return to 0 once every block
+        //:   has been deallocated.
+        //:
+        //: 3 The counts of a thread remain in the profile after it exits.
+        //:
+        //: 4 On POSIX platforms, the memory used to profile a thread is reused
+        //:   after the thread exits.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of known sizes from several
+        //:   threads, sampling one allocation in 4.  After joining the
+        //:   threads, verify the counts, the byte totals, the histograms, and
+        //:   the call sites.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 with new threads, and verify that the counts are
+        //:   doubled and (except on Windows) that no further memory is
+        //:   obtained from the underlying allocator.  (C-3..4)
+        //
+        // Testing:
+        //   CONCERN: concurrent use is profiled exactly
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT USE" << endl
+                          << "==============" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 20000 };
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX("concurrent", 4, &ta);  const Obj& X = mX;
+
+            ThreadInfo info[k_NUM_THREADS];
+            ThreadId   threads[k_NUM_THREADS];
+
+            Int64 expectedBytes = 0;
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                info[t].d_obj_p         = &mX;
+                info[t].d_numIterations = k_NUM_ITERATIONS;
+                info[t].d_seed          = t;
+                for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                    expectedBytes += 1 + (i * 37 + t * 101) % 500;
+                }
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                threads[t] = createThread(&allocatingThread, &info[t]);
+            }
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                joinThread(threads[t]);
+            }
+
+            Int64 NUM = k_NUM_THREADS * k_NUM_ITERATIONS;
+
+            ASSERTV(X.numAllocations(),   NUM == X.numAllocations());
+            ASSERTV(X.numDeallocations(), NUM == X.numDeallocations());
+            ASSERTV(X.numBytesTotal(),    expectedBytes == X.numBytesTotal());
+            ASSERTV(X.numBytesInUse(),    0   == X.numBytesInUse());
+
+            Snapshot sizes;
+            X.loadSizeHistogram(&sizes);
+            ASSERT(1   == sizes.min());
+            ASSERT(500 == sizes.max());
+
+            bsl::vector<CallSite> sites(&ta);
+            X.loadCallSites(&sites);
+
+            Int64 numSampled = 0;
+            for (bsl::size_t i = 0; i < sites.size(); ++i) {
+                numSampled += sites[i].d_numAllocations;
+                ASSERTV(i, 0 == sites[i].d_numBytesInUse);
+            }
+            if (verbose) { P_(NUM) P(numSampled) }
+            ASSERTV(numSampled, NUM / 8 < numSampled);
+            ASSERTV(numSampled, numSampled < NUM / 2);
+            ASSERT(0 == X.numDroppedSamples());
+
+            if (verbose) cout << "\tProfiles of exited threads." << endl;
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                threads[t] = createThread(&allocatingThread, &info[t]);
+                joinThread(threads[t]);
+            }
+
+            NUM           *= 2;
+            expectedBytes *= 2;
+
+            ASSERTV(X.numAllocations(),   NUM == X.numAllocations());
+            ASSERTV(X.numDeallocations(), NUM == X.numDeallocations());
+            ASSERTV(X.numBytesTotal(),    expectedBytes == X.numBytesTotal());
+            ASSERTV(X.numBytesInUse(),    0   == X.numBytesInUse());
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS == ta.numBlocksInUse());
+#endif
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'print'
+        //
+        // Concerns:
+        //: 1 The report includes the name (if any), the counts, and the
+        //:   summaries of the histograms.
+        //:
+        //: 2 The report includes the call sites, the most frequent first, up
+        //:   to the specified maximum number, unless sampling is disabled.
+        //:
+        //: 3 'print' returns a reference to the stream.
+        //
+        // Plan:
+        //: 1 Print the reports of allocators in known states to string
+        //:   streams, and search the output for the expected lines.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream, int maxNumCallSites);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'print'" << endl
+                          << "=======" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+
+        {
+            Obj mX("reported", 1, &ta);  const Obj& X = mX;
+
+            void *blocks[3];
+            for (int i = 0; i < 3; ++i) {
+                blocks[i] = allocateVia(&mX, i, 2);
+            }
+            mX.deallocate(blocks[0]);
+
+            bsl::ostringstream out;
+            ASSERT(&out == &X.print(out));
+
+            const bsl::string REPORT = out.str();
+            if (veryVerbose) cout << REPORT;
+
+            ASSERT(bsl::string::npos != REPORT.find(
+                                           "Allocator name: reported\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Allocations:    3\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Deallocations:  1\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Bytes in use:   16\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Bytes in total: 24\n"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                            "Sizes (bytes):  min 8, p50 8, p90 8, p99 8, "
+                            "max 8\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Lifetimes (ns): min "));
+            ASSERT(bsl::string::npos != REPORT.find(
+                  "Call sites (1 in 1 allocations sampled, 0 dropped):\n"));
+            ASSERT(bsl::string::npos != REPORT.find("#1: "));
+
+#ifdef U_CAPTURES_CALL_STACKS
+            ASSERT(bsl::string::npos != REPORT.find("#3: "));
+            ASSERT(bsl::string::npos != REPORT.find(
+                               "1 allocations (~1), 8 bytes, 0 bytes in use"));
+
+            bsl::ostringstream limited;
+            X.print(limited, 2);
+            ASSERT(bsl::string::npos != limited.str().find("#2: "));
+            ASSERT(bsl::string::npos == limited.str().find("#3: "));
+#endif
+
+            bsl::ostringstream none;
+            X.print(none, 0);
+            ASSERT(bsl::string::npos != none.str().find("Call sites"));
+            ASSERT(bsl::string::npos == none.str().find("#1: "));
+
+            mX.deallocate(blocks[1]);
+            mX.deallocate(blocks[2]);
+        }
+
+        {
+            Obj mX(0, 0, &ta);  const Obj& X = mX;
+
+            bsl::ostringstream out;
+            X.print(out);
+
+            const bsl::string REPORT = out.str();
+            if (veryVerbose) cout << REPORT;
+
+            ASSERT(bsl::string::npos == REPORT.find("Allocator name:"));
+            ASSERT(bsl::string::npos != REPORT.find("Allocations:    0\n"));
+            ASSERT(bsl::string::npos != REPORT.find("Sizes (bytes):  none\n"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                                                 "Lifetimes (ns): none\n"));
+            ASSERT(bsl::string::npos == REPORT.find("Call sites"));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::ostringstream out;
+            ASSERT_PASS(X.print(out, 0));
+            ASSERT_FAIL(X.print(out, -1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING AND CALL SITES
+        //
+        // Concerns:
+        //: 1 With a sampling period of 1, every allocation is sampled; with a
+        //:   period of 0, none is; and with a period of 'N', about '1 / N' of
+        //:   the allocations are sampled.
+        //:
+        //: 2 Allocations made through different call stacks are attributed to
+        //:   different call sites, and those made through the same call stack
+        //:   to the same call site, with the number of allocations, the bytes,
+        //:   and the bytes in use of each call site maintained exactly.
+        //:
+        //: 3 The call sites are loaded in order of decreasing number of
+        //:   allocations, and then of decreasing bytes.
+        //:
+        //: 4 Once 'k_MAX_CALL_SITES' call sites have been recorded, samples
+        //:   from other call sites are dropped and counted, and the blocks of
+        //:   those samples can be deallocated.
+        //:
+        //: 5 'loadCallSites' may be given a vector whose memory is supplied by
+        //:   the allocator itself.
+        //
+        // Plan:
+        //: 1 Allocate blocks through chains of calls of distinct shapes, and
+        //:   verify the call sites loaded.  (C-1..3)
+        //:
+        //: 2 Allocate through 'k_MAX_CALL_SITES' distinct call stacks, and
+        //:   then from one more call site, and verify the count of dropped
+        //:   samples.  (C-4)
+        //:
+        //: 3 Load the call sites into a vector using the allocator under test.
+        //:   (C-5)
+        //:
+        //: 4 Allocate many blocks with sampling periods of 0 and 16, and
+        //:   verify the number of samples.  (C-1)
+        //
+        // Testing:
+        //   void loadCallSites(bsl::vector<CallSite> *result) const;
+        //   bsls::Types::Int64 numDroppedSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING AND CALL SITES" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tDistinct call sites." << endl;
+        {
+            Obj mX("sites", 1, &ta);  const Obj& X = mX;
+
+            // Three allocations along path 0, two along path 1, one along
+            // path 2 (all from the same line, so that only the paths differ),
+            // and one of 100 bytes directly.
+
+            const unsigned PATHS[] = { 0, 1, 0, 2, 1, 0 };
+            const int      NUM_PATHS = sizeof PATHS / sizeof *PATHS;
+
+            void *blocks[NUM_PATHS + 1];
+            for (int i = 0; i < NUM_PATHS; ++i) {
+                blocks[i] = allocateVia(&mX, PATHS[i], 2);
+            }
+            blocks[NUM_PATHS] = mX.allocate(100);
+
+            bsl::vector<CallSite> sites(&ta);
+            X.loadCallSites(&sites);
+
+            Int64 numSampled = 0;
+            for (bsl::size_t i = 0; i < sites.size(); ++i) {
+                ASSERTV(i, 0 <= sites[i].d_numFrames);
+                ASSERTV(i, sites[i].d_numFrames <= CallSite::k_MAX_FRAMES);
+                numSampled += sites[i].d_numAllocations;
+            }
+            ASSERT(7 == numSampled);
+
+#ifdef U_CAPTURES_CALL_STACKS
+            ASSERTV(sites.size(), 4 == sites.size());
+            if (4 == sites.size()) {
+                ASSERT(3   == sites[0].d_numAllocations);
+                ASSERT(24  == sites[0].d_numBytes);
+                ASSERT(24  == sites[0].d_numBytesInUse);
+                ASSERT(2   == sites[1].d_numAllocations);
+                ASSERT(16  == sites[1].d_numBytes);
+                ASSERT(1   == sites[2].d_numAllocations);
+                ASSERT(100 == sites[2].d_numBytes);
+                ASSERT(1   == sites[3].d_numAllocations);
+                ASSERT(8   == sites[3].d_numBytes);
+                for (int i = 0; i < 4; ++i) {
+                    ASSERTV(i, 0 < sites[i].d_numFrames);
+                }
+            }
+
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[2]);
+            X.loadCallSites(&sites);
+            ASSERT(8 == sites[0].d_numBytesInUse);
+            ASSERT(24 == sites[0].d_numBytes);
+#else
+            ASSERTV(sites.size(), 1 == sites.size());
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[2]);
+#endif
+
+            mX.deallocate(blocks[1]);
+            mX.deallocate(blocks[3]);
+            mX.deallocate(blocks[4]);
+            mX.deallocate(blocks[5]);
+            mX.deallocate(blocks[6]);
+
+            X.loadCallSites(&sites);
+            for (bsl::size_t i = 0; i < sites.size(); ++i) {
+                ASSERTV(i, 0 == sites[i].d_numBytesInUse);
+            }
+            ASSERT(0 == X.numDroppedSamples());
+
+            if (verbose) cout << "\tSelf-allocated result." << endl;
+
+            // The allocation of 'selfSites' itself may be a new call site.
+
+            bsl::vector<CallSite> selfSites(&mX);
+            X.loadCallSites(&selfSites);
+            ASSERT(sites.size()     <= selfSites.size());
+            ASSERT(sites.size() + 1 >= selfSites.size());
+        }
+
+#ifdef U_CAPTURES_CALL_STACKS
+        if (verbose) cout << "\tDropped samples." << endl;
+        {
+            Obj mX("dropped", 1, &ta);  const Obj& X = mX;
+
+            enum { k_DEPTH = 8 };
+
+            ASSERT(1 << k_DEPTH == Obj::k_MAX_CALL_SITES);
+
+            bsl::vector<void *> blocks(&ta);
+            for (int round = 0; round < 2; ++round) {
+                for (int path = 0; path < 1 << k_DEPTH; ++path) {
+                    blocks.push_back(allocateVia(&mX, path, k_DEPTH));
+                }
+            }
+            ASSERT(0 == X.numDroppedSamples());
+
+            blocks.push_back(mX.allocate(8));
+            ASSERT(1 == X.numDroppedSamples());
+
+            bsl::vector<CallSite> sites(&ta);
+            X.loadCallSites(&sites);
+            ASSERT(Obj::k_MAX_CALL_SITES == sites.size());
+            for (bsl::size_t i = 0; i < sites.size(); ++i) {
+                ASSERTV(i, 2 == sites[i].d_numAllocations);
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+        }
+#endif
+
+        if (verbose) cout << "\tSampling periods." << endl;
+        {
+            enum { k_NUM_BLOCKS = 16000 };
+
+            const int PERIODS[] = { 0, 1, 16 };
+            const int NUM_PERIODS = sizeof PERIODS / sizeof *PERIODS;
+
+            for (int pi = 0; pi < NUM_PERIODS; ++pi) {
+                const int PERIOD = PERIODS[pi];
+
+                Obj mX("periods", PERIOD, &ta);  const Obj& X = mX;
+
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    mX.deallocate(mX.allocate(1 + i % 64));
+                }
+
+                bsl::vector<CallSite> sites(&ta);
+                X.loadCallSites(&sites);
+
+                Int64 numSampled = 0;
+                for (bsl::size_t i = 0; i < sites.size(); ++i) {
+                    numSampled += sites[i].d_numAllocations;
+                }
+                if (veryVerbose) { T_ P_(PERIOD) P(numSampled) }
+
+                if (0 == PERIOD) {
+                    ASSERTV(numSampled, 0 == numSampled);
+                }
+                else {
+                    const Int64 EXPECTED = k_NUM_BLOCKS / PERIOD;
+                    ASSERTV(PERIOD, numSampled, EXPECTED / 2 <= numSampled);
+                    ASSERTV(PERIOD, numSampled, numSampled <= EXPECTED * 2);
+                }
+                ASSERTV(PERIOD, k_NUM_BLOCKS == X.numAllocations());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::vector<CallSite> sites(&ta);
+            ASSERT_PASS(X.loadCallSites(&sites));
+            ASSERT_FAIL(X.loadCallSites(0));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of at least the
+        //:   requested size, obtained from the underlying allocator, and
+        //:   'deallocate' returns it to the underlying allocator.
+        //:
+        //: 2 Allocating 0 bytes returns 0, and deallocating 0 has no effect,
+        //:   on the underlying allocator or on the profile.
+        //:
+        //: 3 The counts of allocations and deallocations, the bytes in use and
+        //:   in total, and the histograms of sizes and lifetimes are exact.
+        //:
+        //: 4 'sizedDeallocate' deallocates, and is profiled, as 'deallocate'.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, writing every byte of each, and
+        //:   verify the alignment of each block, the state of the underlying
+        //:   test allocator, and the profile, as the blocks are allocated and
+        //:   deallocated.  (C-1..4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void loadLifetimeHistogram(LatencyHistogramSnapshot *) const;
+        //   void loadSizeHistogram(LatencyHistogramSnapshot *result) const;
+        //   bsls::Types::Int64 numAllocations() const;
+        //   bsls::Types::Int64 numBytesInUse() const;
+        //   bsls::Types::Int64 numBytesTotal() const;
+        //   bsls::Types::Int64 numDeallocations() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX("allocate", 1, &ta);  const Obj& X = mX;
+
+            const Int64 INITIAL_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(INITIAL_BLOCKS == ta.numBlocksInUse());
+            ASSERT(0 == X.numAllocations());
+            ASSERT(0 == X.numDeallocations());
+
+            // The first allocation also creates the thread profile of this
+            // thread.
+
+            const Int64 PROFILE_BLOCKS = INITIAL_BLOCKS + 1;
+
+            void  *blocks[NUM_SIZES];
+            Int64  total = 0;
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                blocks[i] = mX.allocate(SIZE);
+                ASSERTV(SIZE, 0 == reinterpret_cast<bsls::Types::UintPtr>(
+                                                       blocks[i]) % MAX_ALIGN);
+                bsl::memset(blocks[i], 0xA5, SIZE);
+                total += SIZE;
+
+                ASSERTV(SIZE, PROFILE_BLOCKS + i + 1 == ta.numBlocksInUse());
+                ASSERTV(SIZE, i + 1 == X.numAllocations());
+                ASSERTV(SIZE, total == X.numBytesInUse());
+                ASSERTV(SIZE, total == X.numBytesTotal());
+                ASSERTV(SIZE, 0     == X.numDeallocations());
+            }
+
+            Snapshot sizes;
+            X.loadSizeHistogram(&sizes);
+            ASSERT(NUM_SIZES == sizes.count());
+            ASSERT(total     == sizes.sum());
+            ASSERT(1         == sizes.min());
+            ASSERT(100000    == sizes.max());
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int INDEX = bsls::LatencyHistogramUtil::bucketIndex(
+                                                                     SIZES[i]);
+                ASSERTV(SIZES[i], 0 < sizes.bucketCount(INDEX));
+            }
+
+            Snapshot lifetimes;
+            X.loadLifetimeHistogram(&lifetimes);
+            ASSERT(0 == lifetimes.count());
+
+            Int64 inUse = total;
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                if (i % 2) {
+                    mX.sizedDeallocate(blocks[i], SIZES[i]);
+                }
+                else {
+                    mX.deallocate(blocks[i]);
+                }
+                inUse -= SIZES[i];
+
+                ASSERTV(i, PROFILE_BLOCKS + NUM_SIZES - i - 1 ==
+                                                         ta.numBlocksInUse());
+                ASSERTV(i, i + 1     == X.numDeallocations());
+                ASSERTV(i, inUse     == X.numBytesInUse());
+                ASSERTV(i, total     == X.numBytesTotal());
+                ASSERTV(i, NUM_SIZES == X.numAllocations());
+            }
+
+            X.loadLifetimeHistogram(&lifetimes);
+            ASSERT(NUM_SIZES == lifetimes.count());
+            ASSERT(0 <= lifetimes.min());
+            ASSERT(lifetimes.min() <= lifetimes.max());
+
+            if (verbose) cout << "\tLifetimes are measured." << endl;
+
+            void *block = mX.allocate(1);
+            bsls::Stopwatch timer;
+            timer.start();
+            while (timer.elapsedTime() < 0.002) {
+            }
+            mX.deallocate(block);
+
+            X.loadLifetimeHistogram(&lifetimes);
+            ASSERTV(lifetimes.max(), 1000000 <= lifetimes.max());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The name and sampling period are those supplied, or 0 and
+        //:   'k_DEFAULT_SAMPLING_PERIOD' by default.
+        //:
+        //: 2 The profile is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied, and is returned to it at
+        //:   destruction.
+        //:
+        //: 3 A new allocator has an empty profile.
+        //:
+        //: 4 A negative sampling period is detected when assertions are
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Construct allocators with each constructor, and verify their
+        //:   attributes and the use of the underlying allocators.  (C-1..3)
+        //:
+        //: 2 Verify that a negative period is detected.  (C-4)
+        //
+        // Testing:
+        //   bdlma::ProfilingAllocator(bslma::Allocator *ba = 0);
+        //   bdlma::ProfilingAllocator(const char *name, *ba = 0);
+        //   bdlma::ProfilingAllocator(const char *name, int period, *ba = 0);
+        //   ~bdlma::ProfilingAllocator();
+        //   const char *name() const;
+        //   int samplingPeriod() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.name());
+            ASSERT(Obj::k_DEFAULT_SAMPLING_PERIOD == X.samplingPeriod());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+            ASSERT(0 == X.numAllocations());
+            ASSERT(0 == X.numDeallocations());
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesTotal());
+            ASSERT(0 == X.numDroppedSamples());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.name());
+            ASSERT(Obj::k_DEFAULT_SAMPLING_PERIOD == X.samplingPeriod());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX("named", &ta);  const Obj& X = mX;
+
+            ASSERT(0 == bsl::strcmp("named", X.name()));
+            ASSERT(Obj::k_DEFAULT_SAMPLING_PERIOD == X.samplingPeriod());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX("sampled", 7, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == bsl::strcmp("sampled", X.name()));
+            ASSERT(7 == X.samplingPeriod());
+            ASSERT(1 == ta.numBlocksInUse());
+
+            Obj mY(0, 0, &ta);  const Obj& Y = mY;
+
+            ASSERT(0 == Y.name());
+            ASSERT(0 == Y.samplingPeriod());
+            ASSERT(2 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal() - 1);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_PASS(Obj(0,  0, &ta));
+            ASSERT_FAIL(Obj(0, -1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a few blocks, and examine the profile.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX("breathing", 1, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(10);
+            void *q = mX.allocate(20);
+
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(2  == X.numAllocations());
+            ASSERT(30 == X.numBytesInUse());
+
+            mX.deallocate(p);
+
+            ASSERT(1  == X.numDeallocations());
+            ASSERT(20 == X.numBytesInUse());
+            ASSERT(30 == X.numBytesTotal());
+
+            bsl::vector<CallSite> sites(&ta);
+            X.loadCallSites(&sites);
+            ASSERT(1 <= sites.size());
+
+            mX.deallocate(q);
+
+            ASSERT(0 == X.numBytesInUse());
+
+            if (veryVerbose) X.print(cout);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD OF PROFILING
+        //
+        // Concerns:
+        //: 1 Measure the cost that profiling adds to each allocation and
+        //:   deallocation, relative to the allocator profiled.
+        //
+        // Plan:
+        //: 1 Time pairs of allocations and deallocations from the new-delete
+        //:   allocator, from a counting allocator, and from profiling
+        //:   allocators with sampling periods of 0, the default, and 1, each
+        //:   forwarding to the new-delete allocator, and print the mean cost
+        //:   of a pair and the overhead relative to the new-delete allocator.
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD OF PROFILING
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: OVERHEAD OF PROFILING" << endl
+             << "==================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 2000000;
+
+        bslma::Allocator *newDelete =
+                                  &bslma::NewDeleteAllocator::singleton();
+
+        bdlma::CountingAllocator counting(newDelete);
+        Obj                      unsampled(0, 0, newDelete);
+        Obj                      sampled(0, Obj::k_DEFAULT_SAMPLING_PERIOD,
+                                         newDelete);
+        Obj                      everything(0, 1, newDelete);
+
+        struct {
+            const char       *d_name;
+            bslma::Allocator *d_allocator_p;
+        } ALLOCATORS[] = {
+            { "new-delete",              newDelete   },
+            { "counting",                &counting   },
+            { "profiling (period 0)",    &unsampled  },
+            { "profiling (period 1024)", &sampled    },
+            { "profiling (period 1)",    &everything },
+        };
+        const int NUM_ALLOCATORS = sizeof ALLOCATORS / sizeof *ALLOCATORS;
+
+        timeAllocations(newDelete, NUM_ITERATIONS);  // warm up
+
+        double baseline = 0.0;
+        for (int i = 0; i < NUM_ALLOCATORS; ++i) {
+            const double NS = timeAllocations(ALLOCATORS[i].d_allocator_p,
+                                              NUM_ITERATIONS);
+            if (0 == i) {
+                baseline = NS;
+            }
+            printf("%-24s %8.1f ns/pair  %+7.1f ns\n",
+                   ALLOCATORS[i].d_name,
+                   NS,
+                   NS - baseline);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,116 @@
+// bslalg_bytehashutil.cpp                                            -*-C++-*-
+#include <bslalg_bytehashutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslalg_bytehashutil_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The mixing step of the hash multiplies two 64-bit words, each the
+// exclusive-or of 8 bytes of input with a secret constant (or with the state),
+// and folds the 128-bit product back to 64 bits by exclusive-or of its halves.
+// Each bit of the low-order half depends on the low-order bits of both
+// factors, and each bit of the high-order half on all the bits of both
+// factors, so that a single step diffuses every input bit into the state.
+// Mixing inputs longer than 48 bytes in three lanes (combined only at the end)
+// removes the dependency of each multiplication on its predecessor, so that
+// the multiplications of successive 16-byte blocks can be pipelined.
+//
+// Inputs of 4 to 16 bytes are read as two pairs of possibly overlapping 4-byte
+// words taken from each end of the input, and inputs of 17 to 48 bytes (and
+// the tail of longer inputs) end with the (possibly overlapping) last 16
+// bytes, so that no byte beyond the end of the input is ever read, and no
+// byte-at-a-time loop is required.  Since bytes may be read more than once,
+// the length of the input is mixed into the final step.
+//
+// The three-lane loop of 'ByteHashUtil::hash' mixes a 48-byte block only if
+// at least one byte follows it, so that the last 1 to 48 bytes of the input
+// are always mixed by 'ByteHashUtil_Imp::finish'.  'ByteHashAccumulator'
+// preserves this invariant by retaining a complete block until more bytes are
+// appended, and retains the last 16 bytes of each block that it mixes so that
+// 'finish' can read the (possibly overlapping) last 16 bytes of the input.
+
+namespace BloombergLP {
+namespace bslalg {
+
+                          // -----------------------
+                          // struct ByteHashUtil_Imp
+                          // -----------------------
+
+// CLASS DATA
+const ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::k_SECRET0;
+const ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::k_SECRET1;
+const ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::k_SECRET2;
+const ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::k_SECRET3;
+
+                         // -------------------------
+                         // class ByteHashAccumulator
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+void ByteHashAccumulator::appendSlow(const unsigned char *data,
+                                     native_std::size_t   numBytes)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(k_BLOCK_SIZE < d_numPending + numBytes);
+
+    d_length += numBytes;
+
+    unsigned char *const pending   = d_buffer + k_TAIL_SIZE;
+    const unsigned char *lastBlock = pending;
+
+    if (d_numPending) {
+        // Complete the pending block and mix it; at least one byte follows.
+
+        const native_std::size_t count = k_BLOCK_SIZE - d_numPending;
+
+        native_std::memcpy(pending + d_numPending, data, count);
+        data     += count;
+        numBytes -= count;
+
+        ByteHashUtil_Imp::mixBlock(d_lanes, pending);
+    }
+
+    while (numBytes > k_BLOCK_SIZE) {
+        ByteHashUtil_Imp::mixBlock(d_lanes, data);
+        lastBlock  = data;
+        data      += k_BLOCK_SIZE;
+        numBytes  -= k_BLOCK_SIZE;
+    }
+
+    // Retain the last 16 bytes of the most recently mixed block, then the
+    // remaining 1 to 48 bytes.  Note that, if 'lastBlock' is 'pending', the
+    // source and destination do not overlap.
+
+    native_std::memcpy(d_buffer,
+                       lastBlock + k_BLOCK_SIZE - k_TAIL_SIZE,
+                       k_TAIL_SIZE);
+    native_std::memcpy(pending, data, numBytes);
+    d_numPending = numBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,679 @@
+// bslalg_bytehashutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLALG_BYTEHASHUTIL
+#define INCLUDED_BSLALG_BYTEHASHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fast, high-quality hash function for byte sequences.
+//
+//@CLASSES:
+//  bslalg::ByteHashUtil: namespace for hashing contiguous byte sequences
+//  bslalg::ByteHashAccumulator: mechanism computing a hash value incrementally
+//  bslalg::ByteHashUtil_Imp: namespace for implementation primitives
+//
+//@SEE_ALSO: bslalg_hashutil, bslstl_hash
+//
+//@DESCRIPTION: This component provides a namespace class, 'ByteHashUtil',
+// containing functions that compute a 64-bit hash value of a contiguous
+// sequence of bytes, optionally parameterized by a 64-bit seed.  The hash
+// function is intended for use by hash containers keyed on strings (it is
+// used, for example, by 'bsl::hash<bsl::string>' and
+// 'bsl::hash<bslstl::StringRef>'), and is designed to be both fast and of high
+// quality:
+//
+//: o Every bit of the input affects every bit of the result with probability
+//:   close to one half (i.e., the function has good *avalanche*), so that any
+//:   subset of the bits of the result (e.g., the low-order bits used to select
+//:   a bucket) is well distributed, even for inputs that differ only slightly.
+//:
+//: o Long inputs are consumed 48 bytes at a time in three independent lanes,
+//:   each of which mixes 16 bytes using a single 64-by-64-bit multiplication
+//:   yielding a 128-bit product, so that the throughput on long inputs is
+//:   limited by the multiplier rather than by a chain of dependent
+//:   operations.  Inputs of at most 16 bytes are hashed without any loop.
+//:
+//: o The result depends only on the values of the bytes, and not on their
+//:   alignment, or on the endianness of the platform.
+//
+// The algorithm is based on 'wyhash' (see
+// https://github.com/wangyi-fudan/wyhash).  On platforms that provide a
+// native 128-bit product (64-bit GCC and Clang, and 64-bit MSVC) it is used;
+// on other platforms the product is computed from 32-bit partial products.
+//
+// This component also provides a mechanism class, 'ByteHashAccumulator', that
+// computes the same hash value incrementally: a sequence of calls to 'append'
+// followed by a call to 'hash' returns the value that 'ByteHashUtil::hash'
+// returns for the concatenation of the appended byte sequences (and the same
+// seed).  The accumulator allows the hash value of an object whose salient
+// attributes are not contiguous in memory (e.g., a 'struct' having a string
+// member) to be computed in a single pass, without first copying its
+// attributes into a contiguous buffer.
+//
+// Note that this function is *not* a cryptographic hash.  A *seed* (e.g.,
+// chosen randomly at process start-up) makes the hash values of a given set of
+// keys difficult to predict by an adversary who does not know the seed, but
+// should not be relied upon in lieu of a keyed cryptographic hash function.
+//
+// Also note that we reserve the right to change the values returned by the
+// functions of this component in future releases; hash values should not be
+// persisted or sent to other processes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing a String
+///- - - - - - - - - - - - - -
+// Suppose we want to store null-terminated strings in a hash table, and need
+// a hash value for each of them.  We hash the characters of each string
+// (without its terminating null character):
+//..
+//  const char *KEY = "The quick brown fox";
+//
+//  bsls::Types::Uint64 hash = bslalg::ByteHashUtil::hash(KEY, strlen(KEY));
+//..
+// The result depends only on the characters of the string, and not on its
+// address:
+//..
+//  char copy[32];
+//  strcpy(copy + 1, KEY);
+//  assert(hash == bslalg::ByteHashUtil::hash(copy + 1, strlen(KEY)));
+//..
+// Strings that differ by even a single bit are expected to have very different
+// hash values:
+//..
+//  copy[1] ^= 1;
+//  assert(hash != bslalg::ByteHashUtil::hash(copy + 1, strlen(KEY)));
+//..
+// Finally, we compute a hash value using a seed, which yields a different
+// value (with high probability) for each different seed:
+//..
+//  const bsls::Types::Uint64 SEED = 0x0123456789abcdefULL;
+//
+//  bsls::Types::Uint64 seeded = bslalg::ByteHashUtil::hash(KEY,
+//                                                          strlen(KEY),
+//                                                          SEED);
+//  assert(hash != seeded);
+//  assert(seeded == bslalg::ByteHashUtil::hash(KEY, strlen(KEY), SEED));
+//..
+//
+///Example 2: Hashing a Sequence of Fragments
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a key is held in several separate fragments.  We can compute
+// the hash value of the key, without first concatenating its fragments, by
+// appending each of them in turn to a 'ByteHashAccumulator':
+//..
+//  bslalg::ByteHashAccumulator accumulator;
+//
+//  accumulator.append("The quick", 9);
+//  accumulator.append(" brown", 6);
+//  accumulator.append(" fox", 4);
+//..
+// The result is the hash value of the concatenation of the fragments:
+//..
+//  assert(hash == accumulator.hash());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // 'size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // 'memcpy'
+#define INCLUDED_CSTRING
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLALG_BYTEHASHUTIL_INT128 1
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#define BSLALG_BYTEHASHUTIL_UMUL128 1
+#ifndef INCLUDED_INTRIN
+#include <intrin.h>
+#define INCLUDED_INTRIN
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                          // =======================
+                          // struct ByteHashUtil_Imp
+                          // =======================
+
+struct ByteHashUtil_Imp {
+    // This component-private 'struct' provides a namespace for the primitive
+    // operations from which the hash functions of 'ByteHashUtil' are built.
+
+    // TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // CLASS DATA
+    static const Uint64 k_SECRET0 = 0xa0761d6478bd642fULL;
+    static const Uint64 k_SECRET1 = 0xe7037ed1a0b428dbULL;
+    static const Uint64 k_SECRET2 = 0x8ebc6af09c88c6e3ULL;
+    static const Uint64 k_SECRET3 = 0x589965cc75374cc3ULL;
+        // Odd constants, each having 32 set bits, used to mix the input.
+
+    enum {
+        k_BLOCK_SIZE = 48  // number of bytes mixed per iteration of the
+                           // three-lane loop
+    };
+
+    // CLASS METHODS
+    static Uint64 finish(const unsigned char *end,
+                         native_std::size_t   remaining,
+                         Uint64               seed,
+                         Uint64               numBytes);
+        // Return the hash value of an input of the specified 'numBytes' bytes,
+        // more than 16, whose last (unmixed) 'remaining' bytes end at the
+        // specified 'end' address, given the specified 'seed' resulting from
+        // mixing its preceding bytes.  The behavior is undefined unless
+        // '1 <= remaining <= k_BLOCK_SIZE', and the 'max(remaining, 16)' bytes
+        // preceding 'end' are readable.
+
+    static Uint64 hashShort(const unsigned char *data,
+                            native_std::size_t   numBytes,
+                            Uint64               seed);
+        // Return the hash value of the specified 'numBytes' bytes at the
+        // specified 'data' address given the specified (scrambled) 'seed'.
+        // The behavior is undefined unless 'numBytes <= 16'.
+
+    static Uint64 mix(Uint64 a, Uint64 b);
+        // Return the exclusive-or of the high-order and low-order 64 bits of
+        // the 128-bit product of the specified 'a' and 'b'.
+
+    static void mixBlock(Uint64 *lanes, const unsigned char *data);
+        // Mix the 'k_BLOCK_SIZE' bytes at the specified 'data' address into
+        // the specified array of three 'lanes'.
+
+    static void multiply(Uint64 *low, Uint64 *high);
+        // Load into the specified 'low' and 'high' the low-order and
+        // high-order 64 bits, respectively, of the 128-bit product of the
+        // values initially held by 'low' and 'high'.
+
+    static void multiplyPortable(Uint64 *low, Uint64 *high);
+        // Load into the specified 'low' and 'high' the low-order and
+        // high-order 64 bits, respectively, of the 128-bit product of the
+        // values initially held by 'low' and 'high', computing the product
+        // from 32-bit partial products.  Note that this function is used by
+        // 'multiply' on platforms having no native 128-bit product, and is
+        // public for testing purposes only.
+
+    static Uint64 read3(const unsigned char *data, native_std::size_t length);
+        // Return a value formed from the first, middle, and last of the
+        // specified 'length' bytes at the specified 'data' address.  The
+        // behavior is undefined unless '1 <= length <= 3'.
+
+    static Uint64 read4(const unsigned char *data);
+        // Return the value of the 4 bytes at the specified 'data' address
+        // interpreted as an unsigned integer in little-endian byte order.
+
+    static Uint64 read8(const unsigned char *data);
+        // Return the value of the 8 bytes at the specified 'data' address
+        // interpreted as an unsigned integer in little-endian byte order.
+
+    static Uint64 scramble(Uint64 seed);
+        // Return the initial state of each lane for the specified 'seed'.
+};
+
+                            // ===================
+                            // struct ByteHashUtil
+                            // ===================
+
+struct ByteHashUtil {
+    // This 'struct' provides a namespace for functions computing a hash value
+    // of a contiguous sequence of bytes.
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 hash(const void         *data,
+                                    native_std::size_t  numBytes);
+    static bsls::Types::Uint64 hash(const void          *data,
+                                    native_std::size_t   numBytes,
+                                    bsls::Types::Uint64  seed);
+        // Return a 64-bit hash value of the specified 'numBytes' bytes
+        // starting at the specified 'data' address.  Optionally specify a
+        // 'seed' that perturbs the result, so that the same sequence of bytes
+        // hashed using different seeds yields unrelated values.  If 'seed' is
+        // not specified, 0 is used.  The behavior is undefined unless 'data'
+        // refers to at least 'numBytes' readable bytes ('data' may be null if
+        // 'numBytes' is 0).  Note that the result depends only on the values
+        // of the bytes (and 'seed'), and not on the alignment of 'data' or on
+        // the endianness of the platform.
+};
+
+                         // =========================
+                         // class ByteHashAccumulator
+                         // =========================
+
+class ByteHashAccumulator {
+    // This mechanism class computes the hash value of a sequence of bytes
+    // supplied in any number of fragments.  The value returned by 'hash' is
+    // the value that 'ByteHashUtil::hash' returns for the concatenation of all
+    // the bytes appended since construction (and the seed supplied at
+    // construction).  Bytes are mixed in 48-byte blocks as they arrive; at
+    // most one (incomplete or complete) block is retained between calls to
+    // 'append', together with the last 16 bytes of the most recently mixed
+    // block, from which 'hash' reads the (possibly overlapping) tail of the
+    // input.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    enum {
+        k_BLOCK_SIZE = 48,  // number of bytes mixed per iteration
+        k_TAIL_SIZE  = 16   // number of bytes of the previous block retained
+    };
+
+    // DATA
+    Uint64             d_lanes[3];     // state of each of the three lanes
+
+    unsigned char      d_buffer[k_TAIL_SIZE + k_BLOCK_SIZE];
+                                       // the last 16 bytes of the most
+                                       // recently mixed block, followed by the
+                                       // pending (unmixed) bytes
+
+    native_std::size_t d_numPending;   // number of pending bytes (at most
+                                       // 'k_BLOCK_SIZE')
+
+    Uint64             d_length;       // total number of bytes appended
+
+    // PRIVATE MANIPULATORS
+    void appendSlow(const unsigned char *data, native_std::size_t numBytes);
+        // Append the specified 'numBytes' bytes at the specified 'data'
+        // address to the sequence of bytes whose hash value this accumulator
+        // computes.  The behavior is undefined unless
+        // 'k_BLOCK_SIZE < d_numPending + numBytes'.
+
+  public:
+    // CREATORS
+    ByteHashAccumulator();
+    explicit ByteHashAccumulator(bsls::Types::Uint64 seed);
+        // Create an accumulator for the hash value of an empty sequence of
+        // bytes.  Optionally specify a 'seed' that perturbs the hash value
+        // as described for 'ByteHashUtil::hash'.  If 'seed' is not specified,
+        // 0 is used.
+
+    // ~ByteHashAccumulator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void append(const void *data, native_std::size_t numBytes);
+        // Append the specified 'numBytes' bytes at the specified 'data'
+        // address to the sequence of bytes whose hash value this accumulator
+        // computes.  The behavior is undefined unless 'data' refers to at
+        // least 'numBytes' readable bytes ('data' may be null if 'numBytes'
+        // is 0).
+
+    // ACCESSORS
+    bsls::Types::Uint64 hash() const;
+        // Return the value that 'ByteHashUtil::hash' returns for the
+        // concatenation of all the bytes appended to this accumulator, and
+        // the seed supplied at its construction.  Note that further bytes may
+        // be appended after calling this method.
+
+    bsls::Types::Uint64 length() const;
+        // Return the total number of bytes appended to this accumulator.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // struct ByteHashUtil_Imp
+                          // -----------------------
+
+// CLASS METHODS
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::finish(
+                                         const unsigned char *end,
+                                         native_std::size_t   remaining,
+                                         Uint64               seed,
+                                         Uint64               numBytes)
+{
+    BSLS_ASSERT_SAFE(end);
+    BSLS_ASSERT_SAFE(1 <= remaining && remaining <= k_BLOCK_SIZE);
+    BSLS_ASSERT_SAFE(16 < numBytes);
+
+    const unsigned char *p = end - remaining;
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(remaining > 16)) {
+        seed = mix(read8(p) ^ k_SECRET1, read8(p + 8) ^ seed);
+        p         += 16;
+        remaining -= 16;
+    }
+
+    // Mix the last 16 bytes of the input, which may overlap bytes that have
+    // already been mixed.
+
+    Uint64 a = read8(end - 16) ^ k_SECRET1;
+    Uint64 b = read8(end -  8) ^ seed;
+    multiply(&a, &b);
+
+    return mix(a ^ k_SECRET0 ^ numBytes, b ^ k_SECRET1);
+}
+
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::hashShort(
+                                         const unsigned char *data,
+                                         native_std::size_t   numBytes,
+                                         Uint64               seed)
+{
+    BSLS_ASSERT_SAFE(data || 0 == numBytes);
+    BSLS_ASSERT_SAFE(numBytes <= 16);
+
+    Uint64 a;
+    Uint64 b;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes >= 4)) {
+        // Read two (possibly overlapping) 4-byte words from each end.
+
+        const native_std::size_t offset = (numBytes >> 3) << 2;
+
+        a = read4(data) << 32 | read4(data + offset);
+        b = read4(data + numBytes - 4) << 32
+          | read4(data + numBytes - 4 - offset);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes > 0)) {
+        a = read3(data, numBytes);
+        b = 0;
+    }
+    else {
+        a = b = 0;
+    }
+
+    a ^= k_SECRET1;
+    b ^= seed;
+    multiply(&a, &b);
+
+    return mix(a ^ k_SECRET0 ^ numBytes, b ^ k_SECRET1);
+}
+
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::mix(Uint64 a, Uint64 b)
+{
+    multiply(&a, &b);
+    return a ^ b;
+}
+
+inline
+void ByteHashUtil_Imp::mixBlock(Uint64 *lanes, const unsigned char *data)
+{
+    BSLS_ASSERT_SAFE(lanes);
+    BSLS_ASSERT_SAFE(data);
+
+    lanes[0] = mix(read8(data)      ^ k_SECRET1, read8(data +  8) ^ lanes[0]);
+    lanes[1] = mix(read8(data + 16) ^ k_SECRET2, read8(data + 24) ^ lanes[1]);
+    lanes[2] = mix(read8(data + 32) ^ k_SECRET3, read8(data + 40) ^ lanes[2]);
+}
+
+inline
+void ByteHashUtil_Imp::multiply(Uint64 *low, Uint64 *high)
+{
+    BSLS_ASSERT_SAFE(low);
+    BSLS_ASSERT_SAFE(high);
+
+#if defined(BSLALG_BYTEHASHUTIL_INT128)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(*low) * *high;
+
+    *low  = static_cast<Uint64>(product);
+    *high = static_cast<Uint64>(product >> 64);
+#elif defined(BSLALG_BYTEHASHUTIL_UMUL128)
+    *low = _umul128(*low, *high, high);
+#else
+    multiplyPortable(low, high);
+#endif
+}
+
+inline
+void ByteHashUtil_Imp::multiplyPortable(Uint64 *low, Uint64 *high)
+{
+    BSLS_ASSERT_SAFE(low);
+    BSLS_ASSERT_SAFE(high);
+
+    const Uint64 a = *low;
+    const Uint64 b = *high;
+
+    const Uint64 aHigh = a >> 32, aLow = a & 0xffffffffULL;
+    const Uint64 bHigh = b >> 32, bLow = b & 0xffffffffULL;
+
+    const Uint64 hh = aHigh * bHigh;
+    const Uint64 hl = aHigh * bLow;
+    const Uint64 lh = aLow  * bHigh;
+    const Uint64 ll = aLow  * bLow;
+
+    const Uint64 t  = ll + (hl << 32);
+    Uint64       lo = t  + (lh << 32);
+
+    const Uint64 carry = (t < ll) + (lo < t);
+
+    *high = hh + (hl >> 32) + (lh >> 32) + carry;
+    *low  = lo;
+}
+
+inline
+ByteHashUtil_Imp::Uint64
+ByteHashUtil_Imp::read3(const unsigned char *data, native_std::size_t length)
+{
+    BSLS_ASSERT_SAFE(data);
+    BSLS_ASSERT_SAFE(1 <= length && length <= 3);
+
+    return static_cast<Uint64>(data[0]) << 16
+         | static_cast<Uint64>(data[length >> 1]) << 8
+         | data[length - 1];
+}
+
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::read4(const unsigned char *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    unsigned int value;
+    native_std::memcpy(&value, data, sizeof value);
+    return value;
+#else
+    return static_cast<Uint64>(data[0])
+         | static_cast<Uint64>(data[1]) <<  8
+         | static_cast<Uint64>(data[2]) << 16
+         | static_cast<Uint64>(data[3]) << 24;
+#endif
+}
+
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::read8(const unsigned char *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+    Uint64 value;
+    native_std::memcpy(&value, data, sizeof value);
+    return value;
+#else
+    return read4(data) | read4(data + 4) << 32;
+#endif
+}
+
+inline
+ByteHashUtil_Imp::Uint64 ByteHashUtil_Imp::scramble(Uint64 seed)
+{
+    return seed ^ mix(seed ^ k_SECRET0, k_SECRET1);
+}
+
+                            // -------------------
+                            // struct ByteHashUtil
+                            // -------------------
+
+// CLASS METHODS
+inline
+bsls::Types::Uint64 ByteHashUtil::hash(const void         *data,
+                                       native_std::size_t  numBytes)
+{
+    return hash(data, numBytes, 0);
+}
+
+inline
+bsls::Types::Uint64 ByteHashUtil::hash(const void          *data,
+                                       native_std::size_t   numBytes,
+                                       bsls::Types::Uint64  seed)
+{
+    BSLS_ASSERT_SAFE(data || 0 == numBytes);
+
+    typedef ByteHashUtil_Imp Imp;
+
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+
+    seed = Imp::scramble(seed);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numBytes <= 16)) {
+        return Imp::hashShort(p, numBytes, seed);                     // RETURN
+    }
+
+    native_std::size_t remaining = numBytes;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(remaining > Imp::k_BLOCK_SIZE)) {
+        // Mix 48 bytes per iteration in three independent lanes.
+
+        bsls::Types::Uint64 lanes[3] = { seed, seed, seed };
+        do {
+            Imp::mixBlock(lanes, p);
+            p         += Imp::k_BLOCK_SIZE;
+            remaining -= Imp::k_BLOCK_SIZE;
+        } while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                             remaining > Imp::k_BLOCK_SIZE));
+        seed = lanes[0] ^ lanes[1] ^ lanes[2];
+    }
+
+    return Imp::finish(p + remaining, remaining, seed, numBytes);
+}
+
+                         // -------------------------
+                         // class ByteHashAccumulator
+                         // -------------------------
+
+// CREATORS
+inline
+ByteHashAccumulator::ByteHashAccumulator()
+: d_numPending(0)
+, d_length(0)
+{
+    d_lanes[0] = d_lanes[1] = d_lanes[2] = ByteHashUtil_Imp::scramble(0);
+}
+
+inline
+ByteHashAccumulator::ByteHashAccumulator(bsls::Types::Uint64 seed)
+: d_numPending(0)
+, d_length(0)
+{
+    d_lanes[0] = d_lanes[1] = d_lanes[2] = ByteHashUtil_Imp::scramble(seed);
+}
+
+// MANIPULATORS
+inline
+void ByteHashAccumulator::append(const void         *data,
+                                 native_std::size_t  numBytes)
+{
+    BSLS_ASSERT_SAFE(data || 0 == numBytes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   d_numPending + numBytes <= k_BLOCK_SIZE)) {
+        if (numBytes) {
+            native_std::memcpy(d_buffer + k_TAIL_SIZE + d_numPending,
+                               data,
+                               numBytes);
+            d_numPending += numBytes;
+            d_length     += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    appendSlow(static_cast<const unsigned char *>(data), numBytes);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 ByteHashAccumulator::hash() const
+{
+    typedef ByteHashUtil_Imp Imp;
+
+    const unsigned char *pending = d_buffer + k_TAIL_SIZE;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_length <= 16)) {
+        // No block has been mixed, and the pending bytes are the entire input.
+
+        return Imp::hashShort(pending, d_numPending, d_lanes[0]);     // RETURN
+    }
+
+    // Note that, if any block has been mixed, the bytes preceding the pending
+    // bytes in 'd_buffer' are the last 16 bytes of the most recently mixed
+    // block; otherwise, all three lanes hold the scrambled seed.
+
+    return Imp::finish(pending + d_numPending,
+                       d_numPending,
+                       d_lanes[0] ^ d_lanes[1] ^ d_lanes[2],
+                       d_length);
+}
+
+inline
+bsls::Types::Uint64 ByteHashAccumulator::length() const
+{
+    return d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
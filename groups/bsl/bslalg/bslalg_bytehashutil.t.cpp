@@ -0,0 +1,1091 @@
+// bslalg_bytehashutil.t.cpp                                          -*-C++-*-
+#include <bslalg_bytehashutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a hash function over byte sequences,
+// built from a handful of primitives.  We first verify the primitives
+// directly, in particular that the portable 128-bit product agrees with the
+// native one.  We then verify the functional properties of the hash (it
+// depends on exactly the specified bytes and the seed, and not on alignment
+// or platform), and finally its statistical quality: avalanche, bucket
+// distribution for similar keys, and the absence of collisions.  A throughput
+// benchmark comparing the hash with the multiplicative string hashes it
+// replaces is provided as a negative test case.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] Uint64 hash(const void *data, size_t numBytes);
+// [ 3] Uint64 hash(const void *data, size_t numBytes, Uint64 seed);
+//
+// class ByteHashAccumulator
+// [ 5] ByteHashAccumulator();
+// [ 5] ByteHashAccumulator(Uint64 seed);
+// [ 5] void append(const void *data, size_t numBytes);
+// [ 5] Uint64 hash() const;
+// [ 5] Uint64 length() const;
+//
+// IMPLEMENTATION PRIMITIVES
+// [ 3] Uint64 ByteHashUtil_Imp::finish(const uchar *, size_t, Uint64, Uint64);
+// [ 3] Uint64 ByteHashUtil_Imp::hashShort(const uchar *, size_t, Uint64);
+// [ 3] void ByteHashUtil_Imp::mixBlock(Uint64 *, const unsigned char *);
+// [ 3] Uint64 ByteHashUtil_Imp::scramble(Uint64 seed);
+// [ 2] Uint64 ByteHashUtil_Imp::mix(Uint64 a, Uint64 b);
+// [ 2] void ByteHashUtil_Imp::multiply(Uint64 *low, Uint64 *high);
+// [ 2] void ByteHashUtil_Imp::multiplyPortable(Uint64 *, Uint64 *);
+// [ 2] Uint64 ByteHashUtil_Imp::read3(const unsigned char *, size_t);
+// [ 2] Uint64 ByteHashUtil_Imp::read4(const unsigned char *data);
+// [ 2] Uint64 ByteHashUtil_Imp::read8(const unsigned char *data);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] QUALITY: AVALANCHE, DISTRIBUTION, AND COLLISIONS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: THROUGHPUT
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::ByteHashUtil        Util;
+typedef bslalg::ByteHashUtil_Imp    Imp;
+typedef bslalg::ByteHashAccumulator Obj;
+typedef bsls::Types::Uint64      Uint64;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class Random {
+    // This class provides a deterministic generator of pseudo-random 64-bit
+    // values (using the 'splitmix64' algorithm), so that the inputs of the
+    // statistical tests are the same on every run and platform.
+
+    // DATA
+    Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(Uint64 seed)
+    : d_state(seed)
+    {
+    }
+
+    // MANIPULATORS
+    Uint64 next()
+    {
+        Uint64 z = (d_state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    void fill(unsigned char *buffer, int length)
+    {
+        for (int i = 0; i < length; ++i) {
+            buffer[i] = static_cast<unsigned char>(next() >> 56);
+        }
+    }
+};
+
+int countBits(Uint64 value)
+    // Return the number of set bits in the specified 'value'.
+{
+    int count = 0;
+    for (; value; value &= value - 1) {
+        ++count;
+    }
+    return count;
+}
+
+void multiplyReference(Uint64 *low, Uint64 *high)
+    // Load into the specified 'low' and 'high' the low-order and high-order
+    // 64 bits of the product of their initial values, computed by long
+    // multiplication one bit at a time.
+{
+    Uint64 a = *low;
+    Uint64 b = *high;
+
+    Uint64 resultLow = 0, resultHigh = 0;
+    Uint64 shiftedLow = a, shiftedHigh = 0;
+
+    for (int i = 0; i < 64; ++i) {
+        if (b & (1ULL << i)) {
+            const Uint64 sum = resultLow + shiftedLow;
+            resultHigh += shiftedHigh + (sum < resultLow);
+            resultLow   = sum;
+        }
+        shiftedHigh = shiftedHigh << 1 | shiftedLow >> 63;
+        shiftedLow <<= 1;
+    }
+    *low  = resultLow;
+    *high = resultHigh;
+}
+
+int compareUint64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Uint64' at the
+    // specified 'lhs' is less than, equal to, or greater than the one at the
+    // specified 'rhs', respectively.
+{
+    const Uint64 a = *static_cast<const Uint64 *>(lhs);
+    const Uint64 b = *static_cast<const Uint64 *>(rhs);
+    return a < b ? -1 : b < a ? 1 : 0;
+}
+
+double chiSquare(const int *buckets, int numBuckets, int numKeys)
+    // Return the chi-square statistic of the specified 'numBuckets' bucket
+    // counts at 'buckets' into which the specified 'numKeys' keys were
+    // distributed, with respect to a uniform distribution.
+{
+    const double expected = static_cast<double>(numKeys) / numBuckets;
+
+    double result = 0;
+    for (int i = 0; i < numBuckets; ++i) {
+        const double delta = buckets[i] - expected;
+        result += delta * delta / expected;
+    }
+    return result;
+}
+
+Uint64 multiplicativeHash(const char *data, int length)
+    // Return the hash of the specified 'length' characters at the specified
+    // 'data' computed as 'h = 5 * h + c' (formerly used by
+    // 'bsl::hash<bsl::string>'), for comparison.
+{
+    Uint64 h = 0;
+    for (int i = 0; i < length; ++i) {
+        h = 5 * h + data[i];
+    }
+    return h;
+}
+
+Uint64 lcgHash(const char *data, int length)
+    // Return the hash of the specified 'length' characters at the specified
+    // 'data' computed by a linear congruential step per character (formerly
+    // used by 'bsl::hash<bslstl::StringRef>'), for comparison.
+{
+    unsigned int r = 0;
+    for (int i = 0; i < length; ++i) {
+        r ^= data[i];
+        r = r * 1664525U + 1013904223U;
+    }
+    return r;
+}
+
+int makeKey(char *buffer, int index)
+    // Load into the specified 'buffer' a key, such as might name a security
+    // or a user, that is distinct for each distinct value of the specified
+    // 'index', and return the length of the key.
+{
+    return sprintf(buffer, "IBM US %d Equity", index);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing a String
+///- - - - - - - - - - - - - -
+// Suppose we want to store null-terminated strings in a hash table, and need
+// a hash value for each of them.  We hash the characters of each string
+// (without its terminating null character):
+//..
+    const char *KEY = "The quick brown fox";
+
+    bsls::Types::Uint64 hash = bslalg::ByteHashUtil::hash(KEY, strlen(KEY));
+//..
+// The result depends only on the characters of the string, and not on its
+// address:
+//..
+    char copy[32];
+    strcpy(copy + 1, KEY);
+    ASSERT(hash == bslalg::ByteHashUtil::hash(copy + 1, strlen(KEY)));
+//..
+// Strings that differ by even a single bit are expected to have very different
+// hash values:
+//..
+    copy[1] ^= 1;
+    ASSERT(hash != bslalg::ByteHashUtil::hash(copy + 1, strlen(KEY)));
+//..
+// Finally, we compute a hash value using a seed, which yields a different
+// value (with high probability) for each different seed:
+//..
+    const bsls::Types::Uint64 SEED = 0x0123456789abcdefULL;
+
+    bsls::Types::Uint64 seeded = bslalg::ByteHashUtil::hash(KEY,
+                                                            strlen(KEY),
+                                                            SEED);
+    ASSERT(hash != seeded);
+    ASSERT(seeded == bslalg::ByteHashUtil::hash(KEY, strlen(KEY), SEED));
+//..
+//
+///Example 2: Hashing a Sequence of Fragments
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a key is held in several separate fragments.  We can compute
+// the hash value of the key, without first concatenating its fragments, by
+// appending each of them in turn to a 'ByteHashAccumulator':
+//..
+    bslalg::ByteHashAccumulator accumulator;
+
+    accumulator.append("The quick", 9);
+    accumulator.append(" brown", 6);
+    accumulator.append(" fox", 4);
+//..
+// The result is the hash value of the concatenation of the fragments:
+//..
+    ASSERT(hash == accumulator.hash());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLASS 'ByteHashAccumulator'
+        //
+        // Concerns:
+        //: 1 The value returned by 'hash' is the value returned by
+        //:   'ByteHashUtil::hash' for the concatenation of the appended bytes
+        //:   and the seed supplied at construction (0 by default), however the
+        //:   bytes are divided among calls to 'append'.
+        //:
+        //: 2 In particular, the result is correct when the total length, or
+        //:   a fragment, is on either side of a 16- or 48-byte boundary, and
+        //:   when the tail of the input overlaps a block already mixed.
+        //:
+        //: 3 Appending zero bytes (with a null address) has no effect.
+        //:
+        //: 4 'hash' does not affect the state of the accumulator, so that more
+        //:   bytes may be appended after calling it.
+        //:
+        //: 5 'length' returns the total number of bytes appended.
+        //
+        // Plan:
+        //: 1 For each length from 0 to 300, and for each of several seeds,
+        //:   hash a pseudo-random sequence of that length using 'hash', and
+        //:   using an accumulator to which the bytes are appended all at
+        //:   once, one byte at a time, in fragments of every fixed size from 1
+        //:   to 100, and in fragments of pseudo-random size (interleaved with
+        //:   empty fragments).  Verify that the results are equal, and that
+        //:   'length' returns the length.  (C-1..3, 5)
+        //:
+        //: 2 Append the bytes of a sequence one at a time, and after each
+        //:   verify that 'hash' returns the hash value of the prefix appended
+        //:   so far.  (C-4)
+        //
+        // Testing:
+        //   ByteHashAccumulator();
+        //   ByteHashAccumulator(Uint64 seed);
+        //   void append(const void *data, size_t numBytes);
+        //   Uint64 hash() const;
+        //   Uint64 length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS 'ByteHashAccumulator'"
+                            "\n===========================\n");
+
+        enum { k_MAX_LENGTH = 300 };
+
+        unsigned char data[k_MAX_LENGTH];
+        Random        random(5);
+        for (int i = 0; i < k_MAX_LENGTH; ++i) {
+            data[i] = static_cast<unsigned char>(random.next());
+        }
+
+        const Uint64 SEEDS[] = { 0, 1, 0x0123456789abcdefULL, ~0ULL };
+        const int    NUM_SEEDS = static_cast<int>(sizeof SEEDS
+                                                  / sizeof *SEEDS);
+
+        if (verbose) printf("\nComparing with 'hash'.\n");
+
+        for (int si = 0; si < NUM_SEEDS; ++si) {
+            const Uint64 SEED = SEEDS[si];
+
+            for (int n = 0; n <= k_MAX_LENGTH; ++n) {
+                const Uint64 EXP = Util::hash(data, n, SEED);
+
+                if (0 == SEED) {
+                    Obj mX;  const Obj& X = mX;
+                    mX.append(data, n);
+                    ASSERTV(n, EXP == X.hash());
+                    ASSERTV(n, static_cast<Uint64>(n) == X.length());
+                }
+
+                {
+                    Obj mX(SEED);  const Obj& X = mX;
+                    mX.append(0, 0);
+                    mX.append(data, n);
+                    mX.append(0, 0);
+                    ASSERTV(si, n, EXP == X.hash());
+                }
+
+                for (int size = 1; size <= 100; ++size) {
+                    Obj mX(SEED);  const Obj& X = mX;
+                    for (int i = 0; i < n; i += size) {
+                        mX.append(data + i, size < n - i ? size : n - i);
+                    }
+                    ASSERTV(si, n, size, EXP == X.hash());
+                    ASSERTV(si, n, size, static_cast<Uint64>(n) == X.length());
+                }
+
+                for (int trial = 0; trial < 10; ++trial) {
+                    Obj mX(SEED);  const Obj& X = mX;
+                    for (int i = 0; i < n; ) {
+                        const int size = static_cast<int>(
+                                                       random.next() % 70);
+                        const int count = size < n - i ? size : n - i;
+                        mX.append(count ? data + i : 0, count);
+                        i += count;
+                    }
+                    ASSERTV(si, n, trial, EXP == X.hash());
+                }
+            }
+        }
+
+        if (verbose) printf("\nCalling 'hash' between calls to 'append'.\n");
+
+        for (int si = 0; si < NUM_SEEDS; ++si) {
+            const Uint64 SEED = SEEDS[si];
+
+            Obj mX(SEED);  const Obj& X = mX;
+            ASSERTV(si, Util::hash(data, 0, SEED) == X.hash());
+
+            for (int n = 1; n <= k_MAX_LENGTH; ++n) {
+                mX.append(data + n - 1, 1);
+                ASSERTV(si, n, Util::hash(data, n, SEED) == X.hash());
+                ASSERTV(si, n, static_cast<Uint64>(n) == X.length());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // QUALITY: AVALANCHE, DISTRIBUTION, AND COLLISIONS
+        //
+        // Concerns:
+        //: 1 Flipping any single bit of the input (or of the seed) flips each
+        //:   bit of the result with probability close to one half.
+        //:
+        //: 2 The low-order bits, and the high-order bits, of the hash values
+        //:   of a set of similar keys are uniformly distributed.
+        //:
+        //: 3 The hash values of a large set of similar keys are distinct.
+        //
+        // Plan:
+        //: 1 For each of a set of lengths covering every code path, hash
+        //:   pseudo-random inputs, and each input with each bit flipped in
+        //:   turn.  For each bit of the result, verify that the fraction of
+        //:   flips that changed it is in '[0.4 .. 0.6]', and that the mean
+        //:   number of result bits changed is close to 32.  Do the same for
+        //:   each bit of the seed.  (C-1)
+        //:
+        //: 2 Hash 2^16 keys that differ only in a decimal number, and
+        //:   distribute them into 1024 buckets using the low-order bits, and
+        //:   the high-order bits, of the hash.  Verify that the chi-square
+        //:   statistic is within 6 standard deviations of its expectation.
+        //:   For comparison, report the statistic for the multiplicative
+        //:   hash formerly used by 'bsl::hash<bsl::string>'.  (C-2)
+        //:
+        //: 3 Hash 2^20 similar keys, sort the hash values, and verify that
+        //:   they are distinct.  (C-3)
+        //
+        // Testing:
+        //   QUALITY: AVALANCHE, DISTRIBUTION, AND COLLISIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                      "\nQUALITY: AVALANCHE, DISTRIBUTION, AND COLLISIONS"
+                      "\n================================================\n");
+
+        if (verbose) printf("\tTesting avalanche.\n");
+        {
+            static const int LENGTHS[] = { 1, 2, 3, 4, 7, 8, 12, 16, 17, 32,
+                                           48, 49, 64, 97 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            enum { NUM_INPUTS = 100, MAX_LENGTH = 97 };
+
+            Random random(12345);
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                int    flipped[64] = { 0 };
+                int    numTrials   = 0;
+                double totalBits   = 0;
+
+                for (int i = 0; i < NUM_INPUTS; ++i) {
+                    unsigned char buffer[MAX_LENGTH];
+                    random.fill(buffer, LENGTH);
+                    const Uint64 SEED = random.next();
+
+                    const Uint64 H = Util::hash(buffer, LENGTH, SEED);
+
+                    for (int bit = 0; bit < LENGTH * 8; ++bit) {
+                        buffer[bit / 8] ^=
+                                   static_cast<unsigned char>(1 << bit % 8);
+                        const Uint64 DIFF = H ^ Util::hash(buffer,
+                                                           LENGTH,
+                                                           SEED);
+                        buffer[bit / 8] ^=
+                                   static_cast<unsigned char>(1 << bit % 8);
+
+                        for (int j = 0; j < 64; ++j) {
+                            flipped[j] += static_cast<int>(DIFF >> j & 1);
+                        }
+                        totalBits += countBits(DIFF);
+                        ++numTrials;
+                    }
+                }
+
+                const double MEAN = totalBits / numTrials;
+                if (veryVerbose) {
+                    T_ P_(LENGTH) P_(numTrials) P(MEAN)
+                }
+                ASSERTV(LENGTH, MEAN, 31 < MEAN && MEAN < 33);
+
+                for (int j = 0; j < 64; ++j) {
+                    const double FRACTION =
+                                 static_cast<double>(flipped[j]) / numTrials;
+                    ASSERTV(LENGTH, j, FRACTION,
+                            0.4 <= FRACTION && FRACTION <= 0.6);
+                }
+            }
+
+            // Flip each bit of the seed.
+
+            int    flipped[64] = { 0 };
+            double totalBits   = 0;
+
+            enum { NUM_SEEDS = 200 };
+
+            for (int i = 0; i < NUM_SEEDS; ++i) {
+                unsigned char buffer[24];
+                random.fill(buffer, sizeof buffer);
+                const Uint64 SEED = random.next();
+                const Uint64 H    = Util::hash(buffer, sizeof buffer, SEED);
+
+                for (int bit = 0; bit < 64; ++bit) {
+                    const Uint64 DIFF = H ^ Util::hash(buffer,
+                                                       sizeof buffer,
+                                                       SEED ^ 1ULL << bit);
+                    for (int j = 0; j < 64; ++j) {
+                        flipped[j] += static_cast<int>(DIFF >> j & 1);
+                    }
+                    totalBits += countBits(DIFF);
+                }
+            }
+
+            const double MEAN = totalBits / (NUM_SEEDS * 64);
+            ASSERTV(MEAN, 31 < MEAN && MEAN < 33);
+            for (int j = 0; j < 64; ++j) {
+                const double FRACTION =
+                          static_cast<double>(flipped[j]) / (NUM_SEEDS * 64);
+                ASSERTV(j, FRACTION, 0.4 <= FRACTION && FRACTION <= 0.6);
+            }
+        }
+
+        if (verbose) printf("\tTesting bucket distribution.\n");
+        {
+            enum { NUM_KEYS = 1 << 16, NUM_BUCKETS = 1024 };
+
+            // The chi-square statistic with 1023 degrees of freedom has mean
+            // 1023 and standard deviation 'sqrt(2 * 1023) ~= 45'.
+
+            const double LIMIT = 1023 + 6 * 45;
+
+            static int lowBuckets[NUM_BUCKETS];
+            static int highBuckets[NUM_BUCKETS];
+            static int oldBuckets[NUM_BUCKETS];
+            memset(lowBuckets,  0, sizeof lowBuckets);
+            memset(highBuckets, 0, sizeof highBuckets);
+            memset(oldBuckets,  0, sizeof oldBuckets);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                char      key[32];
+                const int LENGTH = makeKey(key, i);
+
+                const Uint64 H = Util::hash(key, LENGTH);
+                ++lowBuckets[H % NUM_BUCKETS];
+                ++highBuckets[H >> 54];
+                ++oldBuckets[multiplicativeHash(key, LENGTH) % NUM_BUCKETS];
+            }
+
+            const double LOW  = chiSquare(lowBuckets,  NUM_BUCKETS, NUM_KEYS);
+            const double HIGH = chiSquare(highBuckets, NUM_BUCKETS, NUM_KEYS);
+            const double OLD  = chiSquare(oldBuckets,  NUM_BUCKETS, NUM_KEYS);
+
+            if (verbose) {
+                T_ P_(LIMIT) P_(LOW) P_(HIGH) P(OLD)
+            }
+            ASSERTV(LOW,  LOW  < LIMIT);
+            ASSERTV(HIGH, HIGH < LIMIT);
+        }
+
+        if (verbose) printf("\tTesting collisions.\n");
+        {
+            enum { NUM_KEYS = 1 << 20 };
+
+            Uint64 *hashes = static_cast<Uint64 *>(
+                                         malloc(NUM_KEYS * sizeof(Uint64)));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                char key[32];
+                hashes[i] = Util::hash(key, makeKey(key, i));
+            }
+            qsort(hashes, NUM_KEYS, sizeof(Uint64), &compareUint64);
+
+            int numCollisions = 0;
+            for (int i = 1; i < NUM_KEYS; ++i) {
+                numCollisions += hashes[i - 1] == hashes[i];
+            }
+            ASSERTV(numCollisions, 0 == numCollisions);
+
+            free(hashes);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'hash'
+        //
+        // Concerns:
+        //: 1 The hash depends on the values of exactly the specified bytes,
+        //:   and not on the bytes before or after them, or on their alignment.
+        //:
+        //: 2 The hash of an empty sequence may be computed from a null
+        //:   pointer.
+        //:
+        //: 3 The hash depends on the length of the input, even when the
+        //:   additional bytes are zero.
+        //:
+        //: 4 The hash depends on the seed, and the overload taking no seed
+        //:   uses a seed of 0.
+        //:
+        //: 5 The hash values are the same on every platform.
+        //
+        // Plan:
+        //: 1 For every length in '[0 .. 300]' and every offset in '[0 .. 8)',
+        //:   copy the same pseudo-random bytes into a buffer at the offset,
+        //:   surrounded by different bytes, and verify that the hash is the
+        //:   same.  (C-1)
+        //:
+        //: 2 Hash a null pointer with length 0.  (C-2)
+        //:
+        //: 3 Verify that the hash values of all-zero inputs of lengths
+        //:   '[0 .. 300]' are distinct.  (C-3)
+        //:
+        //: 4 Compare hash values computed with different seeds.  (C-4)
+        //:
+        //: 5 Compare hash values of fixed inputs with values computed on a
+        //:   reference platform.  (C-5)
+        //
+        // Testing:
+        //   Uint64 hash(const void *data, size_t numBytes);
+        //   Uint64 hash(const void *data, size_t numBytes, Uint64 seed);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hash'"
+                            "\n==============\n");
+
+        enum { MAX_LENGTH = 300, MAX_OFFSET = 8 };
+
+        if (verbose) printf("\tTesting dependence on exactly the input.\n");
+        {
+            Random        random(54321);
+            unsigned char data[MAX_LENGTH];
+            random.fill(data, MAX_LENGTH);
+
+            for (int length = 0; length <= MAX_LENGTH; ++length) {
+                const Uint64 EXP = Util::hash(data, length);
+
+                for (int offset = 0; offset < MAX_OFFSET; ++offset) {
+                    unsigned char buffer[MAX_LENGTH + 2 * MAX_OFFSET];
+                    memset(buffer, offset, sizeof buffer);
+                    memcpy(buffer + offset, data, length);
+
+                    ASSERTV(length, offset,
+                            EXP == Util::hash(buffer + offset, length));
+
+                    memset(buffer, ~offset, offset);
+                    memset(buffer + offset + length,
+                           ~offset,
+                           sizeof buffer - offset - length);
+
+                    ASSERTV(length, offset,
+                            EXP == Util::hash(buffer + offset, length));
+                }
+
+                // Changing any byte of the input changes the hash.
+
+                for (int i = 0; i < length; ++i) {
+                    data[i] ^= 0x80;
+                    ASSERTV(length, i, EXP != Util::hash(data, length));
+                    data[i] ^= 0x80;
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting empty input.\n");
+        {
+            const char DATA[] = "x";
+
+            ASSERT(Util::hash(0, 0) == Util::hash(DATA, 0));
+            ASSERT(Util::hash(0, 0, 17) == Util::hash(DATA, 0, 17));
+            ASSERT(Util::hash(0, 0) != Util::hash(0, 0, 17));
+        }
+
+        if (verbose) printf("\tTesting dependence on length.\n");
+        {
+            unsigned char zeros[MAX_LENGTH] = { 0 };
+            Uint64        hashes[MAX_LENGTH + 1];
+
+            for (int length = 0; length <= MAX_LENGTH; ++length) {
+                hashes[length] = Util::hash(zeros, length);
+            }
+            qsort(hashes, MAX_LENGTH + 1, sizeof(Uint64), &compareUint64);
+            for (int i = 1; i <= MAX_LENGTH; ++i) {
+                ASSERTV(i, hashes[i - 1] != hashes[i]);
+            }
+        }
+
+        if (verbose) printf("\tTesting seeds.\n");
+        {
+            const char DATA[] = "0123456789abcdefghijklmnopqrstuvwxyz"
+                                "0123456789abcdefghijklmnopqrstuvwxyz";
+
+            for (int length = 0; length < 72; ++length) {
+                ASSERTV(length, Util::hash(DATA, length) ==
+                                                Util::hash(DATA, length, 0));
+
+                Uint64 hashes[64];
+                for (int i = 0; i < 64; ++i) {
+                    hashes[i] = Util::hash(DATA, length, 1ULL << i);
+                    ASSERTV(length, i, hashes[i] !=
+                                                Util::hash(DATA, length, 0));
+                }
+                qsort(hashes, 64, sizeof(Uint64), &compareUint64);
+                for (int i = 1; i < 64; ++i) {
+                    ASSERTV(length, i, hashes[i - 1] != hashes[i]);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting platform independence.\n");
+        {
+            const char INPUT[] = "The quick brown fox jumps over the lazy dog"
+                                 " while the zebra watches from a distance";
+
+            static const struct {
+                int    d_line;
+                int    d_length;
+                Uint64 d_seed;
+                Uint64 d_expected;
+            } DATA[] = {
+                //LINE  LEN  SEED                 EXPECTED
+                //----  ---  ----  ---------------------
+                { L_,     0,    0, 0x0409638ee2bde459ULL },
+                { L_,     1,    0, 0xf30049d0446bf2aeULL },
+                { L_,     3,    0, 0x0314c66b6405b584ULL },
+                { L_,     4,    0, 0x622646877058d82eULL },
+                { L_,     8,    0, 0x9d8f352881451a37ULL },
+                { L_,    16,    0, 0xc91b9e743a108f51ULL },
+                { L_,    17,    0, 0x57a5a9803eb39c82ULL },
+                { L_,    43,    0, 0x6303b3bade45a571ULL },
+                { L_,    48,    0, 0x96f4f51a2052ef08ULL },
+                { L_,    49,    0, 0x2468190fb58946cbULL },
+                { L_,    83,    0, 0x8830a6c2b4c2cb6eULL },
+                { L_,     0,   42, 0x72014e4eed7eeb7dULL },
+                { L_,    43,   42, 0x4f0e75ed5d33843dULL },
+                { L_,    83,   42, 0xb67d46bfa9f23861ULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const int    LENGTH = DATA[ti].d_length;
+                const Uint64 SEED   = DATA[ti].d_seed;
+                const Uint64 EXP    = DATA[ti].d_expected;
+
+                const Uint64 RESULT = Util::hash(INPUT, LENGTH, SEED);
+
+                if (veryVerbose) {
+                    printf("\t{ L_, %5d, %4d, 0x%016llxULL },\n",
+                           LENGTH,
+                           static_cast<int>(SEED),
+                           RESULT);
+                }
+                ASSERTV(LINE, EXP == RESULT);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING IMPLEMENTATION PRIMITIVES
+        //
+        // Concerns:
+        //: 1 'multiply' and 'multiplyPortable' compute the full 128-bit
+        //:   product of their arguments, including the carries between the
+        //:   32-bit partial products.
+        //:
+        //: 2 'mix' returns the exclusive-or of the halves of the product.
+        //:
+        //: 3 'read4' and 'read8' read unaligned little-endian values, and
+        //:   'read3' combines the first, middle, and last bytes.
+        //
+        // Plan:
+        //: 1 Compare the results of 'multiply' and 'multiplyPortable' with
+        //:   those of a bit-at-a-time reference multiplication, for a table
+        //:   of boundary values and for pseudo-random values.  (C-1..2)
+        //:
+        //: 2 Read values from a buffer of known bytes at each offset.  (C-3)
+        //
+        // Testing:
+        //   Uint64 ByteHashUtil_Imp::mix(Uint64 a, Uint64 b);
+        //   void ByteHashUtil_Imp::multiply(Uint64 *low, Uint64 *high);
+        //   void ByteHashUtil_Imp::multiplyPortable(Uint64 *, Uint64 *);
+        //   Uint64 ByteHashUtil_Imp::read3(const unsigned char *, size_t);
+        //   Uint64 ByteHashUtil_Imp::read4(const unsigned char *data);
+        //   Uint64 ByteHashUtil_Imp::read8(const unsigned char *data);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING IMPLEMENTATION PRIMITIVES"
+                            "\n=================================\n");
+
+        if (verbose) printf("\tTesting 'multiply' and 'mix'.\n");
+        {
+            static const Uint64 VALUES[] = {
+                0ULL,
+                1ULL,
+                2ULL,
+                0xffffffffULL,
+                0x100000000ULL,
+                0x1ffffffffULL,
+                0x7fffffffffffffffULL,
+                0x8000000000000000ULL,
+                0xfffffffeffffffffULL,
+                0xffffffff00000000ULL,
+                0xffffffffffffffffULL,
+                0xa0761d6478bd642fULL,
+                0xe7037ed1a0b428dbULL,
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            Random random(1);
+
+            for (int i = 0; i < NUM_VALUES + 1000; ++i) {
+                const Uint64 A = i < NUM_VALUES ? VALUES[i] : random.next();
+
+                for (int j = 0; j < NUM_VALUES + 10; ++j) {
+                    const Uint64 B = j < NUM_VALUES ? VALUES[j]
+                                                    : random.next();
+
+                    Uint64 expLow = A, expHigh = B;
+                    multiplyReference(&expLow, &expHigh);
+
+                    Uint64 low = A, high = B;
+                    Imp::multiply(&low, &high);
+                    ASSERTV(i, j, expLow == low);
+                    ASSERTV(i, j, expHigh == high);
+
+                    low = A;  high = B;
+                    Imp::multiplyPortable(&low, &high);
+                    ASSERTV(i, j, expLow == low);
+                    ASSERTV(i, j, expHigh == high);
+
+                    ASSERTV(i, j, (expLow ^ expHigh) == Imp::mix(A, B));
+                }
+            }
+
+            Uint64 low = 0xffffffffffffffffULL, high = low;
+            Imp::multiplyPortable(&low, &high);
+            ASSERT(1 == low);
+            ASSERT(0xfffffffffffffffeULL == high);
+        }
+
+        if (verbose) printf("\tTesting 'read3', 'read4', and 'read8'.\n");
+        {
+            unsigned char buffer[16];
+            for (int i = 0; i < 16; ++i) {
+                buffer[i] = static_cast<unsigned char>(0x11 * i + 1);
+            }
+
+            ASSERT(0x34231201ULL == Imp::read4(buffer));
+            ASSERT(0x7867564534231201ULL == Imp::read8(buffer));
+
+            for (int offset = 1; offset < 8; ++offset) {
+                const unsigned char *p = buffer + offset;
+
+                const Uint64 EXP4 = static_cast<Uint64>(p[0])
+                                  | static_cast<Uint64>(p[1]) << 8
+                                  | static_cast<Uint64>(p[2]) << 16
+                                  | static_cast<Uint64>(p[3]) << 24;
+                const Uint64 EXP8 = EXP4
+                                  | static_cast<Uint64>(p[4]) << 32
+                                  | static_cast<Uint64>(p[5]) << 40
+                                  | static_cast<Uint64>(p[6]) << 48
+                                  | static_cast<Uint64>(p[7]) << 56;
+
+                ASSERTV(offset, EXP4 == Imp::read4(p));
+                ASSERTV(offset, EXP8 == Imp::read8(p));
+            }
+
+            ASSERT(0x010101ULL == Imp::read3(buffer, 1));
+            ASSERT(0x011212ULL == Imp::read3(buffer, 2));
+            ASSERT(0x011223ULL == Imp::read3(buffer, 3));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Hash a few strings of various lengths, and verify that equal
+        //:   strings have equal hash values and different strings different
+        //:   ones.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        static const char *DATA[] = {
+            "",
+            "a",
+            "b",
+            "ab",
+            "ba",
+            "abcd",
+            "abcdefgh",
+            "abcdefghijklmnop",
+            "abcdefghijklmnopq",
+            "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Uint64 HI = Util::hash(DATA[i], strlen(DATA[i]));
+
+            if (veryVerbose) {
+                T_ P_(DATA[i]) P(HI)
+            }
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                char copy[80];
+                strcpy(copy, DATA[j]);
+
+                const Uint64 HJ = Util::hash(copy, strlen(copy));
+                ASSERTV(i, j, (i == j) == (HI == HJ));
+            }
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Measure the throughput of 'hash' for inputs of various lengths,
+        //:   and compare it with the byte-at-a-time string hashes it
+        //:   replaces.
+        //
+        // Plan:
+        //: 1 For each of a set of lengths from 4 bytes to 1MB, repeatedly hash
+        //:   an input of that length (approximately 256MB in total), and
+        //:   report the time per hash and the throughput in GB/s.
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: THROUGHPUT"
+               "\n=======================\n");
+
+        static const int LENGTHS[] = { 4, 8, 16, 24, 32, 64, 128, 256, 1024,
+                                       4096, 65536, 1 << 20 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int MAX_LENGTH = 1 << 20;
+        char *buffer = static_cast<char *>(malloc(MAX_LENGTH));
+        Random(7).fill(reinterpret_cast<unsigned char *>(buffer), MAX_LENGTH);
+
+        printf("%10s %12s %12s %12s %12s %12s %12s\n",
+               "length",
+               "hash ns",
+               "hash GB/s",
+               "5*h+c ns",
+               "5*h+c GB/s",
+               "lcg ns",
+               "lcg GB/s");
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+            const int ITERATIONS = (256 << 20) / LENGTH;
+
+            double times[3];
+            Uint64 checksum = 0;
+
+            for (int algorithm = 0; algorithm < 3; ++algorithm) {
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    // Vary the input so that the computation is not hoisted.
+
+                    const char *data = buffer + (i & 7);
+                    const int   n    = LENGTH - (i & 7 && LENGTH > 8 ? 1 : 0);
+
+                    switch (algorithm) {
+                      case 0: checksum += Util::hash(data, n);         break;
+                      case 1: checksum += multiplicativeHash(data, n); break;
+                      default: checksum += lcgHash(data, n);           break;
+                    }
+                }
+                timer.stop();
+                times[algorithm] = timer.elapsedTime();
+            }
+
+            printf("%10d", LENGTH);
+            for (int algorithm = 0; algorithm < 3; ++algorithm) {
+                const double NS   = times[algorithm] * 1e9 / ITERATIONS;
+                const double GBPS = static_cast<double>(LENGTH) / NS;
+                printf(" %12.2f %12.2f", NS, GBPS);
+            }
+            printf("   (%llu)\n", checksum);
+        }
+
+        free(buffer);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
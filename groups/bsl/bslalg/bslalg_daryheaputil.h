@@ -0,0 +1,449 @@
+// bslalg_daryheaputil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLALG_DARYHEAPUTIL
+#define INCLUDED_BSLALG_DARYHEAPUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide heap algorithms for heaps of arbitrary arity.
+//
+//@CLASSES:
+//  bslalg::DAryHeapUtil: namespace for algorithms on 'ARITY'-ary heaps
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslstl_radixheap
+//
+//@DESCRIPTION: This component provides a 'struct' template,
+// 'bslalg::DAryHeapUtil', parameterized by an 'ARITY', that serves as a
+// namespace for functions maintaining a heap in which every node has (up to)
+// 'ARITY' children, in the same way that 'std::make_heap', 'std::push_heap',
+// and 'std::pop_heap' maintain a binary heap.  The heap occupies a range of
+// random-access iterators, the children of the element at index 'i' are at
+// indices 'ARITY * i + 1' through 'ARITY * i + ARITY', and the first element
+// is a greatest element of the range according to the supplied comparator.
+//
+// A heap of 'N' elements with arity 'D' has a depth of approximately
+// 'log(N) / log(D)'.  Adding an element ('pushHeap') compares the element with
+// one ancestor per level, and so becomes cheaper as the arity increases;
+// removing the greatest element ('popHeap') compares up to 'D' siblings per
+// level, and so performs more comparisons in total as the arity increases.
+// When the heap does not fit in cache, however, the cost of 'popHeap' is
+// dominated by the number of levels visited rather than by the number of
+// comparisons: the 'D' children of a node are adjacent in memory, and, for
+// small 'D' and small elements, share one or two cache lines.  A 4-ary heap
+// of 'int' values therefore incurs approximately half the cache misses of a
+// binary heap per operation, while performing approximately the same number
+// of comparisons, and is the arity used by 'bsl::priority_queue'.
+//
+// Note that the heaps maintained by this component with an 'ARITY' other than
+// 2 are not (in general) heaps as understood by the standard algorithms, and
+// vice versa.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting the Largest Values of a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the three largest values of a sequence of integers, in
+// decreasing order.
+//
+// First, we arrange the values into a 4-ary heap:
+//..
+//  int values[] = { 17, 3, 42, 8, 23, 4, 15, 16 };
+//  const int NUM_VALUES = sizeof values / sizeof *values;
+//
+//  typedef bslalg::DAryHeapUtil<4> HeapUtil;
+//
+//  HeapUtil::makeHeap(values, values + NUM_VALUES, std::less<int>());
+//  assert(HeapUtil::isHeap(values, values + NUM_VALUES, std::less<int>()));
+//  assert(42 == values[0]);
+//..
+// Then, we remove the greatest value three times; each call to 'popHeap'
+// moves the greatest remaining value to the end of the shrinking heap:
+//..
+//  int *end = values + NUM_VALUES;
+//  for (int i = 0; i < 3; ++i, --end) {
+//      HeapUtil::popHeap(values, end, std::less<int>());
+//  }
+//..
+// Finally, we observe that the three largest values now occupy the last three
+// positions of the array, in increasing order:
+//..
+//  assert(17 == values[NUM_VALUES - 3]);
+//  assert(23 == values[NUM_VALUES - 2]);
+//  assert(42 == values[NUM_VALUES - 1]);
+//..
+// Note that the last position holds the first value removed.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_ITERATOR
+#include <iterator>
+#define INCLUDED_ITERATOR
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                            // ===================
+                            // struct DAryHeapUtil
+                            // ===================
+
+template <int ARITY>
+struct DAryHeapUtil {
+    // This 'struct' template provides a namespace for functions that create
+    // and maintain a heap, in which each node has up to the (template
+    // parameter) 'ARITY' children, within a range of random-access iterators.
+    // All functions take a 'comparator' that defines a strict weak ordering
+    // of the elements, and, as for the standard heap algorithms, the first
+    // element of a heap is one for which 'comparator' returns 'false' when
+    // invoked with that element as its first argument and any other element
+    // of the heap as its second.
+
+    BSLMF_ASSERT(2 <= ARITY);
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class RANDOM_ACCESS_ITERATOR,
+              class DISTANCE,
+              class VALUE,
+              class COMPARATOR>
+    static void siftDown(RANDOM_ACCESS_ITERATOR  first,
+                         DISTANCE                length,
+                         DISTANCE                hole,
+                         const VALUE&            value,
+                         COMPARATOR&             comparator);
+        // Move the specified 'value' into the range starting at the specified
+        // 'first' and having the specified 'length', at or below the
+        // specified 'hole' index, moving each greater child encountered one
+        // level up, so that the subtree rooted at 'hole' is a heap.  The
+        // behavior is undefined unless the subtrees rooted at each child of
+        // 'hole' are heaps.  Note that the element originally at 'hole' is
+        // overwritten.
+
+    template <class RANDOM_ACCESS_ITERATOR, class DISTANCE, class COMPARATOR>
+    static DISTANCE siftHoleToLeaf(RANDOM_ACCESS_ITERATOR  first,
+                                   DISTANCE                length,
+                                   DISTANCE                hole,
+                                   COMPARATOR&             comparator);
+        // Move the greatest child of the specified 'hole' index, in the range
+        // starting at the specified 'first' and having the specified
+        // 'length', into 'hole', and repeat with the vacated position of that
+        // child until a leaf is vacated, according to the specified
+        // 'comparator'; return the index of that leaf.  The behavior is
+        // undefined unless the subtrees rooted at each child of 'hole' are
+        // heaps.  Note that the element originally at 'hole' is overwritten,
+        // and that the element at the returned index is to be overwritten by
+        // the caller.
+
+    template <class RANDOM_ACCESS_ITERATOR,
+              class DISTANCE,
+              class VALUE,
+              class COMPARATOR>
+    static void siftUp(RANDOM_ACCESS_ITERATOR  first,
+                       DISTANCE                hole,
+                       const VALUE&            value,
+                       COMPARATOR&             comparator);
+        // Move the specified 'value' into the range starting at the specified
+        // 'first', at or above the specified 'hole' index, moving each lesser
+        // ancestor encountered one level down, so that the range ending at
+        // 'hole' (inclusive) is a heap.  The behavior is undefined unless the
+        // range '[first, first + hole)' is a heap.  Note that the element
+        // originally at 'hole' is overwritten.
+
+  public:
+    // CLASS METHODS
+    template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+    static bool isHeap(RANDOM_ACCESS_ITERATOR first,
+                       RANDOM_ACCESS_ITERATOR last,
+                       COMPARATOR             comparator);
+        // Return 'true' if the range '[first, last)' is a heap according to
+        // the specified 'comparator', and 'false' otherwise.  The behavior is
+        // undefined unless '[first, last)' is a valid range.
+
+    template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+    static void makeHeap(RANDOM_ACCESS_ITERATOR first,
+                         RANDOM_ACCESS_ITERATOR last,
+                         COMPARATOR             comparator);
+        // Rearrange the elements of the range '[first, last)' into a heap
+        // according to the specified 'comparator'.  This operation performs
+        // 'O[N]' comparisons, where 'N' is the length of the range.  The
+        // behavior is undefined unless '[first, last)' is a valid range.
+
+    template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+    static void popHeap(RANDOM_ACCESS_ITERATOR first,
+                        RANDOM_ACCESS_ITERATOR last,
+                        COMPARATOR             comparator);
+        // Move the first element of the heap '[first, last)' to 'last - 1',
+        // and rearrange the remaining elements into the heap
+        // '[first, last - 1)' according to the specified 'comparator'.  This
+        // operation performs 'O[ARITY * log(N) / log(ARITY)]' comparisons,
+        // where 'N' is the length of the range.  The behavior is undefined
+        // unless '[first, last)' is a non-empty heap according to
+        // 'comparator'.
+
+    template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+    static void pushHeap(RANDOM_ACCESS_ITERATOR first,
+                         RANDOM_ACCESS_ITERATOR last,
+                         COMPARATOR             comparator);
+        // Add the element at 'last - 1' to the heap '[first, last - 1)',
+        // rearranging the elements so that '[first, last)' is a heap according
+        // to the specified 'comparator'.  This operation performs
+        // 'O[log(N) / log(ARITY)]' comparisons, where 'N' is the length of the
+        // range.  The behavior is undefined unless '[first, last)' is a
+        // non-empty range and '[first, last - 1)' is a heap according to
+        // 'comparator'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct DAryHeapUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR,
+          class DISTANCE,
+          class VALUE,
+          class COMPARATOR>
+void DAryHeapUtil<ARITY>::siftDown(RANDOM_ACCESS_ITERATOR  first,
+                                   DISTANCE                length,
+                                   DISTANCE                hole,
+                                   const VALUE&            value,
+                                   COMPARATOR&             comparator)
+{
+    // The children of a node are compared with each other before the
+    // greatest of them is compared with 'value', so that a node having a full
+    // set of children is handled by a loop of fixed trip count.
+
+    DISTANCE firstChild = hole * ARITY + 1;
+    while (firstChild + ARITY <= length) {
+        DISTANCE greatest = firstChild;
+        for (DISTANCE i = firstChild + 1; i < firstChild + ARITY; ++i) {
+            if (comparator(first[greatest], first[i])) {
+                greatest = i;
+            }
+        }
+        if (!comparator(value, first[greatest])) {
+            first[hole] = value;
+            return;                                                   // RETURN
+        }
+        first[hole] = first[greatest];
+        hole        = greatest;
+        firstChild  = hole * ARITY + 1;
+    }
+
+    if (firstChild < length) {
+        // Only the last internal node may have fewer than 'ARITY' children,
+        // and those children are leaves.
+
+        DISTANCE greatest = firstChild;
+        for (DISTANCE i = firstChild + 1; i < length; ++i) {
+            if (comparator(first[greatest], first[i])) {
+                greatest = i;
+            }
+        }
+        if (comparator(value, first[greatest])) {
+            first[hole] = first[greatest];
+            hole        = greatest;
+        }
+    }
+    first[hole] = value;
+}
+
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR, class DISTANCE, class COMPARATOR>
+DISTANCE DAryHeapUtil<ARITY>::siftHoleToLeaf(
+                                           RANDOM_ACCESS_ITERATOR  first,
+                                           DISTANCE                length,
+                                           DISTANCE                hole,
+                                           COMPARATOR&             comparator)
+{
+    DISTANCE firstChild = hole * ARITY + 1;
+    while (firstChild + ARITY <= length) {
+        DISTANCE greatest = firstChild;
+        for (DISTANCE i = firstChild + 1; i < firstChild + ARITY; ++i) {
+            greatest = comparator(first[greatest], first[i]) ? i : greatest;
+        }
+        first[hole] = first[greatest];
+        hole        = greatest;
+        firstChild  = hole * ARITY + 1;
+    }
+
+    if (firstChild < length) {
+        DISTANCE greatest = firstChild;
+        for (DISTANCE i = firstChild + 1; i < length; ++i) {
+            greatest = comparator(first[greatest], first[i]) ? i : greatest;
+        }
+        first[hole] = first[greatest];
+        hole        = greatest;
+    }
+    return hole;
+}
+
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR,
+          class DISTANCE,
+          class VALUE,
+          class COMPARATOR>
+void DAryHeapUtil<ARITY>::siftUp(RANDOM_ACCESS_ITERATOR  first,
+                                 DISTANCE                hole,
+                                 const VALUE&            value,
+                                 COMPARATOR&             comparator)
+{
+    while (0 < hole) {
+        const DISTANCE parent = (hole - 1) / ARITY;
+        if (!comparator(first[parent], value)) {
+            break;
+        }
+        first[hole] = first[parent];
+        hole        = parent;
+    }
+    first[hole] = value;
+}
+
+// CLASS METHODS
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+bool DAryHeapUtil<ARITY>::isHeap(RANDOM_ACCESS_ITERATOR first,
+                                 RANDOM_ACCESS_ITERATOR last,
+                                 COMPARATOR             comparator)
+{
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::difference_type Distance;
+
+    const Distance length = last - first;
+    for (Distance i = 1; i < length; ++i) {
+        if (comparator(first[(i - 1) / ARITY], first[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+void DAryHeapUtil<ARITY>::makeHeap(RANDOM_ACCESS_ITERATOR first,
+                                   RANDOM_ACCESS_ITERATOR last,
+                                   COMPARATOR             comparator)
+{
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::difference_type Distance;
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::value_type      Value;
+
+    const Distance length = last - first;
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    // Heapify the subtrees rooted at each internal node, starting with the
+    // last internal node and proceeding towards the root.
+
+    for (Distance i = (length - 2) / ARITY; 0 <= i; --i) {
+        const Value value(first[i]);
+        siftDown(first, length, i, value, comparator);
+    }
+}
+
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+inline
+void DAryHeapUtil<ARITY>::popHeap(RANDOM_ACCESS_ITERATOR first,
+                                  RANDOM_ACCESS_ITERATOR last,
+                                  COMPARATOR             comparator)
+{
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::difference_type Distance;
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::value_type      Value;
+
+    BSLS_ASSERT_SAFE(first < last);
+
+    if (last - first < 2) {
+        return;                                                       // RETURN
+    }
+
+    // The element moved from the end of the heap to replace its first
+    // element is typically among the least, so the vacated first position is
+    // moved down to a leaf without comparing that element at each level, and
+    // the element is then moved up from that leaf, typically by a single
+    // level.
+
+    const Distance length = last - first - 1;
+    const Value    value(first[length]);
+    first[length] = *first;
+    siftUp(first,
+           siftHoleToLeaf(first, length, Distance(0), comparator),
+           value,
+           comparator);
+}
+
+template <int ARITY>
+template <class RANDOM_ACCESS_ITERATOR, class COMPARATOR>
+inline
+void DAryHeapUtil<ARITY>::pushHeap(RANDOM_ACCESS_ITERATOR first,
+                                   RANDOM_ACCESS_ITERATOR last,
+                                   COMPARATOR             comparator)
+{
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::difference_type Distance;
+    typedef typename native_std::iterator_traits<
+                             RANDOM_ACCESS_ITERATOR>::value_type      Value;
+
+    BSLS_ASSERT_SAFE(first < last);
+
+    if (last - first < 2) {
+        return;                                                       // RETURN
+    }
+
+    const Distance hole = last - first - 1;
+    const Value    value(first[hole]);
+    siftUp(first, hole, value, comparator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
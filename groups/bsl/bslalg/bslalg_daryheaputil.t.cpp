@@ -0,0 +1,770 @@
+// bslalg_daryheaputil.t.cpp                                          -*-C++-*-
+
+#include <bslalg_daryheaputil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility 'struct' template providing heap
+// algorithms parameterized by the arity of the heap.  The functions operate
+// on ranges of random-access iterators, so the tests use arrays of integers
+// (and of a simple 'struct' ordered by a comparator on one of its members),
+// and verify the heap property directly, by comparing each element with its
+// parent, independently of the 'isHeap' function under test.  Each function
+// is tested for several arities, including 2, for which the heap layout must
+// coincide with that of the standard heap algorithms.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool isHeap(ITER first, ITER last, COMP comparator);
+// [ 3] void pushHeap(ITER first, ITER last, COMP comparator);
+// [ 4] void popHeap(ITER first, ITER last, COMP comparator);
+// [ 5] void makeHeap(ITER first, ITER last, COMP comparator);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: binary heaps are compatible with the standard algorithms
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+
+enum { MAX_LENGTH = 100 };
+
+struct Record {
+    // This 'struct' is an element type ordered by its key alone, so that
+    // elements having equal keys remain distinguishable by their identifier.
+
+    int d_key;
+    int d_id;
+};
+
+struct RecordLess {
+    // This 'struct' is a comparator ordering 'Record' objects by key, that
+    // counts the comparisons it performs.
+
+    int *d_count_p;
+
+    explicit RecordLess(int *count) : d_count_p(count) {}
+
+    bool operator()(const Record& lhs, const Record& rhs) const
+    {
+        ++*d_count_p;
+        return lhs.d_key < rhs.d_key;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value in the
+    // range '[0, 65535]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 16) & 0xFFFF;
+}
+
+static void fillRandom(int *values, int length, int range, unsigned int seed)
+    // Load into the specified 'values' array, having the specified 'length',
+    // pseudo-random values in the range '[0, range)' generated from the
+    // specified 'seed'.
+{
+    for (int i = 0; i < length; ++i) {
+        values[i] = static_cast<int>(nextRandom(&seed) % range);
+    }
+}
+
+template <int ARITY, class TYPE, class COMPARATOR>
+bool verifyHeap(const TYPE *values, int length, COMPARATOR comparator)
+    // Return 'true' if no element of the specified 'values' array, having the
+    // specified 'length', compares greater, according to the specified
+    // 'comparator', than its parent in an 'ARITY'-ary heap, and 'false'
+    // otherwise.
+{
+    for (int i = 1; i < length; ++i) {
+        if (comparator(values[(i - 1) / ARITY], values[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+static bool isPermutation(const int *lhs, const int *rhs, int length)
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays, each having the
+    // specified 'length', hold the same values in any order, and 'false'
+    // otherwise.
+{
+    int sortedLhs[MAX_LENGTH];
+    int sortedRhs[MAX_LENGTH];
+    memcpy(sortedLhs, lhs, length * sizeof *lhs);
+    memcpy(sortedRhs, rhs, length * sizeof *rhs);
+    std::sort(sortedLhs, sortedLhs + length);
+    std::sort(sortedRhs, sortedRhs + length);
+    return 0 == memcmp(sortedLhs, sortedRhs, length * sizeof *lhs);
+}
+
+template <int ARITY>
+void testIsHeap()
+    // Verify 'DAryHeapUtil<ARITY>::isHeap' against 'verifyHeap' for arrays of
+    // every length up to 'MAX_LENGTH', both for heaps and for arrays in which
+    // exactly one element exceeds its parent.
+{
+    typedef bslalg::DAryHeapUtil<ARITY> Util;
+
+    std::less<int> less;
+
+    for (int length = 0; length <= MAX_LENGTH; ++length) {
+        int values[MAX_LENGTH];
+
+        // Every node of a strictly decreasing sequence is less than its
+        // parent.
+
+        for (int i = 0; i < length; ++i) {
+            values[i] = length - i;
+        }
+        ASSERTV(ARITY, length, Util::isHeap(values, values + length, less));
+
+        // Raising any single element above its parent violates the heap
+        // property at that element only.
+
+        for (int i = 1; i < length; ++i) {
+            const int saved = values[i];
+            values[i] = values[(i - 1) / ARITY] + 1;
+            ASSERTV(ARITY, length, i,
+                    !Util::isHeap(values, values + length, less));
+            ASSERTV(ARITY, length, i,
+                    !verifyHeap<ARITY>(values, length, less));
+            values[i] = saved;
+        }
+
+        // A constant sequence is a heap.
+
+        for (int i = 0; i < length; ++i) {
+            values[i] = 7;
+        }
+        ASSERTV(ARITY, length, Util::isHeap(values, values + length, less));
+    }
+}
+
+template <int ARITY>
+void testPushHeap()
+    // Verify that 'DAryHeapUtil<ARITY>::pushHeap' maintains a heap, holding
+    // the values pushed so far, whose first element is the greatest of them,
+    // for pseudo-random sequences of values having various numbers of
+    // duplicates.
+{
+    typedef bslalg::DAryHeapUtil<ARITY> Util;
+
+    std::less<int> less;
+
+    const int RANGES[] = { 1, 3, 10, 1000 };
+    const int NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+    for (int ri = 0; ri < NUM_RANGES; ++ri) {
+        const int RANGE = RANGES[ri];
+
+        int input[MAX_LENGTH];
+        fillRandom(input, MAX_LENGTH, RANGE, 1 + ri);
+
+        int heap[MAX_LENGTH];
+        int maximum = -1;
+        for (int length = 1; length <= MAX_LENGTH; ++length) {
+            heap[length - 1] = input[length - 1];
+            if (maximum < input[length - 1]) {
+                maximum = input[length - 1];
+            }
+            Util::pushHeap(heap, heap + length, less);
+
+            ASSERTV(ARITY, RANGE, length,
+                    verifyHeap<ARITY>(heap, length, less));
+            ASSERTV(ARITY, RANGE, length, maximum == heap[0]);
+            ASSERTV(ARITY, RANGE, length,
+                    isPermutation(heap, input, length));
+        }
+    }
+
+    // Pushing onto a heap compares the new element with at most one ancestor
+    // per level.
+
+    int count = 0;
+    Record records[MAX_LENGTH];
+    for (int length = 1; length <= MAX_LENGTH; ++length) {
+        records[length - 1].d_key = length;   // each new key is the greatest
+        records[length - 1].d_id  = length;
+
+        count = 0;
+        Util::pushHeap(records, records + length, RecordLess(&count));
+
+        int depth = 0;
+        for (int i = length - 1; 0 < i; i = (i - 1) / ARITY) {
+            ++depth;
+        }
+        ASSERTV(ARITY, length, count, depth, depth == count);
+        ASSERTV(ARITY, length, length == records[0].d_key);
+    }
+}
+
+template <int ARITY>
+void testPopHeap()
+    // Verify that repeated calls to 'DAryHeapUtil<ARITY>::popHeap' on a heap
+    // leave the heap well formed and move its elements, in decreasing order,
+    // to the end of the shrinking range, for pseudo-random sequences of
+    // values having various numbers of duplicates.
+{
+    typedef bslalg::DAryHeapUtil<ARITY> Util;
+
+    std::less<int> less;
+
+    const int RANGES[] = { 1, 3, 10, 1000 };
+    const int NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+    for (int ri = 0; ri < NUM_RANGES; ++ri) {
+        const int RANGE = RANGES[ri];
+
+        for (int length = 1; length <= MAX_LENGTH; ++length) {
+            int input[MAX_LENGTH];
+            fillRandom(input, length, RANGE, length + ri);
+
+            int heap[MAX_LENGTH];
+            for (int i = 1; i <= length; ++i) {
+                heap[i - 1] = input[i - 1];
+                Util::pushHeap(heap, heap + i, less);
+            }
+
+            for (int end = length; 0 < end; --end) {
+                Util::popHeap(heap, heap + end, less);
+                ASSERTV(ARITY, RANGE, length, end,
+                        verifyHeap<ARITY>(heap, end - 1, less));
+                if (1 < end) {
+                    ASSERTV(ARITY, RANGE, length, end,
+                            !less(heap[end - 1], heap[0]));
+                }
+            }
+
+            std::sort(input, input + length);
+            ASSERTV(ARITY, RANGE, length,
+                    0 == memcmp(input, heap, length * sizeof *heap));
+        }
+    }
+
+    // A heap of records having equal keys remains a permutation of its
+    // records as they are removed.
+
+    int count = 0;
+    Record records[MAX_LENGTH];
+    for (int i = 0; i < MAX_LENGTH; ++i) {
+        records[i].d_key = 0;
+        records[i].d_id  = i;
+    }
+    for (int end = MAX_LENGTH; 0 < end; --end) {
+        Util::popHeap(records, records + end, RecordLess(&count));
+    }
+    int seen[MAX_LENGTH] = { 0 };
+    for (int i = 0; i < MAX_LENGTH; ++i) {
+        ++seen[records[i].d_id];
+    }
+    for (int i = 0; i < MAX_LENGTH; ++i) {
+        ASSERTV(ARITY, i, 1 == seen[i]);
+    }
+}
+
+template <int ARITY>
+void testMakeHeap()
+    // Verify that 'DAryHeapUtil<ARITY>::makeHeap' rearranges arrays of every
+    // length up to 'MAX_LENGTH', holding increasing, decreasing, constant,
+    // and pseudo-random values, into heaps, using a number of comparisons
+    // linear in the length of the array.
+{
+    typedef bslalg::DAryHeapUtil<ARITY> Util;
+
+    for (int length = 0; length <= MAX_LENGTH; ++length) {
+        for (int pattern = 0; pattern < 4; ++pattern) {
+            int input[MAX_LENGTH];
+            switch (pattern) {
+              case 0: {
+                for (int i = 0; i < length; ++i) input[i] = i;
+              } break;
+              case 1: {
+                for (int i = 0; i < length; ++i) input[i] = length - i;
+              } break;
+              case 2: {
+                for (int i = 0; i < length; ++i) input[i] = 3;
+              } break;
+              default: {
+                fillRandom(input, length, 50, length);
+              } break;
+            }
+
+            Record records[MAX_LENGTH];
+            for (int i = 0; i < length; ++i) {
+                records[i].d_key = input[i];
+                records[i].d_id  = i;
+            }
+
+            int count = 0;
+            RecordLess comparator(&count);
+            Util::makeHeap(records, records + length, comparator);
+            const int numComparisons = count;
+
+            ASSERTV(ARITY, length, pattern,
+                    verifyHeap<ARITY>(records, length, comparator));
+            ASSERTV(ARITY, length, pattern, numComparisons,
+                    numComparisons <= 2 * length);
+
+            int heap[MAX_LENGTH];
+            for (int i = 0; i < length; ++i) {
+                heap[i] = records[i].d_key;
+                ASSERTV(ARITY, length, pattern, i,
+                        input[records[i].d_id] == records[i].d_key);
+            }
+            ASSERTV(ARITY, length, pattern,
+                    isPermutation(heap, input, length));
+
+            if (veryVerbose && MAX_LENGTH == length) {
+                P_(ARITY) P_(pattern) P(numComparisons)
+            }
+        }
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+                 verbose     = argc > 2;
+                 veryVerbose = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting the Largest Values of a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the three largest values of a sequence of integers, in
+// decreasing order.
+//
+// First, we arrange the values into a 4-ary heap:
+//..
+    int values[] = { 17, 3, 42, 8, 23, 4, 15, 16 };
+    const int NUM_VALUES = sizeof values / sizeof *values;
+
+    typedef bslalg::DAryHeapUtil<4> HeapUtil;
+
+    HeapUtil::makeHeap(values, values + NUM_VALUES, std::less<int>());
+    ASSERT(HeapUtil::isHeap(values, values + NUM_VALUES, std::less<int>()));
+    ASSERT(42 == values[0]);
+//..
+// Then, we remove the greatest value three times; each call to 'popHeap'
+// moves the greatest remaining value to the end of the shrinking heap:
+//..
+    int *end = values + NUM_VALUES;
+    for (int i = 0; i < 3; ++i, --end) {
+        HeapUtil::popHeap(values, end, std::less<int>());
+    }
+//..
+// Finally, we observe that the three largest values now occupy the last three
+// positions of the array, in increasing order:
+//..
+    ASSERT(17 == values[NUM_VALUES - 3]);
+    ASSERT(23 == values[NUM_VALUES - 2]);
+    ASSERT(42 == values[NUM_VALUES - 1]);
+//..
+// Note that the last position holds the first value removed.
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: BINARY HEAPS ARE COMPATIBLE WITH THE STANDARD ALGORITHMS
+        //
+        // Concerns:
+        //: 1 A heap created by 'DAryHeapUtil<2>' can be maintained by the
+        //:   standard heap algorithms, and vice versa.
+        //
+        // Plan:
+        //: 1 Create heaps of pseudo-random values with 'DAryHeapUtil<2>' and
+        //:   with 'std::make_heap', remove all values from each using the
+        //:   other implementation's 'pop' function, and verify that the
+        //:   values are removed in decreasing order.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: binary heaps are compatible with the standard algorithms
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                 "\nCONCERN: BINARY HEAPS ARE COMPATIBLE WITH THE STANDARD"
+                 "\n======================================================\n");
+
+        typedef bslalg::DAryHeapUtil<2> Util;
+
+        std::less<int> less;
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            int input[MAX_LENGTH];
+            fillRandom(input, length, 20, length);
+
+            int sorted[MAX_LENGTH];
+            memcpy(sorted, input, length * sizeof *input);
+            std::sort(sorted, sorted + length);
+
+            int heap[MAX_LENGTH];
+
+            memcpy(heap, input, length * sizeof *input);
+            Util::makeHeap(heap, heap + length, less);
+            for (int end = length; 0 < end; --end) {
+                std::pop_heap(heap, heap + end, less);
+            }
+            ASSERTV(length,
+                    0 == memcmp(sorted, heap, length * sizeof *heap));
+
+            memcpy(heap, input, length * sizeof *input);
+            std::make_heap(heap, heap + length, less);
+            ASSERTV(length, Util::isHeap(heap, heap + length, less));
+            for (int end = length; 0 < end; --end) {
+                Util::popHeap(heap, heap + end, less);
+            }
+            ASSERTV(length,
+                    0 == memcmp(sorted, heap, length * sizeof *heap));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'makeHeap'
+        //
+        // Concerns:
+        //: 1 'makeHeap' rearranges a range of any length, including 0 and 1,
+        //:   into a heap.
+        //:
+        //: 2 The range holds the same elements afterwards, each unmodified.
+        //:
+        //: 3 'makeHeap' performs a number of comparisons linear in the length
+        //:   of the range, regardless of the initial order of the range.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, 5, and 8, and for each length up to 100,
+        //:   apply 'makeHeap' to arrays of records holding increasing,
+        //:   decreasing, constant, and pseudo-random keys, and verify the
+        //:   heap property of the result.  (C-1)
+        //:
+        //: 2 Verify that each record still holds the key it was initialized
+        //:   with, and that the keys are a permutation of the input.  (C-2)
+        //:
+        //: 3 Count the comparisons performed, and verify that there are at
+        //:   most twice as many as there are elements.  (C-3)
+        //
+        // Testing:
+        //   void makeHeap(ITER first, ITER last, COMP comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'makeHeap'"
+                            "\n==========\n");
+
+        testMakeHeap<2>();
+        testMakeHeap<3>();
+        testMakeHeap<4>();
+        testMakeHeap<5>();
+        testMakeHeap<8>();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'popHeap'
+        //
+        // Concerns:
+        //: 1 'popHeap' moves a greatest element of the heap to the end of the
+        //:   range, and leaves the remaining elements a heap.
+        //:
+        //: 2 Repeatedly applying 'popHeap' to a shrinking heap sorts it.
+        //:
+        //: 3 Elements having equivalent keys are neither lost nor duplicated.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, 5, and 8, and for each length up to 100,
+        //:   build heaps of pseudo-random values drawn from ranges of various
+        //:   sizes, remove each element in turn, and verify, after each
+        //:   removal, that the remaining range is a heap and that the
+        //:   removed element is not less than the remaining greatest
+        //:   element.  (C-1)
+        //:
+        //: 2 Verify that the array is sorted once all elements are removed.
+        //:   (C-2)
+        //:
+        //: 3 Remove all records from a heap of records having equal keys, and
+        //:   verify that each record identifier appears exactly once.  (C-3)
+        //
+        // Testing:
+        //   void popHeap(ITER first, ITER last, COMP comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'popHeap'"
+                            "\n=========\n");
+
+        testPopHeap<2>();
+        testPopHeap<3>();
+        testPopHeap<4>();
+        testPopHeap<5>();
+        testPopHeap<8>();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'pushHeap'
+        //
+        // Concerns:
+        //: 1 'pushHeap' adds the last element of the range to the heap
+        //:   preceding it, so that the whole range is a heap whose first
+        //:   element is a greatest element.
+        //:
+        //: 2 The range holds the same elements afterwards.
+        //:
+        //: 3 'pushHeap' compares the new element with at most one element per
+        //:   level of the heap.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, 5, and 8, push pseudo-random values drawn
+        //:   from ranges of various sizes, one at a time, and verify after
+        //:   each push the heap property, the first element, and that the
+        //:   heap is a permutation of the values pushed.  (C-1..2)
+        //:
+        //: 2 Push records of increasing keys, so that each new record rises
+        //:   to the root, and verify that the number of comparisons equals
+        //:   the depth of the new element.  (C-3)
+        //
+        // Testing:
+        //   void pushHeap(ITER first, ITER last, COMP comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'pushHeap'"
+                            "\n==========\n");
+
+        testPushHeap<2>();
+        testPushHeap<3>();
+        testPushHeap<4>();
+        testPushHeap<5>();
+        testPushHeap<8>();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'isHeap'
+        //
+        // Concerns:
+        //: 1 'isHeap' returns 'true' for empty and single-element ranges.
+        //:
+        //: 2 'isHeap' returns 'true' if no element compares greater than its
+        //:   parent, including when elements compare equal, and 'false'
+        //:   otherwise.
+        //:
+        //: 3 The parent of each element is determined by the arity.
+        //
+        // Plan:
+        //: 1 For arities 2, 3, 4, 5, and 8, and for each length up to 100,
+        //:   verify that decreasing and constant arrays are heaps.
+        //:   (C-1..2)
+        //:
+        //: 2 Raise each element in turn above its parent in the heap of the
+        //:   arity under test, and verify that the array is then not a heap.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   bool isHeap(ITER first, ITER last, COMP comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'isHeap'"
+                            "\n========\n");
+
+        testIsHeap<2>();
+        testIsHeap<3>();
+        testIsHeap<4>();
+        testIsHeap<5>();
+        testIsHeap<8>();
+
+        // A heap of one arity is not, in general, a heap of another.
+
+        std::less<int> less;
+
+        int binary[] = { 9, 1, 8, 0, 0, 7 };
+        ASSERT( bslalg::DAryHeapUtil<2>::isHeap(binary, binary + 6, less));
+        ASSERT(!bslalg::DAryHeapUtil<4>::isHeap(binary, binary + 6, less));
+
+        int quaternary[] = { 9, 1, 2, 5, 6 };
+        ASSERT(!bslalg::DAryHeapUtil<2>::isHeap(quaternary,
+                                                quaternary + 5,
+                                                less));
+        ASSERT( bslalg::DAryHeapUtil<4>::isHeap(quaternary,
+                                                quaternary + 5,
+                                                less));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a 4-ary heap one element at a time, and remove its
+        //:   elements in decreasing order.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslalg::DAryHeapUtil<4> Util;
+
+        std::less<int> less;
+
+        int values[] = { 5, 1, 9, 3, 7, 2, 8 };
+        const int NUM_VALUES = sizeof values / sizeof *values;
+
+        for (int i = 1; i <= NUM_VALUES; ++i) {
+            Util::pushHeap(values, values + i, less);
+            ASSERT(Util::isHeap(values, values + i, less));
+        }
+        ASSERT(9 == values[0]);
+
+        for (int end = NUM_VALUES; 0 < end; --end) {
+            Util::popHeap(values, values + end, less);
+            ASSERT(Util::isHeap(values, values + end - 1, less));
+        }
+
+        const int EXP[] = { 1, 2, 3, 5, 7, 8, 9 };
+        ASSERT(0 == memcmp(EXP, values, sizeof values));
+
+        Util::makeHeap(values, values + NUM_VALUES, std::greater<int>());
+        ASSERT(1 == values[0]);
+        ASSERT(Util::isHeap(values, values + NUM_VALUES, std::greater<int>()));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
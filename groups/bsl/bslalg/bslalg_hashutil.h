@@ -12,11 +12,15 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslalg::HashUtil: utility for hash functions
 //
+//@SEE_ALSO: bslalg_bytehashutil
+//
 //@DESCRIPTION: This component provides a namespace class, 'HashUtil', for
 // hash functions.  At the current time it has one hash function,
 // 'HashUtil::computeHash', which will hash most fundamental types, and
-// pointers, rapidly.  Note that when a pointer is passed, only the bits in the
-// pointer itself are hashed, the memory the pointer refers to is not examined.
+// pointers, rapidly, and which is overloaded to hash a contiguous sequence of
+// bytes (optionally using a seed).  Note that when a pointer is passed, only
+// the bits in the pointer itself are hashed, the memory the pointer refers to
+// is not examined.
 //
 ///Usage
 ///-----
@@ -213,6 +217,10 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BYTEHASHUTIL
+#include <bslalg_bytehashutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_NATIVESTD
 #include <bsls_nativestd.h>
 #endif
@@ -255,12 +263,48 @@ struct HashUtil {
         // value -- when 'native_std::size_t' is 64 bits, the high-order 32
         // bits of the return value are all zero.  This is not a feature, it is
         // a bug that we will fix in a later release.
+
+    static native_std::size_t computeHash(const void         *data,
+                                          native_std::size_t  numBytes);
+    static native_std::size_t computeHash(const void          *data,
+                                          native_std::size_t   numBytes,
+                                          bsls::Types::Uint64  seed);
+        // Return a 'size_t' hash value of the specified 'numBytes' bytes
+        // starting at the specified 'data' address.  Optionally specify a
+        // 'seed' that perturbs the result.  If 'seed' is not specified, 0 is
+        // used.  The behavior is undefined unless 'data' refers to at least
+        // 'numBytes' readable bytes ('data' may be null if 'numBytes' is 0).
+        // Note that, unlike the functions above, these functions return a
+        // value using all of the bits of a 'size_t', computed by
+        // 'ByteHashUtil::hash' (see 'bslalg_bytehashutil').
 };
 
 // ===========================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+                        // ---------------
+                        // struct HashUtil
+                        // ---------------
+
+// CLASS METHODS
+inline
+native_std::size_t HashUtil::computeHash(const void         *data,
+                                         native_std::size_t  numBytes)
+{
+    return static_cast<native_std::size_t>(
+                                       ByteHashUtil::hash(data, numBytes, 0));
+}
+
+inline
+native_std::size_t HashUtil::computeHash(const void          *data,
+                                         native_std::size_t   numBytes,
+                                         bsls::Types::Uint64  seed)
+{
+    return static_cast<native_std::size_t>(
+                                    ByteHashUtil::hash(data, numBytes, seed));
+}
+
 }  // close namespace BloombergLP::bslalg
 }  // close namespace BloombergLP
 
@@ -37,7 +37,8 @@ using bslalg::HashUtil;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HASHING FUNDAMENTAL TYPES
-// [ 3] USAGE EXAMPLE
+// [ 3] HASHING BYTE SEQUENCES
+// [ 4] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -151,7 +152,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   This test is at the same time a usage example and a set of
@@ -300,6 +301,50 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING HASHING BYTE SEQUENCES
+        //
+        // Concerns:
+        //   The hash of a byte sequence is that computed by
+        //   'ByteHashUtil::hash', using all the bits of a 'size_t', and
+        //   depends on the seed.
+        //
+        // Plan:
+        //   Compare the return value with that of 'ByteHashUtil::hash' for
+        //   inputs of various lengths, with and without a seed.
+        //
+        // Testing:
+        //    HashUtil::computeHash(const void *, size_t);
+        //    HashUtil::computeHash(const void *, size_t, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASHING BYTE SEQUENCES"
+                            "\n======================\n");
+
+        const char DATA[] = "0123456789abcdefghijklmnopqrstuvwxyz"
+                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        native_std::size_t highBits = 0;
+
+        for (native_std::size_t n = 0; n < sizeof DATA; ++n) {
+            const native_std::size_t HASH = HashUtil::computeHash(DATA, n);
+
+            ASSERTV(n, HASH == static_cast<native_std::size_t>(
+                                      bslalg::ByteHashUtil::hash(DATA, n)));
+            ASSERTV(n, HASH == HashUtil::computeHash(DATA, n, 0));
+            ASSERTV(n, HASH != HashUtil::computeHash(DATA, n, 1));
+            ASSERTV(n, HashUtil::computeHash(DATA, n, 1) ==
+                       static_cast<native_std::size_t>(
+                                   bslalg::ByteHashUtil::hash(DATA, n, 1)));
+
+            highBits |= HASH >> (sizeof(native_std::size_t) * 8 - 8);
+        }
+
+        // The high-order bits of the results are used.
+
+        ASSERT(0 != highBits);
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING HASHING FUNDAMENTAL TYPES
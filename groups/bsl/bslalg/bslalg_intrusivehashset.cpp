@@ -0,0 +1,99 @@
+// bslalg_intrusivehashset.cpp                                        -*-C++-*-
+#include <bslalg_intrusivehashset.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_bslexceptionutil.h>
+
+namespace BloombergLP {
+namespace bslalg {
+
+                       // ---------------------------
+                       // struct IntrusiveHashSet_Util
+                       // ---------------------------
+
+// CLASS METHODS
+HashTableBucket *IntrusiveHashSet_Util::defaultBucketAddress()
+{
+    static HashTableBucket s_bucket = { 0, 0 };
+                                                  // Aggregate initialization
+                                                  // of a POD is thread-safe
+                                                  // static initialization
+
+    // Catch any set that writes to the shared bucket.
+
+    BSLS_ASSERT_SAFE(!s_bucket.first());
+    BSLS_ASSERT_SAFE(!s_bucket.last());
+
+    return &s_bucket;
+}
+
+native_std::size_t
+IntrusiveHashSet_Util::nextNumBuckets(native_std::size_t minNumBuckets)
+{
+    // Each prime is roughly twice its predecessor, as in 'bslstl_hashtable'.
+
+    static const native_std::size_t s_primes[] = { 2, 5, 13, 29, 61,
+        127, 257, 521, 1049, 2099, 4201, 8419, 16843, 33703, 67409, 134837,
+        269513, 539039, 1078081, 2156171, 5312353, 10624709, 21249443,
+        42498893, 84997793, 169995589, 339991181, 679982363, 1359964751,
+        2719929503u
+    };
+    static const int s_numPrimes = sizeof s_primes / sizeof *s_primes;
+
+    int low  = 0;
+    int high = s_numPrimes;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (s_primes[mid] < minNumBuckets) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    if (s_numPrimes == low) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+    return s_primes[low];
+}
+
+native_std::size_t
+IntrusiveHashSet_Util::capacity(native_std::size_t numBuckets,
+                                float              maxLoadFactor)
+{
+    BSLS_ASSERT_SAFE(0 < maxLoadFactor);
+
+    const double result = static_cast<double>(numBuckets) * maxLoadFactor;
+    return result < static_cast<double>(~native_std::size_t(0))
+           ? static_cast<native_std::size_t>(result)
+           : ~native_std::size_t(0);
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1156 @@
+// bslalg_intrusivehashset.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLALG_INTRUSIVEHASHSET
+#define INCLUDED_BSLALG_INTRUSIVEHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an unordered hash set of objects owned by the caller.
+//
+//@CLASSES:
+//  bslalg::IntrusiveHashSetHook: base class linking an object into a set
+//  bslalg::IntrusiveHashSet: hash set of objects linked through hooks
+//
+//@SEE_ALSO: bslalg_hashtableimputil, bslalg_intrusivelist,
+//           bslalg_intrusiverbtree
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslalg::IntrusiveHashSet', implementing a hash set of objects that are
+// created, owned, and destroyed by the caller, and a class template,
+// 'bslalg::IntrusiveHashSetHook', from which the type of those objects must
+// publicly derive.  The hook is a 'bslalg::BidirectionalLink', together with
+// the cached hash code of the element, so that the elements themselves are
+// the nodes of the set, which is maintained by 'bslalg::HashTableImpUtil'
+// using the same layout of a list threaded through an array of buckets as
+// 'bsl::unordered_set'.  An element can be removed from a set given only its
+// address, without hashing it or searching for it.
+//
+// A set allocates memory only for its array of buckets, and only when the
+// array must grow to keep the load factor (the number of elements per
+// bucket) at or below 'maxLoadFactor()'.  Therefore, a set whose buckets have
+// been sized by 'reserve' for the largest number of elements it will hold
+// never allocates memory, and the time taken by each insertion is bounded by
+// the cost of hashing the element and searching one bucket.  These properties
+// make an intrusive set suitable for structures, such as the index of live
+// orders by identifier in an order book, in which objects are frequently
+// inserted and removed and the latency of an allocation is not acceptable.
+//
+// The (template parameter) 'HASH' and 'EQUAL' types hash the elements and
+// compare them for equality, respectively, through methods that can be called
+// as if they had the signatures:
+//..
+//  native_std::size_t operator()(const TYPE& element) const;     // 'HASH'
+//  bool operator()(const TYPE& lhs, const TYPE& rhs) const;       // 'EQUAL'
+//..
+// The method template 'find' accepts a key of any type, 'KEY', for which
+// 'HASH' and 'EQUAL' provide methods that can be called as if they had the
+// signatures:
+//..
+//  native_std::size_t operator()(const KEY& key) const;          // 'HASH'
+//  bool operator()(const KEY& key, const TYPE& element) const;    // 'EQUAL'
+//..
+// where the hash of a key must equal the hash of any element equal to it, so
+// that elements can be looked up by a key (e.g., an identifier) without
+// creating an element to compare against.  A set holds at most one element of
+// each set of equal elements.
+//
+///Multiple Hooks
+///--------------
+// The (template parameter) 'TAG' of 'IntrusiveHashSetHook' and
+// 'IntrusiveHashSet' distinguishes the hooks of a type that is to be in
+// several sets at once, as described in 'bslalg_intrusivelist'.  A type can
+// also derive from the hooks of 'bslalg_intrusivelist' and
+// 'bslalg_intrusiverbtree'.
+//
+///Element Lifetime
+///----------------
+// The set does not own its elements.  The behavior is undefined if an element
+// is destroyed, or its hash code is changed, while it is in a set.  The
+// destructor of 'IntrusiveHashSet' removes (but does not destroy) any
+// elements remaining in the set.  Copying an element does not copy its links.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Live Orders by Identifier
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the orders of an order book are held in queues at their price
+// levels, and that we also need to find an order quickly by its identifier,
+// without allocating memory when an order arrives.
+//
+// First, we define an order type that derives from 'IntrusiveHashSetHook',
+// and functors that hash and compare orders, and also bare identifiers, by
+// identifier:
+//..
+//  struct Order : bslalg::IntrusiveHashSetHook<> {
+//      int d_id;
+//      int d_quantity;
+//
+//      Order(int id, int quantity) : d_id(id), d_quantity(quantity) {}
+//  };
+//
+//  struct OrderHash {
+//      native_std::size_t operator()(const Order& order) const
+//      {
+//          return (*this)(order.d_id);
+//      }
+//
+//      native_std::size_t operator()(int id) const
+//      {
+//          return static_cast<native_std::size_t>(id) * 2654435761u;
+//      }
+//  };
+//
+//  struct OrderEqual {
+//      bool operator()(const Order& lhs, const Order& rhs) const
+//      {
+//          return lhs.d_id == rhs.d_id;
+//      }
+//
+//      bool operator()(int id, const Order& order) const
+//      {
+//          return id == order.d_id;
+//      }
+//  };
+//..
+// Then, we create the index, and reserve room for the largest number of
+// orders we expect to be live at once, so that indexing an order will not
+// allocate memory:
+//..
+//  typedef bslalg::IntrusiveHashSet<Order, OrderHash, OrderEqual> Index;
+//
+//  bslma::TestAllocator ta;
+//  Index                index(&ta);
+//  index.reserve(1000);
+//
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//..
+// Next, we index some orders:
+//..
+//  Order a(17, 100), b(42, 200), c(99, 300);
+//
+//  bool isInserted;
+//  index.insertIfMissing(&isInserted, &a);
+//  assert(isInserted);
+//  index.insertIfMissing(&isInserted, &b);
+//  index.insertIfMissing(&isInserted, &c);
+//
+//  assert(3              == index.size());
+//  assert(numAllocations == ta.numAllocations());
+//..
+// Now, we find an order by its identifier alone:
+//..
+//  Index::iterator it = index.find(42);
+//  assert(&b == &*it);
+//  assert(index.end() == index.find(43));
+//..
+// Finally, an order is filled, and we remove it from the index knowing only
+// its address:
+//..
+//  index.remove(&a);
+//
+//  assert(false       == a.isLinked());
+//  assert(index.end() == index.find(17));
+//  assert(2           == index.size());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
+#include <bslalg_bidirectionallink.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_HASHTABLEANCHOR
+#include <bslalg_hashtableanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_HASHTABLEBUCKET
+#include <bslalg_hashtablebucket.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_HASHTABLEIMPUTIL
+#include <bslalg_hashtableimputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                         // ==========================
+                         // class IntrusiveHashSetHook
+                         // ==========================
+
+template <class TAG = void>
+class IntrusiveHashSetHook : public BidirectionalLink {
+    // This class provides the links, and the cached hash code, through which
+    // an object of a type publicly derived from it is held in an
+    // 'IntrusiveHashSet' having the same (template parameter) 'TAG'.  A hook
+    // that is not in a set is linked to itself as its own predecessor, which
+    // no hook in a set ever is.
+
+    // DATA
+    native_std::size_t d_hashCode;  // hash code of the element, set when the
+                                    // element is inserted into a set
+
+  public:
+    // CREATORS
+    IntrusiveHashSetHook();
+        // Create a hook that is not in a set.
+
+    IntrusiveHashSetHook(const IntrusiveHashSetHook& original);
+        // Create a hook that is not in a set.  Note that neither the links
+        // nor the hash code of the specified 'original' hook are copied.
+
+    //! ~IntrusiveHashSetHook() = default;
+        // Destroy this object.  The behavior is undefined unless this hook is
+        // not in a set.
+
+    // MANIPULATORS
+    IntrusiveHashSetHook& operator=(const IntrusiveHashSetHook& rhs);
+        // Leave this hook unchanged, whatever the value of the specified
+        // 'rhs', and return a reference providing modifiable access to this
+        // hook.
+
+    void setHashCode(native_std::size_t value);
+        // Set the cached hash code of this hook to the specified 'value'.
+        // Note that this method is intended for use by 'IntrusiveHashSet'
+        // only.
+
+    void unlink();
+        // Reset this hook to the state of a hook that is not in a set.  Note
+        // that this method does not remove this hook from the set (if any)
+        // holding it, and is intended for use by 'IntrusiveHashSet' only.
+
+    // ACCESSORS
+    native_std::size_t hashCode() const;
+        // Return the hash code of the element of this hook, as computed when
+        // it was inserted into the set holding it.  The behavior is undefined
+        // unless this hook is in a set.
+
+    bool isLinked() const;
+        // Return 'true' if this hook is in a set, and 'false' otherwise.
+};
+
+                       // ===========================
+                       // struct IntrusiveHashSet_Util
+                       // ===========================
+
+struct IntrusiveHashSet_Util {
+    // This 'struct' provides a namespace for the functions, independent of
+    // the template parameters of 'IntrusiveHashSet', that size its bucket
+    // array.
+
+    // CLASS METHODS
+    static HashTableBucket *defaultBucketAddress();
+        // Return the address of a shared, empty bucket, which serves as the
+        // bucket array of every set that has not yet allocated one.  The
+        // behavior is undefined if the returned bucket is modified.
+
+    static native_std::size_t nextNumBuckets(native_std::size_t minNumBuckets);
+        // Return the smallest supported number of buckets (a prime number)
+        // that is at least the specified 'minNumBuckets'.  Throw
+        // 'native_std::bad_alloc' if there is no such number.
+
+    static native_std::size_t capacity(native_std::size_t numBuckets,
+                                       float              maxLoadFactor);
+        // Return the largest number of elements that a bucket array of the
+        // specified 'numBuckets' can hold without exceeding the specified
+        // 'maxLoadFactor'.
+};
+
+                       // ===============================
+                       // class IntrusiveHashSet_Iterator
+                       // ===============================
+
+template <class VALUE, class TAG>
+class IntrusiveHashSet_Iterator {
+    // This class provides a forward iterator over an 'IntrusiveHashSet' of
+    // elements of the (template parameter) 'VALUE' type, which may be
+    // 'const'-qualified.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type   NcType;
+    typedef IntrusiveHashSet_Iterator<NcType, TAG> NcIter;
+    typedef IntrusiveHashSetHook<TAG>              Hook;
+
+    // DATA
+    BidirectionalLink *d_link_p;  // current position, or 0 at the end
+
+    // FRIENDS
+    template <class OTHER_VALUE, class OTHER_TAG>
+    friend class IntrusiveHashSet_Iterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                value_type;
+    typedef native_std::ptrdiff_t difference_type;
+    typedef VALUE                *pointer;
+    typedef VALUE&                reference;
+
+    // CREATORS
+    IntrusiveHashSet_Iterator();
+        // Create an iterator at the past-the-end position of any set.
+
+    explicit IntrusiveHashSet_Iterator(BidirectionalLink *link);
+        // Create an iterator at the specified 'link', which is the hook of
+        // an element or 0.
+
+    IntrusiveHashSet_Iterator(const NcIter& original);              // IMPLICIT
+        // Create an iterator at the same position as the specified
+        // 'original' iterator.  Note that this constructor enables converting
+        // from modifiable to 'const' iterator types.
+
+    // MANIPULATORS
+    IntrusiveHashSet_Iterator& operator++();
+        // Move this iterator to the next position in the set and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element.
+
+    IntrusiveHashSet_Iterator operator++(int);
+        // Move this iterator to the next position in the set and return its
+        // previous value.  The behavior is undefined unless this iterator
+        // refers to an element.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    BidirectionalLink *link() const;
+        // Return the address of the link at which this iterator is
+        // positioned, or 0 if it is at the past-the-end position.
+};
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+bool operator==(const IntrusiveHashSet_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveHashSet_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same position, and 'false' otherwise.
+
+template <class VALUE1, class VALUE2, class TAG>
+bool operator!=(const IntrusiveHashSet_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveHashSet_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer
+    // to the same position, and 'false' otherwise.
+
+                          // ======================
+                          // class IntrusiveHashSet
+                          // ======================
+
+template <class TYPE, class HASH, class EQUAL, class TAG = void>
+class IntrusiveHashSet {
+    // This class implements an unordered set of objects of the (template
+    // parameter) 'TYPE', which must publicly derive from
+    // 'IntrusiveHashSetHook<TAG>', hashed by the (template parameter) 'HASH'
+    // and compared by the (template parameter) 'EQUAL'.  The set links, but
+    // neither owns nor copies, its elements; it allocates memory only to grow
+    // its array of buckets.
+
+    // PRIVATE TYPES
+    typedef IntrusiveHashSetHook<TAG> Hook;
+    typedef IntrusiveHashSet_Util     Util;
+    typedef HashTableImpUtil          ImpUtil;
+
+    // DATA
+    HashTableAnchor     d_anchor;         // bucket array and list of elements
+    native_std::size_t  d_size;           // number of elements
+    native_std::size_t  d_capacity;       // number of elements the buckets
+                                          // hold before they must grow
+    float               d_maxLoadFactor;  // maximum elements per bucket
+    HASH                d_hasher;         // hashes elements and keys
+    EQUAL               d_comparator;     // compares elements and keys
+    bslma::Allocator   *d_allocator_p;    // supplies the bucket array (held)
+
+  private:
+    // NOT IMPLEMENTED
+    IntrusiveHashSet(const IntrusiveHashSet&);
+    IntrusiveHashSet& operator=(const IntrusiveHashSet&);
+
+    // PRIVATE CLASS METHODS
+    static BidirectionalLink *toLink(TYPE *object);
+        // Return the address of the hook of the specified 'object'.
+
+    static const TYPE& toValue(const BidirectionalLink *link);
+        // Return a reference to the element of which the specified 'link' is
+        // the hook.
+
+    // PRIVATE MANIPULATORS
+    void rehashImp(native_std::size_t minNumBuckets);
+        // Replace the bucket array of this set with a newly allocated one
+        // having at least the specified 'minNumBuckets' buckets, and relink
+        // the elements into it.  If an exception is thrown, this set is
+        // unchanged.
+
+    // PRIVATE ACCESSORS
+    HashTableBucket *bucketForHashCode(native_std::size_t hashCode) const;
+        // Return the address of the bucket of this set holding the elements
+        // having the specified 'hashCode'.
+
+    template <class KEY>
+    BidirectionalLink *findImp(const KEY&         key,
+                               native_std::size_t hashCode) const;
+        // Return the address of the hook of the element of this set equal to
+        // the specified 'key', having the specified 'hashCode', or 0 if there
+        // is no such element.
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE                                       value_type;
+    typedef TYPE&                                      reference;
+    typedef const TYPE&                                const_reference;
+    typedef native_std::size_t                         size_type;
+    typedef IntrusiveHashSet_Iterator<TYPE, TAG>       iterator;
+    typedef IntrusiveHashSet_Iterator<const TYPE, TAG> const_iterator;
+
+    // CREATORS
+    explicit IntrusiveHashSet(bslma::Allocator *basicAllocator = 0);
+    IntrusiveHashSet(const HASH&         hash,
+                     const EQUAL&        equal,
+                     native_std::size_t  initialNumBuckets = 0,
+                     bslma::Allocator   *basicAllocator = 0);
+        // Create an empty set.  Optionally specify the 'hash' and 'equal'
+        // functors; if they are not specified, default-constructed objects of
+        // the (template parameter) types 'HASH' and 'EQUAL' are used.
+        // Optionally specify 'initialNumBuckets', the minimum number of
+        // buckets of the set; if 'initialNumBuckets' is not specified or is 0,
+        // no memory is allocated until the first insertion.  Optionally
+        // specify a 'basicAllocator' used to supply memory for the bucket
+        // array.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ~IntrusiveHashSet();
+        // Remove all elements from this set, and destroy it.  Note that the
+        // elements themselves are not destroyed.
+
+    // MANIPULATORS
+    iterator begin();
+        // Return an iterator at the first element of this set, or 'end()' if
+        // this set is empty.
+
+    iterator end();
+        // Return an iterator at the past-the-end position of this set.
+
+    iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+        // Insert the specified 'object' into this set if it holds no element
+        // equal to 'object', and load 'true' into the specified
+        // 'isInsertedFlag' in that case, and 'false' otherwise.  Return an
+        // iterator at 'object' if it is inserted, and at the equal element
+        // otherwise.  Allocate memory only if inserting 'object' would make
+        // the load factor exceed 'maxLoadFactor()', in which case the bucket
+        // array grows.  If an exception is thrown, this set is unchanged.
+        // The behavior is undefined unless 'object' is not in a set through
+        // 'IntrusiveHashSetHook<TAG>'.
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this set in
+        // constant time, and return an iterator at the element that followed
+        // it.  The behavior is undefined unless 'position' refers to an
+        // element of this set.
+
+    void remove(TYPE *object);
+        // Remove the specified 'object' from this set in constant time,
+        // without hashing it.  The behavior is undefined unless 'object' is
+        // an element of this set.
+
+    void removeAll();
+        // Remove all elements from this set in O(N) time, where 'N' is the
+        // number of elements, retaining the bucket array.  Note that the
+        // elements are not destroyed.
+
+    void rehash(native_std::size_t numBuckets);
+        // Grow the bucket array of this set, if necessary, so that it has at
+        // least the specified 'numBuckets' buckets, and enough buckets to
+        // hold the elements of this set without exceeding
+        // 'maxLoadFactor()'.  If an exception is thrown, this set is
+        // unchanged.
+
+    void reserve(native_std::size_t numElements);
+        // Grow the bucket array of this set, if necessary, so that it can
+        // hold the specified 'numElements' elements without exceeding
+        // 'maxLoadFactor()', so that inserting elements while this set has no
+        // more than 'numElements' elements will not allocate memory.  If an
+        // exception is thrown, this set is unchanged.
+
+    void setMaxLoadFactor(float value);
+        // Set the maximum load factor of this set to the specified 'value',
+        // growing the bucket array if the current load factor exceeds
+        // 'value'.  If an exception is thrown, this set is unchanged.  The
+        // behavior is undefined unless '0 < value'.
+
+    void swap(IntrusiveHashSet& other);
+        // Exchange the elements, bucket array, maximum load factor, and
+        // functors of this set with those of the specified 'other' set.  The
+        // behavior is undefined unless this set and 'other' have the same
+        // allocator.
+
+    iterator iteratorTo(TYPE *object);
+        // Return an iterator at the specified 'object'.  The behavior is
+        // undefined unless 'object' is an element of this set.
+
+    template <class KEY>
+    iterator find(const KEY& key);
+        // Return an iterator at the element of this set equal to the
+        // specified 'key', or 'end()' if there is no such element.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator at the first element of this set, or 'end()' if
+        // this set is empty.
+
+    const_iterator end() const;
+        // Return an iterator at the past-the-end position of this set.
+
+    template <class KEY>
+    const_iterator find(const KEY& key) const;
+        // Return an iterator at the element of this set equal to the
+        // specified 'key', or 'end()' if there is no such element.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory for its
+        // bucket array.
+
+    const EQUAL& comparator() const;
+        // Return a reference to the functor comparing elements (and keys) of
+        // this set for equality.
+
+    const HASH& hasher() const;
+        // Return a reference to the functor hashing elements (and keys) of
+        // this set.
+
+    bool isEmpty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    float loadFactor() const;
+        // Return the number of elements of this set divided by its number of
+        // buckets.
+
+    float maxLoadFactor() const;
+        // Return the maximum load factor of this set, beyond which the bucket
+        // array grows.
+
+    size_type numBuckets() const;
+        // Return the number of buckets of this set.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class IntrusiveHashSetHook
+                         // --------------------------
+
+// CREATORS
+template <class TAG>
+inline
+IntrusiveHashSetHook<TAG>::IntrusiveHashSetHook()
+: d_hashCode(0)
+{
+    unlink();
+}
+
+template <class TAG>
+inline
+IntrusiveHashSetHook<TAG>::IntrusiveHashSetHook(const IntrusiveHashSetHook&)
+: BidirectionalLink()
+, d_hashCode(0)
+{
+    unlink();
+}
+
+// MANIPULATORS
+template <class TAG>
+inline
+IntrusiveHashSetHook<TAG>&
+IntrusiveHashSetHook<TAG>::operator=(const IntrusiveHashSetHook&)
+{
+    return *this;
+}
+
+template <class TAG>
+inline
+void IntrusiveHashSetHook<TAG>::setHashCode(native_std::size_t value)
+{
+    d_hashCode = value;
+}
+
+template <class TAG>
+inline
+void IntrusiveHashSetHook<TAG>::unlink()
+{
+    setPreviousLink(this);
+    setNextLink(0);
+}
+
+// ACCESSORS
+template <class TAG>
+inline
+native_std::size_t IntrusiveHashSetHook<TAG>::hashCode() const
+{
+    return d_hashCode;
+}
+
+template <class TAG>
+inline
+bool IntrusiveHashSetHook<TAG>::isLinked() const
+{
+    return this != previousLink();
+}
+
+                       // -------------------------------
+                       // class IntrusiveHashSet_Iterator
+                       // -------------------------------
+
+// CREATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveHashSet_Iterator<VALUE, TAG>::IntrusiveHashSet_Iterator()
+: d_link_p(0)
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveHashSet_Iterator<VALUE, TAG>::IntrusiveHashSet_Iterator(
+                                                       BidirectionalLink *link)
+: d_link_p(link)
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveHashSet_Iterator<VALUE, TAG>::IntrusiveHashSet_Iterator(
+                                                       const NcIter& original)
+: d_link_p(original.d_link_p)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveHashSet_Iterator<VALUE, TAG>&
+IntrusiveHashSet_Iterator<VALUE, TAG>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_link_p);
+
+    d_link_p = d_link_p->nextLink();
+    return *this;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveHashSet_Iterator<VALUE, TAG>
+IntrusiveHashSet_Iterator<VALUE, TAG>::operator++(int)
+{
+    IntrusiveHashSet_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+// ACCESSORS
+template <class VALUE, class TAG>
+inline
+typename IntrusiveHashSet_Iterator<VALUE, TAG>::reference
+IntrusiveHashSet_Iterator<VALUE, TAG>::operator*() const
+{
+    return *operator->();
+}
+
+template <class VALUE, class TAG>
+inline
+typename IntrusiveHashSet_Iterator<VALUE, TAG>::pointer
+IntrusiveHashSet_Iterator<VALUE, TAG>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_link_p);
+
+    return static_cast<VALUE *>(static_cast<Hook *>(d_link_p));
+}
+
+template <class VALUE, class TAG>
+inline
+BidirectionalLink *IntrusiveHashSet_Iterator<VALUE, TAG>::link() const
+{
+    return d_link_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator==(const IntrusiveHashSet_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveHashSet_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.link() == rhs.link();
+}
+
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator!=(const IntrusiveHashSet_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveHashSet_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.link() != rhs.link();
+}
+
+namespace bslalg {
+
+                          // ----------------------
+                          // class IntrusiveHashSet
+                          // ----------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+BidirectionalLink *IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::toLink(
+                                                                  TYPE *object)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    return static_cast<Hook *>(object);
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+const TYPE& IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::toValue(
+                                                const BidirectionalLink *link)
+{
+    return *static_cast<const TYPE *>(static_cast<const Hook *>(link));
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::rehashImp(
+                                              native_std::size_t minNumBuckets)
+{
+    const native_std::size_t numBuckets = Util::nextNumBuckets(minNumBuckets);
+
+    HashTableBucket *buckets = static_cast<HashTableBucket *>(
+                  d_allocator_p->allocate(numBuckets * sizeof *buckets));
+    for (native_std::size_t i = 0; i < numBuckets; ++i) {
+        buckets[i].reset();
+    }
+
+    // No operation below can throw.  Each element is moved to the front of
+    // its bucket in the new array, using the hash code cached in its hook.
+
+    HashTableAnchor newAnchor(buckets, numBuckets, 0);
+
+    BidirectionalLink *link = d_anchor.listRootAddress();
+    while (link) {
+        BidirectionalLink *next = link->nextLink();
+        ImpUtil::insertAtFrontOfBucket(&newAnchor,
+                                       link,
+                                       static_cast<Hook *>(link)->hashCode());
+        link = next;
+    }
+
+    if (Util::defaultBucketAddress() != d_anchor.bucketArrayAddress()) {
+        d_allocator_p->deallocate(d_anchor.bucketArrayAddress());
+    }
+    d_anchor.swap(newAnchor);
+    d_capacity = Util::capacity(numBuckets, d_maxLoadFactor);
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+HashTableBucket *IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::bucketForHashCode(
+                                            native_std::size_t hashCode) const
+{
+    return d_anchor.bucketArrayAddress()
+         + ImpUtil::computeBucketIndex(hashCode, d_anchor.bucketArraySize());
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+template <class KEY>
+inline
+BidirectionalLink *IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::findImp(
+                                           const KEY&         key,
+                                           native_std::size_t hashCode) const
+{
+    const HashTableBucket *bucket = bucketForHashCode(hashCode);
+
+    for (BidirectionalLink *cursor = bucket->first(), *end = bucket->end();
+         end != cursor;
+         cursor = cursor->nextLink()) {
+        if (hashCode == static_cast<Hook *>(cursor)->hashCode()
+         && d_comparator(key, toValue(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+// CREATORS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::IntrusiveHashSet(
+                                              bslma::Allocator *basicAllocator)
+: d_anchor(Util::defaultBucketAddress(), 1, 0)
+, d_size(0)
+, d_capacity(0)
+, d_maxLoadFactor(1.0f)
+, d_hasher()
+, d_comparator()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::IntrusiveHashSet(
+                                  const HASH&         hash,
+                                  const EQUAL&        equal,
+                                  native_std::size_t  initialNumBuckets,
+                                  bslma::Allocator   *basicAllocator)
+: d_anchor(Util::defaultBucketAddress(), 1, 0)
+, d_size(0)
+, d_capacity(0)
+, d_maxLoadFactor(1.0f)
+, d_hasher(hash)
+, d_comparator(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 != initialNumBuckets) {
+        rehashImp(initialNumBuckets);
+    }
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::~IntrusiveHashSet()
+{
+    removeAll();
+    if (Util::defaultBucketAddress() != d_anchor.bucketArrayAddress()) {
+        d_allocator_p->deallocate(d_anchor.bucketArrayAddress());
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::begin()
+{
+    return iterator(d_anchor.listRootAddress());
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::end()
+{
+    return iterator();
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::insertIfMissing(
+                                                         bool *isInsertedFlag,
+                                                         TYPE *object)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+    BSLS_ASSERT_SAFE(!static_cast<Hook *>(object)->isLinked());
+
+    const native_std::size_t hashCode = d_hasher(*object);
+
+    if (BidirectionalLink *existing = findImp(*object, hashCode)) {
+        *isInsertedFlag = false;
+        return iterator(existing);                                    // RETURN
+    }
+
+    if (d_size >= d_capacity) {
+        const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+        const native_std::size_t minNumBuckets =
+                   static_cast<native_std::size_t>(
+                             static_cast<double>(d_size + 1) / d_maxLoadFactor)
+                 + 1;
+        rehashImp(minNumBuckets > 2 * numBuckets ? minNumBuckets
+                                                 : 2 * numBuckets);
+    }
+
+    Hook *hook = static_cast<Hook *>(object);
+    hook->setHashCode(hashCode);
+    ImpUtil::insertAtFrontOfBucket(&d_anchor, hook, hashCode);
+    ++d_size;
+
+    *isInsertedFlag = true;
+    return iterator(hook);
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position.link());
+
+    BidirectionalLink *link = position.link();
+    BidirectionalLink *next = link->nextLink();
+    Hook              *hook = static_cast<Hook *>(link);
+
+    ImpUtil::remove(&d_anchor, link, hook->hashCode());
+    hook->unlink();
+    --d_size;
+    return iterator(next);
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::remove(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    erase(const_iterator(toLink(object)));
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::removeAll()
+{
+    // Resetting the bucket of each element, rather than every bucket, takes
+    // time proportional to the number of elements, not of buckets.
+
+    BidirectionalLink *link = d_anchor.listRootAddress();
+    while (link) {
+        BidirectionalLink *next = link->nextLink();
+        Hook              *hook = static_cast<Hook *>(link);
+        bucketForHashCode(hook->hashCode())->reset();
+        hook->unlink();
+        link = next;
+    }
+    d_anchor.setListRootAddress(0);
+    d_size = 0;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::rehash(
+                                                 native_std::size_t numBuckets)
+{
+    const native_std::size_t minNumBuckets =
+                  static_cast<native_std::size_t>(
+                                 static_cast<double>(d_size) / d_maxLoadFactor)
+                + 1;
+    if (numBuckets < minNumBuckets) {
+        numBuckets = minNumBuckets;
+    }
+
+    if (numBuckets > d_anchor.bucketArraySize()
+     || Util::defaultBucketAddress() == d_anchor.bucketArrayAddress()) {
+        rehashImp(numBuckets);
+    }
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::reserve(
+                                                native_std::size_t numElements)
+{
+    if (numElements > d_capacity) {
+        rehash(static_cast<native_std::size_t>(
+                         static_cast<double>(numElements) / d_maxLoadFactor)
+             + 1);
+    }
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::setMaxLoadFactor(float value)
+{
+    BSLS_ASSERT(0 < value);
+
+    if (Util::defaultBucketAddress() == d_anchor.bucketArrayAddress()) {
+        d_maxLoadFactor = value;
+        return;                                                       // RETURN
+    }
+
+    if (d_size > Util::capacity(d_anchor.bucketArraySize(), value)) {
+        rehashImp(static_cast<native_std::size_t>(
+                                   static_cast<double>(d_size) / value) + 1);
+    }
+    d_maxLoadFactor = value;
+    d_capacity      = Util::capacity(d_anchor.bucketArraySize(), value);
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+void IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::swap(IntrusiveHashSet& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    d_anchor.swap(other.d_anchor);
+    SwapUtil::swap(&d_size,          &other.d_size);
+    SwapUtil::swap(&d_capacity,      &other.d_capacity);
+    SwapUtil::swap(&d_maxLoadFactor, &other.d_maxLoadFactor);
+    SwapUtil::swap(&d_hasher,        &other.d_hasher);
+    SwapUtil::swap(&d_comparator,    &other.d_comparator);
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iteratorTo(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    return iterator(toLink(object));
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+template <class KEY>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::find(const KEY& key)
+{
+    return iterator(findImp(key, d_hasher(key)));
+}
+
+// ACCESSORS
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::const_iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::begin() const
+{
+    return const_iterator(d_anchor.listRootAddress());
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::const_iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::end() const
+{
+    return const_iterator();
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+template <class KEY>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::const_iterator
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::find(const KEY& key) const
+{
+    return const_iterator(findImp(key, d_hasher(key)));
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+bslma::Allocator *IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+const EQUAL& IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+const HASH& IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::hasher() const
+{
+    return d_hasher;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+bool IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::isEmpty() const
+{
+    return 0 == d_size;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+float IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::loadFactor() const
+{
+    return static_cast<float>(static_cast<double>(d_size)
+                          / static_cast<double>(d_anchor.bucketArraySize()));
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+float IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::maxLoadFactor() const
+{
+    return d_maxLoadFactor;
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::size_type
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::numBuckets() const
+{
+    return d_anchor.bucketArraySize();
+}
+
+template <class TYPE, class HASH, class EQUAL, class TAG>
+inline
+typename IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::size_type
+IntrusiveHashSet<TYPE, HASH, EQUAL, TAG>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1320 @@
+// bslalg_intrusivehashset.t.cpp                                      -*-C++-*-
+
+#include <bslalg_intrusivehashset.h>
+
+#include <bslalg_bidirectionallink.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bslalg;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a hook type and an intrusive hash set of
+// objects deriving from it.  The set links caller-owned objects and allocates
+// only its bucket array, so the tests create arrays of elements on the stack,
+// manipulate them through sets supplied with a test allocator, and verify,
+// after each operation, that the set holds, and can find, exactly the
+// expected elements, that exactly those elements report being linked, and
+// that memory is allocated only when the bucket array grows.  Hash functors
+// mapping many keys to the same hash code exercise the search of a bucket.
+// ----------------------------------------------------------------------------
+// CLASS 'IntrusiveHashSetHook'
+// [ 2] IntrusiveHashSetHook();
+// [ 2] IntrusiveHashSetHook(const IntrusiveHashSetHook& original);
+// [ 2] IntrusiveHashSetHook& operator=(const IntrusiveHashSetHook& rhs);
+// [ 2] void setHashCode(size_t value);
+// [ 2] void unlink();
+// [ 2] size_t hashCode() const;
+// [ 2] bool isLinked() const;
+//
+// CLASS 'IntrusiveHashSet'
+// [ 3] IntrusiveHashSet(bslma::Allocator *basicAllocator = 0);
+// [ 5] IntrusiveHashSet(hash, equal, initialNumBuckets = 0, allocator = 0);
+// [ 6] ~IntrusiveHashSet();
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] void remove(TYPE *object);
+// [ 6] void removeAll();
+// [ 5] void rehash(size_t numBuckets);
+// [ 5] void reserve(size_t numElements);
+// [ 5] void setMaxLoadFactor(float value);
+// [ 6] void swap(IntrusiveHashSet& other);
+// [ 4] iterator iteratorTo(TYPE *object);
+// [ 3] iterator find(const KEY& key);
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 3] bslma::Allocator *allocator() const;
+// [ 5] const EQUAL& comparator() const;
+// [ 5] const HASH& hasher() const;
+// [ 3] bool isEmpty() const;
+// [ 5] float loadFactor() const;
+// [ 5] float maxLoadFactor() const;
+// [ 3] size_type numBuckets() const;
+// [ 3] size_type size() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] MULTIPLE HOOKS
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TagA;
+struct TagB;
+
+struct Element : IntrusiveHashSetHook<> {
+    // This 'struct' is an element of the sets under test, identified by an
+    // integer key.
+
+    int d_key;
+
+    explicit Element(int key = 0) : d_key(key) {}
+};
+
+class ElementHash {
+    // This class hashes elements, and bare keys, by key.  If it is created
+    // with a non-zero modulus, it maps keys differing by a multiple of the
+    // modulus to the same hash code, so that they collide in any bucket
+    // array.
+
+    // DATA
+    int d_modulus;
+
+  public:
+    explicit ElementHash(int modulus = 0) : d_modulus(modulus) {}
+
+    native_std::size_t operator()(int key) const
+    {
+        return d_modulus
+             ? static_cast<native_std::size_t>(key % d_modulus)
+             : static_cast<native_std::size_t>(key) * 2654435761u;
+    }
+
+    native_std::size_t operator()(const Element& element) const
+    {
+        return (*this)(element.d_key);
+    }
+
+    int modulus() const { return d_modulus; }
+};
+
+class ElementEqual {
+    // This class compares elements, and bare keys, by key, and identifies
+    // itself for the tests of 'swap'.
+
+    // DATA
+    int d_id;
+
+  public:
+    explicit ElementEqual(int id = 0) : d_id(id) {}
+
+    bool operator()(const Element& lhs, const Element& rhs) const
+    {
+        return lhs.d_key == rhs.d_key;
+    }
+
+    bool operator()(int key, const Element& element) const
+    {
+        return key == element.d_key;
+    }
+
+    int id() const { return d_id; }
+};
+
+struct MultiElement : IntrusiveHashSetHook<TagA>, IntrusiveHashSetHook<TagB> {
+    // This 'struct' is an element that may be in two sets at once, under
+    // different keys.
+
+    int d_id;
+    int d_altId;
+
+    MultiElement(int id, int altId) : d_id(id), d_altId(altId) {}
+};
+
+struct MultiHashA {
+    native_std::size_t operator()(int id) const
+    {
+        return static_cast<native_std::size_t>(id);
+    }
+
+    native_std::size_t operator()(const MultiElement& element) const
+    {
+        return (*this)(element.d_id);
+    }
+};
+
+struct MultiEqualA {
+    bool operator()(const MultiElement& lhs, const MultiElement& rhs) const
+    {
+        return lhs.d_id == rhs.d_id;
+    }
+
+    bool operator()(int id, const MultiElement& element) const
+    {
+        return id == element.d_id;
+    }
+};
+
+struct MultiHashB {
+    native_std::size_t operator()(int altId) const
+    {
+        return static_cast<native_std::size_t>(altId) * 31u;
+    }
+
+    native_std::size_t operator()(const MultiElement& element) const
+    {
+        return (*this)(element.d_altId);
+    }
+};
+
+struct MultiEqualB {
+    bool operator()(const MultiElement& lhs, const MultiElement& rhs) const
+    {
+        return lhs.d_altId == rhs.d_altId;
+    }
+
+    bool operator()(int altId, const MultiElement& element) const
+    {
+        return altId == element.d_altId;
+    }
+};
+
+typedef IntrusiveHashSet<Element, ElementHash, ElementEqual> Obj;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+bool verify(const Obj& set, const Element *elements, int numElements)
+    // Return 'true' if the specified 'set' holds exactly the linked elements
+    // among the specified 'numElements' elements of the specified 'elements'
+    // array, can find each of them by key, and has a load factor not
+    // exceeding its maximum, and 'false' otherwise.
+{
+    int numLinked = 0;
+    for (int i = 0; i < numElements; ++i) {
+        const Element&      element = elements[i];
+        Obj::const_iterator it      = set.find(element.d_key);
+        if (element.isLinked()) {
+            ++numLinked;
+            if (it == set.end() || &element != &*it) {
+                return false;                                         // RETURN
+            }
+            if (set.hasher()(element) != element.hashCode()) {
+                return false;                                         // RETURN
+            }
+        }
+        else if (it != set.end() && &element == &*it) {
+            return false;                                             // RETURN
+        }
+    }
+
+    if (set.size() != static_cast<Obj::size_type>(numLinked)
+     || set.isEmpty() != (0 == numLinked)) {
+        return false;                                                 // RETURN
+    }
+
+    int numIterated = 0;
+    for (Obj::const_iterator it = set.begin(); it != set.end(); ++it) {
+        if (!it->isLinked()
+         || it != set.find(it->d_key)
+         || ++numIterated > numLinked) {
+            return false;                                             // RETURN
+        }
+    }
+    if (numIterated != numLinked) {
+        return false;                                                 // RETURN
+    }
+
+    return set.loadFactor() <= set.maxLoadFactor();
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Live Orders by Identifier
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the orders of an order book are held in queues at their price
+// levels, and that we also need to find an order quickly by its identifier,
+// without allocating memory when an order arrives.
+//
+// First, we define an order type that derives from 'IntrusiveHashSetHook',
+// and functors that hash and compare orders, and also bare identifiers, by
+// identifier:
+//..
+    struct Order : bslalg::IntrusiveHashSetHook<> {
+        int d_id;
+        int d_quantity;
+
+        Order(int id, int quantity) : d_id(id), d_quantity(quantity) {}
+    };
+
+    struct OrderHash {
+        native_std::size_t operator()(const Order& order) const
+        {
+            return (*this)(order.d_id);
+        }
+
+        native_std::size_t operator()(int id) const
+        {
+            return static_cast<native_std::size_t>(id) * 2654435761u;
+        }
+    };
+
+    struct OrderEqual {
+        bool operator()(const Order& lhs, const Order& rhs) const
+        {
+            return lhs.d_id == rhs.d_id;
+        }
+
+        bool operator()(int id, const Order& order) const
+        {
+            return id == order.d_id;
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // Confirm that no memory is taken from the default allocator.
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create the index, and reserve room for the largest number of
+// orders we expect to be live at once, so that indexing an order will not
+// allocate memory:
+//..
+    typedef bslalg::IntrusiveHashSet<Order, OrderHash, OrderEqual> Index;
+
+    bslma::TestAllocator ta;
+    Index                index(&ta);
+    index.reserve(1000);
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//..
+// Next, we index some orders:
+//..
+    Order a(17, 100), b(42, 200), c(99, 300);
+
+    bool isInserted;
+    index.insertIfMissing(&isInserted, &a);
+    ASSERT(isInserted);
+    index.insertIfMissing(&isInserted, &b);
+    index.insertIfMissing(&isInserted, &c);
+
+    ASSERT(3              == index.size());
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+// Now, we find an order by its identifier alone:
+//..
+    Index::iterator it = index.find(42);
+    ASSERT(&b == &*it);
+    ASSERT(index.end() == index.find(43));
+//..
+// Finally, an order is filled, and we remove it from the index knowing only
+// its address:
+//..
+    index.remove(&a);
+
+    ASSERT(false       == a.isLinked());
+    ASSERT(index.end() == index.find(17));
+    ASSERT(2           == index.size());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // MULTIPLE HOOKS
+        //
+        // Concerns:
+        //: 1 An object deriving from hooks having different tags can be in a
+        //:   set for each tag at the same time, under different keys.
+        //:
+        //: 2 Removing an object from the set for one tag does not affect its
+        //:   membership of the set for the other tag.
+        //
+        // Plan:
+        //: 1 Insert the same objects into sets for two tags, hashed by
+        //:   different members, find them in both, and remove them from each
+        //:   in turn.  (C-1..2)
+        //
+        // Testing:
+        //   MULTIPLE HOOKS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMULTIPLE HOOKS"
+                            "\n==============\n");
+
+        typedef IntrusiveHashSet<MultiElement, MultiHashA, MultiEqualA, TagA>
+                                                                          SetA;
+        typedef IntrusiveHashSet<MultiElement, MultiHashB, MultiEqualB, TagB>
+                                                                          SetB;
+        typedef IntrusiveHashSetHook<TagA>                               HookA;
+        typedef IntrusiveHashSetHook<TagB>                               HookB;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { NUM_ELEMENTS = 20 };
+
+        MultiElement *e[NUM_ELEMENTS];
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            e[i] = new MultiElement(i, 100 + i);
+        }
+
+        {
+            SetA a(&ta);
+            SetB b(&ta);
+
+            bool isInserted;
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                a.insertIfMissing(&isInserted, e[i]);
+                ASSERTV(i, isInserted);
+                b.insertIfMissing(&isInserted, e[NUM_ELEMENTS - 1 - i]);
+                ASSERTV(i, isInserted);
+            }
+            ASSERT(NUM_ELEMENTS == a.size());
+            ASSERT(NUM_ELEMENTS == b.size());
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, e[i] == &*a.find(i));
+                ASSERTV(i, e[i] == &*b.find(100 + i));
+                ASSERTV(i, a.end() == a.find(100 + i));
+            }
+
+            for (int i = 0; i < NUM_ELEMENTS; i += 2) {
+                a.remove(e[i]);
+            }
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const bool inA = i % 2;
+                ASSERTV(i, inA == static_cast<HookA *>(e[i])->isLinked());
+                ASSERTV(i, static_cast<HookB *>(e[i])->isLinked());
+                ASSERTV(i, inA == (a.end() != a.find(i)));
+                ASSERTV(i, e[i] == &*b.find(100 + i));
+            }
+
+            b.removeAll();
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, !static_cast<HookB *>(e[i])->isLinked());
+            }
+            ASSERT(NUM_ELEMENTS / 2 == a.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            ASSERTV(i, !static_cast<HookA *>(e[i])->isLinked());
+            delete e[i];
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // REMOVEALL, DESTRUCTOR, AND SWAP
+        //
+        // Concerns:
+        //: 1 'removeAll' unlinks every element, empties the set, and retains
+        //:   the bucket array, so that the set can be refilled without
+        //:   allocating memory.
+        //:
+        //: 2 The destructor unlinks the remaining elements and releases the
+        //:   bucket array.
+        //:
+        //: 3 'swap' exchanges the elements, bucket arrays, maximum load
+        //:   factors, and functors of two sets without allocating memory.
+        //:
+        //: 4 'swap' asserts that the sets have the same allocator.
+        //
+        // Plan:
+        //: 1 Fill a set, remove all elements, verify them and the set, and
+        //:   refill it while monitoring its allocator.  (C-1)
+        //:
+        //: 2 Destroy a filled set and verify that its elements are unlinked
+        //:   and that no memory is outstanding.  (C-2)
+        //:
+        //: 3 Swap sets of different sizes and functors, including an empty
+        //:   set, verifying both sets before and after.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for 'swap' of sets with different allocators.  (C-4)
+        //
+        // Testing:
+        //   ~IntrusiveHashSet();
+        //   void removeAll();
+        //   void swap(IntrusiveHashSet& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREMOVEALL, DESTRUCTOR, AND SWAP"
+                            "\n===============================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { NUM_ELEMENTS = 40 };
+
+        Element e[NUM_ELEMENTS];
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            e[i].d_key = i;
+        }
+
+        if (verbose) printf("\tTesting 'removeAll'.\n");
+        {
+            Obj  x(ElementHash(7), ElementEqual(), 0, &ta);
+            bool isInserted;
+
+            x.removeAll();
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+            }
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            const Obj::size_type          NUM_BUCKETS = x.numBuckets();
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            x.removeAll();
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, !e[i].isLinked());
+            }
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+            ASSERT(x.isEmpty());
+            ASSERT(x.begin() == x.end());
+            ASSERT(NUM_BUCKETS == x.numBuckets());
+
+            for (int i = NUM_ELEMENTS - 1; i >= 0; --i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+                ASSERTV(i, isInserted);
+            }
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+
+            x.removeAll();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tTesting the destructor.\n");
+        {
+            {
+                Obj  x(&ta);
+                bool isInserted;
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    x.insertIfMissing(&isInserted, &e[i]);
+                }
+                ASSERT(0 < ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, !e[i].isLinked());
+            }
+
+            {
+                Obj x(&ta);
+            }
+            ASSERT(0 == ta.numAllocations() - ta.numDeallocations());
+        }
+
+        if (verbose) printf("\tTesting 'swap'.\n");
+        {
+            for (int n = 0; n <= 10; n += 5) {
+                Obj x(ElementHash(3), ElementEqual(1), 0, &ta);
+                Obj y(ElementHash(0), ElementEqual(2), 0, &ta);
+
+                bool isInserted;
+                for (int i = 0; i < n; ++i) {
+                    x.insertIfMissing(&isInserted, &e[i]);
+                }
+                for (int i = n; i < NUM_ELEMENTS; ++i) {
+                    y.insertIfMissing(&isInserted, &e[i]);
+                }
+                x.setMaxLoadFactor(0.5f);
+
+                const Obj::size_type XB = x.numBuckets();
+                const Obj::size_type YB = y.numBuckets();
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          ta.numAllocations();
+
+                x.swap(y);
+
+                ASSERTV(n, NUM_ALLOCATIONS == ta.numAllocations());
+                ASSERTV(n, NUM_ELEMENTS - n == static_cast<int>(x.size()));
+                ASSERTV(n, n                == static_cast<int>(y.size()));
+                ASSERTV(n, YB   == x.numBuckets());
+                ASSERTV(n, XB   == y.numBuckets());
+                ASSERTV(n, 2    == x.comparator().id());
+                ASSERTV(n, 1    == y.comparator().id());
+                ASSERTV(n, 0    == x.hasher().modulus());
+                ASSERTV(n, 3    == y.hasher().modulus());
+                ASSERTV(n, 1.0f == x.maxLoadFactor());
+                ASSERTV(n, 0.5f == y.maxLoadFactor());
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    ASSERTV(n, i, (i < n) == (y.end() != y.find(i)));
+                    ASSERTV(n, i, (i < n) != (x.end() != x.find(i)));
+                }
+
+                // A swapped set remains fully usable.
+
+                for (int i = 0; i < n; ++i) {
+                    y.remove(&e[i]);
+                    x.insertIfMissing(&isInserted, &e[i]);
+                    ASSERTV(n, i, isInserted);
+                }
+                ASSERTV(n, verify(x, e, NUM_ELEMENTS));
+                ASSERTV(n, y.isEmpty());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator tb("other", veryVeryVeryVerbose);
+
+            Obj x(&ta), y(&ta), z(&tb);
+
+            ASSERT_SAFE_PASS(x.swap(y));
+            ASSERT_SAFE_FAIL(x.swap(z));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BUCKET MANAGEMENT
+        //
+        // Concerns:
+        //: 1 A set created with an initial number of buckets allocates them
+        //:   at once, and one created without allocates nothing.
+        //:
+        //: 2 'reserve(n)' sizes the bucket array so that inserting up to 'n'
+        //:   elements allocates no memory.
+        //:
+        //: 3 'rehash' only grows the bucket array, never below what the
+        //:   elements and maximum load factor require, and preserves the
+        //:   elements.
+        //:
+        //: 4 'setMaxLoadFactor' grows the bucket array only if the elements
+        //:   would otherwise exceed the new maximum load factor, and the new
+        //:   maximum governs subsequent growth.
+        //:
+        //: 5 The functors supplied at construction are used.
+        //:
+        //: 6 'setMaxLoadFactor' asserts that its argument is positive.
+        //
+        // Plan:
+        //: 1 Create sets with and without an initial number of buckets and
+        //:   check the allocator.  (C-1, 5)
+        //:
+        //: 2 For a range of sizes and maximum load factors, 'reserve' room
+        //:   in an empty set, and insert that many elements, checking that
+        //:   no allocation occurs and that the set is valid.  (C-2, 4)
+        //:
+        //: 3 Rehash a filled set to fewer and to more buckets, and verify the
+        //:   number of buckets and the elements.  (C-3)
+        //:
+        //: 4 Lower and raise the maximum load factor of a filled set,
+        //:   verifying the number of buckets and the elements.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for non-positive maximum load factors.  (C-6)
+        //
+        // Testing:
+        //   IntrusiveHashSet(hash, equal, initialNumBuckets = 0, alloc = 0);
+        //   void rehash(size_t numBuckets);
+        //   void reserve(size_t numElements);
+        //   void setMaxLoadFactor(float value);
+        //   const EQUAL& comparator() const;
+        //   const HASH& hasher() const;
+        //   float loadFactor() const;
+        //   float maxLoadFactor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBUCKET MANAGEMENT"
+                            "\n=================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { NUM_ELEMENTS = 200 };
+
+        Element e[NUM_ELEMENTS];
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            e[i].d_key = 3 * i;
+        }
+
+        if (verbose) printf("\tTesting the value constructor.\n");
+        {
+            {
+                Obj x(ElementHash(5), ElementEqual(9), 0, &ta);
+                ASSERT(0    == ta.numAllocations());
+                ASSERT(1    == x.numBuckets());
+                ASSERT(5    == x.hasher().modulus());
+                ASSERT(9    == x.comparator().id());
+                ASSERT(1.0f == x.maxLoadFactor());
+                ASSERT(0.0f == x.loadFactor());
+                ASSERT(&ta  == x.allocator());
+            }
+            {
+                Obj x(ElementHash(), ElementEqual(), 100, &ta);
+                ASSERT(1   == ta.numAllocations());
+                ASSERT(100 <= x.numBuckets());
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          ta.numAllocations();
+                bool isInserted;
+                for (int i = 0; i < 100; ++i) {
+                    x.insertIfMissing(&isInserted, &e[i]);
+                }
+                ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+                ASSERT(verify(x, e, NUM_ELEMENTS));
+                x.removeAll();
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting 'reserve'.\n");
+        {
+            static const float LOAD_FACTORS[] = { 0.25f, 0.5f, 1.0f, 3.0f };
+            enum { NUM_LOAD_FACTORS = sizeof LOAD_FACTORS
+                                    / sizeof *LOAD_FACTORS };
+
+            for (int li = 0; li < NUM_LOAD_FACTORS; ++li) {
+                const float MLF = LOAD_FACTORS[li];
+
+                for (int n = 0; n <= NUM_ELEMENTS; n += 13) {
+                    Obj x(&ta);
+                    x.setMaxLoadFactor(MLF);
+                    ASSERTV(MLF, n, MLF == x.maxLoadFactor());
+
+                    x.reserve(n);
+
+                    const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          ta.numAllocations();
+                    bool isInserted;
+                    for (int i = 0; i < n; ++i) {
+                        x.insertIfMissing(&isInserted, &e[i]);
+                        ASSERTV(MLF, n, i, isInserted);
+                    }
+                    ASSERTV(MLF, n, NUM_ALLOCATIONS == ta.numAllocations());
+                    ASSERTV(MLF, n, verify(x, e, NUM_ELEMENTS));
+
+                    // Reserving no more than is held allocates nothing.
+
+                    x.reserve(n);
+                    x.reserve(n / 2);
+                    ASSERTV(MLF, n, NUM_ALLOCATIONS == ta.numAllocations());
+
+                    x.removeAll();
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting 'rehash'.\n");
+        {
+            Obj  x(ElementHash(11), ElementEqual(), 0, &ta);
+            bool isInserted;
+
+            x.rehash(0);
+            ASSERT(1 <= x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            for (int i = 0; i < 50; ++i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+            }
+            const Obj::size_type NUM_BUCKETS = x.numBuckets();
+
+            x.rehash(1);
+            ASSERT(NUM_BUCKETS == x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            x.rehash(1000);
+            ASSERT(1000 <= x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            const Obj::size_type LARGE_NUM_BUCKETS = x.numBuckets();
+            x.rehash(NUM_BUCKETS);
+            ASSERT(LARGE_NUM_BUCKETS == x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            x.removeAll();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'setMaxLoadFactor'.\n");
+        {
+            Obj  x(&ta);
+            bool isInserted;
+
+            for (int i = 0; i < 100; ++i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+            }
+            const Obj::size_type NUM_BUCKETS = x.numBuckets();
+
+            x.setMaxLoadFactor(4.0f);
+            ASSERT(NUM_BUCKETS == x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            // The raised maximum defers growth.
+
+            bsls::Types::Int64 numAllocations = ta.numAllocations();
+            for (int i = 100; i < 150; ++i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+            }
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            x.setMaxLoadFactor(0.1f);
+            ASSERT(1500 <= x.numBuckets());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            numAllocations = ta.numAllocations();
+            x.setMaxLoadFactor(0.2f);
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(verify(x, e, NUM_ELEMENTS));
+
+            x.removeAll();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj x(&ta);
+
+            ASSERT_FAIL(x.setMaxLoadFactor(0.0f));
+            ASSERT_FAIL(x.setMaxLoadFactor(-1.0f));
+            ASSERT_PASS(x.setMaxLoadFactor(0.5f));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE, REMOVE, AND ITERATORTO
+        //
+        // Concerns:
+        //: 1 'remove' and 'erase' unlink exactly the indicated element from
+        //:   its bucket and from the list of all elements, whatever its
+        //:   position in its bucket, and leave the other elements findable.
+        //:
+        //: 2 'erase' returns an iterator at the element that followed the
+        //:   erased one, so that a set can be emptied by iteration.
+        //:
+        //: 3 'iteratorTo' returns an iterator at the indicated element.
+        //:
+        //: 4 A removed element can be inserted again.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For hash functors producing no, some, and only collisions, fill
+        //:   a set and remove each element in turn in several orders, verify
+        //:   the set after each removal, then insert the elements again.
+        //:   (C-1, 3..4)
+        //:
+        //: 2 Empty a filled set with 'erase' while iterating.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   void remove(TYPE *object);
+        //   iterator iteratorTo(TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE, REMOVE, AND ITERATORTO"
+                            "\n=============================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { NUM_ELEMENTS = 30 };
+
+        Element e[NUM_ELEMENTS];
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            e[i].d_key = i;
+        }
+
+        static const int MODULI[] = { 0, 1, 4, 17 };
+        enum { NUM_MODULI = sizeof MODULI / sizeof *MODULI };
+
+        for (int mi = 0; mi < NUM_MODULI; ++mi) {
+            const int MODULUS = MODULI[mi];
+
+            for (int order = 0; order < 3; ++order) {
+                Obj  x(ElementHash(MODULUS), ElementEqual(), 0, &ta);
+                bool isInserted;
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    x.insertIfMissing(&isInserted, &e[i]);
+                }
+
+                for (int j = 0; j < NUM_ELEMENTS; ++j) {
+                    const int i = 0 == order ? j
+                                : 1 == order ? NUM_ELEMENTS - 1 - j
+                                : (j * 7) % NUM_ELEMENTS;
+
+                    Obj::iterator it = x.iteratorTo(&e[i]);
+                    ASSERTV(MODULUS, order, i, &e[i] == &*it);
+                    ASSERTV(MODULUS, order, i, it == x.find(i));
+
+                    if (j % 2) {
+                        x.remove(&e[i]);
+                    }
+                    else {
+                        Obj::iterator next = it;
+                        ++next;
+                        ASSERTV(MODULUS, order, i, next == x.erase(it));
+                    }
+                    ASSERTV(MODULUS, order, i, !e[i].isLinked());
+                    ASSERTV(MODULUS, order, i, x.end() == x.find(i));
+                    ASSERTV(MODULUS, order, i, verify(x, e, NUM_ELEMENTS));
+                }
+                ASSERTV(MODULUS, order, x.isEmpty());
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    x.insertIfMissing(&isInserted, &e[i]);
+                    ASSERTV(MODULUS, order, i, isInserted);
+                }
+                ASSERTV(MODULUS, order, verify(x, e, NUM_ELEMENTS));
+
+                Obj::iterator it = x.begin();
+                while (it != x.end()) {
+                    it = x.erase(it);
+                }
+                ASSERTV(MODULUS, order, x.isEmpty());
+                ASSERTV(MODULUS, order, verify(x, e, NUM_ELEMENTS));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj     x(&ta);
+            Element a(1), b(2);
+            bool    isInserted;
+            x.insertIfMissing(&isInserted, &a);
+
+            ASSERT_SAFE_FAIL(x.erase(x.end()));
+            ASSERT_SAFE_FAIL(x.remove(&b));
+            ASSERT_SAFE_FAIL(x.iteratorTo(&b));
+            ASSERT_SAFE_FAIL(x.insertIfMissing(0, &b));
+            ASSERT_SAFE_FAIL(x.insertIfMissing(&isInserted, &a));
+            ASSERT_SAFE_PASS(x.iteratorTo(&a));
+            ASSERT_SAFE_PASS(x.remove(&a));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed set is empty, has one bucket, and
+        //:   allocates no memory.
+        //:
+        //: 2 'insertIfMissing' inserts an element only if no equal element is
+        //:   present, reports whether it did, and returns an iterator at the
+        //:   inserted or existing element.
+        //:
+        //: 3 The bucket array grows, allocating memory, only when the
+        //:   elements would otherwise exceed the maximum load factor, and
+        //:   growth preserves the elements.
+        //:
+        //: 4 'find' locates elements by a key of a different type, through
+        //:   both modifiable and non-modifiable sets, including when many
+        //:   elements share a hash code.
+        //:
+        //: 5 Iteration visits each element exactly once.
+        //:
+        //: 6 The set supplies memory only from the allocator given at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Default-construct a set, and verify its state and the
+        //:   allocator.  (C-1, 6)
+        //:
+        //: 2 For hash functors producing no, some, and only collisions,
+        //:   insert elements one at a time, verifying the set, the result,
+        //:   and the number of allocations after each insertion, then insert
+        //:   duplicates of each element and verify that they are rejected.
+        //:   (C-2..6)
+        //
+        // Testing:
+        //   IntrusiveHashSet(bslma::Allocator *basicAllocator = 0);
+        //   iterator begin();
+        //   iterator end();
+        //   iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+        //   iterator find(const KEY& key);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_iterator find(const KEY& key) const;
+        //   bslma::Allocator *allocator() const;
+        //   bool isEmpty() const;
+        //   size_type numBuckets() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASIC MANIPULATORS AND ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting the default constructor.\n");
+        {
+            Obj mX(&ta); const Obj& X = mX;
+
+            ASSERT(0         == ta.numAllocations());
+            ASSERT(&ta       == X.allocator());
+            ASSERT(X.isEmpty());
+            ASSERT(0         == X.size());
+            ASSERT(1         == X.numBuckets());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(0));
+            ASSERT(mX.end()  == mX.find(0));
+
+            Obj mY; const Obj& Y = mY;
+            ASSERT(&da == Y.allocator());
+        }
+
+        if (verbose) printf("\tTesting 'insertIfMissing' and 'find'.\n");
+
+        enum { NUM_ELEMENTS = 100 };
+
+        static const int MODULI[] = { 0, 1, 3, 64 };
+        enum { NUM_MODULI = sizeof MODULI / sizeof *MODULI };
+
+        for (int mi = 0; mi < NUM_MODULI; ++mi) {
+            const int MODULUS = MODULI[mi];
+
+            Element e[NUM_ELEMENTS];
+            Element d[NUM_ELEMENTS];
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                e[i].d_key = d[i].d_key = (i * 37) % NUM_ELEMENTS;
+            }
+
+            {
+                Obj mX(ElementHash(MODULUS), ElementEqual(), 0, &ta);
+                const Obj& X = mX;
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    const Obj::size_type NUM_BUCKETS = X.numBuckets();
+                    const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          ta.numAllocations();
+                    const bool MUST_GROW =
+                           static_cast<float>(X.size() + 1) /
+                           static_cast<float>(NUM_BUCKETS) > X.maxLoadFactor()
+                        || 1 == NUM_BUCKETS;
+
+                    bool          isInserted = false;
+                    Obj::iterator it = mX.insertIfMissing(&isInserted, &e[i]);
+
+                    ASSERTV(MODULUS, i, isInserted);
+                    ASSERTV(MODULUS, i, &e[i] == &*it);
+                    ASSERTV(MODULUS, i, e[i].isLinked());
+                    ASSERTV(MODULUS, i, i + 1 == static_cast<int>(X.size()));
+                    ASSERTV(MODULUS, i, MUST_GROW ==
+                                     (NUM_BUCKETS != X.numBuckets()));
+                    ASSERTV(MODULUS, i, MUST_GROW ==
+                                  (NUM_ALLOCATIONS != ta.numAllocations()));
+                    ASSERTV(MODULUS, i, 1 >= ta.numBlocksInUse());
+                    ASSERTV(MODULUS, i, verify(X, e, NUM_ELEMENTS));
+
+                    ASSERTV(MODULUS, i, &e[i] == &*X.find(e[i].d_key));
+                    ASSERTV(MODULUS, i, &e[i] == &*mX.find(e[i].d_key));
+                }
+                ASSERTV(MODULUS, X.end() == X.find(+NUM_ELEMENTS));
+                ASSERTV(MODULUS, X.end() == X.find(-1));
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    bool          isInserted = true;
+                    Obj::iterator it = mX.insertIfMissing(&isInserted, &d[i]);
+
+                    ASSERTV(MODULUS, i, !isInserted);
+                    ASSERTV(MODULUS, i, &e[i] == &*it);
+                    ASSERTV(MODULUS, i, !d[i].isLinked());
+                }
+                ASSERTV(MODULUS, NUM_ELEMENTS == X.size());
+                ASSERTV(MODULUS, verify(X, e, NUM_ELEMENTS));
+
+                mX.removeAll();
+            }
+            ASSERTV(MODULUS, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // HOOK
+        //
+        // Concerns:
+        //: 1 A default-constructed hook is not linked.
+        //:
+        //: 2 'unlink' restores a hook to the unlinked state, and a hook is
+        //:   linked whenever its predecessor is not itself.
+        //:
+        //: 3 Copy construction and assignment do not copy links or hash
+        //:   codes.
+        //:
+        //: 4 'setHashCode' and 'hashCode' store and return the hash code.
+        //
+        // Plan:
+        //: 1 Create hooks, manipulate their links and hash codes directly,
+        //:   and verify the result of 'isLinked' and 'hashCode'.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   IntrusiveHashSetHook();
+        //   IntrusiveHashSetHook(const IntrusiveHashSetHook& original);
+        //   IntrusiveHashSetHook& operator=(const IntrusiveHashSetHook& rhs);
+        //   void setHashCode(size_t value);
+        //   void unlink();
+        //   size_t hashCode() const;
+        //   bool isLinked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHOOK"
+                            "\n====\n");
+
+        typedef IntrusiveHashSetHook<> Hook;
+
+        Hook a;
+        ASSERT(!a.isLinked());
+        ASSERT(&a == a.previousLink());
+        ASSERT(0  == a.nextLink());
+
+        a.setHashCode(42);
+        ASSERT(42 == a.hashCode());
+
+        // The first element of a set has no predecessor and the last has no
+        // successor, so neither null link alone means "not linked".
+
+        Hook b;
+        a.setPreviousLink(0);
+        ASSERT(a.isLinked());
+        a.setPreviousLink(&b);
+        a.setNextLink(&b);
+        ASSERT(a.isLinked());
+
+        Hook c(a);
+        ASSERT(!c.isLinked());
+        ASSERT(0 == c.hashCode());
+
+        c.setHashCode(7);
+        c = a;
+        ASSERT(!c.isLinked());
+        ASSERT(7 == c.hashCode());
+
+        a = c;
+        ASSERT(a.isLinked());
+        ASSERT(42 == a.hashCode());
+
+        a.unlink();
+        ASSERT(!a.isLinked());
+        ASSERT(42 == a.hashCode());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and remove a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Element e[3] = { Element(10), Element(20), Element(30) };
+        Element dup(20);
+
+        {
+            Obj  x(&ta);
+            bool isInserted;
+
+            ASSERT(x.isEmpty());
+            ASSERT(x.end() == x.find(10));
+
+            for (int i = 0; i < 3; ++i) {
+                x.insertIfMissing(&isInserted, &e[i]);
+                ASSERTV(i, isInserted);
+            }
+            ASSERT(3 == x.size());
+            ASSERT(verify(x, e, 3));
+
+            ASSERT(&e[1] == &*x.insertIfMissing(&isInserted, &dup));
+            ASSERT(!isInserted);
+            ASSERT(!dup.isLinked());
+
+            x.remove(&e[1]);
+            ASSERT(!e[1].isLinked());
+            ASSERT(x.end() == x.find(20));
+            ASSERT(verify(x, e, 3));
+
+            ASSERT(&dup == &*x.insertIfMissing(&isInserted, &dup));
+            ASSERT(isInserted);
+            ASSERT(&dup == &*x.find(20));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        for (int i = 0; i < 3; ++i) {
+            ASSERTV(i, !e[i].isLinked());
+        }
+        ASSERT(!dup.isLinked());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,843 @@
+// bslalg_intrusivelist.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLALG_INTRUSIVELIST
+#define INCLUDED_BSLALG_INTRUSIVELIST
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a doubly-linked list of objects owned by the caller.
+//
+//@CLASSES:
+//  bslalg::IntrusiveListHook: base class linking an object into a list
+//  bslalg::IntrusiveList: list of objects linked through embedded hooks
+//
+//@SEE_ALSO: bslalg_bidirectionallinklistutil, bslalg_intrusiverbtree,
+//           bslalg_intrusivehashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslalg::IntrusiveList', implementing a doubly-linked list of objects that
+// are created, owned, and destroyed by the caller, and a class template,
+// 'bslalg::IntrusiveListHook', from which the type of those objects must
+// publicly derive.  The hook is a 'bslalg::BidirectionalLink', so that the
+// links of the list are embedded in the elements themselves, and the list
+// manipulates them with 'bslalg::BidirectionalLinkListUtil'.  Consequently, a
+// list never allocates memory, none of its operations can throw, and an
+// element can be removed from a list in constant time given only its
+// address, without searching for it.  These properties make an intrusive list
+// suitable for structures, such as the queue of orders at one price level of
+// an order book, or the list of timers due in one slot of a timer wheel, in
+// which objects move frequently between collections and the latency of an
+// allocation is not acceptable.
+//
+// The list is circular around a sentinel link held within the
+// 'bslalg::IntrusiveList' object, which serves as the past-the-end position.
+// Therefore the links of an element in a list are never null, 'end()' can be
+// decremented, and 'IntrusiveListHook::isLinked' can tell whether an object is
+// in a list.  Note that an 'IntrusiveList' object cannot be copied, because
+// its elements can be in only one list (per hook) at a time.
+//
+///Multiple Hooks
+///--------------
+// The (template parameter) 'TAG' of 'IntrusiveListHook' and 'IntrusiveList'
+// distinguishes the hooks of a type that is to be in several lists at once: a
+// type deriving from 'IntrusiveListHook<A>' and 'IntrusiveListHook<B>' can be
+// in an 'IntrusiveList<TYPE, A>' and an 'IntrusiveList<TYPE, B>' at the same
+// time.  The tag types need not be complete.  A type can also derive from the
+// hooks of 'bslalg_intrusiverbtree' and 'bslalg_intrusivehashset'.
+//
+///Element Lifetime
+///----------------
+// The list does not own its elements.  The behavior is undefined if an
+// element is destroyed while it is in a list, and the destructor of
+// 'IntrusiveList' removes (but does not destroy) any elements remaining in the
+// list.  Copying an element does not copy its links: a copy of an element in
+// a list is not itself in a list.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining the Queue of Orders at a Price Level
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we keep, for each price level of an order book, the orders waiting
+// at that price in their order of arrival, and we must be able to cancel any
+// order quickly, without allocating memory in either case.
+//
+// First, we define an order type that derives from 'IntrusiveListHook':
+//..
+//  struct Order : bslalg::IntrusiveListHook<> {
+//      int d_id;
+//      int d_quantity;
+//
+//      Order(int id, int quantity) : d_id(id), d_quantity(quantity) {}
+//  };
+//..
+// Then, we create some orders, which in practice would come from a pool, and
+// queue them at their price level:
+//..
+//  Order a(1, 100), b(2, 200), c(3, 300);
+//
+//  bslalg::IntrusiveList<Order> level;
+//  level.pushBack(&a);
+//  level.pushBack(&b);
+//  level.pushBack(&c);
+//
+//  assert(3 == level.size());
+//  assert(1 == level.front().d_id);
+//..
+// Next, order 2 is cancelled, and we remove it from the queue in constant
+// time, knowing only its address:
+//..
+//  level.remove(&b);
+//
+//  assert(false == b.isLinked());
+//  assert(2     == level.size());
+//..
+// Then, a trade fills the order at the front of the queue:
+//..
+//  Order *filled = level.popFront();
+//
+//  assert(&a == filled);
+//..
+// Finally, we iterate over the orders that remain:
+//..
+//  int totalQuantity = 0;
+//  for (bslalg::IntrusiveList<Order>::const_iterator it = level.begin();
+//       it != level.end();
+//       ++it) {
+//      totalQuantity += it->d_quantity;
+//  }
+//  assert(300 == totalQuantity);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
+#include <bslalg_bidirectionallink.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALLINKLISTUTIL
+#include <bslalg_bidirectionallinklistutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                          // =======================
+                          // class IntrusiveListHook
+                          // =======================
+
+template <class TAG = void>
+class IntrusiveListHook : public BidirectionalLink {
+    // This class provides the links through which an object of a type
+    // publicly derived from it is held in an 'IntrusiveList' having the same
+    // (template parameter) 'TAG'.  A hook that is not in a list has null
+    // links.
+
+  public:
+    // CREATORS
+    IntrusiveListHook();
+        // Create a hook that is not in a list.
+
+    IntrusiveListHook(const IntrusiveListHook& original);
+        // Create a hook that is not in a list.  Note that the links of the
+        // specified 'original' hook are not copied.
+
+    //! ~IntrusiveListHook() = default;
+        // Destroy this object.  The behavior is undefined unless this hook is
+        // not in a list.
+
+    // MANIPULATORS
+    IntrusiveListHook& operator=(const IntrusiveListHook& rhs);
+        // Leave this hook unchanged, whatever the value of the specified
+        // 'rhs', and return a reference providing modifiable access to this
+        // hook.
+
+    // ACCESSORS
+    bool isLinked() const;
+        // Return 'true' if this hook is in a list, and 'false' otherwise.
+};
+
+                        // ============================
+                        // class IntrusiveList_Iterator
+                        // ============================
+
+template <class VALUE, class TAG>
+class IntrusiveList_Iterator {
+    // This class provides a bidirectional iterator over an 'IntrusiveList' of
+    // elements of the (template parameter) 'VALUE' type, which may be
+    // 'const'-qualified.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type NcType;
+    typedef IntrusiveList_Iterator<NcType, TAG>  NcIter;
+    typedef IntrusiveListHook<TAG>               Hook;
+
+    // DATA
+    BidirectionalLink *d_link_p;  // current position
+
+    // FRIENDS
+    template <class OTHER_VALUE, class OTHER_TAG>
+    friend class IntrusiveList_Iterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                value_type;
+    typedef native_std::ptrdiff_t difference_type;
+    typedef VALUE                *pointer;
+    typedef VALUE&                reference;
+
+    // CREATORS
+    IntrusiveList_Iterator();
+        // Create an iterator that does not refer to any position.
+
+    explicit IntrusiveList_Iterator(BidirectionalLink *link);
+        // Create an iterator at the specified 'link', which is either the
+        // hook of an element or the sentinel of a list.
+
+    IntrusiveList_Iterator(const NcIter& original);                 // IMPLICIT
+        // Create an iterator at the same position as the specified
+        // 'original' iterator.  Note that this constructor enables converting
+        // from modifiable to 'const' iterator types.
+
+    // MANIPULATORS
+    IntrusiveList_Iterator& operator++();
+        // Move this iterator to the next position in the list and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element.
+
+    IntrusiveList_Iterator& operator--();
+        // Move this iterator to the previous position in the list and return
+        // a reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element
+        // other than the first, or to the past-the-end position of a
+        // non-empty list.
+
+    IntrusiveList_Iterator operator++(int);
+        // Move this iterator to the next position in the list and return its
+        // previous value.  The behavior is undefined unless this iterator
+        // refers to an element.
+
+    IntrusiveList_Iterator operator--(int);
+        // Move this iterator to the previous position in the list and return
+        // its previous value.  The behavior is undefined unless this iterator
+        // refers to an element other than the first, or to the past-the-end
+        // position of a non-empty list.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    BidirectionalLink *link() const;
+        // Return the address of the link at which this iterator is
+        // positioned.
+};
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+bool operator==(const IntrusiveList_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveList_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same position, and 'false' otherwise.
+
+template <class VALUE1, class VALUE2, class TAG>
+bool operator!=(const IntrusiveList_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveList_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer
+    // to the same position, and 'false' otherwise.
+
+                           // ===================
+                           // class IntrusiveList
+                           // ===================
+
+template <class TYPE, class TAG = void>
+class IntrusiveList {
+    // This class implements a circular doubly-linked list of objects of the
+    // (template parameter) 'TYPE', which must publicly derive from
+    // 'IntrusiveListHook<TAG>'.  The list links, but neither owns nor copies,
+    // its elements, and none of its operations allocates memory or throws.
+
+    // PRIVATE TYPES
+    typedef IntrusiveListHook<TAG>    Hook;
+    typedef BidirectionalLinkListUtil ListUtil;
+
+    // DATA
+    BidirectionalLink   d_sentinel;  // past-the-end position, linked to the
+                                     // last and the first elements
+
+    native_std::size_t  d_size;      // number of elements
+
+  private:
+    // NOT IMPLEMENTED
+    IntrusiveList(const IntrusiveList&);
+    IntrusiveList& operator=(const IntrusiveList&);
+
+    // PRIVATE CLASS METHODS
+    static BidirectionalLink *toLink(TYPE *object);
+        // Return the address of the hook of the specified 'object'.
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE                                     value_type;
+    typedef TYPE&                                    reference;
+    typedef const TYPE&                              const_reference;
+    typedef native_std::size_t                       size_type;
+    typedef IntrusiveList_Iterator<TYPE, TAG>        iterator;
+    typedef IntrusiveList_Iterator<const TYPE, TAG>  const_iterator;
+
+    // CREATORS
+    IntrusiveList();
+        // Create an empty list.
+
+    ~IntrusiveList();
+        // Remove all elements from this list, and destroy it.  Note that the
+        // elements themselves are not destroyed.
+
+    // MANIPULATORS
+    iterator begin();
+        // Return an iterator at the first element of this list, or 'end()'
+        // if this list is empty.
+
+    iterator end();
+        // Return an iterator at the past-the-end position of this list.
+
+    reference front();
+        // Return a reference to the first element of this list.  The
+        // behavior is undefined if this list is empty.
+
+    reference back();
+        // Return a reference to the last element of this list.  The behavior
+        // is undefined if this list is empty.
+
+    void pushFront(TYPE *object);
+        // Insert the specified 'object' at the front of this list.  The
+        // behavior is undefined unless 'object' is not in a list through
+        // 'IntrusiveListHook<TAG>'.
+
+    void pushBack(TYPE *object);
+        // Insert the specified 'object' at the back of this list.  The
+        // behavior is undefined unless 'object' is not in a list through
+        // 'IntrusiveListHook<TAG>'.
+
+    iterator insert(const_iterator position, TYPE *object);
+        // Insert the specified 'object' into this list immediately before
+        // the specified 'position', and return an iterator at 'object'.  The
+        // behavior is undefined unless 'position' is a position in this list
+        // and 'object' is not in a list through 'IntrusiveListHook<TAG>'.
+
+    TYPE *popFront();
+        // Remove the first element from this list and return its address.
+        // The behavior is undefined if this list is empty.
+
+    TYPE *popBack();
+        // Remove the last element from this list and return its address.
+        // The behavior is undefined if this list is empty.
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this list and
+        // return an iterator at the element that followed it.  The behavior
+        // is undefined unless 'position' refers to an element of this list.
+
+    void remove(TYPE *object);
+        // Remove the specified 'object' from this list in constant time.  The
+        // behavior is undefined unless 'object' is an element of this list.
+
+    void removeAll();
+        // Remove all elements from this list.  Note that the elements are not
+        // destroyed.
+
+    void splice(const_iterator position, IntrusiveList *other);
+        // Move all elements of the specified 'other' list, in order, into
+        // this list immediately before the specified 'position', in constant
+        // time, leaving 'other' empty.  The behavior is undefined unless
+        // 'position' is a position in this list and 'other' is not this list.
+
+    void swap(IntrusiveList& other);
+        // Exchange the elements of this list with those of the specified
+        // 'other' list in constant time.
+
+    iterator iteratorTo(TYPE *object);
+        // Return an iterator at the specified 'object'.  The behavior is
+        // undefined unless 'object' is an element of this list.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator at the first element of this list, or 'end()'
+        // if this list is empty.
+
+    const_iterator end() const;
+        // Return an iterator at the past-the-end position of this list.
+
+    const_reference front() const;
+        // Return a reference to the first element of this list.  The
+        // behavior is undefined if this list is empty.
+
+    const_reference back() const;
+        // Return a reference to the last element of this list.  The behavior
+        // is undefined if this list is empty.
+
+    bool isEmpty() const;
+        // Return 'true' if this list has no elements, and 'false' otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this list.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class IntrusiveListHook
+                          // -----------------------
+
+// CREATORS
+template <class TAG>
+inline
+IntrusiveListHook<TAG>::IntrusiveListHook()
+{
+    reset();
+}
+
+template <class TAG>
+inline
+IntrusiveListHook<TAG>::IntrusiveListHook(const IntrusiveListHook&)
+: BidirectionalLink()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class TAG>
+inline
+IntrusiveListHook<TAG>&
+IntrusiveListHook<TAG>::operator=(const IntrusiveListHook&)
+{
+    return *this;
+}
+
+// ACCESSORS
+template <class TAG>
+inline
+bool IntrusiveListHook<TAG>::isLinked() const
+{
+    return 0 != nextLink();
+}
+
+                        // ----------------------------
+                        // class IntrusiveList_Iterator
+                        // ----------------------------
+
+// CREATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>::IntrusiveList_Iterator()
+: d_link_p(0)
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>::IntrusiveList_Iterator(
+                                                       BidirectionalLink *link)
+: d_link_p(link)
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>::IntrusiveList_Iterator(
+                                                       const NcIter& original)
+: d_link_p(original.d_link_p)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>&
+IntrusiveList_Iterator<VALUE, TAG>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_link_p);
+
+    d_link_p = d_link_p->nextLink();
+    return *this;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>&
+IntrusiveList_Iterator<VALUE, TAG>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_link_p);
+
+    d_link_p = d_link_p->previousLink();
+    return *this;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>
+IntrusiveList_Iterator<VALUE, TAG>::operator++(int)
+{
+    IntrusiveList_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveList_Iterator<VALUE, TAG>
+IntrusiveList_Iterator<VALUE, TAG>::operator--(int)
+{
+    IntrusiveList_Iterator result(*this);
+    --*this;
+    return result;
+}
+
+// ACCESSORS
+template <class VALUE, class TAG>
+inline
+typename IntrusiveList_Iterator<VALUE, TAG>::reference
+IntrusiveList_Iterator<VALUE, TAG>::operator*() const
+{
+    return *operator->();
+}
+
+template <class VALUE, class TAG>
+inline
+typename IntrusiveList_Iterator<VALUE, TAG>::pointer
+IntrusiveList_Iterator<VALUE, TAG>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_link_p);
+
+    return static_cast<VALUE *>(static_cast<Hook *>(d_link_p));
+}
+
+template <class VALUE, class TAG>
+inline
+BidirectionalLink *IntrusiveList_Iterator<VALUE, TAG>::link() const
+{
+    return d_link_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator==(const IntrusiveList_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveList_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.link() == rhs.link();
+}
+
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator!=(const IntrusiveList_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveList_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.link() != rhs.link();
+}
+
+namespace bslalg {
+
+                           // -------------------
+                           // class IntrusiveList
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class TAG>
+inline
+BidirectionalLink *IntrusiveList<TYPE, TAG>::toLink(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    return static_cast<Hook *>(object);
+}
+
+// CREATORS
+template <class TYPE, class TAG>
+inline
+IntrusiveList<TYPE, TAG>::IntrusiveList()
+: d_size(0)
+{
+    d_sentinel.setNextLink(&d_sentinel);
+    d_sentinel.setPreviousLink(&d_sentinel);
+}
+
+template <class TYPE, class TAG>
+inline
+IntrusiveList<TYPE, TAG>::~IntrusiveList()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::iterator IntrusiveList<TYPE, TAG>::begin()
+{
+    return iterator(d_sentinel.nextLink());
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::iterator IntrusiveList<TYPE, TAG>::end()
+{
+    return iterator(&d_sentinel);
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::reference IntrusiveList<TYPE, TAG>::front()
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    return *begin();
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::reference IntrusiveList<TYPE, TAG>::back()
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    return *iterator(d_sentinel.previousLink());
+}
+
+template <class TYPE, class TAG>
+inline
+void IntrusiveList<TYPE, TAG>::pushFront(TYPE *object)
+{
+    insert(begin(), object);
+}
+
+template <class TYPE, class TAG>
+inline
+void IntrusiveList<TYPE, TAG>::pushBack(TYPE *object)
+{
+    insert(end(), object);
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::iterator
+IntrusiveList<TYPE, TAG>::insert(const_iterator position, TYPE *object)
+{
+    BSLS_ASSERT_SAFE(position.link());
+    BSLS_ASSERT_SAFE(!static_cast<Hook *>(object)->isLinked());
+
+    BidirectionalLink *link = toLink(object);
+    ListUtil::insertLinkBeforeTarget(link, position.link());
+    ++d_size;
+    return iterator(link);
+}
+
+template <class TYPE, class TAG>
+inline
+TYPE *IntrusiveList<TYPE, TAG>::popFront()
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    TYPE *result = &front();
+    remove(result);
+    return result;
+}
+
+template <class TYPE, class TAG>
+inline
+TYPE *IntrusiveList<TYPE, TAG>::popBack()
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    TYPE *result = &back();
+    remove(result);
+    return result;
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::iterator
+IntrusiveList<TYPE, TAG>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position.link());
+    BSLS_ASSERT_SAFE(position.link() != &d_sentinel);
+
+    BidirectionalLink *link = position.link();
+    BidirectionalLink *next = link->nextLink();
+    ListUtil::unlink(link);
+    link->reset();
+    --d_size;
+    return iterator(next);
+}
+
+template <class TYPE, class TAG>
+inline
+void IntrusiveList<TYPE, TAG>::remove(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    erase(const_iterator(toLink(object)));
+}
+
+template <class TYPE, class TAG>
+void IntrusiveList<TYPE, TAG>::removeAll()
+{
+    BidirectionalLink *link = d_sentinel.nextLink();
+    while (&d_sentinel != link) {
+        BidirectionalLink *next = link->nextLink();
+        link->reset();
+        link = next;
+    }
+    d_sentinel.setNextLink(&d_sentinel);
+    d_sentinel.setPreviousLink(&d_sentinel);
+    d_size = 0;
+}
+
+template <class TYPE, class TAG>
+void IntrusiveList<TYPE, TAG>::splice(const_iterator  position,
+                                      IntrusiveList  *other)
+{
+    BSLS_ASSERT_SAFE(position.link());
+    BSLS_ASSERT_SAFE(other);
+    BSLS_ASSERT_SAFE(this != other);
+
+    if (other->isEmpty()) {
+        return;                                                       // RETURN
+    }
+
+    // Splicing the range out of 'other' rejoins its sentinel to itself.
+
+    ListUtil::spliceListBeforeTarget(other->d_sentinel.nextLink(),
+                                     other->d_sentinel.previousLink(),
+                                     position.link());
+    d_size += other->d_size;
+    other->d_size = 0;
+}
+
+template <class TYPE, class TAG>
+void IntrusiveList<TYPE, TAG>::swap(IntrusiveList& other)
+{
+    IntrusiveList temp;
+    temp.splice(temp.end(), this);
+    splice(end(), &other);
+    other.splice(other.end(), &temp);
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::iterator
+IntrusiveList<TYPE, TAG>::iteratorTo(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    return iterator(toLink(object));
+}
+
+// ACCESSORS
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::const_iterator
+IntrusiveList<TYPE, TAG>::begin() const
+{
+    return const_iterator(d_sentinel.nextLink());
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::const_iterator
+IntrusiveList<TYPE, TAG>::end() const
+{
+    return const_iterator(const_cast<BidirectionalLink *>(&d_sentinel));
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::const_reference
+IntrusiveList<TYPE, TAG>::front() const
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    return *begin();
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::const_reference
+IntrusiveList<TYPE, TAG>::back() const
+{
+    BSLS_ASSERT_SAFE(!isEmpty());
+
+    return *const_iterator(d_sentinel.previousLink());
+}
+
+template <class TYPE, class TAG>
+inline
+bool IntrusiveList<TYPE, TAG>::isEmpty() const
+{
+    return 0 == d_size;
+}
+
+template <class TYPE, class TAG>
+inline
+typename IntrusiveList<TYPE, TAG>::size_type
+IntrusiveList<TYPE, TAG>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,904 @@
+// bslalg_intrusivelist.t.cpp                                         -*-C++-*-
+
+#include <bslalg_intrusivelist.h>
+
+#include <bslalg_bidirectionallink.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bslalg;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a hook type and an intrusive list of
+// objects deriving from it.  The list links caller-owned objects and does not
+// allocate, so the tests create arrays of elements on the stack, manipulate
+// them through the list, and verify, after each operation, that the list is
+// well formed in both directions, holds the expected elements in the expected
+// order, and that exactly the elements in the list report being linked.
+// ----------------------------------------------------------------------------
+// CLASS 'IntrusiveListHook'
+// [ 2] IntrusiveListHook();
+// [ 2] IntrusiveListHook(const IntrusiveListHook& original);
+// [ 2] IntrusiveListHook& operator=(const IntrusiveListHook& rhs);
+// [ 2] bool isLinked() const;
+//
+// CLASS 'IntrusiveList'
+// [ 3] IntrusiveList();
+// [ 5] ~IntrusiveList();
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reference front();
+// [ 3] reference back();
+// [ 3] void pushFront(TYPE *object);
+// [ 3] void pushBack(TYPE *object);
+// [ 4] iterator insert(const_iterator position, TYPE *object);
+// [ 3] TYPE *popFront();
+// [ 3] TYPE *popBack();
+// [ 4] iterator erase(const_iterator position);
+// [ 4] void remove(TYPE *object);
+// [ 5] void removeAll();
+// [ 5] void splice(const_iterator position, IntrusiveList *other);
+// [ 5] void swap(IntrusiveList& other);
+// [ 4] iterator iteratorTo(TYPE *object);
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_reference front() const;
+// [ 3] const_reference back() const;
+// [ 3] bool isEmpty() const;
+// [ 3] size_type size() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] MULTIPLE HOOKS
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TagA;
+struct TagB;
+
+struct Element : IntrusiveListHook<> {
+    // This 'struct' is an element of the lists under test, identified by a
+    // single character.
+
+    char d_id;
+
+    explicit Element(char id = '?') : d_id(id) {}
+};
+
+struct MultiElement : IntrusiveListHook<TagA>, IntrusiveListHook<TagB> {
+    // This 'struct' is an element that may be in two lists at once.
+
+    int d_id;
+
+    explicit MultiElement(int id = 0) : d_id(id) {}
+};
+
+typedef IntrusiveList<Element> Obj;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+void makeElements(Element *elements, int numElements)
+    // Give the specified 'numElements' elements of the specified 'elements'
+    // array the identifiers 'a', 'b', 'c', ... in order.
+{
+    for (int i = 0; i < numElements; ++i) {
+        elements[i].d_id = static_cast<char>('a' + i);
+    }
+}
+
+bool verify(const Obj& list, const char *spec)
+    // Return 'true' if the specified 'list' holds, in order, elements having
+    // the identifiers in the specified 'spec', and is consistently linked in
+    // both directions, and 'false' otherwise.
+{
+    const int len = static_cast<int>(strlen(spec));
+
+    if (list.size() != static_cast<Obj::size_type>(len)
+     || list.isEmpty() != (0 == len)) {
+        return false;                                                 // RETURN
+    }
+
+    int i = 0;
+    for (Obj::const_iterator it = list.begin(); it != list.end(); ++it, ++i) {
+        if (i >= len || spec[i] != it->d_id || !it->isLinked()) {
+            return false;                                             // RETURN
+        }
+        const BidirectionalLink *link = it.link();
+        if (link->nextLink()->previousLink() != link
+         || link->previousLink()->nextLink() != link) {
+            return false;                                             // RETURN
+        }
+    }
+    if (i != len) {
+        return false;                                                 // RETURN
+    }
+
+    Obj::const_iterator it = list.end();
+    for (i = len - 1; i >= 0; --i) {
+        --it;
+        if (spec[i] != (*it).d_id) {
+            return false;                                             // RETURN
+        }
+    }
+    return it == list.begin();
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining the Queue of Orders at a Price Level
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we keep, for each price level of an order book, the orders waiting
+// at that price in their order of arrival, and we must be able to cancel any
+// order quickly, without allocating memory in either case.
+//
+// First, we define an order type that derives from 'IntrusiveListHook':
+//..
+    struct Order : bslalg::IntrusiveListHook<> {
+        int d_id;
+        int d_quantity;
+
+        Order(int id, int quantity) : d_id(id), d_quantity(quantity) {}
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create some orders, which in practice would come from a pool, and
+// queue them at their price level:
+//..
+    Order a(1, 100), b(2, 200), c(3, 300);
+
+    bslalg::IntrusiveList<Order> level;
+    level.pushBack(&a);
+    level.pushBack(&b);
+    level.pushBack(&c);
+
+    ASSERT(3 == level.size());
+    ASSERT(1 == level.front().d_id);
+//..
+// Next, order 2 is cancelled, and we remove it from the queue in constant
+// time, knowing only its address:
+//..
+    level.remove(&b);
+
+    ASSERT(false == b.isLinked());
+    ASSERT(2     == level.size());
+//..
+// Then, a trade fills the order at the front of the queue:
+//..
+    Order *filled = level.popFront();
+
+    ASSERT(&a == filled);
+//..
+// Finally, we iterate over the orders that remain:
+//..
+    int totalQuantity = 0;
+    for (bslalg::IntrusiveList<Order>::const_iterator it = level.begin();
+         it != level.end();
+         ++it) {
+        totalQuantity += it->d_quantity;
+    }
+    ASSERT(300 == totalQuantity);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // MULTIPLE HOOKS
+        //
+        // Concerns:
+        //: 1 An object deriving from hooks having different tags can be in a
+        //:   list for each tag at the same time.
+        //:
+        //: 2 Operations on a list through one hook do not affect the other.
+        //
+        // Plan:
+        //: 1 Put elements deriving from two hooks into two lists, in opposite
+        //:   orders, and remove elements from one list, verifying both lists
+        //:   and the 'isLinked' state of each hook.  (C-1..2)
+        //
+        // Testing:
+        //   MULTIPLE HOOKS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMULTIPLE HOOKS"
+                            "\n==============\n");
+
+        typedef IntrusiveListHook<TagA> HookA;
+        typedef IntrusiveListHook<TagB> HookB;
+
+        enum { k_NUM_ELEMENTS = 5 };
+
+        MultiElement elements[k_NUM_ELEMENTS];
+
+        IntrusiveList<MultiElement, TagA> listA;
+        IntrusiveList<MultiElement, TagB> listB;
+
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            elements[i].d_id = i;
+            listA.pushBack(&elements[i]);
+            listB.pushFront(&elements[i]);
+        }
+        ASSERT(k_NUM_ELEMENTS == listA.size());
+        ASSERT(k_NUM_ELEMENTS == listB.size());
+
+        int i = 0;
+        for (IntrusiveList<MultiElement, TagA>::iterator it = listA.begin();
+             it != listA.end();
+             ++it, ++i) {
+            ASSERTV(i, it->d_id, i == it->d_id);
+        }
+        for (IntrusiveList<MultiElement, TagB>::iterator it = listB.begin();
+             it != listB.end();
+             ++it) {
+            --i;
+            ASSERTV(i, it->d_id, i == it->d_id);
+        }
+
+        listA.remove(&elements[2]);
+
+        ASSERT(false == static_cast<HookA&>(elements[2]).isLinked());
+        ASSERT(true  == static_cast<HookB&>(elements[2]).isLinked());
+        ASSERT(k_NUM_ELEMENTS - 1 == listA.size());
+        ASSERT(k_NUM_ELEMENTS     == listB.size());
+
+        listB.removeAll();
+
+        for (int j = 0; j < k_NUM_ELEMENTS; ++j) {
+            ASSERTV(j,
+                    (2 != j) == static_cast<HookA&>(elements[j]).isLinked());
+            ASSERTV(j, !static_cast<HookB&>(elements[j]).isLinked());
+        }
+        listA.removeAll();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'splice', 'swap', 'removeAll', AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'splice' moves all elements of the other list, in order, before
+        //:   the given position, and leaves the other list empty and usable.
+        //:
+        //: 2 Splicing an empty list has no effect.
+        //:
+        //: 3 'swap' exchanges the elements of two lists, either or both of
+        //:   which may be empty.
+        //:
+        //: 4 'removeAll' and the destructor unlink every element.
+        //
+        // Plan:
+        //: 1 Splice lists of various lengths into every position of lists of
+        //:   various lengths, and verify the result.  (C-1..2)
+        //:
+        //: 2 Swap lists of various lengths, and verify both.  (C-3)
+        //:
+        //: 3 Remove all elements, and destroy a non-empty list, and verify
+        //:   that no element is linked.  (C-4)
+        //
+        // Testing:
+        //   ~IntrusiveList();
+        //   void removeAll();
+        //   void splice(const_iterator position, IntrusiveList *other);
+        //   void swap(IntrusiveList& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'splice', 'swap', 'removeAll', AND DESTRUCTOR"
+                            "\n============================================="
+                            "\n");
+
+        static const char *SPECS[] = { "", "a", "ab", "abc", "abcd" };
+        const int NUM_SPECS = static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+        if (verbose) printf("Testing 'splice'.\n");
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *SPEC1 = SPECS[ti];
+            const int   LEN1  = static_cast<int>(strlen(SPEC1));
+
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                const int LEN2 = static_cast<int>(strlen(SPECS[tj]));
+
+                for (int pos = 0; pos <= LEN1; ++pos) {
+                    Element e1[4];
+                    Element e2[4];
+                    makeElements(e1, 4);
+                    for (int k = 0; k < 4; ++k) {
+                        e2[k].d_id = static_cast<char>('A' + k);
+                    }
+
+                    Obj x;  Obj y;
+                    for (int k = 0; k < LEN1; ++k) x.pushBack(&e1[k]);
+                    for (int k = 0; k < LEN2; ++k) y.pushBack(&e2[k]);
+
+                    Obj::iterator position = x.begin();
+                    for (int k = 0; k < pos; ++k) ++position;
+
+                    x.splice(position, &y);
+
+                    char expected[16];
+                    int  n = 0;
+                    for (int k = 0; k < pos; ++k) expected[n++] = SPEC1[k];
+                    for (int k = 0; k < LEN2; ++k) {
+                        expected[n++] = static_cast<char>('A' + k);
+                    }
+                    for (int k = pos; k < LEN1; ++k) expected[n++] = SPEC1[k];
+                    expected[n] = '\0';
+
+                    ASSERTV(ti, tj, pos, verify(x, expected));
+                    ASSERTV(ti, tj, pos, verify(y, ""));
+
+
+                    // The emptied list remains usable.
+
+                    Element extra('X');
+                    y.pushBack(&extra);
+                    ASSERTV(ti, tj, pos, verify(y, "X"));
+                    y.removeAll();
+                }
+            }
+        }
+
+        if (verbose) printf("Testing 'swap'.\n");
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *SPEC1 = SPECS[ti];
+            const int   LEN1  = static_cast<int>(strlen(SPEC1));
+
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                const char *SPEC2 = SPECS[tj];
+                const int   LEN2  = static_cast<int>(strlen(SPEC2));
+
+                Element e1[4];
+                Element e2[4];
+                makeElements(e1, 4);
+                makeElements(e2, 4);
+
+                Obj x;  Obj y;
+                for (int k = 0; k < LEN1; ++k) x.pushBack(&e1[k]);
+                for (int k = 0; k < LEN2; ++k) y.pushBack(&e2[k]);
+
+                x.swap(y);
+
+                ASSERTV(ti, tj, verify(x, SPEC2));
+                ASSERTV(ti, tj, verify(y, SPEC1));
+                ASSERTV(ti, tj, 0 == LEN2 || &e2[0] == &x.front());
+                ASSERTV(ti, tj, 0 == LEN1 || &e1[0] == &y.front());
+            }
+        }
+
+        if (verbose) printf("Testing 'removeAll' and destructor.\n");
+        {
+            Element e[4];
+            makeElements(e, 4);
+
+            Obj x;
+            for (int k = 0; k < 4; ++k) x.pushBack(&e[k]);
+
+            x.removeAll();
+            ASSERT(verify(x, ""));
+            for (int k = 0; k < 4; ++k) {
+                ASSERTV(k, !e[k].isLinked());
+            }
+
+            x.removeAll();
+            ASSERT(verify(x, ""));
+
+            {
+                Obj y;
+                for (int k = 0; k < 4; ++k) y.pushFront(&e[k]);
+                ASSERT(verify(y, "dcba"));
+            }
+            for (int k = 0; k < 4; ++k) {
+                ASSERTV(k, !e[k].isLinked());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'insert', 'erase', 'remove', AND 'iteratorTo'
+        //
+        // Concerns:
+        //: 1 'insert' links the object immediately before the position, which
+        //:   may be any position including 'end()', and returns an iterator
+        //:   at the object.
+        //:
+        //: 2 'erase' unlinks the element at the position and returns an
+        //:   iterator at the next position.
+        //:
+        //: 3 'remove' unlinks an element given only its address.
+        //:
+        //: 4 'iteratorTo' returns an iterator at the object.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For lists of every length up to a maximum, insert an element at
+        //:   every position, and verify the result.  (C-1)
+        //:
+        //: 2 For lists of every length up to a maximum, erase and remove the
+        //:   element at every position, and verify the result.  (C-2..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   iterator insert(const_iterator position, TYPE *object);
+        //   iterator erase(const_iterator position);
+        //   void remove(TYPE *object);
+        //   iterator iteratorTo(TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert', 'erase', 'remove', AND 'iteratorTo'"
+                            "\n============================================="
+                            "\n");
+
+        static const char SPEC[] = "abcdef";
+        enum { k_MAX_LENGTH = sizeof SPEC - 1 };
+
+        if (verbose) printf("Testing 'insert'.\n");
+
+        for (int len = 0; len <= k_MAX_LENGTH; ++len) {
+            for (int pos = 0; pos <= len; ++pos) {
+                Element e[k_MAX_LENGTH];
+                makeElements(e, k_MAX_LENGTH);
+                Element extra('X');
+
+                Obj x;
+                for (int k = 0; k < len; ++k) x.pushBack(&e[k]);
+
+                Obj::const_iterator position = x.begin();
+                for (int k = 0; k < pos; ++k) ++position;
+
+                Obj::iterator result = x.insert(position, &extra);
+                ASSERTV(len, pos, &extra == &*result);
+                ASSERTV(len, pos, position == ++result);
+
+                char expected[16];
+                int  n = 0;
+                for (int k = 0; k < pos; ++k) expected[n++] = SPEC[k];
+                expected[n++] = 'X';
+                for (int k = pos; k < len; ++k) expected[n++] = SPEC[k];
+                expected[n] = '\0';
+
+                ASSERTV(len, pos, verify(x, expected));
+            }
+        }
+
+        if (verbose) printf("Testing 'erase', 'remove', and 'iteratorTo'.\n");
+
+        for (int len = 1; len <= k_MAX_LENGTH; ++len) {
+            for (int pos = 0; pos < len; ++pos) {
+                char expected[16];
+                int  n = 0;
+                for (int k = 0; k < len; ++k) {
+                    if (k != pos) expected[n++] = SPEC[k];
+                }
+                expected[n] = '\0';
+
+                {
+                    Element e[k_MAX_LENGTH];
+                    makeElements(e, k_MAX_LENGTH);
+
+                    Obj x;
+                    for (int k = 0; k < len; ++k) x.pushBack(&e[k]);
+
+                    Obj::iterator it = x.iteratorTo(&e[pos]);
+                    ASSERTV(len, pos, &e[pos] == &*it);
+
+                    Obj::iterator next = x.erase(it);
+                    ASSERTV(len, pos, verify(x, expected));
+                    ASSERTV(len, pos, !e[pos].isLinked());
+                    ASSERTV(len, pos, pos + 1 == len
+                                      ? x.end() == next
+                                      : &e[pos + 1] == &*next);
+                }
+                {
+                    Element e[k_MAX_LENGTH];
+                    makeElements(e, k_MAX_LENGTH);
+
+                    Obj x;
+                    for (int k = 0; k < len; ++k) x.pushBack(&e[k]);
+
+                    x.remove(&e[pos]);
+                    ASSERTV(len, pos, verify(x, expected));
+                    ASSERTV(len, pos, !e[pos].isLinked());
+
+                    // The removed element can be inserted again.
+
+                    x.pushFront(&e[pos]);
+                    ASSERTV(len, pos, &e[pos] == &x.front());
+                }
+            }
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Element a('a'), b('b');
+            Obj x;
+            x.pushBack(&a);
+
+            ASSERT_SAFE_FAIL(x.insert(x.end(), &a));
+            ASSERT_SAFE_FAIL(x.erase(x.end()));
+            ASSERT_SAFE_FAIL(x.remove(&b));
+            ASSERT_SAFE_PASS(x.insert(x.end(), &b));
+            ASSERT_SAFE_PASS(x.remove(&b));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed list is empty, and 'begin() == end()'.
+        //:
+        //: 2 'pushFront' and 'pushBack' add elements at the respective ends.
+        //:
+        //: 3 'popFront' and 'popBack' remove and return the element at the
+        //:   respective ends, and unlink it.
+        //:
+        //: 4 'front', 'back', 'size', 'isEmpty', and iteration, forward and
+        //:   backward, through modifiable and non-modifiable iterators,
+        //:   reflect the contents of the list.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Build lists by pushing elements at either end, following a
+        //:   table of instructions, verifying the list after each step, then
+        //:   empty the list from either end, again verifying each step.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   IntrusiveList();
+        //   iterator begin();
+        //   iterator end();
+        //   reference front();
+        //   reference back();
+        //   void pushFront(TYPE *object);
+        //   void pushBack(TYPE *object);
+        //   TYPE *popFront();
+        //   TYPE *popBack();
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   bool isEmpty() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASIC MANIPULATORS AND ACCESSORS"
+                            "\n================================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_pushes;    // 'F'/'B': push front/back next element
+            const char *d_expected;  // contents after all pushes
+            const char *d_pops;      // 'F'/'B': pop front/back
+        } DATA[] = {
+            // LINE  PUSHES   EXPECTED  POPS
+            // ----  ------   --------  ------
+            {  L_,   "",      "",       ""      },
+            {  L_,   "F",     "a",      "F"     },
+            {  L_,   "B",     "a",      "B"     },
+            {  L_,   "FF",    "ba",     "FB"    },
+            {  L_,   "BB",    "ab",     "BF"    },
+            {  L_,   "FB",    "ab",     "FF"    },
+            {  L_,   "BF",    "ba",     "BB"    },
+            {  L_,   "BBFF",  "dcab",   "FBFB"  },
+            {  L_,   "FBFBF", "ecabd",  "BBFFB" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *PUSHES   = DATA[ti].d_pushes;
+            const char *EXPECTED = DATA[ti].d_expected;
+            const char *POPS     = DATA[ti].d_pops;
+            const int   LEN      = static_cast<int>(strlen(PUSHES));
+
+            Element e[8];
+            makeElements(e, 8);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(LINE, verify(X, ""));
+            ASSERTV(LINE, X.begin() == X.end());
+            ASSERTV(LINE, mX.begin() == mX.end());
+
+            for (int k = 0; k < LEN; ++k) {
+                if ('F' == PUSHES[k]) {
+                    mX.pushFront(&e[k]);
+                    ASSERTV(LINE, k, &e[k] == &mX.front());
+                    ASSERTV(LINE, k, &e[k] == &X.front());
+                }
+                else {
+                    mX.pushBack(&e[k]);
+                    ASSERTV(LINE, k, &e[k] == &mX.back());
+                    ASSERTV(LINE, k, &e[k] == &X.back());
+                }
+                ASSERTV(LINE, k, e[k].isLinked());
+                ASSERTV(LINE, k, k + 1 == static_cast<int>(X.size()));
+            }
+            ASSERTV(LINE, verify(X, EXPECTED));
+
+            char remaining[16];
+            strcpy(remaining, EXPECTED);
+            for (int k = 0; k < LEN; ++k) {
+                const int n = static_cast<int>(strlen(remaining));
+                Element  *p;
+                if ('F' == POPS[k]) {
+                    p = mX.popFront();
+                    ASSERTV(LINE, k, remaining[0] == p->d_id);
+                    memmove(remaining, remaining + 1, n);
+                }
+                else {
+                    p = mX.popBack();
+                    ASSERTV(LINE, k, remaining[n - 1] == p->d_id);
+                    remaining[n - 1] = '\0';
+                }
+                ASSERTV(LINE, k, !p->isLinked());
+                ASSERTV(LINE, k, verify(X, remaining));
+            }
+            ASSERTV(LINE, X.isEmpty());
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Element a('a');
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.front());
+            ASSERT_SAFE_FAIL(mX.back());
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(mX.popFront());
+            ASSERT_SAFE_FAIL(mX.popBack());
+
+            mX.pushBack(&a);
+
+            ASSERT_SAFE_PASS(mX.front());
+            ASSERT_SAFE_PASS(X.back());
+            ASSERT_SAFE_FAIL(mX.pushBack(&a));
+            ASSERT_SAFE_PASS(mX.popBack());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'IntrusiveListHook'
+        //
+        // Concerns:
+        //: 1 A default-constructed hook is not linked, and has null links.
+        //:
+        //: 2 Neither copy construction nor copy assignment copies links.
+        //
+        // Plan:
+        //: 1 Create hooks, copy a linked hook, and assign from a linked hook,
+        //:   and verify 'isLinked' and the links of each.  (C-1..2)
+        //
+        // Testing:
+        //   IntrusiveListHook();
+        //   IntrusiveListHook(const IntrusiveListHook& original);
+        //   IntrusiveListHook& operator=(const IntrusiveListHook& rhs);
+        //   bool isLinked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'IntrusiveListHook'"
+                            "\n===================\n");
+
+        Element a('a');
+        ASSERT(!a.isLinked());
+        ASSERT(0 == a.nextLink());
+        ASSERT(0 == a.previousLink());
+
+        Obj x;
+        x.pushBack(&a);
+        ASSERT(a.isLinked());
+
+        Element b(a);
+        ASSERT('a' == b.d_id);
+        ASSERT(!b.isLinked());
+        ASSERT(0 == b.nextLink());
+        ASSERT(0 == b.previousLink());
+
+        Element c('c');
+        c = a;
+        ASSERT('a' == c.d_id);
+        ASSERT(!c.isLinked());
+
+        x.pushBack(&b);
+        a = Element('z');
+        ASSERT('z' == a.d_id);
+        ASSERT(a.isLinked());
+        ASSERT(verify(x, "za"));
+
+        x.removeAll();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push, iterate, remove, and pop elements of a list.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Element e[3];
+        makeElements(e, 3);
+
+        Obj x;
+        ASSERT(x.isEmpty());
+
+        x.pushBack(&e[1]);
+        x.pushFront(&e[0]);
+        x.pushBack(&e[2]);
+        ASSERT(verify(x, "abc"));
+
+        x.remove(&e[1]);
+        ASSERT(verify(x, "ac"));
+
+        ASSERT(&e[2] == x.popBack());
+        ASSERT(&e[0] == x.popFront());
+        ASSERT(x.isEmpty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
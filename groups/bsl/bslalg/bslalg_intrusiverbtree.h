@@ -0,0 +1,1080 @@
+// bslalg_intrusiverbtree.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLALG_INTRUSIVERBTREE
+#define INCLUDED_BSLALG_INTRUSIVERBTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered red-black tree of objects owned by the caller.
+//
+//@CLASSES:
+//  bslalg::IntrusiveRbTreeHook: base class linking an object into a tree
+//  bslalg::IntrusiveRbTree: ordered tree of objects linked through hooks
+//
+//@SEE_ALSO: bslalg_rbtreeutil, bslalg_intrusivelist, bslalg_intrusivehashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslalg::IntrusiveRbTree', implementing an ordered red-black tree of objects
+// that are created, owned, and destroyed by the caller, and a class template,
+// 'bslalg::IntrusiveRbTreeHook', from which the type of those objects must
+// publicly derive.  The hook is a 'bslalg::RbTreeNode', so that the nodes of
+// the tree are the elements themselves, and the tree is maintained by
+// 'bslalg::RbTreeUtil', exactly as the nodes of 'bsl::map' are.  Consequently,
+// a tree never allocates memory, and, provided the comparator does not throw,
+// none of its operations can throw.  An element can be removed from a tree
+// given only its address, without first searching for it.  These properties
+// make an intrusive tree suitable for structures, such as the price levels of
+// an order book or a queue of timers ordered by deadline, in which objects
+// are frequently inserted and removed and the latency of an allocation is not
+// acceptable.
+//
+// The (template parameter) 'COMPARATOR' orders the elements: it must provide a
+// strict weak ordering through a method that can be called as if it had the
+// signature:
+//..
+//  bool operator()(const TYPE& lhs, const TYPE& rhs) const;
+//..
+// The lookup methods 'find', 'lowerBound', and 'upperBound' are templates on
+// the type of their argument, so that a comparator that can also compare
+// elements with some other type, 'KEY', through methods that can be called as
+// if they had the signatures:
+//..
+//  bool operator()(const TYPE& lhs, const KEY& rhs) const;
+//  bool operator()(const KEY& lhs, const TYPE& rhs) const;
+//..
+// allows elements to be looked up by a 'KEY' (e.g., a price) without creating
+// an element to compare against.  Elements that are equivalent under the
+// comparator are permitted: 'insert' places an element after any equivalent
+// elements already in the tree, while 'insertIfMissing' does not insert an
+// element equivalent to one already in the tree.
+//
+///Multiple Hooks
+///--------------
+// The (template parameter) 'TAG' of 'IntrusiveRbTreeHook' and
+// 'IntrusiveRbTree' distinguishes the hooks of a type that is to be in
+// several trees at once, as described in 'bslalg_intrusivelist'.  A type can
+// also derive from the hooks of 'bslalg_intrusivelist' and
+// 'bslalg_intrusivehashset'.
+//
+///Element Lifetime
+///----------------
+// The tree does not own its elements.  The behavior is undefined if an
+// element is destroyed, or its position in the order defined by the
+// comparator is changed, while it is in a tree.  The destructor of
+// 'IntrusiveRbTree' removes (but does not destroy) any elements remaining in
+// the tree.  Copying an element does not copy its links.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Scheduling Timers by Deadline
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need a queue of timers, ordered by deadline, from which timers
+// are frequently cancelled before they expire, and which must not allocate
+// memory when a timer is scheduled.
+//
+// First, we define a timer type that derives from 'IntrusiveRbTreeHook', and
+// a comparator that orders timers by deadline, and that can also compare a
+// timer with a bare deadline:
+//..
+//  struct Timer : bslalg::IntrusiveRbTreeHook<> {
+//      int d_deadline;
+//      int d_id;
+//
+//      Timer(int deadline, int id) : d_deadline(deadline), d_id(id) {}
+//  };
+//
+//  struct TimerLess {
+//      bool operator()(const Timer& lhs, const Timer& rhs) const
+//      {
+//          return lhs.d_deadline < rhs.d_deadline;
+//      }
+//
+//      bool operator()(const Timer& lhs, int rhs) const
+//      {
+//          return lhs.d_deadline < rhs;
+//      }
+//
+//      bool operator()(int lhs, const Timer& rhs) const
+//      {
+//          return lhs < rhs.d_deadline;
+//      }
+//  };
+//..
+// Then, we schedule some timers:
+//..
+//  Timer t1(30, 1), t2(10, 2), t3(20, 3), t4(10, 4);
+//
+//  bslalg::IntrusiveRbTree<Timer, TimerLess> timers;
+//  timers.insert(&t1);
+//  timers.insert(&t2);
+//  timers.insert(&t3);
+//  timers.insert(&t4);
+//
+//  assert(4 == timers.size());
+//..
+// Next, timer 3 is cancelled, and we remove it knowing only its address:
+//..
+//  timers.remove(&t3);
+//  assert(false == t3.isLinked());
+//..
+// Now, the time reaches 15, and we fire, in order, the timers whose deadlines
+// have passed; note that timers having equal deadlines fire in the order in
+// which they were scheduled:
+//..
+//  int fired[4];
+//  int numFired = 0;
+//
+//  while (!timers.isEmpty() && timers.begin()->d_deadline <= 15) {
+//      fired[numFired++] = timers.begin()->d_id;
+//      timers.erase(timers.begin());
+//  }
+//
+//  assert(2 == numFired);
+//  assert(2 == fired[0]);
+//  assert(4 == fired[1]);
+//..
+// Finally, we look up the first timer due at or after time 25, using the
+// comparator's ability to compare a timer with a bare deadline:
+//..
+//  assert(&t1 == &*timers.lowerBound(25));
+//  assert(timers.end() == timers.find(25));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEANCHOR
+#include <bslalg_rbtreeanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEUTIL
+#include <bslalg_rbtreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                         // =========================
+                         // class IntrusiveRbTreeHook
+                         // =========================
+
+template <class TAG = void>
+class IntrusiveRbTreeHook : public RbTreeNode {
+    // This class provides the node through which an object of a type publicly
+    // derived from it is held in an 'IntrusiveRbTree' having the same
+    // (template parameter) 'TAG'.  A hook that is not in a tree has a null
+    // parent.
+
+  public:
+    // CREATORS
+    IntrusiveRbTreeHook();
+        // Create a hook that is not in a tree.
+
+    IntrusiveRbTreeHook(const IntrusiveRbTreeHook& original);
+        // Create a hook that is not in a tree.  Note that the links of the
+        // specified 'original' hook are not copied.
+
+    //! ~IntrusiveRbTreeHook() = default;
+        // Destroy this object.  The behavior is undefined unless this hook is
+        // not in a tree.
+
+    // MANIPULATORS
+    IntrusiveRbTreeHook& operator=(const IntrusiveRbTreeHook& rhs);
+        // Leave this hook unchanged, whatever the value of the specified
+        // 'rhs', and return a reference providing modifiable access to this
+        // hook.
+
+    void unlink();
+        // Reset this hook to the state of a hook that is not in a tree.  Note
+        // that this method does not remove this hook from the tree (if any)
+        // holding it, and is intended for use by 'IntrusiveRbTree' only.
+
+    // ACCESSORS
+    bool isLinked() const;
+        // Return 'true' if this hook is in a tree, and 'false' otherwise.
+};
+
+                       // ==============================
+                       // class IntrusiveRbTree_Iterator
+                       // ==============================
+
+template <class VALUE, class TAG>
+class IntrusiveRbTree_Iterator {
+    // This class provides a bidirectional iterator, in order, over an
+    // 'IntrusiveRbTree' of elements of the (template parameter) 'VALUE' type,
+    // which may be 'const'-qualified.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type  NcType;
+    typedef IntrusiveRbTree_Iterator<NcType, TAG> NcIter;
+    typedef IntrusiveRbTreeHook<TAG>              Hook;
+
+    // DATA
+    RbTreeNode *d_node_p;  // current position
+
+    // FRIENDS
+    template <class OTHER_VALUE, class OTHER_TAG>
+    friend class IntrusiveRbTree_Iterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                value_type;
+    typedef native_std::ptrdiff_t difference_type;
+    typedef VALUE                *pointer;
+    typedef VALUE&                reference;
+
+    // CREATORS
+    IntrusiveRbTree_Iterator();
+        // Create an iterator that does not refer to any position.
+
+    explicit IntrusiveRbTree_Iterator(const RbTreeNode *node);
+        // Create an iterator at the specified 'node', which is either the
+        // hook of an element or the sentinel of a tree.
+
+    IntrusiveRbTree_Iterator(const NcIter& original);               // IMPLICIT
+        // Create an iterator at the same position as the specified
+        // 'original' iterator.  Note that this constructor enables converting
+        // from modifiable to 'const' iterator types.
+
+    // MANIPULATORS
+    IntrusiveRbTree_Iterator& operator++();
+        // Move this iterator to the next position in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element.
+
+    IntrusiveRbTree_Iterator& operator--();
+        // Move this iterator to the previous position in the tree and return
+        // a reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element
+        // other than the first, or to the past-the-end position of a
+        // non-empty tree.
+
+    IntrusiveRbTree_Iterator operator++(int);
+        // Move this iterator to the next position in the tree and return its
+        // previous value.  The behavior is undefined unless this iterator
+        // refers to an element.
+
+    IntrusiveRbTree_Iterator operator--(int);
+        // Move this iterator to the previous position in the tree and return
+        // its previous value.  The behavior is undefined unless this iterator
+        // refers to an element other than the first, or to the past-the-end
+        // position of a non-empty tree.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element.
+
+    RbTreeNode *node() const;
+        // Return the address of the node at which this iterator is
+        // positioned.
+};
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+bool operator==(const IntrusiveRbTree_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveRbTree_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same position, and 'false' otherwise.
+
+template <class VALUE1, class VALUE2, class TAG>
+bool operator!=(const IntrusiveRbTree_Iterator<VALUE1, TAG>& lhs,
+                const IntrusiveRbTree_Iterator<VALUE2, TAG>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer
+    // to the same position, and 'false' otherwise.
+
+                    // ====================================
+                    // class IntrusiveRbTree_NodeComparator
+                    // ====================================
+
+template <class TYPE, class COMPARATOR, class TAG>
+class IntrusiveRbTree_NodeComparator {
+    // This class adapts a comparator of objects of the (template parameter)
+    // 'TYPE' to the node comparisons required by 'RbTreeUtil', by converting
+    // each node to the element of which it is the hook.
+
+    // PRIVATE TYPES
+    typedef IntrusiveRbTreeHook<TAG> Hook;
+
+    // DATA
+    const COMPARATOR& d_comparator;  // comparator of elements
+
+    // NOT IMPLEMENTED
+    IntrusiveRbTree_NodeComparator& operator=(
+                                        const IntrusiveRbTree_NodeComparator&);
+
+    // PRIVATE CLASS METHODS
+    static const TYPE& toValue(const RbTreeNode& node);
+        // Return a reference to the element of which the specified 'node' is
+        // the hook.
+
+  public:
+    // CREATORS
+    explicit IntrusiveRbTree_NodeComparator(const COMPARATOR& comparator);
+        // Create an adaptor of the specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const;
+        // Return 'true' if the element of the specified 'lhs' node is ordered
+        // before that of the specified 'rhs' node, and 'false' otherwise.
+
+    template <class KEY>
+    bool operator()(const RbTreeNode& lhs, const KEY& rhs) const;
+        // Return 'true' if the element of the specified 'lhs' node is ordered
+        // before the specified 'rhs' key, and 'false' otherwise.
+
+    template <class KEY>
+    bool operator()(const KEY& lhs, const RbTreeNode& rhs) const;
+        // Return 'true' if the specified 'lhs' key is ordered before the
+        // element of the specified 'rhs' node, and 'false' otherwise.
+};
+
+                      // ================================
+                      // struct IntrusiveRbTree_Unlinker
+                      // ================================
+
+template <class TAG>
+struct IntrusiveRbTree_Unlinker {
+    // This 'struct' provides the node "factory" through which
+    // 'RbTreeUtil::deleteTree' unlinks, rather than deletes, the elements of
+    // an 'IntrusiveRbTree'.
+
+    // MANIPULATORS
+    void deleteNode(RbTreeNode *node);
+        // Reset the hook of the specified 'node' to the state of a hook that
+        // is not in a tree.
+};
+
+                          // =====================
+                          // class IntrusiveRbTree
+                          // =====================
+
+template <class TYPE, class COMPARATOR, class TAG = void>
+class IntrusiveRbTree {
+    // This class implements an ordered red-black tree of objects of the
+    // (template parameter) 'TYPE', which must publicly derive from
+    // 'IntrusiveRbTreeHook<TAG>', ordered by the (template parameter)
+    // 'COMPARATOR'.  The tree links, but neither owns nor copies, its
+    // elements, and none of its operations allocates memory.
+
+    // PRIVATE TYPES
+    typedef IntrusiveRbTreeHook<TAG> Hook;
+    typedef IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>
+                                     NodeComparator;
+
+    // DATA
+    RbTreeAnchor d_tree;        // root, first node, sentinel, and count
+    COMPARATOR   d_comparator;  // orders the elements
+
+  private:
+    // NOT IMPLEMENTED
+    IntrusiveRbTree(const IntrusiveRbTree&);
+    IntrusiveRbTree& operator=(const IntrusiveRbTree&);
+
+    // PRIVATE CLASS METHODS
+    static RbTreeNode *toNode(TYPE *object);
+        // Return the address of the hook of the specified 'object'.
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE                                       value_type;
+    typedef TYPE&                                      reference;
+    typedef const TYPE&                                const_reference;
+    typedef native_std::size_t                         size_type;
+    typedef COMPARATOR                                 value_compare;
+    typedef IntrusiveRbTree_Iterator<TYPE, TAG>        iterator;
+    typedef IntrusiveRbTree_Iterator<const TYPE, TAG>  const_iterator;
+
+    // CREATORS
+    IntrusiveRbTree();
+    explicit IntrusiveRbTree(const COMPARATOR& comparator);
+        // Create an empty tree.  Optionally specify a 'comparator' used to
+        // order the elements; if 'comparator' is not specified, a
+        // default-constructed 'COMPARATOR' is used.
+
+    ~IntrusiveRbTree();
+        // Remove all elements from this tree, and destroy it.  Note that the
+        // elements themselves are not destroyed.
+
+    // MANIPULATORS
+    iterator begin();
+        // Return an iterator at the first element of this tree, or 'end()'
+        // if this tree is empty.
+
+    iterator end();
+        // Return an iterator at the past-the-end position of this tree.
+
+    iterator insert(TYPE *object);
+        // Insert the specified 'object' into this tree, after any equivalent
+        // elements, in O(log(N)) time, where 'N' is the number of elements in
+        // this tree, and return an iterator at 'object'.  The behavior is
+        // undefined unless 'object' is not in a tree through
+        // 'IntrusiveRbTreeHook<TAG>'.
+
+    iterator insert(const_iterator hint, TYPE *object);
+        // Insert the specified 'object' into this tree, using the specified
+        // 'hint' as a suggestion of the position immediately after that of
+        // 'object', and return an iterator at 'object'.  If 'hint' is that
+        // position, this operation takes amortized constant time, and
+        // O(log(N)) time otherwise, where 'N' is the number of elements in
+        // this tree.  Note that 'object' is placed immediately before 'hint'
+        // if that position preserves the order of this tree, even if elements
+        // equivalent to 'object' precede 'hint'.  The behavior is undefined
+        // unless 'hint' is a position in this tree and 'object' is not in a
+        // tree through 'IntrusiveRbTreeHook<TAG>'.
+
+    iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+        // Insert the specified 'object' into this tree if it holds no element
+        // equivalent to 'object', and load 'true' into the specified
+        // 'isInsertedFlag' in that case, and 'false' otherwise.  Return an
+        // iterator at 'object' if it is inserted, and at the equivalent
+        // element otherwise.  The behavior is undefined unless 'object' is
+        // not in a tree through 'IntrusiveRbTreeHook<TAG>'.
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this tree in
+        // amortized constant time, and return an iterator at the element that
+        // followed it.  The behavior is undefined unless 'position' refers to
+        // an element of this tree.
+
+    void remove(TYPE *object);
+        // Remove the specified 'object' from this tree in amortized constant
+        // time.  The behavior is undefined unless 'object' is an element of
+        // this tree.
+
+    void removeAll();
+        // Remove all elements from this tree in O(N) time, where 'N' is the
+        // number of elements.  Note that the elements are not destroyed.
+
+    void swap(IntrusiveRbTree& other);
+        // Exchange the elements and comparator of this tree with those of the
+        // specified 'other' tree.
+
+    iterator iteratorTo(TYPE *object);
+        // Return an iterator at the specified 'object'.  The behavior is
+        // undefined unless 'object' is an element of this tree.
+
+    template <class KEY>
+    iterator find(const KEY& key);
+        // Return an iterator at the first element of this tree equivalent to
+        // the specified 'key', or 'end()' if there is no such element.
+
+    template <class KEY>
+    iterator lowerBound(const KEY& key);
+        // Return an iterator at the first element of this tree not ordered
+        // before the specified 'key', or 'end()' if there is no such element.
+
+    template <class KEY>
+    iterator upperBound(const KEY& key);
+        // Return an iterator at the first element of this tree ordered after
+        // the specified 'key', or 'end()' if there is no such element.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator at the first element of this tree, or 'end()'
+        // if this tree is empty.
+
+    const_iterator end() const;
+        // Return an iterator at the past-the-end position of this tree.
+
+    template <class KEY>
+    const_iterator find(const KEY& key) const;
+        // Return an iterator at the first element of this tree equivalent to
+        // the specified 'key', or 'end()' if there is no such element.
+
+    template <class KEY>
+    const_iterator lowerBound(const KEY& key) const;
+        // Return an iterator at the first element of this tree not ordered
+        // before the specified 'key', or 'end()' if there is no such element.
+
+    template <class KEY>
+    const_iterator upperBound(const KEY& key) const;
+        // Return an iterator at the first element of this tree ordered after
+        // the specified 'key', or 'end()' if there is no such element.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference to the comparator ordering the elements of this
+        // tree.
+
+    bool isEmpty() const;
+        // Return 'true' if this tree has no elements, and 'false' otherwise.
+
+    bool isWellFormed() const;
+        // Return 'true' if this tree is a valid red-black tree ordered by its
+        // comparator, and 'false' otherwise.  Note that this method takes
+        // O(N) time, where 'N' is the number of elements, and is intended for
+        // testing.
+
+    size_type size() const;
+        // Return the number of elements in this tree.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class IntrusiveRbTreeHook
+                         // -------------------------
+
+// CREATORS
+template <class TAG>
+inline
+IntrusiveRbTreeHook<TAG>::IntrusiveRbTreeHook()
+{
+    unlink();
+}
+
+template <class TAG>
+inline
+IntrusiveRbTreeHook<TAG>::IntrusiveRbTreeHook(const IntrusiveRbTreeHook&)
+: RbTreeNode()
+{
+    unlink();
+}
+
+// MANIPULATORS
+template <class TAG>
+inline
+IntrusiveRbTreeHook<TAG>&
+IntrusiveRbTreeHook<TAG>::operator=(const IntrusiveRbTreeHook&)
+{
+    return *this;
+}
+
+template <class TAG>
+inline
+void IntrusiveRbTreeHook<TAG>::unlink()
+{
+    reset(0, 0, 0, RbTreeNode::BSLALG_BLACK);
+}
+
+// ACCESSORS
+template <class TAG>
+inline
+bool IntrusiveRbTreeHook<TAG>::isLinked() const
+{
+    return 0 != parent();
+}
+
+                       // ------------------------------
+                       // class IntrusiveRbTree_Iterator
+                       // ------------------------------
+
+// CREATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>::IntrusiveRbTree_Iterator()
+: d_node_p(0)
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>::IntrusiveRbTree_Iterator(
+                                                        const RbTreeNode *node)
+: d_node_p(const_cast<RbTreeNode *>(node))
+{
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>::IntrusiveRbTree_Iterator(
+                                                       const NcIter& original)
+: d_node_p(original.d_node_p)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>&
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    d_node_p = RbTreeUtil::next(d_node_p);
+    return *this;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>&
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    d_node_p = RbTreeUtil::previous(d_node_p);
+    return *this;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator++(int)
+{
+    IntrusiveRbTree_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class VALUE, class TAG>
+inline
+IntrusiveRbTree_Iterator<VALUE, TAG>
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator--(int)
+{
+    IntrusiveRbTree_Iterator result(*this);
+    --*this;
+    return result;
+}
+
+// ACCESSORS
+template <class VALUE, class TAG>
+inline
+typename IntrusiveRbTree_Iterator<VALUE, TAG>::reference
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator*() const
+{
+    return *operator->();
+}
+
+template <class VALUE, class TAG>
+inline
+typename IntrusiveRbTree_Iterator<VALUE, TAG>::pointer
+IntrusiveRbTree_Iterator<VALUE, TAG>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return static_cast<VALUE *>(static_cast<Hook *>(d_node_p));
+}
+
+template <class VALUE, class TAG>
+inline
+RbTreeNode *IntrusiveRbTree_Iterator<VALUE, TAG>::node() const
+{
+    return d_node_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator==(const IntrusiveRbTree_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveRbTree_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.node() == rhs.node();
+}
+
+template <class VALUE1, class VALUE2, class TAG>
+inline
+bool bslalg::operator!=(const IntrusiveRbTree_Iterator<VALUE1, TAG>& lhs,
+                        const IntrusiveRbTree_Iterator<VALUE2, TAG>& rhs)
+{
+    return lhs.node() != rhs.node();
+}
+
+namespace bslalg {
+
+                    // ------------------------------------
+                    // class IntrusiveRbTree_NodeComparator
+                    // ------------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+const TYPE& IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>::toValue(
+                                                        const RbTreeNode& node)
+{
+    return static_cast<const TYPE&>(static_cast<const Hook&>(node));
+}
+
+// CREATORS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>::
+                IntrusiveRbTree_NodeComparator(const COMPARATOR& comparator)
+: d_comparator(comparator)
+{
+}
+
+// ACCESSORS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+bool IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>::operator()(
+                                                 const RbTreeNode& lhs,
+                                                 const RbTreeNode& rhs) const
+{
+    return d_comparator(toValue(lhs), toValue(rhs));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+bool IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>::operator()(
+                                                  const RbTreeNode& lhs,
+                                                  const KEY&        rhs) const
+{
+    return d_comparator(toValue(lhs), rhs);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+bool IntrusiveRbTree_NodeComparator<TYPE, COMPARATOR, TAG>::operator()(
+                                                  const KEY&        lhs,
+                                                  const RbTreeNode& rhs) const
+{
+    return d_comparator(lhs, toValue(rhs));
+}
+
+                      // --------------------------------
+                      // struct IntrusiveRbTree_Unlinker
+                      // --------------------------------
+
+// MANIPULATORS
+template <class TAG>
+inline
+void IntrusiveRbTree_Unlinker<TAG>::deleteNode(RbTreeNode *node)
+{
+    static_cast<IntrusiveRbTreeHook<TAG> *>(node)->unlink();
+}
+
+                          // ---------------------
+                          // class IntrusiveRbTree
+                          // ---------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+RbTreeNode *IntrusiveRbTree<TYPE, COMPARATOR, TAG>::toNode(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(object);
+
+    return static_cast<Hook *>(object);
+}
+
+// CREATORS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::IntrusiveRbTree()
+: d_tree()
+, d_comparator()
+{
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::IntrusiveRbTree(
+                                                 const COMPARATOR& comparator)
+: d_tree()
+, d_comparator(comparator)
+{
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::~IntrusiveRbTree()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::begin()
+{
+    return iterator(d_tree.firstNode());
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::end()
+{
+    return iterator(d_tree.sentinel());
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::insert(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(!static_cast<Hook *>(object)->isLinked());
+
+    NodeComparator comparator(d_comparator);
+    bool           leftChildFlag;
+    RbTreeNode    *parent = RbTreeUtil::findInsertLocation(&leftChildFlag,
+                                                           &d_tree,
+                                                           comparator,
+                                                           *object);
+    RbTreeNode    *node   = toNode(object);
+    RbTreeUtil::insertAt(&d_tree, parent, leftChildFlag, node);
+    return iterator(node);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::insert(const_iterator  hint,
+                                               TYPE           *object)
+{
+    BSLS_ASSERT_SAFE(hint.node());
+    BSLS_ASSERT_SAFE(!static_cast<Hook *>(object)->isLinked());
+
+    NodeComparator comparator(d_comparator);
+    bool           leftChildFlag;
+    RbTreeNode    *parent = RbTreeUtil::findInsertLocation(&leftChildFlag,
+                                                           &d_tree,
+                                                           comparator,
+                                                           *object,
+                                                           hint.node());
+    RbTreeNode    *node   = toNode(object);
+    RbTreeUtil::insertAt(&d_tree, parent, leftChildFlag, node);
+    return iterator(node);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::insertIfMissing(bool *isInsertedFlag,
+                                                        TYPE *object)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+    BSLS_ASSERT_SAFE(!static_cast<Hook *>(object)->isLinked());
+
+    NodeComparator comparator(d_comparator);
+    int            comparisonResult;
+    RbTreeNode    *parent = RbTreeUtil::findUniqueInsertLocation(
+                                                             &comparisonResult,
+                                                             &d_tree,
+                                                             comparator,
+                                                             *object);
+    if (0 == comparisonResult) {
+        *isInsertedFlag = false;
+        return iterator(parent);                                      // RETURN
+    }
+
+    RbTreeNode *node = toNode(object);
+    RbTreeUtil::insertAt(&d_tree, parent, comparisonResult < 0, node);
+    *isInsertedFlag = true;
+    return iterator(node);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position.node());
+    BSLS_ASSERT_SAFE(position.node() != d_tree.sentinel());
+
+    RbTreeNode *node = position.node();
+    RbTreeNode *next = RbTreeUtil::next(node);
+    RbTreeUtil::remove(&d_tree, node);
+    static_cast<Hook *>(node)->unlink();
+    return iterator(next);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+void IntrusiveRbTree<TYPE, COMPARATOR, TAG>::remove(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    RbTreeNode *node = toNode(object);
+    RbTreeUtil::remove(&d_tree, node);
+    static_cast<Hook *>(node)->unlink();
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+void IntrusiveRbTree<TYPE, COMPARATOR, TAG>::removeAll()
+{
+    IntrusiveRbTree_Unlinker<TAG> unlinker;
+    RbTreeUtil::deleteTree(&d_tree, &unlinker);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+void IntrusiveRbTree<TYPE, COMPARATOR, TAG>::swap(IntrusiveRbTree& other)
+{
+    RbTreeUtil::swap(&d_tree, &other.d_tree);
+    SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iteratorTo(TYPE *object)
+{
+    BSLS_ASSERT_SAFE(static_cast<Hook *>(object)->isLinked());
+
+    return iterator(toNode(object));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::find(const KEY& key)
+{
+    NodeComparator comparator(d_comparator);
+    return iterator(RbTreeUtil::find(d_tree, comparator, key));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::lowerBound(const KEY& key)
+{
+    NodeComparator comparator(d_comparator);
+    return iterator(RbTreeUtil::lowerBound(d_tree, comparator, key));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::upperBound(const KEY& key)
+{
+    NodeComparator comparator(d_comparator);
+    return iterator(RbTreeUtil::upperBound(d_tree, comparator, key));
+}
+
+// ACCESSORS
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::const_iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::begin() const
+{
+    return const_iterator(d_tree.firstNode());
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::const_iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::end() const
+{
+    return const_iterator(d_tree.sentinel());
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::const_iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::find(const KEY& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return const_iterator(RbTreeUtil::find(d_tree, comparator, key));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::const_iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::lowerBound(const KEY& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return const_iterator(RbTreeUtil::lowerBound(d_tree, comparator, key));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+template <class KEY>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::const_iterator
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::upperBound(const KEY& key) const
+{
+    NodeComparator comparator(d_comparator);
+    return const_iterator(RbTreeUtil::upperBound(d_tree, comparator, key));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+const COMPARATOR& IntrusiveRbTree<TYPE, COMPARATOR, TAG>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+bool IntrusiveRbTree<TYPE, COMPARATOR, TAG>::isEmpty() const
+{
+    return 0 == d_tree.numNodes();
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+bool IntrusiveRbTree<TYPE, COMPARATOR, TAG>::isWellFormed() const
+{
+    return RbTreeUtil::isWellFormed(d_tree, NodeComparator(d_comparator));
+}
+
+template <class TYPE, class COMPARATOR, class TAG>
+inline
+typename IntrusiveRbTree<TYPE, COMPARATOR, TAG>::size_type
+IntrusiveRbTree<TYPE, COMPARATOR, TAG>::size() const
+{
+    return d_tree.numNodes();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
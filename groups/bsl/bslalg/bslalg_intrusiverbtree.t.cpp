@@ -0,0 +1,1080 @@
+// bslalg_intrusiverbtree.t.cpp                                       -*-C++-*-
+
+#include <bslalg_intrusiverbtree.h>
+
+#include <bslalg_rbtreenode.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bslalg;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a hook type and an intrusive red-black
+// tree of objects deriving from it.  The tree links caller-owned objects and
+// does not allocate, so the tests create arrays of elements, manipulate them
+// through the tree, and verify, after each operation, that the tree is a
+// valid red-black tree ('isWellFormed'), that iterating over it yields the
+// expected elements in order -- equivalent elements in order of insertion --
+// and that exactly the elements in the tree report being linked.  The
+// expected order is computed independently by sorting the elements.
+// ----------------------------------------------------------------------------
+// CLASS 'IntrusiveRbTreeHook'
+// [ 2] IntrusiveRbTreeHook();
+// [ 2] IntrusiveRbTreeHook(const IntrusiveRbTreeHook& original);
+// [ 2] IntrusiveRbTreeHook& operator=(const IntrusiveRbTreeHook& rhs);
+// [ 2] void unlink();
+// [ 2] bool isLinked() const;
+//
+// CLASS 'IntrusiveRbTree'
+// [ 3] IntrusiveRbTree();
+// [ 7] explicit IntrusiveRbTree(const COMPARATOR& comparator);
+// [ 7] ~IntrusiveRbTree();
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] iterator insert(TYPE *object);
+// [ 4] iterator insert(const_iterator hint, TYPE *object);
+// [ 4] iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+// [ 5] iterator erase(const_iterator position);
+// [ 5] void remove(TYPE *object);
+// [ 7] void removeAll();
+// [ 7] void swap(IntrusiveRbTree& other);
+// [ 5] iterator iteratorTo(TYPE *object);
+// [ 6] iterator find(const KEY& key);
+// [ 6] iterator lowerBound(const KEY& key);
+// [ 6] iterator upperBound(const KEY& key);
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 6] const_iterator find(const KEY& key) const;
+// [ 6] const_iterator lowerBound(const KEY& key) const;
+// [ 6] const_iterator upperBound(const KEY& key) const;
+// [ 7] const COMPARATOR& comparator() const;
+// [ 3] bool isEmpty() const;
+// [ 3] bool isWellFormed() const;
+// [ 3] size_type size() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct Element : IntrusiveRbTreeHook<> {
+    // This 'struct' is an element of the trees under test, ordered by its
+    // key, and identified by its sequence number.
+
+    int d_key;
+    int d_seq;
+
+    explicit Element(int key = 0, int seq = 0) : d_key(key), d_seq(seq) {}
+};
+
+class ElementLess {
+    // This class orders 'Element' objects by key, in ascending or descending
+    // order as specified at construction, and also compares them with bare
+    // keys.
+
+    // DATA
+    bool d_descending;
+
+  public:
+    // CREATORS
+    explicit ElementLess(bool descending = false) : d_descending(descending)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const Element& lhs, const Element& rhs) const
+    {
+        return (*this)(lhs.d_key, rhs.d_key);
+    }
+
+    bool operator()(const Element& lhs, int rhs) const
+    {
+        return (*this)(lhs.d_key, rhs);
+    }
+
+    bool operator()(int lhs, const Element& rhs) const
+    {
+        return (*this)(lhs, rhs.d_key);
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return d_descending ? rhs < lhs : lhs < rhs;
+    }
+
+    bool isDescending() const
+    {
+        return d_descending;
+    }
+};
+
+typedef IntrusiveRbTree<Element, ElementLess> Obj;
+
+enum { k_MAX_ELEMENTS = 256 };
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+int nextRandom(unsigned *state)
+    // Return the next value of a simple pseudo-random sequence whose state is
+    // held in the specified 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<int>((*state >> 16) & 0x7fff);
+}
+
+void makeElements(Element *elements,
+                  int      numElements,
+                  int      numKeys,
+                  unsigned seed)
+    // Give the specified 'numElements' elements of the specified 'elements'
+    // array pseudo-random keys in the range '[0 .. numKeys)', determined by
+    // the specified 'seed', and sequence numbers equal to their indices.
+{
+    for (int i = 0; i < numElements; ++i) {
+        elements[i].d_key = nextRandom(&seed) % numKeys;
+        elements[i].d_seq = i;
+    }
+}
+
+bool verify(const Obj&      tree,
+            const Element  *elements,
+            int             numElements,
+            const bool     *inTree)
+    // Return 'true' if the specified 'tree' is well formed and holds, in
+    // order, exactly those of the specified 'numElements' elements of the
+    // specified 'elements' array for which the specified 'inTree' array
+    // holds 'true', with equivalent elements in order of their sequence
+    // numbers, and 'false' otherwise.  Note that this function assumes that
+    // equivalent elements were inserted in order of sequence number.
+{
+    if (!tree.isWellFormed()) {
+        return false;                                                 // RETURN
+    }
+
+    // Sort the expected elements by (key, sequence number) with an insertion
+    // sort, which suffices for the small arrays used here.
+
+    const Element *expected[k_MAX_ELEMENTS];
+    int            numExpected = 0;
+    for (int i = 0; i < numElements; ++i) {
+        if (inTree[i] != elements[i].isLinked()) {
+            return false;                                             // RETURN
+        }
+        if (!inTree[i]) {
+            continue;
+        }
+        int j = numExpected++;
+        while (j > 0
+            && (tree.comparator()(elements[i], *expected[j - 1])
+             || (!tree.comparator()(*expected[j - 1], elements[i])
+              && elements[i].d_seq < expected[j - 1]->d_seq))) {
+            expected[j] = expected[j - 1];
+            --j;
+        }
+        expected[j] = &elements[i];
+    }
+
+    if (tree.size() != static_cast<Obj::size_type>(numExpected)
+     || tree.isEmpty() != (0 == numExpected)) {
+        return false;                                                 // RETURN
+    }
+
+    int i = 0;
+    for (Obj::const_iterator it = tree.begin(); it != tree.end(); ++it, ++i) {
+        if (i >= numExpected || expected[i] != &*it) {
+            return false;                                             // RETURN
+        }
+    }
+    if (i != numExpected) {
+        return false;                                                 // RETURN
+    }
+
+    Obj::const_iterator it = tree.end();
+    for (i = numExpected - 1; i >= 0; --i) {
+        --it;
+        if (expected[i] != it.operator->()) {
+            return false;                                             // RETURN
+        }
+    }
+    return it == tree.begin();
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Scheduling Timers by Deadline
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we need a queue of timers, ordered by deadline, from which timers
+// are frequently cancelled before they expire, and which must not allocate
+// memory when a timer is scheduled.
+//
+// First, we define a timer type that derives from 'IntrusiveRbTreeHook', and
+// a comparator that orders timers by deadline, and that can also compare a
+// timer with a bare deadline:
+//..
+    struct Timer : bslalg::IntrusiveRbTreeHook<> {
+        int d_deadline;
+        int d_id;
+
+        Timer(int deadline, int id) : d_deadline(deadline), d_id(id) {}
+    };
+
+    struct TimerLess {
+        bool operator()(const Timer& lhs, const Timer& rhs) const
+        {
+            return lhs.d_deadline < rhs.d_deadline;
+        }
+
+        bool operator()(const Timer& lhs, int rhs) const
+        {
+            return lhs.d_deadline < rhs;
+        }
+
+        bool operator()(int lhs, const Timer& rhs) const
+        {
+            return lhs < rhs.d_deadline;
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+    bool veryVeryVerbose     = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we schedule some timers:
+//..
+    Timer t1(30, 1), t2(10, 2), t3(20, 3), t4(10, 4);
+
+    bslalg::IntrusiveRbTree<Timer, TimerLess> timers;
+    timers.insert(&t1);
+    timers.insert(&t2);
+    timers.insert(&t3);
+    timers.insert(&t4);
+
+    ASSERT(4 == timers.size());
+//..
+// Next, timer 3 is cancelled, and we remove it knowing only its address:
+//..
+    timers.remove(&t3);
+    ASSERT(false == t3.isLinked());
+//..
+// Now, the time reaches 15, and we fire, in order, the timers whose deadlines
+// have passed; note that timers having equal deadlines fire in the order in
+// which they were scheduled:
+//..
+    int fired[4];
+    int numFired = 0;
+
+    while (!timers.isEmpty() && timers.begin()->d_deadline <= 15) {
+        fired[numFired++] = timers.begin()->d_id;
+        timers.erase(timers.begin());
+    }
+
+    ASSERT(2 == numFired);
+    ASSERT(2 == fired[0]);
+    ASSERT(4 == fired[1]);
+//..
+// Finally, we look up the first timer due at or after time 25, using the
+// comparator's ability to compare a timer with a bare deadline:
+//..
+    ASSERT(&t1 == &*timers.lowerBound(25));
+    ASSERT(timers.end() == timers.find(25));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'removeAll', DESTRUCTOR, 'swap', AND 'comparator'
+        //
+        // Concerns:
+        //: 1 'removeAll' and the destructor unlink every element, and leave
+        //:   the tree empty.
+        //:
+        //: 2 'swap' exchanges the elements and the comparators of two trees,
+        //:   either or both of which may be empty.
+        //:
+        //: 3 The comparator supplied at construction is used, and returned by
+        //:   'comparator'.
+        //
+        // Plan:
+        //: 1 Fill trees of various sizes, remove all elements, or destroy
+        //:   the tree, and verify that no element is linked.  (C-1)
+        //:
+        //: 2 Swap trees of various sizes, one ordered ascending and the other
+        //:   descending, and verify both.  (C-2..3)
+        //
+        // Testing:
+        //   explicit IntrusiveRbTree(const COMPARATOR& comparator);
+        //   ~IntrusiveRbTree();
+        //   void removeAll();
+        //   void swap(IntrusiveRbTree& other);
+        //   const COMPARATOR& comparator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\n'removeAll', DESTRUCTOR, 'swap', AND 'comparator'"
+                          "\n================================================="
+                          "\n");
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 32, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) printf("Testing 'removeAll' and destructor.\n");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            Element e[k_MAX_ELEMENTS];
+            bool    inTree[k_MAX_ELEMENTS] = { false };
+            makeElements(e, N, N + 1, ti);
+
+            {
+                Obj x;
+                for (int i = 0; i < N; ++i) x.insert(&e[i]);
+
+                x.removeAll();
+                ASSERTV(N, verify(x, e, N, inTree));
+
+                // The emptied tree remains usable.
+
+                for (int i = 0; i < N; ++i) {
+                    x.insert(&e[i]);
+                    inTree[i] = true;
+                }
+                ASSERTV(N, verify(x, e, N, inTree));
+            }
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(N, i, !e[i].isLinked());
+            }
+        }
+
+        if (verbose) printf("Testing 'swap' and 'comparator'.\n");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N1 = SIZES[ti];
+
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int N2 = SIZES[tj];
+
+                Element e1[k_MAX_ELEMENTS];
+                Element e2[k_MAX_ELEMENTS];
+                bool    in1[k_MAX_ELEMENTS];
+                bool    in2[k_MAX_ELEMENTS];
+                makeElements(e1, N1, 10, ti);
+                makeElements(e2, N2, 10, tj + 100);
+
+                Obj x;
+                Obj y(ElementLess(true));
+                ASSERT(!x.comparator().isDescending());
+                ASSERT( y.comparator().isDescending());
+
+                for (int i = 0; i < N1; ++i) {
+                    x.insert(&e1[i]);
+                    in1[i] = true;
+                }
+                for (int i = 0; i < N2; ++i) {
+                    y.insert(&e2[i]);
+                    in2[i] = true;
+                }
+
+                x.swap(y);
+
+                ASSERTV(N1, N2,  x.comparator().isDescending());
+                ASSERTV(N1, N2, !y.comparator().isDescending());
+                ASSERTV(N1, N2, verify(x, e2, N2, in2));
+                ASSERTV(N1, N2, verify(y, e1, N1, in1));
+
+                // Each tree remains usable.
+
+                Element extra(5, k_MAX_ELEMENTS);
+                x.insert(&extra);
+                ASSERTV(N1, N2, x.isWellFormed());
+                x.remove(&extra);
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'find', 'lowerBound', AND 'upperBound'
+        //
+        // Concerns:
+        //: 1 'find' returns the first element equivalent to the key, or
+        //:   'end()'.
+        //:
+        //: 2 'lowerBound' and 'upperBound' return the first element not
+        //:   ordered before, and ordered after, the key, respectively, or
+        //:   'end()'.
+        //:
+        //: 3 The lookups accept any key type the comparator accepts, and are
+        //:   available on 'const' trees.
+        //
+        // Plan:
+        //: 1 Fill trees of various sizes with elements having keys with
+        //:   many duplicates, look up every key in and around the range of
+        //:   keys, both by bare key and by element, through modifiable and
+        //:   'const' trees, and compare the results with a linear search.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   iterator find(const KEY& key);
+        //   iterator lowerBound(const KEY& key);
+        //   iterator upperBound(const KEY& key);
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator lowerBound(const KEY& key) const;
+        //   const_iterator upperBound(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'find', 'lowerBound', AND 'upperBound'"
+                            "\n======================================\n");
+
+        static const int SIZES[] = { 0, 1, 2, 5, 20, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N        = SIZES[ti];
+            const int NUM_KEYS = N / 3 + 2;
+
+            Element e[k_MAX_ELEMENTS];
+            makeElements(e, N, NUM_KEYS, ti);
+
+            Obj mX;  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) mX.insert(&e[i]);
+
+            for (int key = -1; key <= NUM_KEYS; ++key) {
+
+                // Linear search for the expected positions.
+
+                Obj::const_iterator expLower = X.end();
+                Obj::const_iterator expUpper = X.end();
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    if (expLower == X.end() && it->d_key >= key) {
+                        expLower = it;
+                    }
+                    if (expUpper == X.end() && it->d_key > key) {
+                        expUpper = it;
+                    }
+                }
+                Obj::const_iterator expFind =
+                       expLower != X.end() && expLower->d_key == key
+                       ? expLower
+                       : X.end();
+
+                const Element KEY(key);
+
+                ASSERTV(N, key, expFind  == mX.find(key));
+                ASSERTV(N, key, expFind  ==  X.find(key));
+                ASSERTV(N, key, expFind  ==  X.find(KEY));
+                ASSERTV(N, key, expLower == mX.lowerBound(key));
+                ASSERTV(N, key, expLower ==  X.lowerBound(key));
+                ASSERTV(N, key, expLower ==  X.lowerBound(KEY));
+                ASSERTV(N, key, expUpper == mX.upperBound(key));
+                ASSERTV(N, key, expUpper ==  X.upperBound(key));
+                ASSERTV(N, key, expUpper ==  X.upperBound(KEY));
+            }
+            mX.removeAll();
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'erase', 'remove', AND 'iteratorTo'
+        //
+        // Concerns:
+        //: 1 'erase' unlinks the element at the position, leaves a valid
+        //:   red-black tree, and returns an iterator at the next element.
+        //:
+        //: 2 'remove' unlinks an element given only its address.
+        //:
+        //: 3 'iteratorTo' returns an iterator at the element.
+        //:
+        //: 4 A removed element can be inserted again.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Fill trees of various sizes, then remove the elements in a
+        //:   pseudo-random order, alternately by 'erase' and 'remove',
+        //:   verifying the tree after each removal.  (C-1..3)
+        //:
+        //: 2 Re-insert removed elements and verify the tree.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   void remove(TYPE *object);
+        //   iterator iteratorTo(TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'erase', 'remove', AND 'iteratorTo'"
+                            "\n===================================\n");
+
+        static const int SIZES[] = { 1, 2, 3, 4, 5, 8, 17, 64, 200 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            Element e[k_MAX_ELEMENTS];
+            bool    inTree[k_MAX_ELEMENTS];
+            makeElements(e, N, N / 2 + 1, ti);
+
+            Obj x;
+            for (int i = 0; i < N; ++i) {
+                x.insert(&e[i]);
+                inTree[i] = true;
+            }
+
+            // Remove in a pseudo-random order.
+
+            int order[k_MAX_ELEMENTS];
+            for (int i = 0; i < N; ++i) order[i] = i;
+            unsigned seed = 7 + ti;
+            for (int i = N - 1; i > 0; --i) {
+                const int j = nextRandom(&seed) % (i + 1);
+                const int t = order[i];  order[i] = order[j];  order[j] = t;
+            }
+
+            for (int k = 0; k < N; ++k) {
+                Element *p = &e[order[k]];
+
+                Obj::iterator it = x.iteratorTo(p);
+                ASSERTV(N, k, p == &*it);
+
+                if (k % 2) {
+                    Obj::iterator expNext = it;
+                    ++expNext;
+                    const Element *nextElement = expNext == x.end()
+                                               ? 0
+                                               : &*expNext;
+
+                    Obj::iterator next = x.erase(it);
+                    ASSERTV(N, k, nextElement
+                                  ? nextElement == &*next
+                                  : x.end() == next);
+                }
+                else {
+                    x.remove(p);
+                }
+                inTree[order[k]] = false;
+
+                ASSERTV(N, k, !p->isLinked());
+                ASSERTV(N, k, verify(x, e, N, inTree));
+
+                // Every fourth removed element is inserted again, and removed
+                // again, to show that a removed element is reusable.
+
+                if (0 == k % 4) {
+                    const int seq = p->d_seq;
+                    p->d_seq = k_MAX_ELEMENTS;
+                    x.insert(p);
+                    inTree[order[k]] = true;
+                    ASSERTV(N, k, verify(x, e, N, inTree));
+                    x.remove(p);
+                    inTree[order[k]] = false;
+                    p->d_seq = seq;
+                }
+            }
+            ASSERTV(N, x.isEmpty());
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Element a(1), b(2);
+            Obj x;
+            x.insert(&a);
+
+            ASSERT_SAFE_FAIL(x.erase(x.end()));
+            ASSERT_SAFE_FAIL(x.remove(&b));
+            ASSERT_SAFE_FAIL(x.iteratorTo(&b));
+            ASSERT_SAFE_PASS(x.iteratorTo(&a));
+            ASSERT_SAFE_PASS(x.remove(&a));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'insert' WITH HINT, AND 'insertIfMissing'
+        //
+        // Concerns:
+        //: 1 'insert' with a hint inserts the element at its ordered position
+        //:   whether or not the hint is correct.
+        //:
+        //: 2 'insertIfMissing' inserts an element only if no equivalent
+        //:   element is present, reports whether it did, and returns an
+        //:   iterator at the inserted or equivalent element.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random elements with hints at 'begin()', 'end()',
+        //:   and the correct position, and verify the tree.  (C-1)
+        //:
+        //: 2 Insert elements having many duplicate keys with
+        //:   'insertIfMissing', and verify the flag, the returned iterator,
+        //:   and the tree.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   iterator insert(const_iterator hint, TYPE *object);
+        //   iterator insertIfMissing(bool *isInsertedFlag, TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' WITH HINT, AND 'insertIfMissing'"
+                            "\n=========================================\n");
+
+        enum { k_NUM_ELEMENTS = 100 };
+
+        if (verbose) printf("Testing 'insert' with hint.\n");
+
+        for (int mode = 0; mode < 3; ++mode) {
+            Element e[k_NUM_ELEMENTS];
+            bool    inTree[k_NUM_ELEMENTS] = { false };
+
+            // Elements equivalent to one at 'hint' are placed immediately
+            // before it, rather than after the last equivalent element, so
+            // keys are distinct unless the hint is the upper bound.
+
+            if (2 == mode) {
+                makeElements(e, k_NUM_ELEMENTS, 30, mode);
+            }
+            else {
+                for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                    e[i] = Element((i * 37) % k_NUM_ELEMENTS, i);
+                }
+            }
+
+            Obj x;
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                Obj::const_iterator hint = 0 == mode ? x.begin()
+                                         : 1 == mode ? x.end()
+                                         : x.upperBound(e[i].d_key);
+
+                Obj::iterator it = x.insert(hint, &e[i]);
+                inTree[i] = true;
+
+                ASSERTV(mode, i, &e[i] == &*it);
+                ASSERTV(mode, i, verify(x, e, k_NUM_ELEMENTS, inTree));
+            }
+        }
+
+        if (verbose) printf("Testing 'insertIfMissing'.\n");
+        {
+            Element e[k_NUM_ELEMENTS];
+            bool    inTree[k_NUM_ELEMENTS] = { false };
+            makeElements(e, k_NUM_ELEMENTS, 20, 99);
+
+            Obj x;
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                Obj::iterator existing = x.find(e[i].d_key);
+
+                bool isInserted;
+                Obj::iterator it = x.insertIfMissing(&isInserted, &e[i]);
+
+                if (x.end() == existing) {
+                    ASSERTV(i, isInserted);
+                    ASSERTV(i, &e[i] == &*it);
+                    inTree[i] = true;
+                }
+                else {
+                    ASSERTV(i, !isInserted);
+                    ASSERTV(i, existing == it);
+                    ASSERTV(i, !e[i].isLinked());
+                }
+                ASSERTV(i, verify(x, e, k_NUM_ELEMENTS, inTree));
+            }
+            ASSERT(20 >= x.size());
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Element a(1), b(2);
+            bool    flag;
+            Obj     x;
+            x.insert(&a);
+
+            ASSERT_SAFE_FAIL(x.insert(x.end(), &a));
+            ASSERT_SAFE_FAIL(x.insert(Obj::const_iterator(), &b));
+            ASSERT_SAFE_FAIL(x.insertIfMissing(&flag, &a));
+            ASSERT_SAFE_FAIL(x.insertIfMissing(0, &b));
+            ASSERT_SAFE_PASS(x.insertIfMissing(&flag, &b));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert', ITERATION, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty, and 'begin() == end()'.
+        //:
+        //: 2 'insert' links the element at its ordered position, after any
+        //:   equivalent elements, keeps the tree a valid red-black tree, and
+        //:   returns an iterator at the element.
+        //:
+        //: 3 Iteration, forward and backward, through modifiable and
+        //:   non-modifiable iterators, visits the elements in order.
+        //:
+        //: 4 'size' and 'isEmpty' reflect the number of elements.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Insert ascending, descending, and pseudo-random sequences of
+        //:   elements, with and without duplicate keys, verifying the tree
+        //:   after each insertion.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   IntrusiveRbTree();
+        //   iterator begin();
+        //   iterator end();
+        //   iterator insert(TYPE *object);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool isEmpty() const;
+        //   bool isWellFormed() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert', ITERATION, AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        enum { k_NUM_ELEMENTS = 200 };
+
+        for (int mode = 0; mode < 4; ++mode) {
+            Element e[k_NUM_ELEMENTS];
+            bool    inTree[k_NUM_ELEMENTS] = { false };
+
+            switch (mode) {
+              case 0: {  // ascending
+                for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                    e[i] = Element(i, i);
+                }
+              } break;
+              case 1: {  // descending
+                for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                    e[i] = Element(k_NUM_ELEMENTS - i, i);
+                }
+              } break;
+              case 2: {  // pseudo-random, mostly distinct
+                makeElements(e, k_NUM_ELEMENTS, 10000, 1);
+              } break;
+              default: {  // pseudo-random, many duplicates
+                makeElements(e, k_NUM_ELEMENTS, 7, 2);
+              } break;
+            }
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(mode, verify(X, e, k_NUM_ELEMENTS, inTree));
+            ASSERTV(mode, X.begin() == X.end());
+            ASSERTV(mode, mX.begin() == mX.end());
+
+            for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+                Obj::iterator it = mX.insert(&e[i]);
+                inTree[i] = true;
+
+                ASSERTV(mode, i, &e[i] == &*it);
+                ASSERTV(mode, i, e[i].isLinked());
+                ASSERTV(mode, i, verify(X, e, k_NUM_ELEMENTS, inTree));
+            }
+
+            // Modifiable iteration visits the same elements.
+
+            Obj::const_iterator cit = X.begin();
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it, ++cit) {
+                ASSERTV(mode, cit == it);
+                ASSERTV(mode, &*cit == &*it);
+            }
+            ASSERTV(mode, X.end() == cit);
+
+            // Post-increment and post-decrement.
+
+            Obj::iterator it = mX.begin();
+            Obj::iterator old = it++;
+            ASSERTV(mode, mX.begin() == old);
+            old = it--;
+            ASSERTV(mode, mX.begin() == it);
+            ASSERTV(mode, old != it);
+
+            mX.removeAll();
+        }
+
+        if (verbose) printf("Negative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Element a(1);
+            Obj x;
+            x.insert(&a);
+
+            ASSERT_SAFE_FAIL(x.insert(&a));
+            ASSERT_SAFE_FAIL(*Obj::iterator());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'IntrusiveRbTreeHook'
+        //
+        // Concerns:
+        //: 1 A default-constructed hook is not linked, and has no parent or
+        //:   children.
+        //:
+        //: 2 Neither copy construction nor copy assignment copies links.
+        //:
+        //: 3 'unlink' restores the state of a default-constructed hook.
+        //
+        // Plan:
+        //: 1 Create hooks, copy a linked hook, assign from a linked hook, and
+        //:   unlink a hook, and verify 'isLinked' and the links of each.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   IntrusiveRbTreeHook();
+        //   IntrusiveRbTreeHook(const IntrusiveRbTreeHook& original);
+        //   IntrusiveRbTreeHook& operator=(const IntrusiveRbTreeHook& rhs);
+        //   void unlink();
+        //   bool isLinked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'IntrusiveRbTreeHook'"
+                            "\n=====================\n");
+
+        Element a(1, 1);
+        ASSERT(!a.isLinked());
+        ASSERT(0 == a.parent());
+        ASSERT(0 == a.leftChild());
+        ASSERT(0 == a.rightChild());
+
+        Obj x;
+        x.insert(&a);
+        ASSERT(a.isLinked());
+
+        Element b(a);
+        ASSERT(1 == b.d_key);
+        ASSERT(!b.isLinked());
+        ASSERT(0 == b.parent());
+
+        Element c(3, 3);
+        c = a;
+        ASSERT(1 == c.d_key);
+        ASSERT(!c.isLinked());
+
+        b.d_key = 2;
+        x.insert(&b);
+        a = Element(0, 0);
+        ASSERT(0 == a.d_key);
+        ASSERT(a.isLinked());
+        ASSERT(x.isWellFormed());
+        ASSERT(2 == x.size());
+
+        x.removeAll();
+
+        c.reset(&a, &b, 0, RbTreeNode::BSLALG_RED);
+        ASSERT(c.isLinked());
+        c.unlink();
+        ASSERT(!c.isLinked());
+        ASSERT(0 == c.parent());
+        ASSERT(0 == c.leftChild());
+        ASSERT(0 == c.rightChild());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, iterate, look up, and remove elements of a tree.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Element e[5];
+        for (int i = 0; i < 5; ++i) {
+            e[i] = Element((i * 3) % 5, i);  // keys 0, 3, 1, 4, 2
+        }
+
+        Obj x;
+        ASSERT(x.isEmpty());
+
+        for (int i = 0; i < 5; ++i) {
+            x.insert(&e[i]);
+        }
+        ASSERT(5 == x.size());
+        ASSERT(x.isWellFormed());
+
+        int expectedKey = 0;
+        for (Obj::iterator it = x.begin(); it != x.end(); ++it) {
+            ASSERTV(expectedKey, it->d_key, expectedKey == it->d_key);
+            ++expectedKey;
+        }
+
+        ASSERT(&e[1] == &*x.find(3));
+        ASSERT(x.end() == x.find(7));
+
+        x.remove(&e[1]);
+        ASSERT(x.end() == x.find(3));
+        ASSERT(4 == x.size());
+
+        x.removeAll();
+        ASSERT(x.isEmpty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
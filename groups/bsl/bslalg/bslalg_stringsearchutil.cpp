@@ -0,0 +1,962 @@
+// bslalg_stringsearchutil.cpp                                        -*-C++-*-
+#include <bslalg_stringsearchutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#include <cstring>  // 'memchr', 'memcmp'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The first occurrence of a character is found using 'memchr' regardless of
+// the instruction set, as the C library provides a vectorized implementation
+// that is at least as fast as the kernels of this component.
+//
+// Each vectorized kernel processes complete blocks of 16 (SSE2) or 32 (AVX2)
+// characters using unaligned loads, and then passes the remaining (fewer than
+// one block of) characters to the corresponding scalar kernel, so that no
+// character beyond the end of the string is ever read.  Kernels searching
+// backwards process blocks starting from the end of the string, and pass the
+// remaining characters at its start to the scalar kernel.
+//
+// When searching for a substring of length 'm', the block of candidate
+// starting positions '[i, i + W)' is compared with the first character of the
+// substring, and the block '[i + m - 1, i + m - 1 + W)' with its last
+// character; a block is processed only if the second block lies within the
+// string, i.e., if the candidate positions '[i, i + W)' are all valid.  When
+// searching forwards, each block starts at the next occurrence of the first
+// character (found using 'memchr'), so that regions in which it does not occur
+// are skipped quickly.
+//
+// Sets of characters are represented by a 'CharSet': two 16-byte tables
+// indexed by the low 4 bits of a character, in which bit 'h' of the entry in
+// the first (second) table is set if the character whose high 4 bits are 'h'
+// ('h + 8') is a member of the set.  The AVX2 kernels look up both tables for
+// 32 characters at a time using 'vpshufb', select the entry from the second
+// table for characters whose high bit is set using 'vpblendvb', and test the
+// bit selected by the high 4 bits of the character using a third lookup.  The
+// SSE2 instruction set has no byte shuffle, so the SSE2 kernels compare each
+// block with each member of the set (for sets of at most 'k_MAX_SSE2_SET'
+// characters), and otherwise defer to the scalar kernels, which use the same
+// tables.
+//
+// The instruction set is held in a variable having static storage duration
+// that is initialized (by 'detectInstructionSet') when the process is
+// initialized.  Until then (e.g., during the initialization of other
+// variables having static storage duration) its value is 0, 'e_SCALAR', so
+// that the scalar kernels are used.
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLALG_STRINGSEARCHUTIL_SSE2 1
+#include <emmintrin.h>
+#if defined(BSLS_PLATFORM_CMP_CLANG) || BSLS_PLATFORM_CMP_VERSION >= 40900
+#define BSLALG_STRINGSEARCHUTIL_AVX2 1
+#define BSLALG_STRINGSEARCHUTIL_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslalg::StringSearchUtil_Imp Imp;
+typedef native_std::size_t           size_type;
+
+enum {
+    k_MAX_SSE2_SET = 16  // maximum number of characters in a set searched
+                         // using the SSE2 kernels
+};
+
+Imp::InstructionSet s_instructionSet = Imp::detectInstructionSet();
+    // instruction set used by the search kernels
+
+                               // ==============
+                               // struct CharSet
+                               // ==============
+
+struct CharSet {
+    // This 'struct' represents a set of 'char' values as a pair of tables
+    // indexed by the low 4 bits of a character (see the implementation
+    // notes).
+
+    // DATA
+    unsigned char d_tables[2][16];  // tables for characters whose high bit is
+                                    // clear and set, respectively
+
+    // MANIPULATORS
+    void assign(const char *characters, size_type numCharacters);
+        // Set this object to represent the set of the specified
+        // 'numCharacters' characters at the specified 'characters' address.
+
+    // ACCESSORS
+    bool isMember(char character) const;
+        // Return 'true' if the specified 'character' is a member of this set,
+        // and 'false' otherwise.
+};
+
+// MANIPULATORS
+void CharSet::assign(const char *characters, size_type numCharacters)
+{
+    native_std::memset(d_tables, 0, sizeof d_tables);
+
+    for (const char *end = characters + numCharacters;
+         characters != end;
+         ++characters) {
+        const unsigned char c = static_cast<unsigned char>(*characters);
+        d_tables[c >> 7][c & 0x0f] |=
+                               static_cast<unsigned char>(1 << ((c >> 4) & 7));
+    }
+}
+
+// ACCESSORS
+inline
+bool CharSet::isMember(char character) const
+{
+    const unsigned char c = static_cast<unsigned char>(character);
+    return (d_tables[c >> 7][c & 0x0f] >> ((c >> 4) & 7)) & 1;
+}
+
+                            // ==================
+                            // Scalar Kernels
+                            // ==================
+
+const char *findScalar(const char *string, size_type length, char character)
+{
+    return static_cast<const char *>(
+                                native_std::memchr(string, character, length));
+}
+
+const char *findLastScalar(const char *string,
+                           size_type   length,
+                           char        character)
+{
+    for (const char *current = string + length; current != string;) {
+        if (*--current == character) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findScalar(const char *string,
+                       size_type   length,
+                       const char *pattern,
+                       size_type   patternLength)
+    // Return the address of the first occurrence of the specified 'pattern'
+    // of the specified 'patternLength' in the specified 'string' of the
+    // specified 'length', and 0 if there is no such occurrence.  The behavior
+    // is undefined unless '1 <= patternLength'.
+{
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    const char *last = string + (length - patternLength);
+    while (0 != (string = findScalar(string, last - string + 1, *pattern))) {
+        if (0 == native_std::memcmp(string + 1,
+                                    pattern + 1,
+                                    patternLength - 1)) {
+            return string;                                            // RETURN
+        }
+        if (string == last) {
+            break;
+        }
+        ++string;
+    }
+    return 0;
+}
+
+const char *findLastScalar(const char *string,
+                           size_type   length,
+                           const char *pattern,
+                           size_type   patternLength)
+    // Return the address of the last occurrence of the specified 'pattern' of
+    // the specified 'patternLength' in the specified 'string' of the specified
+    // 'length', and 0 if there is no such occurrence.  The behavior is
+    // undefined unless '1 <= patternLength'.
+{
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    for (const char *current = string + (length - patternLength) + 1;
+         0 != (current = findLastScalar(string, current - string, *pattern));
+        ) {
+        if (0 == native_std::memcmp(current + 1,
+                                    pattern + 1,
+                                    patternLength - 1)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findInSetScalar(const char     *string,
+                            size_type       length,
+                            const CharSet&  set,
+                            bool            isMember)
+    // Return the address of the first character in the specified 'string' of
+    // the specified 'length' whose membership in the specified 'set' is the
+    // specified 'isMember', and 0 if there is no such character.
+{
+    for (const char *end = string + length; string != end; ++string) {
+        if (set.isMember(*string) == isMember) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findLastInSetScalar(const char     *string,
+                                size_type       length,
+                                const CharSet&  set,
+                                bool            isMember)
+    // Return the address of the last character in the specified 'string' of
+    // the specified 'length' whose membership in the specified 'set' is the
+    // specified 'isMember', and 0 if there is no such character.
+{
+    for (const char *current = string + length; current != string;) {
+        --current;
+        if (set.isMember(*current) == isMember) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+
+                              // ============
+                              // SSE2 Kernels
+                              // ============
+
+inline
+int lowestBit(unsigned int mask)
+    // Return the index of the lowest set bit of the specified 'mask'.  The
+    // behavior is undefined unless '0 != mask'.
+{
+    return __builtin_ctz(mask);
+}
+
+inline
+int highestBit(unsigned int mask)
+    // Return the index of the highest set bit of the specified 'mask'.  The
+    // behavior is undefined unless '0 != mask'.
+{
+    return 31 - __builtin_clz(mask);
+}
+
+inline
+__m128i loadSse2(const char *address)
+    // Return the 16 characters at the specified 'address'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+inline
+unsigned int matchSse2(const char *address, __m128i character)
+    // Return a mask having bit 'i' set if the character at the specified
+    // 'address + i' is equal to the specified 'character' (a vector of 16
+    // copies of a character), for each 'i' in '[0, 16)'.
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(loadSse2(address), character));
+}
+
+const char *findLastSse2(const char *string, size_type length, char character)
+{
+    const __m128i target = _mm_set1_epi8(character);
+
+    for (; length >= 16; length -= 16) {
+        const unsigned int mask = matchSse2(string + length - 16, target);
+        if (mask) {
+            return string + length - 16 + highestBit(mask);           // RETURN
+        }
+    }
+    return findLastScalar(string, length, character);
+}
+
+const char *findSse2(const char *string,
+                     size_type   length,
+                     const char *pattern,
+                     size_type   patternLength)
+    // The behavior is undefined unless '2 <= patternLength <= length'.
+{
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last  = _mm_set1_epi8(pattern[patternLength - 1]);
+
+    size_type numPositions = length - patternLength + 1;
+
+    while (numPositions >= 16) {
+        // Skip to the next occurrence of the first character of the pattern,
+        // which may be far away.
+
+        const char *next = findScalar(string, numPositions, pattern[0]);
+        if (!next) {
+            return 0;                                                 // RETURN
+        }
+        numPositions -= next - string;
+        string        = next;
+        if (numPositions < 16) {
+            break;
+        }
+
+        unsigned int mask = matchSse2(string, first)
+                          & matchSse2(string + patternLength - 1, last);
+        while (mask) {
+            const char *candidate = string + lowestBit(mask);
+            if (0 == native_std::memcmp(candidate + 1,
+                                        pattern + 1,
+                                        patternLength - 2)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+        string       += 16;
+        numPositions -= 16;
+    }
+    return findScalar(string,
+                      numPositions + patternLength - 1,
+                      pattern,
+                      patternLength);
+}
+
+const char *findLastSse2(const char *string,
+                         size_type   length,
+                         const char *pattern,
+                         size_type   patternLength)
+    // The behavior is undefined unless '2 <= patternLength <= length'.
+{
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last  = _mm_set1_epi8(pattern[patternLength - 1]);
+
+    size_type numPositions = length - patternLength + 1;
+
+    for (; numPositions >= 16; numPositions -= 16) {
+        const char   *block = string + numPositions - 16;
+        unsigned int  mask  = matchSse2(block, first)
+                            & matchSse2(block + patternLength - 1, last);
+        while (mask) {
+            const int bit = highestBit(mask);
+            if (0 == native_std::memcmp(block + bit + 1,
+                                        pattern + 1,
+                                        patternLength - 2)) {
+                return block + bit;                                   // RETURN
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return findLastScalar(string,
+                          numPositions + patternLength - 1,
+                          pattern,
+                          patternLength);
+}
+
+void splatSse2(__m128i    *targets,
+               const char *characters,
+               size_type   numCharacters)
+    // Load into the specified 'targets' array a vector of 16 copies of each of
+    // the specified 'numCharacters' characters at the specified 'characters'
+    // address.
+{
+    for (size_type i = 0; i < numCharacters; ++i) {
+        targets[i] = _mm_set1_epi8(characters[i]);
+    }
+}
+
+inline
+unsigned int matchSetSse2(const char    *address,
+                          const __m128i *targets,
+                          size_type      numTargets)
+    // Return a mask having bit 'i' set if the character at the specified
+    // 'address + i' is equal to one of the characters of the specified
+    // 'numTargets' vectors at the specified 'targets' address, for each 'i' in
+    // '[0, 16)'.
+{
+    const __m128i block = loadSse2(address);
+
+    __m128i match = _mm_setzero_si128();
+    for (size_type i = 0; i < numTargets; ++i) {
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(block, targets[i]));
+    }
+    return _mm_movemask_epi8(match);
+}
+
+const char *findInSetSse2(const char     *string,
+                          size_type       length,
+                          const char     *characters,
+                          size_type       numCharacters,
+                          const CharSet&  set,
+                          bool            isMember)
+    // The behavior is undefined unless 'numCharacters <= k_MAX_SSE2_SET', and
+    // 'set' represents the specified 'numCharacters' at 'characters'.
+{
+    __m128i targets[k_MAX_SSE2_SET];
+    splatSse2(targets, characters, numCharacters);
+
+    const unsigned int flip = isMember ? 0 : 0xffff;
+
+    for (; length >= 16; string += 16, length -= 16) {
+        const unsigned int mask = matchSetSse2(string, targets, numCharacters)
+                                ^ flip;
+        if (mask) {
+            return string + lowestBit(mask);                          // RETURN
+        }
+    }
+    return findInSetScalar(string, length, set, isMember);
+}
+
+const char *findLastInSetSse2(const char     *string,
+                              size_type       length,
+                              const char     *characters,
+                              size_type       numCharacters,
+                              const CharSet&  set,
+                              bool            isMember)
+    // The behavior is undefined unless 'numCharacters <= k_MAX_SSE2_SET', and
+    // 'set' represents the specified 'numCharacters' at 'characters'.
+{
+    __m128i targets[k_MAX_SSE2_SET];
+    splatSse2(targets, characters, numCharacters);
+
+    const unsigned int flip = isMember ? 0 : 0xffff;
+
+    for (; length >= 16; length -= 16) {
+        const char         *block = string + length - 16;
+        const unsigned int  mask  = matchSetSse2(block,
+                                                 targets,
+                                                 numCharacters) ^ flip;
+        if (mask) {
+            return block + highestBit(mask);                          // RETURN
+        }
+    }
+    return findLastInSetScalar(string, length, set, isMember);
+}
+
+#endif  // BSLALG_STRINGSEARCHUTIL_SSE2
+
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+
+                              // ============
+                              // AVX2 Kernels
+                              // ============
+
+inline BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+__m256i loadAvx2(const char *address)
+    // Return the 32 characters at the specified 'address'.
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(address));
+}
+
+inline BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+unsigned int matchAvx2(const char *address, __m256i character)
+    // Return a mask having bit 'i' set if the character at the specified
+    // 'address + i' is equal to the specified 'character' (a vector of 32
+    // copies of a character), for each 'i' in '[0, 32)'.
+{
+    return static_cast<unsigned int>(_mm256_movemask_epi8(
+                         _mm256_cmpeq_epi8(loadAvx2(address), character)));
+}
+
+BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+const char *findLastAvx2(const char *string, size_type length, char character)
+{
+    const __m256i target = _mm256_set1_epi8(character);
+
+    for (; length >= 32; length -= 32) {
+        const unsigned int mask = matchAvx2(string + length - 32, target);
+        if (mask) {
+            return string + length - 32 + highestBit(mask);           // RETURN
+        }
+    }
+    return findLastScalar(string, length, character);
+}
+
+BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+const char *findAvx2(const char *string,
+                     size_type   length,
+                     const char *pattern,
+                     size_type   patternLength)
+    // The behavior is undefined unless '2 <= patternLength <= length'.
+{
+    const __m256i first = _mm256_set1_epi8(pattern[0]);
+    const __m256i last  = _mm256_set1_epi8(pattern[patternLength - 1]);
+
+    size_type numPositions = length - patternLength + 1;
+
+    while (numPositions >= 32) {
+        // Skip to the next occurrence of the first character of the pattern,
+        // which may be far away.
+
+        const char *next = findScalar(string, numPositions, pattern[0]);
+        if (!next) {
+            return 0;                                                 // RETURN
+        }
+        numPositions -= next - string;
+        string        = next;
+        if (numPositions < 32) {
+            break;
+        }
+
+        unsigned int mask = matchAvx2(string, first)
+                          & matchAvx2(string + patternLength - 1, last);
+        while (mask) {
+            const char *candidate = string + lowestBit(mask);
+            if (0 == native_std::memcmp(candidate + 1,
+                                        pattern + 1,
+                                        patternLength - 2)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+        string       += 32;
+        numPositions -= 32;
+    }
+    return findScalar(string,
+                      numPositions + patternLength - 1,
+                      pattern,
+                      patternLength);
+}
+
+BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+const char *findLastAvx2(const char *string,
+                         size_type   length,
+                         const char *pattern,
+                         size_type   patternLength)
+    // The behavior is undefined unless '2 <= patternLength <= length'.
+{
+    const __m256i first = _mm256_set1_epi8(pattern[0]);
+    const __m256i last  = _mm256_set1_epi8(pattern[patternLength - 1]);
+
+    size_type numPositions = length - patternLength + 1;
+
+    for (; numPositions >= 32; numPositions -= 32) {
+        const char   *block = string + numPositions - 32;
+        unsigned int  mask  = matchAvx2(block, first)
+                            & matchAvx2(block + patternLength - 1, last);
+        while (mask) {
+            const int bit = highestBit(mask);
+            if (0 == native_std::memcmp(block + bit + 1,
+                                        pattern + 1,
+                                        patternLength - 2)) {
+                return block + bit;                                   // RETURN
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return findLastScalar(string,
+                          numPositions + patternLength - 1,
+                          pattern,
+                          patternLength);
+}
+
+struct CharSetAvx2 {
+    // This 'struct' holds the vectors used by the AVX2 kernels to determine
+    // the membership of 32 characters at a time in a 'CharSet'.
+
+    // DATA
+    __m256i d_low;   // table for characters whose high bit is clear
+    __m256i d_high;  // table for characters whose high bit is set
+    __m256i d_bits;  // bit tested for each value of the high 4 bits
+    __m256i d_mask;  // 32 copies of '0x0f'
+
+    // MANIPULATORS
+    BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+    void assign(const CharSet& set);
+        // Load into this object the vectors for the specified 'set'.
+
+    // ACCESSORS
+    BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+    unsigned int match(const char *address) const;
+        // Return a mask having bit 'i' set if the character at the specified
+        // 'address + i' is a member of the set, for each 'i' in '[0, 32)'.
+};
+
+// MANIPULATORS
+inline BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+void CharSetAvx2::assign(const CharSet& set)
+{
+    // Note that 'vpshufb' indexes each 128-bit half of its table separately,
+    // so each table is duplicated in both halves.
+
+    const __m128i low  = loadSse2(
+                             reinterpret_cast<const char *>(set.d_tables[0]));
+    const __m128i high = loadSse2(
+                             reinterpret_cast<const char *>(set.d_tables[1]));
+
+    d_low  = _mm256_inserti128_si256(_mm256_castsi128_si256(low),  low,  1);
+    d_high = _mm256_inserti128_si256(_mm256_castsi128_si256(high), high, 1);
+    d_bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                              1, 2, 4, 8, 16, 32, 64, -128,
+                              1, 2, 4, 8, 16, 32, 64, -128,
+                              1, 2, 4, 8, 16, 32, 64, -128);
+    d_mask = _mm256_set1_epi8(0x0f);
+}
+
+// ACCESSORS
+inline BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+unsigned int CharSetAvx2::match(const char *address) const
+{
+    const __m256i block = loadAvx2(address);
+    const __m256i low   = _mm256_and_si256(block, d_mask);
+    const __m256i high  = _mm256_and_si256(_mm256_srli_epi16(block, 4),
+                                           d_mask);
+
+    // Select the entry of 'd_high' for characters whose high bit is set.
+
+    const __m256i entry = _mm256_blendv_epi8(_mm256_shuffle_epi8(d_low,  low),
+                                             _mm256_shuffle_epi8(d_high, low),
+                                             block);
+    const __m256i bit   = _mm256_shuffle_epi8(d_bits, high);
+
+    return static_cast<unsigned int>(_mm256_movemask_epi8(
+                       _mm256_cmpeq_epi8(_mm256_and_si256(entry, bit), bit)));
+}
+
+BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+const char *findInSetAvx2(const char     *string,
+                          size_type       length,
+                          const CharSet&  set,
+                          bool            isMember)
+{
+    CharSetAvx2 vectors;
+    vectors.assign(set);
+
+    const unsigned int flip = isMember ? 0 : 0xffffffffu;
+
+    for (; length >= 32; string += 32, length -= 32) {
+        const unsigned int mask = vectors.match(string) ^ flip;
+        if (mask) {
+            return string + lowestBit(mask);                          // RETURN
+        }
+    }
+    return findInSetScalar(string, length, set, isMember);
+}
+
+BSLALG_STRINGSEARCHUTIL_TARGET_AVX2
+const char *findLastInSetAvx2(const char     *string,
+                              size_type       length,
+                              const CharSet&  set,
+                              bool            isMember)
+{
+    CharSetAvx2 vectors;
+    vectors.assign(set);
+
+    const unsigned int flip = isMember ? 0 : 0xffffffffu;
+
+    for (; length >= 32; length -= 32) {
+        const char         *block = string + length - 32;
+        const unsigned int  mask  = vectors.match(block) ^ flip;
+        if (mask) {
+            return block + highestBit(mask);                          // RETURN
+        }
+    }
+    return findLastInSetScalar(string, length, set, isMember);
+}
+
+#endif  // BSLALG_STRINGSEARCHUTIL_AVX2
+
+                              // ===========
+                              // Dispatchers
+                              // ===========
+
+const char *findInSet(const char *string,
+                      size_type   length,
+                      const char *characters,
+                      size_type   numCharacters,
+                      bool        isMember)
+    // Return the address of the first character in the specified 'string' of
+    // the specified 'length' whose membership in the set of the specified
+    // 'numCharacters' characters at the specified 'characters' address is the
+    // specified 'isMember', and 0 if there is no such character.
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    if (0 == numCharacters) {
+        return isMember || 0 == length ? 0 : string;                  // RETURN
+    }
+
+    CharSet set;
+    set.assign(characters, numCharacters);
+
+    switch (s_instructionSet) {
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+      case Imp::e_AVX2: {
+        return findInSetAvx2(string, length, set, isMember);          // RETURN
+      }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+      case Imp::e_SSE2: {
+        if (numCharacters <= k_MAX_SSE2_SET) {
+            return findInSetSse2(string,                              // RETURN
+                                 length,
+                                 characters,
+                                 numCharacters,
+                                 set,
+                                 isMember);
+        }
+      } break;
+#endif
+      default: {
+      } break;
+    }
+    return findInSetScalar(string, length, set, isMember);
+}
+
+const char *findLastInSet(const char *string,
+                          size_type   length,
+                          const char *characters,
+                          size_type   numCharacters,
+                          bool        isMember)
+    // Return the address of the last character in the specified 'string' of
+    // the specified 'length' whose membership in the set of the specified
+    // 'numCharacters' characters at the specified 'characters' address is the
+    // specified 'isMember', and 0 if there is no such character.
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    if (0 == numCharacters) {
+        return isMember || 0 == length ? 0 : string + length - 1;     // RETURN
+    }
+
+    CharSet set;
+    set.assign(characters, numCharacters);
+
+    switch (s_instructionSet) {
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+      case Imp::e_AVX2: {
+        return findLastInSetAvx2(string, length, set, isMember);      // RETURN
+      }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+      case Imp::e_SSE2: {
+        if (numCharacters <= k_MAX_SSE2_SET) {
+            return findLastInSetSse2(string,                          // RETURN
+                                     length,
+                                     characters,
+                                     numCharacters,
+                                     set,
+                                     isMember);
+        }
+      } break;
+#endif
+      default: {
+      } break;
+    }
+    return findLastInSetScalar(string, length, set, isMember);
+}
+
+}  // close unnamed namespace
+
+namespace bslalg {
+
+                        // ---------------------------
+                        // struct StringSearchUtil_Imp
+                        // ---------------------------
+
+// CLASS METHODS
+StringSearchUtil_Imp::InstructionSet
+StringSearchUtil_Imp::detectInstructionSet()
+{
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+    // Note that '__builtin_cpu_init' must be called before
+    // '__builtin_cpu_supports' during the initialization of the process.
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return e_AVX2;                                                // RETURN
+    }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+    return e_SSE2;
+#else
+    return e_SCALAR;
+#endif
+}
+
+StringSearchUtil_Imp::InstructionSet StringSearchUtil_Imp::instructionSet()
+{
+    return s_instructionSet;
+}
+
+void StringSearchUtil_Imp::setInstructionSet(InstructionSet value)
+{
+    BSLS_ASSERT(value <= detectInstructionSet());
+
+    s_instructionSet = value;
+}
+
+const char *StringSearchUtil_Imp::find(const char *string,
+                                       size_type   length,
+                                       char        character)
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    // Note that 'memchr' is vectorized by the C library on all platforms of
+    // interest, and is faster than the kernels of this component.
+
+    return findScalar(string, length, character);
+}
+
+const char *StringSearchUtil_Imp::find(const char *string,
+                                       size_type   length,
+                                       const char *pattern,
+                                       size_type   patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (patternLength < 2 || patternLength > length) {
+        return 0 == patternLength
+               ? string
+               : 1 == patternLength
+                 ? find(string, length, *pattern)
+                 : 0;                                                 // RETURN
+    }
+
+    switch (s_instructionSet) {
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+      case e_AVX2: {
+        return findAvx2(string, length, pattern, patternLength);      // RETURN
+      }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+      case e_SSE2: {
+        return findSse2(string, length, pattern, patternLength);      // RETURN
+      }
+#endif
+      default: {
+        return findScalar(string, length, pattern, patternLength);    // RETURN
+      }
+    }
+}
+
+const char *StringSearchUtil_Imp::findLast(const char *string,
+                                           size_type   length,
+                                           char        character)
+{
+    BSLS_ASSERT_SAFE(string || 0 == length);
+
+    switch (s_instructionSet) {
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+      case e_AVX2: {
+        return findLastAvx2(string, length, character);               // RETURN
+      }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+      case e_SSE2: {
+        return findLastSse2(string, length, character);               // RETURN
+      }
+#endif
+      default: {
+        return findLastScalar(string, length, character);             // RETURN
+      }
+    }
+}
+
+const char *StringSearchUtil_Imp::findLast(const char *string,
+                                           size_type   length,
+                                           const char *pattern,
+                                           size_type   patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (patternLength < 2 || patternLength > length) {
+        return 0 == patternLength
+               ? string + length
+               : 1 == patternLength
+                 ? findLast(string, length, *pattern)
+                 : 0;                                                 // RETURN
+    }
+
+    switch (s_instructionSet) {
+#if defined(BSLALG_STRINGSEARCHUTIL_AVX2)
+      case e_AVX2: {
+        return findLastAvx2(string,                                   // RETURN
+                            length,
+                            pattern,
+                            patternLength);
+      }
+#endif
+#if defined(BSLALG_STRINGSEARCHUTIL_SSE2)
+      case e_SSE2: {
+        return findLastSse2(string,                                   // RETURN
+                            length,
+                            pattern,
+                            patternLength);
+      }
+#endif
+      default: {
+        return findLastScalar(string,                                 // RETURN
+                              length,
+                              pattern,
+                              patternLength);
+      }
+    }
+}
+
+const char *StringSearchUtil_Imp::findFirstOf(const char *string,
+                                              size_type   length,
+                                              const char *characters,
+                                              size_type   numCharacters)
+{
+    return 1 == numCharacters
+           ? find(string, length, *characters)
+           : findInSet(string, length, characters, numCharacters, true);
+}
+
+const char *StringSearchUtil_Imp::findFirstNotOf(const char *string,
+                                                 size_type   length,
+                                                 const char *characters,
+                                                 size_type   numCharacters)
+{
+    return findInSet(string, length, characters, numCharacters, false);
+}
+
+const char *StringSearchUtil_Imp::findLastOf(const char *string,
+                                             size_type   length,
+                                             const char *characters,
+                                             size_type   numCharacters)
+{
+    return 1 == numCharacters
+           ? findLast(string, length, *characters)
+           : findLastInSet(string, length, characters, numCharacters, true);
+}
+
+const char *StringSearchUtil_Imp::findLastNotOf(const char *string,
+                                                size_type   length,
+                                                const char *characters,
+                                                size_type   numCharacters)
+{
+    return findLastInSet(string, length, characters, numCharacters, false);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
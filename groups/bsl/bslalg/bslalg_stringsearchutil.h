@@ -0,0 +1,623 @@
+// bslalg_stringsearchutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLALG_STRINGSEARCHUTIL
+#define INCLUDED_BSLALG_STRINGSEARCHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized algorithms for searching character strings.
+//
+//@CLASSES:
+//  bslalg::StringSearchUtil: namespace for searching strings of any type
+//  bslalg::StringSearchUtil_Imp: namespace for 'char' search kernels
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref
+//
+//@DESCRIPTION: This component provides a class template, 'StringSearchUtil',
+// parameterized by a character traits type (e.g.,
+// 'native_std::char_traits<wchar_t>'), containing functions that search a
+// string (a sequence of characters, not necessarily null-terminated, given by
+// its address and length) for either the first or last occurrence of a
+// substring, or the first or last character that is (or is not) one of a
+// given set of characters.  These functions implement the search operations
+// of 'bsl::basic_string' and 'bslstl::StringRefImp':
+//..
+//  Function            Returns the address of the
+//  ------------------  ------------------------------------------------------
+//  find                first occurrence of a substring
+//  findLast            last occurrence of a substring
+//  findFirstOf         first character that is a member of a set
+//  findFirstNotOf      first character that is not a member of a set
+//  findLastOf          last character that is a member of a set
+//  findLastNotOf       last character that is not a member of a set
+//..
+// Each function returns 0 if the sought substring or character is not found.
+//
+///Vectorized Implementation
+///-------------------------
+// The primary template of 'StringSearchUtil' examines one character at a time
+// using the 'eq' and 'compare' functions of the traits type, and so supports
+// any character type and traits.  The specialization for
+// 'native_std::char_traits<char>' (the traits of 'bsl::string' and
+// 'bslstl::StringRef') instead forwards to the search kernels of
+// 'StringSearchUtil_Imp', which, on x86-64 platforms (using GCC or Clang),
+// examine a block of 16 (using SSE2 instructions) or 32 (using AVX2
+// instructions) characters at a time:
+//
+//: o The last occurrence of a character is found by comparing a block with a
+//:   vector holding copies of the character, and taking the index of the
+//:   highest set bit of the mask of matching positions.  (The first
+//:   occurrence is found using 'memchr', which the C library already
+//:   vectorizes.)
+//:
+//: o A substring is found by comparing a block with the first character of the
+//:   substring, and the block starting 'length - 1' characters further on with
+//:   its last character, so that only the (typically rare) positions matching
+//:   both need be compared with the substring in full.  When searching
+//:   forwards, 'memchr' is used to skip to the next occurrence of the first
+//:   character before each block is compared.
+//:
+//: o Membership in a set of characters is determined, using SSE2, by comparing
+//:   a block with each character of the set (for sets of at most 16
+//:   characters), and, using AVX2, for sets of any size, by using the low and
+//:   high 4 bits of each character to index 16-entry tables derived from the
+//:   set.
+//
+// No kernel reads beyond the end of the string; characters following the last
+// complete block are examined one at a time.
+//
+// The most capable instruction set supported by the processor is selected
+// when the process is initialized.  On other platforms, the search kernels
+// examine one character at a time, using 'memchr' and 'memcmp' where
+// applicable.  All implementations return identical results.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Tag-Value Message
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we are parsing a message consisting of fields of the form
+// 'tag=value', separated by the '|' character, and need to find the value of
+// the field having a given tag.
+//
+// First, we define the message and the tag that we seek, including the
+// delimiters surrounding it:
+//..
+//  typedef bslalg::StringSearchUtil<native_std::char_traits<char> > Util;
+//
+//  const char               MESSAGE[] = "|8=FIX.4.2|35=D|49=SENDER|55=IBM|";
+//  const native_std::size_t LENGTH    = sizeof MESSAGE - 1;
+//
+//  const char TAG[] = "|55=";
+//..
+// Then, we find the first occurrence of the tag in the message:
+//..
+//  const char *field = Util::find(MESSAGE, LENGTH, TAG, sizeof TAG - 1);
+//  assert(MESSAGE + 25 == field);
+//..
+// Next, we find the end of the value (i.e., the next delimiter):
+//..
+//  const char *value = field + sizeof TAG - 1;
+//  const char *end   = Util::findFirstOf(value,
+//                                        MESSAGE + LENGTH - value,
+//                                        "|",
+//                                        1);
+//  assert(end);
+//  assert(3 == end - value);
+//  assert(0 == memcmp(value, "IBM", 3));
+//..
+// Finally, we verify that the message does not contain a character that is
+// neither printable nor a delimiter, by searching for the first character
+// that is *not* a member of the set of valid characters:
+//..
+//  const char VALID[] = "|=.0123456789"
+//                       "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+//                       "abcdefghijklmnopqrstuvwxyz";
+//
+//  assert(0 == Util::findFirstNotOf(MESSAGE,
+//                                   LENGTH,
+//                                   VALID,
+//                                   sizeof VALID - 1));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // 'size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_STRING
+#include <string>  // 'native_std::char_traits'
+#define INCLUDED_STRING
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                        // ===========================
+                        // struct StringSearchUtil_Imp
+                        // ===========================
+
+struct StringSearchUtil_Imp {
+    // This component-private 'struct' provides a namespace for the search
+    // kernels on strings of 'char' used by 'StringSearchUtil', each of which
+    // dispatches to the implementation using the most capable instruction set
+    // supported by the processor.  See the documentation of the corresponding
+    // functions of 'StringSearchUtil' for their contracts.
+
+    // TYPES
+    enum InstructionSet {
+        // Enumerate the implementations of the search kernels.
+
+        e_SCALAR,  // one character at a time
+        e_SSE2,    // 16 characters at a time
+        e_AVX2     // 32 characters at a time
+    };
+
+    // CLASS METHODS
+    static InstructionSet detectInstructionSet();
+        // Return the most capable instruction set that is supported by both
+        // this platform and the processor executing the process.
+
+    static InstructionSet instructionSet();
+        // Return the instruction set used by the search kernels.  Note that,
+        // unless 'setInstructionSet' has been called, this is the value
+        // returned by 'detectInstructionSet'.
+
+    static void setInstructionSet(InstructionSet value);
+        // Use the specified 'value' as the instruction set of the search
+        // kernels.  The behavior is undefined unless
+        // 'value <= detectInstructionSet()'.  Note that this function is not
+        // thread-safe, and is intended for testing and benchmarking only.
+
+    static const char *find(const char         *string,
+                            native_std::size_t  length,
+                            char                character);
+        // Return the address of the first occurrence of the specified
+        // 'character' in the specified 'string' having the specified
+        // 'length', and 0 if there is no such occurrence.
+
+    static const char *find(const char         *string,
+                            native_std::size_t  length,
+                            const char         *pattern,
+                            native_std::size_t  patternLength);
+    static const char *findLast(const char         *string,
+                                native_std::size_t  length,
+                                char                character);
+    static const char *findLast(const char         *string,
+                                native_std::size_t  length,
+                                const char         *pattern,
+                                native_std::size_t  patternLength);
+    static const char *findFirstOf(const char         *string,
+                                   native_std::size_t  length,
+                                   const char         *characters,
+                                   native_std::size_t  numCharacters);
+    static const char *findFirstNotOf(const char         *string,
+                                      native_std::size_t  length,
+                                      const char         *characters,
+                                      native_std::size_t  numCharacters);
+    static const char *findLastOf(const char         *string,
+                                  native_std::size_t  length,
+                                  const char         *characters,
+                                  native_std::size_t  numCharacters);
+    static const char *findLastNotOf(const char         *string,
+                                     native_std::size_t  length,
+                                     const char         *characters,
+                                     native_std::size_t  numCharacters);
+        // See the functions of the same name in 'StringSearchUtil'.  Note
+        // that 'findLast' with a 'character' returns the address of the last
+        // occurrence of 'character'.
+};
+
+                          // =======================
+                          // struct StringSearchUtil
+                          // =======================
+
+template <class CHAR_TRAITS>
+struct StringSearchUtil {
+    // This 'struct' provides a namespace for functions that search a string
+    // of characters compared using the (template parameter) type
+    // 'CHAR_TRAITS', which must meet the requirements of a character traits
+    // type in the C++ standard.  In each function, the string searched is
+    // given by its address 'string' and its number of characters 'length',
+    // and a set of characters is given by the address 'characters' of an
+    // array holding its 'numCharacters' members (in any order, and possibly
+    // including duplicates).  The behavior of each function is undefined
+    // unless each address refers to an array of at least the corresponding
+    // number of characters (an address may be null if the number is 0).
+
+    // TYPES
+    typedef typename CHAR_TRAITS::char_type char_type;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bool isMember(const char_type    *characters,
+                         native_std::size_t  numCharacters,
+                         char_type           character);
+        // Return 'true' if the specified 'character' is equal to one of the
+        // specified 'numCharacters' characters at the specified 'characters'
+        // address, and 'false' otherwise.
+
+  public:
+    // CLASS METHODS
+    static const char_type *find(const char_type    *string,
+                                 native_std::size_t  length,
+                                 const char_type    *pattern,
+                                 native_std::size_t  patternLength);
+        // Return the address of the first character of the first occurrence
+        // of the specified 'pattern' having the specified 'patternLength' in
+        // the specified 'string' having the specified 'length', and 0 if
+        // there is no such occurrence.  If 'patternLength' is 0, return
+        // 'string'.
+
+    static const char_type *findLast(const char_type    *string,
+                                     native_std::size_t  length,
+                                     const char_type    *pattern,
+                                     native_std::size_t  patternLength);
+        // Return the address of the first character of the last occurrence of
+        // the specified 'pattern' having the specified 'patternLength' in the
+        // specified 'string' having the specified 'length', and 0 if there is
+        // no such occurrence.  If 'patternLength' is 0, return
+        // 'string + length'.
+
+    static const char_type *findFirstOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters);
+        // Return the address of the first character of the specified 'string'
+        // having the specified 'length' that is a member of the set of the
+        // specified 'numCharacters' characters at the specified 'characters'
+        // address, and 0 if there is no such character.
+
+    static const char_type *findFirstNotOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters);
+        // Return the address of the first character of the specified 'string'
+        // having the specified 'length' that is not a member of the set of the
+        // specified 'numCharacters' characters at the specified 'characters'
+        // address, and 0 if there is no such character.
+
+    static const char_type *findLastOf(const char_type    *string,
+                                       native_std::size_t  length,
+                                       const char_type    *characters,
+                                       native_std::size_t  numCharacters);
+        // Return the address of the last character of the specified 'string'
+        // having the specified 'length' that is a member of the set of the
+        // specified 'numCharacters' characters at the specified 'characters'
+        // address, and 0 if there is no such character.
+
+    static const char_type *findLastNotOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters);
+        // Return the address of the last character of the specified 'string'
+        // having the specified 'length' that is not a member of the set of the
+        // specified 'numCharacters' characters at the specified 'characters'
+        // address, and 0 if there is no such character.
+};
+
+template <>
+struct StringSearchUtil<native_std::char_traits<char> > {
+    // This specialization of 'StringSearchUtil' for strings of 'char'
+    // compared using 'native_std::char_traits<char>' forwards to the
+    // vectorized search kernels of 'StringSearchUtil_Imp'.
+
+    // TYPES
+    typedef char char_type;
+
+    // CLASS METHODS
+    static const char *find(const char         *string,
+                            native_std::size_t  length,
+                            const char         *pattern,
+                            native_std::size_t  patternLength);
+    static const char *findLast(const char         *string,
+                                native_std::size_t  length,
+                                const char         *pattern,
+                                native_std::size_t  patternLength);
+    static const char *findFirstOf(const char         *string,
+                                   native_std::size_t  length,
+                                   const char         *characters,
+                                   native_std::size_t  numCharacters);
+    static const char *findFirstNotOf(const char         *string,
+                                      native_std::size_t  length,
+                                      const char         *characters,
+                                      native_std::size_t  numCharacters);
+    static const char *findLastOf(const char         *string,
+                                  native_std::size_t  length,
+                                  const char         *characters,
+                                  native_std::size_t  numCharacters);
+    static const char *findLastNotOf(const char         *string,
+                                     native_std::size_t  length,
+                                     const char         *characters,
+                                     native_std::size_t  numCharacters);
+        // See the primary template.
+};
+
+// ============================================================================
+//                       INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // struct StringSearchUtil
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class CHAR_TRAITS>
+inline
+bool StringSearchUtil<CHAR_TRAITS>::isMember(
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters,
+                                      char_type           character)
+{
+    for (; numCharacters; --numCharacters, ++characters) {
+        if (CHAR_TRAITS::eq(*characters, character)) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+// CLASS METHODS
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::find(const char_type    *string,
+                                    native_std::size_t  length,
+                                    const char_type    *pattern,
+                                    native_std::size_t  patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string;                                                // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    const char_type *last = string + (length - patternLength);
+    for (; string <= last; ++string) {
+        if (CHAR_TRAITS::eq(*string, *pattern)
+         && 0 == CHAR_TRAITS::compare(string + 1,
+                                      pattern + 1,
+                                      patternLength - 1)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::findLast(const char_type    *string,
+                                        native_std::size_t  length,
+                                        const char_type    *pattern,
+                                        native_std::size_t  patternLength)
+{
+    BSLS_ASSERT_SAFE(string  || 0 == length);
+    BSLS_ASSERT_SAFE(pattern || 0 == patternLength);
+
+    if (0 == patternLength) {
+        return string + length;                                       // RETURN
+    }
+    if (patternLength > length) {
+        return 0;                                                     // RETURN
+    }
+
+    for (const char_type *current = string + (length - patternLength);
+         ;
+         --current) {
+        if (CHAR_TRAITS::eq(*current, *pattern)
+         && 0 == CHAR_TRAITS::compare(current + 1,
+                                      pattern + 1,
+                                      patternLength - 1)) {
+            return current;                                           // RETURN
+        }
+        if (current == string) {
+            break;
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::findFirstOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters)
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    for (const char_type *end = string + length; string != end; ++string) {
+        if (isMember(characters, numCharacters, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::findFirstNotOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters)
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    for (const char_type *end = string + length; string != end; ++string) {
+        if (!isMember(characters, numCharacters, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::findLastOf(const char_type    *string,
+                                          native_std::size_t  length,
+                                          const char_type    *characters,
+                                          native_std::size_t  numCharacters)
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    for (const char_type *current = string + length; current != string;) {
+        --current;
+        if (isMember(characters, numCharacters, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TRAITS>
+const typename CHAR_TRAITS::char_type *
+StringSearchUtil<CHAR_TRAITS>::findLastNotOf(
+                                      const char_type    *string,
+                                      native_std::size_t  length,
+                                      const char_type    *characters,
+                                      native_std::size_t  numCharacters)
+{
+    BSLS_ASSERT_SAFE(string     || 0 == length);
+    BSLS_ASSERT_SAFE(characters || 0 == numCharacters);
+
+    for (const char_type *current = string + length; current != string;) {
+        --current;
+        if (!isMember(characters, numCharacters, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+             // ------------------------------------------------------
+             // struct StringSearchUtil<native_std::char_traits<char> >
+             // ------------------------------------------------------
+
+// CLASS METHODS
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::find(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *pattern,
+                                            native_std::size_t  patternLength)
+{
+    return StringSearchUtil_Imp::find(string, length, pattern, patternLength);
+}
+
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::findLast(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *pattern,
+                                            native_std::size_t  patternLength)
+{
+    return StringSearchUtil_Imp::findLast(string,
+                                          length,
+                                          pattern,
+                                          patternLength);
+}
+
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::findFirstOf(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *characters,
+                                            native_std::size_t  numCharacters)
+{
+    return StringSearchUtil_Imp::findFirstOf(string,
+                                             length,
+                                             characters,
+                                             numCharacters);
+}
+
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::findFirstNotOf(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *characters,
+                                            native_std::size_t  numCharacters)
+{
+    return StringSearchUtil_Imp::findFirstNotOf(string,
+                                                length,
+                                                characters,
+                                                numCharacters);
+}
+
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::findLastOf(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *characters,
+                                            native_std::size_t  numCharacters)
+{
+    return StringSearchUtil_Imp::findLastOf(string,
+                                            length,
+                                            characters,
+                                            numCharacters);
+}
+
+inline
+const char *StringSearchUtil<native_std::char_traits<char> >::findLastNotOf(
+                                            const char         *string,
+                                            native_std::size_t  length,
+                                            const char         *characters,
+                                            native_std::size_t  numCharacters)
+{
+    return StringSearchUtil_Imp::findLastNotOf(string,
+                                               length,
+                                               characters,
+                                               numCharacters);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1019 @@
+// bslalg_stringsearchutil.t.cpp                                      -*-C++-*-
+#include <bslalg_stringsearchutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides search functions on strings, and, for
+// strings of 'char', several implementations of each of them (one per
+// instruction set) of which one is selected at run time.  Every
+// implementation must return the same result as a straightforward search, so
+// we compare each function, using every instruction set supported by the
+// processor, with a naive "oracle" over a systematically generated set of
+// inputs.  The inputs are chosen to cover the boundaries of the vectorized
+// kernels: strings whose lengths are around (multiples of) the block sizes of
+// 16 and 32 characters, matches at every position, at the first and last
+// positions, and straddling block boundaries, and sets of characters of every
+// size around the limit of the SSE2 kernels, including characters whose high
+// bit is set.  Strings are placed at every offset within an aligned buffer
+// so that both aligned and unaligned loads are exercised, and are surrounded
+// by "poison" characters that would cause a mismatch if read.  A benchmark
+// comparing the implementations is provided as a negative test case.
+//-----------------------------------------------------------------------------
+// class StringSearchUtil_Imp
+// [ 2] InstructionSet detectInstructionSet();
+// [ 2] InstructionSet instructionSet();
+// [ 2] void setInstructionSet(InstructionSet value);
+// [ 4] const char *find(const char *, size_t, char);
+// [ 4] const char *findLast(const char *, size_t, char);
+//
+// class StringSearchUtil
+// [ 3] const char_type *find(string, length, pattern, patternLength);
+// [ 3] const char_type *findLast(string, length, pattern, patternLength);
+// [ 3] const char_type *findFirstOf(string, length, chars, numChars);
+// [ 3] const char_type *findFirstNotOf(string, length, chars, numChars);
+// [ 3] const char_type *findLastOf(string, length, chars, numChars);
+// [ 3] const char_type *findLastNotOf(string, length, chars, numChars);
+//
+// class StringSearchUtil<native_std::char_traits<char> >
+// [ 5] const char *find(string, length, pattern, patternLength);
+// [ 5] const char *findLast(string, length, pattern, patternLength);
+// [ 6] const char *findFirstOf(string, length, chars, numChars);
+// [ 6] const char *findFirstNotOf(string, length, chars, numChars);
+// [ 6] const char *findLastOf(string, length, chars, numChars);
+// [ 6] const char *findLastNotOf(string, length, chars, numChars);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: SEARCH THROUGHPUT
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::StringSearchUtil_Imp                                  Imp;
+typedef bslalg::StringSearchUtil<native_std::char_traits<char> >      Util;
+typedef bslalg::StringSearchUtil<native_std::char_traits<wchar_t> >   WUtil;
+
+enum {
+    k_MAX_LENGTH = 100,  // maximum length of the strings searched
+    k_MARGIN     = 40,   // number of poison characters around each string
+    k_BUFFER     = k_MARGIN + 32 + k_MAX_LENGTH + k_MARGIN
+};
+
+const char POISON = '#';  // a character not occurring in any test string
+                          // or set
+
+static const char *const INSTRUCTION_SET_NAMES[] = { "SCALAR",
+                                                     "SSE2",
+                                                     "AVX2" };
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct CaseInsensitiveTraits : native_std::char_traits<char> {
+    // This 'struct' provides a character traits type that compares letters
+    // without regard to case, used to verify that the primary template of
+    // 'StringSearchUtil' compares characters using the traits.
+
+    static char fold(char c)
+        // Return the lower-case equivalent of the specified 'c' if it is an
+        // upper-case letter, and 'c' otherwise.
+    {
+        return 'A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    static bool eq(char a, char b)
+    {
+        return fold(a) == fold(b);
+    }
+
+    static int compare(const char *a, const char *b, native_std::size_t n)
+    {
+        for (; n; --n, ++a, ++b) {
+            if (fold(*a) != fold(*b)) {
+                return fold(*a) < fold(*b) ? -1 : 1;                  // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+class Random {
+    // This class provides a deterministic generator of pseudo-random values,
+    // so that the inputs of the tests are the same on every run.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed)
+    : d_state(seed)
+    {
+    }
+
+    // MANIPULATORS
+    unsigned int next()
+    {
+        d_state = d_state * 1664525U + 1013904223U;
+        return d_state >> 8;
+    }
+};
+
+// The following functions are the "oracles" against which the functions under
+// test are compared.
+
+const char *naiveFind(const char *s, size_t n, const char *p, size_t m)
+{
+    if (m > n) {
+        return 0;                                                     // RETURN
+    }
+    for (size_t i = 0; i + m <= n; ++i) {
+        if (0 == memcmp(s + i, p, m)) {
+            return s + i;                                             // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *naiveFindLast(const char *s, size_t n, const char *p, size_t m)
+{
+    if (m > n) {
+        return 0;                                                     // RETURN
+    }
+    for (size_t i = n - m + 1; i > 0; --i) {
+        if (0 == memcmp(s + i - 1, p, m)) {
+            return s + i - 1;                                         // RETURN
+        }
+    }
+    return 0;
+}
+
+bool naiveIsMember(const char *set, size_t numChars, char c)
+{
+    for (size_t i = 0; i < numChars; ++i) {
+        if (set[i] == c) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+const char *naiveFindIn(const char *s,
+                        size_t      n,
+                        const char *set,
+                        size_t      numChars,
+                        bool        isMember,
+                        bool        isLast)
+{
+    for (size_t k = 0; k < n; ++k) {
+        const size_t i = isLast ? n - 1 - k : k;
+        if (naiveIsMember(set, numChars, s[i]) == isMember) {
+            return s + i;                                             // RETURN
+        }
+    }
+    return 0;
+}
+
+long offsetOf(const char *result, const char *string)
+    // Return the offset of the specified 'result' within the specified
+    // 'string', or -1 if 'result' is 0.
+{
+    return result ? result - string : -1;
+}
+
+int numInstructionSets()
+    // Return the number of instruction sets that can be tested on the
+    // processor executing this process.
+{
+    return Imp::detectInstructionSet() + 1;
+}
+
+void fillPoisoned(char *buffer)
+    // Fill the specified 'buffer' of 'k_BUFFER' characters with 'POISON'.
+{
+    memset(buffer, POISON, k_BUFFER);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing a Tag-Value Message
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we are parsing a message consisting of fields of the form
+// 'tag=value', separated by the '|' character, and need to find the value of
+// the field having a given tag.
+//
+// First, we define the message and the tag that we seek, including the
+// delimiters surrounding it:
+//..
+    typedef bslalg::StringSearchUtil<native_std::char_traits<char> > Util;
+
+    const char               MESSAGE[] = "|8=FIX.4.2|35=D|49=SENDER|55=IBM|";
+    const native_std::size_t LENGTH    = sizeof MESSAGE - 1;
+
+    const char TAG[] = "|55=";
+//..
+// Then, we find the first occurrence of the tag in the message:
+//..
+    const char *field = Util::find(MESSAGE, LENGTH, TAG, sizeof TAG - 1);
+    ASSERT(MESSAGE + 25 == field);
+//..
+// Next, we find the end of the value (i.e., the next delimiter):
+//..
+    const char *value = field + sizeof TAG - 1;
+    const char *end   = Util::findFirstOf(value,
+                                          MESSAGE + LENGTH - value,
+                                          "|",
+                                          1);
+    ASSERT(end);
+    ASSERT(3 == end - value);
+    ASSERT(0 == memcmp(value, "IBM", 3));
+//..
+// Finally, we verify that the message does not contain a character that is
+// neither printable nor a delimiter, by searching for the first character
+// that is *not* a member of the set of valid characters:
+//..
+    const char VALID[] = "|=.0123456789"
+                         "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                         "abcdefghijklmnopqrstuvwxyz";
+
+    ASSERT(0 == Util::findFirstNotOf(MESSAGE,
+                                     LENGTH,
+                                     VALID,
+                                     sizeof VALID - 1));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CHARACTER SET SEARCHES
+        //
+        // Concerns:
+        //: 1 'findFirstOf', 'findFirstNotOf', 'findLastOf' and
+        //:   'findLastNotOf' return the first or last character of the string
+        //:   that is (or is not) a member of the set, and 0 if there is none,
+        //:   using each instruction set supported by the processor.
+        //:
+        //: 2 The result is correct for sets of any size (in particular, on
+        //:   both sides of the largest set handled by the SSE2 kernels), for
+        //:   sets containing duplicates, and for the empty set.
+        //:
+        //: 3 Characters whose high bit is set, and characters whose low 4 bits
+        //:   are equal to those of a member, are classified correctly.
+        //:
+        //: 4 No character outside the string is examined.
+        //
+        // Plan:
+        //: 1 For each instruction set supported by the processor, for each of
+        //:   a number of sets of sizes from 0 to 40 (drawn from all 255
+        //:   non-poison 'char' values), and for each string length from 0 to
+        //:   'k_MAX_LENGTH', generate strings of characters drawn from both
+        //:   the set and its neighborhood, place each at several offsets in a
+        //:   poisoned buffer, and compare the result of each of the four
+        //:   functions with that of a naive search.  (C-1..4)
+        //
+        // Testing:
+        //   const char *findFirstOf(string, length, chars, numChars);
+        //   const char *findFirstNotOf(string, length, chars, numChars);
+        //   const char *findLastOf(string, length, chars, numChars);
+        //   const char *findLastNotOf(string, length, chars, numChars);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCHARACTER SET SEARCHES"
+                            "\n======================\n");
+
+        const Imp::InstructionSet ORIGINAL = Imp::instructionSet();
+
+        char buffer[k_BUFFER];
+        char set[64];
+
+        for (int is = 0; is < numInstructionSets(); ++is) {
+            Imp::setInstructionSet(static_cast<Imp::InstructionSet>(is));
+
+            if (veryVerbose) printf("\t%s\n", INSTRUCTION_SET_NAMES[is]);
+
+            Random random(is + 1);
+
+            for (size_t numChars = 0; numChars <= 40; ++numChars) {
+              for (int trial = 0; trial < 4; ++trial) {
+                // Trial 0 draws the set from letters, so that members share
+                // their low 4 bits with non-members; trial 1 from characters
+                // whose high bit is set; trial 3 includes duplicates.
+
+                for (size_t i = 0; i < numChars; ++i) {
+                    char c;
+                    do {
+                        const unsigned int r = random.next();
+                        c = 0 == trial ? static_cast<char>('a' + r % 26)
+                          : 1 == trial ? static_cast<char>(0x80 | (r & 0x7f))
+                          : static_cast<char>(r & 0xff);
+                    } while (POISON == c);
+                    set[i] = 3 == trial && i ? set[random.next() % i] : c;
+                }
+
+                for (size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                  for (int offset = 0; offset < 32; offset += 7) {
+                    fillPoisoned(buffer);
+                    char *const STRING = buffer + k_MARGIN + offset;
+
+                    // Choose a density of members such that every function
+                    // returns non-null results at various positions.
+
+                    const unsigned int density = random.next() % 8;
+
+                    for (size_t i = 0; i < length; ++i) {
+                        const unsigned int r = random.next();
+                        char c;
+                        if (numChars && (r >> 4) % 8 < density) {
+                            c = set[(r >> 8) % numChars];
+                        }
+                        else {
+                            do {
+                                c = 0 == trial
+                                    ? static_cast<char>('A' + r % 58)
+                                    : static_cast<char>(random.next());
+                            } while (POISON == c);
+                        }
+                        STRING[i] = c;
+                    }
+
+                    const char *const SET = numChars ? set : 0;
+                    const char *const S   = length ? STRING : 0;
+
+                    ASSERTV(is, numChars, trial, length, offset,
+                            offsetOf(naiveFindIn(S, length, SET, numChars,
+                                                 true, false), S) ==
+                            offsetOf(Util::findFirstOf(S, length,
+                                                       SET, numChars), S));
+                    ASSERTV(is, numChars, trial, length, offset,
+                            offsetOf(naiveFindIn(S, length, SET, numChars,
+                                                 false, false), S) ==
+                            offsetOf(Util::findFirstNotOf(S, length,
+                                                          SET, numChars), S));
+                    ASSERTV(is, numChars, trial, length, offset,
+                            offsetOf(naiveFindIn(S, length, SET, numChars,
+                                                 true, true), S) ==
+                            offsetOf(Util::findLastOf(S, length,
+                                                      SET, numChars), S));
+                    ASSERTV(is, numChars, trial, length, offset,
+                            offsetOf(naiveFindIn(S, length, SET, numChars,
+                                                 false, true), S) ==
+                            offsetOf(Util::findLastNotOf(S, length,
+                                                         SET, numChars), S));
+                  }
+                }
+              }
+            }
+        }
+
+        Imp::setInstructionSet(ORIGINAL);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SUBSTRING SEARCHES
+        //
+        // Concerns:
+        //: 1 'find' and 'findLast' return the first or last occurrence of the
+        //:   pattern, and 0 if there is none, using each instruction set
+        //:   supported by the processor.
+        //:
+        //: 2 An empty pattern is found at the start ('find') or the end
+        //:   ('findLast') of the string, and a pattern longer than the string
+        //:   is not found.
+        //:
+        //: 3 Occurrences at the first and last possible positions, and those
+        //:   straddling block boundaries, are found.
+        //:
+        //: 4 Partial matches (positions matching the first and last character
+        //:   of the pattern, but not the whole pattern) are rejected.
+        //:
+        //: 5 No character outside the string is examined.
+        //
+        // Plan:
+        //: 1 For each instruction set supported by the processor, for each
+        //:   pattern length from 0 to 40, and for each string length from 0
+        //:   to 'k_MAX_LENGTH', generate strings over a small alphabet (so
+        //:   that partial matches are frequent) with the pattern planted at
+        //:   zero, one or two random positions, place each at several offsets
+        //:   in a poisoned buffer, and compare the results with those of a
+        //:   naive search.  (C-1..5)
+        //
+        // Testing:
+        //   const char *find(string, length, pattern, patternLength);
+        //   const char *findLast(string, length, pattern, patternLength);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBSTRING SEARCHES"
+                            "\n==================\n");
+
+        const Imp::InstructionSet ORIGINAL = Imp::instructionSet();
+
+        char buffer[k_BUFFER];
+        char pattern[64];
+
+        for (int is = 0; is < numInstructionSets(); ++is) {
+            Imp::setInstructionSet(static_cast<Imp::InstructionSet>(is));
+
+            if (veryVerbose) printf("\t%s\n", INSTRUCTION_SET_NAMES[is]);
+
+            Random random(is + 1);
+
+            for (size_t m = 0; m <= 40; ++m) {
+                for (size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                  for (int trial = 0; trial < 6; ++trial) {
+                    const int offset = trial * 5 % 32;
+
+                    fillPoisoned(buffer);
+                    char *const STRING = buffer + k_MARGIN + offset;
+
+                    for (size_t i = 0; i < m; ++i) {
+                        pattern[i] = static_cast<char>('a'
+                                                       + random.next() % 3);
+                    }
+                    for (size_t i = 0; i < length; ++i) {
+                        STRING[i] = static_cast<char>('a' + random.next() % 3);
+                    }
+
+                    // Plant the pattern 'trial % 3' times, at the start, at
+                    // the end, or at random positions.
+
+                    for (int k = 0; k < trial % 3 && m <= length; ++k) {
+                        const unsigned int r = random.next() % 4;
+                        const size_t       position =
+                                  0 == r ? 0
+                                : 1 == r ? length - m
+                                : random.next() % (length - m + 1);
+                        memcpy(STRING + position, pattern, m);
+                    }
+
+                    const char *const P = m ? pattern : 0;
+                    const char *const S = length ? STRING : 0;
+
+                    ASSERTV(is, m, length, trial,
+                            offsetOf(naiveFind(S, length, P, m), S) ==
+                            offsetOf(Util::find(S, length, P, m), S));
+                    ASSERTV(is, m, length, trial,
+                            offsetOf(naiveFindLast(S, length, P, m), S) ==
+                            offsetOf(Util::findLast(S, length, P, m), S));
+
+                    // A pattern differing from the string only in its middle
+                    // character is not found.
+
+                    if (m >= 3 && m <= length) {
+                        memcpy(STRING, pattern, m);
+                        STRING[m / 2] = 'z';
+                        ASSERTV(is, m, length, trial,
+                                offsetOf(naiveFind(S, length, P, m), S) ==
+                                offsetOf(Util::find(S, length, P, m), S));
+                        ASSERTV(is, m, length, trial,
+                                offsetOf(naiveFindLast(S, length, P, m), S) ==
+                                offsetOf(Util::findLast(S, length, P, m), S));
+                    }
+                  }
+                }
+            }
+        }
+
+        Imp::setInstructionSet(ORIGINAL);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CHARACTER SEARCHES
+        //
+        // Concerns:
+        //: 1 'find' and 'findLast' for a single character return the first or
+        //:   last occurrence of the character, and 0 if there is none, using
+        //:   each instruction set supported by the processor.
+        //:
+        //: 2 Occurrences at every position of strings of every length around
+        //:   the block sizes are found, including characters whose high bit
+        //:   is set and the null character.
+        //:
+        //: 3 No character outside the string is examined.
+        //
+        // Plan:
+        //: 1 For each instruction set supported by the processor, for each
+        //:   string length from 0 to 'k_MAX_LENGTH', for each offset from 0
+        //:   to 31 in a poisoned buffer, and for each position in the string
+        //:   (and none), plant the sought character at that position (and at
+        //:   a second, later position) in a string not otherwise containing
+        //:   it, and verify the results of both functions.  (C-1..3)
+        //
+        // Testing:
+        //   const char *find(const char *, size_t, char);
+        //   const char *findLast(const char *, size_t, char);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCHARACTER SEARCHES"
+                            "\n==================\n");
+
+        const Imp::InstructionSet ORIGINAL = Imp::instructionSet();
+
+        static const char TARGETS[] = { 'x', '\0', '\xff', '\x80' };
+        const int NUM_TARGETS = sizeof TARGETS / sizeof *TARGETS;
+
+        char buffer[k_BUFFER];
+
+        for (int is = 0; is < numInstructionSets(); ++is) {
+            Imp::setInstructionSet(static_cast<Imp::InstructionSet>(is));
+
+            if (veryVerbose) printf("\t%s\n", INSTRUCTION_SET_NAMES[is]);
+
+            for (int ti = 0; ti < NUM_TARGETS; ++ti) {
+              const char TARGET = TARGETS[ti];
+
+              for (size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                for (int offset = 0; offset < 32; ++offset) {
+                  fillPoisoned(buffer);
+                  char *const STRING = buffer + k_MARGIN + offset;
+
+                  // Surround the string by the target, which must not be
+                  // found.
+
+                  memset(STRING - k_MARGIN + 1, TARGET, k_MARGIN - 1);
+                  memset(STRING + length, TARGET, k_MARGIN);
+
+                  for (size_t i = 0; i < length; ++i) {
+                      STRING[i] = static_cast<char>('a' + i % 23);
+                  }
+
+                  const char *const S = length ? STRING : 0;
+
+                  ASSERTV(is, ti, length, offset,
+                          0 == Imp::find(S, length, TARGET));
+                  ASSERTV(is, ti, length, offset,
+                          0 == Imp::findLast(S, length, TARGET));
+
+                  for (size_t position = 0; position < length; ++position) {
+                      STRING[position] = TARGET;
+
+                      ASSERTV(is, ti, length, offset, position,
+                              STRING + position ==
+                                             Imp::find(S, length, TARGET));
+                      ASSERTV(is, ti, length, offset, position,
+                              STRING + position ==
+                                         Imp::findLast(S, length, TARGET));
+
+                      const size_t second = (position + length) / 2 + 1;
+                      if (second < length) {
+                          STRING[second] = TARGET;
+
+                          ASSERTV(is, ti, length, offset, position,
+                                  STRING + position ==
+                                             Imp::find(S, length, TARGET));
+                          ASSERTV(is, ti, length, offset, position,
+                                  STRING + second ==
+                                         Imp::findLast(S, length, TARGET));
+
+                          STRING[second] = static_cast<char>(
+                                                          'a' + second % 23);
+                      }
+
+                      STRING[position] = static_cast<char>(
+                                                        'a' + position % 23);
+                  }
+                }
+              }
+            }
+        }
+
+        Imp::setInstructionSet(ORIGINAL);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY TEMPLATE
+        //
+        // Concerns:
+        //: 1 The functions of the primary template return the same results as
+        //:   a naive search for strings of a character type other than
+        //:   'char'.
+        //:
+        //: 2 Characters are compared using the 'eq' and 'compare' functions of
+        //:   the traits type.
+        //:
+        //: 3 An empty pattern is found at the start ('find') or the end
+        //:   ('findLast') of the string; an empty set contains no character.
+        //
+        // Plan:
+        //: 1 Using a table of strings, patterns and sets, verify the results
+        //:   of each function for strings of 'wchar_t' (converted from the
+        //:   table entries).  (C-1, 3)
+        //:
+        //: 2 Using the 'CaseInsensitiveTraits' test type, verify that a
+        //:   pattern or set member in a different case is found.  (C-2)
+        //
+        // Testing:
+        //   const char_type *find(string, length, pattern, patternLength);
+        //   const char_type *findLast(string, length, pattern, patternLength);
+        //   const char_type *findFirstOf(string, length, chars, numChars);
+        //   const char_type *findFirstNotOf(string, length, chars, numChars);
+        //   const char_type *findLastOf(string, length, chars, numChars);
+        //   const char_type *findLastNotOf(string, length, chars, numChars);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY TEMPLATE"
+                            "\n================\n");
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_string;     // string searched
+            const char *d_pattern;    // pattern or set
+            int         d_find;       // expected 'find'
+            int         d_findLast;   // expected 'findLast'
+            int         d_firstOf;    // expected 'findFirstOf'
+            int         d_firstNot;   // expected 'findFirstNotOf'
+            int         d_lastOf;     // expected 'findLastOf'
+            int         d_lastNot;    // expected 'findLastNotOf'
+        } DATA[] = {
+            //LINE  STRING      PATTERN  FIND LAST  FOF  FNOT  LOF  LNOT
+            //----  ----------  -------  ---- ----  ---  ----  ---  ----
+            { L_,   "",         "",         0,   0,  -1,   -1,  -1,   -1 },
+            { L_,   "",         "a",       -1,  -1,  -1,   -1,  -1,   -1 },
+            { L_,   "abc",      "",         0,   3,  -1,    0,  -1,    2 },
+            { L_,   "abc",      "a",        0,   0,   0,    1,   0,    2 },
+            { L_,   "abc",      "c",        2,   2,   2,    0,   2,    1 },
+            { L_,   "abc",      "abcd",    -1,  -1,   0,   -1,   2,   -1 },
+            { L_,   "abcabc",   "bc",       1,   4,   1,    0,   5,    3 },
+            { L_,   "abcabc",   "ca",       2,   2,   0,    1,   5,    4 },
+            { L_,   "aaaa",     "aa",       0,   2,   0,   -1,   3,   -1 },
+            { L_,   "xyzzy",    "zy",       3,   3,   1,    0,   4,    0 },
+            { L_,   "xyzzy",    "q",       -1,  -1,  -1,    0,  -1,    4 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *S    = DATA[ti].d_string;
+            const char *PAT  = DATA[ti].d_pattern;
+
+            const size_t N = strlen(S);
+            const size_t M = strlen(PAT);
+
+            wchar_t string[16];
+            wchar_t pattern[16];
+            for (size_t i = 0; i <= N; ++i) {
+                string[i] = static_cast<wchar_t>(S[i]);
+            }
+            for (size_t i = 0; i <= M; ++i) {
+                pattern[i] = static_cast<wchar_t>(PAT[i]);
+            }
+
+            if (veryVerbose) { T_ P_(LINE) P_(S) P(PAT) }
+
+#define OFFSET(EXPR) (static_cast<int>((EXPR) ? (EXPR) - string : -1))
+
+            ASSERTV(LINE, DATA[ti].d_find ==
+                             OFFSET(WUtil::find(string, N, pattern, M)));
+            ASSERTV(LINE, DATA[ti].d_findLast ==
+                         OFFSET(WUtil::findLast(string, N, pattern, M)));
+            ASSERTV(LINE, DATA[ti].d_firstOf ==
+                      OFFSET(WUtil::findFirstOf(string, N, pattern, M)));
+            ASSERTV(LINE, DATA[ti].d_firstNot ==
+                   OFFSET(WUtil::findFirstNotOf(string, N, pattern, M)));
+            ASSERTV(LINE, DATA[ti].d_lastOf ==
+                       OFFSET(WUtil::findLastOf(string, N, pattern, M)));
+            ASSERTV(LINE, DATA[ti].d_lastNot ==
+                    OFFSET(WUtil::findLastNotOf(string, N, pattern, M)));
+
+#undef OFFSET
+
+            // The specialization for 'char' gives the same results.
+
+            ASSERTV(LINE, DATA[ti].d_find ==
+                               offsetOf(Util::find(S, N, PAT, M), S));
+            ASSERTV(LINE, DATA[ti].d_findLast ==
+                           offsetOf(Util::findLast(S, N, PAT, M), S));
+            ASSERTV(LINE, DATA[ti].d_firstOf ==
+                        offsetOf(Util::findFirstOf(S, N, PAT, M), S));
+            ASSERTV(LINE, DATA[ti].d_firstNot ==
+                     offsetOf(Util::findFirstNotOf(S, N, PAT, M), S));
+            ASSERTV(LINE, DATA[ti].d_lastOf ==
+                         offsetOf(Util::findLastOf(S, N, PAT, M), S));
+            ASSERTV(LINE, DATA[ti].d_lastNot ==
+                      offsetOf(Util::findLastNotOf(S, N, PAT, M), S));
+        }
+
+        if (verbose) printf("\nComparing using the traits.\n");
+        {
+            typedef bslalg::StringSearchUtil<CaseInsensitiveTraits> CIUtil;
+
+            const char STRING[] = "Hello, World";
+            const size_t N      = sizeof STRING - 1;
+
+            ASSERT(STRING + 7 == CIUtil::find(STRING, N, "wORLD", 5));
+            ASSERT(STRING + 7 == CIUtil::findLast(STRING, N, "wO", 2));
+            ASSERT(STRING     == CIUtil::findFirstOf(STRING, N, "h", 1));
+            ASSERT(STRING + 1 == CIUtil::findFirstNotOf(STRING, N, "h", 1));
+            ASSERT(STRING + 7 == CIUtil::findLastOf(STRING, N, "w", 1));
+            ASSERT(STRING + 10 == CIUtil::findLastNotOf(STRING, N, "D", 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // INSTRUCTION SET SELECTION
+        //
+        // Concerns:
+        //: 1 'instructionSet' initially returns the value of
+        //:   'detectInstructionSet'.
+        //:
+        //: 2 'setInstructionSet' sets the value returned by 'instructionSet'
+        //:   to any value not exceeding that of 'detectInstructionSet'.
+        //:
+        //: 3 'detectInstructionSet' returns the same value on each call.
+        //
+        // Plan:
+        //: 1 Verify the initial value of 'instructionSet', then set each
+        //:   supported instruction set in turn and verify that it is
+        //:   returned, and finally restore the original value.  (C-1..3)
+        //
+        // Testing:
+        //   InstructionSet detectInstructionSet();
+        //   InstructionSet instructionSet();
+        //   void setInstructionSet(InstructionSet value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSTRUCTION SET SELECTION"
+                            "\n=========================\n");
+
+        const Imp::InstructionSet DETECTED = Imp::detectInstructionSet();
+
+        if (verbose) printf("\tDetected: %s\n",
+                            INSTRUCTION_SET_NAMES[DETECTED]);
+
+        ASSERT(DETECTED == Imp::detectInstructionSet());
+        ASSERT(DETECTED == Imp::instructionSet());
+
+        for (int is = 0; is <= DETECTED; ++is) {
+            Imp::setInstructionSet(static_cast<Imp::InstructionSet>(is));
+            ASSERTV(is, is == Imp::instructionSet());
+            ASSERTV(is, DETECTED == Imp::detectInstructionSet());
+        }
+
+        Imp::setInstructionSet(DETECTED);
+        ASSERT(DETECTED == Imp::instructionSet());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform each search on a short string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const char   S[] = "the quick brown fox jumps over the lazy dog";
+        const size_t N   = sizeof S - 1;
+
+        ASSERT(S      == Util::find(S, N, "the", 3));
+        ASSERT(S + 31 == Util::findLast(S, N, "the", 3));
+        ASSERT(0      == Util::find(S, N, "cat", 3));
+        ASSERT(S + 3  == Util::findFirstOf(S, N, " ,", 2));
+        ASSERT(S + 39 == Util::findLastOf(S, N, " ,", 2));
+        ASSERT(S + 1  == Util::findFirstNotOf(S, N, "t", 1));
+        ASSERT(S + 41 == Util::findLastNotOf(S, N, "g", 1));
+        ASSERT(S + 16 == Imp::find(S, N, 'f'));
+        ASSERT(S + 42 == Imp::findLast(S, N, 'g'));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SEARCH THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Measure the throughput of each search, using each instruction set
+        //:   supported by the processor, on strings typical of text protocol
+        //:   messages.
+        //
+        // Plan:
+        //: 1 For each of a set of lengths from 16 to 64K characters, search a
+        //:   string of that length (not containing the sought character,
+        //:   substring or set member) repeatedly, and report the throughput
+        //:   in GB/s.
+        //
+        // Testing:
+        //   PERFORMANCE: SEARCH THROUGHPUT
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: SEARCH THROUGHPUT"
+               "\n==============================\n");
+
+        const Imp::InstructionSet ORIGINAL = Imp::instructionSet();
+
+        static const int LENGTHS[] = { 16, 64, 256, 1024, 4096, 65536 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int MAX_LENGTH = 65536;
+        char *buffer = static_cast<char *>(malloc(MAX_LENGTH));
+        Random random(7);
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            buffer[i] = static_cast<char>('A' + random.next() % 26);
+        }
+
+        static const char *const FUNCTIONS[] = {
+            "find(char)", "find(str)", "findLast(str)", "findFirstOf(4)",
+            "findFirstOf(32)", "findLastNotOf(26)"
+        };
+        const int NUM_FUNCTIONS = sizeof FUNCTIONS / sizeof *FUNCTIONS;
+
+        const char SET[] = "|=\x01\x02" "abcdefghijklmnopqrstuvwxyz0123";
+        const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+        printf("%18s %8s", "function", "length");
+        for (int is = 0; is < numInstructionSets(); ++is) {
+            printf(" %10s", INSTRUCTION_SET_NAMES[is]);
+        }
+        printf("   (GB/s)\n");
+
+        for (int fi = 0; fi < NUM_FUNCTIONS; ++fi) {
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH     = LENGTHS[li];
+                const int ITERATIONS = (256 << 20) / LENGTH;
+
+                printf("%18s %8d", FUNCTIONS[fi], LENGTH);
+
+                for (int is = 0; is < numInstructionSets(); ++is) {
+                    Imp::setInstructionSet(
+                                         static_cast<Imp::InstructionSet>(is));
+
+                    long checksum = 0;
+
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    for (int i = 0; i < ITERATIONS; ++i) {
+                        const char *s = buffer + (i & 7);
+                        const int   n = LENGTH - 8;
+                        const char *r = 0;
+
+                        switch (fi) {
+                          case 0: r = Imp::find(s, n, '|');             break;
+                          case 1: r = Util::find(s, n, "|55=", 4);      break;
+                          case 2: r = Util::findLast(s, n, "|55=", 4);  break;
+                          case 3: r = Util::findFirstOf(s, n, SET, 4);  break;
+                          case 4: r = Util::findFirstOf(s, n, SET, 32); break;
+                          default: {
+                            r = Util::findLastNotOf(s, n, ALPHABET, 26);
+                          } break;
+                        }
+                        checksum += r ? r - s : -1;
+                    }
+                    timer.stop();
+
+                    const double SECONDS = timer.elapsedTime();
+                    printf(" %10.2f",
+                           static_cast<double>(LENGTH) * ITERATIONS
+                                                         / SECONDS / 1e9);
+                    if (checksum != -ITERATIONS) {
+                        printf("!");
+                    }
+                }
+                printf("\n");
+            }
+        }
+
+        Imp::setInstructionSet(ORIGINAL);
+        free(buffer);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
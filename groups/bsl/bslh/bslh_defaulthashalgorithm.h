@@ -0,0 +1,216 @@
+// bslh_defaulthashalgorithm.h                                        -*-C++-*-
+#ifndef INCLUDED_BSLH_DEFAULTHASHALGORITHM
+#define INCLUDED_BSLH_DEFAULTHASHALGORITHM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the default streaming hash algorithm for 'hashAppend'.
+//
+//@CLASSES:
+//  bslh::DefaultHashAlgorithm: default algorithm accumulating a hash value
+//
+//@SEE_ALSO: bslh_hash, bslalg_bytehashutil
+//
+//@DESCRIPTION: This component provides a mechanism class,
+// 'bslh::DefaultHashAlgorithm', that computes a hash value of a sequence of
+// bytes supplied in any number of fragments.  'DefaultHashAlgorithm' is the
+// default *hashing algorithm* of the 'hashAppend' protocol described in
+// 'bslh_hash': a type's 'hashAppend' function passes each of the type's
+// salient attributes (ultimately, their bytes) to the algorithm, and the hash
+// value of the object is the result of the algorithm once all of its
+// attributes have been passed.
+//
+// A hashing algorithm is a type, 'ALGORITHM', that can be default-constructed
+// and supports the following operations, where 'algorithm' is a modifiable
+// object of type 'ALGORITHM', 'data' is an address of type 'const void *', and
+// 'numBytes' is of type 'size_t':
+//..
+//  Expression                        Semantics
+//  --------------------------------  ----------------------------------------
+//  ALGORITHM::result_type            the type of the hash value
+//  algorithm(data, numBytes)         append 'numBytes' bytes at 'data'
+//  algorithm.computeHash()           return the hash value of the bytes
+//                                    appended so far
+//..
+// 'DefaultHashAlgorithm' computes its hash value using the hash function of
+// 'bslalg_bytehashutil', consuming the bytes as they are appended, so that the
+// hash value of the bytes appended to an algorithm object is the value that
+// 'bslalg::ByteHashUtil::hash' would return for their concatenation.  A
+// 'DefaultHashAlgorithm' object may optionally be constructed with a 64-bit
+// seed, which is used as the seed of 'bslalg::ByteHashUtil::hash'.
+//
+// Note that we reserve the right to change the values computed by the
+// algorithm in future releases; hash values should not be persisted or sent
+// to other processes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing Non-Contiguous Data
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the hash value of a name held as separate first and
+// last names.  We supply each part of the name to a 'DefaultHashAlgorithm' in
+// turn, and compute the hash value:
+//..
+//  bslh::DefaultHashAlgorithm algorithm;
+//
+//  algorithm("John", 4);
+//  algorithm("Smith", 5);
+//
+//  bslh::DefaultHashAlgorithm::result_type hash = algorithm.computeHash();
+//..
+// The result is the same as if the parts of the name had been concatenated:
+//..
+//  bslh::DefaultHashAlgorithm other;
+//
+//  other("JohnSmith", 9);
+//
+//  assert(hash == other.computeHash());
+//..
+// Note that the 'hashAppend' functions of most types append not only the
+// bytes of their attributes, but also values that delimit them (e.g., the
+// length of each string), so that different objects such as the names
+// "John Smith" and "Johns Mith" yield different hash values.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BYTEHASHUTIL
+#include <bslalg_bytehashutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // 'size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslh {
+
+                        // ==========================
+                        // class DefaultHashAlgorithm
+                        // ==========================
+
+class DefaultHashAlgorithm {
+    // This mechanism class computes a hash value of the bytes supplied to it
+    // (in any number of fragments) by calls to its function-call operator.
+
+    // DATA
+    bslalg::ByteHashAccumulator d_accumulator;  // hash state
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultHashAlgorithm(const DefaultHashAlgorithm&);
+    DefaultHashAlgorithm& operator=(const DefaultHashAlgorithm&);
+
+  public:
+    // TYPES
+    typedef native_std::size_t result_type;
+        // Type of the hash value computed by this algorithm.
+
+    // CREATORS
+    DefaultHashAlgorithm();
+    explicit DefaultHashAlgorithm(bsls::Types::Uint64 seed);
+        // Create an algorithm object that has been supplied no bytes.
+        // Optionally specify a 'seed' that perturbs the computed hash value.
+        // If 'seed' is not specified, 0 is used.
+
+    // ~DefaultHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, native_std::size_t numBytes);
+        // Supply the specified 'numBytes' bytes at the specified 'data'
+        // address to this algorithm, to be hashed following any bytes
+        // previously supplied.  The behavior is undefined unless 'data'
+        // refers to at least 'numBytes' readable bytes ('data' may be null if
+        // 'numBytes' is 0).
+
+    result_type computeHash();
+        // Return the hash value of the concatenation of the bytes supplied to
+        // this algorithm.  Note that more bytes may be supplied after calling
+        // this method, and that the value returned by a subsequent call will
+        // then be the hash value of all the bytes supplied.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class DefaultHashAlgorithm
+                        // --------------------------
+
+// CREATORS
+inline
+DefaultHashAlgorithm::DefaultHashAlgorithm()
+: d_accumulator()
+{
+}
+
+inline
+DefaultHashAlgorithm::DefaultHashAlgorithm(bsls::Types::Uint64 seed)
+: d_accumulator(seed)
+{
+}
+
+// MANIPULATORS
+inline
+void DefaultHashAlgorithm::operator()(const void         *data,
+                                      native_std::size_t  numBytes)
+{
+    BSLS_ASSERT_SAFE(data || 0 == numBytes);
+
+    d_accumulator.append(data, numBytes);
+}
+
+inline
+DefaultHashAlgorithm::result_type DefaultHashAlgorithm::computeHash()
+{
+    return static_cast<result_type>(d_accumulator.hash());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
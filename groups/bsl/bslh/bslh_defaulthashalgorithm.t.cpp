@@ -0,0 +1,316 @@
+// bslh_defaulthashalgorithm.t.cpp                                    -*-C++-*-
+#include <bslh_defaulthashalgorithm.h>
+
+#include <bslalg_bytehashutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that accumulates bytes and returns
+// their hash value, delegating to 'bslalg::ByteHashAccumulator'.  We verify
+// that the hash value of the bytes supplied, in any number of fragments, is
+// that returned by 'bslalg::ByteHashUtil::hash' for their concatenation (and
+// the seed supplied at construction).
+//-----------------------------------------------------------------------------
+// TYPES
+// [ 2] typedef size_t result_type;
+//
+// CREATORS
+// [ 2] DefaultHashAlgorithm();
+// [ 2] DefaultHashAlgorithm(Uint64 seed);
+//
+// MANIPULATORS
+// [ 2] void operator()(const void *data, size_t numBytes);
+// [ 2] result_type computeHash();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslh::DefaultHashAlgorithm Obj;
+typedef bsls::Types::Uint64        Uint64;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing Non-Contiguous Data
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the hash value of a name held as separate first and
+// last names.  We supply each part of the name to a 'DefaultHashAlgorithm' in
+// turn, and compute the hash value:
+//..
+    bslh::DefaultHashAlgorithm algorithm;
+
+    algorithm("John", 4);
+    algorithm("Smith", 5);
+
+    bslh::DefaultHashAlgorithm::result_type hash = algorithm.computeHash();
+//..
+// The result is the same as if the parts of the name had been concatenated:
+//..
+    bslh::DefaultHashAlgorithm other;
+
+    other("JohnSmith", 9);
+
+    ASSERT(hash == other.computeHash());
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // HASHING FRAGMENTED INPUT
+        //
+        // Concerns:
+        //: 1 'computeHash' returns the value of 'bslalg::ByteHashUtil::hash'
+        //:   for the concatenation of the bytes supplied, and the seed
+        //:   supplied at construction (0 by default), converted to
+        //:   'result_type'.
+        //:
+        //: 2 The result does not depend on how the bytes are divided among
+        //:   calls to the function-call operator.
+        //:
+        //: 3 Calling 'computeHash' does not prevent more bytes from being
+        //:   supplied.
+        //:
+        //: 4 'result_type' is 'size_t'.
+        //
+        // Plan:
+        //: 1 For each length from 0 to 200, supply a sequence of that length
+        //:   to default-constructed and seeded objects, in fragments of each
+        //:   size from 1 to 64, and compare the result of 'computeHash' with
+        //:   that of 'bslalg::ByteHashUtil::hash'.  (C-1..2)
+        //:
+        //: 2 Supply the bytes of a sequence one at a time, calling
+        //:   'computeHash' after each, and verify the result.  (C-3)
+        //:
+        //: 3 Verify 'sizeof(result_type)'.  (C-4)
+        //
+        // Testing:
+        //   typedef size_t result_type;
+        //   DefaultHashAlgorithm();
+        //   DefaultHashAlgorithm(Uint64 seed);
+        //   void operator()(const void *data, size_t numBytes);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASHING FRAGMENTED INPUT"
+                            "\n========================\n");
+
+        ASSERT(sizeof(size_t) == sizeof(Obj::result_type));
+        ASSERT(static_cast<Obj::result_type>(-1) > 0);
+
+        enum { k_MAX_LENGTH = 200 };
+
+        unsigned char data[k_MAX_LENGTH];
+        for (int i = 0; i < k_MAX_LENGTH; ++i) {
+            data[i] = static_cast<unsigned char>(i * 37 + 11);
+        }
+
+        const Uint64 SEED = 0xfedcba9876543210ULL;
+
+        if (verbose) printf("\nComparing with 'ByteHashUtil::hash'.\n");
+
+        for (int n = 0; n <= k_MAX_LENGTH; ++n) {
+            const size_t EXP = static_cast<size_t>(
+                                      bslalg::ByteHashUtil::hash(data, n));
+            const size_t EXP_SEEDED = static_cast<size_t>(
+                                bslalg::ByteHashUtil::hash(data, n, SEED));
+
+            for (int size = 1; size <= 64; ++size) {
+                Obj mX;
+                Obj mY(SEED);
+                for (int i = 0; i < n; i += size) {
+                    const int count = size < n - i ? size : n - i;
+                    mX(data + i, count);
+                    mY(data + i, count);
+                }
+                ASSERTV(n, size, EXP        == mX.computeHash());
+                ASSERTV(n, size, EXP_SEEDED == mY.computeHash());
+            }
+        }
+
+        if (verbose) printf("\nCalling 'computeHash' repeatedly.\n");
+        {
+            Obj mX;
+            ASSERT(static_cast<size_t>(bslalg::ByteHashUtil::hash(data, 0))
+                                                          == mX.computeHash());
+            for (int n = 1; n <= k_MAX_LENGTH; ++n) {
+                mX(data + n - 1, 1);
+                ASSERTV(n, static_cast<size_t>(
+                                        bslalg::ByteHashUtil::hash(data, n))
+                                                          == mX.computeHash());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Hash a few short sequences and verify that equal sequences have
+        //:   equal hash values, and different sequences (or seeds) different
+        //:   hash values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mA;  mA("abc", 3);
+        Obj mB;  mB("ab", 2);  mB("c", 1);
+        Obj mC;  mC("abd", 3);
+        Obj mD(1);  mD("abc", 3);
+        Obj mE;
+
+        const size_t A = mA.computeHash();
+
+        if (veryVerbose) { P(A) }
+
+        ASSERT(A == mB.computeHash());
+        ASSERT(A != mC.computeHash());
+        ASSERT(A != mD.computeHash());
+        ASSERT(A != mE.computeHash());
+
+        mE("abc", 3);
+        ASSERT(A == mE.computeHash());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,544 @@
+// bslh_hash.h                                                        -*-C++-*-
+#ifndef INCLUDED_BSLH_HASH
+#define INCLUDED_BSLH_HASH
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hash functor built on the 'hashAppend' protocol.
+//
+//@CLASSES:
+//  bslh::Hash: functor hashing any type that supports 'hashAppend'
+//
+//@SEE_ALSO: bslh_defaulthashalgorithm, bslstl_hash
+//
+//@DESCRIPTION: This component provides a hash functor, 'bslh::Hash', that
+// computes the hash value of an object of any type supporting the
+// 'hashAppend' protocol, together with the 'hashAppend' overloads for the
+// fundamental types, pointers, and arrays.
+//
+///The 'hashAppend' Protocol
+///-------------------------
+// The 'hashAppend' protocol separates the two concerns of hashing an object:
+// *which* of the object's attributes contribute to its hash value (known only
+// to the type), and *how* those attributes are combined into a hash value
+// (known only to the hashing algorithm).  A type opts into the protocol by
+// providing, in its own namespace (so that it is found by argument-dependent
+// lookup), a free function template:
+//..
+//  template <class HASH_ALGORITHM>
+//  void hashAppend(HASH_ALGORITHM& algorithm, const TYPE& object);
+//..
+// that calls 'hashAppend(algorithm, attribute)' for each of the salient
+// attributes of 'object', in a fixed order.  A *hashing algorithm* (see
+// 'bslh_defaulthashalgorithm') is a mechanism to which bytes are supplied by
+// calling 'algorithm(data, numBytes)', and which returns the hash value of all
+// the bytes supplied from 'computeHash'.  'bslh::Hash<HASH_ALGORITHM>' is a
+// functor that hashes an object by creating a 'HASH_ALGORITHM', passing the
+// object to 'hashAppend', and returning the result of 'computeHash'.
+//
+// The protocol has several advantages over specializing 'bsl::hash' for each
+// type:
+//
+//: o A type's 'hashAppend' needs only to name its attributes, which is simpler
+//:   than writing a hash function and far less error prone than writing one
+//:   that combines the hash values of the attributes.
+//:
+//: o The attributes of an object are fed to a single algorithm, so that
+//:   hashing an object makes one pass over its bytes, and the quality of the
+//:   resulting hash value is that of the algorithm (rather than that of an
+//:   ad hoc combination of the hash values of the attributes).
+//:
+//: o The algorithm can be replaced (e.g., by a seeded or a cryptographic
+//:   algorithm) without changing any type's 'hashAppend'.
+//
+// A 'hashAppend' overload is required to supply the same bytes to the
+// algorithm for objects that compare equal, and should supply different bytes
+// for objects that do not.  In particular, an overload for a type having a
+// variable number of attributes (e.g., a container) should also supply that
+// number, so that (e.g.) the sequences '[[1, 2], [3]]' and '[[1], [2, 3]]'
+// are not hashed identically.  The 'hashAppend' overloads provided by 'bsl'
+// containers supply their size followed by their elements, and those of
+// 'bsl::basic_string' and 'bslstl::StringRef' supply their characters
+// followed by their length.
+//
+///Fundamental Types
+///- - - - - - - - -
+// This component provides 'hashAppend' overloads in namespace 'bslh' for
+// 'bool', the character and integral types, the floating-point types,
+// pointers, and arrays:
+//
+//: o Integral and character types, and 'bool', supply their object
+//:   representation.  Enumerations are converted to an integral type.
+//:
+//: o 'float' and 'double' supply their object representation, except that
+//:   negative zero is replaced by positive zero (since the two compare equal).
+//:   'long double' is hashed as a 'double' (as by 'bsl::hash<long double>'),
+//:   since its object representation may contain padding bytes.
+//:
+//: o Pointers supply the bits of the address.  Note that the memory to which
+//:   a pointer refers is *not* examined; in particular, a 'const char *' is
+//:   not hashed as a string.
+//:
+//: o Arrays supply each of their elements in turn (an array having a fixed
+//:   size, the size is not supplied).
+//
+// Note that a 'hashAppend' function for a user-defined type that calls
+// 'hashAppend' for attributes of fundamental type must be able to find the
+// overloads in namespace 'bslh'.  If the type's 'hashAppend' is defined in a
+// namespace other than 'bslh', a using declaration,
+// 'using bslh::hashAppend;', ensures that they are found for any hashing
+// algorithm.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing a User-Defined Type
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a value-semantic type, 'Point', representing a point
+// in the plane, and that we want to use points as keys in a hash table:
+//..
+//  class Point {
+//      // This class represents a point in the plane.
+//
+//      // DATA
+//      int d_x;  // x-coordinate
+//      int d_y;  // y-coordinate
+//
+//      // FRIENDS
+//      template <class HASH_ALGORITHM>
+//      friend void hashAppend(HASH_ALGORITHM& algorithm, const Point& point);
+//
+//    public:
+//      // CREATORS
+//      Point(int x, int y)
+//          // Create a point having the specified 'x' and 'y' coordinates.
+//      : d_x(x)
+//      , d_y(y)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      bool operator==(const Point& other) const
+//          // Return 'true' if this point has the same value as the specified
+//          // 'other' point, and 'false' otherwise.
+//      {
+//          return d_x == other.d_x && d_y == other.d_y;
+//      }
+//  };
+//..
+// Rather than writing a hash function for 'Point', we define a 'hashAppend'
+// function that supplies its salient attributes, its coordinates, to a
+// hashing algorithm:
+//..
+//  template <class HASH_ALGORITHM>
+//  void hashAppend(HASH_ALGORITHM& algorithm, const Point& point)
+//      // Supply the salient attributes of the specified 'point' to the
+//      // specified 'algorithm'.
+//  {
+//      using bslh::hashAppend;
+//      hashAppend(algorithm, point.d_x);
+//      hashAppend(algorithm, point.d_y);
+//  }
+//..
+// Then, 'bslh::Hash<>' can hash points, using the default hashing algorithm:
+//..
+//  bslh::Hash<> hasher;
+//
+//  const Point A(1, 2);
+//  const Point B(1, 2);
+//  const Point C(2, 1);
+//
+//  assert(hasher(A) == hasher(B));
+//  assert(hasher(A) != hasher(C));
+//..
+// Note that 'bslh::Hash<>' is also the hash functor used by 'bsl::hash' for
+// types that do not specialize it, so that (e.g.) a
+// 'bsl::unordered_set<Point>' requires no hash functor to be specified.
+//
+///Example 2: Using a Different Hashing Algorithm
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need hash values of points computed by the well-known
+// FNV-1a hash function (e.g., to match values computed by another system).
+// We define a hashing algorithm implementing FNV-1a:
+//..
+//  class Fnv1aAlgorithm {
+//      // This mechanism class computes the 32-bit FNV-1a hash value of the
+//      // bytes supplied to it.
+//
+//      // DATA
+//      unsigned int d_state;  // hash value of the bytes supplied so far
+//
+//    public:
+//      // TYPES
+//      typedef unsigned int result_type;
+//
+//      // CREATORS
+//      Fnv1aAlgorithm()
+//          // Create an algorithm object that has been supplied no bytes.
+//      : d_state(2166136261u)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void operator()(const void *data, size_t numBytes)
+//          // Supply the specified 'numBytes' bytes at the specified 'data'
+//          // address to this algorithm.
+//      {
+//          const unsigned char *bytes =
+//                                  static_cast<const unsigned char *>(data);
+//          for (size_t i = 0; i < numBytes; ++i) {
+//              d_state = (d_state ^ bytes[i]) * 16777619u;
+//          }
+//      }
+//
+//      result_type computeHash()
+//          // Return the hash value of the bytes supplied to this algorithm.
+//      {
+//          return d_state;
+//      }
+//  };
+//..
+// Finally, we hash points using 'Fnv1aAlgorithm', without any change to
+// 'Point':
+//..
+//  bslh::Hash<Fnv1aAlgorithm> fnvHasher;
+//
+//  assert(fnvHasher(A) == fnvHasher(B));
+//  assert(fnvHasher(A) != fnvHasher(C));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLH_DEFAULTHASHALGORITHM
+#include <bslh_defaulthashalgorithm.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYDEFAULTCONSTRUCTIBLE
+#include <bslmf_istriviallydefaultconstructible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // 'size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslh {
+
+                                // ===========
+                                // struct Hash
+                                // ===========
+
+template <class HASH_ALGORITHM = DefaultHashAlgorithm>
+struct Hash {
+    // This 'struct' provides a stateless functor returning the hash value of
+    // an object of any type supporting the 'hashAppend' protocol, computed
+    // by the (template parameter) 'HASH_ALGORITHM'.  'HASH_ALGORITHM' must be
+    // default-constructible, and supply the function-call operator and
+    // 'computeHash' method described in 'bslh_defaulthashalgorithm'.
+
+    // TYPES
+    typedef native_std::size_t result_type;
+        // Type of the hash value returned by this functor.
+
+    //! Hash() = default;
+        // Create a 'Hash' object.
+
+    //! Hash(const Hash& original) = default;
+        // Create a 'Hash' object.  Note that as 'Hash' is an empty
+        // (stateless) type, this operation has no observable effect.
+
+    //! ~Hash() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! Hash& operator=(const Hash& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+        // Note that as 'Hash' is an empty (stateless) type, this operation
+        // has no observable effect.
+
+    // ACCESSORS
+    template <class TYPE>
+    result_type operator()(const TYPE& key) const;
+        // Return the hash value of the specified 'key', computed by a
+        // 'HASH_ALGORITHM' object to which 'key' is supplied by
+        // 'hashAppend'.
+};
+
+// FREE FUNCTIONS
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, bool input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, char input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, signed char input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned char input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, wchar_t input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, short input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned short input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, int input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned int input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, long input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned long input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, long long input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned long long input);
+    // Supply the object representation of the specified 'input' to the
+    // specified 'algorithm'.
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, float input);
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, double input);
+    // Supply the object representation of the specified 'input' to the
+    // specified 'algorithm', replacing negative zero with positive zero.
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, long double input);
+    // Supply the specified 'input', converted to 'double', to the specified
+    // 'algorithm'.
+
+template <class HASH_ALGORITHM, class TYPE>
+void hashAppend(HASH_ALGORITHM& algorithm, TYPE *const& input);
+    // Supply the bits of the address held by the specified 'input' pointer
+    // to the specified 'algorithm'.  Note that the memory to which 'input'
+    // refers is not examined.
+
+template <class HASH_ALGORITHM, class TYPE, native_std::size_t NUM_ELEMENTS>
+void hashAppend(HASH_ALGORITHM& algorithm, TYPE (&input)[NUM_ELEMENTS]);
+    // Supply each of the elements of the specified 'input' array, in order,
+    // to the specified 'algorithm'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                                // -----------
+                                // struct Hash
+                                // -----------
+
+// ACCESSORS
+template <class HASH_ALGORITHM>
+template <class TYPE>
+inline
+typename Hash<HASH_ALGORITHM>::result_type
+Hash<HASH_ALGORITHM>::operator()(const TYPE& key) const
+{
+    HASH_ALGORITHM algorithm;
+    hashAppend(algorithm, key);
+    return static_cast<result_type>(algorithm.computeHash());
+}
+
+// FREE FUNCTIONS
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, bool input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, char input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, signed char input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned char input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, wchar_t input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, short input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned short input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, int input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned int input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, long input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned long input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, long long input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, unsigned long long input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, float input)
+{
+    if (0 == input) {
+        input = 0;  // Replace negative zero with positive zero.
+    }
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, double input)
+{
+    if (0 == input) {
+        input = 0;  // Replace negative zero with positive zero.
+    }
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, long double input)
+{
+    hashAppend(algorithm, static_cast<double>(input));
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, TYPE *const& input)
+{
+    algorithm(&input, sizeof input);
+}
+
+template <class HASH_ALGORITHM, class TYPE, native_std::size_t NUM_ELEMENTS>
+inline
+void hashAppend(HASH_ALGORITHM& algorithm, TYPE (&input)[NUM_ELEMENTS])
+{
+    for (native_std::size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        hashAppend(algorithm, input[i]);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'Hash'
+//: o 'bslh::Hash<HASH_ALGORITHM>' is trivially default constructible.
+//: o 'bslh::Hash<HASH_ALGORITHM>' is trivially copyable.
+
+namespace bsl {
+
+template <class HASH_ALGORITHM>
+struct is_trivially_default_constructible<
+                                   ::BloombergLP::bslh::Hash<HASH_ALGORITHM> >
+: bsl::true_type
+{};
+
+template <class HASH_ALGORITHM>
+struct is_trivially_copyable< ::BloombergLP::bslh::Hash<HASH_ALGORITHM> >
+: bsl::true_type
+{};
+
+}  // close namespace bsl
+
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,664 @@
+// bslh_hash.t.cpp                                                    -*-C++-*-
+#include <bslh_hash.h>
+
+#include <bslh_defaulthashalgorithm.h>
+
+#include <bslmf_issame.h>
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_istriviallydefaultconstructible.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a functor, 'bslh::Hash', and the
+// 'hashAppend' overloads for fundamental types, pointers, and arrays.  We
+// verify the 'hashAppend' overloads using a hashing algorithm that records the
+// bytes supplied to it, checking that each overload supplies exactly the
+// documented bytes.  We then verify that 'bslh::Hash' returns the hash value
+// computed by its algorithm from the bytes supplied by 'hashAppend', using
+// both 'DefaultHashAlgorithm' and the recording algorithm, and that it has the
+// documented traits.
+//-----------------------------------------------------------------------------
+// CLASS 'Hash'
+// [ 3] typedef size_t result_type;
+// [ 3] result_type operator()(const TYPE& key) const;
+//
+// FREE FUNCTIONS
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, bool input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, char input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, signed char input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, unsigned char input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, wchar_t input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, short input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, unsigned short input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, int input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, unsigned int input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, long input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, unsigned long input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, long long input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, unsigned long long input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, float input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, double input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, long double input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, TYPE *const& input);
+// [ 2] void hashAppend(HASH_ALGORITHM& algorithm, TYPE (&input)[N]);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ 3] TYPE TRAITS
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslh::Hash<> Obj;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class RecordingAlgorithm {
+    // This hashing algorithm records the bytes supplied to it (up to a fixed
+    // capacity) and the number of calls to its function-call operator.  Its
+    // hash value is the number of bytes supplied.
+
+    // DATA
+    unsigned char d_bytes[256];  // bytes supplied
+    size_t        d_length;      // number of bytes supplied
+    int           d_numCalls;    // number of calls to 'operator()'
+
+  public:
+    // TYPES
+    typedef size_t result_type;
+
+    // CREATORS
+    RecordingAlgorithm()
+    : d_length(0)
+    , d_numCalls(0)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes)
+    {
+        ASSERT(d_length + numBytes <= sizeof d_bytes);
+        memcpy(d_bytes + d_length, data, numBytes);
+        d_length += numBytes;
+        ++d_numCalls;
+    }
+
+    result_type computeHash()
+    {
+        return d_length;
+    }
+
+    // ACCESSORS
+    const unsigned char *bytes() const
+    {
+        return d_bytes;
+    }
+
+    size_t length() const
+    {
+        return d_length;
+    }
+
+    int numCalls() const
+    {
+        return d_numCalls;
+    }
+
+    bool equals(const void *data, size_t numBytes) const
+        // Return 'true' if the bytes supplied to this algorithm are the
+        // specified 'numBytes' bytes at the specified 'data' address, and
+        // 'false' otherwise.
+    {
+        return numBytes == d_length && 0 == memcmp(d_bytes, data, numBytes);
+    }
+};
+
+template <class TYPE>
+bool suppliesRepresentation(TYPE value)
+    // Return 'true' if 'hashAppend' supplies exactly the object
+    // representation of the specified 'value', in a single call, and 'false'
+    // otherwise.
+{
+    RecordingAlgorithm algorithm;
+    bslh::hashAppend(algorithm, value);
+    return 1 == algorithm.numCalls() && algorithm.equals(&value, sizeof value);
+}
+
+enum Color { e_RED, e_GREEN = 7 };
+
+}  // close unnamed namespace
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Hashing a User-Defined Type
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a value-semantic type, 'Point', representing a point
+// in the plane, and that we want to use points as keys in a hash table:
+//..
+    class Point {
+        // This class represents a point in the plane.
+
+        // DATA
+        int d_x;  // x-coordinate
+        int d_y;  // y-coordinate
+
+        // FRIENDS
+        template <class HASH_ALGORITHM>
+        friend void hashAppend(HASH_ALGORITHM& algorithm, const Point& point);
+
+      public:
+        // CREATORS
+        Point(int x, int y)
+            // Create a point having the specified 'x' and 'y' coordinates.
+        : d_x(x)
+        , d_y(y)
+        {
+        }
+
+        // ACCESSORS
+        bool operator==(const Point& other) const
+            // Return 'true' if this point has the same value as the specified
+            // 'other' point, and 'false' otherwise.
+        {
+            return d_x == other.d_x && d_y == other.d_y;
+        }
+    };
+//..
+// Rather than writing a hash function for 'Point', we define a 'hashAppend'
+// function that supplies its salient attributes, its coordinates, to a
+// hashing algorithm:
+//..
+    template <class HASH_ALGORITHM>
+    void hashAppend(HASH_ALGORITHM& algorithm, const Point& point)
+        // Supply the salient attributes of the specified 'point' to the
+        // specified 'algorithm'.
+    {
+        using bslh::hashAppend;
+        hashAppend(algorithm, point.d_x);
+        hashAppend(algorithm, point.d_y);
+    }
+//..
+//
+///Example 2: Using a Different Hashing Algorithm
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need hash values of points computed by the well-known
+// FNV-1a hash function (e.g., to match values computed by another system).
+// We define a hashing algorithm implementing FNV-1a:
+//..
+    class Fnv1aAlgorithm {
+        // This mechanism class computes the 32-bit FNV-1a hash value of the
+        // bytes supplied to it.
+
+        // DATA
+        unsigned int d_state;  // hash value of the bytes supplied so far
+
+      public:
+        // TYPES
+        typedef unsigned int result_type;
+
+        // CREATORS
+        Fnv1aAlgorithm()
+            // Create an algorithm object that has been supplied no bytes.
+        : d_state(2166136261u)
+        {
+        }
+
+        // MANIPULATORS
+        void operator()(const void *data, size_t numBytes)
+            // Supply the specified 'numBytes' bytes at the specified 'data'
+            // address to this algorithm.
+        {
+            const unsigned char *bytes =
+                                    static_cast<const unsigned char *>(data);
+            for (size_t i = 0; i < numBytes; ++i) {
+                d_state = (d_state ^ bytes[i]) * 16777619u;
+            }
+        }
+
+        result_type computeHash()
+            // Return the hash value of the bytes supplied to this algorithm.
+        {
+            return d_state;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, 'bslh::Hash<>' can hash points, using the default hashing algorithm:
+//..
+    bslh::Hash<> hasher;
+
+    const Point A(1, 2);
+    const Point B(1, 2);
+    const Point C(2, 1);
+
+    ASSERT(hasher(A) == hasher(B));
+    ASSERT(hasher(A) != hasher(C));
+//..
+// Finally, we hash points using 'Fnv1aAlgorithm', without any change to
+// 'Point':
+//..
+    bslh::Hash<Fnv1aAlgorithm> fnvHasher;
+
+    ASSERT(fnvHasher(A) == fnvHasher(B));
+    ASSERT(fnvHasher(A) != fnvHasher(C));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS 'Hash'
+        //
+        // Concerns:
+        //: 1 'operator()' returns the result of 'computeHash' of an algorithm
+        //:   object to which the key has been supplied by 'hashAppend'.
+        //:
+        //: 2 'operator()' finds 'hashAppend' overloads for user-defined types
+        //:   by argument-dependent lookup.
+        //:
+        //: 3 The default algorithm is 'DefaultHashAlgorithm'.
+        //:
+        //: 4 'result_type' is 'size_t'.
+        //:
+        //: 5 'Hash' can be invoked through a 'const' object.
+        //:
+        //: 6 'Hash' is trivially default constructible and trivially
+        //:   copyable.
+        //
+        // Plan:
+        //: 1 Using 'RecordingAlgorithm', whose hash value is the number of
+        //:   bytes supplied, hash keys of several types and verify the result.
+        //:   (C-1..2, 5)
+        //:
+        //: 2 Compare the result of 'Hash<>' with that of a
+        //:   'DefaultHashAlgorithm' supplied the same bytes.  (C-1, 3)
+        //:
+        //: 3 Verify the 'result_type' typedef and the traits using
+        //:   'bsl::is_same' and the trait meta-functions.  (C-4, 6)
+        //
+        // Testing:
+        //   typedef size_t result_type;
+        //   result_type operator()(const TYPE& key) const;
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS 'Hash'"
+                            "\n============\n");
+
+        ASSERT((bsl::is_same<size_t, Obj::result_type>::value));
+        ASSERT((bsl::is_same<size_t,
+                             bslh::Hash<RecordingAlgorithm>::result_type>::
+                                                                      value));
+        ASSERT((bsl::is_same<bslh::Hash<bslh::DefaultHashAlgorithm>,
+                             Obj>::value));
+
+        ASSERT(bsl::is_trivially_copyable<Obj>::value);
+        ASSERT(bsl::is_trivially_default_constructible<Obj>::value);
+        ASSERT(bsl::is_trivially_copyable<
+                                     bslh::Hash<RecordingAlgorithm> >::value);
+
+        if (verbose) printf("\nUsing a recording algorithm.\n");
+        {
+            const bslh::Hash<RecordingAlgorithm> X = {};
+
+            ASSERT(sizeof(int)    == X(5));
+            ASSERT(sizeof(double) == X(5.0));
+            ASSERT(2 * sizeof(int) == X(Point(1, 2)));
+
+            const Point POINTS[] = { Point(1, 2), Point(3, 4), Point(5, 6) };
+            ASSERT(6 * sizeof(int) == X(POINTS));
+        }
+
+        if (verbose) printf("\nUsing the default algorithm.\n");
+        {
+            const Obj X = {};
+
+            const int VALUES[] = { 0, 1, -1, 42, 0x7fffffff };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int VALUE = VALUES[i];
+
+                bslh::DefaultHashAlgorithm algorithm;
+                algorithm(&VALUE, sizeof VALUE);
+
+                ASSERTV(VALUE, algorithm.computeHash() == X(VALUE));
+
+                for (int j = 0; j < NUM_VALUES; ++j) {
+                    ASSERTV(i, j, (i == j) == (X(VALUE) == X(VALUES[j])));
+                }
+            }
+
+            const Point P1(3, 4);
+
+            bslh::DefaultHashAlgorithm algorithm;
+            const int COORDINATES[] = { 3, 4 };
+            algorithm(COORDINATES, sizeof COORDINATES);
+
+            ASSERT(algorithm.computeHash() == X(P1));
+            ASSERT(X(P1) == X(Point(3, 4)));
+            ASSERT(X(P1) != X(Point(4, 3)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'hashAppend' FOR FUNDAMENTAL TYPES, POINTERS, AND ARRAYS
+        //
+        // Concerns:
+        //: 1 'hashAppend' for 'bool' and each character and integral type
+        //:   supplies exactly the object representation of its argument, in a
+        //:   single call.
+        //:
+        //: 2 Enumerators are hashed as integers.
+        //:
+        //: 3 'hashAppend' for 'float' and 'double' supplies the object
+        //:   representation of its argument, except that negative zero is
+        //:   supplied as positive zero.
+        //:
+        //: 4 'hashAppend' for 'long double' supplies the value converted to
+        //:   'double'.
+        //:
+        //: 5 'hashAppend' for a pointer supplies the bits of the pointer, and
+        //:   not the memory to which it refers; in particular a 'const char *'
+        //:   is not hashed as a string.
+        //:
+        //: 6 'hashAppend' for an array supplies each element in turn, and is
+        //:   selected in preference to the pointer overload.
+        //
+        // Plan:
+        //: 1 Using 'RecordingAlgorithm', verify the bytes supplied for several
+        //:   values of each type.  (C-1..6)
+        //
+        // Testing:
+        //   void hashAppend(HASH_ALGORITHM& algorithm, bool input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, char input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, signed char input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, unsigned char input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, wchar_t input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, short input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, unsigned short input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, int input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, unsigned int input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, long input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, unsigned long input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, long long input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, unsigned long long);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, float input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, double input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, long double input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, TYPE *const& input);
+        //   void hashAppend(HASH_ALGORITHM& algorithm, TYPE (&input)[N]);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'hashAppend' FOR FUNDAMENTAL TYPES, POINTERS, "
+                            "AND ARRAYS"
+                            "\n============================================="
+                            "==========\n");
+
+        if (verbose) printf("\nIntegral types.\n");
+        {
+            ASSERT(suppliesRepresentation(false));
+            ASSERT(suppliesRepresentation(true));
+            ASSERT(suppliesRepresentation('a'));
+            ASSERT(suppliesRepresentation(static_cast<signed char>(-5)));
+            ASSERT(suppliesRepresentation(static_cast<unsigned char>(200)));
+            ASSERT(suppliesRepresentation(L'w'));
+            ASSERT(suppliesRepresentation(static_cast<short>(-12345)));
+            ASSERT(suppliesRepresentation(
+                                      static_cast<unsigned short>(54321)));
+            ASSERT(suppliesRepresentation(-123456789));
+            ASSERT(suppliesRepresentation(3000000000u));
+            ASSERT(suppliesRepresentation(-1234567890L));
+            ASSERT(suppliesRepresentation(4000000000UL));
+            ASSERT(suppliesRepresentation(-1234567890123LL));
+            ASSERT(suppliesRepresentation(18000000000000000000ULL));
+        }
+
+        if (verbose) printf("\nEnumerations.\n");
+        {
+            RecordingAlgorithm algorithm;
+            bslh::hashAppend(algorithm, e_GREEN);
+
+            const int EXP = 7;
+            ASSERT(algorithm.equals(&EXP, sizeof EXP));
+        }
+
+        if (verbose) printf("\nFloating-point types.\n");
+        {
+            ASSERT(suppliesRepresentation(1.5f));
+            ASSERT(suppliesRepresentation(-1.5f));
+            ASSERT(suppliesRepresentation(0.0f));
+            ASSERT(suppliesRepresentation(3.25));
+            ASSERT(suppliesRepresentation(-3.25));
+            ASSERT(suppliesRepresentation(0.0));
+
+            const float  POS_ZERO_F = 0.0f;
+            const double POS_ZERO_D = 0.0;
+
+            RecordingAlgorithm mF;
+            bslh::hashAppend(mF, -0.0f);
+            ASSERT(mF.equals(&POS_ZERO_F, sizeof POS_ZERO_F));
+
+            RecordingAlgorithm mD;
+            bslh::hashAppend(mD, -0.0);
+            ASSERT(mD.equals(&POS_ZERO_D, sizeof POS_ZERO_D));
+
+            const double VALUE = 2.5;
+
+            RecordingAlgorithm mL;
+            bslh::hashAppend(mL, 2.5L);
+            ASSERT(mL.equals(&VALUE, sizeof VALUE));
+
+            RecordingAlgorithm mN;
+            bslh::hashAppend(mN, -0.0L);
+            ASSERT(mN.equals(&POS_ZERO_D, sizeof POS_ZERO_D));
+        }
+
+        if (verbose) printf("\nPointers.\n");
+        {
+            int         i = 0;
+            int        *p = &i;
+            const char *s = "abc";
+            void       *n = 0;
+
+            ASSERT(suppliesRepresentation(p));
+            ASSERT(suppliesRepresentation(s));
+            ASSERT(suppliesRepresentation(n));
+
+            RecordingAlgorithm algorithm;
+            bslh::hashAppend(algorithm, s);
+            ASSERT(sizeof s == algorithm.length());
+        }
+
+        if (verbose) printf("\nArrays.\n");
+        {
+            const short ARRAY[] = { 1, -2, 3 };
+
+            RecordingAlgorithm algorithm;
+            bslh::hashAppend(algorithm, ARRAY);
+
+            ASSERT(3 == algorithm.numCalls());
+            ASSERT(algorithm.equals(ARRAY, sizeof ARRAY));
+
+            int matrix[2][2] = { { 1, 2 }, { 3, 4 } };
+
+            RecordingAlgorithm mM;
+            bslh::hashAppend(mM, matrix);
+            ASSERT(4 == mM.numCalls());
+            ASSERT(mM.equals(matrix, sizeof matrix));
+
+            RecordingAlgorithm mS;
+            bslh::hashAppend(mS, "ab");
+            ASSERT(mS.equals("ab", 3));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Hash a few values of fundamental type and verify that equal
+        //:   values have equal hash values, and that different values have
+        //:   different hash values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const Obj X = {};
+
+        ASSERT(X(1) == X(1));
+        ASSERT(X(1) != X(2));
+        ASSERT(X(1.0) == X(1.0));
+        ASSERT(X(0.0) == X(-0.0));
+        ASSERT(X(true) != X(false));
+
+        const int A[] = { 1, 2 };
+        const int B[] = { 1, 2 };
+        const int C[] = { 2, 1 };
+        ASSERT(X(A) == X(B));
+        ASSERT(X(A) != X(C));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
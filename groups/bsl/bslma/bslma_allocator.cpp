@@ -27,6 +27,12 @@ Allocator::~Allocator()
 {
 }
 
+// MANIPULATORS
+void Allocator::sizedDeallocate(void *address, size_type)
+{
+    deallocate(address);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -119,6 +119,18 @@ BSLS_IDENT("$Id: $")
 // is known that the 'address' does *not* refer to a secondary base class of
 // the object being deleted.
 //
+///Sized Deallocation
+///------------------
+// Clients that know the size of a block they are deallocating (such as
+// containers, which track their capacity) may call 'sizedDeallocate', passing
+// the same size that was supplied to 'allocate', instead of 'deallocate'.  By
+// default, 'sizedDeallocate' simply ignores the size and forwards to
+// 'deallocate', so that concrete allocators need not implement it.  However,
+// an allocator that organizes its memory by size class can override
+// 'sizedDeallocate' to locate the size class of the block directly from the
+// size, rather than from per-block bookkeeping.  Note that 'bsl::allocator'
+// calls 'sizedDeallocate' from its 'deallocate' method.
+//
 ///Usage
 ///-----
 // The 'bslma::Allocator' protocol provided in this component defines a
@@ -445,6 +457,17 @@ class Allocator {
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    virtual void sizedDeallocate(void *address, size_type size);
+        // Return the memory block at the specified 'address', which was
+        // obtained from a call to 'allocate' with the specified 'size' (in
+        // bytes), back to this allocator.  If 'address' is 0, this function
+        // has no effect.  The behavior is undefined unless 'address' was
+        // allocated using this allocator object with a request of 'size'
+        // bytes, and has not already been deallocated.  Note that the default
+        // implementation ignores 'size' and calls 'deallocate(address)';
+        // derived classes that can use 'size' to locate the block more
+        // efficiently may override this method.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -29,6 +29,7 @@ using namespace BloombergLP;
 // [ 1] virtual ~bslma::Allocator();
 // [ 1] virtual void *allocate(size_type size) = 0;
 // [ 1] virtual void deallocate(void *address) = 0;
+// [ 1] virtual void sizedDeallocate(void *address, size_type size);
 // [ 2] template<typename TYPE> deleteObject(const TYPE *);
 // [ 3] template<typename TYPE> deleteObjectRaw(const TYPE *);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
@@ -885,12 +886,15 @@ int main(int argc, char *argv[])
         //   Up-cast a reference to the object to the base class
         //   'bslma::Allocator'.  Using the base class reference invoke both
         //   'allocate' and 'deallocate' methods.  Verify that the correct
-        //   implementations of the methods are called.
+        //   implementations of the methods are called.  Finally, invoke
+        //   'sizedDeallocate', which is not overridden, and verify that it
+        //   forwards to 'deallocate'.
         //
         // Testing:
         //   virtual ~bslma::Allocator();
         //   virtual void *allocate(size_type size) = 0;
         //   virtual void deallocate(void *address) = 0;
+        //   virtual void sizedDeallocate(void *address, size_type size);
         // --------------------------------------------------------------------
 
         if (verbose) printf("\nPROTOCOL TEST"
@@ -904,6 +908,13 @@ int main(int argc, char *argv[])
             a.deallocate(&myA);                 ASSERT(2 == myA.fun());
         }
 
+        if (verbose) printf("\nTesting default 'sizedDeallocate'\n");
+        {
+            ASSERT(&myA == a.allocate(100));    ASSERT(1 == myA.fun());
+            a.sizedDeallocate(&myA, 100);       ASSERT(2 == myA.fun());
+            ASSERT(2 == myA.deallocateCount());
+        }
+
       } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
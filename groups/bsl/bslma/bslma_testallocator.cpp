@@ -490,7 +490,7 @@ TestAllocator::~TestAllocator()
 // MANIPULATORS
 void *TestAllocator::allocate(size_type size)
 {
-    bsls::BslLockGuard guard(&d_lock);
+    bsls::SpinParkLockGuard guard(&d_lock);
 
     bsls::Types::Int64 allocationIndex = d_numAllocations.addRelaxed(1) - 1;
 
@@ -591,7 +591,7 @@ void *TestAllocator::allocate(size_type size)
 
 void TestAllocator::deallocate(void *address)
 {
-    bsls::BslLockGuard guard(&d_lock);
+    bsls::SpinParkLockGuard guard(&d_lock);
 
     d_numDeallocations.addRelaxed(1);
     d_lastDeallocatedAddress_p.storeRelaxed(reinterpret_cast<int *>(address));
@@ -746,7 +746,7 @@ void TestAllocator::deallocate(void *address)
 // ACCESSORS
 void TestAllocator::print() const
 {
-    bsls::BslLockGuard guard(&d_lock);
+    bsls::SpinParkLockGuard guard(&d_lock);
 
     if (d_name_p) {
         std::printf("\n"
@@ -786,7 +786,7 @@ int TestAllocator::status() const
 {
     enum { BSLMA_MEMORY_LEAK = -1, BSLMA_SUCCESS = 0 };
 
-    bsls::BslLockGuard guard(&d_lock);
+    bsls::SpinParkLockGuard guard(&d_lock);
 
     const bsls::Types::Int64 numErrors = numMismatches() + numBoundsErrors();
 
@@ -296,8 +296,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #endif
 
-#ifndef INCLUDED_BSLS_BSLLOCK
-#include <bsls_bsllock.h>
+#ifndef INCLUDED_BSLS_SPINPARKLOCK
+#include <bsls_spinparklock.h>
 #endif
 
 #ifndef INCLUDED_BSLS_TYPES
@@ -430,7 +430,7 @@ class TestAllocator : public Allocator {
     TestAllocator_List
                *d_list_p;                // list of allocated memory (owned)
 
-    mutable bsls::BslLock
+    mutable bsls::SpinParkLock
                 d_lock;                  // ensure mutual exclusion in
                                          // 'allocate', 'deallocate', 'print',
                                          // and 'status'
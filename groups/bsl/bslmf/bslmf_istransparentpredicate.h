@@ -0,0 +1,186 @@
+// bslmf_istransparentpredicate.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#define INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a meta-function detecting transparent predicates.
+//
+//@CLASSES:
+//  bslmf::IsTransparentPredicate: detects a nested 'is_transparent' type
+//
+//@SEE_ALSO: bslmf_enableif, bslstl_map, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a meta-function,
+// 'bslmf::IsTransparentPredicate', that may be used to query whether a
+// comparator, equality predicate, or hash functor is *transparent*; that is,
+// whether it declares a nested type named 'is_transparent'.  By the
+// convention of the C++14 standard [associative.reqmts], such a functor
+// accepts arguments of types other than the key type of a container, so that
+// the container may offer lookup methods taking any type that the functor
+// accepts, without first converting the argument to the key type.
+//
+// 'bslmf::IsTransparentPredicate' takes a second template parameter, 'KEY',
+// that does not affect its value.  The lookup methods of a container are
+// templates on the type of their argument, and, since 'SFINAE' applies only
+// to expressions depending on the template parameters of the function
+// template itself, supplying that type as 'KEY' is what allows the
+// meta-function to remove such a method from the overload set when the
+// functor is not transparent.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Offering a Lookup Method for Any Type
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a container of employee records ordered by their
+// identifiers, and we want its 'contains' method to accept a bare identifier,
+// if the comparator of the container is transparent, so that no record needs
+// to be created for a lookup.
+//
+// First, we define the record type, and two comparators for it, only the
+// second of which is transparent:
+//..
+//  struct Employee {
+//      int         d_id;
+//      const char *d_name;
+//  };
+//
+//  struct EmployeeLess {
+//      // This 'struct' compares 'Employee' objects by identifier.
+//
+//      bool operator()(const Employee& lhs, const Employee& rhs) const
+//      {
+//          return lhs.d_id < rhs.d_id;
+//      }
+//  };
+//
+//  struct TransparentEmployeeLess {
+//      // This 'struct' compares 'Employee' objects and identifiers in any
+//      // combination.
+//
+//      typedef void is_transparent;
+//
+//      bool operator()(const Employee& lhs, const Employee& rhs) const
+//      {
+//          return lhs.d_id < rhs.d_id;
+//      }
+//
+//      bool operator()(const Employee& lhs, int rhs) const
+//      {
+//          return lhs.d_id < rhs;
+//      }
+//
+//      bool operator()(int lhs, const Employee& rhs) const
+//      {
+//          return lhs < rhs.d_id;
+//      }
+//  };
+//..
+// Then, we verify that the meta-function detects the transparent one:
+//..
+//  assert(false ==
+//               (bslmf::IsTransparentPredicate<EmployeeLess, int>::value));
+//  assert(true  ==
+//    (bslmf::IsTransparentPredicate<TransparentEmployeeLess, int>::value));
+//..
+// Finally, we sketch how a container would declare its lookup methods: the
+// non-template method is always available, and the method template exists
+// only if the comparator is transparent:
+//..
+//  template <class KEY, class COMPARATOR>
+//  class SortedKeys {
+//      // ...
+//
+//    public:
+//      bool contains(const KEY& key) const;
+//
+//      template <class LOOKUP_KEY>
+//      typename bsl::enable_if<
+//          bslmf::IsTransparentPredicate<COMPARATOR, LOOKUP_KEY>::value,
+//          bool>::type
+//      contains(const LOOKUP_KEY& key) const;
+//  };
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmf {
+
+                     // ================================
+                     // struct IsTransparentPredicate_Imp
+                     // ================================
+
+template <class TYPE>
+struct IsTransparentPredicate_Imp {
+    // This 'struct' template provides a meta-function to determine whether
+    // the (template parameter) 'TYPE' declares a nested type named
+    // 'is_transparent'.
+
+    typedef struct { char a; }    YesType;
+    typedef struct { char a[2]; } NoType;
+
+    template <class TEST_TYPE>
+    static
+    YesType test(typename TEST_TYPE::is_transparent *);
+
+    template <class TEST_TYPE>
+    static
+    NoType test(...);
+
+    enum { Value = (sizeof(test<TYPE>(0)) == sizeof(YesType)) };
+};
+
+                       // =============================
+                       // struct IsTransparentPredicate
+                       // =============================
+
+template <class COMPARATOR, class KEY>
+struct IsTransparentPredicate
+    : bsl::integral_constant<bool,
+                             IsTransparentPredicate_Imp<COMPARATOR>::Value> {
+    // This meta-function derives from 'bsl::true_type' if the (template
+    // parameter) 'COMPARATOR' declares a nested type named 'is_transparent',
+    // and from 'bsl::false_type' otherwise.  The (template parameter) 'KEY'
+    // does not affect the result; it is supplied by function templates taking
+    // an argument of type 'KEY', so that the meta-function depends on their
+    // template parameters.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
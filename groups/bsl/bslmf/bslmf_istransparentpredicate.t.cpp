@@ -0,0 +1,388 @@
+// bslmf_istransparentpredicate.t.cpp                                 -*-C++-*-
+#include <bslmf_istransparentpredicate.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>   // 'printf'
+#include <stdlib.h>  // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test defines a meta-function,
+// 'bslmf::IsTransparentPredicate', that determines whether a type declares a
+// nested type named 'is_transparent'.  We verify the value of the
+// meta-function for class types that declare such a type in each possible
+// way, for class types that do not, and for non-class types, and verify that
+// the meta-function can remove a function template from an overload set.
+//
+//-----------------------------------------------------------------------------
+// [ 2] bslmf::IsTransparentPredicate::value
+// [ 2] bslmf::IsTransparentPredicate::type
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: Method templates can be removed from overload sets.
+// [ 4] USAGE EXAMPLE
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Opaque {
+    // This 'struct' declares no nested types.
+};
+
+struct TransparentVoid {
+    // This 'struct' declares 'is_transparent' as an alias for 'void'.
+
+    typedef void is_transparent;
+};
+
+struct TransparentInt {
+    // This 'struct' declares 'is_transparent' as an alias for 'int'.
+
+    typedef int is_transparent;
+};
+
+struct TransparentClass {
+    // This 'struct' declares 'is_transparent' as a nested class.
+
+    struct is_transparent {};
+};
+
+struct DerivedTransparent : TransparentVoid {
+    // This 'struct' inherits 'is_transparent' from its base class.
+};
+
+struct Incomplete;
+    // A forward declaration for the type that shall remain incomplete for this
+    // whole translation unit.
+
+template <class COMPARATOR>
+struct Lookup {
+    // This 'struct' provides a non-template 'find' method, and a 'find'
+    // method template that exists only if the (template parameter)
+    // 'COMPARATOR' is transparent.
+
+    static int find(int)
+        // Return 1.
+    {
+        return 1;
+    }
+
+    template <class LOOKUP_KEY>
+    static typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<COMPARATOR, LOOKUP_KEY>::value,
+        int>::type
+    find(const LOOKUP_KEY&)
+        // Return 2.
+    {
+        return 2;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Offering a Lookup Method for Any Type
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a container of employee records ordered by their
+// identifiers, and we want its 'contains' method to accept a bare identifier,
+// if the comparator of the container is transparent, so that no record needs
+// to be created for a lookup.
+//
+// First, we define the record type, and two comparators for it, only the
+// second of which is transparent:
+//..
+    struct Employee {
+        int         d_id;
+        const char *d_name;
+    };
+
+    struct EmployeeLess {
+        // This 'struct' compares 'Employee' objects by identifier.
+
+        bool operator()(const Employee& lhs, const Employee& rhs) const
+        {
+            return lhs.d_id < rhs.d_id;
+        }
+    };
+
+    struct TransparentEmployeeLess {
+        // This 'struct' compares 'Employee' objects and identifiers in any
+        // combination.
+
+        typedef void is_transparent;
+
+        bool operator()(const Employee& lhs, const Employee& rhs) const
+        {
+            return lhs.d_id < rhs.d_id;
+        }
+
+        bool operator()(const Employee& lhs, int rhs) const
+        {
+            return lhs.d_id < rhs;
+        }
+
+        bool operator()(int lhs, const Employee& rhs) const
+        {
+            return lhs < rhs.d_id;
+        }
+    };
+//..
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE\n"
+                            "\n=============\n");
+
+// Then, we verify that the meta-function detects the transparent one:
+//..
+    ASSERT(false ==
+                 (bslmf::IsTransparentPredicate<EmployeeLess, int>::value));
+    ASSERT(true  ==
+      (bslmf::IsTransparentPredicate<TransparentEmployeeLess, int>::value));
+//..
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // OVERLOAD SELECTION
+        //
+        // Concerns:
+        //: 1 A method template whose return type is guarded by the
+        //:   meta-function is removed from the overload set if the
+        //:   comparator is not transparent, so that the argument is converted
+        //:   for the non-template method.
+        //:
+        //: 2 If the comparator is transparent, the method template is chosen
+        //:   for arguments of other types than that of the non-template
+        //:   method, and the non-template method for arguments of its type.
+        //
+        // Plan:
+        //: 1 Call the 'find' methods of 'Lookup' instantiated for a
+        //:   transparent and an opaque comparator with arguments of the
+        //:   parameter type of the non-template method, and of another type,
+        //:   and verify which method is called.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Method templates can be removed from overload sets.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nOVERLOAD SELECTION\n"
+                            "\n==================\n");
+
+        ASSERT(1 == Lookup<Opaque>::find(5));
+        ASSERT(1 == Lookup<Opaque>::find('a'));
+        ASSERT(1 == Lookup<Opaque>::find(5.0));
+
+        ASSERT(1 == Lookup<TransparentVoid>::find(5));
+        ASSERT(2 == Lookup<TransparentVoid>::find('a'));
+        ASSERT(2 == Lookup<TransparentVoid>::find(5.0));
+        ASSERT(2 == Lookup<TransparentVoid>::find("five"));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'bslmf::IsTransparentPredicate::value'
+        //
+        // Concerns:
+        //: 1 The meta-function returns 'true' for a class type declaring a
+        //:   nested type named 'is_transparent', whatever that type is, and
+        //:   also if the type is inherited.
+        //:
+        //: 2 The meta-function returns 'false' for a class type not declaring
+        //:   such a type, and for non-class types.
+        //:
+        //: 3 The result does not depend on the 'KEY' parameter, or on the
+        //:   cv-qualification of the comparator.
+        //:
+        //: 4 The meta-function derives from 'bsl::true_type' or
+        //:   'bsl::false_type'.
+        //
+        // Plan:
+        //: 1 Verify the value of the meta-function for a set of types
+        //:   covering each concern.  (C-1..3)
+        //:
+        //: 2 Verify the type of the nested 'type' alias.  (C-4)
+        //
+        // Testing:
+        //   bslmf::IsTransparentPredicate::value
+        //   bslmf::IsTransparentPredicate::type
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslmf::IsTransparentPredicate::value'\n"
+                            "\n======================================\n");
+
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentVoid,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentInt,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentClass,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<DerivedTransparent,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<const TransparentVoid,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentVoid,
+                                               Incomplete>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<TransparentVoid,
+                                               const char *>::value));
+
+        ASSERT(!(bslmf::IsTransparentPredicate<Opaque, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<const Opaque, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<Opaque, Incomplete>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<int, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<int *, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<void, int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<bool (*)(int, int),
+                                               int>::value));
+
+        typedef bslmf::IsTransparentPredicate<TransparentVoid, int> Yes;
+        typedef bslmf::IsTransparentPredicate<Opaque, int>          No;
+
+        ASSERT((bsl::is_same<bsl::true_type,  Yes::type>::value));
+        ASSERT((bsl::is_same<bsl::false_type, No::type>::value));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Verify the value of the meta-function for one transparent and
+        //:   one opaque type.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST\n"
+                            "\n==============\n");
+
+        const bool transparent =
+                   bslmf::IsTransparentPredicate<TransparentVoid, int>::value;
+        const bool opaque =
+                   bslmf::IsTransparentPredicate<Opaque, int>::value;
+
+        if (veryVerbose) {
+            P_(transparent) P(opaque)
+        }
+
+        ASSERT( transparent);
+        ASSERT(!opaque);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,18 +12,25 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bsls::AtomicInt: atomic 32-bit integer type
 //  bsls::AtomicInt64: atomic 64-bit integer types
+//  bsls::AtomicUint: atomic 32-bit unsigned integer type
+//  bsls::AtomicUint64: atomic 64-bit unsigned integer type
+//  bsls::AtomicBool: atomic boolean type
 //  bsls::AtomicPointer: parameterized atomic pointer type
 //
 //@SEE_ALSO: bsls_atomicoperations
 //
 //@DESCRIPTION: This component provides classes with atomic operations for
-// 'int', 'Int64', and pointer types.  These classes are based on atomic
-// operations supplied by the 'bsls_atomicoperations' component.  The
-// 'bsls::AtomicInt' and 'bsls::AtomicInt64' classes represent the
-// corresponding atomic integer types, and provide overloaded operators and
-// functions for common arithmetic operations.  The 'bsls::AtomicPointer' class
-// represents the atomic pointer type, and provides atomic operations to
-// manipulate and dereference a pointer.
+// 'int', 'Int64', 'unsigned int', 'Uint64', 'bool', and pointer types.  These
+// classes are based on atomic operations supplied by the
+// 'bsls_atomicoperations' component.  The 'bsls::AtomicInt',
+// 'bsls::AtomicInt64', 'bsls::AtomicUint', and 'bsls::AtomicUint64' classes
+// represent the corresponding atomic integer types, and provide overloaded
+// operators and functions for common arithmetic and bitwise operations (the
+// arithmetic on the unsigned types wraps modulo 2 to the power of the number
+// of bits in the type).  The 'bsls::AtomicBool' class represents the atomic
+// boolean type, and is suitable for flags shared between threads.  The
+// 'bsls::AtomicPointer' class represents the atomic pointer type, and provides
+// atomic operations to manipulate and dereference a pointer.
 //
 ///Memory Order and Consistency Guarantees of Atomic Operations
 ///------------------------------------------------------------
@@ -783,6 +790,33 @@ class AtomicInt {
         // atomically and it provides the acquire/release memory ordering
         // guarantee.
 
+    int fetchAnd(int value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value.
+
+    int fetchAndAcqRel(int value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    int fetchOr(int value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value.
+
+    int fetchOrAcqRel(int value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    int fetchXor(int value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value.
+
+    int fetchXorAcqRel(int value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
     // ACCESSORS
     operator int() const;
         // Return the current value of this object.
@@ -910,6 +944,33 @@ class AtomicInt64 {
         // atomically and it provides the acquire/release memory ordering
         // guarantee.
 
+    Types::Int64 fetchAnd(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Int64 fetchAndAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Int64 fetchOr(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Int64 fetchOrAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Int64 fetchXor(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Int64 fetchXorAcqRel(Types::Int64 value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
     // ACCESSORS
     operator Types::Int64() const;
         // Return the current value of this object.
@@ -926,6 +987,405 @@ class AtomicInt64 {
         // memory ordering guarantee.
 };
 
+                              // ================
+                              // class AtomicUint
+                              // ================
+
+class AtomicUint {
+    // This class implements an atomic unsigned integer, which supports common
+    // integer operations in a way that is guaranteed to be atomic.  Operations
+    // on objects of this class provide the sequential consistency memory
+    // ordering guarantee unless explicitly qualified with a less strict
+    // consistency guarantee suffix (i.e., Acquire, Release, AcqRel or
+    // Relaxed).
+
+    // DATA
+    AtomicOperations::AtomicTypes::Uint d_value;
+
+  private:
+    // NOT IMPLEMENTED
+    AtomicUint(const AtomicUint&);               // = delete
+    AtomicUint& operator=(const AtomicUint& );   // = delete
+        // Note that the copy constructor and the copy-assignment operator
+        // are not implemented because they cannot be done atomically.
+
+  public:
+    // CREATORS
+    AtomicUint();
+        // Create an atomic unsigned integer object having the default value 0.
+
+    AtomicUint(unsigned int value);
+        // Create an atomic unsigned integer object having the specified
+        // 'value'.
+
+    //! ~AtomicUint() = default;
+        // Destroy this atomic unsigned integer object.
+
+    // MANIPULATORS
+    AtomicUint& operator=(unsigned int value);
+        // Atomically assign the specified 'value' to this object, and return a
+        // modifiable reference to 'this' object.
+
+    unsigned int operator+=(unsigned int value);
+        // Atomically add the specified 'value' to this object, and return the
+        // resulting value.
+
+    unsigned int operator-=(unsigned int value);
+        // Atomically subtract the specified 'value' from this object, and
+        // return the resulting value.
+
+    unsigned int operator++();
+        // Atomically increment the value of this object by 1 and return the
+        // resulting value.
+
+    unsigned int operator++(int);
+        // Atomically increment the value of this object by 1 and return the
+        // value prior to being incremented.
+
+    unsigned int operator--();
+        // Atomically decrement the value of this object by 1 and return the
+        // resulting value.
+
+    unsigned int operator--(int);
+        // Atomically decrement the value of this object by 1 and return the
+        // value prior to being decremented.
+
+    unsigned int add(unsigned int value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value.
+
+    unsigned int addRelaxed(unsigned int value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value, providing the relaxed memory ordering guarantee.
+
+    unsigned int addAcqRel(unsigned int value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    void storeRelaxed(unsigned int value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the relaxed memory ordering guarantee.
+
+    void storeRelease(unsigned int value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the release memory ordering guarantee.
+
+    unsigned int swap(unsigned int swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value.
+
+    unsigned int swapAcqRel(unsigned int swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value, providing the acquire/release memory
+        // ordering guarantee.
+
+    unsigned int testAndSwap(unsigned int compareValue,
+                             unsigned int swapValue);
+        // Compare the value of this object to the specified 'compareValue'. If
+        // they are equal, set the value of this atomic unsigned integer to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic unsigned integer, whether or not
+        // the swap occurred.  Note that the entire test-and-swap operation is
+        // performed atomically.
+
+    unsigned int testAndSwapAcqRel(unsigned int compareValue,
+                                   unsigned int swapValue);
+        // Compare the value of this object to the specified 'compareValue'. If
+        // they are equal, set the value of this atomic unsigned integer to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic unsigned integer, whether or not
+        // the swap occurred.  Note that the entire test-and-swap operation is
+        // performed atomically and it provides the acquire/release memory
+        // ordering guarantee.
+
+    unsigned int fetchAnd(unsigned int value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value.
+
+    unsigned int fetchAndAcqRel(unsigned int value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    unsigned int fetchOr(unsigned int value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value.
+
+    unsigned int fetchOrAcqRel(unsigned int value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    unsigned int fetchXor(unsigned int value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value.
+
+    unsigned int fetchXorAcqRel(unsigned int value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    // ACCESSORS
+    operator unsigned int() const;
+        // Return the current value of this object.
+
+    unsigned int load() const;
+        // Return the current value of this object.
+
+    unsigned int loadRelaxed() const;
+        // Return the current value of this object, providing the relaxed
+        // memory ordering guarantee.
+
+    unsigned int loadAcquire() const;
+        // Return the current value of this object, providing the acquire
+        // memory ordering guarantee.
+};
+
+                             // ==================
+                             // class AtomicUint64
+                             // ==================
+
+class AtomicUint64 {
+    // This class is implements an atomic 64-bit unsigned integer, which
+    // supports common integer operations in a way that is guaranteed to be
+    // atomic.  Operations on objects of this class provide the sequential
+    // consistency memory ordering guarantee unless explicitly qualified with a
+    // less strict consistency guarantee suffix (i.e., Acquire, Release, AcqRel
+    // or Relaxed).
+
+    // DATA
+    AtomicOperations::AtomicTypes::Uint64 d_value;
+
+  private:
+    // NOT IMPLEMENTED
+    AtomicUint64(const AtomicUint64&);              // = delete
+    AtomicUint64& operator=(const AtomicUint64&);   // = delete
+        // Note that the copy constructor and the copy-assignment operator
+        // are not implemented because they cannot be done atomically.
+
+  public:
+    // CREATORS
+    AtomicUint64();
+        // Create an atomic 64-bit unsigned integer object having the default
+        // value 0.
+
+    AtomicUint64(Types::Uint64 value);
+        // Create an atomic 64-bit unsigned integer object having the specified
+        // 'value'.
+
+    //! ~AtomicUint64() = default;
+        // Destroy this atomic 64-bit unsigned integer object.
+
+    // MANIPULATORS
+    AtomicUint64& operator=(Types::Uint64 value);
+        // Atomically assign the specified 'value' to this object, and return a
+        // modifiable reference to 'this' object.
+
+    Types::Uint64 operator+=(Types::Uint64 value);
+        // Atomically add the specified 'value' to this object, and return the
+        // resulting value.
+
+    Types::Uint64 operator-=(Types::Uint64 value);
+        // Atomically subtract the specified 'value' from this object, and
+        // return the resulting value.
+
+    Types::Uint64 operator++();
+        // Atomically increment the value of this object by 1 and return the
+        // resulting value.
+
+    Types::Uint64 operator++(int);
+        // Atomically increment the value of this object by 1 and return the
+        // value prior to being incremented.
+
+    Types::Uint64 operator--();
+        // Atomically decrement the value of this object by 1 and return the
+        // resulting value.
+
+    Types::Uint64 operator--(int);
+        // Atomically decrement the value of this object by 1 and return the
+        // value prior to being decremented.
+
+    Types::Uint64 add(Types::Uint64 value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value.
+
+    Types::Uint64 addRelaxed(Types::Uint64 value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value, providing the relaxed memory ordering guarantee.
+
+    Types::Uint64 addAcqRel(Types::Uint64 value);
+        // Atomically add the specified 'value' to this object and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    void storeRelaxed(Types::Uint64 value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the relaxed memory ordering guarantee.
+
+    void storeRelease(Types::Uint64 value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the release memory ordering guarantee.
+
+    Types::Uint64 swap(Types::Uint64 swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value.
+
+    Types::Uint64 swapAcqRel(Types::Uint64 swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value, providing the acquire/release memory
+        // ordering guarantee.
+
+    Types::Uint64 testAndSwap(Types::Uint64 compareValue,
+                             Types::Uint64 swapValue);
+        // Compare the value of this object to the specified 'compareValue'. If
+        // they are equal, set the value of this atomic unsigned integer to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic unsigned integer, whether or not
+        // the swap occurred.  Note that the entire test-and-swap operation is
+        // performed atomically.
+
+    Types::Uint64 testAndSwapAcqRel(Types::Uint64 compareValue,
+                                   Types::Uint64 swapValue);
+        // Compare the value of this object to the specified 'compareValue'. If
+        // they are equal, set the value of this atomic unsigned integer to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic unsigned integer, whether or not
+        // the swap occurred.  Note that the entire test-and-swap operation is
+        // performed atomically and it provides the acquire/release memory
+        // ordering guarantee.
+
+    Types::Uint64 fetchAnd(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Uint64 fetchAndAcqRel(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Uint64 fetchOr(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Uint64 fetchOrAcqRel(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Uint64 fetchXor(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value.
+
+    Types::Uint64 fetchXorAcqRel(Types::Uint64 value);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'value', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    // ACCESSORS
+    operator Types::Uint64() const;
+        // Return the current value of this object.
+
+    Types::Uint64 load() const;
+        // Return the current value of this object.
+
+    Types::Uint64 loadRelaxed() const;
+        // Return the current value of this object, providing the relaxed
+        // memory ordering guarantee.
+
+    Types::Uint64 loadAcquire() const;
+        // Return the current value of this object, providing the acquire
+        // memory ordering guarantee.
+};
+
+                              // ================
+                              // class AtomicBool
+                              // ================
+
+class AtomicBool {
+    // This class implements an atomic boolean, which supports common boolean
+    // operations in a way that is guaranteed to be atomic.  Operations on
+    // objects of this class provide the sequential consistency memory ordering
+    // guarantee unless explicitly qualified with a less strict consistency
+    // guarantee suffix (i.e., Acquire, Release, AcqRel or Relaxed).
+
+    // DATA
+    AtomicOperations::AtomicTypes::Int d_value;  // 0 for 'false', 1 for
+                                                 // 'true'
+
+  private:
+    // NOT IMPLEMENTED
+    AtomicBool(const AtomicBool&);              // = delete
+    AtomicBool& operator=(const AtomicBool&);   // = delete
+        // Note that the copy constructor and the copy-assignment operator
+        // are not implemented because they cannot be done atomically.
+
+  public:
+    // CREATORS
+    AtomicBool();
+        // Create an atomic boolean object having the default value 'false'.
+
+    AtomicBool(bool value);
+        // Create an atomic boolean object having the specified 'value'.
+
+    //! ~AtomicBool() = default;
+        // Destroy this atomic boolean object.
+
+    // MANIPULATORS
+    AtomicBool& operator=(bool value);
+        // Atomically assign the specified 'value' to this object, and return a
+        // modifiable reference to 'this' object.
+
+    void storeRelaxed(bool value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the relaxed memory ordering guarantee.
+
+    void storeRelease(bool value);
+        // Atomically assign the specified 'value' to this object, providing
+        // the release memory ordering guarantee.
+
+    bool swap(bool swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value.
+
+    bool swapAcqRel(bool swapValue);
+        // Atomically set the value of this object to the specified 'swapValue'
+        // and return its previous value, providing the acquire/release memory
+        // ordering guarantee.
+
+    bool testAndSwap(bool compareValue, bool swapValue);
+        // Compare the value of this object to the specified 'compareValue'.
+        // If they are equal, set the value of this atomic boolean to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic boolean, whether or not the swap
+        // occurred.  Note that the entire test-and-swap operation is performed
+        // atomically.
+
+    bool testAndSwapAcqRel(bool compareValue, bool swapValue);
+        // Compare the value of this object to the specified 'compareValue'.
+        // If they are equal, set the value of this atomic boolean to the
+        // specified 'swapValue', otherwise leave this value unchanged.  Return
+        // the previous value of this atomic boolean, whether or not the swap
+        // occurred.  Note that the entire test-and-swap operation is performed
+        // atomically and it provides the acquire/release memory ordering
+        // guarantee.
+
+    // ACCESSORS
+    operator bool() const;
+        // Return the current value of this object.
+
+    bool load() const;
+        // Return the current value of this object.
+
+    bool loadRelaxed() const;
+        // Return the current value of this object, providing the relaxed
+        // memory ordering guarantee.
+
+    bool loadAcquire() const;
+        // Return the current value of this object, providing the acquire
+        // memory ordering guarantee.
+};
+
                              // ===================
                              // class AtomicPointer
                              // ===================
@@ -1166,45 +1626,81 @@ int AtomicInt::testAndSwapAcqRel(int compareValue, int swapValue)
                                                       swapValue);
 }
 
-// ACCESSORS
-
 inline
-AtomicInt::operator int() const
+int AtomicInt::fetchAnd(int value)
 {
-    return AtomicOperations_Imp::getInt(&d_value);
+    return AtomicOperations_Imp::fetchAndInt(&d_value, value);
 }
 
 inline
-int AtomicInt::load() const
+int AtomicInt::fetchAndAcqRel(int value)
 {
-    return this->operator int();
+    return AtomicOperations_Imp::fetchAndIntAcqRel(&d_value, value);
 }
 
 inline
-int AtomicInt::loadRelaxed() const
+int AtomicInt::fetchOr(int value)
 {
-    return AtomicOperations_Imp::getIntRelaxed(&d_value);
+    return AtomicOperations_Imp::fetchOrInt(&d_value, value);
 }
 
 inline
-int AtomicInt::loadAcquire() const
+int AtomicInt::fetchOrAcqRel(int value)
 {
-    return AtomicOperations_Imp::getIntAcquire(&d_value);
+    return AtomicOperations_Imp::fetchOrIntAcqRel(&d_value, value);
 }
 
-                              // -----------------
-                              // class AtomicInt64
-                              // -----------------
-
-// CREATORS
 inline
-AtomicInt64::AtomicInt64()
+int AtomicInt::fetchXor(int value)
 {
-    AtomicOperations_Imp::initInt64(&d_value, 0);
+    return AtomicOperations_Imp::fetchXorInt(&d_value, value);
 }
 
 inline
-AtomicInt64::AtomicInt64(Types::Int64 value)
+int AtomicInt::fetchXorAcqRel(int value)
+{
+    return AtomicOperations_Imp::fetchXorIntAcqRel(&d_value, value);
+}
+
+// ACCESSORS
+
+inline
+AtomicInt::operator int() const
+{
+    return AtomicOperations_Imp::getInt(&d_value);
+}
+
+inline
+int AtomicInt::load() const
+{
+    return this->operator int();
+}
+
+inline
+int AtomicInt::loadRelaxed() const
+{
+    return AtomicOperations_Imp::getIntRelaxed(&d_value);
+}
+
+inline
+int AtomicInt::loadAcquire() const
+{
+    return AtomicOperations_Imp::getIntAcquire(&d_value);
+}
+
+                              // -----------------
+                              // class AtomicInt64
+                              // -----------------
+
+// CREATORS
+inline
+AtomicInt64::AtomicInt64()
+{
+    AtomicOperations_Imp::initInt64(&d_value, 0);
+}
+
+inline
+AtomicInt64::AtomicInt64(Types::Int64 value)
 {
     AtomicOperations_Imp::initInt64(&d_value, value);
 }
@@ -1315,6 +1811,42 @@ AtomicInt64::testAndSwapAcqRel(Types::Int64 compareValue,
                                                         swapValue);
 }
 
+inline
+Types::Int64 AtomicInt64::fetchAnd(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchAndInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAndAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchAndInt64AcqRel(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOr(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchOrInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOrAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchOrInt64AcqRel(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXor(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchXorInt64(&d_value, value);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXorAcqRel(Types::Int64 value)
+{
+    return AtomicOperations_Imp::fetchXorInt64AcqRel(&d_value, value);
+}
+
 // ACCESSORS
 inline
 AtomicInt64::operator Types::Int64() const
@@ -1340,6 +1872,463 @@ Types::Int64 AtomicInt64::loadAcquire() const
     return AtomicOperations_Imp::getInt64Acquire(&d_value);
 }
 
+                              // ----------------
+                              // class AtomicUint
+                              // ----------------
+
+// CREATORS
+inline
+AtomicUint::AtomicUint()
+{
+    AtomicOperations_Imp::initUint(&d_value, 0);
+}
+
+inline
+AtomicUint::AtomicUint(unsigned int value)
+{
+    AtomicOperations_Imp::initUint(&d_value, value);
+}
+
+// MANIPULATORS
+inline
+AtomicUint& AtomicUint::operator=(unsigned int value)
+{
+    AtomicOperations_Imp::setUint(&d_value, value);
+    return *this;
+}
+
+inline
+unsigned int AtomicUint::operator+=(unsigned int value)
+{
+    return AtomicOperations_Imp::addUintNv(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::operator-=(unsigned int value)
+{
+    return AtomicOperations_Imp::addUintNv(&d_value, 0 - value);
+}
+
+inline
+unsigned int AtomicUint::operator++()
+{
+    return AtomicOperations_Imp::incrementUintNv(&d_value);
+}
+
+inline
+unsigned int AtomicUint::operator++(int)
+{
+    return AtomicOperations_Imp::incrementUintNv(&d_value) - 1;
+}
+
+inline
+unsigned int AtomicUint::operator--()
+{
+    return AtomicOperations_Imp::decrementUintNv(&d_value);
+}
+
+inline
+unsigned int AtomicUint::operator--(int)
+{
+    return AtomicOperations_Imp::decrementUintNv(&d_value) + 1;
+}
+
+inline
+unsigned int AtomicUint::add(unsigned int value)
+{
+    return AtomicOperations_Imp::addUintNv(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::addRelaxed(unsigned int value)
+{
+    return AtomicOperations_Imp::addUintNvRelaxed(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::addAcqRel(unsigned int value)
+{
+    return AtomicOperations_Imp::addUintNvAcqRel(&d_value, value);
+}
+
+inline
+void AtomicUint::storeRelaxed(unsigned int value)
+{
+    AtomicOperations_Imp::setUintRelaxed(&d_value, value);
+}
+
+inline
+void AtomicUint::storeRelease(unsigned int value)
+{
+    AtomicOperations_Imp::setUintRelease(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::swap(unsigned int swapValue)
+{
+    return AtomicOperations_Imp::swapUint(&d_value, swapValue);
+}
+
+inline
+unsigned int AtomicUint::swapAcqRel(unsigned int swapValue)
+{
+    return AtomicOperations_Imp::swapUintAcqRel(&d_value, swapValue);
+}
+
+inline
+unsigned int AtomicUint::testAndSwap(unsigned int compareValue,
+                                     unsigned int swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapUint(&d_value,
+                                                     compareValue,
+                                                     swapValue);
+}
+
+inline
+unsigned int AtomicUint::testAndSwapAcqRel(unsigned int compareValue,
+                                           unsigned int swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapUintAcqRel(&d_value,
+                                                      compareValue,
+                                                      swapValue);
+}
+
+inline
+unsigned int AtomicUint::fetchAnd(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchAndUint(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::fetchAndAcqRel(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchAndUintAcqRel(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::fetchOr(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchOrUint(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::fetchOrAcqRel(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchOrUintAcqRel(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::fetchXor(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchXorUint(&d_value, value);
+}
+
+inline
+unsigned int AtomicUint::fetchXorAcqRel(unsigned int value)
+{
+    return AtomicOperations_Imp::fetchXorUintAcqRel(&d_value, value);
+}
+
+// ACCESSORS
+
+inline
+AtomicUint::operator unsigned int() const
+{
+    return AtomicOperations_Imp::getUint(&d_value);
+}
+
+inline
+unsigned int AtomicUint::load() const
+{
+    return this->operator unsigned int();
+}
+
+inline
+unsigned int AtomicUint::loadRelaxed() const
+{
+    return AtomicOperations_Imp::getUintRelaxed(&d_value);
+}
+
+inline
+unsigned int AtomicUint::loadAcquire() const
+{
+    return AtomicOperations_Imp::getUintAcquire(&d_value);
+}
+
+                             // ------------------
+                             // class AtomicUint64
+                             // ------------------
+
+// CREATORS
+inline
+AtomicUint64::AtomicUint64()
+{
+    AtomicOperations_Imp::initUint64(&d_value, 0);
+}
+
+inline
+AtomicUint64::AtomicUint64(Types::Uint64 value)
+{
+    AtomicOperations_Imp::initUint64(&d_value, value);
+}
+
+// MANIPULATORS
+inline
+AtomicUint64& AtomicUint64::operator=(Types::Uint64 value)
+{
+    AtomicOperations_Imp::setUint64(&d_value, value);
+    return *this;
+}
+
+inline
+Types::Uint64 AtomicUint64::operator+=(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::addUint64Nv(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::operator-=(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::addUint64Nv(&d_value, 0 - value);
+}
+
+inline
+Types::Uint64 AtomicUint64::operator++()
+{
+    return AtomicOperations_Imp::incrementUint64Nv(&d_value);
+}
+
+inline
+Types::Uint64 AtomicUint64::operator++(int)
+{
+    return AtomicOperations_Imp::incrementUint64Nv(&d_value) - 1;
+}
+
+inline
+Types::Uint64 AtomicUint64::operator--()
+{
+    return AtomicOperations_Imp::decrementUint64Nv(&d_value);
+}
+
+inline
+Types::Uint64 AtomicUint64::operator--(int)
+{
+    return AtomicOperations_Imp::decrementUint64Nv(&d_value) + 1;
+}
+
+inline
+Types::Uint64 AtomicUint64::add(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::addUint64Nv(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::addRelaxed(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::addUint64NvRelaxed(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::addAcqRel(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::addUint64NvAcqRel(&d_value, value);
+}
+
+inline
+void AtomicUint64::storeRelaxed(Types::Uint64 value)
+{
+    AtomicOperations_Imp::setUint64Relaxed(&d_value, value);
+}
+
+inline
+void AtomicUint64::storeRelease(Types::Uint64 value)
+{
+    AtomicOperations_Imp::setUint64Release(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::swap(Types::Uint64 swapValue)
+{
+    return AtomicOperations_Imp::swapUint64(&d_value, swapValue);
+}
+
+inline
+Types::Uint64 AtomicUint64::swapAcqRel(Types::Uint64 swapValue)
+{
+    return AtomicOperations_Imp::swapUint64AcqRel(&d_value, swapValue);
+}
+
+inline
+Types::Uint64
+AtomicUint64::testAndSwap(Types::Uint64 compareValue,
+                              Types::Uint64 swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapUint64(&d_value,
+                                                       compareValue,
+                                                       swapValue);
+}
+
+inline
+Types::Uint64
+AtomicUint64::testAndSwapAcqRel(Types::Uint64 compareValue,
+                                    Types::Uint64 swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapUint64AcqRel(&d_value,
+                                                        compareValue,
+                                                        swapValue);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchAnd(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchAndUint64(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchAndAcqRel(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchAndUint64AcqRel(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchOr(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchOrUint64(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchOrAcqRel(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchOrUint64AcqRel(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchXor(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchXorUint64(&d_value, value);
+}
+
+inline
+Types::Uint64 AtomicUint64::fetchXorAcqRel(Types::Uint64 value)
+{
+    return AtomicOperations_Imp::fetchXorUint64AcqRel(&d_value, value);
+}
+
+// ACCESSORS
+inline
+AtomicUint64::operator Types::Uint64() const
+{
+    return AtomicOperations_Imp::getUint64(&d_value);
+}
+
+inline
+Types::Uint64 AtomicUint64::load() const
+{
+    return this->operator Types::Uint64();
+}
+
+inline
+Types::Uint64 AtomicUint64::loadRelaxed() const
+{
+    return AtomicOperations_Imp::getUint64Relaxed(&d_value);
+}
+
+inline
+Types::Uint64 AtomicUint64::loadAcquire() const
+{
+    return AtomicOperations_Imp::getUint64Acquire(&d_value);
+}
+
+                              // ----------------
+                              // class AtomicBool
+                              // ----------------
+
+// CREATORS
+inline
+AtomicBool::AtomicBool()
+{
+    AtomicOperations_Imp::initInt(&d_value, 0);
+}
+
+inline
+AtomicBool::AtomicBool(bool value)
+{
+    AtomicOperations_Imp::initInt(&d_value, value);
+}
+
+// MANIPULATORS
+inline
+AtomicBool& AtomicBool::operator=(bool value)
+{
+    AtomicOperations_Imp::setInt(&d_value, value);
+    return *this;
+}
+
+inline
+void AtomicBool::storeRelaxed(bool value)
+{
+    AtomicOperations_Imp::setIntRelaxed(&d_value, value);
+}
+
+inline
+void AtomicBool::storeRelease(bool value)
+{
+    AtomicOperations_Imp::setIntRelease(&d_value, value);
+}
+
+inline
+bool AtomicBool::swap(bool swapValue)
+{
+    return AtomicOperations_Imp::swapInt(&d_value, swapValue);
+}
+
+inline
+bool AtomicBool::swapAcqRel(bool swapValue)
+{
+    return AtomicOperations_Imp::swapIntAcqRel(&d_value, swapValue);
+}
+
+inline
+bool AtomicBool::testAndSwap(bool compareValue, bool swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapInt(&d_value,
+                                                compareValue,
+                                                swapValue);
+}
+
+inline
+bool AtomicBool::testAndSwapAcqRel(bool compareValue, bool swapValue)
+{
+    return AtomicOperations_Imp::testAndSwapIntAcqRel(&d_value,
+                                                      compareValue,
+                                                      swapValue);
+}
+
+// ACCESSORS
+inline
+AtomicBool::operator bool() const
+{
+    return AtomicOperations_Imp::getInt(&d_value);
+}
+
+inline
+bool AtomicBool::load() const
+{
+    return this->operator bool();
+}
+
+inline
+bool AtomicBool::loadRelaxed() const
+{
+    return AtomicOperations_Imp::getIntRelaxed(&d_value);
+}
+
+inline
+bool AtomicBool::loadAcquire() const
+{
+    return AtomicOperations_Imp::getIntAcquire(&d_value);
+}
+
                              // -------------------
                              // class AtomicPointer
                              // -------------------
@@ -55,6 +55,9 @@ using namespace std;
 // [ 4] void operator +=(int value);
 // [ 4] void operator -=(int value);
 // [ 2] operator int() const;
+// [12] int fetchAnd(int value);
+// [12] int fetchOr(int value);
+// [12] int fetchXor(int value);
 //
 // bsls::AtomicInt64
 // -----------------
@@ -74,6 +77,56 @@ using namespace std;
 // [ 4] void operator +=(bsls::Types::Int64 value);
 // [ 4] void operator -=(bsls::Types::Int64 value);
 // [ 2] operator bsls::Types::Int64() const;
+// [12] bsls::Types::Int64 fetchAnd(bsls::Types::Int64 value);
+// [12] bsls::Types::Int64 fetchOr(bsls::Types::Int64 value);
+// [12] bsls::Types::Int64 fetchXor(bsls::Types::Int64 value);
+//
+// bsls::AtomicUint
+// ----------------
+// [10] bsls::AtomicUint();
+// [10] bsls::AtomicUint(unsigned int value);
+// [10] unsigned int add(unsigned int value);
+// [10] unsigned int swap(unsigned int swapValue);
+// [10] unsigned int testAndSwap(unsigned int, unsigned int);
+// [10] unsigned int operator ++();
+// [10] unsigned int operator ++(int);
+// [10] unsigned int operator --();
+// [10] unsigned int operator --(int);
+// [10] bsls::AtomicUint& operator= (unsigned int value);
+// [10] unsigned int operator +=(unsigned int value);
+// [10] unsigned int operator -=(unsigned int value);
+// [10] operator unsigned int() const;
+// [12] unsigned int fetchAnd(unsigned int value);
+// [12] unsigned int fetchOr(unsigned int value);
+// [12] unsigned int fetchXor(unsigned int value);
+//
+// bsls::AtomicUint64
+// ------------------
+// [10] bsls::AtomicUint64();
+// [10] bsls::AtomicUint64(bsls::Types::Uint64 value);
+// [10] bsls::Types::Uint64 add(bsls::Types::Uint64 value);
+// [10] bsls::Types::Uint64 swap(bsls::Types::Uint64 swapValue);
+// [10] bsls::Types::Uint64 testAndSwap(bsls::Types::Uint64 ...
+// [10] bsls::Types::Uint64 operator ++();
+// [10] bsls::Types::Uint64 operator ++(int);
+// [10] bsls::Types::Uint64 operator --();
+// [10] bsls::Types::Uint64 operator --(int);
+// [10] bsls::AtomicUint64& operator= (bsls::Types::Uint64 value);
+// [10] bsls::Types::Uint64 operator +=(bsls::Types::Uint64 value);
+// [10] bsls::Types::Uint64 operator -=(bsls::Types::Uint64 value);
+// [10] operator bsls::Types::Uint64() const;
+// [12] bsls::Types::Uint64 fetchAnd(bsls::Types::Uint64 value);
+// [12] bsls::Types::Uint64 fetchOr(bsls::Types::Uint64 value);
+// [12] bsls::Types::Uint64 fetchXor(bsls::Types::Uint64 value);
+//
+// bsls::AtomicBool
+// ----------------
+// [11] bsls::AtomicBool();
+// [11] bsls::AtomicBool(bool value);
+// [11] bool swap(bool swapValue);
+// [11] bool testAndSwap(bool compareValue, bool swapValue);
+// [11] bsls::AtomicBool& operator= (bool value);
+// [11] operator bool() const;
 //
 // bsls::AtomicPointer
 // -------------------
@@ -157,10 +210,14 @@ struct APTestObj
 
 typedef bsls::AtomicInt                      AI;
 typedef bsls::AtomicInt64                    AI64;
+typedef bsls::AtomicUint                     AU;
+typedef bsls::AtomicUint64                   AU64;
+typedef bsls::AtomicBool                     AB;
 typedef bsls::AtomicPointer<APTestObj>       AP;
 typedef bsls::AtomicPointer<const APTestObj> CAP;
 
 typedef bsls::Types::Int64            Int64;
+typedef bsls::Types::Uint64           Uint64;
 
 //=============================================================================
 //                         HELPER CLASSES AND FUNCTIONS  FOR TESTING
@@ -179,6 +236,81 @@ void yield()
 #endif
 }
 
+template <class OBJ, class TYPE>
+void testBitwiseOperations(int line, TYPE value, TYPE operand)
+    // Verify, for an object of the specified 'OBJ' atomic type having the
+    // specified 'value', that each bitwise operation with the specified
+    // 'operand' returns 'value' and sets the expected result.  Report a
+    // failure using the specified 'line'.
+{
+    OBJ mX(value);  const OBJ& X = mX;
+
+    LOOP_ASSERT(line, value == mX.fetchAnd(operand));
+    LOOP_ASSERT(line, TYPE(value & operand) == X);
+    mX = value;
+    LOOP_ASSERT(line, value == mX.fetchAndAcqRel(operand));
+    LOOP_ASSERT(line, TYPE(value & operand) == X);
+    mX = value;
+    LOOP_ASSERT(line, value == mX.fetchOr(operand));
+    LOOP_ASSERT(line, TYPE(value | operand) == X);
+    mX = value;
+    LOOP_ASSERT(line, value == mX.fetchOrAcqRel(operand));
+    LOOP_ASSERT(line, TYPE(value | operand) == X);
+    mX = value;
+    LOOP_ASSERT(line, value == mX.fetchXor(operand));
+    LOOP_ASSERT(line, TYPE(value ^ operand) == X);
+    LOOP_ASSERT(line, TYPE(value ^ operand) == mX.fetchXorAcqRel(operand));
+    LOOP_ASSERT(line, value == X.load());
+}
+
+template <class OBJ, class TYPE>
+void testUnsignedOperations(int line, TYPE value, TYPE operand)
+    // Verify, for an object of the specified 'OBJ' atomic unsigned integer
+    // type having the specified 'value', that each arithmetic, swap, and
+    // access operation with the specified 'operand' returns and sets the
+    // values computed using (wrapping) unsigned arithmetic.  Report a failure
+    // using the specified 'line'.
+{
+    OBJ mX;  const OBJ& X = mX;
+    LOOP_ASSERT(line, 0 == X);
+
+    mX = value;
+    LOOP_ASSERT(line, value == X);
+    LOOP_ASSERT(line, value == X.load());
+    LOOP_ASSERT(line, value == X.loadRelaxed());
+    LOOP_ASSERT(line, value == X.loadAcquire());
+
+    mX.storeRelaxed(operand);
+    LOOP_ASSERT(line, operand == X);
+    mX.storeRelease(value);
+    LOOP_ASSERT(line, value == X);
+
+    LOOP_ASSERT(line, TYPE(value + operand) == (mX += operand));
+    LOOP_ASSERT(line, value == (mX -= operand));
+    LOOP_ASSERT(line, TYPE(value + operand) == mX.add(operand));
+    LOOP_ASSERT(line, TYPE(value + 2 * operand) == mX.addRelaxed(operand));
+    LOOP_ASSERT(line, TYPE(value + 3 * operand) == mX.addAcqRel(operand));
+
+    mX = value;
+    LOOP_ASSERT(line, TYPE(value + 1) == ++mX);
+    LOOP_ASSERT(line, TYPE(value + 1) == mX++);
+    LOOP_ASSERT(line, TYPE(value + 1) == --mX);
+    LOOP_ASSERT(line, TYPE(value + 1) == mX--);
+    LOOP_ASSERT(line, value == X);
+
+    LOOP_ASSERT(line, value == mX.swap(operand));
+    LOOP_ASSERT(line, operand == mX.swapAcqRel(value));
+    LOOP_ASSERT(line, value == mX.testAndSwap(TYPE(value + 1), operand));
+    LOOP_ASSERT(line, value == X);
+    LOOP_ASSERT(line, value == mX.testAndSwap(value, operand));
+    LOOP_ASSERT(line, operand == X);
+    LOOP_ASSERT(line, operand == mX.testAndSwapAcqRel(operand, value));
+    LOOP_ASSERT(line, value == X);
+
+    OBJ mY(operand);  const OBJ& Y = mY;
+    LOOP_ASSERT(line, operand == Y);
+}
+
 template <class INT>
 struct LockData
 {
@@ -1123,6 +1255,241 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE OPERATIONS
+        //
+        // Concerns:
+        //: 1 'fetchAnd', 'fetchOr', and 'fetchXor', and their 'AcqRel'
+        //:   variants, set the value to the bitwise combination of the value
+        //:   and the operand, and return the previous value, for each of the
+        //:   integer types.
+        //
+        // Plan:
+        //: 1 For a table of values and operands, apply each operation to an
+        //:   object of each integer type, and verify the returned and the
+        //:   resulting values.  (C-1)
+        //
+        // Testing:
+        //   int AtomicInt::fetchAnd(int value);
+        //   int AtomicInt::fetchAndAcqRel(int value);
+        //   int AtomicInt::fetchOr(int value);
+        //   int AtomicInt::fetchOrAcqRel(int value);
+        //   int AtomicInt::fetchXor(int value);
+        //   int AtomicInt::fetchXorAcqRel(int value);
+        //   [the same operations for 'AtomicInt64']
+        //   [the same operations for 'AtomicUint']
+        //   [the same operations for 'AtomicUint64']
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BITWISE OPERATIONS"
+                          << "\n=========================="
+                          << endl;
+
+        static const struct {
+            int   d_lineNum;  // source line number
+            Int64 d_value;    // initial value
+            Int64 d_operand;  // operand
+        } VALUES[] = {
+            //line  value                 operand
+            //----  --------------------  --------------------
+            { L_,   0,                    0                    },
+            { L_,   0,                    -1                   },
+            { L_,   -1,                   0                    },
+            { L_,   -1,                   -1                   },
+            { L_,   0x00FF00FF00FF00FFLL, 0x0F0F0F0F0F0F0F0FLL },
+            { L_,   0x7FFFFFFF80000001LL, 0x0000000180000000LL },
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int   LINE = VALUES[i].d_lineNum;
+            const Int64 V    = VALUES[i].d_value;
+            const Int64 OP   = VALUES[i].d_operand;
+
+            if (veryVerbose) { T_(); P_(LINE); P_(V); P(OP); }
+
+            testBitwiseOperations<AI, int>(LINE,
+                                           static_cast<int>(V),
+                                           static_cast<int>(OP));
+            testBitwiseOperations<AI64, Int64>(LINE, V, OP);
+            testBitwiseOperations<AU, unsigned int>(
+                                          LINE,
+                                          static_cast<unsigned int>(V),
+                                          static_cast<unsigned int>(OP));
+            testBitwiseOperations<AU64, Uint64>(LINE,
+                                                static_cast<Uint64>(V),
+                                                static_cast<Uint64>(OP));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'AtomicBool'
+        //
+        // Concerns:
+        //: 1 A default-constructed object has the value 'false'.
+        //:
+        //: 2 The value constructor, the assignment operator, and the store
+        //:   operations set the value, and the accessors report it.
+        //:
+        //: 3 'swap' and 'testAndSwap', and their 'AcqRel' variants, return
+        //:   the previous value and set the expected value.
+        //
+        // Plan:
+        //: 1 Default-construct an object and verify its value.  (C-1)
+        //:
+        //: 2 For each of 'false' and 'true', construct an object, set its
+        //:   value with each manipulator, and verify the value using each
+        //:   accessor.  (C-2)
+        //:
+        //: 3 For each combination of the current value, the compare value,
+        //:   and the swap value, verify the results of the swap operations.
+        //:   (C-3)
+        //
+        // Testing:
+        //   AtomicBool();
+        //   AtomicBool(bool value);
+        //   AtomicBool& operator=(bool value);
+        //   void storeRelaxed(bool value);
+        //   void storeRelease(bool value);
+        //   bool swap(bool swapValue);
+        //   bool swapAcqRel(bool swapValue);
+        //   bool testAndSwap(bool compareValue, bool swapValue);
+        //   bool testAndSwapAcqRel(bool compareValue, bool swapValue);
+        //   operator bool() const;
+        //   bool load() const;
+        //   bool loadRelaxed() const;
+        //   bool loadAcquire() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'AtomicBool'"
+                          << "\n===================="
+                          << endl;
+
+        {
+            AB mX;  const AB& X = mX;
+            ASSERT(false == X);
+            ASSERT(false == X.load());
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            const bool V = i;
+
+            AB mX(V);  const AB& X = mX;
+            LOOP_ASSERT(i, V == X);
+            LOOP_ASSERT(i, V == X.load());
+            LOOP_ASSERT(i, V == X.loadRelaxed());
+            LOOP_ASSERT(i, V == X.loadAcquire());
+
+            mX = !V;
+            LOOP_ASSERT(i, !V == X);
+            mX.storeRelaxed(V);
+            LOOP_ASSERT(i, V == X);
+            mX.storeRelease(!V);
+            LOOP_ASSERT(i, !V == X);
+
+            LOOP_ASSERT(i, !V == mX.swap(V));
+            LOOP_ASSERT(i, V == X);
+            LOOP_ASSERT(i, V == mX.swapAcqRel(!V));
+            LOOP_ASSERT(i, !V == X);
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            const bool V    = i & 1;
+            const bool CMP  = i & 2;
+            const bool SWAP = i & 4;
+            const bool EXP  = V == CMP ? SWAP : V;
+
+            AB mX(V);  const AB& X = mX;
+            LOOP_ASSERT(i, V == mX.testAndSwap(CMP, SWAP));
+            LOOP_ASSERT(i, EXP == X);
+
+            mX = V;
+            LOOP_ASSERT(i, V == mX.testAndSwapAcqRel(CMP, SWAP));
+            LOOP_ASSERT(i, EXP == X);
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'AtomicUint' AND 'AtomicUint64'
+        //
+        // Concerns:
+        //: 1 The constructors, assignment operator, and store operations set
+        //:   the full range of unsigned values, and the accessors report it.
+        //:
+        //: 2 Arithmetic wraps modulo 2 to the power of the number of bits in
+        //:   the type.
+        //:
+        //: 3 The swap and test-and-swap operations return the previous value
+        //:   and set the expected value.
+        //
+        // Plan:
+        //: 1 For a table of values and operands, exercise each operation of
+        //:   each type, and verify the returned and resulting values against
+        //:   the values computed using unsigned arithmetic.  (C-1..3)
+        //
+        // Testing:
+        //   AtomicUint();
+        //   AtomicUint(unsigned int value);
+        //   AtomicUint& operator=(unsigned int value);
+        //   unsigned int operator+=(unsigned int value);
+        //   unsigned int operator-=(unsigned int value);
+        //   unsigned int operator++();
+        //   unsigned int operator++(int);
+        //   unsigned int operator--();
+        //   unsigned int operator--(int);
+        //   unsigned int add(unsigned int value);
+        //   unsigned int addRelaxed(unsigned int value);
+        //   unsigned int addAcqRel(unsigned int value);
+        //   void storeRelaxed(unsigned int value);
+        //   void storeRelease(unsigned int value);
+        //   unsigned int swap(unsigned int swapValue);
+        //   unsigned int swapAcqRel(unsigned int swapValue);
+        //   unsigned int testAndSwap(unsigned int, unsigned int);
+        //   unsigned int testAndSwapAcqRel(unsigned int, unsigned int);
+        //   operator unsigned int() const;
+        //   unsigned int load() const;
+        //   unsigned int loadRelaxed() const;
+        //   unsigned int loadAcquire() const;
+        //   [the same operations for 'AtomicUint64']
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'AtomicUint' AND 'AtomicUint64'"
+                          << "\n======================================="
+                          << endl;
+
+        static const struct {
+            int    d_lineNum;  // source line number
+            Uint64 d_value;    // initial value
+            Uint64 d_operand;  // operand
+        } VALUES[] = {
+            //line  value                  operand
+            //----  ---------------------  ---------------------
+            { L_,   0,                     0                     },
+            { L_,   0,                     1                     },
+            { L_,   1,                     0xFFFFFFFFFFFFFFFFULL },
+            { L_,   0xFFFFFFFFFFFFFFFFULL, 1                     },
+            { L_,   0x00000000FFFFFFFFULL, 1                     },
+            { L_,   0x0000000080000000ULL, 0x0000000080000000ULL },
+            { L_,   0x8000000000000000ULL, 0x8000000000000000ULL },
+            { L_,   0x0123456789ABCDEFULL, 0x0F0F0F0F0F0F0F0FULL },
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int    LINE = VALUES[i].d_lineNum;
+            const Uint64 V    = VALUES[i].d_value;
+            const Uint64 OP   = VALUES[i].d_operand;
+
+            if (veryVerbose) { T_(); P_(LINE); P_(V); P(OP); }
+
+            testUnsignedOperations<AU, unsigned int>(
+                                          LINE,
+                                          static_cast<unsigned int>(V),
+                                          static_cast<unsigned int>(OP));
+            testUnsignedOperations<AU64, Uint64>(LINE, V, OP);
+        }
+      } break;
       case 9: {
         // TESTING USAGE Examples
         //
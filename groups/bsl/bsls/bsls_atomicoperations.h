@@ -191,6 +191,38 @@ BSLS_IDENT("$Id: $")
 // to determine the resulting value of an operation than to simply perform the
 // operation.
 //
+// The bitwise operations (e.g., 'fetchOrInt', 'fetchAndInt64AcqRel') set the
+// value of an atomic integer to the bitwise AND, OR, or XOR of its value and
+// an operand, and return the *previous* value.  They are typically used to
+// set, clear, or toggle flags packed into a single word.
+//
+///Atomic Unsigned Integer Operations
+///----------------------------------
+// The atomic unsigned integer operations (e.g., 'addUintNv', 'fetchOrUint64')
+// mirror the signed integer operations for 32 and 64-bit unsigned integers.
+// Arithmetic on unsigned values wraps modulo 2 to the power of the number of
+// bits in the type, so these types are suitable for sequence numbers and bit
+// masks.
+//
+///Atomic 128-bit Operations
+///-------------------------
+// The 128-bit operations ('getUint128', 'setUint128', and
+// 'testAndSwapUint128') operate on a pair of 64-bit words as a single atomic
+// value.  A double-width compare-and-swap is commonly used to update a pointer
+// together with a version counter, in order to avoid the ABA problem in
+// lock-free data structures.  On platforms providing a native double-width
+// compare-and-swap instruction (such as 'cmpxchg16b' on x86-64) these
+// operations are lock-free; on other platforms they are emulated using a small
+// set of spin locks.
+//
+///Memory Fences
+///-------------
+// 'threadFence', 'threadFenceAcquire', and 'threadFenceRelease' issue
+// standalone memory fences providing, respectively, the sequential
+// consistency, acquire, and release memory ordering guarantees.  A fence can
+// be combined with relaxed atomic operations to order several memory accesses
+// at once, rather than paying for the ordering on each individual access.
+//
 ///Atomic Pointer Operations
 ///-------------------------
 // The atomic pointer operations provide thread-safe access to pointer values
@@ -757,7 +789,10 @@ struct AtomicOperations {
     // 'AtomicOperations' provides a namespace for a suite of atomic
     // operations on the following types as defined by the 'AtomicTypes'
     // typedef: integer - 'AtomicTypes::Int', 64bit integer -
-    // 'AtomicTypes::Int64', pointer - 'AtomicTypes::Pointer'.
+    // 'AtomicTypes::Int64', unsigned integer - 'AtomicTypes::Uint', 64bit
+    // unsigned integer - 'AtomicTypes::Uint64', 128bit unsigned integer -
+    // 'AtomicTypes::Uint128', pointer - 'AtomicTypes::Pointer'.  It also
+    // provides memory fences.
 
     // TYPES
     typedef AtomicOperations_Imp   Imp;
@@ -887,6 +922,39 @@ struct AtomicOperations {
         // Atomically decrement the value of the specified 'atomicInt' by 1,
         // providing the acquire/release memory ordering guarantee.
 
+    static int fetchAndInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static int fetchOrInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static int fetchXorInt(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
         // *** atomic functions for Int64 ***
 
     static void initInt64(AtomicTypes::Int64 *atomicInt,
@@ -1024,6 +1092,404 @@ struct AtomicOperations {
         // resulting value, providing the acquire/release memory ordering
         // guarantee.
 
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchAndInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchOrInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                           Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'value', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchXorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'value', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+        // *** atomic functions for unsigned int ***
+
+    static void initUint(AtomicTypes::Uint *atomicUint,
+                         unsigned int       initialValue = 0);
+        // Initialize the specified 'atomicUint' and set its value to the
+        // specified 'initialValue'.
+
+    static unsigned int getUint(AtomicTypes::Uint const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint',
+        // providing the sequential consistency memory ordering guarantee.
+
+    static unsigned int getUintRelaxed(AtomicTypes::Uint const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint', without
+        // providing any memory ordering guarantees.
+
+    static unsigned int getUintAcquire(AtomicTypes::Uint const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint',
+        // providing the acquire memory ordering guarantee.
+
+    static void setUint(AtomicTypes::Uint *atomicUint, unsigned int value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static void setUintRelaxed(AtomicTypes::Uint *atomicUint,
+                               unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', without providing any memory ordering guarantees.
+
+    static void setUintRelease(AtomicTypes::Uint *atomicUint,
+                               unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', providing the release memory ordering guarantee.
+
+    static unsigned int swapUint(AtomicTypes::Uint *atomicUint,
+                                 unsigned int       swapValue);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'swapValue', and return its previous value, providing the
+        // sequential consistency memory ordering guarantee.
+
+    static unsigned int swapUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                       unsigned int       swapValue);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'swapValue', and return its previous value, providing the
+        // acquire/release memory ordering guarantee.
+
+    static unsigned int testAndSwapUint(AtomicTypes::Uint *atomicUint,
+                                        unsigned int       compareValue,
+                                        unsigned int       swapValue);
+        // Conditionally set the value of the specified 'atomicUint' to the
+        // specified 'swapValue' if and only if the value of 'atomicUint'
+        // equals the value of the specified 'compareValue', and return the
+        // initial value of 'atomicUint', providing the sequential consistency
+        // memory ordering guarantee.  The whole operation is performed
+        // atomically.
+
+    static unsigned int testAndSwapUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                              unsigned int       compareValue,
+                                              unsigned int       swapValue);
+        // Conditionally set the value of the specified 'atomicUint' to the
+        // specified 'swapValue' if and only if the value of 'atomicUint'
+        // equals the value of the specified 'compareValue', and return the
+        // initial value of 'atomicUint', providing the acquire/release memory
+        // ordering guarantee.  The whole operation is performed atomically.
+
+    static unsigned int addUintNv(AtomicTypes::Uint *atomicUint,
+                                  unsigned int       value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, providing the sequential consistency
+        // memory ordering guarantee.  Note that the result wraps modulo 2 to
+        // the power of the number of bits in the type.
+
+    static unsigned int addUintNvRelaxed(AtomicTypes::Uint *atomicUint,
+                                         unsigned int       value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, without providing any memory
+        // ordering guarantees.
+
+    static unsigned int addUintNvAcqRel(AtomicTypes::Uint *atomicUint,
+                                        unsigned int       value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, providing the acquire/release memory
+        // ordering guarantee.
+
+    static void addUint(AtomicTypes::Uint *atomicUint, unsigned int value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void addUintRelaxed(AtomicTypes::Uint *atomicUint,
+                               unsigned int       value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // without providing any memory ordering guarantees.
+
+    static void addUintAcqRel(AtomicTypes::Uint *atomicUint,
+                              unsigned int       value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // providing the acquire/release memory ordering guarantee.
+
+    static unsigned int incrementUintNv(AtomicTypes::Uint *atomicUint);
+        // Atomically increment the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the sequential consistency memory
+        // ordering guarantee.
+
+    static unsigned int incrementUintNvAcqRel(AtomicTypes::Uint *atomicUint);
+        // Atomically increment the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static void incrementUint(AtomicTypes::Uint *atomicUint);
+        // Atomically increment the value of the specified 'atomicUint' by 1,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void incrementUintAcqRel(AtomicTypes::Uint *atomicUint);
+        // Atomically increment the value of the specified 'atomicUint' by 1,
+        // providing the acquire/release memory ordering guarantee.
+
+    static unsigned int decrementUintNv(AtomicTypes::Uint *atomicUint);
+        // Atomically decrement the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the sequential consistency memory
+        // ordering guarantee.
+
+    static unsigned int decrementUintNvAcqRel(AtomicTypes::Uint *atomicUint);
+        // Atomically decrement the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static void decrementUint(AtomicTypes::Uint *atomicUint);
+        // Atomically decrement the value of the specified 'atomicUint' by 1,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void decrementUintAcqRel(AtomicTypes::Uint *atomicUint);
+        // Atomically decrement the value of the specified 'atomicUint' by 1,
+        // providing the acquire/release memory ordering guarantee.
+
+    static unsigned int fetchAndUint(AtomicTypes::Uint *atomicUint,
+                                     unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise AND of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static unsigned int fetchAndUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                           unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise AND of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static unsigned int fetchOrUint(AtomicTypes::Uint *atomicUint,
+                                    unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise OR of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static unsigned int fetchOrUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                          unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise OR of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static unsigned int fetchXorUint(AtomicTypes::Uint *atomicUint,
+                                     unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise XOR of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static unsigned int fetchXorUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                           unsigned int       value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise XOR of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
+        // *** atomic functions for Uint64 ***
+
+    static void initUint64(AtomicTypes::Uint64 *atomicUint,
+                           Types::Uint64        initialValue = 0);
+        // Initialize the specified 'atomicUint' and set its value to the
+        // specified 'initialValue'.
+
+    static Types::Uint64 getUint64(AtomicTypes::Uint64 const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint',
+        // providing the sequential consistency memory ordering guarantee.
+
+    static Types::Uint64 getUint64Relaxed(
+                                        AtomicTypes::Uint64 const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint', without
+        // providing any memory ordering guarantees.
+
+    static Types::Uint64 getUint64Acquire(
+                                        AtomicTypes::Uint64 const *atomicUint);
+        // Atomically retrieve the value of the specified 'atomicUint',
+        // providing the acquire memory ordering guarantee.
+
+    static void setUint64(AtomicTypes::Uint64 *atomicUint,
+                          Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', providing the sequential consistency memory
+        // ordering guarantee.
+
+    static void setUint64Relaxed(AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', without providing any memory ordering guarantees.
+
+    static void setUint64Release(AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'value', providing the release memory ordering guarantee.
+
+    static Types::Uint64 swapUint64(AtomicTypes::Uint64 *atomicUint,
+                                    Types::Uint64        swapValue);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'swapValue', and return its previous value, providing the
+        // sequential consistency memory ordering guarantee.
+
+    static Types::Uint64 swapUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                          Types::Uint64        swapValue);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // specified 'swapValue', and return its previous value, providing the
+        // acquire/release memory ordering guarantee.
+
+    static Types::Uint64 testAndSwapUint64(AtomicTypes::Uint64 *atomicUint,
+                                           Types::Uint64        compareValue,
+                                           Types::Uint64        swapValue);
+        // Conditionally set the value of the specified 'atomicUint' to the
+        // specified 'swapValue' if and only if the value of 'atomicUint'
+        // equals the value of the specified 'compareValue', and return the
+        // initial value of 'atomicUint', providing the sequential consistency
+        // memory ordering guarantee.  The whole operation is performed
+        // atomically.
+
+    static Types::Uint64 testAndSwapUint64AcqRel(
+                                            AtomicTypes::Uint64 *atomicUint,
+                                            Types::Uint64        compareValue,
+                                            Types::Uint64        swapValue);
+        // Conditionally set the value of the specified 'atomicUint' to the
+        // specified 'swapValue' if and only if the value of 'atomicUint'
+        // equals the value of the specified 'compareValue', and return the
+        // initial value of 'atomicUint', providing the acquire/release memory
+        // ordering guarantee.  The whole operation is performed atomically.
+
+    static Types::Uint64 addUint64Nv(AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, providing the sequential consistency
+        // memory ordering guarantee.  Note that the result wraps modulo 2 to
+        // the power of the number of bits in the type.
+
+    static Types::Uint64 addUint64NvRelaxed(AtomicTypes::Uint64 *atomicUint,
+                                            Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, without providing any memory
+        // ordering guarantees.
+
+    static Types::Uint64 addUint64NvAcqRel(AtomicTypes::Uint64 *atomicUint,
+                                           Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value'
+        // and return the resulting value, providing the acquire/release memory
+        // ordering guarantee.
+
+    static void addUint64(AtomicTypes::Uint64 *atomicUint,
+                          Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void addUint64Relaxed(AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // without providing any memory ordering guarantees.
+
+    static void addUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                Types::Uint64        value);
+        // Atomically add to the specified 'atomicUint' the specified 'value',
+        // providing the acquire/release memory ordering guarantee.
+
+    static Types::Uint64 incrementUint64Nv(AtomicTypes::Uint64 *atomicUint);
+        // Atomically increment the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the sequential consistency memory
+        // ordering guarantee.
+
+    static Types::Uint64 incrementUint64NvAcqRel(
+                                              AtomicTypes::Uint64 *atomicUint);
+        // Atomically increment the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static void incrementUint64(AtomicTypes::Uint64 *atomicUint);
+        // Atomically increment the value of the specified 'atomicUint' by 1,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void incrementUint64AcqRel(AtomicTypes::Uint64 *atomicUint);
+        // Atomically increment the value of the specified 'atomicUint' by 1,
+        // providing the acquire/release memory ordering guarantee.
+
+    static Types::Uint64 decrementUint64Nv(AtomicTypes::Uint64 *atomicUint);
+        // Atomically decrement the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the sequential consistency memory
+        // ordering guarantee.
+
+    static Types::Uint64 decrementUint64NvAcqRel(
+                                              AtomicTypes::Uint64 *atomicUint);
+        // Atomically decrement the specified 'atomicUint' by 1 and return the
+        // resulting value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static void decrementUint64(AtomicTypes::Uint64 *atomicUint);
+        // Atomically decrement the value of the specified 'atomicUint' by 1,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void decrementUint64AcqRel(AtomicTypes::Uint64 *atomicUint);
+        // Atomically decrement the value of the specified 'atomicUint' by 1,
+        // providing the acquire/release memory ordering guarantee.
+
+    static Types::Uint64 fetchAndUint64(AtomicTypes::Uint64 *atomicUint,
+                                        Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise AND of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Uint64 fetchAndUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                              Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise AND of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static Types::Uint64 fetchOrUint64(AtomicTypes::Uint64 *atomicUint,
+                                       Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise OR of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Uint64 fetchOrUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                             Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise OR of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
+    static Types::Uint64 fetchXorUint64(AtomicTypes::Uint64 *atomicUint,
+                                        Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise XOR of its value and the specified 'value', and return its
+        // previous value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Uint64 fetchXorUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                              Types::Uint64        value);
+        // Atomically set the value of the specified 'atomicUint' to the
+        // bitwise XOR of its value and the specified 'value', and return its
+        // previous value, providing the acquire/release memory ordering
+        // guarantee.
+
         // *** atomic functions for pointer ***
 
     static void initPointer(AtomicTypes::Pointer *atomicPtr,
@@ -1088,6 +1554,65 @@ struct AtomicOperations {
         // the value of the specified 'compareValue', and return the initial
         // value of 'atomicPtr', providing the acquire/release memory ordering
         // guarantee.  The whole operation is performed atomically.
+
+        // *** atomic functions for Uint128 ***
+
+    static void initUint128(AtomicTypes::Uint128 *atomicValue,
+                            Types::Uint64         initialLow  = 0,
+                            Types::Uint64         initialHigh = 0);
+        // Initialize the specified 'atomicValue' and set its low and high
+        // 64-bit words to the specified 'initialLow' and 'initialHigh'
+        // respectively.
+
+    static void getUint128(AtomicTypes::Uint128 const *atomicValue,
+                           Types::Uint64              *low,
+                           Types::Uint64              *high);
+        // Atomically load the low and high 64-bit words of the value of the
+        // specified 'atomicValue' into the specified 'low' and 'high'
+        // respectively, providing the sequential consistency memory ordering
+        // guarantee.  Note that, on some platforms, this operation is
+        // implemented as a compare-and-swap, and so requires write access to
+        // the memory of 'atomicValue'.
+
+    static void setUint128(AtomicTypes::Uint128 *atomicValue,
+                           Types::Uint64         low,
+                           Types::Uint64         high);
+        // Atomically set the low and high 64-bit words of the specified
+        // 'atomicValue' to the specified 'low' and 'high' respectively,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static bool testAndSwapUint128(AtomicTypes::Uint128 *atomicValue,
+                                   Types::Uint64        *compareLow,
+                                   Types::Uint64        *compareHigh,
+                                   Types::Uint64         swapLow,
+                                   Types::Uint64         swapHigh);
+        // Conditionally set the low and high 64-bit words of the specified
+        // 'atomicValue' to the specified 'swapLow' and 'swapHigh' if and only
+        // if they are equal to the values addressed by the specified
+        // 'compareLow' and 'compareHigh' respectively, load the initial value
+        // of 'atomicValue' into 'compareLow' and 'compareHigh', and return
+        // 'true' if the value was set, and 'false' otherwise, providing the
+        // sequential consistency memory ordering guarantee.  The whole
+        // operation is performed atomically.  Note that on return the values
+        // addressed by 'compareLow' and 'compareHigh' are suitable for
+        // retrying the operation in a compare-and-swap loop.
+
+        // *** memory fences ***
+
+    static void threadFence();
+        // Issue a memory fence providing the sequential consistency memory
+        // ordering guarantee: no memory access preceding the fence in program
+        // order may be reordered with any memory access following it.
+
+    static void threadFenceAcquire();
+        // Issue a memory fence providing the acquire memory ordering
+        // guarantee: no memory load preceding the fence in program order may
+        // be reordered with any memory access following it.
+
+    static void threadFenceRelease();
+        // Issue a memory fence providing the release memory ordering
+        // guarantee: no memory access preceding the fence in program order may
+        // be reordered with any memory store following it.
 };
 
 // ===========================================================================
@@ -1252,6 +1777,42 @@ void AtomicOperations::decrementIntAcqRel(AtomicTypes::Int *atomicInt)
     Imp::decrementIntAcqRel(atomicInt);
 }
 
+inline
+int AtomicOperations::fetchAndInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchAndInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchAndIntAcqRel(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchOrInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchOrInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchOrIntAcqRel(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchXorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchXorInt(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int value)
+{
+    return Imp::fetchXorIntAcqRel(atomicInt, value);
+}
+
 inline
 void AtomicOperations::initInt64(AtomicTypes::Int64 *atomicInt,
                                  Types::Int64        initialValue)
@@ -1427,6 +1988,489 @@ Types::Int64
     return Imp::decrementInt64NvAcqRel(atomicInt);
 }
 
+inline
+Types::Int64 AtomicOperations::fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value)
+{
+    return Imp::fetchAndInt64(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchAndInt64AcqRel(
+                                                 AtomicTypes::Int64 *atomicInt,
+                                                 Types::Int64        value)
+{
+    return Imp::fetchAndInt64AcqRel(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        value)
+{
+    return Imp::fetchOrInt64(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchOrInt64AcqRel(
+                                                 AtomicTypes::Int64 *atomicInt,
+                                                 Types::Int64        value)
+{
+    return Imp::fetchOrInt64AcqRel(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        value)
+{
+    return Imp::fetchXorInt64(atomicInt, value);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchXorInt64AcqRel(
+                                                 AtomicTypes::Int64 *atomicInt,
+                                                 Types::Int64        value)
+{
+    return Imp::fetchXorInt64AcqRel(atomicInt, value);
+}
+
+inline
+void AtomicOperations::initUint(AtomicTypes::Uint *atomicUint,
+                                unsigned int       initialValue)
+{
+    Imp::initUint(atomicUint, initialValue);
+}
+
+inline
+unsigned int AtomicOperations::getUint(AtomicTypes::Uint const *atomicUint)
+{
+    return Imp::getUint(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::getUintRelaxed(
+                                           AtomicTypes::Uint const *atomicUint)
+{
+    return Imp::getUintRelaxed(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::getUintAcquire(
+                                           AtomicTypes::Uint const *atomicUint)
+{
+    return Imp::getUintAcquire(atomicUint);
+}
+
+inline
+void AtomicOperations::setUint(AtomicTypes::Uint *atomicUint,
+                               unsigned int       value)
+{
+    Imp::setUint(atomicUint, value);
+}
+
+inline
+void AtomicOperations::setUintRelaxed(AtomicTypes::Uint *atomicUint,
+                                      unsigned int       value)
+{
+    Imp::setUintRelaxed(atomicUint, value);
+}
+
+inline
+void AtomicOperations::setUintRelease(AtomicTypes::Uint *atomicUint,
+                                      unsigned int       value)
+{
+    Imp::setUintRelease(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::swapUint(AtomicTypes::Uint *atomicUint,
+                                        unsigned int       swapValue)
+{
+    return Imp::swapUint(atomicUint, swapValue);
+}
+
+inline
+unsigned int AtomicOperations::swapUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                              unsigned int       swapValue)
+{
+    return Imp::swapUintAcqRel(atomicUint, swapValue);
+}
+
+inline
+unsigned int AtomicOperations::testAndSwapUint(AtomicTypes::Uint *atomicUint,
+                                               unsigned int       compareValue,
+                                               unsigned int       swapValue)
+{
+    return Imp::testAndSwapUint(atomicUint, compareValue, swapValue);
+}
+
+inline
+unsigned int AtomicOperations::testAndSwapUintAcqRel(
+                                               AtomicTypes::Uint *atomicUint,
+                                               unsigned int       compareValue,
+                                               unsigned int       swapValue)
+{
+    return Imp::testAndSwapUintAcqRel(atomicUint, compareValue, swapValue);
+}
+
+inline
+unsigned int AtomicOperations::addUintNv(AtomicTypes::Uint *atomicUint,
+                                         unsigned int       value)
+{
+    return Imp::addUintNv(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::addUintNvRelaxed(AtomicTypes::Uint *atomicUint,
+                                                unsigned int       value)
+{
+    return Imp::addUintNvRelaxed(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::addUintNvAcqRel(AtomicTypes::Uint *atomicUint,
+                                               unsigned int       value)
+{
+    return Imp::addUintNvAcqRel(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUint(AtomicTypes::Uint *atomicUint,
+                               unsigned int       value)
+{
+    Imp::addUint(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUintRelaxed(AtomicTypes::Uint *atomicUint,
+                                      unsigned int       value)
+{
+    Imp::addUintRelaxed(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                     unsigned int       value)
+{
+    Imp::addUintAcqRel(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::incrementUintNv(AtomicTypes::Uint *atomicUint)
+{
+    return Imp::incrementUintNv(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::incrementUintNvAcqRel(
+                                                 AtomicTypes::Uint *atomicUint)
+{
+    return Imp::incrementUintNvAcqRel(atomicUint);
+}
+
+inline
+void AtomicOperations::incrementUint(AtomicTypes::Uint *atomicUint)
+{
+    Imp::incrementUint(atomicUint);
+}
+
+inline
+void AtomicOperations::incrementUintAcqRel(AtomicTypes::Uint *atomicUint)
+{
+    Imp::incrementUintAcqRel(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::decrementUintNv(AtomicTypes::Uint *atomicUint)
+{
+    return Imp::decrementUintNv(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::decrementUintNvAcqRel(
+                                                 AtomicTypes::Uint *atomicUint)
+{
+    return Imp::decrementUintNvAcqRel(atomicUint);
+}
+
+inline
+void AtomicOperations::decrementUint(AtomicTypes::Uint *atomicUint)
+{
+    Imp::decrementUint(atomicUint);
+}
+
+inline
+void AtomicOperations::decrementUintAcqRel(AtomicTypes::Uint *atomicUint)
+{
+    Imp::decrementUintAcqRel(atomicUint);
+}
+
+inline
+unsigned int AtomicOperations::fetchAndUint(AtomicTypes::Uint *atomicUint,
+                                            unsigned int       value)
+{
+    return Imp::fetchAndUint(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::fetchAndUintAcqRel(
+                                                 AtomicTypes::Uint *atomicUint,
+                                                 unsigned int       value)
+{
+    return Imp::fetchAndUintAcqRel(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::fetchOrUint(AtomicTypes::Uint *atomicUint,
+                                           unsigned int       value)
+{
+    return Imp::fetchOrUint(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::fetchOrUintAcqRel(AtomicTypes::Uint *atomicUint,
+                                                 unsigned int       value)
+{
+    return Imp::fetchOrUintAcqRel(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::fetchXorUint(AtomicTypes::Uint *atomicUint,
+                                            unsigned int       value)
+{
+    return Imp::fetchXorUint(atomicUint, value);
+}
+
+inline
+unsigned int AtomicOperations::fetchXorUintAcqRel(
+                                                 AtomicTypes::Uint *atomicUint,
+                                                 unsigned int       value)
+{
+    return Imp::fetchXorUintAcqRel(atomicUint, value);
+}
+
+inline
+void AtomicOperations::initUint64(AtomicTypes::Uint64 *atomicUint,
+                                  Types::Uint64        initialValue)
+{
+    Imp::initUint64(atomicUint, initialValue);
+}
+
+inline
+Types::Uint64 AtomicOperations::getUint64(
+                                         AtomicTypes::Uint64 const *atomicUint)
+{
+    return Imp::getUint64(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::getUint64Relaxed(
+                                         AtomicTypes::Uint64 const *atomicUint)
+{
+    return Imp::getUint64Relaxed(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::getUint64Acquire(
+                                         AtomicTypes::Uint64 const *atomicUint)
+{
+    return Imp::getUint64Acquire(atomicUint);
+}
+
+inline
+void AtomicOperations::setUint64(AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64        value)
+{
+    Imp::setUint64(atomicUint, value);
+}
+
+inline
+void AtomicOperations::setUint64Relaxed(AtomicTypes::Uint64 *atomicUint,
+                                        Types::Uint64        value)
+{
+    Imp::setUint64Relaxed(atomicUint, value);
+}
+
+inline
+void AtomicOperations::setUint64Release(AtomicTypes::Uint64 *atomicUint,
+                                        Types::Uint64        value)
+{
+    Imp::setUint64Release(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::swapUint64(AtomicTypes::Uint64 *atomicUint,
+                                           Types::Uint64        swapValue)
+{
+    return Imp::swapUint64(atomicUint, swapValue);
+}
+
+inline
+Types::Uint64 AtomicOperations::swapUint64AcqRel(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        swapValue)
+{
+    return Imp::swapUint64AcqRel(atomicUint, swapValue);
+}
+
+inline
+Types::Uint64 AtomicOperations::testAndSwapUint64(
+                                             AtomicTypes::Uint64 *atomicUint,
+                                             Types::Uint64        compareValue,
+                                             Types::Uint64        swapValue)
+{
+    return Imp::testAndSwapUint64(atomicUint, compareValue, swapValue);
+}
+
+inline
+Types::Uint64 AtomicOperations::testAndSwapUint64AcqRel(
+                                             AtomicTypes::Uint64 *atomicUint,
+                                             Types::Uint64        compareValue,
+                                             Types::Uint64        swapValue)
+{
+    return Imp::testAndSwapUint64AcqRel(atomicUint, compareValue, swapValue);
+}
+
+inline
+Types::Uint64 AtomicOperations::addUint64Nv(AtomicTypes::Uint64 *atomicUint,
+                                            Types::Uint64        value)
+{
+    return Imp::addUint64Nv(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::addUint64NvRelaxed(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::addUint64NvRelaxed(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::addUint64NvAcqRel(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::addUint64NvAcqRel(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUint64(AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64        value)
+{
+    Imp::addUint64(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUint64Relaxed(AtomicTypes::Uint64 *atomicUint,
+                                        Types::Uint64        value)
+{
+    Imp::addUint64Relaxed(atomicUint, value);
+}
+
+inline
+void AtomicOperations::addUint64AcqRel(AtomicTypes::Uint64 *atomicUint,
+                                       Types::Uint64        value)
+{
+    Imp::addUint64AcqRel(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::incrementUint64Nv(
+                                               AtomicTypes::Uint64 *atomicUint)
+{
+    return Imp::incrementUint64Nv(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::incrementUint64NvAcqRel(
+                                               AtomicTypes::Uint64 *atomicUint)
+{
+    return Imp::incrementUint64NvAcqRel(atomicUint);
+}
+
+inline
+void AtomicOperations::incrementUint64(AtomicTypes::Uint64 *atomicUint)
+{
+    Imp::incrementUint64(atomicUint);
+}
+
+inline
+void AtomicOperations::incrementUint64AcqRel(AtomicTypes::Uint64 *atomicUint)
+{
+    Imp::incrementUint64AcqRel(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::decrementUint64Nv(
+                                               AtomicTypes::Uint64 *atomicUint)
+{
+    return Imp::decrementUint64Nv(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::decrementUint64NvAcqRel(
+                                               AtomicTypes::Uint64 *atomicUint)
+{
+    return Imp::decrementUint64NvAcqRel(atomicUint);
+}
+
+inline
+void AtomicOperations::decrementUint64(AtomicTypes::Uint64 *atomicUint)
+{
+    Imp::decrementUint64(atomicUint);
+}
+
+inline
+void AtomicOperations::decrementUint64AcqRel(AtomicTypes::Uint64 *atomicUint)
+{
+    Imp::decrementUint64AcqRel(atomicUint);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchAndUint64(AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::fetchAndUint64(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchAndUint64AcqRel(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::fetchAndUint64AcqRel(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchOrUint64(AtomicTypes::Uint64 *atomicUint,
+                                              Types::Uint64        value)
+{
+    return Imp::fetchOrUint64(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchOrUint64AcqRel(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::fetchOrUint64AcqRel(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchXorUint64(AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::fetchXorUint64(atomicUint, value);
+}
+
+inline
+Types::Uint64 AtomicOperations::fetchXorUint64AcqRel(
+                                               AtomicTypes::Uint64 *atomicUint,
+                                               Types::Uint64        value)
+{
+    return Imp::fetchXorUint64AcqRel(atomicUint, value);
+}
+
 inline
 void AtomicOperations::initPointer(AtomicTypes::Pointer *atomicPtr,
                                    void                 *initialValue)
@@ -1504,6 +2548,62 @@ void *AtomicOperations::testAndSwapPtrAcqRel(
     return Imp::testAndSwapPtrAcqRel(atomicPtr, compareValue, swapValue);
 }
 
+inline
+void AtomicOperations::initUint128(AtomicTypes::Uint128 *atomicValue,
+                                   Types::Uint64         initialLow,
+                                   Types::Uint64         initialHigh)
+{
+    Imp::initUint128(atomicValue, initialLow, initialHigh);
+}
+
+inline
+void AtomicOperations::getUint128(AtomicTypes::Uint128 const *atomicValue,
+                                  Types::Uint64              *low,
+                                  Types::Uint64              *high)
+{
+    Imp::getUint128(atomicValue, low, high);
+}
+
+inline
+void AtomicOperations::setUint128(AtomicTypes::Uint128 *atomicValue,
+                                  Types::Uint64         low,
+                                  Types::Uint64         high)
+{
+    Imp::setUint128(atomicValue, low, high);
+}
+
+inline
+bool AtomicOperations::testAndSwapUint128(AtomicTypes::Uint128 *atomicValue,
+                                          Types::Uint64        *compareLow,
+                                          Types::Uint64        *compareHigh,
+                                          Types::Uint64         swapLow,
+                                          Types::Uint64         swapHigh)
+{
+    return Imp::testAndSwapUint128(atomicValue,
+                                   compareLow,
+                                   compareHigh,
+                                   swapLow,
+                                   swapHigh);
+}
+
+inline
+void AtomicOperations::threadFence()
+{
+    Imp::threadFence();
+}
+
+inline
+void AtomicOperations::threadFenceAcquire()
+{
+    Imp::threadFenceAcquire();
+}
+
+inline
+void AtomicOperations::threadFenceRelease()
+{
+    Imp::threadFenceRelease();
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -58,6 +58,41 @@ using namespace std;
 // [2 ] setPtr(Pointer *aPointer, void *value);
 // [4 ] swapPtr(Pointer *aPointer, void *value);
 // [4 ] testAndSwapPtr(Pointer *, void *, void *);
+// [13] fetchAndInt(Int *, int);
+// [13] fetchOrInt(Int *, int);
+// [13] fetchXorInt(Int *, int);
+// [13] fetchAndInt64(Int64 *, Int64);
+// [13] fetchOrInt64(Int64 *, Int64);
+// [13] fetchXorInt64(Int64 *, Int64);
+// [14] initUint(Uint *, unsigned int);
+// [14] getUint(const Uint *);
+// [14] setUint(Uint *, unsigned int);
+// [14] swapUint(Uint *, unsigned int);
+// [14] testAndSwapUint(Uint *, unsigned int, unsigned int);
+// [14] addUintNv(Uint *, unsigned int);
+// [14] incrementUintNv(Uint *);
+// [14] decrementUintNv(Uint *);
+// [14] fetchAndUint(Uint *, unsigned int);
+// [14] fetchOrUint(Uint *, unsigned int);
+// [14] fetchXorUint(Uint *, unsigned int);
+// [14] initUint64(Uint64 *, Uint64);
+// [14] getUint64(const Uint64 *);
+// [14] setUint64(Uint64 *, Uint64);
+// [14] swapUint64(Uint64 *, Uint64);
+// [14] testAndSwapUint64(Uint64 *, Uint64, Uint64);
+// [14] addUint64Nv(Uint64 *, Uint64);
+// [14] incrementUint64Nv(Uint64 *);
+// [14] decrementUint64Nv(Uint64 *);
+// [14] fetchAndUint64(Uint64 *, Uint64);
+// [14] fetchOrUint64(Uint64 *, Uint64);
+// [14] fetchXorUint64(Uint64 *, Uint64);
+// [15] initUint128(Uint128 *, Uint64, Uint64);
+// [15] getUint128(const Uint128 *, Uint64 *, Uint64 *);
+// [15] setUint128(Uint128 *, Uint64, Uint64);
+// [15] testAndSwapUint128(Uint128 *, Uint64 *, Uint64 *, Uint64, Uint64);
+// [15] threadFence();
+// [15] threadFenceAcquire();
+// [15] threadFenceRelease();
 //-----------------------------------------------------------------------------
 // [1 ] Breathing test
 // [7 ] Usage examples
@@ -1150,6 +1185,120 @@ static void* testAndSwapPtrAcqRelTestThread(void *ptr)
     return ptr;
 }
 
+struct Case13
+{
+    Types::Int   *d_int_p;
+    Types::Int64 *d_int64_p;
+    int           d_bit;
+    int           d_iterations;
+};
+
+static void* case13Thread(void* ptr)
+    // Repeatedly set, clear, and toggle the bit owned by the thread
+    // described by the 'Case13' object at the specified 'ptr', verifying that
+    // the previous values returned by the bitwise operations are consistent
+    // with the thread being the only one modifying that bit.
+{
+    Case13 *args = (Case13*) ptr;
+
+    const int                MASK   = 1 << args->d_bit;
+    const bsls::Types::Int64 MASK64 = 1LL << (args->d_bit * 2 + 1);
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        int prev = Obj::fetchOrInt(args->d_int_p, MASK);
+        LOOP2_ASSERT(prev, MASK, 0 == (prev & MASK));
+        prev = Obj::fetchXorIntAcqRel(args->d_int_p, MASK);
+        LOOP2_ASSERT(prev, MASK, MASK == (prev & MASK));
+        prev = Obj::fetchXorInt(args->d_int_p, MASK);
+        LOOP2_ASSERT(prev, MASK, 0 == (prev & MASK));
+        prev = Obj::fetchAndIntAcqRel(args->d_int_p, ~MASK);
+        LOOP2_ASSERT(prev, MASK, MASK == (prev & MASK));
+
+        bsls::Types::Int64 prev64 = Obj::fetchOrInt64AcqRel(args->d_int64_p,
+                                                            MASK64);
+        LOOP_ASSERT(prev64, 0 == (prev64 & MASK64));
+        prev64 = Obj::fetchXorInt64(args->d_int64_p, MASK64);
+        LOOP_ASSERT(prev64, MASK64 == (prev64 & MASK64));
+        prev64 = Obj::fetchXorInt64AcqRel(args->d_int64_p, MASK64);
+        LOOP_ASSERT(prev64, 0 == (prev64 & MASK64));
+        prev64 = Obj::fetchAndInt64(args->d_int64_p, ~MASK64);
+        LOOP_ASSERT(prev64, MASK64 == (prev64 & MASK64));
+    }
+    return ptr;
+}
+
+struct Case15
+{
+    Types::Uint128 *d_value_p;
+    Types::Int     *d_flag_p;
+    Types::Int     *d_data_p;
+    int             d_iterations;
+};
+
+static void* case15CasThread(void* ptr)
+    // Atomically increment both words of the 128-bit value described by the
+    // 'Case15' object at the specified 'ptr' using a compare-and-swap loop,
+    // verifying that the two words are always observed to be equal.
+{
+    Case15 *args = (Case15*) ptr;
+
+    for (int i = 0; i < args->d_iterations; ++i) {
+        bsls::Types::Uint64 low, high;
+        Obj::getUint128(args->d_value_p, &low, &high);
+        LOOP2_ASSERT(low, high, low == high);
+
+        while (!Obj::testAndSwapUint128(args->d_value_p,
+                                        &low,
+                                        &high,
+                                        low + 1,
+                                        high + 1)) {
+            LOOP2_ASSERT(low, high, low == high);
+        }
+    }
+    return ptr;
+}
+
+static void* case15ProducerThread(void* ptr)
+    // Publish a sequence of values through the data and flag words described
+    // by the 'Case15' object at the specified 'ptr', using relaxed stores
+    // ordered by release fences.
+{
+    Case15 *args = (Case15*) ptr;
+
+    for (int i = 1; i <= args->d_iterations; ++i) {
+        while (Obj::getIntRelaxed(args->d_flag_p)) {
+        }
+        Obj::threadFenceAcquire();
+
+        Obj::setIntRelaxed(args->d_data_p, i);
+        Obj::threadFenceRelease();
+        Obj::setIntRelaxed(args->d_flag_p, 1);
+    }
+    return ptr;
+}
+
+static void* case15ConsumerThread(void* ptr)
+    // Consume the sequence of values published by 'case15ProducerThread'
+    // through the data and flag words described by the 'Case15' object at the
+    // specified 'ptr', using relaxed loads ordered by acquire fences, and
+    // verify that the values are observed in order.
+{
+    Case15 *args = (Case15*) ptr;
+
+    for (int i = 1; i <= args->d_iterations; ++i) {
+        while (!Obj::getIntRelaxed(args->d_flag_p)) {
+        }
+        Obj::threadFenceAcquire();
+
+        const int data = Obj::getIntRelaxed(args->d_data_p);
+        LOOP2_ASSERT(i, data, i == data);
+
+        Obj::threadFence();
+        Obj::setIntRelaxed(args->d_flag_p, 0);
+    }
+    return ptr;
+}
+
 }
 
 //=============================================================================
@@ -1620,6 +1769,583 @@ int main(int argc, char *argv[]) {
 #endif
 
     switch (test) { case 0:
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 128-BIT OPERATIONS AND MEMORY FENCES
+        //
+        // Concerns:
+        //: 1 'initUint128' sets both words of the value.
+        //:
+        //: 2 'testAndSwapUint128' sets the value if and only if both words
+        //:   are equal to the compare words, loads the initial value into the
+        //:   compare words, and returns 'true' if and only if the value was
+        //:   set.
+        //:
+        //: 3 'getUint128' and 'setUint128' load and store both words.
+        //:
+        //: 4 The 128-bit operations are atomic: concurrent read-modify-write
+        //:   loops never observe a torn value and never lose an update.
+        //:
+        //: 5 Relaxed accesses ordered by the fences are observed in order by
+        //:   another thread.
+        //
+        // Plan:
+        //: 1 Using a table of values, initialize a 128-bit value, and verify
+        //:   the results of 'getUint128', 'setUint128' and
+        //:   'testAndSwapUint128' for compare words differing from the value
+        //:   in neither, one, or both words.  (C-1..3)
+        //:
+        //: 2 Start several threads, each incrementing both words of a shared
+        //:   value in a compare-and-swap loop, and verify that the two words
+        //:   are always equal, and that the final value reflects every
+        //:   increment.  (C-4)
+        //:
+        //: 3 Pass a sequence of values from one thread to another using
+        //:   relaxed loads and stores ordered only by the fences, and verify
+        //:   that each value is received.  (C-5)
+        //
+        // Testing:
+        //   initUint128(Uint128 *, Uint64, Uint64);
+        //   getUint128(const Uint128 *, Uint64 *, Uint64 *);
+        //   setUint128(Uint128 *, Uint64, Uint64);
+        //   testAndSwapUint128(Uint128 *, Uint64 *, Uint64 *, Uint64, Uint64);
+        //   threadFence();
+        //   threadFenceAcquire();
+        //   threadFenceRelease();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 128-BIT OPERATIONS AND MEMORY FENCES"
+                          << "\n============================================"
+                          << endl;
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        if (verbose) cout << "\nTesting single-threaded semantics" << endl;
+        {
+            static const struct {
+                int    d_lineNum;  // source line number
+                Uint64 d_low;      // low word
+                Uint64 d_high;     // high word
+            } VALUES[] = {
+                //line  low                    high
+                //----  ---------------------  ---------------------
+                { L_,   0,                     0                     },
+                { L_,   1,                     0                     },
+                { L_,   0,                     1                     },
+                { L_,   0xFFFFFFFFFFFFFFFFULL, 0                     },
+                { L_,   0,                     0xFFFFFFFFFFFFFFFFULL },
+                { L_,   0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL },
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int    LINE = VALUES[i].d_lineNum;
+                const Uint64 LOW  = VALUES[i].d_low;
+                const Uint64 HIGH = VALUES[i].d_high;
+
+                Types::Uint128 x;  const Types::Uint128& X = x;
+
+                Uint64 low, high;
+
+                Obj::initUint128(&x);
+                Obj::getUint128(&X, &low, &high);
+                LOOP_ASSERT(LINE, 0 == low && 0 == high);
+
+                Obj::initUint128(&x, LOW, HIGH);
+                Obj::getUint128(&X, &low, &high);
+                LOOP_ASSERT(LINE, LOW == low && HIGH == high);
+
+                // Mismatch in the low word, the high word, and both.
+
+                for (int j = 0; j < 3; ++j) {
+                    low  = j & 1 ? LOW  : LOW  + 1;
+                    high = j & 2 ? HIGH : HIGH + 1;
+                    LOOP2_ASSERT(LINE, j, !Obj::testAndSwapUint128(&x,
+                                                                   &low,
+                                                                   &high,
+                                                                   7,
+                                                                   8));
+                    LOOP2_ASSERT(LINE, j, LOW == low && HIGH == high);
+
+                    Obj::getUint128(&X, &low, &high);
+                    LOOP2_ASSERT(LINE, j, LOW == low && HIGH == high);
+                }
+
+                low  = LOW;
+                high = HIGH;
+                LOOP_ASSERT(LINE, Obj::testAndSwapUint128(&x,
+                                                          &low,
+                                                          &high,
+                                                          HIGH,
+                                                          LOW));
+                LOOP_ASSERT(LINE, LOW == low && HIGH == high);
+
+                Obj::getUint128(&X, &low, &high);
+                LOOP_ASSERT(LINE, HIGH == low && LOW == high);
+
+                Obj::setUint128(&x, LOW, HIGH);
+                Obj::getUint128(&X, &low, &high);
+                LOOP_ASSERT(LINE, LOW == low && HIGH == high);
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent compare-and-swap" << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 100000 };
+
+            Types::Uint128 value;
+            Obj::initUint128(&value, 0, 0);
+
+            Case15 args;
+            args.d_value_p    = &value;
+            args.d_iterations = k_NUM_ITERATIONS;
+
+            my_thread_t threads[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = myCreateThread(&threads[i], case15CasThread, &args);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                myJoinThread(threads[i]);
+            }
+
+            Uint64 low, high;
+            Obj::getUint128(&value, &low, &high);
+            LOOP_ASSERT(low, k_NUM_THREADS * k_NUM_ITERATIONS == low);
+            LOOP_ASSERT(high, k_NUM_THREADS * k_NUM_ITERATIONS == high);
+        }
+
+        if (verbose) cout << "\nTesting memory fences" << endl;
+        {
+            Obj::threadFence();
+            Obj::threadFenceAcquire();
+            Obj::threadFenceRelease();
+
+            Types::Int flag;
+            Types::Int data;
+            Obj::initInt(&flag, 0);
+            Obj::initInt(&data, 0);
+
+            Case15 args;
+            args.d_flag_p     = &flag;
+            args.d_data_p     = &data;
+            args.d_iterations = 1000;
+
+            my_thread_t producer, consumer;
+            ASSERT(0 == myCreateThread(&producer,
+                                       case15ProducerThread,
+                                       &args));
+            ASSERT(0 == myCreateThread(&consumer,
+                                       case15ConsumerThread,
+                                       &args));
+            myJoinThread(producer);
+            myJoinThread(consumer);
+
+            ASSERT(args.d_iterations == Obj::getInt(&data));
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING UNSIGNED INTEGER OPERATIONS
+        //
+        // Concerns:
+        //: 1 The 'Uint' and 'Uint64' operations store and load the full range
+        //:   of unsigned values.
+        //:
+        //: 2 Arithmetic wraps modulo 2 to the power of the number of bits in
+        //:   the type.
+        //:
+        //: 3 The swap, test-and-swap, and bitwise operations return the
+        //:   previous value, and set the expected value.
+        //:
+        //: 4 The increment and decrement operations are atomic.
+        //
+        // Plan:
+        //: 1 For a table of values, exercise each operation in every memory
+        //:   ordering variant, and verify the returned and resulting values
+        //:   against the values computed using unsigned arithmetic.
+        //:   (C-1..3)
+        //:
+        //: 2 Start several threads incrementing and decrementing a shared
+        //:   value, and verify the final value.  (C-4)
+        //
+        // Testing:
+        //   initUint(Uint *, unsigned int);
+        //   getUint(const Uint *);
+        //   getUintRelaxed(const Uint *);
+        //   getUintAcquire(const Uint *);
+        //   setUint(Uint *, unsigned int);
+        //   setUintRelaxed(Uint *, unsigned int);
+        //   setUintRelease(Uint *, unsigned int);
+        //   swapUint(Uint *, unsigned int);
+        //   swapUintAcqRel(Uint *, unsigned int);
+        //   testAndSwapUint(Uint *, unsigned int, unsigned int);
+        //   testAndSwapUintAcqRel(Uint *, unsigned int, unsigned int);
+        //   addUint(Uint *, unsigned int);
+        //   addUintRelaxed(Uint *, unsigned int);
+        //   addUintAcqRel(Uint *, unsigned int);
+        //   addUintNv(Uint *, unsigned int);
+        //   addUintNvRelaxed(Uint *, unsigned int);
+        //   addUintNvAcqRel(Uint *, unsigned int);
+        //   incrementUint(Uint *);
+        //   incrementUintAcqRel(Uint *);
+        //   incrementUintNv(Uint *);
+        //   incrementUintNvAcqRel(Uint *);
+        //   decrementUint(Uint *);
+        //   decrementUintAcqRel(Uint *);
+        //   decrementUintNv(Uint *);
+        //   decrementUintNvAcqRel(Uint *);
+        //   fetchAndUint(Uint *, unsigned int);
+        //   fetchAndUintAcqRel(Uint *, unsigned int);
+        //   fetchOrUint(Uint *, unsigned int);
+        //   fetchOrUintAcqRel(Uint *, unsigned int);
+        //   fetchXorUint(Uint *, unsigned int);
+        //   fetchXorUintAcqRel(Uint *, unsigned int);
+        //   [the same operations for 'Uint64']
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING UNSIGNED INTEGER OPERATIONS"
+                          << "\n==================================="
+                          << endl;
+
+        if (verbose) cout << "\nTesting 'Uint'" << endl;
+        {
+            typedef unsigned int T;
+
+            static const struct {
+                int d_lineNum;  // source line number
+                T   d_value;    // initial value
+                T   d_operand;  // operand
+            } VALUES[] = {
+                //line  value        operand
+                //----  -----------  -----------
+                { L_,   0,           0           },
+                { L_,   0,           1           },
+                { L_,   1,           0xFFFFFFFFU },
+                { L_,   0xFFFFFFFFU, 1           },
+                { L_,   0x80000000U, 0x80000000U },
+                { L_,   0x12345678U, 0x0F0F0F0FU },
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int LINE = VALUES[i].d_lineNum;
+                const T   V    = VALUES[i].d_value;
+                const T   OP   = VALUES[i].d_operand;
+
+                Types::Uint x;  const Types::Uint& X = x;
+
+                Obj::initUint(&x);
+                LOOP_ASSERT(LINE, 0 == Obj::getUint(&X));
+
+                Obj::initUint(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::getUint(&X));
+                LOOP_ASSERT(LINE, V == Obj::getUintRelaxed(&X));
+                LOOP_ASSERT(LINE, V == Obj::getUintAcquire(&X));
+
+                Obj::setUint(&x, OP);
+                LOOP_ASSERT(LINE, OP == Obj::getUint(&X));
+                Obj::setUintRelaxed(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::getUint(&X));
+                Obj::setUintRelease(&x, OP);
+                LOOP_ASSERT(LINE, OP == Obj::getUint(&X));
+
+                LOOP_ASSERT(LINE, OP == Obj::swapUint(&x, V));
+                LOOP_ASSERT(LINE, V  == Obj::swapUintAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, OP == Obj::getUint(&X));
+
+                LOOP_ASSERT(LINE, OP == Obj::testAndSwapUint(&x, OP + 1, V));
+                LOOP_ASSERT(LINE, OP == Obj::getUint(&X));
+                LOOP_ASSERT(LINE, OP == Obj::testAndSwapUint(&x, OP, V));
+                LOOP_ASSERT(LINE, V  == Obj::getUint(&X));
+                LOOP_ASSERT(LINE, V  == Obj::testAndSwapUintAcqRel(&x,
+                                                                   V,
+                                                                   OP));
+                LOOP_ASSERT(LINE, OP == Obj::getUint(&X));
+
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, T(V + OP) == Obj::addUintNv(&x, OP));
+                LOOP_ASSERT(LINE, T(V + 2 * OP) ==
+                                             Obj::addUintNvRelaxed(&x, OP));
+                LOOP_ASSERT(LINE, T(V + 3 * OP) ==
+                                              Obj::addUintNvAcqRel(&x, OP));
+                Obj::addUint(&x, OP);
+                Obj::addUintRelaxed(&x, OP);
+                Obj::addUintAcqRel(&x, OP);
+                LOOP_ASSERT(LINE, T(V + 6 * OP) == Obj::getUint(&X));
+
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, T(V + 1) == Obj::incrementUintNv(&x));
+                LOOP_ASSERT(LINE, T(V + 2) == Obj::incrementUintNvAcqRel(&x));
+                Obj::incrementUint(&x);
+                Obj::incrementUintAcqRel(&x);
+                LOOP_ASSERT(LINE, T(V + 4) == Obj::getUint(&X));
+                LOOP_ASSERT(LINE, T(V + 3) == Obj::decrementUintNv(&x));
+                LOOP_ASSERT(LINE, T(V + 2) == Obj::decrementUintNvAcqRel(&x));
+                Obj::decrementUint(&x);
+                Obj::decrementUintAcqRel(&x);
+                LOOP_ASSERT(LINE, V == Obj::getUint(&X));
+
+                LOOP_ASSERT(LINE, V == Obj::fetchAndUint(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getUint(&X));
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchAndUintAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getUint(&X));
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrUint(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getUint(&X));
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrUintAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getUint(&X));
+                Obj::setUint(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchXorUint(&x, OP));
+                LOOP_ASSERT(LINE, (V ^ OP) == Obj::getUint(&X));
+                LOOP_ASSERT(LINE, (V ^ OP) == Obj::fetchXorUintAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, V == Obj::getUint(&X));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'Uint64'" << endl;
+        {
+            typedef bsls::Types::Uint64 T;
+
+            static const struct {
+                int d_lineNum;  // source line number
+                T   d_value;    // initial value
+                T   d_operand;  // operand
+            } VALUES[] = {
+                //line  value                  operand
+                //----  ---------------------  ---------------------
+                { L_,   0,                     0                     },
+                { L_,   0,                     1                     },
+                { L_,   1,                     0xFFFFFFFFFFFFFFFFULL },
+                { L_,   0xFFFFFFFFFFFFFFFFULL, 1                     },
+                { L_,   0x00000000FFFFFFFFULL, 1                     },
+                { L_,   0x8000000000000000ULL, 0x8000000000000000ULL },
+                { L_,   0x0123456789ABCDEFULL, 0x0F0F0F0F0F0F0F0FULL },
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int LINE = VALUES[i].d_lineNum;
+                const T   V    = VALUES[i].d_value;
+                const T   OP   = VALUES[i].d_operand;
+
+                Types::Uint64 x;  const Types::Uint64& X = x;
+
+                Obj::initUint64(&x);
+                LOOP_ASSERT(LINE, 0 == Obj::getUint64(&X));
+
+                Obj::initUint64(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::getUint64(&X));
+                LOOP_ASSERT(LINE, V == Obj::getUint64Relaxed(&X));
+                LOOP_ASSERT(LINE, V == Obj::getUint64Acquire(&X));
+
+                Obj::setUint64(&x, OP);
+                LOOP_ASSERT(LINE, OP == Obj::getUint64(&X));
+                Obj::setUint64Relaxed(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::getUint64(&X));
+                Obj::setUint64Release(&x, OP);
+                LOOP_ASSERT(LINE, OP == Obj::getUint64(&X));
+
+                LOOP_ASSERT(LINE, OP == Obj::swapUint64(&x, V));
+                LOOP_ASSERT(LINE, V  == Obj::swapUint64AcqRel(&x, OP));
+                LOOP_ASSERT(LINE, OP == Obj::getUint64(&X));
+
+                LOOP_ASSERT(LINE, OP == Obj::testAndSwapUint64(&x, OP + 1, V));
+                LOOP_ASSERT(LINE, OP == Obj::getUint64(&X));
+                LOOP_ASSERT(LINE, OP == Obj::testAndSwapUint64(&x, OP, V));
+                LOOP_ASSERT(LINE, V  == Obj::getUint64(&X));
+                LOOP_ASSERT(LINE, V  == Obj::testAndSwapUint64AcqRel(&x,
+                                                                     V,
+                                                                     OP));
+                LOOP_ASSERT(LINE, OP == Obj::getUint64(&X));
+
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, T(V + OP) == Obj::addUint64Nv(&x, OP));
+                LOOP_ASSERT(LINE, T(V + 2 * OP) ==
+                                           Obj::addUint64NvRelaxed(&x, OP));
+                LOOP_ASSERT(LINE, T(V + 3 * OP) ==
+                                            Obj::addUint64NvAcqRel(&x, OP));
+                Obj::addUint64(&x, OP);
+                Obj::addUint64Relaxed(&x, OP);
+                Obj::addUint64AcqRel(&x, OP);
+                LOOP_ASSERT(LINE, T(V + 6 * OP) == Obj::getUint64(&X));
+
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, T(V + 1) == Obj::incrementUint64Nv(&x));
+                LOOP_ASSERT(LINE, T(V + 2) ==
+                                           Obj::incrementUint64NvAcqRel(&x));
+                Obj::incrementUint64(&x);
+                Obj::incrementUint64AcqRel(&x);
+                LOOP_ASSERT(LINE, T(V + 4) == Obj::getUint64(&X));
+                LOOP_ASSERT(LINE, T(V + 3) == Obj::decrementUint64Nv(&x));
+                LOOP_ASSERT(LINE, T(V + 2) ==
+                                           Obj::decrementUint64NvAcqRel(&x));
+                Obj::decrementUint64(&x);
+                Obj::decrementUint64AcqRel(&x);
+                LOOP_ASSERT(LINE, V == Obj::getUint64(&X));
+
+                LOOP_ASSERT(LINE, V == Obj::fetchAndUint64(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getUint64(&X));
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchAndUint64AcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getUint64(&X));
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrUint64(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getUint64(&X));
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrUint64AcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getUint64(&X));
+                Obj::setUint64(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchXorUint64(&x, OP));
+                LOOP_ASSERT(LINE, (V ^ OP) == Obj::getUint64(&X));
+                LOOP_ASSERT(LINE, (V ^ OP) ==
+                                           Obj::fetchXorUint64AcqRel(&x, OP));
+                LOOP_ASSERT(LINE, V == Obj::getUint64(&X));
+            }
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE OPERATIONS
+        //
+        // Concerns:
+        //: 1 The 'fetchAnd', 'fetchOr', and 'fetchXor' operations on 'Int'
+        //:   and 'Int64' set the value to the bitwise combination of the
+        //:   value and the operand, and return the previous value.
+        //:
+        //: 2 Concurrent bitwise operations on different bits of the same
+        //:   value do not interfere with each other.
+        //
+        // Plan:
+        //: 1 For a table of values and operands, apply each operation in
+        //:   each memory ordering variant, and verify the returned and the
+        //:   resulting values.  (C-1)
+        //:
+        //: 2 Start several threads, each repeatedly setting, toggling, and
+        //:   clearing its own bit in shared 'Int' and 'Int64' values, and
+        //:   verify the previous values returned, and that the final values
+        //:   are 0.  (C-2)
+        //
+        // Testing:
+        //   fetchAndInt(Int *, int);
+        //   fetchAndIntAcqRel(Int *, int);
+        //   fetchOrInt(Int *, int);
+        //   fetchOrIntAcqRel(Int *, int);
+        //   fetchXorInt(Int *, int);
+        //   fetchXorIntAcqRel(Int *, int);
+        //   fetchAndInt64(Int64 *, Int64);
+        //   fetchAndInt64AcqRel(Int64 *, Int64);
+        //   fetchOrInt64(Int64 *, Int64);
+        //   fetchOrInt64AcqRel(Int64 *, Int64);
+        //   fetchXorInt64(Int64 *, Int64);
+        //   fetchXorInt64AcqRel(Int64 *, Int64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BITWISE OPERATIONS"
+                          << "\n=========================="
+                          << endl;
+
+        typedef bsls::Types::Int64 Int64;
+
+        if (verbose) cout << "\nTesting single-threaded semantics" << endl;
+        {
+            static const struct {
+                int   d_lineNum;  // source line number
+                Int64 d_value;    // initial value
+                Int64 d_operand;  // operand
+            } VALUES[] = {
+                //line  value                 operand
+                //----  --------------------  --------------------
+                { L_,   0,                    0                    },
+                { L_,   0,                    -1                   },
+                { L_,   -1,                   0                    },
+                { L_,   -1,                   -1                   },
+                { L_,   0x00FF00FF00FF00FFLL, 0x0F0F0F0F0F0F0F0FLL },
+                { L_,   0x7FFFFFFF00000001LL, 0x0000000180000000LL },
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int   LINE = VALUES[i].d_lineNum;
+                const Int64 V64  = VALUES[i].d_value;
+                const Int64 OP64 = VALUES[i].d_operand;
+                const int   V    = static_cast<int>(V64);
+                const int   OP   = static_cast<int>(OP64);
+
+                Types::Int x;  const Types::Int& X = x;
+
+                Obj::initInt(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchAndInt(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getInt(&X));
+                Obj::setInt(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchAndIntAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V & OP) == Obj::getInt(&X));
+                Obj::setInt(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrInt(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getInt(&X));
+                Obj::setInt(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchOrIntAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, (V | OP) == Obj::getInt(&X));
+                Obj::setInt(&x, V);
+                LOOP_ASSERT(LINE, V == Obj::fetchXorInt(&x, OP));
+                LOOP_ASSERT(LINE, (V ^ OP) == Obj::getInt(&X));
+                LOOP_ASSERT(LINE, (V ^ OP) == Obj::fetchXorIntAcqRel(&x, OP));
+                LOOP_ASSERT(LINE, V == Obj::getInt(&X));
+
+                Types::Int64 y;  const Types::Int64& Y = y;
+
+                Obj::initInt64(&y, V64);
+                LOOP_ASSERT(LINE, V64 == Obj::fetchAndInt64(&y, OP64));
+                LOOP_ASSERT(LINE, (V64 & OP64) == Obj::getInt64(&Y));
+                Obj::setInt64(&y, V64);
+                LOOP_ASSERT(LINE, V64 == Obj::fetchAndInt64AcqRel(&y, OP64));
+                LOOP_ASSERT(LINE, (V64 & OP64) == Obj::getInt64(&Y));
+                Obj::setInt64(&y, V64);
+                LOOP_ASSERT(LINE, V64 == Obj::fetchOrInt64(&y, OP64));
+                LOOP_ASSERT(LINE, (V64 | OP64) == Obj::getInt64(&Y));
+                Obj::setInt64(&y, V64);
+                LOOP_ASSERT(LINE, V64 == Obj::fetchOrInt64AcqRel(&y, OP64));
+                LOOP_ASSERT(LINE, (V64 | OP64) == Obj::getInt64(&Y));
+                Obj::setInt64(&y, V64);
+                LOOP_ASSERT(LINE, V64 == Obj::fetchXorInt64(&y, OP64));
+                LOOP_ASSERT(LINE, (V64 ^ OP64) == Obj::getInt64(&Y));
+                LOOP_ASSERT(LINE, (V64 ^ OP64) ==
+                                          Obj::fetchXorInt64AcqRel(&y, OP64));
+                LOOP_ASSERT(LINE, V64 == Obj::getInt64(&Y));
+            }
+        }
+
+        if (verbose) cout << "\nTesting concurrent bitwise operations"
+                          << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 50000 };
+
+            Types::Int   value;
+            Types::Int64 value64;
+            Obj::initInt(&value, 0);
+            Obj::initInt64(&value64, 0);
+
+            Case13      args[k_NUM_THREADS];
+            my_thread_t threads[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_int_p      = &value;
+                args[i].d_int64_p    = &value64;
+                args[i].d_bit        = i * 3;
+                args[i].d_iterations = k_NUM_ITERATIONS;
+
+                int rc = myCreateThread(&threads[i], case13Thread, &args[i]);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                myJoinThread(threads[i]);
+            }
+
+            ASSERT(0 == Obj::getInt(&value));
+            ASSERT(0 == Obj::getInt64(&value64));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING GET/SET ACQUIRE/RELEASE MANIPULATORS:
@@ -12,6 +12,10 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bsls::AtomicOperations_DefaultInt: defaults for atomic operations on int
 //  bsls::AtomicOperations_DefaultInt64: defaults for Int64
+//  bsls::AtomicOperations_DefaultUint: defaults for atomic operations on uint
+//  bsls::AtomicOperations_DefaultUint64: defaults for Uint64
+//  bsls::AtomicOperations_DefaultUint128: defaults for 128-bit unsigned int
+//  bsls::AtomicOperations_DefaultFence: defaults for memory fences
 //  bsls::AtomicOperations_DefaultPointer32: defaults for 32-bit pointer
 //  bsls::AtomicOperations_DefaultPointer64: defaults for 64-bit pointer
 //  bsls::AtomicOperations_Default32: all atomics for a generic 32-bit platform
@@ -138,9 +142,19 @@ BSLS_IDENT("$Id: $")
 // classes:
 //: o bsls::AtomicOperations_DefaultInt - provides atomic operations for int
 //: o bsls::AtomicOperations_DefaultInt64 - for Int64
+//: o bsls::AtomicOperations_DefaultUint - for unsigned int
+//: o bsls::AtomicOperations_DefaultUint64 - for Uint64
+//: o bsls::AtomicOperations_DefaultUint128 - for 128-bit unsigned integer
+//: o bsls::AtomicOperations_DefaultFence - for memory fences
 //: o bsls::AtomicOperations_DefaultPointer32 - for 32-bit pointer
 //: o bsls::AtomicOperations_DefaultPointer64 - for 64-bit pointer
 //
+// The operations on unsigned integers are implemented in terms of the
+// operations on the signed integers of the same size, and the 128-bit
+// operations are emulated using a set of spin locks, unless a platform
+// provides a native implementation.  The default memory fences are
+// implemented using a sequentially consistent atomic exchange.
+//
 // The platform-specific core atomic operations are left unimplemented in these
 // default implementation classes.  The implementations for those operations
 // have to be provided by a platform-specific derived classes.
@@ -158,10 +172,18 @@ BSLS_IDENT("$Id: $")
 // This is how the generic platform base classes are composed:
 //: o bsls::AtomicOperations_Default32 : AtomicOperations_DefaultInt,
 //:                                      AtomicOperations_DefaultInt64,
-//:                                      AtomicOperations_DefaultPointer32
+//:                                      AtomicOperations_DefaultUint,
+//:                                      AtomicOperations_DefaultUint64,
+//:                                      AtomicOperations_DefaultUint128,
+//:                                      AtomicOperations_DefaultPointer32,
+//:                                      AtomicOperations_DefaultFence
 //: o bsls::AtomicOperations_Default64 : AtomicOperations_DefaultInt,
 //:                                      AtomicOperations_DefaultInt64,
-//:                                      AtomicOperations_DefaultPointer64
+//:                                      AtomicOperations_DefaultUint,
+//:                                      AtomicOperations_DefaultUint64,
+//:                                      AtomicOperations_DefaultUint128,
+//:                                      AtomicOperations_DefaultPointer64,
+//:                                      AtomicOperations_DefaultFence
 //
 // A typical derived class implementing platform-specific atomic operations
 // needs to derive from either 'bsls::AtomicOperations_Default32' (if the
@@ -218,7 +240,9 @@ BSLS_IDENT("$Id: $")
 // brevity):
 //..
 //  DefaultPointer32      DefaultInt         DefaultInt64    DefaultPointer64
-//          ^                  ^                   ^                 ^
+//          ^             DefaultUint        DefaultUint64           ^
+//          |             DefaultFence       DefaultUint128          |
+//          |                  ^                   ^                 |
 //          |                  |                   |                 |
 //          +---------------+  +-------------------+  +--------------+
 //                          |  |                   |  |
@@ -269,6 +293,25 @@ BSLS_IDENT("$Id: $")
 //                    __attribute__((__aligned__(sizeof(bsls::Types::Int64))));
 //      };
 //
+//      struct Uint
+//      {
+//          volatile unsigned int d_value
+//                          __attribute__((__aligned__(sizeof(unsigned int))));
+//      };
+//
+//      struct Uint64
+//      {
+//          volatile bsls::Types::Uint64 d_value
+//                   __attribute__((__aligned__(sizeof(bsls::Types::Uint64))));
+//      };
+//
+//      struct Uint128
+//      {
+//          // 'd_value[0]' is the low word; 'd_value[1]' the high word.
+//          volatile bsls::Types::Uint64 d_value[2]
+//                                            __attribute__((__aligned__(16)));
+//      };
+//
 //      struct Pointer
 //      {
 //          void * volatile d_value
@@ -375,6 +418,21 @@ struct AtomicOperations_DefaultInt
     static void decrementInt(typename AtomicTypes::Int *atomicInt);
 
     static void decrementIntAcqRel(typename AtomicTypes::Int *atomicInt);
+
+    static int fetchAndInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int                        value);
+
+    static int fetchOrInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                int                        value);
+
+    static int fetchXorInt(typename AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int                        value);
 };
 
                     // ====================================
@@ -478,6 +536,346 @@ struct AtomicOperations_DefaultInt64
 
     static Types::Int64 decrementInt64NvAcqRel(
                                        typename AtomicTypes::Int64 *atomicInt);
+
+    static Types::Int64 fetchAndInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64                 value);
+
+    static Types::Int64 fetchAndInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64                value);
+
+    static Types::Int64 fetchOrInt64(typename AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64                 value);
+
+    static Types::Int64 fetchOrInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64                value);
+
+    static Types::Int64 fetchXorInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64                 value);
+
+    static Types::Int64 fetchXorInt64AcqRel(
+                                       typename AtomicTypes::Int64 *atomicInt,
+                                       Types::Int64                value);
+};
+
+                    // ===================================
+                    // struct AtomicOperations_DefaultUint
+                    // ===================================
+
+template <class IMP>
+struct AtomicOperations_DefaultUint
+    // This class provides default implementations of atomic operations for
+    // the 32-bit unsigned integer type independent of any specific platform.
+    // The operations are implemented in terms of the corresponding atomic
+    // operations for the 32-bit signed integer type, which must be provided by
+    // the 'IMP' template parameter, and which have the same representation.
+{
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+    // CLASS METHODS
+    static void initUint(typename AtomicTypes::Uint *atomicUint,
+                         unsigned int                initialValue = 0);
+
+    static unsigned int getUint(typename AtomicTypes::Uint const *atomicUint);
+
+    static unsigned int getUintRelaxed(
+                                 typename AtomicTypes::Uint const *atomicUint);
+
+    static unsigned int getUintAcquire(
+                                 typename AtomicTypes::Uint const *atomicUint);
+
+    static void setUint(typename AtomicTypes::Uint *atomicUint,
+                        unsigned int                value);
+
+    static void setUintRelaxed(typename AtomicTypes::Uint *atomicUint,
+                               unsigned int                value);
+
+    static void setUintRelease(typename AtomicTypes::Uint *atomicUint,
+                               unsigned int                value);
+
+    static unsigned int swapUint(typename AtomicTypes::Uint *atomicUint,
+                                 unsigned int                swapValue);
+
+    static unsigned int swapUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                                       unsigned int                swapValue);
+
+    static unsigned int testAndSwapUint(
+                                      typename AtomicTypes::Uint *atomicUint,
+                                      unsigned int               compareValue,
+                                      unsigned int               swapValue);
+
+    static unsigned int testAndSwapUintAcqRel(
+                                      typename AtomicTypes::Uint *atomicUint,
+                                      unsigned int               compareValue,
+                                      unsigned int               swapValue);
+
+    static unsigned int addUintNv(typename AtomicTypes::Uint *atomicUint,
+                                  unsigned int                value);
+
+    static unsigned int addUintNvRelaxed(
+                                       typename AtomicTypes::Uint *atomicUint,
+                                       unsigned int               value);
+
+    static unsigned int addUintNvAcqRel(typename AtomicTypes::Uint *atomicUint,
+                                        unsigned int                value);
+
+    static void addUint(typename AtomicTypes::Uint *atomicUint,
+                        unsigned int                value);
+
+    static void addUintRelaxed(typename AtomicTypes::Uint *atomicUint,
+                               unsigned int                value);
+
+    static void addUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                              unsigned int                value);
+
+    static void incrementUint(typename AtomicTypes::Uint *atomicUint);
+
+    static void incrementUintAcqRel(typename AtomicTypes::Uint *atomicUint);
+
+    static unsigned int incrementUintNv(
+                                       typename AtomicTypes::Uint *atomicUint);
+
+    static unsigned int incrementUintNvAcqRel(
+                                       typename AtomicTypes::Uint *atomicUint);
+
+    static void decrementUint(typename AtomicTypes::Uint *atomicUint);
+
+    static void decrementUintAcqRel(typename AtomicTypes::Uint *atomicUint);
+
+    static unsigned int decrementUintNv(
+                                       typename AtomicTypes::Uint *atomicUint);
+
+    static unsigned int decrementUintNvAcqRel(
+                                       typename AtomicTypes::Uint *atomicUint);
+
+    static unsigned int fetchAndUint(typename AtomicTypes::Uint *atomicUint,
+                                     unsigned int                value);
+
+    static unsigned int fetchAndUintAcqRel(
+                                       typename AtomicTypes::Uint *atomicUint,
+                                       unsigned int               value);
+
+    static unsigned int fetchOrUint(typename AtomicTypes::Uint *atomicUint,
+                                    unsigned int                value);
+
+    static unsigned int fetchOrUintAcqRel(
+                                       typename AtomicTypes::Uint *atomicUint,
+                                       unsigned int               value);
+
+    static unsigned int fetchXorUint(typename AtomicTypes::Uint *atomicUint,
+                                     unsigned int                value);
+
+    static unsigned int fetchXorUintAcqRel(
+                                       typename AtomicTypes::Uint *atomicUint,
+                                       unsigned int               value);
+};
+
+                   // =====================================
+                   // struct AtomicOperations_DefaultUint64
+                   // =====================================
+
+template <class IMP>
+struct AtomicOperations_DefaultUint64
+    // This class provides default implementations of atomic operations for
+    // the 64-bit unsigned integer type independent of any specific platform.
+    // The operations are implemented in terms of the corresponding atomic
+    // operations for the 64-bit signed integer type, which must be provided by
+    // the 'IMP' template parameter, and which have the same representation.
+{
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+    // CLASS METHODS
+    static void initUint64(typename AtomicTypes::Uint64 *atomicUint,
+                           Types::Uint64                 initialValue = 0);
+
+    static Types::Uint64 getUint64(
+                               typename AtomicTypes::Uint64 const *atomicUint);
+
+    static Types::Uint64 getUint64Relaxed(
+                               typename AtomicTypes::Uint64 const *atomicUint);
+
+    static Types::Uint64 getUint64Acquire(
+                               typename AtomicTypes::Uint64 const *atomicUint);
+
+    static void setUint64(typename AtomicTypes::Uint64 *atomicUint,
+                          Types::Uint64                 value);
+
+    static void setUint64Relaxed(typename AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64                 value);
+
+    static void setUint64Release(typename AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64                 value);
+
+    static Types::Uint64 swapUint64(typename AtomicTypes::Uint64 *atomicUint,
+                                    Types::Uint64                 swapValue);
+
+    static Types::Uint64 swapUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                swapValue);
+
+    static Types::Uint64 testAndSwapUint64(
+                                    typename AtomicTypes::Uint64 *atomicUint,
+                                    Types::Uint64                compareValue,
+                                    Types::Uint64                swapValue);
+
+    static Types::Uint64 testAndSwapUint64AcqRel(
+                                    typename AtomicTypes::Uint64 *atomicUint,
+                                    Types::Uint64                compareValue,
+                                    Types::Uint64                swapValue);
+
+    static Types::Uint64 addUint64Nv(typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                 value);
+
+    static Types::Uint64 addUint64NvRelaxed(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 addUint64NvAcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static void addUint64(typename AtomicTypes::Uint64 *atomicUint,
+                          Types::Uint64                 value);
+
+    static void addUint64Relaxed(typename AtomicTypes::Uint64 *atomicUint,
+                                 Types::Uint64                 value);
+
+    static void addUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                                Types::Uint64                 value);
+
+    static void incrementUint64(typename AtomicTypes::Uint64 *atomicUint);
+
+    static void incrementUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static Types::Uint64 incrementUint64Nv(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static Types::Uint64 incrementUint64NvAcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static void decrementUint64(typename AtomicTypes::Uint64 *atomicUint);
+
+    static void decrementUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static Types::Uint64 decrementUint64Nv(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static Types::Uint64 decrementUint64NvAcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint);
+
+    static Types::Uint64 fetchAndUint64(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 fetchAndUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 fetchOrUint64(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 fetchOrUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 fetchXorUint64(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+
+    static Types::Uint64 fetchXorUint64AcqRel(
+                                     typename AtomicTypes::Uint64 *atomicUint,
+                                     Types::Uint64                value);
+};
+
+                   // ======================================
+                   // struct AtomicOperations_DefaultUint128
+                   // ======================================
+
+template <class IMP>
+struct AtomicOperations_DefaultUint128
+    // This class provides default implementations of atomic operations for
+    // the 128-bit unsigned integer type independent of any specific platform.
+    // The 128-bit value is represented as a pair of 64-bit words, and the
+    // operations are emulated by serializing access to each value through one
+    // of a fixed set of spin locks, selected by the address of the value.  A
+    // platform having a native 128-bit compare-and-swap instruction should
+    // override both 'getUint128' and 'testAndSwapUint128' (the emulation is
+    // consistent only if *all* accesses to a value go through one of the two
+    // implementations); 'setUint128' is implemented in terms of those two
+    // operations.
+{
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+  private:
+    // PRIVATE TYPES
+    enum { k_NUM_LOCKS = 64 };  // number of spin locks in 's_locks'
+
+    // CLASS DATA
+    static typename AtomicTypes::Int s_locks[k_NUM_LOCKS];
+                                                 // spin locks protecting the
+                                                 // emulated 128-bit values
+
+    // PRIVATE CLASS METHODS
+    static typename AtomicTypes::Int *lockFor(const volatile void *address);
+        // Return the address of the spin lock protecting the 128-bit value at
+        // the specified 'address'.
+
+    static void lock(typename AtomicTypes::Int *spinLock);
+        // Acquire the specified 'spinLock', spinning until it is available.
+
+    static void unlock(typename AtomicTypes::Int *spinLock);
+        // Release the specified 'spinLock'.
+
+  public:
+    // CLASS METHODS
+    static void initUint128(typename AtomicTypes::Uint128 *atomicValue,
+                            Types::Uint64                  initialLow  = 0,
+                            Types::Uint64                  initialHigh = 0);
+
+    static void getUint128(typename AtomicTypes::Uint128 const *atomicValue,
+                           Types::Uint64                       *low,
+                           Types::Uint64                       *high);
+
+    static void setUint128(typename AtomicTypes::Uint128 *atomicValue,
+                           Types::Uint64                  low,
+                           Types::Uint64                  high);
+
+    static bool testAndSwapUint128(
+                                 typename AtomicTypes::Uint128 *atomicValue,
+                                 Types::Uint64                 *compareLow,
+                                 Types::Uint64                 *compareHigh,
+                                 Types::Uint64                  swapLow,
+                                 Types::Uint64                  swapHigh);
+};
+
+                    // ====================================
+                    // struct AtomicOperations_DefaultFence
+                    // ====================================
+
+template <class IMP>
+struct AtomicOperations_DefaultFence
+    // This class provides default implementations of memory fences
+    // independent of any specific platform.  The full fence is implemented as
+    // a sequentially consistent atomic exchange on a local variable (which
+    // produces a full hardware barrier on every supported platform), and the
+    // acquire and release fences are implemented as a full fence.
+{
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+    // CLASS METHODS
+    static void threadFence();
+
+    static void threadFenceAcquire();
+
+    static void threadFenceRelease();
 };
 
                   // ========================================
@@ -645,10 +1043,14 @@ template <class IMP>
 struct AtomicOperations_Default32
 : AtomicOperations_DefaultInt<IMP>
 , AtomicOperations_DefaultInt64<IMP>
+, AtomicOperations_DefaultUint<IMP>
+, AtomicOperations_DefaultUint64<IMP>
+, AtomicOperations_DefaultUint128<IMP>
 , AtomicOperations_DefaultPointer32<IMP>
+, AtomicOperations_DefaultFence<IMP>
     // This class provides default implementations of non-essential atomic
-    // operations for the 32-bit integer, 64-bit integer and 32-bit pointer
-    // type for a generic 32-bit platform.
+    // operations for the 32-bit, 64-bit and 128-bit integer types, the 32-bit
+    // pointer type and memory fences for a generic 32-bit platform.
 {
 };
 
@@ -660,10 +1062,14 @@ template <class IMP>
 struct AtomicOperations_Default64
 : AtomicOperations_DefaultInt<IMP>
 , AtomicOperations_DefaultInt64<IMP>
+, AtomicOperations_DefaultUint<IMP>
+, AtomicOperations_DefaultUint64<IMP>
+, AtomicOperations_DefaultUint128<IMP>
 , AtomicOperations_DefaultPointer64<IMP>
+, AtomicOperations_DefaultFence<IMP>
     // This class provides default implementations of non-essential atomic
-    // operations for the 32-bit integer, 64-bit integer and 64-bit pointer
-    // type for a generic 64-bit platform.
+    // operations for the 32-bit, 64-bit and 128-bit integer types, the 64-bit
+    // pointer type and memory fences for a generic 64-bit platform.
 {
 };
 
@@ -838,6 +1244,75 @@ void AtomicOperations_DefaultInt<IMP>::
     IMP::addIntAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int oldValue = IMP::getIntRelaxed(atomicInt);
+    int expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt(atomicInt, expected, expected & value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchAndInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int oldValue = IMP::getIntRelaxed(atomicInt);
+    int expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt(atomicInt, expected, expected | value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchOrInt(atomicInt, value);
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorInt(typename AtomicTypes::Int *atomicInt, int value)
+{
+    int oldValue = IMP::getIntRelaxed(atomicInt);
+    int expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt(atomicInt, expected, expected ^ value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt, int value)
+{
+    return IMP::fetchXorInt(atomicInt, value);
+}
+
                     // ------------------------------------
                     // struct AtomicOperations_DefaultInt64
                     // ------------------------------------
@@ -1014,6 +1489,910 @@ Types::Int64 AtomicOperations_DefaultInt64<IMP>::
     return IMP::addInt64NvAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 oldValue = IMP::getInt64Relaxed(atomicInt);
+    Types::Int64 expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt64(atomicInt,
+                                         expected,
+                                         expected & value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64                 value)
+{
+    return IMP::fetchAndInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 oldValue = IMP::getInt64Relaxed(atomicInt);
+    Types::Int64 expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt64(atomicInt,
+                                         expected,
+                                         expected | value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                       Types::Int64                 value)
+{
+    return IMP::fetchOrInt64(atomicInt, value);
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 value)
+{
+    Types::Int64 oldValue = IMP::getInt64Relaxed(atomicInt);
+    Types::Int64 expected;
+    do {
+        expected = oldValue;
+        oldValue = IMP::testAndSwapInt64(atomicInt,
+                                         expected,
+                                         expected ^ value);
+    } while (oldValue != expected);
+
+    return oldValue;
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64                 value)
+{
+    return IMP::fetchXorInt64(atomicInt, value);
+}
+
+                    // -----------------------------------
+                    // struct AtomicOperations_DefaultUint
+                    // -----------------------------------
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    initUint(typename AtomicTypes::Uint *atomicUint, unsigned int initialValue)
+{
+    atomicUint->d_value = initialValue;
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    getUint(typename AtomicTypes::Uint const *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::getInt(
+            reinterpret_cast<typename AtomicTypes::Int const *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    getUintRelaxed(typename AtomicTypes::Uint const *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::getIntRelaxed(
+            reinterpret_cast<typename AtomicTypes::Int const *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    getUintAcquire(typename AtomicTypes::Uint const *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::getIntAcquire(
+            reinterpret_cast<typename AtomicTypes::Int const *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    setUint(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::setInt(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    setUintRelaxed(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::setIntRelaxed(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    setUintRelease(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::setIntRelease(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    swapUint(typename AtomicTypes::Uint *atomicUint, unsigned int swapValue)
+{
+    return static_cast<unsigned int>(
+        IMP::swapInt(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(swapValue)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    swapUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                   unsigned int                swapValue)
+{
+    return static_cast<unsigned int>(
+        IMP::swapIntAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(swapValue)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    testAndSwapUint(typename AtomicTypes::Uint *atomicUint,
+                    unsigned int                compareValue,
+                    unsigned int                swapValue)
+{
+    return static_cast<unsigned int>(
+        IMP::testAndSwapInt(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(compareValue),
+            static_cast<int>(swapValue)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    testAndSwapUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                          unsigned int                compareValue,
+                          unsigned int                swapValue)
+{
+    return static_cast<unsigned int>(
+        IMP::testAndSwapIntAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(compareValue),
+            static_cast<int>(swapValue)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    addUintNv(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    return static_cast<unsigned int>(
+        IMP::addIntNv(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    addUintNvRelaxed(typename AtomicTypes::Uint *atomicUint,
+                unsigned int               value)
+{
+    return static_cast<unsigned int>(
+        IMP::addIntNvRelaxed(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    addUintNvAcqRel(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    return static_cast<unsigned int>(
+        IMP::addIntNvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    addUint(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::addInt(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    addUintRelaxed(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::addIntRelaxed(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    addUintAcqRel(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    IMP::addIntAcqRel(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+        static_cast<int>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    incrementUint(typename AtomicTypes::Uint *atomicUint)
+{
+    IMP::incrementInt(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    incrementUintAcqRel(typename AtomicTypes::Uint *atomicUint)
+{
+    IMP::incrementIntAcqRel(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    incrementUintNv(typename AtomicTypes::Uint *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::incrementIntNv(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    incrementUintNvAcqRel(typename AtomicTypes::Uint *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::incrementIntNvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    decrementUint(typename AtomicTypes::Uint *atomicUint)
+{
+    IMP::decrementInt(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint<IMP>::
+    decrementUintAcqRel(typename AtomicTypes::Uint *atomicUint)
+{
+    IMP::decrementIntAcqRel(
+        reinterpret_cast<typename AtomicTypes::Int *>(atomicUint));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    decrementUintNv(typename AtomicTypes::Uint *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::decrementIntNv(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    decrementUintNvAcqRel(typename AtomicTypes::Uint *atomicUint)
+{
+    return static_cast<unsigned int>(
+        IMP::decrementIntNvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchAndUint(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchAndInt(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchAndUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                       unsigned int                value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchAndIntAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchOrUint(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchOrInt(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchOrUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                      unsigned int                value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchOrIntAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchXorUint(typename AtomicTypes::Uint *atomicUint, unsigned int value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchXorInt(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+template <class IMP>
+inline
+unsigned int AtomicOperations_DefaultUint<IMP>::
+    fetchXorUintAcqRel(typename AtomicTypes::Uint *atomicUint,
+                       unsigned int                value)
+{
+    return static_cast<unsigned int>(
+        IMP::fetchXorIntAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int *>(atomicUint),
+            static_cast<int>(value)));
+}
+
+                   // -------------------------------------
+                   // struct AtomicOperations_DefaultUint64
+                   // -------------------------------------
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    initUint64(typename AtomicTypes::Uint64 *atomicUint,
+               Types::Uint64                 initialValue)
+{
+    atomicUint->d_value = initialValue;
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    getUint64(typename AtomicTypes::Uint64 const *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::getInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 const *>(
+                atomicUint)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    getUint64Relaxed(typename AtomicTypes::Uint64 const *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::getInt64Relaxed(
+            reinterpret_cast<typename AtomicTypes::Int64 const *>(
+                atomicUint)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    getUint64Acquire(typename AtomicTypes::Uint64 const *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::getInt64Acquire(
+            reinterpret_cast<typename AtomicTypes::Int64 const *>(
+                atomicUint)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    setUint64(typename AtomicTypes::Uint64 *atomicUint, Types::Uint64 value)
+{
+    IMP::setInt64(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    setUint64Relaxed(typename AtomicTypes::Uint64 *atomicUint,
+                Types::Uint64                value)
+{
+    IMP::setInt64Relaxed(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    setUint64Release(typename AtomicTypes::Uint64 *atomicUint,
+                Types::Uint64                value)
+{
+    IMP::setInt64Release(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    swapUint64(typename AtomicTypes::Uint64 *atomicUint,
+               Types::Uint64                 swapValue)
+{
+    return static_cast<Types::Uint64>(
+        IMP::swapInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(swapValue)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    swapUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                Types::Uint64                swapValue)
+{
+    return static_cast<Types::Uint64>(
+        IMP::swapInt64AcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(swapValue)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    testAndSwapUint64(typename AtomicTypes::Uint64 *atomicUint,
+                      Types::Uint64                 compareValue,
+                      Types::Uint64                 swapValue)
+{
+    return static_cast<Types::Uint64>(
+        IMP::testAndSwapInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(compareValue),
+            static_cast<Types::Int64>(swapValue)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    testAndSwapUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                            Types::Uint64                 compareValue,
+                            Types::Uint64                 swapValue)
+{
+    return static_cast<Types::Uint64>(
+        IMP::testAndSwapInt64AcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(compareValue),
+            static_cast<Types::Int64>(swapValue)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    addUint64Nv(typename AtomicTypes::Uint64 *atomicUint, Types::Uint64 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::addInt64Nv(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    addUint64NvRelaxed(typename AtomicTypes::Uint64 *atomicUint,
+                       Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::addInt64NvRelaxed(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    addUint64NvAcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                      Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::addInt64NvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    addUint64(typename AtomicTypes::Uint64 *atomicUint, Types::Uint64 value)
+{
+    IMP::addInt64(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    addUint64Relaxed(typename AtomicTypes::Uint64 *atomicUint,
+                Types::Uint64                value)
+{
+    IMP::addInt64Relaxed(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    addUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                    Types::Uint64                 value)
+{
+    IMP::addInt64AcqRel(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+        static_cast<Types::Int64>(value));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    incrementUint64(typename AtomicTypes::Uint64 *atomicUint)
+{
+    IMP::incrementInt64(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    incrementUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint)
+{
+    IMP::incrementInt64AcqRel(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    incrementUint64Nv(typename AtomicTypes::Uint64 *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::incrementInt64Nv(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    incrementUint64NvAcqRel(typename AtomicTypes::Uint64 *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::incrementInt64NvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    decrementUint64(typename AtomicTypes::Uint64 *atomicUint)
+{
+    IMP::decrementInt64(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint));
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint64<IMP>::
+    decrementUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint)
+{
+    IMP::decrementInt64AcqRel(
+        reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    decrementUint64Nv(typename AtomicTypes::Uint64 *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::decrementInt64Nv(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    decrementUint64NvAcqRel(typename AtomicTypes::Uint64 *atomicUint)
+{
+    return static_cast<Types::Uint64>(
+        IMP::decrementInt64NvAcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchAndUint64(typename AtomicTypes::Uint64 *atomicUint,
+                   Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchAndInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchAndUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                         Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchAndInt64AcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchOrUint64(typename AtomicTypes::Uint64 *atomicUint,
+                  Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchOrInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchOrUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                        Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchOrInt64AcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchXorUint64(typename AtomicTypes::Uint64 *atomicUint,
+                   Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchXorInt64(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+template <class IMP>
+inline
+Types::Uint64 AtomicOperations_DefaultUint64<IMP>::
+    fetchXorUint64AcqRel(typename AtomicTypes::Uint64 *atomicUint,
+                         Types::Uint64                 value)
+{
+    return static_cast<Types::Uint64>(
+        IMP::fetchXorInt64AcqRel(
+            reinterpret_cast<typename AtomicTypes::Int64 *>(atomicUint),
+            static_cast<Types::Int64>(value)));
+}
+
+                   // --------------------------------------
+                   // struct AtomicOperations_DefaultUint128
+                   // --------------------------------------
+
+// CLASS DATA
+template <class IMP>
+typename AtomicOperations_DefaultUint128<IMP>::AtomicTypes::Int
+    AtomicOperations_DefaultUint128<IMP>::s_locks[k_NUM_LOCKS];
+
+// PRIVATE CLASS METHODS
+template <class IMP>
+inline
+typename AtomicOperations_DefaultUint128<IMP>::AtomicTypes::Int *
+AtomicOperations_DefaultUint128<IMP>::lockFor(const volatile void *address)
+{
+    // 128-bit values are 16-byte aligned, so the low 4 bits carry no
+    // information.
+
+    return s_locks + (reinterpret_cast<Types::UintPtr>(address) >> 4)
+                                                                 % k_NUM_LOCKS;
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint128<IMP>::lock(
+                                           typename AtomicTypes::Int *spinLock)
+{
+    while (IMP::swapIntAcqRel(spinLock, 1)) {
+        while (IMP::getIntRelaxed(spinLock)) {
+        }
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint128<IMP>::unlock(
+                                           typename AtomicTypes::Int *spinLock)
+{
+    IMP::setIntRelease(spinLock, 0);
+}
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint128<IMP>::
+    initUint128(typename AtomicTypes::Uint128 *atomicValue,
+                Types::Uint64                  initialLow,
+                Types::Uint64                  initialHigh)
+{
+    atomicValue->d_value[0] = initialLow;
+    atomicValue->d_value[1] = initialHigh;
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint128<IMP>::
+    getUint128(typename AtomicTypes::Uint128 const *atomicValue,
+               Types::Uint64                       *low,
+               Types::Uint64                       *high)
+{
+    typename AtomicTypes::Int *spinLock = lockFor(atomicValue);
+
+    lock(spinLock);
+    *low  = atomicValue->d_value[0];
+    *high = atomicValue->d_value[1];
+    unlock(spinLock);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultUint128<IMP>::
+    setUint128(typename AtomicTypes::Uint128 *atomicValue,
+               Types::Uint64                  low,
+               Types::Uint64                  high)
+{
+    // A torn initial read merely costs one more iteration.
+
+    Types::Uint64 compareLow  = atomicValue->d_value[0];
+    Types::Uint64 compareHigh = atomicValue->d_value[1];
+
+    while (!IMP::testAndSwapUint128(atomicValue,
+                                    &compareLow,
+                                    &compareHigh,
+                                    low,
+                                    high)) {
+    }
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultUint128<IMP>::
+    testAndSwapUint128(typename AtomicTypes::Uint128 *atomicValue,
+                       Types::Uint64                 *compareLow,
+                       Types::Uint64                 *compareHigh,
+                       Types::Uint64                  swapLow,
+                       Types::Uint64                  swapHigh)
+{
+    typename AtomicTypes::Int *spinLock = lockFor(atomicValue);
+
+    lock(spinLock);
+
+    const Types::Uint64 oldLow  = atomicValue->d_value[0];
+    const Types::Uint64 oldHigh = atomicValue->d_value[1];
+    const bool          result  = oldLow  == *compareLow
+                               && oldHigh == *compareHigh;
+
+    if (result) {
+        atomicValue->d_value[0] = swapLow;
+        atomicValue->d_value[1] = swapHigh;
+    }
+
+    unlock(spinLock);
+
+    *compareLow  = oldLow;
+    *compareHigh = oldHigh;
+
+    return result;
+}
+
+                    // ------------------------------------
+                    // struct AtomicOperations_DefaultFence
+                    // ------------------------------------
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultFence<IMP>::threadFence()
+{
+    typename AtomicTypes::Int dummy;
+    IMP::initInt(&dummy, 0);
+    IMP::swapInt(&dummy, 1);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultFence<IMP>::threadFenceAcquire()
+{
+    IMP::threadFence();
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultFence<IMP>::threadFenceRelease()
+{
+    IMP::threadFence();
+}
+
                   // ----------------------------------------
                   // struct AtomicOperations_DefaultPointer32
                   // ----------------------------------------
@@ -60,6 +60,24 @@ struct Atomic_TypeTraits<AtomicOperations_POWERPC_AIX_GCC>
                        __attribute__((__aligned__(sizeof(Types::Int64))));
     };
 
+    struct Uint
+    {
+        volatile unsigned int d_value
+                       __attribute__((__aligned__(sizeof(unsigned int))));
+    };
+
+    struct Uint64
+    {
+        volatile Types::Uint64 d_value
+                       __attribute__((__aligned__(sizeof(Types::Uint64))));
+    };
+
+    struct Uint128
+    {
+        volatile Types::Uint64 d_value[2]  // low word first
+                       __attribute__((__aligned__(16)));
+    };
+
     struct Pointer
     {
         void * volatile d_value __attribute__((__aligned__(sizeof(void *))));
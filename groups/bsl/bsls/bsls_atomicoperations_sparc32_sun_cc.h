@@ -112,6 +112,39 @@ struct Atomic_TypeTraits<AtomicOperations_SPARC32_SUN_CC>
 #endif
     };
 
+    struct Uint
+    {
+#ifdef BSLS_PLATFORM_CMP_GNU
+        volatile unsigned int d_value
+                       __attribute__((__aligned__(sizeof(unsigned int))));
+#else
+#       pragma align 4 (d_value)
+        volatile unsigned int d_value;
+#endif
+    };
+
+    struct Uint64
+    {
+#ifdef BSLS_PLATFORM_CMP_GNU
+        volatile Types::Uint64 d_value
+                       __attribute__((__aligned__(sizeof(Types::Uint64))));
+#else
+#       pragma align 8 (d_value)
+        volatile Types::Uint64 d_value;
+#endif
+    };
+
+    struct Uint128
+    {
+#ifdef BSLS_PLATFORM_CMP_GNU
+        volatile Types::Uint64 d_value[2]  // low word first
+                       __attribute__((__aligned__(16)));
+#else
+#       pragma align 16 (d_value)
+        volatile Types::Uint64 d_value[2];  // low word first
+#endif
+    };
+
     struct Pointer
     {
 #ifdef BSLS_PLATFORM_CMP_GNU
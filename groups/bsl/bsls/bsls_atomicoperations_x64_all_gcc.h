@@ -23,7 +23,9 @@ BSLS_IDENT("$Id: $")
 //:   code,
 //: o "+m" constraint may cause an 'inconsistent operand constraint' error in
 //:   GCC 3.x in optimized builds, therefore sometimes a combination of output
-//:   "=m" and input "m" constraints is used.
+//:   "=m" and input "m" constraints is used,
+//: o the 128-bit compare-and-swap is implemented using 'cmpxchg16b', which is
+//:   available on all but the earliest x86-64 processors.
 
 #ifndef INCLUDED_BSLS_ATOMICOPERATIONS_DEFAULT
 #include <bsls_atomicoperations_default.h>
@@ -65,6 +67,24 @@ struct Atomic_TypeTraits<AtomicOperations_X64_ALL_GCC>
                        __attribute__((__aligned__(sizeof(Types::Int64))));
     };
 
+    struct Uint
+    {
+        volatile unsigned int d_value
+                       __attribute__((__aligned__(sizeof(unsigned int))));
+    };
+
+    struct Uint64
+    {
+        volatile Types::Uint64 d_value
+                       __attribute__((__aligned__(sizeof(Types::Uint64))));
+    };
+
+    struct Uint128
+    {
+        volatile Types::Uint64 d_value[2]  // low word first
+                       __attribute__((__aligned__(16)));
+    };
+
     struct Pointer
     {
         void * volatile d_value __attribute__((__aligned__(sizeof(void *))));
@@ -96,6 +116,12 @@ struct AtomicOperations_X64_ALL_GCC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+    static int fetchAndInt(AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchOrInt(AtomicTypes::Int *atomicInt, int value);
+
+    static int fetchXorInt(AtomicTypes::Int *atomicInt, int value);
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -114,6 +140,35 @@ struct AtomicOperations_X64_ALL_GCC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 value);
+
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64 value);
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 value);
+
+        // *** atomic functions for Uint128 ***
+
+    static void getUint128(const AtomicTypes::Uint128 *atomicValue,
+                           Types::Uint64 *low,
+                           Types::Uint64 *high);
+
+    static bool testAndSwapUint128(AtomicTypes::Uint128 *atomicValue,
+                                   Types::Uint64 *compareLow,
+                                   Types::Uint64 *compareHigh,
+                                   Types::Uint64 swapLow,
+                                   Types::Uint64 swapHigh);
+
+        // *** memory fences ***
+
+    static void threadFence();
+
+    static void threadFenceAcquire();
+
+    static void threadFenceRelease();
 };
 
 // ===========================================================================
@@ -198,6 +253,27 @@ int AtomicOperations_X64_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+inline
+int AtomicOperations_X64_ALL_GCC::
+    fetchAndInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return __sync_fetch_and_and(&atomicInt->d_value, value);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    fetchOrInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return __sync_fetch_and_or(&atomicInt->d_value, value);
+}
+
+inline
+int AtomicOperations_X64_ALL_GCC::
+    fetchXorInt(AtomicTypes::Int *atomicInt, int value)
+{
+    return __sync_fetch_and_xor(&atomicInt->d_value, value);
+}
+
 inline
 Types::Int64 AtomicOperations_X64_ALL_GCC::
     getInt64(const AtomicTypes::Int64 *atomicInt)
@@ -275,6 +351,99 @@ Types::Int64 AtomicOperations_X64_ALL_GCC::
     return __sync_add_and_fetch(&atomicInt->d_value, value);
 }
 
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                  Types::Int64 value)
+{
+    return __sync_fetch_and_and(&atomicInt->d_value, value);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                 Types::Int64 value)
+{
+    return __sync_fetch_and_or(&atomicInt->d_value, value);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_ALL_GCC::
+    fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                  Types::Int64 value)
+{
+    return __sync_fetch_and_xor(&atomicInt->d_value, value);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    getUint128(const AtomicTypes::Uint128 *atomicValue,
+               Types::Uint64 *low,
+               Types::Uint64 *high)
+{
+    // A 'cmpxchg16b' whose compare and swap values are equal loads the value
+    // atomically without changing it.
+
+    *low  = 0;
+    *high = 0;
+    testAndSwapUint128(const_cast<AtomicTypes::Uint128 *>(atomicValue),
+                       low,
+                       high,
+                       0,
+                       0);
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndSwapUint128(AtomicTypes::Uint128 *atomicValue,
+                       Types::Uint64 *compareLow,
+                       Types::Uint64 *compareHigh,
+                       Types::Uint64 swapLow,
+                       Types::Uint64 swapHigh)
+{
+    char result;
+
+    asm volatile (
+        "       lock cmpxchg16b %[obj]      \n\t"
+        "       sete %[res]                 \n\t"
+
+                : [obj] "=m" (*atomicValue),
+                  [res] "=q" (result),
+                  "+a" (*compareLow),
+                  "+d" (*compareHigh)
+                : "m" (*atomicValue),
+                  "b" (swapLow),
+                  "c" (swapHigh)
+                : "memory", "cc");
+
+    return result;
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    threadFence()
+{
+    asm volatile ("mfence" ::: "memory");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    threadFenceAcquire()
+{
+    // Loads are not reordered with other loads, and stores are not reordered
+    // with other stores or with older loads, on x86-64, so only the compiler
+    // must be prevented from reordering accesses.
+
+    asm volatile ("" ::: "memory");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    threadFenceRelease()
+{
+    asm volatile ("" ::: "memory");
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
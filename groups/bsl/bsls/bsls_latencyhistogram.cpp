@@ -0,0 +1,268 @@
+// bsls_latencyhistogram.cpp                                          -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+
+namespace bsls {
+
+namespace {
+
+const Types::Int64 k_MAX_INT64 = static_cast<Types::Int64>(
+                                        ~static_cast<Types::Uint64>(0) >> 1);
+
+}  // close unnamed namespace
+
+                      // ------------------------------
+                      // class LatencyHistogramSnapshot
+                      // ------------------------------
+
+// PRIVATE MANIPULATORS
+void LatencyHistogramSnapshot::constrainExtrema()
+{
+    if (0 == d_count) {
+        return;                                                       // RETURN
+    }
+
+    int first = 0;
+    while (0 == d_counts[first]) {
+        ++first;
+    }
+    int last = LatencyHistogramUtil::k_NUM_BUCKETS - 1;
+    while (0 == d_counts[last]) {
+        --last;
+    }
+
+    const Types::Int64 firstUpper =
+                                LatencyHistogramUtil::bucketUpperBound(first);
+    const Types::Int64 lastLower  =
+                                 LatencyHistogramUtil::bucketLowerBound(last);
+    if (d_min > firstUpper) {
+        d_min = firstUpper;
+    }
+    if (d_max < lastLower) {
+        d_max = lastLower;
+    }
+}
+
+// CREATORS
+LatencyHistogramSnapshot::LatencyHistogramSnapshot()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LatencyHistogramSnapshot::merge(const LatencyHistogramSnapshot& other)
+{
+    for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+        d_counts[i] += other.d_counts[i];
+    }
+    d_count += other.d_count;
+    d_sum   += other.d_sum;
+    if (other.d_min < d_min) {
+        d_min = other.d_min;
+    }
+    if (other.d_max > d_max) {
+        d_max = other.d_max;
+    }
+}
+
+void LatencyHistogramSnapshot::reset()
+{
+    for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+        d_counts[i] = 0;
+    }
+    d_count = 0;
+    d_sum   = 0;
+    d_min   = k_MAX_INT64;
+    d_max   = 0;
+}
+
+// ACCESSORS
+Types::Int64 LatencyHistogramSnapshot::valueAtPercentile(
+                                                       double percentile) const
+{
+    BSLS_ASSERT(0.0 <= percentile);
+    BSLS_ASSERT(percentile <= 100.0);
+
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    // Compute the rank 'ceil(percentile / 100 * d_count)', and clamp it to
+    // '[1, d_count]' (guarding against rounding in the product).
+
+    const double       exactRank = percentile / 100.0
+                                 * static_cast<double>(d_count);
+    Types::Int64       rank      = static_cast<Types::Int64>(exactRank);
+    if (static_cast<double>(rank) < exactRank) {
+        ++rank;
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > d_count) {
+        rank = d_count;
+    }
+
+    Types::Int64 seen  = 0;
+    int          index = 0;
+    for (; index < LatencyHistogramUtil::k_NUM_BUCKETS - 1; ++index) {
+        seen += d_counts[index];
+        if (seen >= rank) {
+            break;
+        }
+    }
+
+    const Types::Int64 value = LatencyHistogramUtil::bucketUpperBound(index);
+    return value < d_min ? d_min
+                         : value > d_max ? d_max
+                                         : value;
+}
+
+                          // ----------------------
+                          // class LatencyHistogram
+                          // ----------------------
+
+// CREATORS
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LatencyHistogram::reset()
+{
+    for (int s = 0; s < k_NUM_STRIPES; ++s) {
+        Stripe& stripe = d_stripes[s];
+        for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+            stripe.d_counts[i].storeRelaxed(0);
+        }
+        stripe.d_sum.storeRelaxed(0);
+        stripe.d_min.storeRelaxed(k_MAX_INT64);
+        stripe.d_max.storeRelaxed(0);
+    }
+}
+
+// ACCESSORS
+void LatencyHistogram::loadSnapshot(LatencyHistogramSnapshot *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->reset();
+
+    for (int s = 0; s < k_NUM_STRIPES; ++s) {
+        const Stripe& stripe = d_stripes[s];
+
+        for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+            const Types::Int64 count = stripe.d_counts[i].loadRelaxed();
+            result->d_counts[i] += count;
+            result->d_count     += count;
+        }
+        result->d_sum += stripe.d_sum.loadRelaxed();
+
+        const Types::Int64 min = stripe.d_min.loadRelaxed();
+        const Types::Int64 max = stripe.d_max.loadRelaxed();
+        if (min < result->d_min) {
+            result->d_min = min;
+        }
+        if (max > result->d_max) {
+            result->d_max = max;
+        }
+    }
+
+    // A value being recorded concurrently may be reflected in the count of
+    // its bucket before the minimum and maximum are updated; keep them
+    // consistent with the counts loaded.
+
+    result->constrainExtrema();
+}
+
+                        // ---------------------------
+                        // class LocalLatencyHistogram
+                        // ---------------------------
+
+// CREATORS
+LocalLatencyHistogram::LocalLatencyHistogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LocalLatencyHistogram::reset()
+{
+    for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+        d_counts[i].storeRelaxed(0);
+    }
+    d_sum.storeRelaxed(0);
+    d_min.storeRelaxed(k_MAX_INT64);
+    d_max.storeRelaxed(0);
+}
+
+// ACCESSORS
+void LocalLatencyHistogram::loadSnapshot(
+                                        LatencyHistogramSnapshot *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->reset();
+
+    for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+        const Types::Int64 count = d_counts[i].loadRelaxed();
+        result->d_counts[i]  = count;
+        result->d_count     += count;
+    }
+    result->d_sum = d_sum.loadRelaxed();
+    result->d_min = d_min.loadRelaxed();
+    result->d_max = d_max.loadRelaxed();
+
+    result->constrainExtrema();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bsls::operator==(const LatencyHistogramSnapshot& lhs,
+                      const LatencyHistogramSnapshot& rhs)
+{
+    if (lhs.d_count != rhs.d_count
+     || lhs.d_sum   != rhs.d_sum
+     || lhs.min()   != rhs.min()
+     || lhs.max()   != rhs.max()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < LatencyHistogramUtil::k_NUM_BUCKETS; ++i) {
+        if (lhs.d_counts[i] != rhs.d_counts[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
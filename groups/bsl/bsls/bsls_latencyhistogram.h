@@ -0,0 +1,656 @@
+// bsls_latencyhistogram.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#define INCLUDED_BSLS_LATENCYHISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe log-linear histogram for recording latencies.
+//
+//@CLASSES:
+//  bsls::LatencyHistogram: thread-safe histogram of non-negative values
+//  bsls::LatencyHistogramSnapshot: mergeable, queryable copy of a histogram
+//  bsls::LocalLatencyHistogram: histogram recorded by one thread at a time
+//  bsls::LatencyHistogramUtil: namespace for the bucket arithmetic
+//
+//@SEE_ALSO: bsls_timeutil, bsls_stopwatch
+//
+//@DESCRIPTION: This component provides a class, 'bsls::LatencyHistogram',
+// that records the distribution of non-negative 64-bit values (typically
+// latencies in nanoseconds, as measured using 'bsls::TimeUtil') from any
+// number of threads, at a cost of a few atomic additions per value recorded.
+// The recorded distribution is examined by loading a
+// 'bsls::LatencyHistogramSnapshot', a value-semantic copy of the histogram
+// that can be merged with other snapshots, and that provides the count, sum,
+// minimum, maximum, and mean of the recorded values, and the value at any
+// percentile.  'bsls::LocalLatencyHistogram' provides a cheaper histogram
+// that only one thread at a time may record into (see "Single-Writer
+// Histograms" below).  'bsls::LatencyHistogramUtil' provides the mapping
+// between values and the buckets of the histograms.
+//
+// Unlike 'bsls::Stopwatch', which accumulates a total time, a histogram
+// retains enough information to describe the tail of a distribution (e.g., the
+// 99th or 99.99th percentile), which is often of more interest than the mean
+// when instrumenting a latency-sensitive path.
+//
+///Buckets and Precision
+///---------------------
+// The histogram is *log-linear*, in the manner of an HDR histogram: values
+// less than 32 are recorded exactly, and each larger range of values
+// '[2^N, 2^(N + 1))' is divided into 32 buckets of equal width.  The width of
+// the bucket holding a value is therefore at most 1/32 (about 3%) of the
+// value, whatever its magnitude, and the full range of 'bsls::Types::Int64'
+// is covered by 1888 buckets.  Percentiles are reported as the greatest value
+// of the bucket holding the requested rank (limited to the greatest value
+// recorded), and so are accurate to within the same relative precision.  The
+// count, sum, minimum, and maximum of the recorded values are exact.
+//
+///Concurrency and Cost
+///--------------------
+// 'record' may be called concurrently from any number of threads.  To limit
+// contention between threads recording similar values, the counts of a
+// histogram are divided into 4 *stripes*, each holding a complete set of
+// buckets, and a thread records into a stripe selected by a hash of the
+// address of its stack.  Recording a value performs two relaxed atomic
+// additions (to the count of a bucket and to the sum), and updates the
+// minimum and maximum (using an atomic compare-and-swap) only when the value
+// exceeds them; it does not allocate memory, lock, or make a system call.
+// Note that the stripes make a histogram large (about 60 kilobytes), so
+// histograms are intended to be long-lived objects (e.g., one per
+// instrumented operation), rather than temporaries.
+//
+// 'loadSnapshot' may be called concurrently with 'record'.  A snapshot loaded
+// while values are being recorded holds, for each bucket, a count that was
+// current at some point during the call, but need not reflect the recording
+// of any particular value atomically (e.g., a value may be reflected in the
+// count of its bucket but not yet in the sum).  'reset' must not be called
+// concurrently with any other method of the same histogram.
+//
+///Single-Writer Histograms
+///------------------------
+// When each thread can be given a histogram of its own (e.g., one held in
+// thread-specific storage), 'bsls::LocalLatencyHistogram' avoids the cost of
+// atomic read-modify-write operations altogether.  It holds a single set of
+// buckets (about 15 kilobytes), and 'record' updates it with relaxed atomic
+// loads and stores, which compile to ordinary memory accesses on common
+// platforms.  Only one thread at a time may call 'record' (or 'reset'), but
+// any thread may call 'loadSnapshot' concurrently, with the same guarantees
+// as for 'bsls::LatencyHistogram'.  The snapshots of the histograms of
+// several threads are combined using 'merge'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Instrumenting a Function
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we want to know the distribution of the time taken to process
+// a message, so that we can monitor its 99th percentile.
+//
+// First, we define a function that does the work to be measured:
+//..
+//  void processMessage(int *state)
+//      // Process a message, updating the specified 'state'.
+//  {
+//      for (int i = 0; i < 100; ++i) {
+//          *state = *state * 31 + i;
+//      }
+//  }
+//..
+// Then, we create a histogram (typically, a long-lived object shared by all
+// the threads processing messages):
+//..
+//  bsls::LatencyHistogram latencies;
+//..
+// Next, we process messages, recording the time taken by each, as measured by
+// the fast timer of 'bsls::TimeUtil':
+//..
+//  int state = 0;
+//  for (int i = 0; i < 1000; ++i) {
+//      const bsls::Types::Int64 start = bsls::TimeUtil::getFastTimer();
+//      processMessage(&state);
+//      latencies.record(bsls::TimeUtil::getFastTimer() - start);
+//  }
+//..
+// Now, we load a snapshot of the histogram, and examine the distribution:
+//..
+//  bsls::LatencyHistogramSnapshot snapshot;
+//  latencies.loadSnapshot(&snapshot);
+//
+//  assert(1000 == snapshot.count());
+//  assert(snapshot.min() <= snapshot.valueAtPercentile(50.0));
+//  assert(snapshot.valueAtPercentile(50.0)
+//                                     <= snapshot.valueAtPercentile(99.0));
+//  assert(snapshot.valueAtPercentile(99.0) <= snapshot.max());
+//..
+// Finally, we note that snapshots of several histograms (e.g., one for each
+// of several servers) can be merged to describe the combined distribution:
+//..
+//  bsls::LatencyHistogramSnapshot total;
+//  total.merge(snapshot);
+//  total.merge(snapshot);
+//
+//  assert(2000           == total.count());
+//  assert(snapshot.max() == total.max());
+//..
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                       // ===========================
+                       // struct LatencyHistogramUtil
+                       // ===========================
+
+struct LatencyHistogramUtil {
+    // This 'struct' provides a namespace for the functions mapping values to
+    // the buckets of a log-linear histogram, and buckets to the ranges of
+    // values they hold.
+
+    // TYPES
+    enum {
+        k_SUB_BUCKET_BITS  = 5,                       // log2 of the buckets
+                                                      // per power of two
+
+        k_SUB_BUCKET_COUNT = 1 << k_SUB_BUCKET_BITS,  // buckets per power of
+                                                      // two
+
+        k_NUM_BUCKETS      = (64 - k_SUB_BUCKET_BITS)
+                                                   << k_SUB_BUCKET_BITS
+                                                      // buckets needed for
+                                                      // all non-negative
+                                                      // 'Types::Int64' values
+    };
+
+    // CLASS METHODS
+    static int bucketIndex(Types::Int64 value);
+        // Return the index of the bucket holding the specified 'value'.  The
+        // behavior is undefined unless '0 <= value'.
+
+    static Types::Int64 bucketLowerBound(int index);
+        // Return the least value held by the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static Types::Int64 bucketUpperBound(int index);
+        // Return the greatest value held by the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static int numSignificantBits(Types::Uint64 value);
+        // Return the number of bits of the specified 'value' following (and
+        // including) its most significant set bit, or 0 if 'value' is 0.
+};
+
+                      // ==============================
+                      // class LatencyHistogramSnapshot
+                      // ==============================
+
+class LatencyHistogramSnapshot {
+    // This value-semantic class holds the counts of the buckets of a
+    // log-linear histogram, together with the count, sum, minimum, and
+    // maximum of the values recorded, as loaded from a 'LatencyHistogram' or
+    // obtained by merging other snapshots.  Two snapshots have the same value
+    // if they have the same bucket counts, sum, minimum, and maximum.
+
+    // DATA
+    Types::Int64 d_counts[LatencyHistogramUtil::k_NUM_BUCKETS];
+                                          // count of values in each bucket
+
+    Types::Int64 d_count;                 // total count of values
+
+    Types::Int64 d_sum;                   // sum of values
+
+    Types::Int64 d_min;                   // least value, if 'd_count > 0'
+
+    Types::Int64 d_max;                   // greatest value, if 'd_count > 0'
+
+    // FRIENDS
+    friend class LatencyHistogram;
+    friend class LocalLatencyHistogram;
+    friend bool operator==(const LatencyHistogramSnapshot&,
+                           const LatencyHistogramSnapshot&);
+
+    // PRIVATE MANIPULATORS
+    void constrainExtrema();
+        // Limit the minimum and maximum of this snapshot to the greatest value
+        // of its first non-empty bucket and the least value of its last
+        // non-empty bucket, respectively, so that they are consistent with
+        // bucket counts loaded concurrently with the recording of values.
+
+  public:
+    // CREATORS
+    LatencyHistogramSnapshot();
+        // Create a snapshot of an empty histogram.
+
+    //! LatencyHistogramSnapshot(const LatencyHistogramSnapshot& original);
+    //! ~LatencyHistogramSnapshot();
+
+    // MANIPULATORS
+    //! LatencyHistogramSnapshot& operator=(
+    //!                                  const LatencyHistogramSnapshot& rhs);
+
+    void merge(const LatencyHistogramSnapshot& other);
+        // Add the values described by the specified 'other' snapshot to the
+        // values described by this snapshot.
+
+    void reset();
+        // Reset this snapshot to describe an empty histogram.
+
+    // ACCESSORS
+    Types::Int64 bucketCount(int index) const;
+        // Return the number of values held by the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < LatencyHistogramUtil::k_NUM_BUCKETS'.
+
+    Types::Int64 count() const;
+        // Return the number of values described by this snapshot.
+
+    Types::Int64 max() const;
+        // Return the greatest value described by this snapshot, or 0 if this
+        // snapshot is empty.
+
+    double mean() const;
+        // Return the mean of the values described by this snapshot, or 0 if
+        // this snapshot is empty.
+
+    Types::Int64 min() const;
+        // Return the least value described by this snapshot, or 0 if this
+        // snapshot is empty.
+
+    Types::Int64 sum() const;
+        // Return the sum of the values described by this snapshot.
+
+    Types::Int64 valueAtPercentile(double percentile) const;
+        // Return the value at the specified 'percentile' of the values
+        // described by this snapshot, or 0 if this snapshot is empty.  The
+        // result is the greatest value of the bucket holding the value of
+        // rank 'ceil(percentile / 100 * count())' (or of rank 1, if that is
+        // 0), limited to the range '[min(), max()]'.  The behavior is
+        // undefined unless '0 <= percentile <= 100'.
+};
+
+// FREE OPERATORS
+bool operator==(const LatencyHistogramSnapshot& lhs,
+                const LatencyHistogramSnapshot& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' snapshots have the same
+    // value, and 'false' otherwise.
+
+bool operator!=(const LatencyHistogramSnapshot& lhs,
+                const LatencyHistogramSnapshot& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' snapshots do not have
+    // the same value, and 'false' otherwise.
+
+                          // ======================
+                          // class LatencyHistogram
+                          // ======================
+
+class LatencyHistogram {
+    // This class provides a log-linear histogram of non-negative values into
+    // which any number of threads may record concurrently.  The counts are
+    // divided into stripes, each selected by a different subset of threads,
+    // to reduce contention.  See the component documentation for the
+    // precision of the histogram and the guarantees made to concurrent
+    // readers.
+
+    // PRIVATE TYPES
+    enum {
+        k_STRIPE_BITS = 2,                   // log2 of the number of stripes
+        k_NUM_STRIPES = 1 << k_STRIPE_BITS,  // number of stripes
+        k_CACHE_LINE  = 64                   // separation between stripes
+    };
+
+    struct Stripe {
+        // This 'struct' holds the counts of the values recorded by a subset
+        // of the threads using a histogram.
+
+        AtomicInt64 d_counts[LatencyHistogramUtil::k_NUM_BUCKETS];
+        AtomicInt64 d_sum;
+        AtomicInt64 d_min;
+        AtomicInt64 d_max;
+        char        d_padding[k_CACHE_LINE];
+    };
+
+    // DATA
+    Stripe d_stripes[k_NUM_STRIPES];
+
+  private:
+    // NOT IMPLEMENTED
+    LatencyHistogram(const LatencyHistogram&);
+    LatencyHistogram& operator=(const LatencyHistogram&);
+
+    // PRIVATE CLASS METHODS
+    static int stripeIndex();
+        // Return the index of the stripe used by the calling thread.
+
+  public:
+    // CREATORS
+    LatencyHistogram();
+        // Create an empty histogram.
+
+    //! ~LatencyHistogram();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.  A negative 'value'
+        // is recorded as 0.  This method may be called concurrently with
+        // 'record' and 'loadSnapshot'.
+
+    void reset();
+        // Reset this histogram to the empty state.  The behavior is undefined
+        // if this method is called concurrently with any other method of this
+        // histogram.
+
+    // ACCESSORS
+    void loadSnapshot(LatencyHistogramSnapshot *result) const;
+        // Load into the specified 'result' a snapshot of the values recorded
+        // in this histogram.  This method may be called concurrently with
+        // 'record' (see the component documentation).
+};
+
+                        // ===========================
+                        // class LocalLatencyHistogram
+                        // ===========================
+
+class LocalLatencyHistogram {
+    // This class provides a log-linear histogram of non-negative values into
+    // which one thread at a time may record, without atomic read-modify-write
+    // operations, and from which any thread may load a snapshot.  See the
+    // component documentation for the guarantees made to concurrent readers.
+
+    // DATA
+    AtomicInt64 d_counts[LatencyHistogramUtil::k_NUM_BUCKETS];
+                                      // count of values in each bucket
+
+    AtomicInt64 d_sum;                // sum of values
+
+    AtomicInt64 d_min;                // least value, or the greatest
+                                      // 'Types::Int64' value if empty
+
+    AtomicInt64 d_max;                // greatest value, or 0 if empty
+
+  private:
+    // NOT IMPLEMENTED
+    LocalLatencyHistogram(const LocalLatencyHistogram&);
+    LocalLatencyHistogram& operator=(const LocalLatencyHistogram&);
+
+  public:
+    // CREATORS
+    LocalLatencyHistogram();
+        // Create an empty histogram.
+
+    //! ~LocalLatencyHistogram();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.  A negative 'value'
+        // is recorded as 0.  This method may be called concurrently with
+        // 'loadSnapshot', but the behavior is undefined if it is called
+        // concurrently with 'record' or 'reset'.
+
+    void reset();
+        // Reset this histogram to the empty state.  The behavior is undefined
+        // if this method is called concurrently with any other method of this
+        // histogram.
+
+    // ACCESSORS
+    void loadSnapshot(LatencyHistogramSnapshot *result) const;
+        // Load into the specified 'result' a snapshot of the values recorded
+        // in this histogram.  This method may be called concurrently with
+        // 'record' (see the component documentation).
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // ---------------------------
+                       // struct LatencyHistogramUtil
+                       // ---------------------------
+
+// CLASS METHODS
+inline
+int LatencyHistogramUtil::bucketIndex(Types::Int64 value)
+{
+    const Types::Uint64 unsignedValue = static_cast<Types::Uint64>(value);
+
+    if (unsignedValue < static_cast<Types::Uint64>(k_SUB_BUCKET_COUNT)) {
+        return static_cast<int>(unsignedValue);                       // RETURN
+    }
+
+    // 'top' holds the 'k_SUB_BUCKET_BITS + 1' most significant bits of
+    // 'value', the first of which is set.
+
+    const int shift = numSignificantBits(unsignedValue)
+                    - k_SUB_BUCKET_BITS - 1;
+    const int top   = static_cast<int>(unsignedValue >> shift);
+
+    return (shift << k_SUB_BUCKET_BITS) + top;
+}
+
+inline
+Types::Int64 LatencyHistogramUtil::bucketLowerBound(int index)
+{
+    if (index < k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+    const int top   = (index & (k_SUB_BUCKET_COUNT - 1)) + k_SUB_BUCKET_COUNT;
+
+    return static_cast<Types::Int64>(static_cast<Types::Uint64>(top) << shift);
+}
+
+inline
+Types::Int64 LatencyHistogramUtil::bucketUpperBound(int index)
+{
+    if (index < k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+    const int top   = (index & (k_SUB_BUCKET_COUNT - 1)) + k_SUB_BUCKET_COUNT;
+
+    return static_cast<Types::Int64>(
+                       (static_cast<Types::Uint64>(top + 1) << shift) - 1);
+}
+
+inline
+int LatencyHistogramUtil::numSignificantBits(Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return value ? 64 - __builtin_clzll(value) : 0;
+#else
+    int result = 0;
+    for (int shift = 32; shift > 0; shift >>= 1) {
+        if (value >> shift) {
+            value  >>= shift;
+            result  += shift;
+        }
+    }
+    return result + static_cast<int>(value);
+#endif
+}
+
+                      // ------------------------------
+                      // class LatencyHistogramSnapshot
+                      // ------------------------------
+
+// ACCESSORS
+inline
+Types::Int64 LatencyHistogramSnapshot::bucketCount(int index) const
+{
+    return d_counts[index];
+}
+
+inline
+Types::Int64 LatencyHistogramSnapshot::count() const
+{
+    return d_count;
+}
+
+inline
+Types::Int64 LatencyHistogramSnapshot::max() const
+{
+    return d_count ? d_max : 0;
+}
+
+inline
+double LatencyHistogramSnapshot::mean() const
+{
+    return d_count ? static_cast<double>(d_sum) / static_cast<double>(d_count)
+                   : 0.0;
+}
+
+inline
+Types::Int64 LatencyHistogramSnapshot::min() const
+{
+    return d_count ? d_min : 0;
+}
+
+inline
+Types::Int64 LatencyHistogramSnapshot::sum() const
+{
+    return d_sum;
+}
+
+                          // ----------------------
+                          // class LatencyHistogram
+                          // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int LatencyHistogram::stripeIndex()
+{
+    // The stacks of distinct threads are at least tens of kilobytes apart, so
+    // the address of a local variable, ignoring its low-order bits, serves as
+    // a cheap identifier of the calling thread.  The identifier is mixed by a
+    // multiplicative hash, whose high-order bits select the stripe.
+
+    int                 local;
+    const Types::Uint64 address = reinterpret_cast<Types::UintPtr>(&local);
+
+    return static_cast<int>(((address >> 14) * 0x9E3779B97F4A7C15ULL)
+                                                      >> (64 - k_STRIPE_BITS));
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogram::record(Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    Stripe& stripe = d_stripes[stripeIndex()];
+
+    stripe.d_counts[LatencyHistogramUtil::bucketIndex(value)].addRelaxed(1);
+    stripe.d_sum.addRelaxed(value);
+
+    // The minimum and maximum change rarely once some values have been
+    // recorded, so test them before attempting to update them.
+
+    Types::Int64 current = stripe.d_max.loadRelaxed();
+    while (value > current) {
+        const Types::Int64 previous = stripe.d_max.testAndSwap(current,
+                                                                value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+
+    current = stripe.d_min.loadRelaxed();
+    while (value < current) {
+        const Types::Int64 previous = stripe.d_min.testAndSwap(current,
+                                                                value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
+                        // ---------------------------
+                        // class LocalLatencyHistogram
+                        // ---------------------------
+
+// MANIPULATORS
+inline
+void LocalLatencyHistogram::record(Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    // Only one thread records at a time, so each counter is updated by a
+    // load and a store, rather than by an atomic addition.  The sum is
+    // computed in unsigned arithmetic, so that it wraps, as an atomic
+    // addition does, rather than overflowing.
+
+    AtomicInt64& count = d_counts[LatencyHistogramUtil::bucketIndex(value)];
+    count.storeRelaxed(count.loadRelaxed() + 1);
+
+    d_sum.storeRelaxed(static_cast<Types::Int64>(
+                                static_cast<Types::Uint64>(d_sum.loadRelaxed())
+                              + static_cast<Types::Uint64>(value)));
+
+    if (value > d_max.loadRelaxed()) {
+        d_max.storeRelaxed(value);
+    }
+    if (value < d_min.loadRelaxed()) {
+        d_min.storeRelaxed(value);
+    }
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bsls::operator!=(const LatencyHistogramSnapshot& lhs,
+                      const LatencyHistogramSnapshot& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
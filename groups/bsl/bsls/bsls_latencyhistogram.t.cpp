@@ -0,0 +1,1095 @@
+// bsls_latencyhistogram.t.cpp                                        -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>           // printf()
+#include <stdlib.h>          // atoi(), qsort()
+
+// For thread support
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#   include <windows.h>
+
+typedef HANDLE thread_t;
+
+#else
+#   include <pthread.h>
+
+typedef pthread_t thread_t;
+
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a utility for the bucket arithmetic of a
+// log-linear histogram, a value-semantic snapshot, a thread-safe histogram,
+// and a single-writer histogram.  The bucket arithmetic is verified
+// exhaustively at each boundary between buckets.  The histogram and snapshot
+// are verified by recording known sets of values and comparing the statistics
+// of the snapshots loaded with those computed directly from the values, first
+// from a single thread and then from several threads concurrently.  The
+// single-writer histogram is verified by comparing its snapshots with those
+// of a thread-safe histogram into which the same values are recorded.  A
+// benchmark of 'record' is provided as a negative test case.
+//-----------------------------------------------------------------------------
+// CLASS METHODS ('LatencyHistogramUtil')
+// [ 2] int bucketIndex(Types::Int64 value);
+// [ 2] Types::Int64 bucketLowerBound(int index);
+// [ 2] Types::Int64 bucketUpperBound(int index);
+// [ 2] int numSignificantBits(Types::Uint64 value);
+//
+// 'LatencyHistogramSnapshot'
+// [ 3] LatencyHistogramSnapshot();
+// [ 3] void merge(const LatencyHistogramSnapshot& other);
+// [ 3] void reset();
+// [ 3] Types::Int64 bucketCount(int index) const;
+// [ 3] Types::Int64 count() const;
+// [ 3] Types::Int64 max() const;
+// [ 3] double mean() const;
+// [ 3] Types::Int64 min() const;
+// [ 3] Types::Int64 sum() const;
+// [ 4] Types::Int64 valueAtPercentile(double percentile) const;
+// [ 3] bool operator==(const Snapshot& lhs, const Snapshot& rhs);
+// [ 3] bool operator!=(const Snapshot& lhs, const Snapshot& rhs);
+//
+// 'LatencyHistogram'
+// [ 4] LatencyHistogram();
+// [ 4] void record(Types::Int64 value);
+// [ 4] void reset();
+// [ 4] void loadSnapshot(LatencyHistogramSnapshot *result) const;
+//
+// 'LocalLatencyHistogram'
+// [ 6] LocalLatencyHistogram();
+// [ 6] void record(Types::Int64 value);
+// [ 6] void reset();
+// [ 6] void loadSnapshot(LatencyHistogramSnapshot *result) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 5] CONCERN: Values recorded concurrently are all counted.
+// [-1] PERFORMANCE: COST OF 'record'
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::LatencyHistogram         Obj;
+typedef bsls::LocalLatencyHistogram    LocalObj;
+typedef bsls::LatencyHistogramSnapshot Snapshot;
+typedef bsls::LatencyHistogramUtil     Util;
+typedef bsls::Types::Int64             Int64;
+typedef bsls::Types::Uint64            Uint64;
+
+const Int64 MAX_INT64 = static_cast<Int64>(~static_cast<Uint64>(0) >> 1);
+
+//=============================================================================
+//                             HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *seed)
+    // Advance the specified 'seed' and return a pseudo-random 64-bit value.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed ^ (*seed >> 29);
+}
+
+Int64 nextLatency(Uint64 *seed)
+    // Advance the specified 'seed' and return a pseudo-random non-negative
+    // value whose magnitude is approximately log-uniformly distributed over
+    // the full range of 'Int64'.
+{
+    const Uint64 r = nextRandom(seed);
+    return static_cast<Int64>((r >> 1) >> (r % 63));
+}
+
+extern "C" int compareInt64(const void *lhs, const void *rhs)
+    // Return a negative value, zero, or a positive value if the 'Int64'
+    // addressed by the specified 'lhs' is less than, equal to, or greater
+    // than that addressed by the specified 'rhs', respectively.
+{
+    const Int64 a = *static_cast<const Int64 *>(lhs);
+    const Int64 b = *static_cast<const Int64 *>(rhs);
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+typedef void *(*ThreadFunction)(void *argument);
+
+thread_t createThread(ThreadFunction function, void *argument)
+    // Create a thread running the specified 'function' with the specified
+    // 'argument', and return its handle.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE) function, argument, 0,
+                        0);
+#else
+    thread_t thread;
+    pthread_create(&thread, 0, function, argument);
+    return thread;
+#endif
+}
+
+void joinThread(thread_t thread)
+    // Wait for the thread having the specified 'thread' handle to complete.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, 0);
+#endif
+}
+
+struct RecordingArguments {
+    // This 'struct' describes the work of a recording thread.
+
+    Obj  *d_histogram_p;    // histogram to record into
+    int   d_threadIndex;    // values recorded are 'd_threadIndex + 1000 * i'
+    int   d_numValues;      // number of values to record
+};
+
+extern "C" void *recordingThread(void *argument)
+    // Record into a histogram the values described by the specified
+    // 'argument', which must address a 'RecordingArguments' object.
+{
+    RecordingArguments *arguments =
+                                 static_cast<RecordingArguments *>(argument);
+
+    for (int i = 0; i < arguments->d_numValues; ++i) {
+        arguments->d_histogram_p->record(arguments->d_threadIndex
+                                         + 1000 * static_cast<Int64>(i % 64));
+    }
+    return 0;
+}
+
+struct LocalRecordingArguments {
+    // This 'struct' describes the work of a thread recording into a
+    // single-writer histogram.
+
+    LocalObj *d_histogram_p;  // histogram to record into
+    int       d_numValues;    // number of values to record ('0 .. N - 1')
+};
+
+extern "C" void *localRecordingThread(void *argument)
+    // Record into a single-writer histogram the values described by the
+    // specified 'argument', which must address a 'LocalRecordingArguments'
+    // object.
+{
+    LocalRecordingArguments *arguments =
+                            static_cast<LocalRecordingArguments *>(argument);
+
+    for (int i = 0; i < arguments->d_numValues; ++i) {
+        arguments->d_histogram_p->record(i);
+    }
+    return 0;
+}
+
+struct BenchmarkArguments {
+    // This 'struct' describes the work of a benchmark thread.
+
+    Obj    *d_histogram_p;  // histogram to record into
+    int     d_numValues;    // number of values to record
+    double  d_elapsed;      // elapsed time in nanoseconds (output)
+};
+
+extern "C" void *benchmarkThread(void *argument)
+    // Time the recording of pseudo-random values into the histogram described
+    // by the specified 'argument', which must address a 'BenchmarkArguments'
+    // object, and store the elapsed time in that object.
+{
+    BenchmarkArguments *arguments =
+                                 static_cast<BenchmarkArguments *>(argument);
+
+    Obj         *histogram = arguments->d_histogram_p;
+    const int    NUM       = arguments->d_numValues;
+    Uint64       seed      = reinterpret_cast<bsls::Types::UintPtr>(argument);
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < NUM; ++i) {
+        histogram->record(static_cast<Int64>(nextRandom(&seed) & 0xFFFFF));
+    }
+    arguments->d_elapsed =
+                  static_cast<double>(bsls::TimeUtil::getTimer() - start);
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+void processMessage(int *state)
+    // Process a message, updating the specified 'state'.
+{
+    for (int i = 0; i < 100; ++i) {
+        *state = *state * 31 + i;
+    }
+}
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+        bsls::LatencyHistogram latencies;
+
+        int state = 0;
+        for (int i = 0; i < 1000; ++i) {
+            const bsls::Types::Int64 start = bsls::TimeUtil::getFastTimer();
+            processMessage(&state);
+            latencies.record(bsls::TimeUtil::getFastTimer() - start);
+        }
+
+        bsls::LatencyHistogramSnapshot snapshot;
+        latencies.loadSnapshot(&snapshot);
+
+        ASSERT(1000 == snapshot.count());
+        ASSERT(snapshot.min() <= snapshot.valueAtPercentile(50.0));
+        ASSERT(snapshot.valueAtPercentile(50.0)
+                                         <= snapshot.valueAtPercentile(99.0));
+        ASSERT(snapshot.valueAtPercentile(99.0) <= snapshot.max());
+
+        bsls::LatencyHistogramSnapshot total;
+        total.merge(snapshot);
+        total.merge(snapshot);
+
+        ASSERT(2000           == total.count());
+        ASSERT(snapshot.max() == total.max());
+
+        if (verbose) {
+            T_ P_(snapshot.valueAtPercentile(50.0))
+            P(snapshot.valueAtPercentile(99.0))
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'LocalLatencyHistogram'
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty.
+        //:
+        //: 2 The snapshot of a single-writer histogram has the same value as
+        //:   that of a thread-safe histogram into which the same values are
+        //:   recorded, including negative values, the greatest 'Int64' value,
+        //:   and values whose sum overflows.
+        //:
+        //: 3 'reset' empties the histogram.
+        //:
+        //: 4 Snapshots loaded by another thread while one thread records have
+        //:   counts that do not decrease from one snapshot to the next, and
+        //:   the final snapshot is exact.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Record the same pseudo-random values into a 'LatencyHistogram'
+        //:   and a 'LocalLatencyHistogram', and compare their snapshots after
+        //:   each of a number of values.  (C-1..3)
+        //:
+        //: 2 Record values from one thread while loading snapshots from
+        //:   another.  (C-4)
+        //:
+        //: 3 Verify that a null snapshot address is detected.  (C-5)
+        //
+        // Testing:
+        //   LocalLatencyHistogram();
+        //   void record(Types::Int64 value);
+        //   void reset();
+        //   void loadSnapshot(LatencyHistogramSnapshot *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'LocalLatencyHistogram'"
+                            "\n=======================\n");
+
+        {
+            Obj      mX;  const Obj&      X = mX;
+            LocalObj mY;  const LocalObj& Y = mY;
+
+            Snapshot x;
+            Snapshot y;
+
+            Y.loadSnapshot(&y);
+            ASSERT(Snapshot() == y);
+
+            mX.record(-1);           mY.record(-1);
+            mX.record(MAX_INT64);    mY.record(MAX_INT64);
+
+            Uint64 seed = 3;
+            for (int i = 0; i < 10000; ++i) {
+                const Int64 VALUE = nextLatency(&seed);
+                mX.record(VALUE);
+                mY.record(VALUE);
+
+                if (0 == i % 997) {
+                    X.loadSnapshot(&x);
+                    Y.loadSnapshot(&y);
+                    ASSERTV(i, x == y);
+                }
+            }
+            X.loadSnapshot(&x);
+            Y.loadSnapshot(&y);
+            ASSERT(x == y);
+            ASSERT(10002     == y.count());
+            ASSERT(0         == y.min());
+            ASSERT(MAX_INT64 == y.max());
+
+            mY.reset();
+            Y.loadSnapshot(&y);
+            ASSERT(Snapshot() == y);
+
+            mY.record(5);
+            Y.loadSnapshot(&y);
+            ASSERT(1 == y.count());
+            ASSERT(5 == y.min());
+            ASSERT(5 == y.max());
+            ASSERT(5 == y.sum());
+        }
+
+        if (verbose) printf("\tConcurrent snapshots.\n");
+        {
+            enum { k_NUM_VALUES = 1000000 };
+
+            LocalObj mY;  const LocalObj& Y = mY;
+
+            LocalRecordingArguments arguments = { &mY, k_NUM_VALUES };
+
+            thread_t thread = createThread(&localRecordingThread, &arguments);
+
+            Snapshot previous;
+            for (int i = 0; i < 100; ++i) {
+                Snapshot current;
+                Y.loadSnapshot(&current);
+
+                ASSERTV(i, previous.count() <= current.count());
+                ASSERTV(i, current.count() <= k_NUM_VALUES);
+                ASSERTV(i, current.min() <= current.max());
+                previous = current;
+            }
+
+            joinThread(thread);
+
+            Snapshot snapshot;
+            Y.loadSnapshot(&snapshot);
+            ASSERT(k_NUM_VALUES == snapshot.count());
+            ASSERT(0 == snapshot.min());
+            ASSERT(k_NUM_VALUES - 1 == snapshot.max());
+            ASSERT(static_cast<Int64>(k_NUM_VALUES) * (k_NUM_VALUES - 1) / 2
+                                                            == snapshot.sum());
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            LocalObj mY;  const LocalObj& Y = mY;
+            Snapshot snapshot;
+
+            ASSERT_PASS(Y.loadSnapshot(&snapshot));
+            ASSERT_FAIL(Y.loadSnapshot(0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT RECORDING
+        //
+        // Concerns:
+        //: 1 Every value recorded concurrently by several threads is counted
+        //:   in the bucket holding it, and in the sum, minimum, and maximum.
+        //:
+        //: 2 Snapshots loaded concurrently with recording have counts that do
+        //:   not decrease from one snapshot to the next, and that do not
+        //:   exceed the number of values recorded.
+        //
+        // Plan:
+        //: 1 Start several threads, each recording a distinct, known set of
+        //:   values, and load snapshots repeatedly while they run.  Verify
+        //:   the snapshots loaded during recording and, after joining the
+        //:   threads, compare the final snapshot with the expected
+        //:   statistics.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Values recorded concurrently are all counted.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT RECORDING"
+                            "\n====================\n");
+
+        enum { k_NUM_THREADS = 8, k_NUM_VALUES = 200000 };
+
+        Obj mX;  const Obj& X = mX;
+
+        RecordingArguments arguments[k_NUM_THREADS];
+        thread_t           threads[k_NUM_THREADS];
+
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            arguments[t].d_histogram_p = &mX;
+            arguments[t].d_threadIndex = t;
+            arguments[t].d_numValues   = k_NUM_VALUES;
+            threads[t] = createThread(&recordingThread, &arguments[t]);
+        }
+
+        Snapshot previous;
+        for (int i = 0; i < 100; ++i) {
+            Snapshot current;
+            X.loadSnapshot(&current);
+
+            ASSERTV(i, previous.count() <= current.count());
+            ASSERTV(i, current.count() <= k_NUM_THREADS * k_NUM_VALUES);
+            for (int b = 0; b < Util::k_NUM_BUCKETS; ++b) {
+                ASSERTV(i, b, previous.bucketCount(b) <=
+                                                       current.bucketCount(b));
+            }
+            previous = current;
+        }
+
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            joinThread(threads[t]);
+        }
+
+        Snapshot snapshot;
+        X.loadSnapshot(&snapshot);
+
+        // Thread 't' records 'k_NUM_VALUES / 64' copies of each value
+        // 't + 1000 * j', for 'j' in '[0, 64)'.
+
+        Int64 expectedSum = 0;
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            for (int j = 0; j < 64; ++j) {
+                expectedSum += (t + 1000 * static_cast<Int64>(j))
+                                                         * (k_NUM_VALUES / 64);
+            }
+        }
+
+        ASSERTV(snapshot.count(), k_NUM_THREADS * k_NUM_VALUES ==
+                                                             snapshot.count());
+        ASSERTV(snapshot.sum(), expectedSum == snapshot.sum());
+        ASSERTV(snapshot.min(), 0 == snapshot.min());
+        ASSERTV(snapshot.max(), k_NUM_THREADS - 1 + 63000 == snapshot.max());
+
+        for (int j = 0; j < 64; ++j) {
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                const Int64 value = t + 1000 * j;
+                const int   index = Util::bucketIndex(value);
+
+                Int64 expected = 0;
+                for (int k = 0; k < 64; ++k) {
+                    for (int u = 0; u < k_NUM_THREADS; ++u) {
+                        if (index == Util::bucketIndex(u + 1000 * k)) {
+                            expected += k_NUM_VALUES / 64;
+                        }
+                    }
+                }
+                ASSERTV(j, t, expected == snapshot.bucketCount(index));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RECORDING AND PERCENTILES
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty.
+        //:
+        //: 2 Each value recorded is counted in the bucket holding it, and the
+        //:   count, sum, minimum, and maximum of a snapshot are exact.
+        //:
+        //: 3 Negative values are recorded as 0, and the greatest 'Int64' value
+        //:   is recorded correctly.
+        //:
+        //: 4 'valueAtPercentile' returns a value no less than the exact value
+        //:   at that percentile, and greater by no more than the width of its
+        //:   bucket; it returns the minimum for very small percentiles, the
+        //:   maximum for the 100th percentile, and 0 for an empty snapshot.
+        //:
+        //: 5 'reset' empties the histogram.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Record sets of pseudo-random values spanning the full range of
+        //:   'Int64', and of values in a narrow range, and compare the
+        //:   snapshots with statistics computed from the sorted values.
+        //:   (C-1..4)
+        //:
+        //: 2 Reset the histogram and verify that a snapshot is empty.  (C-5)
+        //:
+        //: 3 Verify that percentiles outside '[0, 100]' and a null snapshot
+        //:   address are detected.  (C-6)
+        //
+        // Testing:
+        //   LatencyHistogram();
+        //   void record(Types::Int64 value);
+        //   void reset();
+        //   void loadSnapshot(LatencyHistogramSnapshot *result) const;
+        //   Types::Int64 valueAtPercentile(double percentile) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRECORDING AND PERCENTILES"
+                            "\n=========================\n");
+
+        enum { k_NUM_VALUES = 10000 };
+
+        static Int64 values[k_NUM_VALUES];
+
+        const Int64 RANGES[] = { 0, 1000, 1000000 };
+        const int   NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+        for (int ri = 0; ri < NUM_RANGES; ++ri) {
+            const Int64 RANGE = RANGES[ri];
+            if (veryVerbose) { T_ P(RANGE) }
+
+            Obj mX;  const Obj& X = mX;
+
+            Snapshot snapshot;
+            X.loadSnapshot(&snapshot);
+            ASSERT(Snapshot() == snapshot);
+            ASSERT(0 == snapshot.valueAtPercentile(50.0));
+
+            Uint64 seed  = ri + 1;
+            Int64  sum   = 0;
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                values[i] = RANGE
+                          ? 1000 + static_cast<Int64>(
+                               nextRandom(&seed) % static_cast<Uint64>(RANGE))
+                          : nextLatency(&seed);
+                mX.record(values[i]);
+
+                // Overflow of the sum is well-defined for the (unsigned)
+                // arithmetic used here, and is matched by the histogram.
+
+                sum = static_cast<Int64>(static_cast<Uint64>(sum)
+                                         + static_cast<Uint64>(values[i]));
+            }
+
+            qsort(values, k_NUM_VALUES, sizeof *values, &compareInt64);
+
+            X.loadSnapshot(&snapshot);
+            ASSERTV(ri, k_NUM_VALUES == snapshot.count());
+            ASSERTV(ri, values[0] == snapshot.min());
+            ASSERTV(ri, values[k_NUM_VALUES - 1] == snapshot.max());
+            if (RANGE) {
+                ASSERTV(ri, sum == snapshot.sum());
+            }
+
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                const int index = Util::bucketIndex(values[i]);
+                ASSERTV(ri, i, 0 < snapshot.bucketCount(index));
+            }
+
+            const double PERCENTILES[] = { 0.0, 0.001, 1.0, 10.0, 25.0, 50.0,
+                                           75.0, 90.0, 99.0, 99.9, 99.99,
+                                           100.0 };
+            const int NUM_PERCENTILES = sizeof PERCENTILES
+                                      / sizeof *PERCENTILES;
+
+            for (int pi = 0; pi < NUM_PERCENTILES; ++pi) {
+                const double PERCENTILE = PERCENTILES[pi];
+
+                int rank = static_cast<int>(PERCENTILE / 100.0
+                                                                * k_NUM_VALUES
+                                            + 0.999999);
+                if (rank < 1) {
+                    rank = 1;
+                }
+                const Int64 EXACT  = values[rank - 1];
+                const Int64 RESULT = snapshot.valueAtPercentile(PERCENTILE);
+
+                if (veryVerbose) { T_ T_ P_(PERCENTILE) P_(EXACT) P(RESULT) }
+
+                ASSERTV(ri, PERCENTILE, EXACT, RESULT, EXACT <= RESULT);
+                ASSERTV(ri, PERCENTILE, EXACT, RESULT,
+                        RESULT - EXACT <= EXACT / Util::k_SUB_BUCKET_COUNT);
+            }
+            ASSERTV(ri, values[k_NUM_VALUES - 1] ==
+                                          snapshot.valueAtPercentile(100.0));
+
+            mX.reset();
+            X.loadSnapshot(&snapshot);
+            ASSERTV(ri, Snapshot() == snapshot);
+        }
+
+        if (verbose) printf("\tExtreme values.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.record(-5);
+            mX.record(MAX_INT64);
+
+            Snapshot snapshot;
+            X.loadSnapshot(&snapshot);
+
+            ASSERT(2         == snapshot.count());
+            ASSERT(0         == snapshot.min());
+            ASSERT(MAX_INT64 == snapshot.max());
+            ASSERT(MAX_INT64 == snapshot.sum());
+            ASSERT(1         == snapshot.bucketCount(0));
+            ASSERT(1         == snapshot.bucketCount(Util::k_NUM_BUCKETS - 1));
+            ASSERT(0         == snapshot.valueAtPercentile(50.0));
+            ASSERT(MAX_INT64 == snapshot.valueAtPercentile(50.1));
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj      mX;  const Obj& X = mX;
+            Snapshot snapshot;
+
+            ASSERT_PASS(X.loadSnapshot(&snapshot));
+            ASSERT_FAIL(X.loadSnapshot(0));
+
+            ASSERT_PASS(snapshot.valueAtPercentile(  0.0));
+            ASSERT_PASS(snapshot.valueAtPercentile(100.0));
+            ASSERT_FAIL(snapshot.valueAtPercentile( -0.1));
+            ASSERT_FAIL(snapshot.valueAtPercentile(100.1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SNAPSHOT VALUE SEMANTICS AND MERGING
+        //
+        // Concerns:
+        //: 1 A default-constructed snapshot is empty: its count, sum, minimum,
+        //:   maximum, mean, and bucket counts are all 0.
+        //:
+        //: 2 Copies and assigned snapshots have the value of their source, and
+        //:   the equality operators compare all of the salient attributes.
+        //:
+        //: 3 'merge' adds the bucket counts, counts, and sums, and takes the
+        //:   lesser minimum and greater maximum, and merging an empty snapshot
+        //:   has no effect.
+        //:
+        //: 4 'reset' restores the empty state.
+        //
+        // Plan:
+        //: 1 Load snapshots of histograms into which known values have been
+        //:   recorded, and verify the accessors, copies, comparisons, merges,
+        //:   and resets of those snapshots.  (C-1..4)
+        //
+        // Testing:
+        //   LatencyHistogramSnapshot();
+        //   void merge(const LatencyHistogramSnapshot& other);
+        //   void reset();
+        //   Types::Int64 bucketCount(int index) const;
+        //   Types::Int64 count() const;
+        //   Types::Int64 max() const;
+        //   double mean() const;
+        //   Types::Int64 min() const;
+        //   Types::Int64 sum() const;
+        //   bool operator==(const Snapshot& lhs, const Snapshot& rhs);
+        //   bool operator!=(const Snapshot& lhs, const Snapshot& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSNAPSHOT VALUE SEMANTICS AND MERGING"
+                            "\n====================================\n");
+
+        const Snapshot EMPTY;
+
+        ASSERT(0   == EMPTY.count());
+        ASSERT(0   == EMPTY.sum());
+        ASSERT(0   == EMPTY.min());
+        ASSERT(0   == EMPTY.max());
+        ASSERT(0.0 == EMPTY.mean());
+        for (int i = 0; i < Util::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == EMPTY.bucketCount(i));
+        }
+        ASSERT(EMPTY == EMPTY);
+        ASSERT(!(EMPTY != EMPTY));
+
+        Obj mA;  const Obj& A = mA;
+        Obj mB;  const Obj& B = mB;
+
+        mA.record(10);
+        mA.record(20);
+        mA.record(3000);
+
+        mB.record(5);
+        mB.record(20);
+
+        Snapshot sa;  A.loadSnapshot(&sa);  const Snapshot& SA = sa;
+        Snapshot sb;  B.loadSnapshot(&sb);  const Snapshot& SB = sb;
+
+        ASSERT(3    == SA.count());
+        ASSERT(3030 == SA.sum());
+        ASSERT(10   == SA.min());
+        ASSERT(3000 == SA.max());
+        ASSERT(1010.0 == SA.mean());
+        ASSERT(1    == SA.bucketCount(Util::bucketIndex(10)));
+        ASSERT(1    == SA.bucketCount(Util::bucketIndex(20)));
+        ASSERT(1    == SA.bucketCount(Util::bucketIndex(3000)));
+
+        ASSERT(SA != EMPTY);
+        ASSERT(SA != SB);
+
+        if (verbose) printf("\tCopy and assignment.\n");
+        {
+            Snapshot mC(SA);  const Snapshot& C = mC;
+            ASSERT(SA == C);
+
+            mC = SB;
+            ASSERT(SB == C);
+
+            mC = C;
+            ASSERT(SB == C);
+        }
+
+        if (verbose) printf("\tEquality of each attribute.\n");
+        {
+            // Snapshots differing only in the bucket of one value.
+
+            Obj mX;  mX.record(10);  mX.record(20);  mX.record(3001);
+            Obj mY;  mY.record(10);  mY.record(20);  mY.record(3100);
+
+            Snapshot x;  mX.loadSnapshot(&x);
+            Snapshot y;  mY.loadSnapshot(&y);
+
+            ASSERT(SA != x);   // sum and maximum differ
+            ASSERT(SA != y);   // bucket, sum, and maximum differ
+            ASSERT(x  != y);
+        }
+
+        if (verbose) printf("\tMerge.\n");
+        {
+            Snapshot mC(SA);  const Snapshot& C = mC;
+
+            mC.merge(EMPTY);
+            ASSERT(SA == C);
+
+            mC.merge(SB);
+            ASSERT(5    == C.count());
+            ASSERT(3055 == C.sum());
+            ASSERT(5    == C.min());
+            ASSERT(3000 == C.max());
+            ASSERT(2    == C.bucketCount(Util::bucketIndex(20)));
+
+            // Merging is equivalent to recording into one histogram.
+
+            Obj mAB;
+            mAB.record(10);  mAB.record(20);  mAB.record(3000);
+            mAB.record(5);   mAB.record(20);
+
+            Snapshot ab;  mAB.loadSnapshot(&ab);
+            ASSERT(ab == C);
+
+            Snapshot mD;  const Snapshot& D = mD;
+            mD.merge(SB);
+            mD.merge(SA);
+            ASSERT(C == D);
+        }
+
+        if (verbose) printf("\tReset.\n");
+        {
+            Snapshot mC(SA);  const Snapshot& C = mC;
+            mC.reset();
+            ASSERT(EMPTY == C);
+            ASSERT(0 == C.min());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'LatencyHistogramUtil'
+        //
+        // Concerns:
+        //: 1 'numSignificantBits' returns the position of the most significant
+        //:   set bit, and 0 for 0.
+        //:
+        //: 2 Values less than 'k_SUB_BUCKET_COUNT' have buckets of their own.
+        //:
+        //: 3 The buckets are contiguous and cover '[0, MAX_INT64]', and each
+        //:   value is mapped to the bucket whose bounds contain it.
+        //:
+        //: 4 The width of each bucket is at most '1 / k_SUB_BUCKET_COUNT' of
+        //:   its lower bound (for buckets beyond the exact ones).
+        //
+        // Plan:
+        //: 1 Check 'numSignificantBits' for 0 and for each power of two, and
+        //:   the values adjacent to it.  (C-1)
+        //:
+        //: 2 For each bucket, verify its bounds against those of its
+        //:   neighbors, and that its bounds and the values adjacent to them
+        //:   are mapped to the expected buckets.  (C-2..4)
+        //:
+        //: 3 Verify the mapping of pseudo-random values.  (C-3)
+        //
+        // Testing:
+        //   int bucketIndex(Types::Int64 value);
+        //   Types::Int64 bucketLowerBound(int index);
+        //   Types::Int64 bucketUpperBound(int index);
+        //   int numSignificantBits(Types::Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'LatencyHistogramUtil'"
+                            "\n======================\n");
+
+        ASSERT(0 == Util::numSignificantBits(0));
+        for (int bit = 0; bit < 64; ++bit) {
+            const Uint64 POWER = 1ULL << bit;
+            ASSERTV(bit, bit + 1 == Util::numSignificantBits(POWER));
+            ASSERTV(bit, bit     == Util::numSignificantBits(POWER - 1));
+            ASSERTV(bit, bit + 1 == Util::numSignificantBits(
+                                                        POWER | (POWER - 1)));
+        }
+
+        ASSERT(1888 == Util::k_NUM_BUCKETS);
+
+        for (int i = 0; i < Util::k_SUB_BUCKET_COUNT; ++i) {
+            ASSERTV(i, i == Util::bucketIndex(i));
+            ASSERTV(i, i == Util::bucketLowerBound(i));
+            ASSERTV(i, i == Util::bucketUpperBound(i));
+        }
+
+        ASSERT(0         == Util::bucketLowerBound(0));
+        ASSERT(MAX_INT64 == Util::bucketUpperBound(Util::k_NUM_BUCKETS - 1));
+
+        for (int i = 0; i < Util::k_NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Util::bucketLowerBound(i);
+            const Int64 UPPER = Util::bucketUpperBound(i);
+
+            ASSERTV(i, LOWER <= UPPER);
+            ASSERTV(i, i == Util::bucketIndex(LOWER));
+            ASSERTV(i, i == Util::bucketIndex(UPPER));
+            ASSERTV(i, i == Util::bucketIndex(LOWER + (UPPER - LOWER) / 2));
+
+            if (i >= Util::k_SUB_BUCKET_COUNT) {
+                ASSERTV(i, UPPER - LOWER < LOWER / Util::k_SUB_BUCKET_COUNT);
+            }
+            if (i > 0) {
+                ASSERTV(i, Util::bucketUpperBound(i - 1) + 1 == LOWER);
+                ASSERTV(i, i - 1 == Util::bucketIndex(LOWER - 1));
+            }
+        }
+
+        Uint64 seed = 7;
+        for (int i = 0; i < 100000; ++i) {
+            const Int64 VALUE = nextLatency(&seed);
+            const int   INDEX = Util::bucketIndex(VALUE);
+
+            ASSERTV(VALUE, 0 <= INDEX);
+            ASSERTV(VALUE, INDEX < Util::k_NUM_BUCKETS);
+            ASSERTV(VALUE, Util::bucketLowerBound(INDEX) <= VALUE);
+            ASSERTV(VALUE, VALUE <= Util::bucketUpperBound(INDEX));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a few values, load a snapshot, and examine it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.record(i);
+        }
+
+        Snapshot snapshot;
+        X.loadSnapshot(&snapshot);
+
+        ASSERT(100  == snapshot.count());
+        ASSERT(5050 == snapshot.sum());
+        ASSERT(1    == snapshot.min());
+        ASSERT(100  == snapshot.max());
+        ASSERT(50.5 == snapshot.mean());
+
+        const Int64 MEDIAN = snapshot.valueAtPercentile(50.0);
+        if (verbose) { T_ P(MEDIAN) }
+        ASSERT(50 <= MEDIAN);
+        ASSERT(MEDIAN <= 51);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF 'record'
+        //
+        // Concerns:
+        //: 1 Measure the cost of 'record', from one thread and from several
+        //:   threads recording into the same histogram.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, have each thread record a number of
+        //:   pseudo-random values (10,000,000 by default, or as specified by
+        //:   the second argument), and print the average time per 'record'
+        //:   as seen by each thread.
+        //
+        // Testing:
+        //   PERFORMANCE: COST OF 'record'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: COST OF 'record'"
+               "\n=============================\n");
+
+        const int NUM_VALUES = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        enum { k_MAX_THREADS = 8 };
+
+        for (int numThreads = 1;
+             numThreads <= k_MAX_THREADS;
+             numThreads *= 2) {
+            Obj mX;
+
+            BenchmarkArguments arguments[k_MAX_THREADS];
+            thread_t           threads[k_MAX_THREADS];
+
+            for (int t = 0; t < numThreads; ++t) {
+                arguments[t].d_histogram_p = &mX;
+                arguments[t].d_numValues   = NUM_VALUES;
+                arguments[t].d_elapsed     = 0.0;
+                threads[t] = createThread(&benchmarkThread, &arguments[t]);
+            }
+
+            double elapsed = 0.0;
+            for (int t = 0; t < numThreads; ++t) {
+                joinThread(threads[t]);
+                elapsed += arguments[t].d_elapsed;
+            }
+
+            Snapshot snapshot;
+            mX.loadSnapshot(&snapshot);
+            ASSERT(static_cast<Int64>(numThreads) * NUM_VALUES ==
+                                                             snapshot.count());
+
+            printf("threads: %d  ns/record: %.2f  p50: %lld  p99: %lld\n",
+                   numThreads,
+                   elapsed / numThreads / NUM_VALUES,
+                   snapshot.valueAtPercentile(50.0),
+                   snapshot.valueAtPercentile(99.0));
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,218 @@
+// bsls_spinparklock.cpp                                              -*-C++-*-
+#include <bsls_spinparklock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #include <linux/futex.h>  // FUTEX_WAIT, FUTEX_WAKE
+    #include <sys/syscall.h>  // SYS_futex
+    #include <unistd.h>       // syscall()
+    #define BSLS_SPINPARKLOCK_USE_FUTEX 1
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    #include <windows.h>      // SwitchToThread(), YieldProcessor()
+#else
+    #include <sched.h>        // sched_yield()
+#endif
+
+#if defined(BSLS_SPINPARKLOCK_USE_FUTEX) && !defined(FUTEX_PRIVATE_FLAG)
+    // Kernels before 2.6.22 do not support process-private futexes; the
+    // shared variants are correct, if somewhat slower.
+
+    #define FUTEX_WAIT_PRIVATE FUTEX_WAIT
+    #define FUTEX_WAKE_PRIVATE FUTEX_WAKE
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_NUM_SPIN_ROUNDS  = 10,  // rounds of spinning before parking
+
+    k_MAX_ROUND_LENGTH = 64   // upper bound on the number of spin-wait hints
+                              // executed in a single round
+};
+
+struct Statistics {
+    // This 'struct' holds the process-wide contention counts for all
+    // 'bsls::SpinParkLock' objects.  Objects of this type have static storage
+    // duration only, and so are zero-initialized before any lock is used.
+
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numContendedLocks;
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numSpins;
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numParks;
+    bsls::AtomicOperations::AtomicTypes::Int64 d_numWakes;
+};
+
+Statistics s_statistics;
+
+inline
+void spinWaitHint()
+    // Inform the processor that the calling thread is in a spin-wait loop, so
+    // that it may yield pipeline resources to a sibling hardware thread and
+    // avoid the memory-order mis-speculation penalty on leaving the loop.
+{
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)) \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    asm volatile("pause" ::: "memory");
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    YieldProcessor();
+#endif
+}
+
+inline
+void park(bsls::AtomicOperations::AtomicTypes::Int *state, int expected)
+    // Suspend the calling thread while the specified '*state' has the
+    // specified 'expected' value, or until it is woken by 'unpark'.  Note
+    // that this function may return spuriously, and that, on platforms
+    // lacking an address-based wait facility, it merely yields the processor.
+{
+#if defined(BSLS_SPINPARKLOCK_USE_FUTEX)
+    // 'AtomicTypes::Int' wraps a single, suitably aligned 'int'.
+
+    syscall(SYS_futex,
+            reinterpret_cast<int *>(state),
+            FUTEX_WAIT_PRIVATE,
+            expected,
+            0,
+            0,
+            0);
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    (void)state;
+    (void)expected;
+    SwitchToThread();
+#else
+    (void)state;
+    (void)expected;
+    sched_yield();
+#endif
+}
+
+inline
+void unpark(bsls::AtomicOperations::AtomicTypes::Int *state)
+    // Wake one thread suspended in 'park' on the specified 'state', if any.
+{
+#if defined(BSLS_SPINPARKLOCK_USE_FUTEX)
+    syscall(SYS_futex,
+            reinterpret_cast<int *>(state),
+            FUTEX_WAKE_PRIVATE,
+            1,
+            0,
+            0,
+            0);
+#else
+    (void)state;
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                            // ------------------
+                            // class SpinParkLock
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+void SpinParkLock::lockContended()
+{
+    // Spin phase: re-try the acquisition between rounds of spin-wait hints
+    // whose length doubles, up to 'k_MAX_ROUND_LENGTH', after each round.
+    // Reading the lock word before attempting the compare-and-swap keeps the
+    // cache line shared while the lock is held.
+
+    Types::Int64 numSpins    = 0;
+    int          roundLength = 1;
+
+    for (int round = 0; round < k_NUM_SPIN_ROUNDS; ++round) {
+        for (int i = 0; i < roundLength; ++i) {
+            spinWaitHint();
+        }
+        numSpins += roundLength;
+
+        if (k_UNLOCKED == AtomicOperations::getIntRelaxed(&d_state)
+         && k_UNLOCKED == AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                                 k_UNLOCKED,
+                                                                 k_LOCKED)) {
+            AtomicOperations::addInt64Relaxed(
+                                          &s_statistics.d_numContendedLocks,
+                                          1);
+            AtomicOperations::addInt64Relaxed(&s_statistics.d_numSpins,
+                                              numSpins);
+            return;                                                   // RETURN
+        }
+
+        if (roundLength < k_MAX_ROUND_LENGTH) {
+            roundLength *= 2;
+        }
+    }
+
+    // Park phase: mark the lock as having waiters, and park until the lock is
+    // observed to be free.  A thread acquiring the lock here must leave it in
+    // the "waiters" state, as other threads may still be parked.
+
+    Types::Int64 numParks = 0;
+
+    while (k_UNLOCKED != AtomicOperations::swapIntAcqRel(&d_state,
+                                                         k_LOCKED_WAITERS)) {
+        park(&d_state, k_LOCKED_WAITERS);
+        ++numParks;
+    }
+
+    AtomicOperations::addInt64Relaxed(&s_statistics.d_numContendedLocks, 1);
+    AtomicOperations::addInt64Relaxed(&s_statistics.d_numSpins, numSpins);
+    AtomicOperations::addInt64Relaxed(&s_statistics.d_numParks, numParks);
+}
+
+void SpinParkLock::wakeOne()
+{
+    AtomicOperations::addInt64Relaxed(&s_statistics.d_numWakes, 1);
+
+    unpark(&d_state);
+}
+
+// CLASS METHODS
+void SpinParkLock::resetStatistics()
+{
+    AtomicOperations::setInt64Relaxed(&s_statistics.d_numContendedLocks, 0);
+    AtomicOperations::setInt64Relaxed(&s_statistics.d_numSpins, 0);
+    AtomicOperations::setInt64Relaxed(&s_statistics.d_numParks, 0);
+    AtomicOperations::setInt64Relaxed(&s_statistics.d_numWakes, 0);
+}
+
+SpinParkLockStatistics SpinParkLock::statistics()
+{
+    return SpinParkLockStatistics(
+         AtomicOperations::getInt64Relaxed(&s_statistics.d_numContendedLocks),
+         AtomicOperations::getInt64Relaxed(&s_statistics.d_numSpins),
+         AtomicOperations::getInt64Relaxed(&s_statistics.d_numParks),
+         AtomicOperations::getInt64Relaxed(&s_statistics.d_numWakes));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
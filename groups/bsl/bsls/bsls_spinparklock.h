@@ -0,0 +1,489 @@
+// bsls_spinparklock.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLS_SPINPARKLOCK
+#define INCLUDED_BSLS_SPINPARKLOCK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a compact adaptive mutex that spins before parking.
+//
+//@CLASSES:
+//  bsls::SpinParkLock: 4-byte mutex that spins, then parks, when contended
+//  bsls::SpinParkLockGuard: RAII mechanism for locking a 'SpinParkLock'
+//  bsls::SpinParkLockStatistics: process-wide contention counts
+//
+//@SEE_ALSO: bsls_bsllock, bslmt_mutex
+//
+//@DESCRIPTION: This component provides a mutually exclusive lock primitive
+// ("mutex"), 'bsls::SpinParkLock', that occupies a single 4-byte atomic
+// integer and is intended as a drop-in replacement for 'bsls::BslLock' in code
+// whose critical sections are short and frequently entered (e.g., the
+// bookkeeping of 'bslma::TestAllocator').  Like 'bsls::BslLock', the lock is
+// *not* recursive, and it is not intended for direct client use; see
+// 'bslmt_mutex' instead.
+//
+// This component also provides the 'bsls::SpinParkLockGuard' class, a
+// mechanism that follows the RAII idiom for automatically acquiring and
+// releasing the lock on an associated 'bsls::SpinParkLock' object, and that
+// has the same interface as 'bsls::BslLockGuard'.
+//
+///Locking Protocol
+///----------------
+// The lock word holds one of three states: unlocked (0), locked with no
+// parked waiters (1), and locked with possibly-parked waiters (2).  An
+// uncontended 'lock' is a single compare-and-swap from 0 to 1, and an
+// uncontended 'unlock' is a single exchange to 0; neither makes a system call
+// nor touches any memory other than the lock word.
+//
+// A thread that finds the lock held first *spins*: it executes a bounded
+// number of rounds of the processor's spin-wait hint ('pause' on x86),
+// doubling the length of each round (exponential backoff) and re-trying the
+// acquisition between rounds.  Only if the lock is still unavailable after
+// the spin budget is exhausted does the thread mark the lock word as 2 and
+// *park* -- on Linux, by waiting on the lock word with the 'futex' system
+// call.  An 'unlock' that observes state 2 wakes exactly one parked thread.
+// On platforms without 'futex', parking degrades to yielding the processor,
+// which preserves correctness at the cost of efficiency under heavy
+// contention.
+//
+///Contention Statistics
+///---------------------
+// So as not to grow the 4-byte lock word, contention statistics are kept
+// process-wide, for all 'bsls::SpinParkLock' objects together, and are
+// updated only on the contended path; the uncontended 'lock' and 'unlock' pay
+// nothing for them.  'bsls::SpinParkLock::statistics' returns a
+// 'bsls::SpinParkLockStatistics' object holding the number of contended
+// acquisitions, spin-wait iterations, parks, and wake-ups recorded since
+// program start (or the last call to 'bsls::SpinParkLock::resetStatistics').
+// The counts are maintained with relaxed atomic operations, and so are
+// approximate while other threads are concurrently locking.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Using 'bsls::SpinParkLock' to Make a 'class' Thread-Safe
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we illustrate the use of 'bsls::SpinParkLock' and
+// 'bsls::SpinParkLockGuard' to protect a counter that is updated by many
+// threads in a short critical section.
+//
+// First, we define a 'my_HitCounter' class that tallies hits per key.  Note
+// the 'd_lock' data member of type 'bsls::SpinParkLock', which adds just 4
+// bytes to the footprint of the class:
+//..
+//  class my_HitCounter {
+//      // This 'class' counts hits on a small, fixed set of keys.  It is meant
+//      // for illustrative purposes only.
+//
+//      // DATA
+//      int                        d_hits[16];  // hits per key
+//      int                        d_total;     // sum of 'd_hits'
+//      mutable bsls::SpinParkLock d_lock;      // guard 'd_hits' and 'd_total'
+//
+//    public:
+//      // CREATORS
+//      my_HitCounter();
+//          // Create a hit counter having no hits recorded.
+//
+//      // MANIPULATORS
+//      void hit(int key);
+//          // Atomically record a hit on the specified 'key'.  The behavior is
+//          // undefined unless '0 <= key < 16'.
+//
+//      // ACCESSORS
+//      int total() const;
+//          // Atomically return the number of hits recorded on all keys.
+//  };
+//..
+// Then, we implement the manipulator and accessor using a
+// 'bsls::SpinParkLockGuard', exactly as we would use a 'bsls::BslLockGuard':
+//..
+//  my_HitCounter::my_HitCounter()
+//  : d_total(0)
+//  {
+//      for (int i = 0; i < 16; ++i) {
+//          d_hits[i] = 0;
+//      }
+//  }
+//
+//  void my_HitCounter::hit(int key)
+//  {
+//      BSLS_ASSERT(0 <= key);
+//      BSLS_ASSERT(key < 16);
+//
+//      bsls::SpinParkLockGuard guard(&d_lock);
+//
+//      ++d_hits[key];
+//      ++d_total;
+//  }
+//
+//  int my_HitCounter::total() const
+//  {
+//      bsls::SpinParkLockGuard guard(&d_lock);
+//
+//      return d_total;
+//  }
+//..
+// Finally, after the counter has been used, we can inspect how often any
+// 'bsls::SpinParkLock' in the process had to wait for its lock:
+//..
+//  my_HitCounter counter;
+//  counter.hit(3);
+//  counter.hit(7);
+//  assert(2 == counter.total());
+//
+//  bsls::SpinParkLockStatistics stats = bsls::SpinParkLock::statistics();
+//  assert(0 <= stats.numContendedLocks());
+//  assert(stats.numParks() <= stats.numContendedLocks());
+//..
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bsls {
+
+                        // ============================
+                        // class SpinParkLockStatistics
+                        // ============================
+
+class SpinParkLockStatistics {
+    // This simply constrained (value-semantic) attribute class holds a
+    // snapshot of the process-wide contention counts maintained by
+    // 'SpinParkLock'.
+
+    // DATA
+    Types::Int64 d_numContendedLocks;  // acquisitions that had to wait
+    Types::Int64 d_numSpins;           // spin-wait hint iterations executed
+    Types::Int64 d_numParks;           // times a thread parked
+    Types::Int64 d_numWakes;           // times 'unlock' woke a parked thread
+
+  public:
+    // CREATORS
+    SpinParkLockStatistics();
+        // Create a statistics object having all counts equal to 0.
+
+    SpinParkLockStatistics(Types::Int64 numContendedLocks,
+                           Types::Int64 numSpins,
+                           Types::Int64 numParks,
+                           Types::Int64 numWakes);
+        // Create a statistics object having the specified
+        // 'numContendedLocks', 'numSpins', 'numParks', and 'numWakes'.
+
+    // ACCESSORS
+    Types::Int64 numContendedLocks() const;
+        // Return the number of 'lock' calls that found the lock held and
+        // therefore entered the spin-then-park path.
+
+    Types::Int64 numParks() const;
+        // Return the number of times a thread waiting for a lock was parked
+        // (suspended, or, where parking is unavailable, yielded) after
+        // exhausting its spin budget.
+
+    Types::Int64 numSpins() const;
+        // Return the total number of spin-wait hint instructions executed by
+        // threads waiting for a lock.
+
+    Types::Int64 numWakes() const;
+        // Return the number of 'unlock' calls that woke a parked thread.
+};
+
+                            // ==================
+                            // class SpinParkLock
+                            // ==================
+
+class SpinParkLock {
+    // This 'class' implements a compact, portable, *non*-recursive mutex that
+    // acquires the lock with a single compare-and-swap when uncontended and,
+    // when contended, spins with exponential backoff before parking the
+    // calling thread.  Objects of this class occupy 4 bytes and require no
+    // operating-system resources.  Note that 'SpinParkLock' is *not* intended
+    // for direct use by client code; it is meant for internal use only.
+
+    // PRIVATE TYPES
+    enum {
+        k_UNLOCKED       = 0,  // lock is free
+        k_LOCKED         = 1,  // lock is held, no thread is parked
+        k_LOCKED_WAITERS = 2   // lock is held, a thread may be parked
+    };
+
+    // DATA
+    AtomicOperations::AtomicTypes::Int d_state;  // one of the states above
+
+  private:
+    // NOT IMPLEMENTED
+    SpinParkLock(const SpinParkLock&);             // = delete
+    SpinParkLock& operator=(const SpinParkLock&);  // = delete
+
+    // PRIVATE MANIPULATORS
+    void lockContended();
+        // Acquire the lock on this object, which was found to be held by
+        // another thread, by spinning and then parking the calling thread.
+
+    void wakeOne();
+        // Wake one thread parked on this lock, if any.
+
+  public:
+    // CLASS METHODS
+    static void resetStatistics();
+        // Reset the process-wide contention counts of all 'SpinParkLock'
+        // objects to 0.
+
+    static SpinParkLockStatistics statistics();
+        // Return the process-wide contention counts accumulated by all
+        // 'SpinParkLock' objects since program start or the most recent call
+        // to 'resetStatistics'.
+
+    // CREATORS
+    SpinParkLock();
+        // Create a lock object initialized to the unlocked state.
+
+    ~SpinParkLock();
+        // Destroy this lock object.  The behavior is undefined unless this
+        // object is in the unlocked state.
+
+    // MANIPULATORS
+    void lock();
+        // Acquire the lock on this object.  If the lock on this object is
+        // currently held by another thread, then spin and, if the lock is
+        // still unavailable, suspend execution of the calling thread until the
+        // lock can be acquired.  The behavior is undefined unless the calling
+        // thread does not already hold the lock on this object.  Note that
+        // deadlock may result if this method is invoked while the calling
+        // thread holds the lock on the object.
+
+    int tryLock();
+        // Attempt to acquire the lock on this object without waiting.  Return
+        // 0 on success, and a non-zero value if the lock is currently held by
+        // another thread.  The behavior is undefined unless the calling thread
+        // does not already hold the lock on this object.
+
+    void unlock();
+        // Release the lock on this object that was previously acquired
+        // through a call to 'lock' or a successful call to 'tryLock', enabling
+        // another thread to acquire the lock.  The behavior is undefined
+        // unless the calling thread holds the lock on this object.
+};
+
+                         // =======================
+                         // class SpinParkLockGuard
+                         // =======================
+
+class SpinParkLockGuard {
+    // This 'class' implements a guard for automatically acquiring and
+    // releasing the lock on an associated 'bsls::SpinParkLock' object.  This
+    // mechanism follows the RAII idiom whereby the lock on the 'SpinParkLock'
+    // associated with a guard object is acquired upon construction and
+    // released upon destruction.
+
+    // DATA
+    SpinParkLock *d_lock_p;  // lock guarded by this object (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SpinParkLockGuard(const SpinParkLockGuard&);             // = delete
+    SpinParkLockGuard& operator=(const SpinParkLockGuard&);  // = delete
+
+  public:
+    // CREATORS
+    explicit SpinParkLockGuard(SpinParkLock *lock);
+        // Create a guard object that conditionally manages the specified
+        // 'lock', and acquires the lock on 'lock' by invoking its 'lock'
+        // method.  The behavior is undefined unless the calling thread does
+        // not already hold the lock on 'lock'.  Note that deadlock may result
+        // if a guard is created for 'lock' while the calling thread holds the
+        // lock on 'lock'.  Also note that 'lock' must remain valid throughout
+        // the lifetime of this guard, or until 'release' is called.
+
+    ~SpinParkLockGuard();
+        // Destroy this guard object and release the lock on the object it
+        // manages (if any) by invoking the 'unlock' method of the object that
+        // was supplied at construction of this guard.  If no lock is currently
+        // being managed, this method has no effect.
+
+    // MANIPULATORS
+    void release();
+        // Release from management, with no effect, the object currently
+        // managed by this guard, if any.  Note that 'unlock' is *not* called
+        // on the managed object upon its release.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class SpinParkLockStatistics
+                        // ----------------------------
+
+// CREATORS
+inline
+SpinParkLockStatistics::SpinParkLockStatistics()
+: d_numContendedLocks(0)
+, d_numSpins(0)
+, d_numParks(0)
+, d_numWakes(0)
+{
+}
+
+inline
+SpinParkLockStatistics::SpinParkLockStatistics(
+                                          Types::Int64 numContendedLocks,
+                                          Types::Int64 numSpins,
+                                          Types::Int64 numParks,
+                                          Types::Int64 numWakes)
+: d_numContendedLocks(numContendedLocks)
+, d_numSpins(numSpins)
+, d_numParks(numParks)
+, d_numWakes(numWakes)
+{
+}
+
+// ACCESSORS
+inline
+Types::Int64 SpinParkLockStatistics::numContendedLocks() const
+{
+    return d_numContendedLocks;
+}
+
+inline
+Types::Int64 SpinParkLockStatistics::numParks() const
+{
+    return d_numParks;
+}
+
+inline
+Types::Int64 SpinParkLockStatistics::numSpins() const
+{
+    return d_numSpins;
+}
+
+inline
+Types::Int64 SpinParkLockStatistics::numWakes() const
+{
+    return d_numWakes;
+}
+
+                            // ------------------
+                            // class SpinParkLock
+                            // ------------------
+
+// CREATORS
+inline
+SpinParkLock::SpinParkLock()
+{
+    AtomicOperations::initInt(&d_state, k_UNLOCKED);
+}
+
+inline
+SpinParkLock::~SpinParkLock()
+{
+    BSLS_ASSERT_SAFE(k_UNLOCKED == AtomicOperations::getIntRelaxed(&d_state));
+}
+
+// MANIPULATORS
+inline
+void SpinParkLock::lock()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                 k_UNLOCKED != AtomicOperations::testAndSwapIntAcqRel(
+                                                                &d_state,
+                                                                k_UNLOCKED,
+                                                                k_LOCKED))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        lockContended();
+    }
+}
+
+inline
+int SpinParkLock::tryLock()
+{
+    return AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                  k_UNLOCKED,
+                                                  k_LOCKED);
+}
+
+inline
+void SpinParkLock::unlock()
+{
+    const int state = AtomicOperations::swapIntAcqRel(&d_state, k_UNLOCKED);
+
+    BSLS_ASSERT_SAFE(k_UNLOCKED != state);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_LOCKED_WAITERS == state)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        wakeOne();
+    }
+}
+
+                         // -----------------------
+                         // class SpinParkLockGuard
+                         // -----------------------
+
+// CREATORS
+inline
+SpinParkLockGuard::SpinParkLockGuard(SpinParkLock *lock)
+: d_lock_p(lock)
+{
+    BSLS_ASSERT_SAFE(lock);
+
+    d_lock_p->lock();
+}
+
+inline
+SpinParkLockGuard::~SpinParkLockGuard()
+{
+    if (d_lock_p) {
+        d_lock_p->unlock();
+    }
+}
+
+// MANIPULATORS
+inline
+void SpinParkLockGuard::release()
+{
+    d_lock_p = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,928 @@
+// bsls_spinparklock.t.cpp                                            -*-C++-*-
+#include <bsls_spinparklock.h>
+
+#include <bsls_asserttest.h>     // for testing only
+#include <bsls_atomic.h>         // for testing only
+#include <bsls_bsllock.h>        // for testing only
+#include <bsls_bsltestutil.h>    // for testing only
+#include <bsls_timeutil.h>       // for testing only
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing a compact mutually exclusive locking primitive ("mutex")
+// that spins, then parks, when contended, a guard for that mutex type, and an
+// attribute class reporting process-wide contention counts.  The operations
+// on the mutex type, 'bsls::SpinParkLock', are 'lock', 'tryLock', and
+// 'unlock'; the lone operation on the guard is 'release'.  As for
+// 'bsls::BslLock', we use two concurrent threads to verify that the 'lock',
+// 'unlock', and 'release' methods invoked by the respective threads occur in
+// the expected order.  We then verify mutual exclusion among many threads
+// hammering one lock, and that contended acquisitions are reflected in the
+// statistics.  Finally, a benchmark compares the lock against 'bsls::BslLock'
+// (i.e., 'pthread_mutex_t') for 1 to 64 threads.
+// ----------------------------------------------------------------------------
+// 'SpinParkLockStatistics' class:
+// [ 3] SpinParkLockStatistics();
+// [ 3] SpinParkLockStatistics(Int64, Int64, Int64, Int64);
+// [ 3] Int64 numContendedLocks() const;
+// [ 3] Int64 numParks() const;
+// [ 3] Int64 numSpins() const;
+// [ 3] Int64 numWakes() const;
+//
+// 'SpinParkLock' class:
+// [ 3] static void resetStatistics();
+// [ 3] static SpinParkLockStatistics statistics();
+// [ 1] SpinParkLock::SpinParkLock();
+// [ 1] SpinParkLock::~SpinParkLock();
+// [ 1] void SpinParkLock::lock();
+// [ 1] int SpinParkLock::tryLock();
+// [ 1] void SpinParkLock::unlock();
+//
+// 'SpinParkLockGuard' class:
+// [ 2] SpinParkLockGuard::SpinParkLockGuard(SpinParkLock *lock);
+// [ 2] SpinParkLockGuard::~SpinParkLockGuard();
+// [ 2] void SpinParkLockGuard::release();
+// ----------------------------------------------------------------------------
+// [ 1] BASIC TEST
+// [ 4] CONCERN: Mutual exclusion holds among many contending threads.
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: Precondition violations are detected when enabled.
+// [-1] PERFORMANCE: 'SpinParkLock' VS. 'BslLock'
+
+// ============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::SpinParkLock           Obj;
+typedef bsls::SpinParkLockGuard      Guard;
+typedef bsls::SpinParkLockStatistics Stats;
+typedef bsls::Types::Int64           Int64;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+static
+void sleepSeconds(int seconds)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    Sleep(seconds * 1000);
+#else
+    sleep(seconds);
+#endif
+}
+
+enum { MAX_SLEEP_CYCLES = 2 };
+
+static
+void pause(bsls::AtomicInt *value)
+    // Pause the current thread until the specified '*value' is non-zero, or
+    // a sufficient number of sleep cycles have elapsed.
+{
+    for (int i = 0; 0 == *value && i < MAX_SLEEP_CYCLES; ++i) {
+        sleepSeconds(1);
+    }
+}
+
+                              // ---------------
+                              // cases 1, 2, & 3
+                              // ---------------
+
+enum { NO_THREAD = 0, MAIN_THREAD = 1, CHILD_THREAD = 2 };
+
+struct ThreadInfo {
+    Obj             *d_lock;
+    bsls::AtomicInt  d_firstIn;
+    bsls::AtomicInt  d_threadStarted;
+    bsls::AtomicInt  d_threadDone;
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    info->d_threadStarted = 1;
+    info->d_lock->lock();                                             // LOCK
+    if (NO_THREAD == info->d_firstIn) {
+        info->d_firstIn = CHILD_THREAD;
+    }
+    info->d_lock->unlock();                                           // UNLOCK
+    info->d_threadDone = 1;
+
+    return arg;
+}
+
+                                  // ------
+                                  // case 4
+                                  // ------
+
+struct CounterInfo {
+    Obj   *d_lock;
+    int   *d_counter;      // protected by 'd_lock'
+    int    d_numIterations;
+    bool   d_useTryLock;   // alternate 'tryLock' and 'lock' if 'true'
+};
+
+extern "C" void *counterFunction(void *arg)
+{
+    CounterInfo *info = (CounterInfo *)arg;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        if (info->d_useTryLock && (i & 1)) {
+            while (0 != info->d_lock->tryLock()) {
+            }
+            ++*info->d_counter;
+            info->d_lock->unlock();
+        }
+        else {
+            Guard guard(info->d_lock);
+            ++*info->d_counter;
+        }
+    }
+    return arg;
+}
+
+                                  // -------
+                                  // case -1
+                                  // -------
+
+template <class LOCK>
+struct BenchmarkInfo {
+    LOCK  *d_lock;
+    int   *d_counter;          // protected by 'd_lock'
+    int    d_numIterations;
+};
+
+template <class LOCK, class GUARD>
+void *benchmarkFunction(void *arg)
+    // Acquire and release the lock in the 'BenchmarkInfo<LOCK>' addressed by
+    // the specified 'arg' the indicated number of times, doing a small amount
+    // of work under the lock each time.
+{
+    BenchmarkInfo<LOCK> *info = (BenchmarkInfo<LOCK> *)arg;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        GUARD guard(info->d_lock);
+        *info->d_counter = *info->d_counter * 31 + i;
+    }
+    return arg;
+}
+
+template <class LOCK, class GUARD>
+double runBenchmark(int numThreads, int numIterations)
+    // Contend for a single lock of the (template parameter) type 'LOCK' from
+    // the specified 'numThreads' threads, each acquiring it through a 'GUARD'
+    // the specified 'numIterations' times, and return the average wall-clock
+    // nanoseconds per acquisition.
+{
+    enum { k_MAX_THREADS = 64 };
+
+    LOCK                lock;
+    int                 counter = 0;
+    BenchmarkInfo<LOCK> info[k_MAX_THREADS];
+    ThreadId            threads[k_MAX_THREADS];
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+
+    for (int t = 0; t < numThreads; ++t) {
+        info[t].d_lock          = &lock;
+        info[t].d_counter       = &counter;
+        info[t].d_numIterations = numIterations;
+        threads[t] = createThread(&benchmarkFunction<LOCK, GUARD>, &info[t]);
+    }
+    for (int t = 0; t < numThreads; ++t) {
+        joinThread(threads[t]);
+    }
+
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(elapsed) / numThreads / numIterations;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Using 'bsls::SpinParkLock' to Make a 'class' Thread-Safe
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we illustrate the use of 'bsls::SpinParkLock' and
+// 'bsls::SpinParkLockGuard' to protect a counter that is updated by many
+// threads in a short critical section.
+//
+// First, we define a 'my_HitCounter' class that tallies hits per key.  Note
+// the 'd_lock' data member of type 'bsls::SpinParkLock', which adds just 4
+// bytes to the footprint of the class:
+//..
+    class my_HitCounter {
+        // This 'class' counts hits on a small, fixed set of keys.  It is meant
+        // for illustrative purposes only.
+
+        // DATA
+        int                        d_hits[16];  // hits per key
+        int                        d_total;     // sum of 'd_hits'
+        mutable bsls::SpinParkLock d_lock;      // guard 'd_hits' and 'd_total'
+
+      public:
+        // CREATORS
+        my_HitCounter();
+            // Create a hit counter having no hits recorded.
+
+        // MANIPULATORS
+        void hit(int key);
+            // Atomically record a hit on the specified 'key'.  The behavior is
+            // undefined unless '0 <= key < 16'.
+
+        // ACCESSORS
+        int total() const;
+            // Atomically return the number of hits recorded on all keys.
+    };
+//..
+// Then, we implement the manipulator and accessor using a
+// 'bsls::SpinParkLockGuard', exactly as we would use a 'bsls::BslLockGuard':
+//..
+    my_HitCounter::my_HitCounter()
+    : d_total(0)
+    {
+        for (int i = 0; i < 16; ++i) {
+            d_hits[i] = 0;
+        }
+    }
+
+    void my_HitCounter::hit(int key)
+    {
+        BSLS_ASSERT(0 <= key);
+        BSLS_ASSERT(key < 16);
+
+        bsls::SpinParkLockGuard guard(&d_lock);
+
+        ++d_hits[key];
+        ++d_total;
+    }
+
+    int my_HitCounter::total() const
+    {
+        bsls::SpinParkLockGuard guard(&d_lock);
+
+        return d_total;
+    }
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, after the counter has been used, we can inspect how often any
+// 'bsls::SpinParkLock' in the process had to wait for its lock:
+//..
+    my_HitCounter counter;
+    counter.hit(3);
+    counter.hit(7);
+    ASSERT(2 == counter.total());
+
+    bsls::SpinParkLockStatistics stats = bsls::SpinParkLock::statistics();
+    ASSERT(0 <= stats.numContendedLocks());
+    ASSERT(stats.numParks() <= stats.numContendedLocks());
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //   Ensure that mutual exclusion holds under heavy contention.
+        //
+        // Concerns:
+        //: 1 No two threads are ever inside a critical section guarded by the
+        //:   same lock at the same time, whether the lock is acquired by
+        //:   'lock' or by 'tryLock', and whether a waiting thread acquires the
+        //:   lock while spinning or after parking.
+        //:
+        //: 2 Every contending thread eventually acquires the lock (no lost
+        //:   wake-ups).
+        //
+        // Plan:
+        //: 1 For 2, 4, and 8 threads, have each thread increment a shared,
+        //:   non-atomic counter a number of times under the lock, half of
+        //:   the threads alternating 'tryLock' and 'lock'.  Verify after
+        //:   joining all threads that no increment was lost.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Mutual exclusion holds among many contending threads.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY TEST"
+                            "\n================\n");
+
+        enum { k_MAX_THREADS = 8, k_NUM_ITERATIONS = 20000 };
+
+        for (int numThreads = 2;
+             numThreads <= k_MAX_THREADS;
+             numThreads *= 2) {
+            Obj mX;
+            int counter = 0;
+
+            CounterInfo info[k_MAX_THREADS];
+            ThreadId    threads[k_MAX_THREADS];
+
+            for (int t = 0; t < numThreads; ++t) {
+                info[t].d_lock          = &mX;
+                info[t].d_counter       = &counter;
+                info[t].d_numIterations = k_NUM_ITERATIONS;
+                info[t].d_useTryLock    = 0 != (t & 1);
+                threads[t] = createThread(&counterFunction, &info[t]);
+            }
+            for (int t = 0; t < numThreads; ++t) {
+                joinThread(threads[t]);
+            }
+
+            if (veryVerbose) { T_ P_(numThreads) P(counter) }
+
+            LOOP2_ASSERT(numThreads,
+                         counter,
+                         numThreads * k_NUM_ITERATIONS == counter);
+            ASSERT(0 == mX.tryLock());
+            mX.unlock();
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // STATISTICS TEST
+        //   Ensure that contention is reflected in the statistics.
+        //
+        // Concerns:
+        //: 1 A default-constructed 'SpinParkLockStatistics' has all counts 0,
+        //:   and the value constructor sets each count as specified.
+        //:
+        //: 2 Uncontended 'lock', 'tryLock', and 'unlock' calls do not change
+        //:   the statistics.
+        //:
+        //: 3 A 'lock' call that must wait longer than the spin budget counts
+        //:   one contended lock, one or more spins and parks, and its
+        //:   release by the holder counts one wake-up.
+        //:
+        //: 4 'resetStatistics' sets all counts to 0.
+        //
+        // Plan:
+        //: 1 Construct statistics objects and verify their accessors.  (C-1)
+        //:
+        //: 2 Reset the statistics, lock and unlock a lock from one thread,
+        //:   and verify that all counts are still 0.  (C-2)
+        //:
+        //: 3 Lock a lock in the main thread, start a child thread that locks
+        //:   it, and sleep for a second before unlocking.  After joining,
+        //:   verify the counts.  (C-3)
+        //:
+        //: 4 Reset the statistics and verify all counts are 0.  (C-4)
+        //
+        // Testing:
+        //   SpinParkLockStatistics();
+        //   SpinParkLockStatistics(Int64, Int64, Int64, Int64);
+        //   Int64 numContendedLocks() const;
+        //   Int64 numParks() const;
+        //   Int64 numSpins() const;
+        //   Int64 numWakes() const;
+        //   static void resetStatistics();
+        //   static SpinParkLockStatistics statistics();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSTATISTICS TEST"
+                            "\n===============\n");
+
+        // C-1
+        {
+            const Stats X;
+            ASSERT(0 == X.numContendedLocks());
+            ASSERT(0 == X.numSpins());
+            ASSERT(0 == X.numParks());
+            ASSERT(0 == X.numWakes());
+
+            const Stats Y(1, 2, 3, 4);
+            ASSERT(1 == Y.numContendedLocks());
+            ASSERT(2 == Y.numSpins());
+            ASSERT(3 == Y.numParks());
+            ASSERT(4 == Y.numWakes());
+        }
+
+        // C-2
+        {
+            Obj::resetStatistics();
+
+            Obj mX;
+            mX.lock();
+            mX.unlock();
+            ASSERT(0 == mX.tryLock());
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+
+            const Stats X = Obj::statistics();
+            ASSERT(0 == X.numContendedLocks());
+            ASSERT(0 == X.numSpins());
+            ASSERT(0 == X.numParks());
+            ASSERT(0 == X.numWakes());
+        }
+
+        // C-3
+        {
+            Obj mX;
+            mX.lock();                                                // LOCK
+
+            ThreadInfo info;
+            info.d_lock          = &mX;
+            info.d_firstIn       = NO_THREAD;
+            info.d_threadStarted = 0;
+            info.d_threadDone    = 0;
+
+            ThreadId id = createThread(&threadFunction, &info);
+
+            pause(&info.d_threadStarted);
+            sleepSeconds(1);
+
+            mX.unlock();                                              // UNLOCK
+
+            joinThread(id);
+
+            ASSERT(CHILD_THREAD == info.d_firstIn);
+
+            const Stats X = Obj::statistics();
+            if (verbose) {
+                T_ P_(X.numContendedLocks()) P_(X.numSpins())
+                   P_(X.numParks())          P(X.numWakes())
+            }
+            ASSERT(1 == X.numContendedLocks());
+            ASSERT(0 <  X.numSpins());
+            ASSERT(1 <= X.numParks());
+            ASSERT(1 <= X.numWakes());
+        }
+
+        // C-4
+        {
+            Obj::resetStatistics();
+
+            const Stats X = Obj::statistics();
+            ASSERT(0 == X.numContendedLocks());
+            ASSERT(0 == X.numSpins());
+            ASSERT(0 == X.numParks());
+            ASSERT(0 == X.numWakes());
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GUARD TEST
+        //   Ensure that 'SpinParkLockGuard' works as expected.
+        //
+        // Concerns:
+        //: 1 Following construction, the associated lock is in the locked
+        //:   state.
+        //:
+        //: 2 Following destruction with no prior call to 'release', the
+        //:   associated lock is in the unlocked state.
+        //:
+        //: 3 'release' releases the associated lock from management and
+        //:   leaves the lock locked.
+        //:
+        //: 4 Destruction following a call to 'release' has no effect on the
+        //:   state of the associated lock.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a lock, 'mX', in the main thread.  Then, within a nested
+        //:   block, create a guard for 'mX', 'mG', and create a child thread
+        //:   that has access to 'mX'.  The child thread, upon acquiring the
+        //:   lock on 'mX', atomically updates a shared "first in" variable if
+        //:   and only if it still has its initial value (0).  Allow the child
+        //:   thread to run for a brief time before letting 'mG' go out of
+        //:   scope.  Verify, at appropriate points, that the "first in"
+        //:   variable has the expected result.  (C-1..2)
+        //:
+        //: 2 Repeat P-1, except call 'release' on 'mG' before allowing it to
+        //:   go out of scope.  Verify that the child thread cannot update the
+        //:   "first in" variable until 'unlock' is called on 'mX' in the main
+        //:   thread.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered.  (C-5)
+        //
+        // Testing:
+        //   SpinParkLockGuard::SpinParkLockGuard(SpinParkLock *lock);
+        //   SpinParkLockGuard::~SpinParkLockGuard();
+        //   void SpinParkLockGuard::release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nGUARD TEST"
+                            "\n==========\n");
+
+        // C-1..2
+        {
+            Obj mX;
+
+            ThreadInfo info;
+            info.d_lock          = &mX;
+            info.d_firstIn       = NO_THREAD;
+            info.d_threadStarted = 0;
+            info.d_threadDone    = 0;
+
+            ThreadId id;
+
+            {
+                Guard mG(&mX);                                        // LOCK
+                ASSERT(0 != mX.tryLock());
+
+                id = createThread(&threadFunction, &info);
+
+                pause(&info.d_threadDone);
+                ASSERT(NO_THREAD == info.d_firstIn);
+            }                                                         // UNLOCK
+
+            joinThread(id);
+
+            ASSERT(CHILD_THREAD == info.d_firstIn);
+            ASSERT(0 == mX.tryLock());
+            mX.unlock();
+        }
+
+        // C-3..4
+        {
+            Obj mX;
+
+            ThreadInfo info;
+            info.d_lock          = &mX;
+            info.d_firstIn       = NO_THREAD;
+            info.d_threadStarted = 0;
+            info.d_threadDone    = 0;
+
+            ThreadId id;
+
+            {
+                Guard mG(&mX);                                        // LOCK
+
+                id = createThread(&threadFunction, &info);
+
+                pause(&info.d_threadDone);
+                ASSERT(NO_THREAD == info.d_firstIn);
+
+                mG.release();
+            }
+
+            pause(&info.d_threadDone);
+            ASSERT(NO_THREAD == info.d_firstIn);
+
+            mX.unlock();                                              // UNLOCK
+
+            joinThread(id);
+
+            ASSERT(CHILD_THREAD == info.d_firstIn);
+        }
+
+        // C-5
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            {
+                Obj mX;
+
+                ASSERT_SAFE_PASS((Guard(&mX)));
+                ASSERT_SAFE_FAIL( Guard(  0));
+            }
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BASIC TEST
+        //   Ensure that 'SpinParkLock' works as expected.
+        //
+        // Concerns:
+        //: 1 Following construction, the lock is in the unlocked state.
+        //:
+        //: 2 'lock' acquires the lock for exclusive access by the calling
+        //:    thread.
+        //:
+        //: 3 'unlock' releases the lock making it available to other threads.
+        //:
+        //: 4 'tryLock' acquires the lock, returning 0, if and only if it is
+        //:   not held, and otherwise returns a non-zero value without
+        //:   waiting.
+        //:
+        //: 5 The lock occupies 4 bytes.
+        //
+        // Plan:
+        //: 1 Create a lock, 'mX', in the main thread, then create a child
+        //:   thread that has access to 'mX'.  Each of the threads, upon
+        //:   acquiring the lock on 'mX', atomically update a shared "first in"
+        //:   variable if and only if it still has its initial value (0); both
+        //:   threads use the 'lock' method.  Allow the child thread to run for
+        //:   a brief time before locking in the main thread.  After joining
+        //:   with the child thread, verify the "first in" variable has the
+        //:   expected result.  Repeat, except this time lock 'mX' in the main
+        //:   thread *before* creating the child thread.  (C-1..3)
+        //:
+        //: 2 Call 'tryLock' on a lock in each state and verify the result.
+        //:   (C-4)
+        //:
+        //: 3 Verify 'sizeof(Obj)'.  (C-5)
+        //
+        // Testing:
+        //   SpinParkLock::SpinParkLock();
+        //   SpinParkLock::~SpinParkLock();
+        //   void SpinParkLock::lock();
+        //   int SpinParkLock::tryLock();
+        //   void SpinParkLock::unlock();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASIC TEST"
+                            "\n==========\n");
+
+        // C-1..3
+        {
+            Obj mX;
+
+            ThreadInfo info;
+            info.d_lock          = &mX;
+            info.d_firstIn       = NO_THREAD;
+            info.d_threadStarted = 0;
+            info.d_threadDone    = 0;
+
+            ThreadId id = createThread(&threadFunction, &info);
+
+            pause(&info.d_threadDone);
+
+            mX.lock();                                                // LOCK
+            if (NO_THREAD == info.d_firstIn) {
+                info.d_firstIn = MAIN_THREAD;
+            }
+            mX.unlock();                                              // UNLOCK
+
+            joinThread(id);
+
+            ASSERT(CHILD_THREAD == info.d_firstIn);
+        }
+
+        {
+            Obj mX;
+            mX.lock();                                                // LOCK
+
+            ThreadInfo info;
+            info.d_lock          = &mX;
+            info.d_firstIn       = NO_THREAD;
+            info.d_threadStarted = 0;
+            info.d_threadDone    = 0;
+
+            ThreadId id = createThread(&threadFunction, &info);
+
+            pause(&info.d_threadDone);
+
+            if (NO_THREAD == info.d_firstIn) {
+                info.d_firstIn = MAIN_THREAD;
+            }
+            mX.unlock();                                              // UNLOCK
+
+            joinThread(id);
+
+            ASSERT(MAIN_THREAD == info.d_firstIn);
+        }
+
+        // C-4
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.tryLock());
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+            ASSERT(0 == mX.tryLock());
+            mX.unlock();
+
+            mX.lock();
+            ASSERT(0 != mX.tryLock());
+            mX.unlock();
+        }
+
+        // C-5
+        {
+            ASSERT(4 == sizeof(Obj));
+        }
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'SpinParkLock' VS. 'BslLock'
+        //
+        // Concerns:
+        //: 1 Compare the cost of acquiring and releasing a 'SpinParkLock'
+        //:   around a very short critical section with that of a 'BslLock'
+        //:   (i.e., 'pthread_mutex_t', or a critical section on Windows), for
+        //:   1 to 64 threads contending for a single lock.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads, have each thread acquire and
+        //:   release the lock a number of times (1,000,000 divided by the
+        //:   number of threads by default, or the total specified by the
+        //:   second argument), and print the average wall-clock time per
+        //:   acquisition for each lock type, along with the contention
+        //:   statistics of the 'SpinParkLock' run.
+        //
+        // Testing:
+        //   PERFORMANCE: 'SpinParkLock' VS. 'BslLock'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: 'SpinParkLock' VS. 'BslLock'"
+               "\n=========================================\n");
+
+        const int NUM_TOTAL = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        printf("%7s %14s %14s %12s %12s %12s\n",
+               "threads",
+               "SpinPark ns",
+               "BslLock ns",
+               "contended",
+               "spins",
+               "parks");
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            const int NUM_ITERATIONS = NUM_TOTAL / numThreads;
+
+            Obj::resetStatistics();
+
+            const double spinPark = runBenchmark<Obj, Guard>(numThreads,
+                                                             NUM_ITERATIONS);
+            const Stats  stats    = Obj::statistics();
+
+            const double bslLock =
+                       runBenchmark<bsls::BslLock, bsls::BslLockGuard>(
+                                                               numThreads,
+                                                               NUM_ITERATIONS);
+
+            printf("%7d %14.2f %14.2f %12lld %12lld %12lld\n",
+                   numThreads,
+                   spinPark,
+                   bslLock,
+                   stats.numContendedLocks(),
+                   stats.numSpins(),
+                   stats.numParks());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
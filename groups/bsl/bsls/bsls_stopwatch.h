@@ -30,6 +30,17 @@ BSLS_IDENT("$Id: $")
 // measure the overhead of the loop separately and subtract that time from the
 // over-all time interval.
 //
+///Fast Mode
+///- - - - -
+// A stopwatch created with the 'e_FAST_TIMER' timer mode measures wall time
+// using 'bsls::TimeUtil::getFastTimerRaw' rather than
+// 'bsls::TimeUtil::getTimerRaw'.  Where the processor provides an invariant
+// time-stamp counter, this greatly reduces the cost of starting, stopping,
+// and reading the stopwatch; elsewhere, the two modes behave identically.
+// See the "Fast Timer" section of 'bsls_timeutil.h'.  Note that the timer
+// mode affects only the wall time; system and user times are always obtained
+// from the operating system.
+//
 ///Accuracy on Windows
 ///- - - - - - - - - -
 // 'bsls::Stopwatch' may be slow or inconsistent on some Windows machines.  See
@@ -68,7 +79,7 @@ BSLS_IDENT("$Id: $")
 //  const double t3u = s.accumulatedUserTime();    assert(t2u <= t3u);
 //  const double t3w = s.accumulatedWallTime();    assert(t2w <= t3w);
 //..
-// Finally, we reset the stopwatch, which both puts it into the STOPPED state
+// Next, we reset the stopwatch, which both puts it into the STOPPED state
 // and resets all accumulated times back to their initial state (i.e., 0.0):
 //..
 //  s.reset();
@@ -79,6 +90,17 @@ BSLS_IDENT("$Id: $")
 //  const double t5u = s.accumulatedUserTime();    assert(0.0 == t5u);
 //  const double t5w = s.accumulatedWallTime();    assert(0.0 == t5w);
 //..
+// Finally, we create a stopwatch in the fast timer mode, which is well suited
+// to timing many short operations:
+//..
+//  bsls::Stopwatch f(bsls::Stopwatch::e_FAST_TIMER);
+//  assert(bsls::Stopwatch::e_FAST_TIMER == f.timerMode());
+//
+//  f.start();
+//  const double t6w = f.accumulatedWallTime();    assert(0.0 <= t6w);
+//  f.stop();
+//  const double t7w = f.accumulatedWallTime();    assert(t6w <= t7w);
+//..
 
 #ifndef INCLUDED_BSLS_TIMEUTIL
 #include <bsls_timeutil.h>
@@ -109,6 +131,16 @@ class Stopwatch {
     // The accumulated times can be accessed at any time and in either state
     // (RUNNING or STOPPED).
 
+  public:
+    // TYPES
+    enum TimerMode {
+        // Enumerate the timers from which a stopwatch may obtain wall time.
+
+        e_STANDARD_TIMER,  // 'TimeUtil::getTimerRaw'
+        e_FAST_TIMER       // 'TimeUtil::getFastTimerRaw'
+    };
+
+  private:
     // DATA
     Types::Int64 d_startSystemTime;        // system time when
                                            // started (nanoseconds)
@@ -120,6 +152,10 @@ class Stopwatch {
                                            // wall time when
                                            // started (nanoseconds)
 
+    TimeUtil::OpaqueFastTime d_startFastWallTime;
+                                           // wall time when started,
+                                           // if 'e_FAST_TIMER'
+
     Types::Int64 d_accumulatedSystemTime;  // accumulated system
                                            // time (nanoseconds)
 
@@ -135,6 +171,8 @@ class Stopwatch {
     bool         d_collectCpuTimesFlag;    // 'true' if cpu times
                                            // are being collected
 
+    TimerMode    d_timerMode;              // timer providing wall time
+
     // CLASS DATA
     static const double      s_nanosecondsPerSecond;   // conversion factor
                                                        // (for nanoseconds to
@@ -147,26 +185,31 @@ class Stopwatch {
 
   private:
     // PRIVATE MANIPULATORS
+    void startWallTime();
+        // Record the current wall time, as provided by the timer selected by
+        // 'd_timerMode', as the time at which this stopwatch was started.
+
     void updateTimes();
         // Update the CPU times accumulated but this stopwatch.
 
     // PRIVATE ACCESSORS
-    void accumulatedTimesRaw(Types::Int64               *systemTime,
-                             Types::Int64               *userTime,
-                             TimeUtil::OpaqueNativeTime *wallTime) const;
-        // Load into the specified 'systemTime', 'userTime', and 'wallTime' the
-        // values of the system time, user time, and wall time (in
-        // nanoseconds), respectively, as provided by 'TimeUtil'.
-
-    Types::Int64 elapsedWallTime(TimeUtil::OpaqueNativeTime rawWallTime) const;
-        // Return the elapsed time, in nanoseconds, between the current
-        // 'd_startWallTime' and the specified 'rawWallTime'.
+    Types::Int64 elapsedWallTime() const;
+        // Return the elapsed time, in nanoseconds, between the time at which
+        // this stopwatch was last started and the current time, both as
+        // provided by the timer selected by 'd_timerMode'.
 
   public:
     // CREATORS
     Stopwatch();
+    explicit Stopwatch(TimerMode timerMode);
         // Create a stopwatch in the STOPPED state having total accumulated
-        // system, user, and wall times all equal to 0.0.
+        // system, user, and wall times all equal to 0.0.  Optionally specify
+        // a 'timerMode' indicating the timer from which wall time is
+        // obtained.  If 'timerMode' is not specified, 'e_STANDARD_TIMER' is
+        // used.  Note that 'e_FAST_TIMER' reduces the cost of measuring wall
+        // time on platforms having an invariant time-stamp counter (see
+        // 'bsls_timeutil'), and that the fast timer is calibrated on the
+        // construction of the first stopwatch using it.
 
     //! ~Stopwatch();
         // Destroy this stopwatch.  Note that this method's definition is
@@ -225,6 +268,10 @@ class Stopwatch {
     bool isRunning() const;
         // Return 'true' if this stopwatch is in the RUNNING state, and 'false'
         // otherwise.
+
+    TimerMode timerMode() const;
+        // Return the timer mode of this stopwatch, indicating the timer from
+        // which wall time is obtained.
 };
 
 // ============================================================================
@@ -235,21 +282,32 @@ class Stopwatch {
                             // class Stopwatch
                             // ---------------
 
-// PRIVATE ACCESSORS
+// PRIVATE MANIPULATORS
 inline
-void Stopwatch::accumulatedTimesRaw(Types::Int64               *systemTime,
-                                    Types::Int64               *userTime,
-                                    TimeUtil::OpaqueNativeTime *wallTime) const
+void Stopwatch::startWallTime()
 {
-    TimeUtil::getProcessTimers(systemTime, userTime);
-    TimeUtil::getTimerRaw(wallTime);
+    if (e_FAST_TIMER == d_timerMode) {
+        TimeUtil::getFastTimerRaw(&d_startFastWallTime);
+    }
+    else {
+        TimeUtil::getTimerRaw(&d_startWallTime);
+    }
 }
 
+// PRIVATE ACCESSORS
 inline
-Types::Int64 Stopwatch::elapsedWallTime(
-                                  TimeUtil::OpaqueNativeTime rawWallTime) const
+Types::Int64 Stopwatch::elapsedWallTime() const
 {
-    return TimeUtil::convertRawTime(rawWallTime)
+    if (e_FAST_TIMER == d_timerMode) {
+        TimeUtil::OpaqueFastTime now;
+        TimeUtil::getFastTimerRaw(&now);
+        return TimeUtil::convertRawTime(now)
+             - TimeUtil::convertRawTime(d_startFastWallTime);         // RETURN
+    }
+
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+    return TimeUtil::convertRawTime(now)
          - TimeUtil::convertRawTime(d_startWallTime);
 }
 
@@ -262,8 +320,24 @@ Stopwatch::Stopwatch()
 , d_accumulatedWallTime(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
+, d_timerMode(e_STANDARD_TIMER)
+{
+    TimeUtil::initialize();
+}
+
+inline
+Stopwatch::Stopwatch(TimerMode timerMode)
+: d_accumulatedSystemTime(0)
+, d_accumulatedUserTime(0)
+, d_accumulatedWallTime(0)
+, d_isRunning(false)
+, d_collectCpuTimesFlag(false)
+, d_timerMode(timerMode)
 {
     TimeUtil::initialize();
+    if (e_FAST_TIMER == timerMode) {
+        TimeUtil::initializeFastTimer();
+    }
 }
 
 // MANIPULATORS
@@ -282,13 +356,9 @@ void Stopwatch::start(bool collectCpuTimes)
     if (!d_isRunning) {
         d_collectCpuTimesFlag = collectCpuTimes;
         if (d_collectCpuTimesFlag) {
-            accumulatedTimesRaw(&d_startSystemTime,
-                                &d_startUserTime,
-                                &d_startWallTime);
-        }
-        else {
-            TimeUtil::getTimerRaw(&d_startWallTime);
+            TimeUtil::getProcessTimers(&d_startSystemTime, &d_startUserTime);
         }
+        startWallTime();
         d_isRunning = true;
     }
 }
@@ -301,9 +371,7 @@ void Stopwatch::stop()
             updateTimes();
         }
         else {
-            TimeUtil::OpaqueNativeTime now;
-            TimeUtil::getTimerRaw(&now);
-            d_accumulatedWallTime += elapsedWallTime(now);
+            d_accumulatedWallTime += elapsedWallTime();
         }
         d_isRunning = false;
     }
@@ -346,9 +414,7 @@ inline
 double Stopwatch::accumulatedWallTime() const
 {
     if (d_isRunning) {
-        TimeUtil::OpaqueNativeTime now;
-        TimeUtil::getTimerRaw(&now);
-        return (double)(d_accumulatedWallTime + elapsedWallTime(now))
+        return (double)(d_accumulatedWallTime + elapsedWallTime())
                                                       / s_nanosecondsPerSecond;
                                                                       // RETURN
     }
@@ -367,6 +433,12 @@ bool Stopwatch::isRunning() const
     return d_isRunning;
 }
 
+inline
+Stopwatch::TimerMode Stopwatch::timerMode() const
+{
+    return d_timerMode;
+}
+
 }  // close package namespace
 
 
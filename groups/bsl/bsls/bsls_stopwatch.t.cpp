@@ -33,6 +33,7 @@ using namespace BloombergLP;
 // behavior.
 //-----------------------------------------------------------------------------
 // [ 2] bsls::Stopwatch();
+// [ 7] explicit bsls::Stopwatch(TimerMode timerMode);
 // [ 2] ~bsls::Stopwatch();
 // [ 3] void start();
 // [ 3] void stop();
@@ -43,10 +44,12 @@ using namespace BloombergLP;
 // [ 4] double accumulatedWallTime() const;
 // [ 5] void accumulatedTimes(double*, double*, double*) const;
 // [ 4] double elapsedTime() const;
+// [ 7] TimerMode timerMode() const;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 9] USAGE Example
+// [ 8] CONCERN: Standard timer mode does not calibrate the fast timer.
 // [ 6] Reproduce bug from test case 
 //-----------------------------------------------------------------------------
 
@@ -252,7 +255,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -297,6 +300,163 @@ int main(int argc, char *argv[])
         const double t5s = s.accumulatedSystemTime();  ASSERT(0.0 == t5s);
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
+
+        bsls::Stopwatch f(bsls::Stopwatch::e_FAST_TIMER);
+        ASSERT(bsls::Stopwatch::e_FAST_TIMER == f.timerMode());
+
+        f.start();
+        const double t6w = f.accumulatedWallTime();    ASSERT(0.0 <= t6w);
+        f.stop();
+        const double t7w = f.accumulatedWallTime();    ASSERT(t6w <= t7w);
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING LAZY CALIBRATION OF THE FAST TIMER
+        //
+        // Concerns:
+        //: 1 Creating and using stopwatches in the standard timer mode does
+        //:   not start the (costly) calibration of the fast timer.
+        //:
+        //: 2 Creating a stopwatch in the fast timer mode calibrates the fast
+        //:   timer.
+        //
+        // Plan:
+        //: 1 In a process that has not used the fast timer, create, start,
+        //:   and stop stopwatches constructed with no timer mode and with
+        //:   'e_STANDARD_TIMER', and verify that
+        //:   'bsls::TimeUtil::isFastTimerInitialized' remains 'false'.  (C-1)
+        //:
+        //: 2 Create a stopwatch in the 'e_FAST_TIMER' mode, and verify that
+        //:   'bsls::TimeUtil::isFastTimerInitialized' becomes 'true'.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Standard timer mode does not calibrate the fast timer.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING LAZY CALIBRATION OF THE FAST TIMER"
+                            "\n==========================================\n");
+
+        ASSERT(!bsls::TimeUtil::isFastTimerInitialized());
+
+        {
+            Obj mD;                      const Obj& D = mD;
+            Obj mS(Obj::e_STANDARD_TIMER);
+
+            mD.start(true);
+            mS.start();
+            delayWall(0.01);
+            mS.stop();
+            mD.stop();
+
+            ASSERT(0.0 < D.accumulatedWallTime());
+        }
+
+        ASSERT(!bsls::TimeUtil::isFastTimerInitialized());
+
+        {
+            Obj mF(Obj::e_FAST_TIMER);
+
+            ASSERT(bsls::TimeUtil::isFastTimerInitialized());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING FAST TIMER MODE
+        //
+        // Concerns:
+        //: 1 A stopwatch has the timer mode supplied at construction, and
+        //:   'e_STANDARD_TIMER' by default.
+        //:
+        //: 2 A stopwatch in the fast timer mode accumulates wall time across
+        //:   runs, and agrees closely with one in the standard mode timing the
+        //:   same interval.
+        //:
+        //: 3 The timer mode does not affect the collection of CPU times.
+        //
+        // Plan:
+        //: 1 Create stopwatches with and without a timer mode, and verify the
+        //:   value returned by 'timerMode'.  (C-1)
+        //:
+        //: 2 Run a stopwatch in each mode over the same delays, twice, and
+        //:   verify that the accumulated wall times agree to within 1% and a
+        //:   millisecond, and that 'reset' restores the initial state.  (C-2)
+        //:
+        //: 3 Start a fast stopwatch collecting CPU times and verify that the
+        //:   user time advances during a busy delay.  (C-3)
+        //
+        // Testing:
+        //   explicit bsls::Stopwatch(TimerMode timerMode);
+        //   TimerMode timerMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING FAST TIMER MODE"
+                            "\n=======================\n");
+
+        if (verbose) printf("\tTimer mode.\n");
+        {
+            const Obj D;
+            const Obj S(Obj::e_STANDARD_TIMER);
+            const Obj F(Obj::e_FAST_TIMER);
+
+            ASSERT(Obj::e_STANDARD_TIMER == D.timerMode());
+            ASSERT(Obj::e_STANDARD_TIMER == S.timerMode());
+            ASSERT(Obj::e_FAST_TIMER     == F.timerMode());
+
+            ASSERT(!F.isRunning());
+            ASSERT(0.0 == F.accumulatedWallTime());
+        }
+
+        if (verbose) printf("\tAgreement with the standard timer.\n");
+        {
+            Obj mS;                      const Obj& S = mS;
+            Obj mF(Obj::e_FAST_TIMER);   const Obj& F = mF;
+
+            const double DELAY = 0.1;  // seconds
+
+            for (int i = 0; i < 2; ++i) {
+                mS.start();
+                mF.start();
+                delayWall(DELAY);
+                mF.stop();
+                mS.stop();
+            }
+
+            const double standard = S.accumulatedWallTime();
+            const double fast     = F.accumulatedWallTime();
+            if (veryVerbose) { T_ P_(standard) P(fast) }
+
+            // The two stopwatches time (almost) the same intervals, but with
+            // different clocks, so allow for a small difference of rate as
+            // well as the time taken to start and stop them.
+
+            const double DIFFERENCE = standard > fast ? standard - fast
+                                                      : fast - standard;
+
+            ASSERTV(fast, 0.99 * 2 * DELAY <= fast);
+            ASSERTV(standard, fast, DIFFERENCE < 0.01 * standard + 1e-3);
+
+            mF.reset();
+            ASSERT(!F.isRunning());
+            ASSERT(0.0 == F.accumulatedWallTime());
+            ASSERT(Obj::e_FAST_TIMER == F.timerMode());
+        }
+
+        if (verbose) printf("\tCPU times.\n");
+        {
+            Obj mF(Obj::e_FAST_TIMER);   const Obj& F = mF;
+
+            mF.start(true);
+            delayUser(0.1);
+
+            double systemTime, userTime, wallTime;
+            F.accumulatedTimes(&systemTime, &userTime, &wallTime);
+            mF.stop();
+
+            if (veryVerbose) { T_ P_(systemTime) P_(userTime) P(wallTime) }
+
+            ASSERTV(wallTime, 0.099 <= wallTime);
+            ASSERTV(userTime, 0.0 <  userTime + systemTime);
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -90,6 +90,33 @@ BSLS_IDENT("$Id: $")
 // expressed by the 'QueryPerformanceCounter' interface.  Note that the times
 // will still be monotonically non-decreasing. 
 //
+///Fast Timer
+///----------
+// 'getTimer' and 'getTimerRaw' obtain the time from the operating system,
+// which typically costs tens of nanoseconds per call, and more where a system
+// call is required.  Where the cost of the measurement itself matters (e.g.,
+// when timing every message processed), 'getFastTimer' and 'getFastTimerRaw'
+// may be used instead.  On x86 and x86-64 processors having an *invariant*
+// time-stamp counter (TSC) -- one that ticks at a constant rate regardless of
+// the power state of the processor and is synchronized across processors --
+// these methods read the TSC directly (using the 'rdtsc' instruction), and
+// convert its value to nanoseconds using a rate calibrated, once per process,
+// against the clock used by 'getTimer'.  The calibration takes approximately
+// 10 milliseconds, and is performed by 'initializeFastTimer' or by the first
+// call to a fast-timer method; 'initialize' does not calibrate the fast timer,
+// so that clients using only the standard timer do not pay for it.
+//
+// On all other platforms, and on processors not reporting an invariant TSC
+// (which includes some virtual machines), the fast-timer methods fall back to
+// the clock used by 'getTimer', and so are no more costly than 'getTimer'
+// itself.  'isFastTimerTscBased' reports which implementation is in use.
+//
+// The values returned by 'getFastTimer' share the origin of those returned by
+// 'getTimer' at the time of the calibration, but the two clocks may drift
+// apart by a small fraction (typically of the order of 1E-5) of the time
+// elapsed since then.  Intervals should therefore be measured using either
+// the fast timer or the standard timer, but not both.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use 'bsls::TimeUtil'
@@ -246,6 +273,11 @@ struct TimeUtil {
     typedef struct { Types::Int64 d_opaque; } OpaqueNativeTime;
 #endif
 
+    typedef struct { Types::Uint64 d_opaque; } OpaqueFastTime;
+        // 'OpaqueFastTime' is the type of the raw values obtained by
+        // 'getFastTimerRaw': either a count of time-stamp counter ticks, or
+        // (if the fast timer is not TSC-based) a time in nanoseconds.
+
     // CLASS METHODS
     static Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
         // Convert the specified 'rawTime' to a value in nanoseconds,
@@ -253,6 +285,27 @@ struct TimeUtil {
         // of the conversion.  Note that this method is thread-safe only if
         // 'initialize' has been called before.
 
+    static Types::Int64 convertRawTime(OpaqueFastTime rawTime);
+        // Convert the specified 'rawTime', obtained by 'getFastTimerRaw', to
+        // a value in nanoseconds, referenced to the same arbitrary but fixed
+        // origin as the values returned by 'getFastTimer', and return the
+        // result of the conversion.  This method is thread-safe.
+
+    static Types::Int64 getFastTimer();
+        // Return the instantaneous value of a low-overhead, platform-
+        // dependent system timer in absolute nanoseconds referenced to an
+        // arbitrary but fixed origin.  If the fast timer has not yet been
+        // calibrated, calibrate it first (see the "Fast Timer" section of the
+        // component documentation).  This method is thread-safe.
+
+    static void getFastTimerRaw(OpaqueFastTime *timeValue);
+        // Load into the specified 'timeValue' the value of an opaque type
+        // representing the current time, as measured by the low-overhead
+        // timer.  'timeValue' must be converted by the 'convertRawTime'
+        // method to conventional units (nanoseconds).  If the fast timer has
+        // not yet been calibrated, calibrate it first.  This method is
+        // thread-safe.
+
     static Types::Int64 getProcessSystemTimer();
         // Return the instantaneous values of a platform-dependent timer for
         // the current process system time in absolute nanoseconds referenced
@@ -289,9 +342,30 @@ struct TimeUtil {
         // if 'initialize' has been called before.
 
     static void initialize();
-        // Do a platform-dependent initialization for the utilities.  Note that
-        // only after a call to this method all the following methods are
-        // guaranteed to be thread-safe.
+        // Do a platform-dependent initialization for the utilities.  Note
+        // that only after a call to this method all the following methods are
+        // guaranteed to be thread-safe.  Also note that this method does not
+        // calibrate the fast timer (see 'initializeFastTimer').
+
+    static void initializeFastTimer();
+        // Calibrate the fast timer if it has not yet been calibrated, waiting
+        // for the calibration to complete if another thread has started it.
+        // Note that calling this method before measuring an interval with the
+        // fast timer keeps the cost of the calibration out of that interval.
+        // This method is thread-safe.
+
+    static bool isFastTimerInitialized();
+        // Return 'true' if the calibration of the fast timer has been started
+        // (by 'initializeFastTimer' or by a fast-timer method), and 'false'
+        // otherwise.  Note that this method does not calibrate the fast
+        // timer.  This method is thread-safe.
+
+    static bool isFastTimerTscBased();
+        // Return 'true' if 'getFastTimer' and 'getFastTimerRaw' read the
+        // invariant time-stamp counter of the processor, and 'false' if they
+        // fall back to the clock used by 'getTimer'.  If the fast timer has
+        // not yet been calibrated, calibrate it first.  This method is
+        // thread-safe.
 };
 
 }  // close package namespace
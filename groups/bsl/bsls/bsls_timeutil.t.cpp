@@ -47,11 +47,17 @@ using namespace BloombergLP;
 // and the system results for plausible correct behavior.
 //-----------------------------------------------------------------------------
 // [11] bsls::Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
+// [13] bsls::Types::Int64 convertRawTime(OpaqueFastTime rawTime);
+// [ 1] bsls::Types::Int64 bsls::TimeUtil::getFastTimer();
+// [13] void getFastTimerRaw(OpaqueFastTime *timeValue);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
 // [ 1] void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getTimer();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
 // [11] OpaqueNativeTime getTimerRaw();
+// [13] void initializeFastTimer();
+// [13] bool isFastTimerInitialized();
+// [13] bool isFastTimerTscBased();
 //-----------------------------------------------------------------------------
 // [XX] Breathing Test -- NOT IMPLEMENTED
 // [ 2] USAGE
@@ -63,6 +69,7 @@ using namespace BloombergLP;
 // [ 8] Initialization test: getProcessUserTimer (UNIX only)
 // [ 9] Initialization test: getProcessTimers (UNIX only)
 // [10] Initialization test: getTimer (Windows only)
+// [13] Calibration of the fast timer against 'getTimer'
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -122,6 +129,12 @@ static Int64 callGetProcessTimersRetUser() {
     return uTimer;
 }
 
+static Int64 callGetFastTimerRaw() {
+    TU::OpaqueFastTime rawTime;
+    TU::getFastTimerRaw(&rawTime);
+    return TU::convertRawTime(rawTime);
+}
+
 static void osSleep(unsigned seconds) {
 #if defined(BSLS_PLATFORM_OS_UNIX)
     for(;;) {
@@ -497,6 +510,133 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING THE FAST TIMER
+        //
+        // Concerns:
+        //: 1 The fast timer reports the same implementation each time.
+        //:
+        //: 2 The fast timer measures intervals that agree with those measured
+        //:   by 'getTimer' to within the accuracy of the calibration.
+        //:
+        //: 3 The values of the fast timer are close to those of 'getTimer'
+        //:   (i.e., they share its origin).
+        //:
+        //: 4 'convertRawTime' converts a value obtained by 'getFastTimerRaw'
+        //:   to the value 'getFastTimer' would have returned at that time.
+        //:
+        //: 5 On platforms without an invariant time-stamp counter, the fast
+        //:   timer is the timer used by 'getTimer'.
+        //:
+        //: 6 'initialize' does not calibrate the fast timer, and
+        //:   'initializeFastTimer' does.
+        //
+        // Plan:
+        //: 1 Call 'initialize', and verify that 'isFastTimerInitialized'
+        //:   returns 'false'; call 'initializeFastTimer', and verify that it
+        //:   returns 'true'.  (C-6)
+        //:
+        //: 2 Call 'isFastTimerTscBased' repeatedly.  (C-1)
+        //:
+        //: 3 Measure a busy delay of 200 milliseconds with both timers, and
+        //:   verify that the measurements differ by less than 0.1%.  (C-2)
+        //:
+        //: 4 Compare the values of both timers read in succession.  (C-3)
+        //:
+        //: 5 Read the fast timer, its raw value, and the fast timer again, and
+        //:   verify that the converted raw value lies between the two.
+        //:   (C-4)
+        //:
+        //: 6 On platforms other than x86 and x86-64, verify that the fast
+        //:   timer is not TSC-based.  (C-5)
+        //
+        // Testing:
+        //   bsls::Types::Int64 convertRawTime(OpaqueFastTime rawTime);
+        //   void getFastTimerRaw(OpaqueFastTime *timeValue);
+        //   void initializeFastTimer();
+        //   bool isFastTimerInitialized();
+        //   bool isFastTimerTscBased();
+        //   Calibration of the fast timer against 'getTimer'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING THE FAST TIMER"
+                            "\n======================\n");
+
+        TU::initialize();
+        ASSERT(!TU::isFastTimerInitialized());
+
+        TU::initializeFastTimer();
+        ASSERT( TU::isFastTimerInitialized());
+
+        const bool TSC_BASED = TU::isFastTimerTscBased();
+        if (verbose) { T_ P(TSC_BASED) }
+
+        for (int i = 0; i < 10; ++i) {
+            ASSERT(TSC_BASED == TU::isFastTimerTscBased());
+        }
+
+#if !defined(BSLS_PLATFORM_CPU_X86) && !defined(BSLS_PLATFORM_CPU_X86_64)
+        ASSERT(!TSC_BASED);
+#endif
+
+        if (verbose) printf("\tAgreement of intervals.\n");
+        {
+            const Int64 DELAY = 200 * 1000 * 1000;  // nanoseconds
+
+            const Int64 fast0     = TU::getFastTimer();
+            const Int64 standard0 = TU::getTimer();
+            Int64       standard1;
+            do {
+                standard1 = TU::getTimer();
+            } while (standard1 - standard0 < DELAY);
+            const Int64 fast1     = TU::getFastTimer();
+
+            const Int64 standardInterval = standard1 - standard0;
+            const Int64 fastInterval     = fast1 - fast0;
+            const Int64 difference       = fastInterval - standardInterval;
+
+            if (veryVerbose) {
+                T_ P_(standardInterval) P_(fastInterval) P(difference)
+            }
+
+            // The fast interval encloses the standard one, so 'difference'
+            // is the sum of a (small) positive overhead and of the error of
+            // calibration.
+
+            LOOP2_ASSERT(standardInterval, fastInterval,
+                         difference > -standardInterval / 1000);
+            LOOP2_ASSERT(standardInterval, fastInterval,
+                         difference <  standardInterval / 1000);
+        }
+
+        if (verbose) printf("\tCommon origin.\n");
+        {
+            const Int64 standard = TU::getTimer();
+            const Int64 fast     = TU::getFastTimer();
+            const Int64 offset   = fast - standard;
+
+            if (veryVerbose) { T_ P(offset) }
+
+            LOOP_ASSERT(offset, offset > -10 * 1000 * 1000);
+            LOOP_ASSERT(offset, offset <  10 * 1000 * 1000);
+        }
+
+        if (verbose) printf("\tConversion of raw values.\n");
+        {
+            for (int i = 0; i < 1000; ++i) {
+                TU::OpaqueFastTime rawTime;
+
+                const Int64 before = TU::getFastTimer();
+                TU::getFastTimerRaw(&rawTime);
+                const Int64 after  = TU::getFastTimer();
+
+                const Int64 converted = TU::convertRawTime(rawTime);
+                LOOP3_ASSERT(before, converted, after, before <= converted);
+                LOOP3_ASSERT(before, converted, after, converted <= after);
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -1588,6 +1728,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getFastTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
@@ -1602,6 +1743,8 @@ int main(int argc, char *argv[])
         }
         TimerMethods[] = {
             { TU::getTimer,                 "getTimer",                true  },
+            { TU::getFastTimer,             "getFastTimer",            true  },
+            { callGetFastTimerRaw,          "getFastTimerRaw",         true  },
             { TU::getProcessSystemTimer,    "getProcessSystemTimer",   false },
             { TU::getProcessUserTimer,      "getProcessUserTimer",     false },
             { callGetProcessTimersRetSystem,"getProcessTimers(system)",false },
@@ -1681,6 +1824,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getFastTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
@@ -1693,6 +1837,8 @@ int main(int argc, char *argv[])
         }
         TimerMethods[] = {
             { TU::getTimer,                  "getTimer"                 },
+            { TU::getFastTimer,              "getFastTimer"             },
+            { callGetFastTimerRaw,           "getFastTimerRaw"          },
             { TU::getProcessSystemTimer,     "getProcessSystemTimer"    },
             { TU::getProcessUserTimer,       "getProcessUserTimer"      },
             { callGetProcessTimersRetSystem, "getProcessTimers(system)" },
@@ -1753,6 +1899,7 @@ int main(int argc, char *argv[])
         //
         // Testing:
         //   bsls::Types::Int64 bsls::TimeUtil::getTimer();
+        //   bsls::Types::Int64 bsls::TimeUtil::getFastTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
         //   bsls::Types::Int64 bsls::TimeUtil::getProcessUserTimer();
         //   void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64,
@@ -1765,6 +1912,8 @@ int main(int argc, char *argv[])
         }
         TimerMethods[] = {
             { TU::getTimer,                  "getTimer"                 },
+            { TU::getFastTimer,              "getFastTimer"             },
+            { callGetFastTimerRaw,           "getFastTimerRaw"          },
             { TU::getProcessSystemTimer,     "getProcessSystemTimer"    },
             { TU::getProcessUserTimer,       "getProcessUserTimer"      },
             { callGetProcessTimersRetSystem, "getProcessTimers(system)" },
@@ -507,8 +507,11 @@ class allocator {
 
     void deallocate(pointer p, size_type n = 1);
         // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the the mechanism
-        // object.  The 'n' argument is ignored by this allocator type.
+        // mechanism object by calling 'sizedDeallocate' on the the mechanism
+        // object, passing the size of the block ('n * sizeof(T)').  The
+        // behavior is undefined unless 'p' was allocated by a call to
+        // 'allocate' with the same 'n' on an allocator comparing equal to
+        // this one.
 
     void construct(pointer p, const T& val);
         // Copy-construct a 'T' object at the memory address specified by 'p'.
@@ -721,8 +724,9 @@ inline
 void allocator<T>::deallocate(typename allocator::pointer   p,
                               typename allocator::size_type n)
 {
-    (void) n;  // suppress warning
-    d_mechanism->deallocate(p);
+    d_mechanism->sizedDeallocate(
+                     p,
+                     BloombergLP::bslma::Allocator::size_type(n * sizeof(T)));
 }
 
 template <class T>
@@ -62,6 +62,7 @@ using namespace std;
 // [ 5] bsl::allocator::const_reference;
 // [ 5] bsl::allocator::value_type;
 // [ 5] template rebind<U>::other
+// [ 7] void deallocate(pointer p, size_type n = 1);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 6] USAGE EXAMPLE
@@ -109,6 +110,59 @@ enum { VERBOSE_ARG_NUM = 2, VERY_VERBOSE_ARG_NUM, VERY_VERY_VERBOSE_ARG_NUM };
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+                        // ============================
+                        // class SizeRecordingAllocator
+                        // ============================
+
+class SizeRecordingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol by forwarding to
+    // a test allocator, and records the size passed to the most recent call
+    // to 'allocate' and to 'sizedDeallocate'.
+
+    // DATA
+    bslma::TestAllocator d_imp;             // supplies memory
+    size_type            d_allocateSize;    // size of most recent allocation
+    size_type            d_deallocateSize;  // size passed to most recent
+                                            // 'sizedDeallocate', or -1 if
+                                            // 'deallocate' was called instead
+
+  public:
+    // CREATORS
+    SizeRecordingAllocator()
+    : d_imp("SizeRecording")
+    , d_allocateSize(0)
+    , d_deallocateSize(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        d_allocateSize = size;
+        return d_imp.allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        d_deallocateSize = -1;
+        d_imp.deallocate(address);
+    }
+
+    virtual void sizedDeallocate(void *address, size_type size)
+    {
+        d_deallocateSize = size;
+        d_imp.deallocate(address);
+    }
+
+    // ACCESSORS
+    size_type allocateSize() const { return d_allocateSize; }
+    size_type deallocateSize() const { return d_deallocateSize; }
+    bsls::Types::Int64 numBlocksInUse() const
+    {
+        return d_imp.numBlocksInUse();
+    }
+};
+
 //=============================================================================
 //                            USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -415,6 +469,70 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'deallocate'
+        //
+        // Concerns:
+        //: 1 'deallocate' passes the size of the block being returned, in
+        //:   bytes, to the 'sizedDeallocate' method of the mechanism.
+        //:
+        //: 2 The size passed to 'sizedDeallocate' is the same as the size
+        //:   passed to 'allocate' for the same block, for any 'n' and for any
+        //:   element type.
+        //
+        // Plan:
+        //: 1 Using an allocator that records the sizes passed to 'allocate'
+        //:   and 'sizedDeallocate', allocate and deallocate blocks for
+        //:   several values of 'n' and element types of various sizes, and
+        //:   verify that the recorded sizes agree.  (C-1..2)
+        //
+        // Testing:
+        //   void deallocate(pointer p, size_type n = 1);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'deallocate'"
+                            "\n====================\n");
+
+        typedef bslma::Allocator::size_type size_type;
+
+        SizeRecordingAllocator sra;
+
+        for (int n = 1; n < 20; ++n) {
+            {
+                bsl::allocator<char> a(&sra);
+                char *p = a.allocate(n);
+                LOOP_ASSERT(n, size_type(n) == sra.allocateSize());
+                a.deallocate(p, n);
+                LOOP_ASSERT(n, size_type(n) == sra.deallocateSize());
+            }
+            {
+                bsl::allocator<int> a(&sra);
+                int *p = a.allocate(n);
+                LOOP_ASSERT(n, n * sizeof(int) == sra.allocateSize());
+                a.deallocate(p, n);
+                LOOP_ASSERT(n, sra.allocateSize() == sra.deallocateSize());
+            }
+            {
+                bsl::allocator<double> a(&sra);
+                double *p = a.allocate(n);
+                LOOP_ASSERT(n, n * sizeof(double) == sra.allocateSize());
+                a.deallocate(p, n);
+                LOOP_ASSERT(n, sra.allocateSize() == sra.deallocateSize());
+            }
+        }
+
+        if (verbose) printf("\tDefault 'n'.\n");
+        {
+            bsl::allocator<double> a(&sra);
+            double *p = a.allocate(1);
+            a.deallocate(p);
+            ASSERT(size_type(sizeof(double)) == sra.deallocateSize());
+        }
+
+        ASSERT(0 == sra.numBlocksInUse());
+
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -0,0 +1,2599 @@
+// bslstl_btree.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREE
+#define INCLUDED_BSLSTL_BTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a B+-tree holding ordered values in wide nodes.
+//
+//@CLASSES:
+//  bslstl::Btree: B+-tree of values having unique keys
+//  bslstl::BtreeIterator: bidirectional iterator over a 'Btree'
+//  bslstl::Btree_SlotUtil: storage of one value in a node of a 'Btree'
+//  bslstl::Btree_Node: data common to the leaf and internal nodes of a tree
+//  bslstl::Btree_LeafNode: node holding values of a 'Btree'
+//  bslstl::Btree_InternalNode: node holding separator keys of a 'Btree'
+//
+//@SEE_ALSO: bslstl_btreemap, bslstl_btreeset, bslalg_rbtreeutil
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::Btree',
+// implementing an ordered container of values having unique keys as a B+-tree
+// whose nodes each hold many values.  'Btree' is the implementation underlying
+// 'bsl::btree_map' and 'bsl::btree_set', in the same way that
+// 'bslalg::RbTreeUtil' underlies 'bsl::map' and 'bsl::set'.
+//
+// A red-black tree allocates one node per element, so that finding a key in a
+// tree of 'N' elements visits approximately 'log2(N)' nodes, each in a
+// different (and typically uncached) cache line.  The nodes of a 'Btree' are
+// approximately 256 bytes (four cache lines) each, and hold as many values
+// (in a leaf node) or keys (in an internal node) as fit; a lookup therefore
+// visits approximately 'log(N) / log(B)' nodes, where 'B' is the number of
+// keys per node, and memory is allocated once per node rather than once per
+// element.
+//
+// Within a node, keys are located by a binary search that selects each half of
+// the remaining range without branching on the result of the comparison, since
+// that result is unpredictable and a mispredicted branch costs more than the
+// comparison of a small key.  Because the search no longer speculatively loads
+// the entries it will compare next, the lookup prefetches all of the cache
+// lines of each node as soon as it has chosen the node, so that their misses
+// overlap.
+//
+// The key of each value is extracted using the 'KEY_CONFIG' template
+// parameter, which has the same requirements as for 'bslstl::HashTable' (see
+// 'bslstl_unorderedmapkeyconfiguration' and
+// 'bslstl_unorderedsetkeyconfiguration'), and keys are ordered using the
+// 'COMPARATOR' template parameter.  Memory is supplied by the 'ALLOCATOR'
+// template parameter, which must meet the requirements of a standard
+// allocator; when 'ALLOCATOR' is 'bsl::allocator', the tree and its values use
+// the 'bslma::Allocator' protocol.
+//
+///Tree Layout
+///-----------
+// All values are held, in order, in the *leaf* nodes of the tree, which are
+// all at the same depth and are linked into a list so that in-order iteration
+// visits each leaf only once.  An *internal* node with 'n' keys has 'n + 1'
+// children; each key is a copy of the key of a value, called a *separator*,
+// such that every key in child 'i' is less than separator 'i', and every key
+// in child 'i + 1' is no less than separator 'i'.
+//
+// An insertion into a full node splits the node in two, adding a separator to
+// its parent (and so possibly splitting the parent).  A node is normally split
+// in half, but a node on the right (left) edge of the tree that is split by an
+// insertion at its end (start) keeps all of its existing values, so that a
+// tree built by inserting values in ascending (descending) order has full
+// nodes.
+//
+// When an erasure leaves a leaf less than half full, the leaf is merged with
+// an adjacent sibling if the values of both fit in one node; otherwise both
+// leaves are left unchanged, so that each pair of adjacent sibling leaves
+// together holds more than one node's worth of values.  Values are never moved
+// between sibling leaves by an erasure, since doing so would require copying a
+// key into a separator.  An internal node that is left less than half full is
+// merged with a sibling, or, if their separators do not fit in one node, takes
+// one separator (and child) from the sibling by rotation through their parent,
+// which moves separators without copying them.  Consequently, 'erase' never
+// allocates memory and never throws.
+//
+///Storage of Values
+///-----------------
+// Values are moved within and between nodes as the tree changes, always using
+// 'memcpy'.  If 'KEY_CONFIG::ValueType' is bitwise moveable (see
+// 'bslmf_isbitwisemoveable'), values are stored inline in the leaf nodes.
+// Otherwise, each value is allocated separately, and the leaf nodes hold their
+// addresses; the same applies to the separator keys of the internal nodes.  In
+// either case, values need not be assignable (e.g., the 'value_type' of a map,
+// 'bsl::pair<const KEY, VALUE>').
+//
+///Iterator Invalidation
+///---------------------
+// Since values are held in arrays within nodes, both insertion and erasure may
+// move other values of the tree.  Consequently, *all* iterators, pointers and
+// references to the values of a 'Btree' are invalidated by any insertion or
+// erasure, other than the iterator returned by the operation.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to implement a simple ordered set of 'int' values.  We can
+// use a 'Btree' configured to use the entire value as its key:
+//..
+//  typedef bslstl::Btree<bslstl::UnorderedSetKeyConfiguration<const int>,
+//                        std::less<int>,
+//                        bsl::allocator<int> > IntTree;
+//..
+// Next, we create a tree, supplying a test allocator:
+//..
+//  bslma::TestAllocator oa("object");
+//  IntTree              tree(&oa);
+//  assert(0 == tree.size());
+//  assert(0 == oa.numBlocksInUse());
+//..
+// Notice that no memory is allocated until the first insertion.  Then, we
+// insert some values in descending order, noting that a value that is already
+// present is not inserted again:
+//..
+//  for (int i = 999; i >= 0; --i) {
+//      bsl::pair<IntTree::Iterator, bool> result = tree.insert(i / 2);
+//      assert((1 == i % 2) == result.second);
+//      assert(i / 2        == *result.first);
+//  }
+//  assert(500 == tree.size());
+//..
+// Now, we observe that the values are visited in ascending order:
+//..
+//  int expected = 0;
+//  for (IntTree::Iterator it = tree.begin(); it != tree.end(); ++it) {
+//      assert(expected == *it);
+//      ++expected;
+//  }
+//  assert(500 == expected);
+//..
+// Finally, we look up and erase some values:
+//..
+//  assert(tree.end() != tree.find(7));
+//  assert(8          == *tree.upperBound(7));
+//
+//  assert(1 == tree.erase(7));
+//  assert(0 == tree.erase(7));
+//  assert(tree.end() == tree.find(7));
+//  assert(8          == *tree.lowerBound(7));
+//  assert(499        == tree.size());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECVQ
+#include <bslmf_removecvq.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ====================
+                        // struct Btree_ImpUtil
+                        // ====================
+
+struct Btree_ImpUtil {
+    // This 'struct' provides a namespace for constants used in the
+    // implementation of 'Btree' that do not depend on its template parameters.
+
+    // TYPES
+    enum {
+        k_NODE_SIZE       = 256,  // approximate size of a node (in bytes)
+        k_MIN_CAPACITY    =   4,  // minimum number of entries of a node
+        k_CACHE_LINE_SIZE =  64   // assumed size of a cache line (in bytes)
+    };
+
+    template <std::size_t HEADER_SIZE, std::size_t ENTRY_SIZE>
+    struct Capacity {
+        // This 'struct' provides the number of entries, each of the (template
+        // parameter) 'ENTRY_SIZE' bytes, of a node having the (template
+        // parameter) 'HEADER_SIZE' bytes of other data, such that the node
+        // occupies approximately 'k_NODE_SIZE' bytes.
+
+        enum {
+            VALUE = HEADER_SIZE + k_MIN_CAPACITY * ENTRY_SIZE <= k_NODE_SIZE
+                  ? (k_NODE_SIZE - HEADER_SIZE) / ENTRY_SIZE
+                  : static_cast<std::size_t>(k_MIN_CAPACITY)
+        };
+    };
+
+    // CLASS METHODS
+    static void prefetchNode(const void *node);
+        // Prefetch into the cache, for reading, the first 'k_NODE_SIZE' bytes
+        // of the specified 'node'.  Note that the entries searched in a node
+        // span several cache lines, and requesting all of them at once
+        // overlaps the latencies of the misses.
+};
+
+                        // =====================
+                        // struct Btree_SlotUtil
+                        // =====================
+
+template <class TYPE,
+          bool   INLINE = bslmf::IsBitwiseMoveable<TYPE>::value>
+struct Btree_SlotUtil {
+    // This 'struct' provides a namespace for functions that create, access,
+    // and destroy an object of the (template parameter) 'TYPE' held in a
+    // 'Slot', which may be moved using 'memcpy'.  This primary template holds
+    // the object inline, and is used for bitwise-moveable types.
+
+    // TYPES
+    typedef TYPE                     ValueType;
+    typedef bsls::ObjectBuffer<TYPE> Slot;
+
+    // CLASS METHODS
+    template <class ALLOCATOR, class SOURCE>
+    static void construct(Slot          *slot,
+                          ALLOCATOR&     allocator,
+                          const SOURCE&  source);
+        // Create in the specified 'slot' an object from the specified
+        // 'source', using the specified 'allocator' (rebound, if necessary) to
+        // supply memory.
+
+    template <class ALLOCATOR, class SOURCE1, class SOURCE2>
+    static void construct(Slot           *slot,
+                          ALLOCATOR&      allocator,
+                          const SOURCE1&  source1,
+                          const SOURCE2&  source2);
+        // Create in the specified 'slot' an object from the specified
+        // 'source1' and 'source2', using the specified 'allocator' (rebound,
+        // if necessary) to supply memory.
+
+    template <class ALLOCATOR>
+    static void destroy(Slot *slot, ALLOCATOR& allocator);
+        // Destroy the object in the specified 'slot', which was created using
+        // the specified 'allocator'.
+
+    static TYPE& value(Slot& slot);
+    static const TYPE& value(const Slot& slot);
+        // Return a reference to the object in the specified 'slot'.
+};
+
+template <class TYPE>
+struct Btree_SlotUtil<TYPE, false> {
+    // This partial specialization of 'Btree_SlotUtil' holds the object
+    // separately, and its address in the slot, and is used for types that are
+    // not bitwise moveable.
+
+    // TYPES
+    typedef TYPE  ValueType;
+    typedef TYPE *Slot;
+
+    // CLASS METHODS
+    template <class ALLOCATOR, class SOURCE>
+    static void construct(Slot          *slot,
+                          ALLOCATOR&     allocator,
+                          const SOURCE&  source);
+        // Create in the specified 'slot' an object from the specified
+        // 'source', using the specified 'allocator' (rebound, if necessary) to
+        // supply memory.
+
+    template <class ALLOCATOR, class SOURCE1, class SOURCE2>
+    static void construct(Slot           *slot,
+                          ALLOCATOR&      allocator,
+                          const SOURCE1&  source1,
+                          const SOURCE2&  source2);
+        // Create in the specified 'slot' an object from the specified
+        // 'source1' and 'source2', using the specified 'allocator' (rebound,
+        // if necessary) to supply memory.
+
+    template <class ALLOCATOR>
+    static void destroy(Slot *slot, ALLOCATOR& allocator);
+        // Destroy the object in the specified 'slot', which was created using
+        // the specified 'allocator'.
+
+    static TYPE& value(Slot& slot);
+    static const TYPE& value(const Slot& slot);
+        // Return a reference to the object in the specified 'slot'.
+};
+
+                        // ================
+                        // class Btree_Node
+                        // ================
+
+struct Btree_Node {
+    // This 'struct' holds the data common to the leaf and internal nodes of a
+    // 'Btree'.
+
+    // PUBLIC DATA
+    Btree_Node     *d_parent_p;  // parent (internal) node, or 0 for the root
+
+    int             d_size;      // number of values (leaf) or separators
+                                 // (internal node) held by this node
+
+    unsigned short  d_position;  // index of this node among the children of
+                                 // its parent
+
+    bool            d_isLeaf;    // 'true' if this node is a leaf
+};
+
+                        // ====================
+                        // class Btree_LeafNode
+                        // ====================
+
+template <class SLOT_UTIL>
+struct Btree_LeafNode : Btree_Node {
+    // This 'struct' holds, in order, values of a 'Btree', each in a slot
+    // managed by the (template parameter) 'SLOT_UTIL'.
+
+    // TYPES
+    typedef SLOT_UTIL                     SlotUtil;
+    typedef typename SLOT_UTIL::Slot      Slot;
+    typedef typename SLOT_UTIL::ValueType ValueType;
+
+    enum {
+        k_CAPACITY = Btree_ImpUtil::Capacity<
+                         sizeof(Btree_Node) + 2 * sizeof(void *),
+                         sizeof(Slot)>::VALUE
+    };
+
+    // PUBLIC DATA
+    Btree_LeafNode *d_prev_p;                // previous leaf, or 0
+    Btree_LeafNode *d_next_p;                // next leaf, or 0
+    Slot            d_values[k_CAPACITY];    // first 'd_size' hold values
+
+    // MANIPULATORS
+    ValueType& value(int index);
+        // Return a reference providing modifiable access to the value at the
+        // specified 'index' in this node.
+
+    // ACCESSORS
+    const ValueType& value(int index) const;
+        // Return a reference providing non-modifiable access to the value at
+        // the specified 'index' in this node.
+};
+
+                        // ========================
+                        // class Btree_InternalNode
+                        // ========================
+
+template <class SLOT_UTIL>
+struct Btree_InternalNode : Btree_Node {
+    // This 'struct' holds the separator keys of a 'Btree', each in a slot
+    // managed by the (template parameter) 'SLOT_UTIL', and the children that
+    // they separate.
+
+    // TYPES
+    typedef SLOT_UTIL                     SlotUtil;
+    typedef typename SLOT_UTIL::Slot      Slot;
+    typedef typename SLOT_UTIL::ValueType KeyType;
+
+    enum {
+        k_CAPACITY = Btree_ImpUtil::Capacity<
+                         sizeof(Btree_Node) + sizeof(void *),
+                         sizeof(Slot) + sizeof(void *)>::VALUE
+    };
+
+    // PUBLIC DATA
+    Btree_Node *d_children[k_CAPACITY + 1];  // first 'd_size + 1' are used
+    Slot        d_keys[k_CAPACITY];          // first 'd_size' hold keys
+
+    // ACCESSORS
+    const KeyType& key(int index) const;
+        // Return a reference providing non-modifiable access to the separator
+        // at the specified 'index' in this node.
+};
+
+                        // ===================
+                        // class BtreeIterator
+                        // ===================
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+class BtreeIterator {
+    // This class template implements an in-core value semantic type that is a
+    // standard-conforming bidirectional iterator (see section 24.2.6
+    // [bidirectional.iterators] of the C++11 standard) over the values of a
+    // 'Btree', held in leaf nodes of the (template parameter) type
+    // 'LEAF_NODE'.  The (template parameter) 'DIFFERENCE_TYPE' determines the
+    // standard mandated 'difference_type' of the iterator.
+
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<VALUE_TYPE>::Type           NcType;
+    typedef BtreeIterator<NcType, LEAF_NODE, DIFFERENCE_TYPE>     NcIter;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                          value_type;
+    typedef DIFFERENCE_TYPE                 difference_type;
+    typedef VALUE_TYPE                     *pointer;
+    typedef VALUE_TYPE&                     reference;
+    typedef bsl::bidirectional_iterator_tag iterator_category;
+        // Standard iterator defined types [24.4.2].
+
+  private:
+    // DATA
+    LEAF_NODE *d_node_p;  // leaf holding the current value, or 0
+    int        d_index;   // index of the current value in 'd_node_p'
+
+  public:
+    // CREATORS
+    BtreeIterator();
+        // Create a default-constructed iterator.  All default-constructed
+        // iterators compare equal to the past-the-end iterator of an empty
+        // tree.
+
+    BtreeIterator(LEAF_NODE *node, int index);
+        // Create an iterator referring to the value at the specified 'index'
+        // in the specified leaf 'node', or, if 'node' is the last leaf of its
+        // tree and 'index' is the number of values it holds, the past-the-end
+        // position of the tree.  Note that this constructor is an
+        // implementation detail and is not part of the C++ standard.
+
+    BtreeIterator(const NcIter& original);                          // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to 'const' iterator types.
+
+    //! BtreeIterator(const BtreeIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.  Note that this operation is either defined by the
+        // constructor taking 'NcIter' (if 'NcType' is the same as
+        // 'VALUE_TYPE'), or generated automatically by the compiler.
+
+    //! ~BtreeIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BtreeIterator& operator=(const BtreeIterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    BtreeIterator& operator++();
+        // Move this iterator to the next value in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to a value in the
+        // tree.
+
+    BtreeIterator& operator--();
+        // Move this iterator to the previous value in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to a value in the
+        // tree, other than the first, or to the past-the-end position of a
+        // non-empty tree.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the value at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to a value in the tree.
+
+    pointer operator->() const;
+        // Return the address of the value at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to a value in the tree.
+
+    int index() const;
+        // Return the index, within its leaf, of the value at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+
+    LEAF_NODE *node() const;
+        // Return the address of the leaf holding the value at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE1,
+          class VALUE_TYPE2,
+          class LEAF_NODE,
+          class DIFFERENCE_TYPE>
+bool operator==(
+            const BtreeIterator<VALUE_TYPE1, LEAF_NODE, DIFFERENCE_TYPE>& lhs,
+            const BtreeIterator<VALUE_TYPE2, LEAF_NODE, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators have the same
+    // value, and 'false' otherwise.  Two iterators have the same value if
+    // they refer to the same position of the same tree, or are both
+    // default-constructed.  The behavior is undefined unless 'VALUE_TYPE1'
+    // and 'VALUE_TYPE2' differ by at most their 'const' qualification.
+
+template <class VALUE_TYPE1,
+          class VALUE_TYPE2,
+          class LEAF_NODE,
+          class DIFFERENCE_TYPE>
+bool operator!=(
+            const BtreeIterator<VALUE_TYPE1, LEAF_NODE, DIFFERENCE_TYPE>& lhs,
+            const BtreeIterator<VALUE_TYPE2, LEAF_NODE, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not have
+    // the same value, and 'false' otherwise.  Two iterators do not have the
+    // same value if they refer to different positions, or exactly one of
+    // them is default-constructed.  The behavior is undefined unless
+    // 'VALUE_TYPE1' and 'VALUE_TYPE2' differ by at most their 'const'
+    // qualification.
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>
+operator++(BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next value in the tree and return the
+    // value of 'iter' prior to this call.  The behavior is undefined unless
+    // 'iter' refers to a value in the tree.
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>
+operator--(BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the previous value in the tree and return
+    // the value of 'iter' prior to this call.  The behavior is undefined
+    // unless 'iter' refers to a value in the tree, other than the first, or to
+    // the past-the-end position of a non-empty tree.
+
+                        // ===========
+                        // class Btree
+                        // ===========
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class Btree {
+    // This class template implements a value-semantic container holding
+    // values of type 'KEY_CONFIG::ValueType' having unique keys (of type
+    // 'KEY_CONFIG::KeyType', extracted by 'KEY_CONFIG::extractKey'), ordered
+    // by the (template parameter) type 'COMPARATOR', in a B+-tree as
+    // described in the component documentation.  Memory is supplied by the
+    // (template parameter) type 'ALLOCATOR'.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType                  KeyType;
+    typedef typename KEY_CONFIG::ValueType                ValueType;
+    typedef ALLOCATOR                                     AllocatorType;
+    typedef bsl::allocator_traits<ALLOCATOR>              AllocatorTraits;
+    typedef typename AllocatorTraits::size_type           SizeType;
+    typedef typename AllocatorTraits::difference_type     DifferenceType;
+
+    typedef typename bslmf::RemoveCvq<ValueType>::Type    StoredType;
+        // Type of the values held in the leaves of the tree.  Note that
+        // 'ValueType' is 'const'-qualified when the values of the tree must
+        // not be modified through its iterators (e.g., by 'bsl::btree_set').
+
+  private:
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<KeyType>::Type      StoredKeyType;
+
+    typedef Btree_SlotUtil<StoredType>                    ValueSlotUtil;
+    typedef Btree_SlotUtil<StoredKeyType>                 KeySlotUtil;
+    typedef typename ValueSlotUtil::Slot                  ValueSlot;
+    typedef typename KeySlotUtil::Slot                    KeySlot;
+
+    typedef Btree_Node                                    Node;
+    typedef Btree_LeafNode<ValueSlotUtil>                 LeafNode;
+    typedef Btree_InternalNode<KeySlotUtil>               InternalNode;
+
+    typedef typename AllocatorTraits::template
+                                rebind_traits<LeafNode>     LeafTraits;
+    typedef typename AllocatorTraits::template
+                                rebind_traits<InternalNode> InternalTraits;
+
+    enum {
+        k_LEAF_CAPACITY     = LeafNode::k_CAPACITY,
+        k_LEAF_MIN          = LeafNode::k_CAPACITY / 2,
+        k_INTERNAL_CAPACITY = InternalNode::k_CAPACITY,
+        k_INTERNAL_MIN      = InternalNode::k_CAPACITY / 2
+    };
+
+  public:
+    typedef BtreeIterator<ValueType, LeafNode, DifferenceType>
+                                                          Iterator;
+    typedef BtreeIterator<const ValueType, LeafNode, DifferenceType>
+                                                          ConstIterator;
+
+  private:
+    // DATA
+    ALLOCATOR   d_allocator;   // allocator for nodes and values
+    COMPARATOR  d_comparator;  // key-ordering functor
+    Node       *d_root_p;      // root node, or 0 if empty
+    LeafNode   *d_first_p;     // first leaf, or 0 if empty
+    LeafNode   *d_last_p;      // last leaf, or 0 if empty
+    SizeType    d_size;        // number of values
+
+  private:
+    // PRIVATE MANIPULATORS
+    InternalNode *allocateInternal();
+        // Return the address of a newly-allocated internal node having no
+        // separators and no parent.
+
+
+    LeafNode *allocateLeaf();
+        // Return the address of a newly-allocated empty leaf having no
+        // parent and no siblings.
+
+    void borrowInternal(InternalNode *node, InternalNode *sibling);
+        // Move the separator between the specified 'node' and its adjacent
+        // specified 'sibling' from their parent to 'node', together with the
+        // nearest child of 'sibling', and move the nearest separator of
+        // 'sibling' to the parent in its place.  The behavior is undefined
+        // unless 'sibling' has more than one separator.
+
+    void deallocateNode(Node *node);
+        // Return the memory of the specified 'node' to the allocator of this
+        // tree, without destroying any values or keys that it holds.
+
+    void destroyNode(Node *node);
+        // Destroy the values or keys held by the specified 'node' and by all
+        // of its descendants, and deallocate them.
+
+    Iterator eraseAt(LeafNode *leaf, int index);
+        // Destroy the value at the specified 'index' in the specified 'leaf',
+        // rebalance this tree, and return an iterator referring to the value
+        // that followed it.
+
+    Iterator insertAt(LeafNode *leaf, int index, ValueSlot *slot);
+        // Move the value held in the specified 'slot' into this tree at the
+        // specified 'index' in the specified 'leaf' (or into a new root if
+        // 'leaf' is 0), splitting nodes as required, and return an iterator
+        // referring to it.  If an exception is thrown, this tree is unchanged
+        // and the value remains in 'slot'.  The behavior is undefined unless
+        // the value belongs at that position.
+
+    Iterator insertNew(LeafNode *leaf, int index, ValueSlot *slot);
+        // Move the value held in the specified 'slot' into this tree at the
+        // specified 'index' in the specified 'leaf' as for 'insertAt', and
+        // return an iterator referring to it.  If an exception is thrown, the
+        // value in 'slot' is destroyed and this tree is unchanged.
+
+    void insertIntoParent(Node          *left,
+                          KeySlot       *separator,
+                          Node          *right,
+                          InternalNode **spares);
+        // Insert into the parent of the specified 'left' node the separator
+        // in the specified 'separator' slot, followed by the specified 'right'
+        // node, which is a new sibling of 'left', splitting the parent (and
+        // its ancestors) as required using internal nodes taken from the
+        // specified 'spares' list.  The behavior is undefined unless 'spares'
+        // holds enough nodes for all of the required splits.
+
+    void mergeInternal(InternalNode *left, InternalNode *right);
+        // Move the separator between the specified 'left' node and its right
+        // sibling, the specified 'right' node, and all of the separators and
+        // children of 'right', to the end of 'left', deallocate 'right', and
+        // rebalance their parent.
+
+    void mergeLeaves(LeafNode *left, LeafNode *right);
+        // Move the values of the specified 'right' leaf to the end of its
+        // left sibling, the specified 'left' leaf, destroy the separator
+        // between them, deallocate 'right', and rebalance their parent.
+
+    void rebalanceInternal(InternalNode *node);
+        // If the specified 'node' is less than half full, merge it with a
+        // sibling if the separators of both fit in one node, and otherwise
+        // move a separator to it from a sibling; remove the root if it has a
+        // single child.
+
+    void rebalanceLeaf(LeafNode **leaf, int *index);
+        // Merge the specified 'leaf' with a sibling if the values of both fit
+        // in one node, and update 'leaf' and the specified 'index' to refer to
+        // the position of the value that was at 'index' in 'leaf'.  Note that
+        // an empty leaf is always merged, since every internal node other
+        // than the root has at least one separator (and so every leaf has a
+        // sibling).
+
+    void removeEntry(InternalNode *node, int index);
+        // Remove, without destroying, the separator at the specified 'index'
+        // in the specified 'node', and the child following it.
+
+    void swapStorage(Btree& other);
+        // Exchange the nodes and values (but not the comparator or the
+        // allocator) of this tree with those of the specified 'other' tree.
+
+    // PRIVATE ACCESSORS
+    LeafNode *findLeaf(const KeyType& key) const;
+        // Return the leaf whose range of keys includes the specified 'key'.
+        // The behavior is undefined unless this tree is not empty.
+
+    bool isEdge(const Node *node, bool right) const;
+        // Return 'true' if the specified 'node' is on the right edge of this
+        // tree, if the specified 'right' is 'true', or on the left edge,
+        // otherwise.
+
+    int leafLowerBound(const LeafNode *leaf, const KeyType& key) const;
+        // Return the index of the first value in the specified 'leaf' whose
+        // key is not less than the specified 'key', or the number of values
+        // in 'leaf' if there is no such value.
+
+    int leafUpperBound(const LeafNode *leaf, const KeyType& key) const;
+        // Return the index of the first value in the specified 'leaf' whose
+        // key is greater than the specified 'key', or the number of values in
+        // 'leaf' if there is no such value.
+
+    const KeyType *lowerSeparator(const LeafNode *leaf) const;
+        // Return the address of the separator that is the lower bound of the
+        // keys of the specified 'leaf', or 0 if 'leaf' is the first leaf.
+
+    Iterator makeIterator(LeafNode *leaf, int index) const;
+        // Return an iterator referring to the value at the specified 'index'
+        // in the specified 'leaf', or to the first value of the next leaf if
+        // 'index' is the number of values in 'leaf'.
+
+  public:
+    // CREATORS
+    explicit Btree(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty tree.  Optionally specify an 'allocator' used to
+        // supply memory.  If 'allocator' is not specified, a
+        // default-constructed allocator is used.  Use a default-constructed
+        // 'COMPARATOR' object.
+
+    Btree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        // Create an empty tree that orders keys using the specified
+        // 'comparator', and uses the specified 'allocator' to supply memory.
+
+    Btree(const Btree& original);
+        // Create a tree having the same value and comparator as the specified
+        // 'original', using the allocator returned by
+        // 'AllocatorTraits::select_on_container_copy_construction' applied to
+        // the allocator of 'original' to supply memory.
+
+    Btree(const Btree& original, const ALLOCATOR& allocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original', using the specified 'allocator' to supply memory.
+
+    ~Btree();
+        // Destroy this tree and its values.
+
+    // MANIPULATORS
+    Btree& operator=(const Btree& rhs);
+        // Assign to this tree the value and comparator of the specified 'rhs',
+        // and return a reference providing modifiable access to this tree.
+        // The allocator of this tree is not changed.  If an exception is
+        // thrown, this tree is unchanged.
+
+    Iterator begin();
+        // Return an iterator referring to the first value of this tree, or
+        // 'end()' if this tree is empty.
+
+    Iterator end();
+        // Return an iterator referring to the past-the-end position of this
+        // tree.
+
+    Iterator erase(ConstIterator position);
+        // Remove the value at the specified 'position' from this tree, and
+        // return an iterator referring to the value following it (or
+        // 'end()').  The behavior is undefined unless 'position' refers to a
+        // value of this tree.  Note that all other iterators are invalidated.
+
+    SizeType erase(const KeyType& key);
+        // Remove the value having the specified 'key' from this tree, if such
+        // a value exists.  Return the number of values removed (either 0 or
+        // 1).
+
+    Iterator erase(ConstIterator first, ConstIterator last);
+        // Remove the values from the specified 'first' position up to, but
+        // not including, the specified 'last' position from this tree, and
+        // return an iterator referring to the value that was at 'last' (or
+        // 'end()').  The behavior is undefined unless '[first .. last)' is a
+        // valid range of this tree.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or 'end()' if there is no such value.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no value
+        // having the same key is present.  Return a pair whose 'first' member
+        // refers to the value having the key of 'value', and whose 'second'
+        // member is 'true' if 'value' was inserted and 'false' otherwise.  If
+        // an exception is thrown, this tree is unchanged.
+
+    template <class SOURCE_TYPE>
+    bsl::pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+        // Insert a 'ValueType' object created from the specified 'value' into
+        // this tree if no value having the same key is present.  Return a pair
+        // whose 'first' member refers to the value having the key of the
+        // created object, and whose 'second' member is 'true' if it was
+        // inserted and 'false' otherwise.  If an exception is thrown, this
+        // tree is unchanged.
+
+    Iterator insert(ConstIterator hint, const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if no value
+        // having the same key is present, and return an iterator referring to
+        // the value having the key of 'value'.  If 'value' belongs
+        // immediately before the specified 'hint', it is inserted in
+        // amortized constant time; otherwise 'hint' is ignored.  If an
+        // exception is thrown, this tree is unchanged.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this tree.
+
+    Iterator insertIfMissing(const KeyType& key);
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', first inserting a value created from 'key' and a
+        // default-constructed 'ValueType::second_type' if no such value is
+        // present.  If an exception is thrown, this tree is unchanged.  Note
+        // that this method is available only if 'ValueType' is a pair.
+
+    Iterator lowerBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is not less than the specified 'key', or 'end()' if there is no
+        // such value.
+
+    void removeAll();
+        // Destroy all values of this tree, and deallocate all of its nodes.
+
+    void swap(Btree& other);
+        // Exchange the value and comparator of this tree with those of the
+        // specified 'other' tree.  The behavior is undefined unless this tree
+        // and 'other' use equal allocators.
+
+    Iterator upperBound(const KeyType& key);
+        // Return an iterator referring to the first value of this tree whose
+        // key is greater than the specified 'key', or 'end()' if there is no
+        // such value.
+
+    // ACCESSORS
+    const ALLOCATOR& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // of this tree.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first value of this tree, or
+        // 'end()' if this tree is empty.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-ordering functor of this tree.
+
+    ConstIterator end() const;
+        // Return an iterator referring to the past-the-end position of this
+        // tree.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the value of this tree having the
+        // specified 'key', or 'end()' if there is no such value.
+
+    int height() const;
+        // Return the number of levels of nodes of this tree, or 0 if it is
+        // empty.
+
+    ConstIterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is not less than the specified 'key', or 'end()' if there is no
+        // such value.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values this tree
+        // could hold.
+
+    SizeType size() const;
+        // Return the number of values in this tree.
+
+    ConstIterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first value of this tree whose
+        // key is greater than the specified 'key', or 'end()' if there is no
+        // such value.
+
+                        // Aspects
+
+    static int internalCapacity();
+        // Return the maximum number of separators of an internal node of a
+        // tree of this type.
+
+    static int leafCapacity();
+        // Return the maximum number of values of a leaf node of a tree of this
+        // type.
+};
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool operator==(const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' trees have the same
+    // value, and 'false' otherwise.  Two trees have the same value if they
+    // have the same number of values, and each value of 'lhs' compares equal,
+    // using 'operator==', to the value at the same position in 'rhs'.
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' trees do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void swap(Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& a,
+          Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' and 'b' trees.
+    // The behavior is undefined unless 'a' and 'b' use equal allocators.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------
+                        // struct Btree_ImpUtil
+                        // --------------------
+
+// CLASS METHODS
+inline
+void Btree_ImpUtil::prefetchNode(const void *node)
+{
+    const char *address = static_cast<const char *>(node);
+    for (int offset = 0; offset < k_NODE_SIZE; offset += k_CACHE_LINE_SIZE) {
+        bsls::PerformanceHint::prefetchForReading(address + offset);
+    }
+}
+
+                        // ---------------------
+                        // struct Btree_SlotUtil
+                        // ---------------------
+
+// CLASS METHODS
+template <class TYPE, bool INLINE>
+template <class ALLOCATOR, class SOURCE>
+inline
+void Btree_SlotUtil<TYPE, INLINE>::construct(Slot          *slot,
+                                             ALLOCATOR&     allocator,
+                                             const SOURCE&  source)
+{
+    bsl::allocator_traits<ALLOCATOR>::construct(allocator,
+                                                &slot->object(),
+                                                source);
+}
+
+template <class TYPE, bool INLINE>
+template <class ALLOCATOR, class SOURCE1, class SOURCE2>
+inline
+void Btree_SlotUtil<TYPE, INLINE>::construct(Slot           *slot,
+                                             ALLOCATOR&      allocator,
+                                             const SOURCE1&  source1,
+                                             const SOURCE2&  source2)
+{
+    bsl::allocator_traits<ALLOCATOR>::construct(allocator,
+                                                &slot->object(),
+                                                source1,
+                                                source2);
+}
+
+template <class TYPE, bool INLINE>
+template <class ALLOCATOR>
+inline
+void Btree_SlotUtil<TYPE, INLINE>::destroy(Slot *slot, ALLOCATOR& allocator)
+{
+    bsl::allocator_traits<ALLOCATOR>::destroy(allocator, &slot->object());
+}
+
+template <class TYPE, bool INLINE>
+inline
+TYPE& Btree_SlotUtil<TYPE, INLINE>::value(Slot& slot)
+{
+    return slot.object();
+}
+
+template <class TYPE, bool INLINE>
+inline
+const TYPE& Btree_SlotUtil<TYPE, INLINE>::value(const Slot& slot)
+{
+    return slot.object();
+}
+
+template <class TYPE>
+template <class ALLOCATOR, class SOURCE>
+void Btree_SlotUtil<TYPE, false>::construct(Slot          *slot,
+                                            ALLOCATOR&     allocator,
+                                            const SOURCE&  source)
+{
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                               rebind_traits<TYPE> Traits;
+
+    typename Traits::allocator_type typeAllocator(allocator);
+
+    TYPE *object = Traits::allocate(typeAllocator, 1);
+    BSLS_TRY {
+        Traits::construct(typeAllocator, object, source);
+    }
+    BSLS_CATCH(...) {
+        Traits::deallocate(typeAllocator, object, 1);
+        BSLS_RETHROW;
+    }
+    *slot = object;
+}
+
+template <class TYPE>
+template <class ALLOCATOR, class SOURCE1, class SOURCE2>
+void Btree_SlotUtil<TYPE, false>::construct(Slot           *slot,
+                                            ALLOCATOR&      allocator,
+                                            const SOURCE1&  source1,
+                                            const SOURCE2&  source2)
+{
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                               rebind_traits<TYPE> Traits;
+
+    typename Traits::allocator_type typeAllocator(allocator);
+
+    TYPE *object = Traits::allocate(typeAllocator, 1);
+    BSLS_TRY {
+        Traits::construct(typeAllocator, object, source1, source2);
+    }
+    BSLS_CATCH(...) {
+        Traits::deallocate(typeAllocator, object, 1);
+        BSLS_RETHROW;
+    }
+    *slot = object;
+}
+
+template <class TYPE>
+template <class ALLOCATOR>
+inline
+void Btree_SlotUtil<TYPE, false>::destroy(Slot *slot, ALLOCATOR& allocator)
+{
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                               rebind_traits<TYPE> Traits;
+
+    typename Traits::allocator_type typeAllocator(allocator);
+
+    Traits::destroy(typeAllocator, *slot);
+    Traits::deallocate(typeAllocator, *slot, 1);
+}
+
+template <class TYPE>
+inline
+TYPE& Btree_SlotUtil<TYPE, false>::value(Slot& slot)
+{
+    return *slot;
+}
+
+template <class TYPE>
+inline
+const TYPE& Btree_SlotUtil<TYPE, false>::value(const Slot& slot)
+{
+    return *slot;
+}
+
+                        // --------------------
+                        // class Btree_LeafNode
+                        // --------------------
+
+// MANIPULATORS
+template <class SLOT_UTIL>
+inline
+typename Btree_LeafNode<SLOT_UTIL>::ValueType&
+Btree_LeafNode<SLOT_UTIL>::value(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return SLOT_UTIL::value(d_values[index]);
+}
+
+// ACCESSORS
+template <class SLOT_UTIL>
+inline
+const typename Btree_LeafNode<SLOT_UTIL>::ValueType&
+Btree_LeafNode<SLOT_UTIL>::value(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return SLOT_UTIL::value(d_values[index]);
+}
+
+                        // ------------------------
+                        // class Btree_InternalNode
+                        // ------------------------
+
+// ACCESSORS
+template <class SLOT_UTIL>
+inline
+const typename Btree_InternalNode<SLOT_UTIL>::KeyType&
+Btree_InternalNode<SLOT_UTIL>::key(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return SLOT_UTIL::value(d_keys[index]);
+}
+
+                        // -------------------
+                        // class BtreeIterator
+                        // -------------------
+
+// CREATORS
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::BtreeIterator()
+: d_node_p(0)
+, d_index(0)
+{
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::BtreeIterator(
+                                                           LEAF_NODE *node,
+                                                           int        index)
+: d_node_p(node)
+, d_index(index)
+{
+    BSLS_ASSERT_SAFE(node || 0 == index);
+    BSLS_ASSERT_SAFE(!node || (0 <= index && index <= node->d_size));
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::BtreeIterator(
+                                                        const NcIter& original)
+: d_node_p(original.node())
+, d_index(original.index())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>&
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_index < d_node_p->d_size);
+
+    if (++d_index == d_node_p->d_size && d_node_p->d_next_p) {
+        d_node_p = d_node_p->d_next_p;
+        d_index  = 0;
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>&
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    if (0 == d_index) {
+        BSLS_ASSERT_SAFE(d_node_p->d_prev_p);
+
+        d_node_p = d_node_p->d_prev_p;
+        d_index  = d_node_p->d_size;
+    }
+    --d_index;
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+typename BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::reference
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value(d_index);
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+typename BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::pointer
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return &d_node_p->value(d_index);
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+int BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::index() const
+{
+    return d_index;
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+LEAF_NODE *BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>::node() const
+{
+    return d_node_p;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE1,
+          class VALUE_TYPE2,
+          class LEAF_NODE,
+          class DIFFERENCE_TYPE>
+inline
+bool operator==(
+             const BtreeIterator<VALUE_TYPE1, LEAF_NODE, DIFFERENCE_TYPE>& lhs,
+             const BtreeIterator<VALUE_TYPE2, LEAF_NODE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.node() == rhs.node() && lhs.index() == rhs.index();
+}
+
+template <class VALUE_TYPE1,
+          class VALUE_TYPE2,
+          class LEAF_NODE,
+          class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+             const BtreeIterator<VALUE_TYPE1, LEAF_NODE, DIFFERENCE_TYPE>& lhs,
+             const BtreeIterator<VALUE_TYPE2, LEAF_NODE, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.node() != rhs.node() || lhs.index() != rhs.index();
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>
+operator++(BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>& iter, int)
+{
+    BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE> temp(iter);
+    ++iter;
+    return temp;
+}
+
+template <class VALUE_TYPE, class LEAF_NODE, class DIFFERENCE_TYPE>
+inline
+BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>
+operator--(BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE>& iter, int)
+{
+    BtreeIterator<VALUE_TYPE, LEAF_NODE, DIFFERENCE_TYPE> temp(iter);
+    --iter;
+    return temp;
+}
+
+                        // -----------
+                        // class Btree
+                        // -----------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::InternalNode *
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocateInternal()
+{
+    typename InternalTraits::allocator_type nodeAllocator(d_allocator);
+
+    InternalNode *node = InternalTraits::allocate(nodeAllocator, 1);
+    node->d_parent_p = 0;
+    node->d_size     = 0;
+    node->d_position = 0;
+    node->d_isLeaf   = false;
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::LeafNode *
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocateLeaf()
+{
+    typename LeafTraits::allocator_type nodeAllocator(d_allocator);
+
+    LeafNode *leaf = LeafTraits::allocate(nodeAllocator, 1);
+    leaf->d_parent_p = 0;
+    leaf->d_size     = 0;
+    leaf->d_position = 0;
+    leaf->d_isLeaf   = true;
+    leaf->d_prev_p   = 0;
+    leaf->d_next_p   = 0;
+    return leaf;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::borrowInternal(
+                                                       InternalNode *node,
+                                                       InternalNode *sibling)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(sibling);
+    BSLS_ASSERT_SAFE(node->d_parent_p == sibling->d_parent_p);
+    BSLS_ASSERT_SAFE(1 < sibling->d_size);
+
+    InternalNode *parent = static_cast<InternalNode *>(node->d_parent_p);
+    const int     size   = node->d_size;
+
+    if (sibling->d_position < node->d_position) {
+        // Rotate the last separator and child of the left 'sibling' through
+        // the parent to the front of 'node'.
+
+        const int separator = sibling->d_position;
+        const int last      = sibling->d_size;
+
+        std::memmove(static_cast<void *>(node->d_keys + 1),
+                     node->d_keys,
+                     size * sizeof(KeySlot));
+        std::memmove(node->d_children + 1,
+                     node->d_children,
+                     (size + 1) * sizeof(Node *));
+        std::memcpy(static_cast<void *>(node->d_keys),
+                    parent->d_keys + separator,
+                    sizeof(KeySlot));
+        std::memcpy(static_cast<void *>(parent->d_keys + separator),
+                    sibling->d_keys + last - 1,
+                    sizeof(KeySlot));
+        node->d_children[0] = sibling->d_children[last];
+        node->d_size        = size + 1;
+        sibling->d_size     = last - 1;
+
+        node->d_children[0]->d_parent_p = node;
+        for (int i = 0; i <= size + 1; ++i) {
+            node->d_children[i]->d_position = static_cast<unsigned short>(i);
+        }
+    }
+    else {
+        // Rotate the first separator and child of the right 'sibling' through
+        // the parent to the back of 'node'.
+
+        const int separator   = node->d_position;
+        const int siblingSize = sibling->d_size;
+
+        std::memcpy(static_cast<void *>(node->d_keys + size),
+                    parent->d_keys + separator,
+                    sizeof(KeySlot));
+        std::memcpy(static_cast<void *>(parent->d_keys + separator),
+                    sibling->d_keys,
+                    sizeof(KeySlot));
+        node->d_children[size + 1] = sibling->d_children[0];
+        node->d_size               = size + 1;
+
+        Node *child = node->d_children[size + 1];
+        child->d_parent_p = node;
+        child->d_position = static_cast<unsigned short>(size + 1);
+
+        std::memmove(static_cast<void *>(sibling->d_keys),
+                     sibling->d_keys + 1,
+                     (siblingSize - 1) * sizeof(KeySlot));
+        std::memmove(sibling->d_children,
+                     sibling->d_children + 1,
+                     siblingSize * sizeof(Node *));
+        sibling->d_size = siblingSize - 1;
+
+        for (int i = 0; i < siblingSize; ++i) {
+            sibling->d_children[i]->d_position =
+                                              static_cast<unsigned short>(i);
+        }
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deallocateNode(Node *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (node->d_isLeaf) {
+        typename LeafTraits::allocator_type nodeAllocator(d_allocator);
+        LeafTraits::deallocate(nodeAllocator,
+                               static_cast<LeafNode *>(node),
+                               1);
+    }
+    else {
+        typename InternalTraits::allocator_type nodeAllocator(d_allocator);
+        InternalTraits::deallocate(nodeAllocator,
+                                   static_cast<InternalNode *>(node),
+                                   1);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::destroyNode(Node *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (node->d_isLeaf) {
+        LeafNode *leaf = static_cast<LeafNode *>(node);
+        for (int i = 0; i < leaf->d_size; ++i) {
+            ValueSlotUtil::destroy(&leaf->d_values[i], d_allocator);
+        }
+    }
+    else {
+        InternalNode *internal = static_cast<InternalNode *>(node);
+        for (int i = 0; i < internal->d_size; ++i) {
+            KeySlotUtil::destroy(&internal->d_keys[i], d_allocator);
+        }
+        for (int i = 0; i <= internal->d_size; ++i) {
+            destroyNode(internal->d_children[i]);
+        }
+    }
+    deallocateNode(node);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::eraseAt(LeafNode *leaf, int index)
+{
+    BSLS_ASSERT_SAFE(leaf);
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < leaf->d_size);
+
+    ValueSlotUtil::destroy(&leaf->d_values[index], d_allocator);
+    std::memmove(static_cast<void *>(leaf->d_values + index),
+                 leaf->d_values + index + 1,
+                 (leaf->d_size - index - 1) * sizeof(ValueSlot));
+    --leaf->d_size;
+    --d_size;
+
+    if (leaf == d_root_p) {
+        if (0 == leaf->d_size) {
+            deallocateNode(leaf);
+            d_root_p  = 0;
+            d_first_p = 0;
+            d_last_p  = 0;
+            return Iterator();                                        // RETURN
+        }
+    }
+    else if (leaf->d_size < k_LEAF_MIN) {
+        rebalanceLeaf(&leaf, &index);
+    }
+
+    return makeIterator(leaf, index);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertAt(LeafNode  *leaf,
+                                                   int        index,
+                                                   ValueSlot *slot)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == leaf)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BSLS_ASSERT_SAFE(0 == d_root_p);
+
+        leaf = allocateLeaf();
+        std::memcpy(static_cast<void *>(leaf->d_values),
+                    slot,
+                    sizeof(ValueSlot));
+        leaf->d_size = 1;
+        d_root_p     = leaf;
+        d_first_p    = leaf;
+        d_last_p     = leaf;
+        d_size       = 1;
+        return Iterator(leaf, 0);                                     // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index <= leaf->d_size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(leaf->d_size < k_LEAF_CAPACITY)) {
+        std::memmove(static_cast<void *>(leaf->d_values + index + 1),
+                     leaf->d_values + index,
+                     (leaf->d_size - index) * sizeof(ValueSlot));
+        std::memcpy(static_cast<void *>(leaf->d_values + index),
+                    slot,
+                    sizeof(ValueSlot));
+        ++leaf->d_size;
+        ++d_size;
+        return Iterator(leaf, index);                                 // RETURN
+    }
+
+    // The leaf is full and must be split.  Choose the split point, and then
+    // obtain everything that the split requires (a copy of the key that will
+    // separate the two halves, a new leaf, and an internal node for each
+    // ancestor that will be split in turn) before modifying the tree, so that
+    // an exception leaves the tree unchanged.
+
+    const int total = k_LEAF_CAPACITY + 1;
+    int       mid;
+    if (k_LEAF_CAPACITY == index && leaf == d_last_p) {
+        mid = k_LEAF_CAPACITY;
+    }
+    else if (0 == index && leaf == d_first_p) {
+        mid = 1;
+    }
+    else {
+        mid = total / 2;
+    }
+
+    const StoredType& firstOfRight = mid == index
+                                   ? ValueSlotUtil::value(*slot)
+                                   : leaf->value(mid < index ? mid : mid - 1);
+
+    KeySlot separator;
+    KeySlotUtil::construct(&separator,
+                           d_allocator,
+                           KEY_CONFIG::extractKey(firstOfRight));
+
+    LeafNode     *right  = 0;
+    InternalNode *spares = 0;
+    BSLS_TRY {
+        right = allocateLeaf();
+
+        Node *ancestor = leaf->d_parent_p;
+        while (ancestor && k_INTERNAL_CAPACITY == ancestor->d_size) {
+            InternalNode *spare = allocateInternal();
+            spare->d_parent_p = spares;
+            spares = spare;
+            ancestor = ancestor->d_parent_p;
+        }
+        if (0 == ancestor) {
+            InternalNode *spare = allocateInternal();
+            spare->d_parent_p = spares;
+            spares = spare;
+        }
+    }
+    BSLS_CATCH(...) {
+        while (spares) {
+            Node *next = spares->d_parent_p;
+            deallocateNode(spares);
+            spares = static_cast<InternalNode *>(next);
+        }
+        if (right) {
+            deallocateNode(right);
+        }
+        KeySlotUtil::destroy(&separator, d_allocator);
+        BSLS_RETHROW;
+    }
+
+    // Nothing below this point can throw.
+
+    ValueSlot values[k_LEAF_CAPACITY + 1];
+    std::memcpy(static_cast<void *>(values),
+                leaf->d_values,
+                index * sizeof(ValueSlot));
+    std::memcpy(static_cast<void *>(values + index), slot, sizeof(ValueSlot));
+    std::memcpy(static_cast<void *>(values + index + 1),
+                leaf->d_values + index,
+                (k_LEAF_CAPACITY - index) * sizeof(ValueSlot));
+
+    std::memcpy(static_cast<void *>(leaf->d_values),
+                values,
+                mid * sizeof(ValueSlot));
+    leaf->d_size = mid;
+
+    std::memcpy(static_cast<void *>(right->d_values),
+                values + mid,
+                (total - mid) * sizeof(ValueSlot));
+    right->d_size = total - mid;
+
+    right->d_prev_p = leaf;
+    right->d_next_p = leaf->d_next_p;
+    if (leaf->d_next_p) {
+        leaf->d_next_p->d_prev_p = right;
+    }
+    else {
+        d_last_p = right;
+    }
+    leaf->d_next_p = right;
+    ++d_size;
+
+    insertIntoParent(leaf, &separator, right, &spares);
+    BSLS_ASSERT_SAFE(0 == spares);
+
+    return index < mid ? Iterator(leaf, index)
+                       : Iterator(right, index - mid);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertNew(LeafNode  *leaf,
+                                                    int        index,
+                                                    ValueSlot *slot)
+{
+    BSLS_TRY {
+        return insertAt(leaf, index, slot);                           // RETURN
+    }
+    BSLS_CATCH(...) {
+        ValueSlotUtil::destroy(slot, d_allocator);
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIntoParent(
+                                                     Node          *left,
+                                                     KeySlot       *separator,
+                                                     Node          *right,
+                                                     InternalNode **spares)
+{
+    BSLS_ASSERT_SAFE(left);
+    BSLS_ASSERT_SAFE(separator);
+    BSLS_ASSERT_SAFE(right);
+    BSLS_ASSERT_SAFE(spares);
+
+    InternalNode *parent = static_cast<InternalNode *>(left->d_parent_p);
+
+    if (0 == parent) {
+        // 'left' is the root; add a new root above it.
+
+        BSLS_ASSERT_SAFE(*spares);
+
+        InternalNode *root = *spares;
+        *spares = static_cast<InternalNode *>(root->d_parent_p);
+
+        root->d_parent_p = 0;
+        root->d_size     = 1;
+        std::memcpy(static_cast<void *>(root->d_keys),
+                    separator,
+                    sizeof(KeySlot));
+        root->d_children[0] = left;
+        root->d_children[1] = right;
+
+        left->d_parent_p  = root;
+        left->d_position  = 0;
+        right->d_parent_p = root;
+        right->d_position = 1;
+
+        d_root_p = root;
+        return;                                                       // RETURN
+    }
+
+    const int position = left->d_position;
+    const int size     = parent->d_size;
+
+    if (size < k_INTERNAL_CAPACITY) {
+        std::memmove(static_cast<void *>(parent->d_keys + position + 1),
+                     parent->d_keys + position,
+                     (size - position) * sizeof(KeySlot));
+        std::memcpy(static_cast<void *>(parent->d_keys + position),
+                    separator,
+                    sizeof(KeySlot));
+        std::memmove(parent->d_children + position + 2,
+                     parent->d_children + position + 1,
+                     (size - position) * sizeof(Node *));
+        parent->d_children[position + 1] = right;
+        parent->d_size = size + 1;
+
+        right->d_parent_p = parent;
+        for (int i = position + 1; i <= size + 1; ++i) {
+            parent->d_children[i]->d_position =
+                                              static_cast<unsigned short>(i);
+        }
+        return;                                                       // RETURN
+    }
+
+    // The parent is full; split it, moving its middle separator up to its own
+    // parent.
+
+    KeySlot keys[k_INTERNAL_CAPACITY + 1];
+    Node   *children[k_INTERNAL_CAPACITY + 2];
+
+    std::memcpy(static_cast<void *>(keys),
+                parent->d_keys,
+                position * sizeof(KeySlot));
+    std::memcpy(static_cast<void *>(keys + position),
+                separator,
+                sizeof(KeySlot));
+    std::memcpy(static_cast<void *>(keys + position + 1),
+                parent->d_keys + position,
+                (size - position) * sizeof(KeySlot));
+
+    std::memcpy(children, parent->d_children, (position + 1) * sizeof(Node *));
+    children[position + 1] = right;
+    std::memcpy(children + position + 2,
+                parent->d_children + position + 1,
+                (size - position) * sizeof(Node *));
+
+    // Note that each half keeps at least one separator.
+
+    int mid;
+    if (k_INTERNAL_CAPACITY == position && isEdge(parent, true)) {
+        mid = k_INTERNAL_CAPACITY - 1;
+    }
+    else if (0 == position && isEdge(parent, false)) {
+        mid = 1;
+    }
+    else {
+        mid = k_INTERNAL_CAPACITY / 2;
+    }
+
+    BSLS_ASSERT_SAFE(*spares);
+
+    InternalNode *sibling = *spares;
+    *spares = static_cast<InternalNode *>(sibling->d_parent_p);
+    sibling->d_parent_p = 0;
+
+    std::memcpy(static_cast<void *>(parent->d_keys),
+                keys,
+                mid * sizeof(KeySlot));
+    parent->d_size = mid;
+    for (int i = 0; i <= mid; ++i) {
+        parent->d_children[i] = children[i];
+        children[i]->d_parent_p = parent;
+        children[i]->d_position = static_cast<unsigned short>(i);
+    }
+
+    const int siblingSize = k_INTERNAL_CAPACITY - mid;
+    std::memcpy(static_cast<void *>(sibling->d_keys),
+                keys + mid + 1,
+                siblingSize * sizeof(KeySlot));
+    sibling->d_size = siblingSize;
+    for (int i = 0; i <= siblingSize; ++i) {
+        sibling->d_children[i] = children[mid + 1 + i];
+        children[mid + 1 + i]->d_parent_p = sibling;
+        children[mid + 1 + i]->d_position = static_cast<unsigned short>(i);
+    }
+
+    insertIntoParent(parent, keys + mid, sibling, spares);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeInternal(
+                                                       InternalNode *left,
+                                                       InternalNode *right)
+{
+    BSLS_ASSERT_SAFE(left);
+    BSLS_ASSERT_SAFE(right);
+    BSLS_ASSERT_SAFE(left->d_parent_p == right->d_parent_p);
+    BSLS_ASSERT_SAFE(left->d_position + 1 == right->d_position);
+    BSLS_ASSERT_SAFE(left->d_size + 1 + right->d_size
+                                                      <= k_INTERNAL_CAPACITY);
+
+    InternalNode *parent   = static_cast<InternalNode *>(left->d_parent_p);
+    const int     position = left->d_position;
+    const int     size     = left->d_size;
+
+    std::memcpy(static_cast<void *>(left->d_keys + size),
+                parent->d_keys + position,
+                sizeof(KeySlot));
+    std::memcpy(static_cast<void *>(left->d_keys + size + 1),
+                right->d_keys,
+                right->d_size * sizeof(KeySlot));
+
+    for (int i = 0; i <= right->d_size; ++i) {
+        Node *child = right->d_children[i];
+        left->d_children[size + 1 + i] = child;
+        child->d_parent_p = left;
+        child->d_position = static_cast<unsigned short>(size + 1 + i);
+    }
+    left->d_size = size + 1 + right->d_size;
+
+    removeEntry(parent, position);
+    deallocateNode(right);
+    rebalanceInternal(parent);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeLeaves(LeafNode *left,
+                                                           LeafNode *right)
+{
+    BSLS_ASSERT_SAFE(left);
+    BSLS_ASSERT_SAFE(right);
+    BSLS_ASSERT_SAFE(left->d_parent_p == right->d_parent_p);
+    BSLS_ASSERT_SAFE(left->d_next_p == right);
+    BSLS_ASSERT_SAFE(left->d_size + right->d_size <= k_LEAF_CAPACITY);
+
+    InternalNode *parent   = static_cast<InternalNode *>(left->d_parent_p);
+    const int     position = left->d_position;
+
+    std::memcpy(static_cast<void *>(left->d_values + left->d_size),
+                right->d_values,
+                right->d_size * sizeof(ValueSlot));
+    left->d_size += right->d_size;
+
+    left->d_next_p = right->d_next_p;
+    if (right->d_next_p) {
+        right->d_next_p->d_prev_p = left;
+    }
+    else {
+        d_last_p = left;
+    }
+
+    KeySlotUtil::destroy(&parent->d_keys[position], d_allocator);
+    removeEntry(parent, position);
+    deallocateNode(right);
+    rebalanceInternal(parent);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rebalanceInternal(
+                                                            InternalNode *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (node == d_root_p) {
+        if (0 == node->d_size) {
+            d_root_p = node->d_children[0];
+            d_root_p->d_parent_p = 0;
+            d_root_p->d_position = 0;
+            deallocateNode(node);
+        }
+        return;                                                       // RETURN
+    }
+
+    if (node->d_size >= k_INTERNAL_MIN) {
+        return;                                                       // RETURN
+    }
+
+    InternalNode *parent   = static_cast<InternalNode *>(node->d_parent_p);
+    const int     position = node->d_position;
+
+    if (0 < position) {
+        InternalNode *left = static_cast<InternalNode *>(
+                                             parent->d_children[position - 1]);
+        if (left->d_size + 1 + node->d_size <= k_INTERNAL_CAPACITY) {
+            mergeInternal(left, node);
+            return;                                                   // RETURN
+        }
+    }
+
+    if (position < parent->d_size) {
+        InternalNode *right = static_cast<InternalNode *>(
+                                             parent->d_children[position + 1]);
+        if (node->d_size + 1 + right->d_size <= k_INTERNAL_CAPACITY) {
+            mergeInternal(node, right);
+            return;                                                   // RETURN
+        }
+        borrowInternal(node, right);
+        return;                                                       // RETURN
+    }
+
+    borrowInternal(node, static_cast<InternalNode *>(
+                                            parent->d_children[position - 1]));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::rebalanceLeaf(LeafNode **leaf,
+                                                             int       *index)
+{
+    BSLS_ASSERT_SAFE(leaf);
+    BSLS_ASSERT_SAFE(*leaf);
+    BSLS_ASSERT_SAFE(index);
+
+    LeafNode     *node     = *leaf;
+    InternalNode *parent   = static_cast<InternalNode *>(node->d_parent_p);
+    const int     position = node->d_position;
+
+    BSLS_ASSERT_SAFE(parent);
+
+    if (0 < position) {
+        LeafNode *left = node->d_prev_p;
+        if (left->d_size + node->d_size <= k_LEAF_CAPACITY) {
+            *index += left->d_size;
+            *leaf   = left;
+            mergeLeaves(left, node);
+            return;                                                   // RETURN
+        }
+    }
+
+    if (position < parent->d_size) {
+        LeafNode *right = node->d_next_p;
+        if (node->d_size + right->d_size <= k_LEAF_CAPACITY) {
+            mergeLeaves(node, right);
+        }
+    }
+
+    BSLS_ASSERT_SAFE(0 < (*leaf)->d_size);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeEntry(InternalNode *node,
+                                                           int           index)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < node->d_size);
+
+    const int size = node->d_size;
+
+    std::memmove(static_cast<void *>(node->d_keys + index),
+                 node->d_keys + index + 1,
+                 (size - index - 1) * sizeof(KeySlot));
+    std::memmove(node->d_children + index + 1,
+                 node->d_children + index + 2,
+                 (size - index - 1) * sizeof(Node *));
+    node->d_size = size - 1;
+
+    for (int i = index + 1; i < size; ++i) {
+        node->d_children[i]->d_position = static_cast<unsigned short>(i);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swapStorage(Btree& other)
+{
+    bslalg::SwapUtil::swap(&d_root_p,  &other.d_root_p);
+    bslalg::SwapUtil::swap(&d_first_p, &other.d_first_p);
+    bslalg::SwapUtil::swap(&d_last_p,  &other.d_last_p);
+    bslalg::SwapUtil::swap(&d_size,    &other.d_size);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::LeafNode *
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::findLeaf(const KeyType& key) const
+{
+    BSLS_ASSERT_SAFE(d_root_p);
+
+    Node *node = d_root_p;
+    while (!node->d_isLeaf) {
+        const InternalNode *internal = static_cast<const InternalNode *>(node);
+
+        // Find the first separator greater than 'key'.  The search narrows
+        // the range without branching on the result of each comparison,
+        // which is unpredictable (see 'leafLowerBound').
+
+        int low = 0;
+        int num = internal->d_size;
+        while (num > 1) {
+            const int half = num / 2;
+            low += d_comparator(key, internal->key(low + half)) ? 0 : half;
+            num -= half;
+        }
+        low += !d_comparator(key, internal->key(low));
+        node = internal->d_children[low];
+        Btree_ImpUtil::prefetchNode(node);
+    }
+    return static_cast<LeafNode *>(node);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isEdge(const Node *node,
+                                                      bool        right) const
+{
+    BSLS_ASSERT_SAFE(node);
+
+    for (; node->d_parent_p; node = node->d_parent_p) {
+        const int edge = right ? node->d_parent_p->d_size : 0;
+        if (node->d_position != edge) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafLowerBound(
+                                                  const LeafNode *leaf,
+                                                  const KeyType&  key) const
+{
+    BSLS_ASSERT_SAFE(leaf);
+
+    // Narrow the range '[low .. low + num]' known to hold the result by
+    // conditionally advancing 'low' rather than by branching: the outcome of
+    // each comparison is unpredictable, so branching would mispredict on
+    // about half of the comparisons, which costs more than the comparisons
+    // themselves for the small keys a B+-tree is most suited to.
+
+    int low = 0;
+    int num = leaf->d_size;
+    while (num > 1) {
+        const int half = num / 2;
+        const KeyType& probe = KEY_CONFIG::extractKey(
+                                                 leaf->value(low + half - 1));
+        low += d_comparator(probe, key) ? half : 0;
+        num -= half;
+    }
+    return num && d_comparator(KEY_CONFIG::extractKey(leaf->value(low)), key)
+           ? low + 1
+           : low;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafUpperBound(
+                                                  const LeafNode *leaf,
+                                                  const KeyType&  key) const
+{
+    BSLS_ASSERT_SAFE(leaf);
+
+    // See 'leafLowerBound'.
+
+    int low = 0;
+    int num = leaf->d_size;
+    while (num > 1) {
+        const int half = num / 2;
+        const KeyType& probe = KEY_CONFIG::extractKey(
+                                                 leaf->value(low + half - 1));
+        low += d_comparator(key, probe) ? 0 : half;
+        num -= half;
+    }
+    return num && !d_comparator(key, KEY_CONFIG::extractKey(leaf->value(low)))
+           ? low + 1
+           : low;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+const typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::KeyType *
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerSeparator(
+                                                   const LeafNode *leaf) const
+{
+    BSLS_ASSERT_SAFE(leaf);
+
+    const Node *node = leaf;
+    while (node->d_parent_p && 0 == node->d_position) {
+        node = node->d_parent_p;
+    }
+    if (0 == node->d_parent_p) {
+        return 0;                                                     // RETURN
+    }
+    return &static_cast<const InternalNode *>(node->d_parent_p)->key(
+                                                        node->d_position - 1);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::makeIterator(LeafNode *leaf,
+                                                       int       index) const
+{
+    BSLS_ASSERT_SAFE(leaf);
+
+    if (index == leaf->d_size && leaf->d_next_p) {
+        return Iterator(leaf->d_next_p, 0);                           // RETURN
+    }
+    return Iterator(leaf, index);
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Btree(const ALLOCATOR& allocator)
+: d_allocator(allocator)
+, d_comparator()
+, d_root_p(0)
+, d_first_p(0)
+, d_last_p(0)
+, d_size(0)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Btree(const COMPARATOR& comparator,
+                                                const ALLOCATOR&  allocator)
+: d_allocator(allocator)
+, d_comparator(comparator)
+, d_root_p(0)
+, d_first_p(0)
+, d_last_p(0)
+, d_size(0)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Btree(const Btree& original)
+: d_allocator(AllocatorTraits::select_on_container_copy_construction(
+                                                        original.d_allocator))
+, d_comparator(original.d_comparator)
+, d_root_p(0)
+, d_first_p(0)
+, d_last_p(0)
+, d_size(0)
+{
+    // Build the copy in a temporary tree so that, if copying a value throws,
+    // the values copied so far are destroyed.
+
+    Btree temp(d_comparator, d_allocator);
+    for (ConstIterator it = original.begin(); it != original.end(); ++it) {
+        temp.insert(temp.end(), *it);
+    }
+    swapStorage(temp);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Btree(const Btree&     original,
+                                                const ALLOCATOR& allocator)
+: d_allocator(allocator)
+, d_comparator(original.d_comparator)
+, d_root_p(0)
+, d_first_p(0)
+, d_last_p(0)
+, d_size(0)
+{
+    Btree temp(d_comparator, d_allocator);
+    for (ConstIterator it = original.begin(); it != original.end(); ++it) {
+        temp.insert(temp.end(), *it);
+    }
+    swapStorage(temp);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::~Btree()
+{
+    if (d_root_p) {
+        destroyNode(d_root_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const Btree& rhs)
+{
+    if (this != &rhs) {
+        Btree other(rhs, d_allocator);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return Iterator(d_first_p, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_last_p ? Iterator(d_last_p, d_last_p->d_size) : Iterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return eraseAt(position.node(), position.index());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(const KeyType& key)
+{
+    if (0 == d_root_p) {
+        return 0;                                                     // RETURN
+    }
+
+    LeafNode  *leaf  = findLeaf(key);
+    const int  index = leafLowerBound(leaf, key);
+
+    if (index == leaf->d_size
+     || d_comparator(key, KEY_CONFIG::extractKey(leaf->value(index)))) {
+        return 0;                                                     // RETURN
+    }
+
+    eraseAt(leaf, index);
+    return 1;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator first,
+                                                ConstIterator last)
+{
+    // Erasing a value invalidates 'last', so count the values to erase first.
+
+    SizeType count = 0;
+    for (ConstIterator it = first; it != last; ++it) {
+        ++count;
+    }
+
+    Iterator result(first.node(), first.index());
+    for (; 0 < count; --count) {
+        result = eraseAt(result.node(), result.index());
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key)
+{
+    if (0 == d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    LeafNode  *leaf  = findLeaf(key);
+    const int  index = leafLowerBound(leaf, key);
+
+    if (index == leaf->d_size
+     || d_comparator(key, KEY_CONFIG::extractKey(leaf->value(index)))) {
+        return end();                                                 // RETURN
+    }
+    return Iterator(leaf, index);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(const ValueType& value)
+{
+    const KeyType& key   = KEY_CONFIG::extractKey(value);
+    LeafNode      *leaf  = 0;
+    int            index = 0;
+
+    if (d_root_p) {
+        leaf  = findLeaf(key);
+        index = leafLowerBound(leaf, key);
+
+        if (index < leaf->d_size
+         && !d_comparator(key, KEY_CONFIG::extractKey(leaf->value(index)))) {
+            return bsl::pair<Iterator, bool>(Iterator(leaf, index),
+                                             false);                  // RETURN
+        }
+    }
+
+    // Note that 'value' cannot refer to a value of this tree, so it is not
+    // invalidated by the insertion.
+
+    ValueSlot slot;
+    ValueSlotUtil::construct(&slot, d_allocator, value);
+
+    return bsl::pair<Iterator, bool>(insertNew(leaf, index, &slot), true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+bsl::pair<typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator, bool>
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(const SOURCE_TYPE& value)
+{
+    // Create the value (using the allocator of this tree) in order to obtain
+    // its key; it is moved into the tree if its key is not present.
+
+    ValueSlot slot;
+    ValueSlotUtil::construct(&slot, d_allocator, value);
+
+    const KeyType& key   = KEY_CONFIG::extractKey(ValueSlotUtil::value(slot));
+    LeafNode      *leaf  = 0;
+    int            index = 0;
+
+    if (d_root_p) {
+        leaf  = findLeaf(key);
+        index = leafLowerBound(leaf, key);
+
+        if (index < leaf->d_size
+         && !d_comparator(key, KEY_CONFIG::extractKey(leaf->value(index)))) {
+            ValueSlotUtil::destroy(&slot, d_allocator);
+            return bsl::pair<Iterator, bool>(Iterator(leaf, index),
+                                             false);                  // RETURN
+        }
+    }
+
+    return bsl::pair<Iterator, bool>(insertNew(leaf, index, &slot), true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insert(ConstIterator    hint,
+                                                 const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    // Determine whether 'value' belongs immediately before 'hint'.
+
+    LeafNode *leaf  = hint.node();
+    int       index = hint.index();
+    bool      useHint;
+
+    if (0 == leaf) {
+        useHint = true;  // the tree is empty
+    }
+    else if (hint != end()
+          && !d_comparator(key, KEY_CONFIG::extractKey(*hint))) {
+        useHint = false;
+    }
+    else if (hint == begin()) {
+        useHint = true;
+    }
+    else {
+        ConstIterator prev = hint;
+        --prev;
+        useHint = d_comparator(KEY_CONFIG::extractKey(*prev), key);
+
+        if (useHint && 0 == index) {
+            // 'value' belongs between the last value of one leaf and the
+            // first value of the next; it belongs in the next leaf unless it
+            // is less than the separator of the two.
+
+            const KeyType *separator = lowerSeparator(leaf);
+            BSLS_ASSERT_SAFE(separator);
+
+            if (d_comparator(key, *separator)) {
+                leaf  = prev.node();
+                index = leaf->d_size;
+            }
+        }
+    }
+
+    if (!useHint) {
+        return insert(value).first;                                   // RETURN
+    }
+
+    ValueSlot slot;
+    ValueSlotUtil::construct(&slot, d_allocator, value);
+
+    return insertNew(leaf, index, &slot);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(const KeyType& key)
+{
+    LeafNode *leaf  = 0;
+    int       index = 0;
+
+    if (d_root_p) {
+        leaf  = findLeaf(key);
+        index = leafLowerBound(leaf, key);
+
+        if (index < leaf->d_size
+         && !d_comparator(key, KEY_CONFIG::extractKey(leaf->value(index)))) {
+            return Iterator(leaf, index);                             // RETURN
+        }
+    }
+
+    ValueSlot slot;
+    ValueSlotUtil::construct(&slot,
+                             d_allocator,
+                             key,
+                             typename ValueType::second_type());
+
+    return insertNew(leaf, index, &slot);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key)
+{
+    if (0 == d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    LeafNode *leaf = findLeaf(key);
+    return makeIterator(leaf, leafLowerBound(leaf, key));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    if (d_root_p) {
+        destroyNode(d_root_p);
+        d_root_p  = 0;
+        d_first_p = 0;
+        d_last_p  = 0;
+        d_size    = 0;
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(Btree& other)
+{
+    BSLS_ASSERT(d_allocator == other.d_allocator);
+
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    swapStorage(other);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key)
+{
+    if (0 == d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    LeafNode *leaf = findLeaf(key);
+    return makeIterator(leaf, leafUpperBound(leaf, key));
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const ALLOCATOR& Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return ConstIterator(d_first_p, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_last_p ? ConstIterator(d_last_p, d_last_p->d_size)
+                    : ConstIterator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    return const_cast<Btree *>(this)->find(key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::height() const
+{
+    int result = 0;
+    for (const Node *node = d_root_p;
+         node;
+         node = node->d_isLeaf
+              ? 0
+              : static_cast<const InternalNode *>(node)->d_children[0]) {
+        ++result;
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key) const
+{
+    return const_cast<Btree *>(this)->lowerBound(key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return ~SizeType(0) / sizeof(StoredType);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key) const
+{
+    return const_cast<Btree *>(this)->upperBound(key);
+}
+
+                        // Aspects
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::internalCapacity()
+{
+    return k_INTERNAL_CAPACITY;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafCapacity()
+{
+    return k_LEAF_CAPACITY;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool bslstl::operator==(const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                        const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs)
+{
+    typedef typename Btree<KEY_CONFIG,
+                           COMPARATOR,
+                           ALLOCATOR>::ConstIterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    ConstIterator r = rhs.begin();
+    for (ConstIterator l = lhs.begin(); l != lhs.end(); ++l, ++r) {
+        if (!(*l == *r)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator!=(const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                        const Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& a,
+                  Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'Btree':
+//: o A 'Btree' is bitwise moveable if its comparator and allocator are
+//:   bitwise moveable (its nodes do not refer back to the tree).
+//: o A 'Btree' uses 'bslma' allocators if the (template parameter) type
+//:   'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace bslma {
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bslstl::Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<bslstl::Btree<KEY_CONFIG, COMPARATOR, ALLOCATOR> >
+: bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<COMPARATOR>::value
+                            && bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1327 @@
+// bslstl_btree.t.cpp                                                 -*-C++-*-
+#include <bslstl_btree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_removecvq.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_allocbitwisemoveabletesttype.h>
+#include <bsltf_alloctesttype.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a B+-tree, together with an iterator
+// over its values and the utilities used to store values in its nodes.  The
+// main concerns are that the values are visited in order, and can be found,
+// after any sequence of insertions and erasures (in particular, those that
+// split and merge nodes at every level of the tree), that nodes are filled
+// when values are inserted in ascending or descending order, that values are
+// correctly moved between nodes (whether or not they are bitwise moveable),
+// that insertion is exception neutral and erasure does not allocate, and that
+// no memory is leaked.  The state of a tree is verified against a simple model
+// (an array of flags indicating which keys are present).
+//-----------------------------------------------------------------------------
+// Btree_ImpUtil
+// [ 2] Capacity<HEADER_SIZE, ENTRY_SIZE>::VALUE
+//
+// Btree_SlotUtil
+// [ 2] void construct(Slot *slot, ALLOCATOR& allocator, const SOURCE&);
+// [ 2] void construct(Slot *, ALLOCATOR&, const SOURCE1&, const SOURCE2&);
+// [ 2] void destroy(Slot *slot, ALLOCATOR& allocator);
+// [ 2] TYPE& value(Slot& slot);
+//
+// BtreeIterator
+// [ 3] BtreeIterator();
+// [ 3] BtreeIterator(const NcIter& original);
+// [ 3] BtreeIterator& operator++();
+// [ 3] BtreeIterator& operator--();
+// [ 3] reference operator*() const;
+// [ 3] pointer operator->() const;
+// [ 3] bool operator==(const BtreeIterator&, const BtreeIterator&);
+// [ 3] bool operator!=(const BtreeIterator&, const BtreeIterator&);
+//
+// Btree
+// [ 3] Btree(const ALLOCATOR& allocator = ALLOCATOR());
+// [ 5] Btree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+// [ 5] Btree(const Btree& original);
+// [ 5] Btree(const Btree& original, const ALLOCATOR& allocator);
+// [ 3] ~Btree();
+// [ 5] Btree& operator=(const Btree& rhs);
+// [ 3] Iterator begin();
+// [ 3] Iterator end();
+// [ 4] Iterator erase(ConstIterator position);
+// [ 4] SizeType erase(const KeyType& key);
+// [ 4] Iterator erase(ConstIterator first, ConstIterator last);
+// [ 3] Iterator find(const KeyType& key);
+// [ 3] pair<Iterator, bool> insert(const ValueType& value);
+// [ 3] pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+// [ 3] Iterator insert(ConstIterator hint, const ValueType& value);
+// [ 3] Iterator insertIfMissing(const KeyType& key);
+// [ 3] Iterator lowerBound(const KeyType& key);
+// [ 4] void removeAll();
+// [ 5] void swap(Btree& other);
+// [ 3] Iterator upperBound(const KeyType& key);
+// [ 3] const ALLOCATOR& allocator() const;
+// [ 3] ConstIterator begin() const;
+// [ 5] const COMPARATOR& comparator() const;
+// [ 3] ConstIterator end() const;
+// [ 3] ConstIterator find(const KeyType& key) const;
+// [ 3] int height() const;
+// [ 3] ConstIterator lowerBound(const KeyType& key) const;
+// [ 3] SizeType maxSize() const;
+// [ 3] SizeType size() const;
+// [ 3] ConstIterator upperBound(const KeyType& key) const;
+// [ 2] static int internalCapacity();
+// [ 2] static int leafCapacity();
+//
+// [ 5] bool operator==(const Btree&, const Btree&);
+// [ 5] bool operator!=(const Btree&, const Btree&);
+// [ 5] void swap(Btree& a, Btree& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 3] CONCERN: Ascending and descending insertions fill the leaves.
+// [ 4] CONCERN: Erasure does not allocate memory.
+// [ 6] CONCERN: Insertion and copying are exception neutral.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::Btree<bslstl::UnorderedSetKeyConfiguration<const int>,
+                      std::less<int>,
+                      bsl::allocator<int> > IntTree;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct DataLess {
+    // This 'struct' provides a comparator ordering test types by the value of
+    // their 'data' attribute.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if 'lhs.data()' is less than 'rhs.data()', and 'false'
+        // otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+template <class KEY, class MAPPED>
+struct MapTree {
+    // This 'struct' provides a namespace for the type of a tree mapping keys
+    // of the (template parameter) type 'KEY', which is either 'int' or a test
+    // type having a 'data' attribute, to objects of the (template parameter)
+    // type 'MAPPED'.
+
+    typedef bsl::pair<const KEY, MAPPED>                 ValueType;
+    typedef bslstl::Btree<
+                        bslstl::UnorderedMapKeyConfiguration<ValueType>,
+                        DataLess,
+                        bsl::allocator<ValueType> >       Type;
+};
+
+template <class MAPPED>
+struct MapTree<int, MAPPED> {
+    typedef bsl::pair<const int, MAPPED>                 ValueType;
+    typedef bslstl::Btree<
+                        bslstl::UnorderedMapKeyConfiguration<ValueType>,
+                        std::less<int>,
+                        bsl::allocator<ValueType> >       Type;
+};
+
+int keyOf(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+template <class TYPE>
+int keyOf(const TYPE& value)
+    // Return the 'data' attribute of the specified 'value'.
+{
+    return value.data();
+}
+
+template <class KEY, class MAPPED>
+int keyOf(const bsl::pair<const KEY, MAPPED>& value)
+    // Return the key of the specified 'value'.
+{
+    return keyOf(value.first);
+}
+
+class Random {
+    // This class provides a deterministic pseudo-random number generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int limit)
+        // Return a pseudo-random number in the range '[0 .. limit)'.
+    {
+        d_state = d_state * 1103515245U + 12345U;
+        return static_cast<int>((d_state >> 8) % limit);
+    }
+};
+
+void shuffle(int *keys, int numKeys, unsigned int seed)
+    // Fill the specified 'keys' array with a pseudo-random permutation of
+    // '[0 .. numKeys)' determined by the specified 'seed'.
+{
+    Random random(seed);
+    for (int i = 0; i < numKeys; ++i) {
+        keys[i] = i;
+    }
+    for (int i = numKeys - 1; 0 < i; --i) {
+        const int j   = random(i + 1);
+        const int tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+}
+
+template <class TREE>
+bool verifyTree(const TREE& tree, const bool *present, int numKeys)
+    // Return 'true' if the specified 'tree' holds exactly the values whose
+    // keys 'k', in the range '[0 .. numKeys)', are those for which the
+    // specified 'present[k]' is 'true', visited in order by both forward and
+    // backward iteration, with no empty leaf, and each found by 'find',
+    // 'lowerBound', and 'upperBound'; and 'false' otherwise.
+{
+    typedef typename bslmf::RemoveCvq<typename TREE::KeyType>::Type Key;
+    typedef typename TREE::ConstIterator                            Iter;
+
+    int expectedSize = 0;
+    for (int k = 0; k < numKeys; ++k) {
+        expectedSize += present[k];
+    }
+    if (static_cast<int>(tree.size()) != expectedSize) {
+        return false;                                                 // RETURN
+    }
+    if ((0 == expectedSize) != (tree.begin() == tree.end())
+     || (0 == expectedSize) != (0 == tree.height())) {
+        return false;                                                 // RETURN
+    }
+
+    // Forward iteration.
+
+    int k = 0;
+    for (Iter it = tree.begin(); it != tree.end(); ++it, ++k) {
+        while (k < numKeys && !present[k]) {
+            ++k;
+        }
+        if (k == numKeys
+         || it.index() >= it.node()->d_size
+         || keyOf(*it) != k) {
+            return false;                                             // RETURN
+        }
+    }
+    while (k < numKeys && !present[k]) {
+        ++k;
+    }
+    if (k != numKeys) {
+        return false;                                                 // RETURN
+    }
+
+    // Backward iteration.
+
+    k = numKeys - 1;
+    for (Iter it = tree.end(); it != tree.begin(); --k) {
+        --it;
+        while (0 <= k && !present[k]) {
+            --k;
+        }
+        if (k < 0 || keyOf(*it) != k) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // Lookup of every key in the range, and of the keys just outside it.
+
+    Iter next = tree.end();  // first value having a key greater than 'k'
+    for (k = numKeys; -1 <= k; --k) {
+        const Key key(k);
+
+        Iter it = tree.find(key);
+        if ((0 <= k && k < numKeys && present[k]) != (it != tree.end())) {
+            return false;                                             // RETURN
+        }
+        if (tree.upperBound(key) != next) {
+            return false;                                             // RETURN
+        }
+        if (it != tree.end()) {
+            if (keyOf(*it) != k || tree.lowerBound(key) != it) {
+                return false;                                         // RETURN
+            }
+            next = it;
+        }
+        else if (tree.lowerBound(key) != next) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TREE>
+int numLeaves(const TREE& tree)
+    // Return the number of leaves of the specified 'tree'.
+{
+    int result = 0;
+    for (typename TREE::ConstIterator it = tree.begin();
+         it != tree.end();
+         ++it) {
+        if (0 == it.index()) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template <class KEY, class MAPPED>
+void testRandomInsertAndErase(int numKeys, unsigned int seed)
+    // Insert and erase values having keys in the range '[0 .. numKeys)' in a
+    // pseudo-random order determined by the specified 'seed' into a tree
+    // mapping the (template parameter) type 'KEY' to the (template parameter)
+    // type 'MAPPED', verifying the tree after each operation and that erasure
+    // does not allocate memory.
+{
+    typedef typename MapTree<KEY, MAPPED>::Type      Obj;
+    typedef typename MapTree<KEY, MAPPED>::ValueType Value;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    int  keys[2000];
+    bool present[2000] = { false };
+
+    BSLS_ASSERT(numKeys <= 2000);
+
+    shuffle(keys, numKeys, seed);
+
+    Obj mX(&oa);  const Obj& X = mX;
+
+    for (int i = 0; i < numKeys; ++i) {
+        const int k = keys[i];
+        const KEY    key(k);
+        const MAPPED mapped(k);
+        const Value  V(key, mapped);
+
+        bsl::pair<typename Obj::Iterator, bool> result = mX.insert(V);
+        ASSERTV(numKeys, i, result.second);
+        ASSERTV(numKeys, i, k == keyOf(*result.first));
+        present[k] = true;
+
+        if (numKeys <= 200 || 0 == i % 97) {
+            ASSERTV(numKeys, i, verifyTree(X, present, numKeys));
+        }
+    }
+    ASSERTV(numKeys, verifyTree(X, present, numKeys));
+
+    if (veryVerbose) { T_ P_(numKeys) P_(X.height()) P(numLeaves(X)) }
+
+    shuffle(keys, numKeys, seed + 1);
+
+    const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+    for (int i = 0; i < numKeys; ++i) {
+        const int k = keys[i];
+
+        if (0 == i % 3) {
+            // Erase by position, checking the returned iterator.
+
+            typename Obj::Iterator it = mX.find(KEY(k));
+            ASSERTV(numKeys, i, X.end() != it);
+
+            typename Obj::ConstIterator next = X.upperBound(KEY(k));
+            const bool atEnd = next == X.end();
+            const int  nextKey = atEnd ? -1 : keyOf(*next);
+
+            it = mX.erase(it);
+            ASSERTV(numKeys, i, atEnd == (X.end() == it));
+            if (!atEnd) {
+                ASSERTV(numKeys, i, nextKey == keyOf(*it));
+            }
+        }
+        else {
+            ASSERTV(numKeys, i, 1 == mX.erase(KEY(k)));
+            ASSERTV(numKeys, i, 0 == mX.erase(KEY(k)));
+        }
+        present[k] = false;
+
+        if (numKeys <= 200 || 0 == i % 97) {
+            ASSERTV(numKeys, i, verifyTree(X, present, numKeys));
+        }
+    }
+    ASSERTV(numKeys, verifyTree(X, present, numKeys));
+    ASSERTV(numKeys, 0 == X.height());
+
+    // Erasure neither allocates memory nor leaks it.  Note that 'find' and
+    // 'erase' may allocate temporary keys from the default allocator.
+
+    ASSERTV(numKeys, numAllocations == oa.numAllocations());
+    ASSERTV(numKeys, 0 == oa.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to implement a simple ordered set of 'int' values.  We can
+// use a 'Btree' configured to use the entire value as its key:
+//..
+    typedef bslstl::Btree<bslstl::UnorderedSetKeyConfiguration<const int>,
+                          std::less<int>,
+                          bsl::allocator<int> > IntTree;
+//..
+// Next, we create a tree, supplying a test allocator:
+//..
+    bslma::TestAllocator oa("object");
+    IntTree              tree(&oa);
+    ASSERT(0 == tree.size());
+    ASSERT(0 == oa.numBlocksInUse());
+//..
+// Notice that no memory is allocated until the first insertion.  Then, we
+// insert some values in descending order, noting that a value that is already
+// present is not inserted again:
+//..
+    for (int i = 999; i >= 0; --i) {
+        bsl::pair<IntTree::Iterator, bool> result = tree.insert(i / 2);
+        ASSERT((1 == i % 2) == result.second);
+        ASSERT(i / 2        == *result.first);
+    }
+    ASSERT(500 == tree.size());
+//..
+// Now, we observe that the values are visited in ascending order:
+//..
+    int expected = 0;
+    for (IntTree::Iterator it = tree.begin(); it != tree.end(); ++it) {
+        ASSERT(expected == *it);
+        ++expected;
+    }
+    ASSERT(500 == expected);
+//..
+// Finally, we look up and erase some values:
+//..
+    ASSERT(tree.end() != tree.find(7));
+    ASSERT(8          == *tree.upperBound(7));
+
+    ASSERT(1 == tree.erase(7));
+    ASSERT(0 == tree.erase(7));
+    ASSERT(tree.end() == tree.find(7));
+    ASSERT(8          == *tree.lowerBound(7));
+    ASSERT(499        == tree.size());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 If an exception is thrown while creating a value, creating a
+        //:   separator key, or allocating a node during an insertion, the tree
+        //:   is unchanged and no memory is leaked.
+        //:
+        //: 2 If an exception is thrown while copying a tree, no memory is
+        //:   leaked, and the target of an assignment is unchanged.
+        //:
+        //: 3 The above hold whether or not the keys and values are bitwise
+        //:   moveable (i.e., stored inline or indirectly).
+        //
+        // Plan:
+        //: 1 Using the exception-test macros, insert values in a pseudo-random
+        //:   order into trees whose keys and values allocate memory, verifying
+        //:   the tree at the start of each attempt.  (C-1, 3)
+        //:
+        //: 2 Using the exception-test macros, copy-construct and assign
+        //:   trees, verifying the target.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Insertion and copying are exception neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING EXCEPTION NEUTRALITY"
+                            "\n============================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { NUM_KEYS = 300 };
+
+        int keys[NUM_KEYS];
+        shuffle(keys, NUM_KEYS, 7);
+
+        if (verbose) printf("\tIndirect keys and values.\n");
+        {
+            typedef bsltf::AllocTestType                 Type;
+            typedef MapTree<Type, Type>::Type            Obj;
+            typedef MapTree<Type, Type>::ValueType       Value;
+
+            BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<Type>::value);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bool                 present[NUM_KEYS] = { false };
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int   k = keys[i];
+                const Value V(Type(k, &da), Type(k, &da));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    if (0 == i % 29) {
+                        ASSERTV(i, verifyTree(X, present, NUM_KEYS));
+                    }
+                    mX.insert(V);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                present[k] = true;
+            }
+            ASSERTV(verifyTree(X, present, NUM_KEYS));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                ASSERTV(X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                mY.insert(Value(Type(-1, &da), Type(-1, &da)));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(1 == Y.size());
+                    mY = X;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(X == Y);
+            }
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tInline keys and values.\n");
+        {
+            typedef bsltf::AllocBitwiseMoveableTestType  Type;
+            typedef MapTree<Type, Type>::Type            Obj;
+            typedef MapTree<Type, Type>::ValueType       Value;
+
+            BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Type>::value);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bool                 present[NUM_KEYS] = { false };
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int   k = keys[NUM_KEYS - 1 - i];
+                const Value V(Type(k, &da), Type(k, &da));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    if (0 == i % 29) {
+                        ASSERTV(i, verifyTree(X, present, NUM_KEYS));
+                    }
+                    mX.insert(X.lowerBound(V.first), V);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                present[k] = true;
+            }
+            ASSERTV(verifyTree(X, present, NUM_KEYS));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, &oa == X.find(Type(i, &da))->second.allocator());
+            }
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value and comparator as the original, and
+        //:   uses the supplied allocator (or, absent one, the allocator of the
+        //:   original).
+        //:
+        //: 2 Assignment gives the target the value of the source without
+        //:   changing its allocator, and self-assignment has no effect.
+        //:
+        //: 3 'swap' exchanges values and comparators without allocating.
+        //:
+        //: 4 Two trees are equal if and only if they hold the same values.
+        //
+        // Plan:
+        //: 1 For a range of sizes, create trees, copy, assign, and swap them,
+        //:   verifying the results and the allocators used.  (C-1..4)
+        //
+        // Testing:
+        //   Btree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        //   Btree(const Btree& original);
+        //   Btree(const Btree& original, const ALLOCATOR& allocator);
+        //   Btree& operator=(const Btree& rhs);
+        //   void swap(Btree& other);
+        //   const COMPARATOR& comparator() const;
+        //   bool operator==(const Btree&, const Btree&);
+        //   bool operator!=(const Btree&, const Btree&);
+        //   void swap(Btree& a, Btree& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                           "\n============================================\n");
+
+        typedef MapTree<int, bsltf::AllocTestType>::Type      Obj;
+        typedef MapTree<int, bsltf::AllocTestType>::ValueType Value;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int SIZES[] = { 0, 1, 2, 50, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            bool present[1000] = { false };
+            for (int k = 0; k < N; ++k) {
+                present[k] = true;
+            }
+
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+            for (int k = N - 1; 0 <= k; --k) {
+                mX.insert(Value(k, bsltf::AllocTestType(k)));
+            }
+            ASSERTV(N, verifyTree(X, present, N));
+            ASSERTV(N, &oa == X.allocator().mechanism());
+
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                ASSERTV(N, verifyTree(Y, present, N));
+                ASSERTV(N, X == Y);
+                ASSERTV(N, !(X != Y));
+                ASSERTV(N, &da == Y.allocator().mechanism());
+            }
+            {
+                Obj mY(X, &sa);  const Obj& Y = mY;
+                ASSERTV(N, verifyTree(Y, present, N));
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &sa == Y.allocator().mechanism());
+                if (0 < N) {
+                    ASSERTV(N, &sa == Y.begin()->second.allocator());
+
+                    // Copies are built by appending, so their leaves are full.
+
+                    const int CAP = Obj::leafCapacity();
+                    ASSERTV(N, (N + CAP - 1) / CAP == numLeaves(Y));
+                }
+            }
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int M = SIZES[tj];
+
+                Obj mY(&sa);  const Obj& Y = mY;
+                for (int k = 0; k < M; ++k) {
+                    mY.insert(Value(k + 1 == M ? 99999 : k,
+                                    bsltf::AllocTestType(k)));
+                }
+                ASSERTV(N, M, (N == M && 0 == N) == (X == Y));
+                ASSERTV(N, M, (N == M && 0 == N) != (X != Y));
+
+                {
+                    Obj mZ(Y, &sa);  const Obj& Z = mZ;
+                    const bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+
+                    mZ.swap(mY);
+                    ASSERTV(N, M, Y == Z);
+                    bslstl::swap(mY, mZ);
+                    ASSERTV(N, M, Y == Z);
+                    ASSERTV(N, M, numBlocks == sa.numBlocksTotal());
+                }
+
+                mY = X;
+                ASSERTV(N, M, verifyTree(Y, present, N));
+                ASSERTV(N, M, X == Y);
+                ASSERTV(N, M, &sa == Y.allocator().mechanism());
+
+                mY = Y;
+                ASSERTV(N, M, X == Y);
+
+                if (veryVeryVerbose) { T_ P_(N) P(M) }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ERASE
+        //
+        // Concerns:
+        //: 1 Erasing a value by key or by position removes exactly that value,
+        //:   and erasing by position returns an iterator to the next value.
+        //:
+        //: 2 Erasure merges nodes at every level of the tree, leaving no empty
+        //:   leaf, and reducing the height of the tree, until the tree is
+        //:   empty and holds no memory.
+        //:
+        //: 3 Erasing a range removes exactly the values in the range.
+        //:
+        //: 4 Erasure does not allocate memory.
+        //:
+        //: 5 'removeAll' destroys all values and deallocates all nodes.
+        //
+        // Plan:
+        //: 1 For a range of sizes and seeds, insert and then erase keys in
+        //:   pseudo-random orders, alternating between erasure by key and by
+        //:   position, verifying the tree against a model after each
+        //:   operation (or periodically, for large trees), and verifying that
+        //:   the object allocator is not used by erasure.  Do so for values
+        //:   stored inline and indirectly.  (C-1..2, 4)
+        //:
+        //: 2 Erase ranges of various lengths and positions from a tree,
+        //:   verifying the result against a model.  (C-3)
+        //:
+        //: 3 Call 'removeAll' and verify that no memory remains in use.  (C-5)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator position);
+        //   SizeType erase(const KeyType& key);
+        //   Iterator erase(ConstIterator first, ConstIterator last);
+        //   void removeAll();
+        //   CONCERN: Erasure does not allocate memory.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ERASE"
+                            "\n=============\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tErasing single values.\n");
+
+        const int SIZES[] = { 1, 2, 3, 10, 57, 100, 200, 1000, 2000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            for (unsigned int seed = 1; seed <= 3; ++seed) {
+                testRandomInsertAndErase<int, int>(N, seed);
+                testRandomInsertAndErase<int, bsltf::AllocTestType>(N, seed);
+                testRandomInsertAndErase<bsltf::AllocTestType, int>(N, seed);
+            }
+        }
+
+        if (verbose) printf("\tErasing ranges.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            enum { N = 500 };
+
+            const int RANGES[][2] = {
+                { 0,   0 }, { 0,   1 }, { 0,  N }, { 10,  20 }, { 1, N - 1 },
+                { 100, 400 }, { 250, N }, { N - 1, N }, { 0, 250 }
+            };
+            const int NUM_RANGES =
+                            static_cast<int>(sizeof RANGES / sizeof *RANGES);
+
+            for (int ti = 0; ti < NUM_RANGES; ++ti) {
+                const int FIRST = RANGES[ti][0];
+                const int LAST  = RANGES[ti][1];
+
+                IntTree mX(&oa);  const IntTree& X = mX;
+                bool    present[N];
+                for (int k = 0; k < N; ++k) {
+                    mX.insert(k);
+                    present[k] = k < FIRST || LAST <= k;
+                }
+
+                IntTree::Iterator it = mX.erase(X.lowerBound(FIRST),
+                                                X.lowerBound(LAST));
+                ASSERTV(FIRST, LAST, verifyTree(X, present, N));
+                ASSERTV(FIRST, LAST, X.lowerBound(LAST) == it);
+            }
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting 'removeAll'.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            MapTree<int, bsltf::AllocTestType>::Type mX(&oa);
+            for (int k = 0; k < 1000; ++k) {
+                mX.insert(MapTree<int, bsltf::AllocTestType>::ValueType(
+                                                  k, bsltf::AllocTestType(k)));
+            }
+            ASSERTV(0 < oa.numBlocksInUse());
+
+            mX.removeAll();
+            ASSERTV(0 == mX.size());
+            ASSERTV(mX.begin() == mX.end());
+            ASSERTV(0 == oa.numBlocksInUse());
+
+            mX.removeAll();
+            mX.insert(MapTree<int, bsltf::AllocTestType>::ValueType(
+                                                  1, bsltf::AllocTestType(1)));
+            ASSERTV(1 == mX.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING INSERT, LOOKUP, AND ITERATION
+        //
+        // Concerns:
+        //: 1 After any sequence of insertions, the values are visited in order
+        //:   by forward and backward iteration, and each is found by 'find',
+        //:   'lowerBound', and 'upperBound'.
+        //:
+        //: 2 Inserting a value whose key is present does not modify the tree,
+        //:   and returns an iterator to the existing value.
+        //:
+        //: 3 Inserting values in ascending (or descending) order fills the
+        //:   leaves, and the height of the tree grows logarithmically.
+        //:
+        //: 4 A hinted insertion inserts at the hint if the hint is correct,
+        //:   and at the correct position otherwise.
+        //:
+        //: 5 'insert' of a value of another type, and 'insertIfMissing', use
+        //:   the allocator of the tree.
+        //:
+        //: 6 No memory is allocated from the default allocator, and no memory
+        //:   is leaked.
+        //
+        // Plan:
+        //: 1 Insert keys in ascending, descending, and pseudo-random orders,
+        //:   with and without hints, verifying the tree against a model after
+        //:   each insertion.  (C-1..4, 6)
+        //:
+        //: 2 Insert values of another type, and use 'insertIfMissing',
+        //:   checking the allocator of the inserted values.  (C-5)
+        //
+        // Testing:
+        //   BtreeIterator();
+        //   BtreeIterator(const NcIter& original);
+        //   BtreeIterator& operator++();
+        //   BtreeIterator& operator--();
+        //   reference operator*() const;
+        //   pointer operator->() const;
+        //   bool operator==(const BtreeIterator&, const BtreeIterator&);
+        //   bool operator!=(const BtreeIterator&, const BtreeIterator&);
+        //   Btree(const ALLOCATOR& allocator = ALLOCATOR());
+        //   ~Btree();
+        //   Iterator begin();
+        //   Iterator end();
+        //   Iterator find(const KeyType& key);
+        //   pair<Iterator, bool> insert(const ValueType& value);
+        //   pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+        //   Iterator insert(ConstIterator hint, const ValueType& value);
+        //   Iterator insertIfMissing(const KeyType& key);
+        //   Iterator lowerBound(const KeyType& key);
+        //   Iterator upperBound(const KeyType& key);
+        //   const ALLOCATOR& allocator() const;
+        //   ConstIterator begin() const;
+        //   ConstIterator end() const;
+        //   ConstIterator find(const KeyType& key) const;
+        //   int height() const;
+        //   ConstIterator lowerBound(const KeyType& key) const;
+        //   SizeType maxSize() const;
+        //   SizeType size() const;
+        //   ConstIterator upperBound(const KeyType& key) const;
+        //   CONCERN: Ascending and descending insertions fill the leaves.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INSERT, LOOKUP, AND ITERATION"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { N = 2000 };
+
+        const int CAP = IntTree::leafCapacity();
+
+        if (verbose) printf("\tAscending and descending insertion.\n");
+        for (int descending = 0; descending < 2; ++descending) {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            bool    present[N] = { false };
+
+            ASSERTV(X.begin() == X.end());
+            ASSERTV(IntTree::Iterator() == mX.end());
+            ASSERTV(&oa == X.allocator().mechanism());
+            ASSERTV(N < X.maxSize());
+
+            for (int i = 0; i < N; ++i) {
+                const int k = descending ? N - 1 - i : i;
+
+                bsl::pair<IntTree::Iterator, bool> result = mX.insert(k);
+                ASSERTV(descending, i, result.second);
+                ASSERTV(descending, i, k == *result.first);
+                present[k] = true;
+
+                result = mX.insert(k);
+                ASSERTV(descending, i, !result.second);
+                ASSERTV(descending, i, k == *result.first);
+
+                if (i < 300 || 0 == i % 50) {
+                    ASSERTV(descending, i, verifyTree(X, present, N));
+                }
+
+                // All leaves are full, except (possibly) the last leaf for
+                // ascending insertion, or the first for descending.
+
+                ASSERTV(descending, i, (i + CAP) / CAP == numLeaves(X));
+            }
+            ASSERTV(descending, verifyTree(X, present, N));
+            ASSERTV(descending, 3 <= X.height() || N <= CAP * CAP);
+            ASSERTV(descending, X.height() <= 4);
+
+            if (veryVerbose) { T_ P_(descending) P(X.height()) }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tPseudo-random insertion.\n");
+        for (unsigned int seed = 1; seed <= 5; ++seed) {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            bool    present[N] = { false };
+            int     keys[N];
+
+            shuffle(keys, N, seed);
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(seed, i, mX.insert(keys[i]).second);
+                present[keys[i]] = true;
+                if (i < 200 || 0 == i % 100) {
+                    ASSERTV(seed, i, verifyTree(X, present, N));
+                }
+            }
+            ASSERTV(seed, verifyTree(X, present, N));
+
+            // Leaves are at least half full (except when a tree has a single
+            // leaf).
+
+            ASSERTV(seed, numLeaves(X) <= 2 * N / (CAP / 2));
+
+            // Iterators convert to 'const' iterators, and pre- and
+            // post-increment and decrement are consistent.
+
+            IntTree::Iterator      it  = mX.begin();
+            IntTree::ConstIterator cit = it;
+            ASSERTV(seed, cit == it);
+            ASSERTV(seed, it == cit++);
+            ASSERTV(seed, cit != it);
+            ASSERTV(seed, ++it == cit);
+            ASSERTV(seed, it-- == cit);
+            ASSERTV(seed, --cit == it);
+            ASSERTV(seed, 0 == *it);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tHinted insertion.\n");
+        for (unsigned int seed = 1; seed <= 5; ++seed) {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            bool    present[N] = { false };
+            int     keys[N];
+
+            shuffle(keys, N, seed);
+            for (int i = 0; i < N; ++i) {
+                const int k = keys[i];
+
+                // Use a correct hint for most keys, and the end, the first
+                // value, or a wrong value for the others.
+
+                IntTree::ConstIterator hint;
+                switch (i % 7) {
+                  case 0: hint = X.end();                         break;
+                  case 1: hint = X.begin();                       break;
+                  case 2: hint = X.lowerBound(k / 2);             break;
+                  default: hint = X.lowerBound(k);
+                }
+
+                IntTree::Iterator it = mX.insert(hint, k);
+                ASSERTV(seed, i, k == *it);
+                present[k] = true;
+
+                ASSERTV(seed, i, it == mX.insert(X.lowerBound(k + 1), k));
+                ASSERTV(seed, i, it == mX.insert(X.lowerBound(k),     k));
+
+                if (i < 200 || 0 == i % 100) {
+                    ASSERTV(seed, i, verifyTree(X, present, N));
+                }
+            }
+            ASSERTV(seed, verifyTree(X, present, N));
+        }
+        for (int descending = 0; descending < 2; ++descending) {
+            // Hinted insertion at the end (or start) fills leaves.
+
+            IntTree mX(&oa);  const IntTree& X = mX;
+            bool    present[N] = { false };
+
+            for (int i = 0; i < N; ++i) {
+                const int k = descending ? N - 1 - i : i;
+                mX.insert(descending ? X.begin() : X.end(), k);
+                present[k] = true;
+            }
+            ASSERTV(descending, verifyTree(X, present, N));
+            ASSERTV(descending, (N + CAP - 1) / CAP == numLeaves(X));
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+
+        if (verbose) printf("\tInserting other types.\n");
+        {
+            typedef MapTree<int, bsltf::AllocTestType>::Type Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 300; ++i) {
+                bsl::pair<Obj::Iterator, bool> result =
+                          mX.insert(bsl::pair<int, bsltf::AllocTestType>(
+                                                 i, bsltf::AllocTestType(i)));
+                ASSERTV(i, result.second);
+                ASSERTV(i, i == result.first->first);
+                ASSERTV(i, &oa == result.first->second.allocator());
+
+                result = mX.insert(bsl::pair<int, bsltf::AllocTestType>(
+                                                 i, bsltf::AllocTestType(-1)));
+                ASSERTV(i, !result.second);
+                ASSERTV(i, i == result.first->second.data());
+            }
+            for (int i = 0; i < 600; ++i) {
+                Obj::Iterator it = mX.insertIfMissing(i);
+                ASSERTV(i, i == it->first);
+                ASSERTV(i, (i < 300 ? i : 0) == it->second.data());
+                ASSERTV(i, &oa == it->second.allocator());
+            }
+            ASSERTV(600 == X.size());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING NODE CAPACITY AND SLOT UTILITIES
+        //
+        // Concerns:
+        //: 1 Nodes hold as many entries as fit in approximately 256 bytes, and
+        //:   at least 4.
+        //:
+        //: 2 Bitwise-moveable values are held inline in slots, and other
+        //:   values are allocated separately, using the supplied allocator.
+        //:
+        //: 3 The 'construct' methods forward their arguments and allocator,
+        //:   and 'destroy' releases all memory.
+        //
+        // Plan:
+        //: 1 Check the capacities for values of several sizes.  (C-1)
+        //:
+        //: 2 Construct and destroy values of bitwise-moveable and other types
+        //:   in slots, checking the size of the slots and the memory used.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   Capacity<HEADER_SIZE, ENTRY_SIZE>::VALUE
+        //   void construct(Slot *slot, ALLOCATOR& allocator, const SOURCE&);
+        //   void construct(Slot *, ALLOCATOR&, const SOURCE1&, const SOURCE2&)
+        //   void destroy(Slot *slot, ALLOCATOR& allocator);
+        //   TYPE& value(Slot& slot);
+        //   static int internalCapacity();
+        //   static int leafCapacity();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE CAPACITY AND SLOT UTILITIES"
+                            "\n========================================\n");
+
+        typedef bslstl::Btree_ImpUtil ImpUtil;
+
+        ASSERTV(56 == (ImpUtil::Capacity<32,   4>::VALUE));
+        ASSERTV(28 == (ImpUtil::Capacity<32,   8>::VALUE));
+        ASSERTV(19 == (ImpUtil::Capacity<24,  12>::VALUE));
+        ASSERTV( 4 == (ImpUtil::Capacity<32,  64>::VALUE));
+        ASSERTV( 4 == (ImpUtil::Capacity<32, 200>::VALUE));
+
+        ASSERTV(IntTree::leafCapacity(),
+                IntTree::leafCapacity() * sizeof(int) <= 256);
+        ASSERTV(IntTree::leafCapacity(),
+                IntTree::leafCapacity() * sizeof(int) > 200);
+        ASSERTV(IntTree::internalCapacity(),
+                IntTree::internalCapacity() * (sizeof(int) + sizeof(void *))
+                                                                       > 200);
+
+        if (veryVerbose) {
+            T_ P_(IntTree::leafCapacity()) P(IntTree::internalCapacity())
+        }
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::allocator<int> alloc(&oa);
+
+        if (verbose) printf("\tInline slots.\n");
+        {
+            typedef bsltf::AllocBitwiseMoveableTestType Type;
+            typedef bslstl::Btree_SlotUtil<Type>        Util;
+
+            BSLMF_ASSERT(sizeof(Util::Slot) == sizeof(Type));
+
+            Util::Slot slot;
+            Util::construct(&slot, alloc, 5);
+            ASSERTV(5   == Util::value(slot).data());
+            ASSERTV(&oa == Util::value(slot).allocator());
+            ASSERTV(1   == oa.numBlocksInUse());
+
+            Util::Slot moved;
+            memcpy(static_cast<void *>(&moved), &slot, sizeof slot);
+            ASSERTV(5   == Util::value(moved).data());
+
+            Util::destroy(&moved, alloc);
+            ASSERTV(0   == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tIndirect slots.\n");
+        {
+            typedef bsltf::AllocTestType                Type;
+            typedef bslstl::Btree_SlotUtil<Type>        Util;
+            typedef bsl::pair<const int, Type>          Pair;
+            typedef bslstl::Btree_SlotUtil<Pair>        PairUtil;
+
+            BSLMF_ASSERT(sizeof(Util::Slot) == sizeof(void *));
+            BSLMF_ASSERT(sizeof(PairUtil::Slot) == sizeof(void *));
+
+            Util::Slot slot;
+            Util::construct(&slot, alloc, Type(7));
+            ASSERTV(7   == Util::value(slot).data());
+            ASSERTV(&oa == Util::value(slot).allocator());
+            ASSERTV(2   == oa.numBlocksInUse());
+
+            Util::Slot moved;
+            memcpy(static_cast<void *>(&moved), &slot, sizeof slot);
+            ASSERTV(7   == Util::value(moved).data());
+
+            Util::destroy(&moved, alloc);
+            ASSERTV(0   == oa.numBlocksInUse());
+
+            PairUtil::Slot pairSlot;
+            PairUtil::construct(&pairSlot, alloc, 3, Type(4));
+            ASSERTV(3   == PairUtil::value(pairSlot).first);
+            ASSERTV(4   == PairUtil::value(pairSlot).second.data());
+            ASSERTV(&oa == PairUtil::value(pairSlot).second.allocator());
+
+            PairUtil::destroy(&pairSlot, alloc);
+            ASSERTV(0   == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, erase and iterate over a number of values.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            IntTree mX(&oa);  const IntTree& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                const int k = (i * 389) % 1000 * 7;
+                ASSERTV(i,  mX.insert(k).second);
+                ASSERTV(i, !mX.insert(k).second);
+            }
+            ASSERTV(1000 == X.size());
+            ASSERTV(1 < X.height());
+
+            long long sum   = 0;
+            int       count = 0;
+            int       last  = -1;
+            for (IntTree::ConstIterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(last, *it, last < *it);
+                last = *it;
+                sum += *it;
+                ++count;
+            }
+            ASSERTV(1000 == count);
+            ASSERTV(7LL * 999 * 1000 / 2 == sum);
+
+            for (int i = 0; i < 7000; ++i) {
+                ASSERTV(i, (0 == i % 7) == (X.end() != X.find(i)));
+            }
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i * 7));
+            }
+            ASSERTV(500 == X.size());
+
+            IntTree mY(X, &oa);  const IntTree& Y = mY;
+            ASSERTV(X == Y);
+            mY.insert(-1);
+            ASSERTV(X != Y);
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
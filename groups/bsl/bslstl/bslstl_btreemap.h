@@ -0,0 +1,1205 @@
+// bslstl_btreemap.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREEMAP
+#define INCLUDED_BSLSTL_BTREEMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map holding many values in each tree node.
+//
+//@CLASSES:
+//   bsl::btree_map : B+-tree-based ordered map container
+//
+//@SEE_ALSO: bslstl_btreeset, bslstl_btree, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::btree_map', implementing a container holding an ordered sequence of
+// unique keys, each mapped to an associated value.  The interface of
+// 'btree_map' is that of 'bsl::map', except that insertion and erasure
+// invalidate iterators (see {Comparison with 'bsl::map'}).
+//
+// An instantiation of 'btree_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of key-value pairs the 'btree_map' contains.  Memory is supplied by
+// the (template parameter) type 'ALLOCATOR', which defaults to
+// 'bsl::allocator', and so uses the 'bslma::Allocator' protocol exactly as
+// 'bsl::map' does.
+//
+///Comparison with 'bsl::map'
+///--------------------------
+// 'bsl::map' is a red-black tree that allocates a node for each element, so
+// that finding a key visits approximately 'log2(N)' nodes, each typically in
+// a different cache line.  'btree_map' is implemented by 'bslstl::Btree', a
+// B+-tree whose nodes occupy approximately 256 bytes and hold as many elements
+// (in a leaf) or keys (in an internal node) as fit, located within a node by
+// binary search (see 'bslstl_btree').  Consequently, 'btree_map':
+//: o allocates memory once per node, rather than once per element, and uses
+//:   no per-element pointers when 'value_type' is bitwise moveable,
+//:
+//: o visits far fewer nodes (and cache lines) to find a key, and
+//:
+//: o iterates over its elements in order by scanning contiguous arrays.
+//
+// In exchange, 'btree_map' provides weaker guarantees than 'bsl::map'
+// regarding the stability of its elements:
+//: o Any insertion or erasure may move other elements within or between
+//:   nodes, and so invalidates all iterators, pointers, and references to the
+//:   elements of the map, other than the iterator returned by the operation.
+//:
+//: o Each internal node holds copies of some of the keys, so 'KEY' must be
+//:   copy-constructible, and inserting an element may copy its key.
+//:
+//: o If 'value_type' is not bitwise moveable, each element is allocated
+//:   separately (as for 'bsl::map'), and nodes hold the addresses of the
+//:   elements; only the lookup and iteration benefits then remain.
+//
+// 'btree_map' is most beneficial for maps of small keys and values that are
+// looked up or scanned frequently.  When references to elements must remain
+// valid as the map changes, 'bsl::map' is the appropriate choice.
+//
+///Requirements on 'KEY', 'VALUE', and 'COMPARATOR'
+///------------------------------------------------
+// 'KEY' and 'VALUE' must be copy-constructible; 'operator[]' additionally
+// requires that 'VALUE' be default-constructible, and the comparison operators
+// require that both be equality and less-than comparable.  'COMPARATOR' must
+// be a copy-constructible function object (and default-constructible if its
+// default is used) defining a strict weak ordering of keys.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining an Order Book
+///- - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain the total quantity offered at each price level
+// of one side of an order book, and to find the best price and scan the
+// levels in price order.  We can use a 'btree_map' from price (in ticks) to
+// quantity:
+//..
+//  bslma::TestAllocator          oa("object");
+//  bsl::btree_map<int, int>      book(&oa);
+//
+//  book[1005] += 300;
+//  book[1001] += 100;
+//  book[1003] += 200;
+//  book[1001] += 50;
+//..
+// Then, we verify the number of price levels, and find the best (lowest)
+// price and the first price at or above 1002:
+//..
+//  assert(3    == book.size());
+//  assert(1001 == book.begin()->first);
+//  assert(150  == book.begin()->second);
+//  assert(1003 == book.lower_bound(1002)->first);
+//..
+// Next, we remove a price level whose quantity has been exhausted:
+//..
+//  assert(1 == book.erase(1003));
+//  assert(book.end() == book.find(1003));
+//..
+// Finally, we sum the quantities offered up to a limit price, noting that the
+// elements are visited in order of their keys:
+//..
+//  int total = 0;
+//  for (bsl::btree_map<int, int>::const_iterator it = book.begin();
+//       it != book.upper_bound(1004);
+//       ++it) {
+//      total += it->second;
+//  }
+//  assert(150 == total);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_btreemap.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                        // ===============
+                        // class btree_map
+                        // ===============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<const KEY, VALUE> > >
+class btree_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys that provide a
+    // mapping from keys (of template parameter type 'KEY') to their associated
+    // values (of template parameter type 'VALUE'), stored in the leaves of a
+    // B+-tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral* (agnostic except for the 'at' method)
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef bsl::pair<const KEY, VALUE>  ValueType;
+        // This 'typedef' is an alias for the type of key-value pair objects
+        // maintained by this map.
+
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<ValueType>
+                                                             TreeConfiguration;
+        // This 'typedef' is an alias for the policy used internally by this
+        // map to extract the 'KEY' value from the key-value pair objects
+        // maintained by this map.
+
+    typedef BloombergLP::bslstl::Btree<TreeConfiguration,
+                                       COMPARATOR,
+                                       ALLOCATOR> Tree;
+        // This 'typedef' is an alias for the template instantiation of the
+        // underlying 'bslstl::Btree' used to implement this container.
+
+    // FRIENDS
+    template <class KEY2, class VALUE2, class COMPARATOR2, class ALLOCATOR2>
+    friend bool operator==(
+                      const btree_map<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>&,
+                      const btree_map<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+                         btree_map,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable<Tree>::value);
+
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::Iterator                    iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' using the (template parameter) type 'COMPARATOR'.  Note
+        // that this class matches the definition of 'map::value_compare' in
+        // the C++11 standard [23.4.4.1].
+
+        // FRIENDS
+        friend class btree_map;
+
+      protected:
+        COMPARATOR comp;  // protected, as required by the standard
+
+        value_compare(COMPARATOR comparator) : comp(comparator) {}
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to
+            // the overload of 'operator()' (the comparison function) provided
+            // by a 'btree_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    Tree d_impl;  // underlying B+-tree used by this map
+
+  public:
+    // CREATORS
+    explicit btree_map(const COMPARATOR&     comparator = COMPARATOR(),
+                       const allocator_type& allocator  = allocator_type());
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify an 'allocator' used to supply memory.  If
+        // 'allocator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'allocator_type' is used.  If the
+        // 'allocator_type' is 'bsl::allocator' (the default), then 'allocator'
+        // shall be convertible to 'bslma::Allocator *', and if 'allocator' is
+        // not supplied, the currently installed default allocator is used.
+        // Note that no memory is allocated until an element is inserted.
+
+    explicit btree_map(const allocator_type& allocator);
+        // Create an empty map that uses the specified 'allocator' to supply
+        // memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order keys.  If the 'allocator_type'
+        // is 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_map(const btree_map& original);
+        // Create a map having the same value and comparator as the specified
+        // 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<allocator_type>::
+        // select_on_container_copy_construction(original.get_allocator())'
+        // to supply memory.  If the 'allocator_type' is 'bsl::allocator'
+        // (the default), the currently installed default allocator is used.
+
+    btree_map(const btree_map& original, const allocator_type& allocator);
+        // Create a map having the same value and comparator as the specified
+        // 'original', and using the specified 'allocator' to supply memory.
+        // If the 'allocator_type' is 'bsl::allocator' (the default), then
+        // 'allocator' shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    btree_map(INPUT_ITERATOR        first,
+              INPUT_ITERATOR        last,
+              const COMPARATOR&     comparator = COMPARATOR(),
+              const allocator_type& allocator  = allocator_type());
+        // Create a map, and insert into it a 'value_type' object converted
+        // from each element in the range starting at the specified 'first'
+        // iterator and ending immediately before the specified 'last'
+        // iterator, ignoring those having a key that appears earlier in the
+        // sequence.  Optionally specify a 'comparator' and an 'allocator'
+        // having the same meaning as for the default constructor.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  Note that if the sequence is ordered by key,
+        // this operation has linear complexity and fills the nodes of the
+        // tree.
+
+    ~btree_map();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    btree_map& operator=(const btree_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    mapped_type& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this map; if this map does
+        // not already contain a 'value_type' object with 'key', first insert
+        // a new 'value_type' object having 'key' and a default-constructed
+        // 'VALUE' object.  Note that an insertion invalidates all iterators,
+        // pointers, and references to the elements of this map.
+
+    mapped_type& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw a 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object (having the lowest key) in the ordered sequence
+        // of 'value_type' objects maintained by this map, or the 'end'
+        // iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    void clear();
+        // Remove all entries from this map, and release all of its nodes.
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this map.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // map.  Note that an erasure invalidates all other iterators,
+        // pointers, and references to the elements of this map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise (there is no
+        // 'value_type' object having 'key' in this map) return 0 with no
+        // other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return an iterator referring to the element
+        // that was at 'last' (or 'end()').  The behavior is undefined unless
+        // 'first' and 'last' either refer to elements in this map or are the
+        // 'end' iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having the specified 'key', if such an entry
+        // exists, and the past-the-end iterator ('end') otherwise.
+
+    template <class SOURCE_TYPE>
+    pair<iterator, bool> insert(const SOURCE_TYPE& value);
+        // Insert the specified 'value' into this map if the key of a
+        // 'value_type' object constructed from 'value' does not already exist
+        // in this map; otherwise, this method has no effect.  Return a 'pair'
+        // whose 'first' member is an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is the same as
+        // that of 'value', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if the value was already present.  Note
+        // that an insertion invalidates all iterators, pointers, and
+        // references to the elements of this map.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map.  Return an iterator referring to
+        // the (possibly newly inserted) 'value_type' object in this map whose
+        // key is the same as that of 'value'.  If 'value' is inserted
+        // immediately before the specified 'hint', this operation has
+        // amortized constant complexity (not counting the search for a key
+        // that is present); otherwise 'hint' is ignored.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this map.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create a 'value_type' object for each iterator in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator.  Insert into this map each such object whose key
+        // is not already contained.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  Note that elements are
+        // appended in amortized constant time while their keys exceed those
+        // in this map.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain such an object.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' object having 'key',
+        // then the two returned iterators will have the same value.  Note
+        // that since a map maintains unique keys, the range will contain at
+        // most one element.
+
+    void swap(btree_map& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee and guarantees O[1] complexity,
+        // as long as the (template parameter) type 'COMPARATOR' does not throw
+        // when swapped.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const mapped_type& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.  Note that
+        // this method is not exception agnostic.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects contained within this map
+        // having the specified 'key'.  Note that since a map maintains unique
+        // keys, the returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' object having 'key',
+        // then the two returned iterators will have the same value.  Note
+        // that since a map maintains unique keys, the range will contain at
+        // most one element.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having the specified 'key', if such
+        // an entry exists, and the past-the-end iterator ('end') otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    key_compare key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this map.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size, without running out of resources.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain such an object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their keys using the key-comparison functor of this map.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_map' objects have the same
+    // value if they have the same number of key-value pairs, and each
+    // key-value pair that is contained in 'lhs' has the same value as the
+    // key-value pair at the same position in 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'btree_map' objects do not have
+    // the same value if they do not have the same number of key-value pairs,
+    // or some key-value pair that is contained in 'lhs' does not have the same
+    // value as the key-value pair at the same position in 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of map 'lhs' is lexicographically less than that of map 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i' and '*j' differ, or if 'rhs' is longer than 'lhs'
+    // and every element of 'lhs' compares equal to the corresponding element
+    // of 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' object with
+    // those of the specified 'b' object.  This function provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity, as long as
+    // the (template parameter) type 'COMPARATOR' does not throw when swapped.
+    // The behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                        // ---------------
+                        // class btree_map
+                        // ---------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                          const COMPARATOR&     comparator,
+                                          const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                               const allocator_type& allocator)
+: d_impl(allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                     const btree_map& original)
+: d_impl(original.d_impl)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                               const btree_map&      original,
+                                               const allocator_type& allocator)
+: d_impl(original.d_impl, allocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          const COMPARATOR&     comparator,
+                                          const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~btree_map()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const btree_map& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    return d_impl.insertIfMissing(key)->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "btree_map<...>::at(key_type): invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                    const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+inline
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          bool>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const SOURCE_TYPE& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                     const value_type& value)
+{
+    return d_impl.insert(hint, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    // Hinting at the end makes the insertion of an ordered sequence (e.g.,
+    // from another map) append to the last leaf.
+
+    while (first != last) {
+        d_impl.insert(d_impl.end(), *first);
+        ++first;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    typedef bsl::pair<iterator, iterator> ResultType;
+
+    iterator first = d_impl.lowerBound(key);
+    if (first == d_impl.end() || d_impl.comparator()(key, first->first)) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(btree_map& other)
+{
+    BSLS_ASSERT_SAFE(this->get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_type&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "btree_map<...>::at(key_type): invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bsl::pair<
+         typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+         typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = d_impl.lowerBound(key);
+    if (first == d_impl.end() || d_impl.comparator()(key, first->first)) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    const_iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_impl.comparator());
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'btree_map':
+//: o A 'btree_map' defines STL iterators.
+//: o A 'btree_map' is bit-wise moveable if the comparator and the allocator
+//:   are bit-wise moveable.
+//: o A 'btree_map' uses 'bslma' allocators if the (template parameter) type
+//:   'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,917 @@
+// bslstl_btreeset.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREESET
+#define INCLUDED_BSLSTL_BTREESET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set holding many keys in each tree node.
+//
+//@CLASSES:
+//   bsl::btree_set : B+-tree-based ordered set container
+//
+//@SEE_ALSO: bslstl_btreemap, bslstl_btree, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::btree_set', implementing a container holding an ordered sequence of
+// unique keys.  The interface of 'btree_set' is that of 'bsl::set', except
+// that insertion and erasure invalidate iterators.
+//
+// An instantiation of 'btree_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'btree_set' contains.  Memory is supplied by the
+// (template parameter) type 'ALLOCATOR', which defaults to 'bsl::allocator',
+// and so uses the 'bslma::Allocator' protocol exactly as 'bsl::set' does.
+//
+// 'btree_set' is implemented by 'bslstl::Btree', a B+-tree whose nodes occupy
+// approximately 256 bytes and hold as many keys as fit.  See 'bslstl_btreemap'
+// for a comparison of the performance characteristics and guarantees of the
+// B+-tree containers with those of 'bsl::map' and 'bsl::set'.  In particular,
+// any insertion or erasure may move other keys within or between nodes,
+// invalidating all iterators, pointers, and references to the elements of the
+// set (other than the iterator returned by the operation), and 'KEY' must be
+// copy-constructible.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracking Active Identifiers
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we want to track the identifiers of the sessions that are currently
+// active, and to find the lowest unused identifier no less than a given value.
+// We can store the active identifiers in a 'btree_set':
+//..
+//  bslma::TestAllocator oa("object");
+//  bsl::btree_set<int>  active(&oa);
+//
+//  for (int id = 100; id < 110; ++id) {
+//      active.insert(id);
+//  }
+//  active.erase(104);
+//  active.erase(105);
+//
+//  assert(8 == active.size());
+//..
+// Notice that all of the identifiers are held in a single node of the tree:
+//..
+//  assert(1 == oa.numBlocksInUse());
+//..
+// Finally, we find the lowest unused identifier no less than 102 by scanning
+// the identifiers in order:
+//..
+//  int id = 102;
+//  for (bsl::btree_set<int>::const_iterator it = active.lower_bound(id);
+//       it != active.end() && *it == id;
+//       ++it) {
+//      ++id;
+//  }
+//  assert(104 == id);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_btreeset.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                        // ===============
+                        // class btree_set
+                        // ===============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class btree_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of template parameter type 'KEY'),
+    // stored in the leaves of a B+-tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<const KEY>
+                                                             TreeConfiguration;
+        // This 'typedef' is an alias for the policy used internally by this
+        // set to extract the 'KEY' value from the keys maintained by this set.
+
+    typedef BloombergLP::bslstl::Btree<TreeConfiguration,
+                                       COMPARATOR,
+                                       ALLOCATOR> Tree;
+        // This 'typedef' is an alias for the template instantiation of the
+        // underlying 'bslstl::Btree' used to implement this container.
+
+    // FRIENDS
+    template <class KEY2, class COMPARATOR2, class ALLOCATOR2>
+    friend bool operator==(const btree_set<KEY2, COMPARATOR2, ALLOCATOR2>&,
+                           const btree_set<KEY2, COMPARATOR2, ALLOCATOR2>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+                         btree_set,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable<Tree>::value);
+
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::ConstIterator               iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_impl;  // underlying B+-tree used by this set
+
+  public:
+    // CREATORS
+    explicit btree_set(const COMPARATOR&     comparator = COMPARATOR(),
+                       const allocator_type& allocator  = allocator_type());
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify an 'allocator' used to supply memory.  If
+        // 'allocator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'allocator_type' is used.  If the
+        // 'allocator_type' is 'bsl::allocator' (the default), then 'allocator'
+        // shall be convertible to 'bslma::Allocator *', and if 'allocator' is
+        // not supplied, the currently installed default allocator is used.
+        // Note that no memory is allocated until a key is inserted.
+
+    explicit btree_set(const allocator_type& allocator);
+        // Create an empty set that uses the specified 'allocator' to supply
+        // memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order keys.  If the 'allocator_type'
+        // is 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_set(const btree_set& original);
+        // Create a set having the same value and comparator as the specified
+        // 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<allocator_type>::
+        // select_on_container_copy_construction(original.get_allocator())'
+        // to supply memory.  If the 'allocator_type' is 'bsl::allocator'
+        // (the default), the currently installed default allocator is used.
+
+    btree_set(const btree_set& original, const allocator_type& allocator);
+        // Create a set having the same value and comparator as the specified
+        // 'original', and using the specified 'allocator' to supply memory.
+        // If the 'allocator_type' is 'bsl::allocator' (the default), then
+        // 'allocator' shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    btree_set(INPUT_ITERATOR        first,
+              INPUT_ITERATOR        last,
+              const COMPARATOR&     comparator = COMPARATOR(),
+              const allocator_type& allocator  = allocator_type());
+        // Create a set, and insert into it a 'value_type' object converted
+        // from each element in the range starting at the specified 'first'
+        // iterator and ending immediately before the specified 'last'
+        // iterator, ignoring those equivalent to a key that appears earlier in
+        // the sequence.  Optionally specify a 'comparator' and an 'allocator'
+        // having the same meaning as for the default constructor.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  Note that if the sequence is ordered, this
+        // operation has linear complexity and fills the nodes of the tree.
+
+    ~btree_set();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    btree_set& operator=(const btree_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    void clear();
+        // Remove all keys from this set, and release all of its nodes.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and return
+        // an iterator referring to the key immediately following the removed
+        // key, or to the past-the-end position if the removed key was the last
+        // key in this set.  The behavior is undefined unless 'position' refers
+        // to a key in this set.  Note that an erasure invalidates all other
+        // iterators, pointers, and references to the elements of this set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the specified 'key', if it exists, and return
+        // 1; otherwise (there is no key equivalent to 'key' in this set)
+        // return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the key that was at 'last' (or
+        // 'end()').  The behavior is undefined unless 'first' and 'last'
+        // either refer to keys in this set or are the 'end' iterator, and the
+        // 'first' position is at or before the 'last' position in the ordered
+        // sequence provided by this container.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, this method
+        // has no effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) key in this set that is
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // value was inserted, and 'false' if the value was already present.
+        // Note that an insertion invalidates all iterators, pointers, and
+        // references to the elements of this set.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set.  Return an iterator
+        // referring to the (possibly newly inserted) key in this set that is
+        // equivalent to 'value'.  If 'value' is inserted immediately before
+        // the specified 'hint', this operation has amortized constant
+        // complexity (not counting the search for a key that is present);
+        // otherwise 'hint' is ignored.  The behavior is undefined unless
+        // 'hint' is a valid iterator into this set.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create a 'value_type' object for each iterator in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator.  Insert into this set each such object that is not
+        // already contained.  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.  Note that keys are appended in
+        // amortized constant time while they exceed those in this set.
+
+    void swap(btree_set& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee and guarantees O[1] complexity,
+        // as long as the (template parameter) type 'COMPARATOR' does not throw
+        // when swapped.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set, or the 'end' iterator if this
+        // set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last (i.e., ordered greatest) key in this set, or 'rend' if this set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys in this set equivalent to the specified
+        // 'key'.  Note that since a set maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this set contains no key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // set maintains unique keys, the range will contain at most one
+        // element.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end iterator ('end') otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    key_compare key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this set.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // set does not contain such a key.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size, without running out of resources.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater than the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain such a key.
+
+    value_compare value_comp() const;
+        // Return (a copy of) the key-comparison functor used by this set.
+        // Note that the keys of a set are its values.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_set' objects have the same
+    // value if they have the same number of keys, and each key that is
+    // contained in 'lhs' has the same value as the key at the same position
+    // in 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'btree_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // that is contained in 'lhs' does not have the same value as the key at
+    // the same position in 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of set 'lhs' is lexicographically less than that of set 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i' and '*j' differ, or if 'rhs' is longer than 'lhs'
+    // and every key of 'lhs' compares equal to the corresponding key of
+    // 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          btree_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' object with
+    // those of the specified 'b' object.  This function provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity, as long as
+    // the (template parameter) type 'COMPARATOR' does not throw when swapped.
+    // The behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                        // ---------------
+                        // class btree_set
+                        // ---------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                          const COMPARATOR&     comparator,
+                                          const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                               const allocator_type& allocator)
+: d_impl(allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const btree_set& original)
+: d_impl(original.d_impl)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                               const btree_set&      original,
+                                               const allocator_type& allocator)
+: d_impl(original.d_impl, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          const COMPARATOR&     comparator,
+                                          const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::~btree_set()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>&
+btree_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const btree_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                             const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bsl::pair<typename Tree::Iterator, bool> result = d_impl.insert(value);
+    return ResultType(result.first, result.second);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                              const value_type& value)
+{
+    return d_impl.insert(hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                   INPUT_ITERATOR last)
+{
+    // Hinting at the end makes the insertion of an ordered sequence (e.g.,
+    // from another set) append to the last leaf.
+
+    while (first != last) {
+        d_impl.insert(d_impl.end(), *first);
+        ++first;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::swap(btree_set& other)
+{
+    BSLS_ASSERT_SAFE(this->get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = d_impl.lowerBound(key);
+    if (first == d_impl.end() || d_impl.comparator()(key, *first)) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    const_iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR btree_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR btree_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR btree_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_impl.comparator();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'btree_set':
+//: o A 'btree_set' defines STL iterators.
+//: o A 'btree_set' is bit-wise moveable if the comparator and the allocator
+//:   are bit-wise moveable.
+//: o A 'btree_set' uses 'bslma' allocators if the (template parameter) type
+//:   'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,607 @@
+// bslstl_btreeset.t.cpp                                              -*-C++-*-
+#include <bslstl_btreeset.h>
+
+#include <bslstl_set.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over 'bslstl::Btree', which
+// is tested thoroughly in its own component.  Accordingly, this test driver
+// concentrates on the forwarding of each method to the underlying tree, and
+// on the type traits.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] btree_set(const COMPARATOR&, const allocator_type&);
+// [ 2] btree_set(const allocator_type& allocator);
+// [ 3] btree_set(const btree_set& original);
+// [ 3] btree_set(const btree_set&, const allocator_type&);
+// [ 2] btree_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 2] ~btree_set();
+//
+// MANIPULATORS
+// [ 3] btree_set& operator=(const btree_set& rhs);
+// [ 2] void clear();
+// [ 2] iterator erase(const_iterator position);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void swap(btree_set& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] const_iterator lower_bound(const key_type& key) const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 2] const_iterator upper_bound(const key_type& key) const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const btree_set&, const btree_set&);
+// [ 3] bool operator!=(const btree_set&, const btree_set&);
+// [ 3] bool operator<(const btree_set&, const btree_set&);
+// [ 3] bool operator>(const btree_set&, const btree_set&);
+// [ 3] bool operator<=(const btree_set&, const btree_set&);
+// [ 3] bool operator>=(const btree_set&, const btree_set&);
+// [ 3] void swap(btree_set& a, btree_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::btree_set<int> Obj;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracking Active Identifiers
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we want to track the identifiers of the sessions that are currently
+// active, and to find the lowest unused identifier no less than a given value.
+// We can store the active identifiers in a 'btree_set':
+//..
+    bslma::TestAllocator oa("object");
+    bsl::btree_set<int>  active(&oa);
+
+    for (int id = 100; id < 110; ++id) {
+        active.insert(id);
+    }
+    active.erase(104);
+    active.erase(105);
+
+    ASSERT(8 == active.size());
+//..
+// Notice that all of the identifiers are held in a single node of the tree:
+//..
+    ASSERT(1 == oa.numBlocksInUse());
+//..
+// Finally, we find the lowest unused identifier no less than 102 by scanning
+// the identifiers in order:
+//..
+    int id = 102;
+    for (bsl::btree_set<int>::const_iterator it = active.lower_bound(id);
+         it != active.end() && *it == id;
+         ++it) {
+        ++id;
+    }
+    ASSERT(104 == id);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values, and do not change
+        //:   allocators.
+        //:
+        //: 3 Sets compare equal if and only if they have the same keys, and
+        //:   the relational operators order sets lexicographically.
+        //
+        // Plan:
+        //: 1 Create sets with various values, copy, assign, swap and compare
+        //:   them.  (C-1..3)
+        //
+        // Testing:
+        //   btree_set(const btree_set& original);
+        //   btree_set(const btree_set&, const allocator_type&);
+        //   btree_set& operator=(const btree_set& rhs);
+        //   void swap(btree_set& other);
+        //   bool operator==(const btree_set&, const btree_set&);
+        //   bool operator!=(const btree_set&, const btree_set&);
+        //   bool operator<(const btree_set&, const btree_set&);
+        //   bool operator>(const btree_set&, const btree_set&);
+        //   bool operator<=(const btree_set&, const btree_set&);
+        //   bool operator>=(const btree_set&, const btree_set&);
+        //   void swap(btree_set& a, btree_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nTESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                        "\n==============================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 300; ++i) {
+                mX.insert(i * 3);
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+            ASSERTV(0 < da.numBlocksInUse());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            Obj mW(&sa);  const Obj& W = mW;
+            for (int i = 299; 0 <= i; --i) {
+                mW.insert(i * 3);
+            }
+            ASSERTV(X == W);
+            ASSERTV(!(X != W));
+            ASSERTV(!(X < W) && !(X > W) && X <= W && X >= W);
+
+            mW.erase(3);
+            ASSERTV(X != W);
+            ASSERTV(X < W);      // '6' follows '0' in 'W', '3' in 'X'
+            ASSERTV(W > X);
+            ASSERTV(X <= W);
+            ASSERTV(W >= X);
+
+            mW.insert(4);
+            ASSERTV(X < W);
+            mW.erase(4);
+            mW.insert(2);
+            ASSERTV(W < X);
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW.insert(1000);
+            ASSERTV(X < W);
+            ASSERTV(!(W < X));
+
+            mZ.swap(mW);
+            ASSERTV(301 == Z.size());
+            ASSERTV(300 == W.size());
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            bsl::swap(mZ, mW);
+            ASSERTV(300 == Z.size());
+            ASSERTV(301 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified comparator and allocator,
+        //:   and allocates only if a non-empty range is supplied.
+        //:
+        //: 2 Each 'insert' overload inserts an element only if it is absent,
+        //:   and returns the documented value.
+        //:
+        //: 3 The lookup methods find exactly the inserted elements, and the
+        //:   bounds are consistent with the order of the comparator.
+        //:
+        //: 4 Each 'erase' overload removes the specified elements and returns
+        //:   the documented value, and 'clear' releases all memory.
+        //:
+        //: 5 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct sets with each constructor, insert, look up, and erase
+        //:   elements, and verify the results and the memory used.  (C-1..4)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-5)
+        //
+        // Testing:
+        //   btree_set(const COMPARATOR&, const allocator_type&);
+        //   btree_set(const allocator_type& allocator);
+        //   btree_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   ~btree_set();
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRIMARY MANIPULATORS AND ACCESSORS"
+                            "\n==========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Obj::value_type, int>::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::iterator,
+                                   Obj::const_iterator>::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::value_compare,
+                                   std::less<int> >::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(0 < A.max_size());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(A.cbegin() == A.cend());
+            ASSERTV(A.rbegin() == A.rend());
+            ASSERTV(A.crbegin() == A.crend());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            static const int DATA[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mC(DATA, DATA + NUM_DATA, std::less<int>(), &oa);
+            const Obj& C = mC;
+            ASSERTV(7 == C.size());
+            ASSERTV(1 == *C.begin());
+            ASSERTV(9 == *C.rbegin());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            typedef bsl::btree_set<int, std::greater<int> > DescendingSet;
+
+            DescendingSet mD(DATA, DATA + NUM_DATA, std::greater<int>(), &oa);
+            const DescendingSet& D = mD;
+            ASSERTV(7 == D.size());
+            ASSERTV(9 == *D.begin());
+            ASSERTV(1 == *D.crbegin());
+            ASSERTV(D.key_comp()(2, 1));
+            ASSERTV(D.value_comp()(2, 1));
+            ASSERTV(4 == *D.lower_bound(4));
+            ASSERTV(3 == *D.upper_bound(4));
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion, lookup, and erasure.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            // Insert the even keys in '[0 .. 1000)' in a scattered order.
+
+            for (int i = 0; i < 500; ++i) {
+                const int KEY = (i * 37 % 500) * 2;
+
+                bsl::pair<Obj::iterator, bool> r = mX.insert(KEY);
+                ASSERTV(i, r.second);
+                ASSERTV(i, KEY == *r.first);
+
+                r = mX.insert(KEY);
+                ASSERTV(i, !r.second);
+                ASSERTV(i, KEY == *r.first);
+
+                Obj::iterator it = mX.insert(X.end(), KEY);
+                ASSERTV(i, KEY == *it);
+            }
+            ASSERTV(500 == X.size());
+            ASSERTV(X.key_comp()(1, 2));
+            ASSERTV(X.value_comp()(1, 2));
+
+            for (int i = -10; i < 1010; ++i) {
+                const bool PRESENT = 0 <= i && i < 1000 && 0 == i % 2;
+
+                ASSERTV(i, PRESENT == (1 == X.count(i)));
+                ASSERTV(i, PRESENT == (X.end() != X.find(i)));
+
+                const int LOWER = i < 0 ? 0 : i + i % 2;
+                const int UPPER = i < 0 ? 0 : i + 2 - i % 2;
+
+                Obj::const_iterator lower = X.lower_bound(i);
+                Obj::const_iterator upper = X.upper_bound(i);
+                ASSERTV(i, LOWER < 1000 ? LOWER == *lower : X.end() == lower);
+                ASSERTV(i, UPPER < 1000 ? UPPER == *upper : X.end() == upper);
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> r =
+                                                             X.equal_range(i);
+                ASSERTV(i, lower == r.first);
+                ASSERTV(i, upper == r.second);
+            }
+
+            int count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(count, count * 2 == *it);
+                ++count;
+            }
+            ASSERTV(500 == count);
+            for (Obj::const_reverse_iterator it = X.rbegin();
+                 it != X.rend();
+                 ++it) {
+                --count;
+                ASSERTV(count, count * 2 == *it);
+            }
+            ASSERTV(0 == count);
+
+            // Insert a range, some of which are already present.
+
+            int values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = 990 + i;
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(515 == X.size());
+            ASSERTV(1009 == *X.rbegin());
+
+            // Erase with each overload.
+
+            ASSERTV(1 == mX.erase(0));
+            ASSERTV(0 == mX.erase(0));
+            ASSERTV(2 == *X.begin());
+
+            Obj::iterator it = mX.erase(X.find(2));
+            ASSERTV(4 == *it);
+
+            it = mX.erase(X.find(100), X.find(300));
+            ASSERTV(300 == *it);
+            ASSERTV(413 == X.size());
+            ASSERTV(0 == X.count(200));
+
+            ASSERTV(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERTV(X.empty());
+            ASSERTV(0 == oa.numBlocksInUse());
+
+            mX.insert(values, values + 20);
+            ASSERTV(20 == X.size());
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase elements, and compare the results with
+        //:   those of a 'bsl::set'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj           mX(&oa);
+            bsl::set<int> mY(&oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 2000);
+
+                switch (seed % 3) {
+                  case 0: {
+                    ASSERTV(i, mY.insert(KEY).second
+                                                    == mX.insert(KEY).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+
+            Obj::const_iterator it = mX.begin();
+            for (bsl::set<int>::const_iterator jt = mY.begin();
+                 jt != mY.end();
+                 ++jt, ++it) {
+                ASSERTV(*jt, *jt == *it);
+            }
+            ASSERTV(mX.end() == it);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
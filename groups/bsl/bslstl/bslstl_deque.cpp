@@ -71,6 +71,12 @@ BSLS_IDENT("$Id$ $CSID$")
 //     and/or end.  The closed range,
 //     '[d_start.d_blockPtr_p, d_finish.d_blockPtr_p]', is the range of
 //     valid pointers within the 'd_blocks' array.
+//   - 'd_spareBlocks' is null or points to the first of a null-terminated
+//     list of at most 'NUM_SPARE_BLOCKS' allocated blocks that hold no
+//     elements, each of which stores the address of the next in its first
+//     bytes.  These blocks are not in the 'd_blocks' array.
+//   - 'd_numSpareBlocks' is the number of blocks in the 'd_spareBlocks'
+//     list.
 //
 // For deques constructed with the 'RAW_INIT' argument ("raw" deques), the
 // above invariants do not apply.  The following invariants do apply:
@@ -78,6 +84,8 @@ BSLS_IDENT("$Id$ $CSID$")
 //     singular 'IteratorImp' value is one where both members are nil.)
 //   - A raw deque has in constructed with 'd_blocks == 0' and
 //     'd_blocksLength == 0'.
+//   - A raw deque has no spare blocks ('d_spareBlocks == 0' and
+//     'd_numSpareBlocks == 0').
 //   - 'd_blocks' and 'd_blocksLength' may be set to valid values, but no
 //     blocks are allocated.
 //   - Once one or more blocks are allocated and 'd_start' and 'd_finish'
@@ -115,6 +123,9 @@ struct Deque_Imp {
     std::size_t    d_blocksLength;  // length of d_blocks array
     IteratorImp    d_start;         // iterator to first element
     IteratorImp    d_finish;        // iterator to one past last element
+    void          *d_spareBlocks;   // list of retained empty blocks
+    int            d_numSpareBlocks;
+                                    // number of blocks in 'd_spareBlocks'
 };
 
 // MANIPULATORS
@@ -123,15 +134,19 @@ void Deque_Util::move(void *dst, void *src)
     BSLS_ASSERT(dst);
     BSLS_ASSERT(src);
 
-    Deque_Imp& dstDeque     = *static_cast<Deque_Imp *>(dst);
-    Deque_Imp& srcDeque     = *static_cast<Deque_Imp *>(src);
+    Deque_Imp& dstDeque       = *static_cast<Deque_Imp *>(dst);
+    Deque_Imp& srcDeque       = *static_cast<Deque_Imp *>(src);
 
-    dstDeque.d_blocks       = srcDeque.d_blocks;
-    dstDeque.d_blocksLength = srcDeque.d_blocksLength;
-    dstDeque.d_start        = srcDeque.d_start;
-    dstDeque.d_finish       = srcDeque.d_finish;
+    dstDeque.d_blocks         = srcDeque.d_blocks;
+    dstDeque.d_blocksLength   = srcDeque.d_blocksLength;
+    dstDeque.d_start          = srcDeque.d_start;
+    dstDeque.d_finish         = srcDeque.d_finish;
+    dstDeque.d_spareBlocks    = srcDeque.d_spareBlocks;
+    dstDeque.d_numSpareBlocks = srcDeque.d_numSpareBlocks;
 
-    srcDeque.d_blocks       = 0;  // put back in a raw state
+    srcDeque.d_blocks         = 0;  // put back in a raw state
+    srcDeque.d_spareBlocks    = 0;
+    srcDeque.d_numSpareBlocks = 0;
 }
 
 void Deque_Util::swap(void *a, void *b)
@@ -139,24 +154,30 @@ void Deque_Util::swap(void *a, void *b)
     BSLS_ASSERT(a);
     BSLS_ASSERT(b);
 
-    Deque_Imp& aDeque     = *static_cast<Deque_Imp *>(a);
-    Deque_Imp& bDeque     = *static_cast<Deque_Imp *>(b);
+    Deque_Imp& aDeque         = *static_cast<Deque_Imp *>(a);
+    Deque_Imp& bDeque         = *static_cast<Deque_Imp *>(b);
 
     Deque_Imp temp;
     temp.d_blocks         = bDeque.d_blocks;
     temp.d_blocksLength   = bDeque.d_blocksLength;
     temp.d_start          = bDeque.d_start;
     temp.d_finish         = bDeque.d_finish;
-
-    bDeque.d_blocks       = aDeque.d_blocks;
-    bDeque.d_blocksLength = aDeque.d_blocksLength;
-    bDeque.d_start        = aDeque.d_start;
-    bDeque.d_finish       = aDeque.d_finish;
-
-    aDeque.d_blocks       = temp.d_blocks;
-    aDeque.d_blocksLength = temp.d_blocksLength;
-    aDeque.d_start        = temp.d_start;
-    aDeque.d_finish       = temp.d_finish;
+    temp.d_spareBlocks    = bDeque.d_spareBlocks;
+    temp.d_numSpareBlocks = bDeque.d_numSpareBlocks;
+
+    bDeque.d_blocks         = aDeque.d_blocks;
+    bDeque.d_blocksLength   = aDeque.d_blocksLength;
+    bDeque.d_start          = aDeque.d_start;
+    bDeque.d_finish         = aDeque.d_finish;
+    bDeque.d_spareBlocks    = aDeque.d_spareBlocks;
+    bDeque.d_numSpareBlocks = aDeque.d_numSpareBlocks;
+
+    aDeque.d_blocks         = temp.d_blocks;
+    aDeque.d_blocksLength   = temp.d_blocksLength;
+    aDeque.d_start          = temp.d_start;
+    aDeque.d_finish         = temp.d_finish;
+    aDeque.d_spareBlocks    = temp.d_spareBlocks;
+    aDeque.d_numSpareBlocks = temp.d_numSpareBlocks;
 }
 
 }  // close namespace bsl
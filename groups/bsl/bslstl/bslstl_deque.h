@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl_Deque: standard-compliant 'bsl::deque' implementation
+//  bslstl::DequeBlockLayout: block length and spare-block policy for a 'deque'
 //
 //@SEE_ALSO: bslstl_vector, bsl+stlhdrs
 //
@@ -36,6 +37,49 @@ BSLS_IDENT("$Id: $")
 //:   establish a full standard compliance for this component when used as
 //:   'bsl::deque' in the BSL STL.
 //
+///Block Layout
+///------------
+// A 'deque' stores its elements in fixed-length blocks, which it allocates
+// as it grows at either end, and deallocates as soon as they become empty.
+// By default, the number of elements in a block, 'BLOCK_LENGTH', is computed
+// by 'bsl::Deque_BlockLengthCalcUtil' from the size of 'VALUE_TYPE' so that a
+// block occupies about 200 bytes, but holds no fewer than 16 elements.
+//
+// A deque used as a FIFO queue of roughly constant length empties a block at
+// its front as often as it fills one at its back, and so, by default,
+// allocates and deallocates a block every 'BLOCK_LENGTH' elements.  The
+// layout of the deques of a given 'VALUE_TYPE' can instead be chosen by
+// specializing 'bsl::Deque_BlockLengthCalcUtil' for that type, typically by
+// deriving the specialization from 'bslstl::DequeBlockLayout', which computes
+// the block length from a block size in bytes and retains a number of emptied
+// ("spare") blocks for reuse:
+//..
+//  namespace bsl {
+//
+//  template <>
+//  struct Deque_BlockLengthCalcUtil<MyMessage>
+//  : BloombergLP::bslstl::DequeBlockLayout<MyMessage, 4096, 2> {
+//      // Use page-sized blocks for 'deque<MyMessage>', and retain up to two
+//      // spare blocks.
+//  };
+//
+//  }  // close namespace bsl
+//..
+// A deque retaining spare blocks takes a new block from its spares, if it
+// has any, before allocating one, and keeps an emptied block as a spare,
+// unless it already has the maximum number, rather than deallocating it.  A
+// spare block serves either end of the deque, so that, once a FIFO queue has
+// reached its steady-state length, 'push_back' and 'pop_front' never call
+// the allocator.  Spare blocks are released when the deque is destroyed.
+//
+// Choosing a block size that is a multiple of the cache-line size (or is the
+// page size) keeps the blocks from sharing cache lines (or pages) with
+// unrelated memory, provided that the allocator supplied to the deque aligns
+// allocations of that size accordingly; e.g., an allocator that obtains
+// page-sized requests directly from the operating system yields page-aligned
+// blocks.  Note that the specialization must be visible wherever a 'deque'
+// of that type is used.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.
@@ -210,6 +254,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ASSERT
 #include <bslmf_assert.h>
 #endif
@@ -256,6 +304,41 @@ BSL_OVERRIDES_STD mode"
 
 #endif
 
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // struct DequeBlockLayout
+                          // =======================
+
+template <class VALUE_TYPE, int BLOCK_SIZE, int SPARE_BLOCKS>
+struct DequeBlockLayout {
+    // This 'struct' provides the block length of a 'bsl::deque' of elements
+    // of the (template parameter) 'VALUE_TYPE' whose blocks are to occupy at
+    // most the (template parameter) 'BLOCK_SIZE' bytes, but to hold no fewer
+    // than 16 elements, and the (template parameter) 'SPARE_BLOCKS' number of
+    // emptied blocks that such a deque retains for reuse.  A specialization of
+    // 'bsl::Deque_BlockLengthCalcUtil' derived from this 'struct' applies the
+    // layout to the deques of 'VALUE_TYPE' (see {Block Layout}).
+
+    BSLMF_ASSERT(0 < BLOCK_SIZE);
+    BSLMF_ASSERT(0 <= SPARE_BLOCKS);
+
+    // TYPES
+    enum {
+        BLOCK_LENGTH     = (16 * sizeof(VALUE_TYPE) >= BLOCK_SIZE)
+                           ? 16
+                           : (BLOCK_SIZE / sizeof(VALUE_TYPE)),
+                               // number of elements per block
+
+        NUM_SPARE_BLOCKS = SPARE_BLOCKS
+                               // maximum number of retained empty blocks
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 namespace bsl {
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -273,15 +356,20 @@ template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
     // This 'struct' provides a namespace for the calculation of block length
     // (the number of elements per block within a 'deque').  This ensures that
-    // each block in the deque can hold at least 16 elements.
+    // each block in the deque can hold at least 16 elements.  By default, a
+    // deque retains no empty blocks.  This template may be specialized to
+    // choose a different layout for the deques of a particular 'VALUE_TYPE'
+    // (see {Block Layout}).
 
     // TYPES
     enum {
         DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
         BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
                              ? 16
-                             : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE))
+                             : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE)),
                                    // number of elements per block
+
+        NUM_SPARE_BLOCKS   = 0     // maximum number of retained empty blocks
     };
 };
 
@@ -361,6 +449,10 @@ class Deque_Base {
     std::size_t  d_blocksLength; // length of d_blocks array
     IteratorImp  d_start;        // iterator to first element
     IteratorImp  d_finish;       // iterator to one past last element
+    BlockPtr     d_spareBlocks;  // list of retained empty blocks, linked
+                                 // through their first bytes (owned)
+    int          d_numSpareBlocks;
+                                 // number of blocks in 'd_spareBlocks'
 
   public:
     // MANIPULATORS
@@ -505,7 +597,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
 
     // PRIVATE TYPES
     enum {
-        BLOCK_LENGTH = Deque_BlockLengthCalcUtil<VALUE_TYPE>::BLOCK_LENGTH
+        BLOCK_LENGTH     = Deque_BlockLengthCalcUtil<VALUE_TYPE>::BLOCK_LENGTH,
+        NUM_SPARE_BLOCKS =
+                        Deque_BlockLengthCalcUtil<VALUE_TYPE>::NUM_SPARE_BLOCKS
     };
 
     typedef Deque_Base<VALUE_TYPE>                             Base;
@@ -579,6 +673,18 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // provide an exception-safe repository for intermediate calculations.
 
     // PRIVATE MANIPULATORS
+    Block *allocateBlock();
+        // Return the address of an uninitialized block, taken from the spare
+        // blocks of this deque if it has any, and allocated otherwise.
+
+    void deallocateBlock(Block *block);
+        // Retain the specified empty 'block' as a spare block of this deque
+        // if it has fewer than 'NUM_SPARE_BLOCKS' spare blocks, and
+        // deallocate it otherwise.
+
+    void releaseSpareBlocks();
+        // Deallocate the spare blocks of this deque.
+
     template <class INPUT_ITER>
     size_type privateAppend(INPUT_ITER                     first,
                             INPUT_ITER                     last,
@@ -972,6 +1078,14 @@ void swap(deque<VALUE_TYPE, ALLOCATOR>& lhs,
     // call.  Note that this method does not throw or invalidate iterators if
     // 'lhs.get_allocator()' and 'rhs.get_allocator()' have the same value.
 
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE_TYPE, class ALLOCATOR>
+void hashAppend(HASHALG& hashAlg, const deque<VALUE_TYPE, ALLOCATOR>& input);
+    // Pass the specified 'input' deque to the specified 'hashAlg': its size
+    // (as a 'std::size_t'), followed by each of its elements in order.  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').
+
                       // =============================
                       // class bsl::Deque_BlockCreator
                       // =============================
@@ -1370,10 +1484,50 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(RawInit, const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
 {
-    this->d_blocks = 0;
+    this->d_blocks         = 0;
+    this->d_spareBlocks    = 0;
+    this->d_numSpareBlocks = 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename deque<VALUE_TYPE,ALLOCATOR>::Block *
+deque<VALUE_TYPE,ALLOCATOR>::allocateBlock()
+{
+    if (0 < NUM_SPARE_BLOCKS && this->d_spareBlocks) {
+        Block *block = this->d_spareBlocks;
+        this->d_spareBlocks = *reinterpret_cast<BlockPtr *>(block);
+        --this->d_numSpareBlocks;
+        return block;                                                 // RETURN
+    }
+    return this->allocateN((Block *) 0, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE,ALLOCATOR>::deallocateBlock(Block *block)
+{
+    if (this->d_numSpareBlocks < NUM_SPARE_BLOCKS) {
+        *reinterpret_cast<BlockPtr *>(block) = this->d_spareBlocks;
+        this->d_spareBlocks = block;
+        ++this->d_numSpareBlocks;
+        return;                                                       // RETURN
+    }
+    this->deallocateN(block, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+void deque<VALUE_TYPE,ALLOCATOR>::releaseSpareBlocks()
+{
+    while (this->d_spareBlocks) {
+        Block *block = this->d_spareBlocks;
+        this->d_spareBlocks = *reinterpret_cast<BlockPtr *>(block);
+        this->deallocateN(block, 1);
+    }
+    this->d_numSpareBlocks = 0;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 typename deque<VALUE_TYPE,ALLOCATOR>::size_type
@@ -1499,7 +1653,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInit(size_type numElements)
     // little room at the front and back of the array for growth.
 
     BlockPtr *firstBlockPtr = &this->d_blocks[Imp::BLOCK_ARRAY_PADDING];
-    *firstBlockPtr = this->allocateN((Block*) 0, 1);
+    *firstBlockPtr = allocateBlock();
 
     // Calculate the offset into the first block such that 'n' elements will
     // leave equal space at the front of the first block and at the end of the
@@ -1674,7 +1828,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateSplit(
 
     // Good time to allocate block for exception safety.
 
-    Block *newBlock = this->allocateN((Block*) 0, 1);
+    Block *newBlock = allocateBlock();
 
     // The following chunk of code will never throw an exception.  Move unsplit
     // blocks from 'this' to 'other', then adjust the iterators.
@@ -2090,6 +2244,10 @@ deque<VALUE_TYPE,ALLOCATOR>::~deque()
         this->deallocateN(*this->d_start.blockPtr(), 1);
     }
 
+    // Deallocate the blocks retained by 'clear' and earlier removals.
+
+    releaseSpareBlocks();
+
     // Deallocate the array of block pointers.
 
     this->deallocateN(this->d_blocks, this->d_blocksLength);
@@ -2483,7 +2641,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_front()
                                                      this->d_start.valuePtr());
 
     if (1 == this->d_start.remainingInBlock()) {
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        deallocateBlock(*this->d_start.blockPtr());
         this->d_start.nextBlock();
         return;                                                       // RETURN
     }
@@ -2500,7 +2658,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_back()
         --this->d_finish;
         BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
                                                     this->d_finish.valuePtr());
-        this->deallocateN(this->d_finish.blockPtr()[1], 1);
+        deallocateBlock(this->d_finish.blockPtr()[1]);
         return;                                                       // RETURN
     }
 
@@ -2535,11 +2693,11 @@ deque<VALUE_TYPE,ALLOCATOR>::erase(const_iterator first,
 
     for ( ; oldStart.imp().blockPtr() != this->d_start.blockPtr();
                                                   oldStart.imp().nextBlock()) {
-        this->deallocateN(oldStart.imp().blockPtr()[0], 1);
+        deallocateBlock(oldStart.imp().blockPtr()[0]);
     }
     for ( ; oldFinish.imp().blockPtr() != this->d_finish.blockPtr();
                                              oldFinish.imp().previousBlock()) {
-        this->deallocateN(oldFinish.imp().blockPtr()[0], 1);
+        deallocateBlock(oldFinish.imp().blockPtr()[0]);
     }
     return result;
 }
@@ -2595,7 +2753,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::clear()
     BlockPtr *startBlock = this->d_start.blockPtr();
     BlockPtr *finishBlock = this->d_finish.blockPtr();
     for ( ; startBlock != finishBlock; ++startBlock) {
-        this->deallocateN(*startBlock, 1);
+        deallocateBlock(*startBlock);
     }
 
     // Reposition in the middle.
@@ -2708,6 +2866,20 @@ void swap(deque<VALUE_TYPE, ALLOCATOR>& a,
     a.swap(b);
 }
 
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE_TYPE, class ALLOCATOR>
+inline
+void hashAppend(HASHALG& hashAlg, const deque<VALUE_TYPE, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    typedef typename deque<VALUE_TYPE, ALLOCATOR>::const_iterator ci_t;
+
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
+    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
+        hashAppend(hashAlg, *b);
+    }
+}
+
                       // --------------------------------
                       // class bslstl::Deque_BlockCreator
                       // --------------------------------
@@ -2739,7 +2911,7 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::~Deque_BlockCreator()
         for (; delFirst != delLast; ++delFirst) {
             // Deallocate the block that '*d_start' points to.
 
-            d_deque_p->deallocateN(*delFirst, 1);
+            d_deque_p->deallocateBlock(*delFirst);
         }
     }
 }
@@ -2750,7 +2922,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtFront(size_type n)
 {
     d_boundary = reserveBlockSlots(n, true);
     for ( ; n > 0; --n) {
-        d_boundary[-1] = d_deque_p->allocateN((Block*) 0, 1);
+        d_boundary[-1] = d_deque_p->allocateBlock();
         --d_boundary;
     }
 }
@@ -2760,7 +2932,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtBack(size_type n)
 {
     d_boundary = reserveBlockSlots(n, false);
     for ( ; n > 0; --n) {
-        *d_boundary = d_deque_p->allocateN((Block*) 0, 1);
+        *d_boundary = d_deque_p->allocateBlock();
         ++d_boundary;
     }
 }
@@ -7,6 +7,8 @@
 #include <bslstl_string.h>                 // for testing only
 #include <bslstl_vector.h>                 // for testing only
 
+#include <bslh_defaulthashalgorithm.h>     // for testing only
+#include <bslh_hash.h>                     // for testing only
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>   // for testing only
@@ -142,11 +144,18 @@ using namespace bsl;
 // [21] bool operator>(const deque<T,A>&, const deque<T,A>&);
 // [21] bool operator<=(const deque<T,A>&, const deque<T,A>&);
 // [21] bool operator>=(const deque<T,A>&, const deque<T,A>&);
+// [27] void hashAppend(HASHALG& hashAlg, const deque<T,A>& input);
+//
+// class bslstl::DequeBlockLayout
+// ==============================
+// [28] BLOCK_LENGTH
+// [28] NUM_SPARE_BLOCKS
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
 // [18] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [28] CONCERN: a deque reuses its spare blocks
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -288,6 +297,24 @@ const int NUM_PADDING = 2;
 const int NUM_INTERNAL_STATE_TEST = 10;
     // Number of different internal states to check.
 
+struct QueueElement {
+    // This 'struct' is the element type of deques having a block layout that
+    // retains spare blocks.
+
+    int d_value;
+};
+
+namespace bsl {
+
+template <>
+struct Deque_BlockLengthCalcUtil<QueueElement>
+: BloombergLP::bslstl::DequeBlockLayout<QueueElement, 256, 2> {
+    // Use blocks of 256 bytes, and retain up to two spare blocks, for the
+    // deques of 'QueueElement'.
+};
+
+}  // close namespace bsl
+
 //=============================================================================
 //                      GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
@@ -7916,6 +7943,305 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK LAYOUT AND SPARE BLOCKS
+        //
+        // Concerns:
+        //: 1 'DequeBlockLayout' computes the number of elements fitting in the
+        //:   block size, but no fewer than 16, and passes the number of spare
+        //:   blocks through.
+        //:
+        //: 2 By default, a deque retains no spare blocks.
+        //:
+        //: 3 A deque whose layout retains spare blocks, used as a queue of
+        //:   steady-state length at either end, makes no allocations once it
+        //:   has reached that length, and holds the correct elements.
+        //:
+        //: 4 A deque retains no more than the configured number of spare
+        //:   blocks, whichever operation empties its blocks.
+        //:
+        //: 5 Spare blocks move with the deque's contents on 'swap', and are
+        //:   released by the destructor.
+        //
+        // Plan:
+        //: 1 Check the enumerators of several layouts.  (C-1..2)
+        //:
+        //: 2 Run a FIFO queue at both ends, and compare the number of
+        //:   allocations after a warm-up with that at the end, for deques of
+        //:   'QueueElement' (retaining spare blocks) and of 'int' (not).
+        //:   (C-3)
+        //:
+        //: 3 Fill deques, empty them with 'clear', 'erase', 'pop_front', and
+        //:   'pop_back', and check the number of blocks in use.  (C-4)
+        //:
+        //: 4 Swap deques having spare blocks, use them, and verify that no
+        //:   memory is in use after they are destroyed.  (C-5)
+        //
+        // Testing:
+        //   BLOCK_LENGTH
+        //   NUM_SPARE_BLOCKS
+        //   CONCERN: a deque reuses its spare blocks
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BLOCK LAYOUT AND SPARE BLOCKS"
+                            "\n=====================================\n");
+
+        typedef bsl::deque<QueueElement> Queue;
+
+        enum {
+            QUEUE_BLOCK_LENGTH =
+                        Deque_BlockLengthCalcUtil<QueueElement>::BLOCK_LENGTH
+        };
+
+        if (verbose) printf("\tTesting the layout enumerators.\n");
+        {
+            typedef bslstl::DequeBlockLayout<int,     4096, 0> PageOfInt;
+            typedef bslstl::DequeBlockLayout<char,      64, 3> LineOfChar;
+            typedef bslstl::DequeBlockLayout<double,    64, 1> LineOfDouble;
+
+            ASSERT(1024 == PageOfInt::BLOCK_LENGTH);
+            ASSERT(   0 == PageOfInt::NUM_SPARE_BLOCKS);
+            ASSERT(  64 == LineOfChar::BLOCK_LENGTH);
+            ASSERT(   3 == LineOfChar::NUM_SPARE_BLOCKS);
+            ASSERT(  16 == LineOfDouble::BLOCK_LENGTH);
+            ASSERT(   1 == LineOfDouble::NUM_SPARE_BLOCKS);
+
+            ASSERT(  64 == QUEUE_BLOCK_LENGTH);
+            ASSERT(   2 ==
+                  Deque_BlockLengthCalcUtil<QueueElement>::NUM_SPARE_BLOCKS);
+            ASSERT(   0 == Deque_BlockLengthCalcUtil<int>::NUM_SPARE_BLOCKS);
+        }
+
+        if (verbose) printf("\tTesting steady-state queues.\n");
+        {
+            const int LENGTHS[] = { 1, 2, QUEUE_BLOCK_LENGTH - 1,
+                                    QUEUE_BLOCK_LENGTH,
+                                    QUEUE_BLOCK_LENGTH + 1,
+                                    5 * QUEUE_BLOCK_LENGTH + 7 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            const int NUM_CYCLES = 20 * QUEUE_BLOCK_LENGTH;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                for (int atBack = 0; atBack < 2; ++atBack) {
+                    Queue mX(&oa);  const Queue& X = mX;
+
+                    int next = 0, expected = 0;
+                    bsls::Types::Int64 numAllocations = 0;
+
+                    for (int i = 0; i < LENGTH + 2 * NUM_CYCLES; ++i) {
+                        if (LENGTH + NUM_CYCLES == i) {
+                            numAllocations = oa.numAllocations();
+                        }
+
+                        QueueElement element = { next++ };
+                        if (atBack) {
+                            mX.push_back(element);
+                        }
+                        else {
+                            mX.push_front(element);
+                        }
+
+                        if (i >= LENGTH) {
+                            const int value = atBack ? X.front().d_value
+                                                     : X.back().d_value;
+                            LOOP3_ASSERT(LENGTH, atBack, i,
+                                         expected == value);
+                            ++expected;
+                            if (atBack) {
+                                mX.pop_front();
+                            }
+                            else {
+                                mX.pop_back();
+                            }
+                        }
+                    }
+                    LOOP2_ASSERT(LENGTH, atBack,
+                                 static_cast<size_t>(LENGTH) == X.size());
+                    LOOP2_ASSERT(LENGTH, atBack,
+                                 numAllocations == oa.numAllocations());
+                }
+                LOOP_ASSERT(LENGTH, 0 == oa.numBlocksInUse());
+            }
+
+            // Without spare blocks, a queue keeps allocating.
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                enum {
+                    INT_BLOCK_LENGTH =
+                                 Deque_BlockLengthCalcUtil<int>::BLOCK_LENGTH
+                };
+
+                bsl::deque<int> mX(&oa);
+                for (int i = 0; i < INT_BLOCK_LENGTH; ++i) {
+                    mX.push_back(i);
+                }
+                const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          oa.numAllocations();
+                for (int i = 0; i < 4 * INT_BLOCK_LENGTH; ++i) {
+                    mX.push_back(i);
+                    mX.pop_front();
+                }
+                ASSERT(NUM_ALLOCATIONS < oa.numAllocations());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting the number of spare blocks.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const int NUM_ELEMENTS = 10 * QUEUE_BLOCK_LENGTH;
+
+            for (int method = 0; method < 4; ++method) {
+                Queue mX(&oa);  const Queue& X = mX;
+
+                // An empty deque holds its array of block pointers and one
+                // block.
+
+                const bsls::Types::Int64 EMPTY_BLOCKS = oa.numBlocksInUse();
+                LOOP_ASSERT(method, 2 == EMPTY_BLOCKS);
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    QueueElement element = { i };
+                    mX.push_back(element);
+                }
+
+                switch (method) {
+                  case 0: {
+                    mX.clear();
+                  } break;
+                  case 1: {
+                    mX.erase(X.begin(), X.end());
+                  } break;
+                  case 2: {
+                    while (!X.empty()) {
+                        mX.pop_front();
+                    }
+                  } break;
+                  case 3: {
+                    while (!X.empty()) {
+                        mX.pop_back();
+                    }
+                  } break;
+                }
+                LOOP_ASSERT(method, X.empty());
+
+                // The array of block pointers may have grown, but is still a
+                // single block.
+
+                LOOP2_ASSERT(method, oa.numBlocksInUse(),
+                             EMPTY_BLOCKS + 2 == oa.numBlocksInUse());
+
+                // Refilling the deque first uses the spare blocks.
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+                for (int i = 0; i < 2 * QUEUE_BLOCK_LENGTH; ++i) {
+                    QueueElement element = { i };
+                    mX.push_back(element);
+                }
+                LOOP_ASSERT(method, NUM_ALLOCATIONS == oa.numAllocations());
+                LOOP_ASSERT(method,
+                            EMPTY_BLOCKS + 2 == oa.numBlocksInUse());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting 'swap' and the destructor.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Queue mX(&oa);  const Queue& X = mX;
+                Queue mY(&oa);  const Queue& Y = mY;
+
+                for (int i = 0; i < 4 * QUEUE_BLOCK_LENGTH; ++i) {
+                    QueueElement element = { i };
+                    mX.push_back(element);
+                    mY.push_back(element);
+                }
+                mX.clear();
+                for (int i = 0; i < 3 * QUEUE_BLOCK_LENGTH; ++i) {
+                    mY.pop_front();
+                }
+
+                mX.swap(mY);
+                ASSERT(QUEUE_BLOCK_LENGTH == X.size());
+                ASSERT(Y.empty());
+                ASSERT(3 * QUEUE_BLOCK_LENGTH == X.front().d_value);
+
+                // Both deques can use the spare blocks they now hold.
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+                for (int i = 0; i < 2 * QUEUE_BLOCK_LENGTH; ++i) {
+                    QueueElement element = { i };
+                    mX.push_back(element);
+                    mY.push_front(element);
+                }
+                ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+                Queue mZ(X, &oa);  const Queue& Z = mZ;
+                ASSERT(X.size() == Z.size());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the deque (as a 'size_t'), and
+        //:   then each of its elements, in order, to the hashing algorithm,
+        //:   including when the elements span several blocks and the first
+        //:   element is not at the start of a block.
+        //
+        // Plan:
+        //: 1 For lengths up to several blocks, create deques of 'int' by
+        //:   alternately pushing at the front and at the back, and compare
+        //:   the value computed by 'bslh::Hash' with that of a
+        //:   'bslh::DefaultHashAlgorithm' to which the size and elements were
+        //:   supplied explicitly.  (C-1)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const deque<T,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        typedef bsl::Deque_BlockLengthCalcUtil<int> BlockLengthUtil;
+
+        const int MAX_LENGTH = 4 * BlockLengthUtil::BLOCK_LENGTH;
+
+        bsl::deque<int> mX(&oa);  const bsl::deque<int>& X = mX;
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            bslh::DefaultHashAlgorithm expected;
+            const size_t               SIZE = X.size();
+            expected(&SIZE, sizeof SIZE);
+            for (size_t i = 0; i < SIZE; ++i) {
+                expected(&X[i], sizeof X[i]);
+            }
+            LOOP_ASSERT(length, expected.computeHash() == hasher(X));
+
+            if (length % 2) {
+                mX.push_front(length);
+            }
+            else {
+                mX.push_back(length);
+            }
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
@@ -0,0 +1,886 @@
+// bslstl_flathashmap.t.cpp                                           -*-C++-*-
+#include <bslstl_flathashmap.h>
+
+#include <bslstl_unorderedmap.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over
+// 'bslstl::FlatHashTable', which is tested thoroughly in its own component.
+// Accordingly, this test driver concentrates on the forwarding of each method
+// to the underlying table, on the behavior specific to a map ('operator[]',
+// 'at', and the use of the mapped allocator), and on the type traits.  A
+// benchmark comparing 'bsl::flat_hash_map' with 'bsl::unordered_map' is
+// provided as a negative test case.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_hash_map(size_type, const hasher&, const key_equal&, ALLOC);
+// [ 2] flat_hash_map(const allocator_type& allocator);
+// [ 4] flat_hash_map(const flat_hash_map& original);
+// [ 4] flat_hash_map(const flat_hash_map&, const allocator_type&);
+// [ 2] flat_hash_map(INPUT_ITERATOR, INPUT_ITERATOR, size_type, ...);
+// [ 2] ~flat_hash_map();
+//
+// MANIPULATORS
+// [ 4] flat_hash_map& operator=(const flat_hash_map& rhs);
+// [ 3] mapped_type& operator[](const key_type& key);
+// [ 3] mapped_type& at(const key_type& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 5] void clear();
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const key_type& key);
+// [ 2] pair<iterator, bool> insert(const SOURCE_TYPE& value);
+// [ 2] iterator insert(const_iterator hint, const SOURCE_TYPE& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 5] void rehash(size_type minCapacity);
+// [ 5] void reserve(size_type numElements);
+// [ 4] void swap(flat_hash_map& other);
+//
+// ACCESSORS
+// [ 3] const mapped_type& at(const key_type& key) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 5] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] hasher hash_function() const;
+// [ 2] key_equal key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_hash_map&, const flat_hash_map&);
+// [ 4] bool operator!=(const flat_hash_map&, const flat_hash_map&);
+// [ 4] void swap(flat_hash_map& a, flat_hash_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_map<int, int>                  IntMap;
+typedef bsl::flat_hash_map<int, bsltf::AllocTestType> Obj;
+typedef Obj::value_type                               Value;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int benchmarkKey(int index)
+    // Return a distinct key for each distinct value of the specified 'index'
+    // in the range '[0 .. 2^31)'.  Note that consecutive indices do not yield
+    // consecutive keys.
+{
+    return static_cast<unsigned int>(index) * 2654435761U;
+}
+
+template <class MAP>
+void benchmark(const char *name, int size, int numRounds)
+    // Print, for the container type 'MAP' identified by the specified 'name',
+    // the average time per operation taken to insert the specified 'size'
+    // distinct keys into an empty map, to look up each of them, to look up
+    // 'size' absent keys, and to erase each of them, repeating each
+    // measurement the specified 'numRounds' times.
+{
+    bslma::NewDeleteAllocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+    double insertTime = 0, hitTime = 0, missTime = 0, eraseTime = 0;
+    bsls::Types::Int64 checksum = 0;
+
+    for (int round = 0; round < numRounds; ++round) {
+        MAP mX(alloc);
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            mX.insert(typename MAP::value_type(benchmarkKey(i), i));
+        }
+        timer.stop();
+        insertTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            checksum += mX.find(benchmarkKey(i))->second;
+        }
+        timer.stop();
+        hitTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = size; i < 2 * size; ++i) {
+            checksum += mX.count(benchmarkKey(i));
+        }
+        timer.stop();
+        missTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            checksum += mX.erase(benchmarkKey(i));
+        }
+        timer.stop();
+        eraseTime += timer.elapsedTime();
+    }
+
+    const double NS = 1e9 / (static_cast<double>(size) * numRounds);
+
+    printf("%-14s %10d %10.1f %10.1f %10.1f %10.1f   (%lld)\n",
+           name,
+           size,
+           insertTime * NS,
+           hitTime    * NS,
+           missTime   * NS,
+           eraseTime  * NS,
+           checksum);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the number of occurrences of each of a sequence of
+// word identifiers.  We can use a 'flat_hash_map' mapping each identifier to
+// its count:
+//..
+    static const int WORDS[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+    bslma::TestAllocator             oa("object");
+    bsl::flat_hash_map<int, int>     counts(&oa);
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Then, we verify the number of distinct words and some of the counts:
+//..
+    ASSERT(7 == counts.size());
+    ASSERT(2 == counts[1]);
+    ASSERT(3 == counts[5]);
+    ASSERT(1 == counts.count(9));
+    ASSERT(0 == counts.count(7));
+//..
+// Notice that all of the elements are held in a single block of memory:
+//..
+    ASSERT(1 == oa.numBlocksInUse());
+//..
+// Finally, we sum the counts by iterating over the map, noting that the order
+// of iteration is unspecified:
+//..
+    int total = 0;
+    for (bsl::flat_hash_map<int, int>::const_iterator it = counts.begin();
+         it != counts.end();
+         ++it) {
+        total += it->second;
+    }
+    ASSERT(NUM_WORDS == total);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ERASURE AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes the specified elements, destroys
+        //:   them, and returns the documented value.
+        //:
+        //: 2 'clear' removes all elements and retains the capacity.
+        //:
+        //: 3 'reserve' and 'rehash' forward to the table, so that after
+        //:   'reserve(n)', 'n' elements can be inserted without allocating.
+        //
+        // Plan:
+        //: 1 Populate maps, erase elements with each overload, and verify the
+        //:   remaining elements and the memory in use.  (C-1..2)
+        //:
+        //: 2 Reserve capacity, insert elements, and verify that no memory is
+        //:   allocated.  (C-3)
+        //
+        // Testing:
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void rehash(size_type minCapacity);
+        //   void reserve(size_type numElements);
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ERASURE AND CAPACITY"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 100;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX[i].setData(i);
+            }
+            ASSERTV(N + 1 == oa.numBlocksInUse());
+
+            ASSERTV(1 == mX.erase(0));
+            ASSERTV(0 == mX.erase(0));
+            ASSERTV(N == oa.numBlocksInUse());
+
+            Obj::iterator it = mX.find(1);
+            Obj::iterator next = it;
+            ++next;
+            ASSERTV(next == mX.erase(it));
+            ASSERTV(0 == X.count(1));
+
+            // Erase a range of elements from the middle of the sequence.
+
+            Obj::const_iterator first = X.begin();
+            for (int i = 0; i < 10; ++i) {
+                ++first;
+            }
+            Obj::const_iterator last = first;
+            for (int i = 0; i < 20; ++i) {
+                ++last;
+            }
+            const int KEY = last->first;
+
+            Obj::iterator result = mX.erase(first, last);
+            ASSERTV(last == result);
+            ASSERTV(KEY  == result->first);
+            ASSERTV(N - 22 == static_cast<int>(X.size()));
+            ASSERTV(N - 21 == oa.numBlocksInUse());
+
+            ASSERTV(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERTV(X.empty());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            mX[1];
+            const Obj::size_type CAPACITY = X.capacity();
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(CAPACITY == X.capacity());
+
+            mX.rehash(0);
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == oa.numBlocksInUse());
+
+            mX.reserve(1000);
+            ASSERTV(1000 <= static_cast<float>(X.capacity())
+                                                 * X.max_load_factor());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            IntMap::size_type capacity = X.capacity();
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(Value(i, bsltf::AllocTestType(i)));
+            }
+            ASSERTV(capacity == X.capacity());
+            ASSERTV(1000 == oam.numBlocksTotalChange());  // elements only
+
+            mX.rehash(5000);
+            ASSERTV(5000 <= X.capacity());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, i == X.at(i).data());
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values and functors, and do not
+        //:   change allocators.
+        //:
+        //: 3 Maps compare equal if and only if they have the same key-value
+        //:   pairs, regardless of insertion order and capacity.
+        //
+        // Plan:
+        //: 1 Create maps with various values, copy, assign, swap and compare
+        //:   them.  (C-1..3)
+        //
+        // Testing:
+        //   flat_hash_map(const flat_hash_map& original);
+        //   flat_hash_map(const flat_hash_map&, const allocator_type&);
+        //   flat_hash_map& operator=(const flat_hash_map& rhs);
+        //   void swap(flat_hash_map& other);
+        //   bool operator==(const flat_hash_map&, const flat_hash_map&);
+        //   bool operator!=(const flat_hash_map&, const flat_hash_map&);
+        //   void swap(flat_hash_map& a, flat_hash_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          "\n============================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                mX[i].setData(i);
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+            ASSERTV(&da == Y.find(7)->second.allocator());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+            ASSERTV(&sa == Z.find(7)->second.allocator());
+
+            // Build a map having the same value in the reverse order, with
+            // a larger capacity.
+
+            Obj mW(1000, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& W = mW;
+            for (int i = 49; 0 <= i; --i) {
+                mW[i].setData(i);
+            }
+            ASSERTV(X.capacity() != W.capacity());
+            ASSERTV(X == W);
+            ASSERTV(!(X != W));
+
+            mW[3].setData(-3);
+            ASSERTV(X != W);
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW[100];
+            mZ.swap(mW);
+            ASSERTV(51 == Z.size());
+            ASSERTV(50 == W.size());
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            bsl::swap(mZ, mW);
+            ASSERTV(50 == Z.size());
+            ASSERTV(51 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed mapped value, using
+        //:   the allocator of the map, only if the key is absent, and returns
+        //:   a reference to the mapped value.
+        //:
+        //: 2 'at' returns a reference to the mapped value, and throws
+        //:   'std::out_of_range' if the key is absent.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' and 'at' on present and absent keys.  (C-1..2)
+        //
+        // Testing:
+        //   mapped_type& operator[](const key_type& key);
+        //   mapped_type& at(const key_type& key);
+        //   const mapped_type& at(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator[]' AND 'at'"
+                            "\n=============================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                bsltf::AllocTestType& value = mX[i];
+                ASSERTV(i, 0 == value.data());
+                ASSERTV(i, &oa == value.allocator());
+                value.setData(i);
+
+                ASSERTV(i, i == mX[i].data());
+                ASSERTV(i, i == mX.at(i).data());
+                ASSERTV(i, i == X.at(i).data());
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+            ASSERTV(0 == da.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(100);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+
+            caught = false;
+            try {
+                X.at(-1);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+            ASSERTV(100 == X.size());
+#endif
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS, INSERTION, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified functors and allocator,
+        //:   and allocates only if an initial number of elements or a
+        //:   non-empty range is supplied.
+        //:
+        //: 2 Each 'insert' overload inserts an element only if its key is
+        //:   absent, and returns the documented value.
+        //:
+        //: 3 The lookup methods find exactly the inserted keys.
+        //:
+        //: 4 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct maps with each constructor, insert and look up keys,
+        //:   and verify the results and the memory used.  (C-1..3)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-4)
+        //
+        // Testing:
+        //   flat_hash_map(size_type, const hasher&, const key_equal&, ALLOC);
+        //   flat_hash_map(const allocator_type& allocator);
+        //   flat_hash_map(INPUT_ITERATOR, INPUT_ITERATOR, size_type, ...);
+        //   ~flat_hash_map();
+        //   iterator begin();
+        //   iterator end();
+        //   iterator find(const key_type& key);
+        //   pair<iterator, bool> insert(const SOURCE_TYPE& value);
+        //   iterator insert(const_iterator hint, const SOURCE_TYPE& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   hasher hash_function() const;
+        //   key_equal key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTORS, INSERTION, AND LOOKUP"
+                            "\n===========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Value,
+                                   bsl::pair<const int,
+                                             bsltf::AllocTestType> >::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            IntMap mA;  const IntMap& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(0 == A.load_factor());
+            ASSERTV(0.875f == A.max_load_factor());
+            ASSERTV(0 < A.max_size());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(A.cbegin() == A.cend());
+            ASSERTV(mA.begin() == mA.end());
+
+            IntMap mB(&oa);  const IntMap& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            IntMap mC(100, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const IntMap& C = mC;
+            ASSERTV(100 <= static_cast<float>(C.capacity())
+                                                 * C.max_load_factor());
+            ASSERTV(1 == oa.numBlocksInUse());
+            ASSERTV(C.empty());
+
+            (void) C.hash_function();
+            (void) C.key_eq();
+
+            static const int DATA[][2] = {
+                { 1, 10 }, { 2, 20 }, { 3, 30 }, { 2, 99 }, { 4, 40 }
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            bsl::pair<int, int> values[NUM_DATA];
+            for (int i = 0; i < NUM_DATA; ++i) {
+                values[i] = bsl::pair<int, int>(DATA[i][0], DATA[i][1]);
+            }
+
+            IntMap mD(values, values + NUM_DATA, 0, bsl::hash<int>(),
+                      bsl::equal_to<int>(), &oa);
+            const IntMap& D = mD;
+            ASSERTV(4 == D.size());
+            ASSERTV(20 == D.at(2));
+            ASSERTV(2 == oa.numBlocksInUse());
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion and lookup.\n");
+        {
+            IntMap mX(&oa);  const IntMap& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                bsl::pair<IntMap::iterator, bool> r =
+                                       mX.insert(bsl::pair<int, int>(i, i));
+                ASSERTV(i, r.second);
+                ASSERTV(i, i == r.first->first);
+
+                r = mX.insert(bsl::pair<int, int>(i, -i));
+                ASSERTV(i, !r.second);
+                ASSERTV(i, i == r.first->second);
+
+                IntMap::iterator it = mX.insert(X.begin(),
+                                                bsl::pair<int, int>(i, 0));
+                ASSERTV(i, r.first == it);
+            }
+            ASSERTV(500 == X.size());
+            ASSERTV(X.load_factor() <= X.max_load_factor());
+
+            for (int i = -100; i < 600; ++i) {
+                const bool PRESENT = 0 <= i && i < 500;
+
+                ASSERTV(i, PRESENT == (1 == X.count(i)));
+                ASSERTV(i, PRESENT == (X.end() != X.find(i)));
+                ASSERTV(i, PRESENT == (mX.end() != mX.find(i)));
+
+                bsl::pair<IntMap::const_iterator, IntMap::const_iterator> cr =
+                                                             X.equal_range(i);
+                bsl::pair<IntMap::iterator, IntMap::iterator> mr =
+                                                            mX.equal_range(i);
+                ASSERTV(i, cr.first == mr.first);
+                ASSERTV(i, cr.second == mr.second);
+                if (PRESENT) {
+                    ASSERTV(i, i == cr.first->first);
+                    ++cr.first;
+                    ASSERTV(i, cr.first == cr.second);
+                }
+                else {
+                    ASSERTV(i, X.end() == cr.first);
+                    ASSERTV(i, X.end() == cr.second);
+                }
+            }
+
+            int count = 0;
+            for (IntMap::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second = it->first * 2;
+                ++count;
+            }
+            ASSERTV(500 == count);
+            for (IntMap::const_iterator it = X.cbegin();
+                 it != X.cend();
+                 ++it) {
+                ASSERTV(it->first, it->first * 2 == it->second);
+            }
+
+            // Insert a range, some of which are already present.
+
+            bsl::pair<int, int> values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = bsl::pair<int, int>(490 + i, 0);
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(510 == X.size());
+            ASSERTV(980 == X.at(490));
+            ASSERTV(0 == X.at(509));
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase elements, and compare the results with
+        //:   those of a 'bsl::unordered_map'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            IntMap                      mX(&oa);
+            bsl::unordered_map<int, int> mY(&oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 2000);
+
+                switch (seed % 3) {
+                  case 0: {
+                    mX[KEY] = i;
+                    mY[KEY] = i;
+                  } break;
+                  case 1: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+
+            for (bsl::unordered_map<int, int>::const_iterator it = mY.begin();
+                 it != mY.end();
+                 ++it) {
+                ASSERTV(it->first, it->second == mX.at(it->first));
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+        //
+        // Concerns:
+        //: 1 Compare the speed of 'bsl::flat_hash_map' with that of
+        //:   'bsl::unordered_map' for maps from 1,000 elements up to a size
+        //:   that may be specified on the command line.
+        //
+        // Plan:
+        //: 1 For sizes increasing by factors of 10 from 1,000 to the maximum
+        //:   size given as the second argument (1,000,000 by default; pass,
+        //:   e.g., 100000000 for 100M elements, memory permitting), time the
+        //:   insertion of distinct keys, successful and unsuccessful lookups,
+        //:   and erasure, repeating the measurements for small sizes so that
+        //:   each size performs approximately the same number of operations.
+        //:   Print the average time per operation in nanoseconds.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::unordered_map'
+        // --------------------------------------------------------------------
+
+        const int MAX_SIZE = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        printf("\nPERFORMANCE: COMPARISON WITH 'bsl::unordered_map'"
+               "\n=================================================\n");
+
+        printf("%-14s %10s %10s %10s %10s %10s   (ns/op)\n",
+               "container", "size", "insert", "find hit", "find miss",
+               "erase");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            const int NUM_ROUNDS = size < 1000000 ? 1000000 / size : 1;
+
+            benchmark<bsl::flat_hash_map<unsigned int, int> >(
+                                           "flat_hash_map", size, NUM_ROUNDS);
+            benchmark<bsl::unordered_map<unsigned int, int> >(
+                                           "unordered_map", size, NUM_ROUNDS);
+
+            if (MAX_SIZE / 10 < size) {
+                break;
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
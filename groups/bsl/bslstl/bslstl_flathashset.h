@@ -0,0 +1,958 @@
+// bslstl_flathashset.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHSET
+#define INCLUDED_BSLSTL_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash set storing its elements inline.
+//
+//@CLASSES:
+//   bsl::flat_hash_set : open-addressing unordered set container
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_hash_set', implementing a container holding a collection of
+// unique keys with no guarantees on ordering.  The interface of
+// 'flat_hash_set' is that of 'bsl::unordered_set' without the bucket
+// interface (i.e., 'bucket', 'bucket_count', 'bucket_size', and the local
+// iterators), which has no meaning for an open-addressing hash table, and
+// with a fixed maximum load factor.
+//
+// An instantiation of 'flat_hash_set' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the set of
+// keys the 'flat_hash_set' contains, without regard to their order.  Memory is
+// supplied by the (template parameter) type 'ALLOCATOR', which defaults to
+// 'bsl::allocator', and so uses the 'bslma::Allocator' protocol exactly as
+// 'bsl::unordered_set' does.
+//
+// 'flat_hash_set' is implemented by 'bslstl::FlatHashTable', which stores its
+// elements directly in a single array and resolves collisions by open
+// addressing.  See 'bslstl_flathashmap' for a comparison of the performance
+// characteristics and guarantees of the flat containers with those of
+// 'bsl::unordered_set' and 'bsl::unordered_map'.  In particular, any
+// insertion that increases the size of a 'flat_hash_set' may rehash it,
+// invalidating all iterators, pointers, and references to its elements, and
+// its 'KEY' type must be copy-constructible in order to be moved by a rehash.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to determine the distinct values in a sequence of integers.
+// We can insert them into a 'flat_hash_set', which ignores duplicates:
+//..
+//  static const int DATA[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+//  const int NUM_DATA = sizeof DATA / sizeof *DATA;
+//
+//  bslma::TestAllocator    oa("object");
+//  bsl::flat_hash_set<int> distinct(DATA, DATA + NUM_DATA, 0,
+//                                   bsl::hash<int>(), bsl::equal_to<int>(),
+//                                   &oa);
+//
+//  assert(7 == distinct.size());
+//  assert(1 == distinct.count(9));
+//  assert(0 == distinct.count(7));
+//..
+// Notice that the set reserved enough capacity for all of the input values
+// before inserting them, so that it allocated exactly once:
+//..
+//  assert(1 == oa.numBlocksTotal());
+//..
+// Finally, we remove the odd values:
+//..
+//  for (bsl::flat_hash_set<int>::iterator it = distinct.begin();
+//       it != distinct.end(); ) {
+//      if (*it % 2) {
+//          it = distinct.erase(it);
+//      }
+//      else {
+//          ++it;
+//      }
+//  }
+//  assert(3 == distinct.size());
+//  assert(1 == distinct.count(2));
+//  assert(1 == distinct.count(4));
+//  assert(1 == distinct.count(6));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_flathashset.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_EQUALTO
+#include <bslstl_equalto.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#include <bslstl_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_HASH
+#include <bslstl_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // for 'std::size_t'
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                        // ===================
+                        // class flat_hash_set
+                        // ===================
+
+template <class KEY,
+          class HASH      = bsl::hash<KEY>,
+          class EQUAL     = bsl::equal_to<KEY>,
+          class ALLOCATOR = bsl::allocator<KEY> >
+class flat_hash_set {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values (of template parameter type 'KEY'),
+    // stored inline in an open-addressing hash table.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<const KEY>
+                                                            TableConfiguration;
+        // This 'typedef' is an alias for the policy used internally by this
+        // set to extract the key from the elements of this set.  Note that
+        // the elements are 'const', so that they cannot be modified through
+        // the iterators of this set.
+
+    typedef BloombergLP::bslstl::FlatHashTable<TableConfiguration,
+                                               HASH,
+                                               EQUAL,
+                                               ALLOCATOR> Table;
+        // This 'typedef' is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatHashTable' used to implement this container.
+
+    // FRIENDS
+    template <class KEY2,
+              class HASH2,
+              class EQUAL2,
+              class ALLOCATOR2>
+    friend bool operator==(
+                        const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
+                        const flat_hash_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+                        flat_hash_set,
+                        ::BloombergLP::bslmf::IsBitwiseMoveable,
+                        ::BloombergLP::bslmf::IsBitwiseMoveable<Table>::value);
+
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef HASH                                       hasher;
+    typedef EQUAL                                      key_equal;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Table::ConstIterator              iterator;
+    typedef typename Table::ConstIterator              const_iterator;
+
+  private:
+    // DATA
+    Table d_impl;  // underlying hash table used by this set
+
+  public:
+    // CREATORS
+    explicit flat_hash_set(
+                  size_type             initialNumElements = 0,
+                  const hasher&         hash               = hasher(),
+                  const key_equal&      keyEqual           = key_equal(),
+                  const allocator_type& allocator          = allocator_type());
+        // Create an empty set.  Optionally specify an 'initialNumElements'
+        // that the set can hold without rehashing.  If 'initialNumElements'
+        // is not supplied or is 0, no memory is allocated.  Optionally specify
+        // a 'hash' functor used to generate the hash values of keys.  If
+        // 'hash' is not supplied, a default-constructed object of type
+        // 'hasher' is used.  Optionally specify a key-equality functor
+        // 'keyEqual' used to determine whether two keys have the same value.
+        // If 'keyEqual' is not supplied, a default-constructed object of type
+        // 'key_equal' is used.  Optionally specify an 'allocator' used to
+        // supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'allocator_type' is used.  If the 'allocator_type' is
+        // 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *', and if 'allocator' is not
+        // supplied, the currently installed default allocator is used.
+
+    explicit flat_hash_set(const allocator_type& allocator);
+        // Create an empty set that uses the specified 'allocator' to supply
+        // memory.  Use default-constructed objects of type 'hasher' and
+        // 'key_equal' to hash and compare keys.  If the 'allocator_type' is
+        // 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_hash_set(const flat_hash_set& original);
+        // Create a set having the same value, hasher, and key-equality functor
+        // as the specified 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<allocator_type>::
+        // select_on_container_copy_construction(original.get_allocator())'
+        // to supply memory.  If the 'allocator_type' is 'bsl::allocator'
+        // (the default), the currently installed default allocator is used.
+
+    flat_hash_set(const flat_hash_set&  original,
+                  const allocator_type& allocator);
+        // Create a set having the same value, hasher, and key-equality functor
+        // as the specified 'original', and using the specified 'allocator' to
+        // supply memory.  If the 'allocator_type' is 'bsl::allocator' (the
+        // default), then 'allocator' shall be convertible to
+        // 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_set(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             initialNumElements = 0,
+                  const hasher&         hash               = hasher(),
+                  const key_equal&      keyEqual           = key_equal(),
+                  const allocator_type& allocator          = allocator_type());
+        // Create a set, and insert into it a 'value_type' object converted
+        // from each element in the range starting at the specified 'first'
+        // iterator and ending immediately before the specified 'last'
+        // iterator, ignoring those equal to a value that appears earlier in
+        // the sequence.  Optionally specify 'initialNumElements', 'hash',
+        // 'keyEqual', and 'allocator' having the same meaning as for the
+        // default constructor.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    ~flat_hash_set();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    flat_hash_set& operator=(const flat_hash_set& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    iterator end();
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the sequence of 'value_type' objects
+        // maintained by this set.
+
+    void clear();
+        // Remove all entries from this set.  Note that this set will be empty
+        // after this call, but its capacity is retained for future use.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this set.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the 'value_type' object equal to the specified
+        // 'key', if it exists, and return 1; otherwise (there is no such
+        // 'value_type' object in this set) return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this set or
+        // are both the 'end' iterator, and the 'first' position is at or
+        // before the 'last' position in the iteration sequence provided by
+        // this container.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equal to the specified 'key', if
+        // such an entry exists, and the past-the-end iterator ('end')
+        // otherwise.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if an equal value does
+        // not already exist in this set; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this set that is
+        // equal to 'value', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if the value was already present.  Note
+        // that an insertion invalidates all iterators, pointers, and
+        // references to the elements of this set.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set if an equal value does
+        // not already exist in this set.  Return an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this set that is
+        // equal to 'value'.  The behavior is undefined unless the specified
+        // 'hint' is a valid iterator into this set.  Note that 'hint' is not
+        // used by this method.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create a 'value_type' object for each iterator in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator.  Insert into this set each such object that is not
+        // already contained.  The (template parameter) type 'INPUT_ITERATOR'
+        // shall meet the requirements of an input iterator defined in the
+        // C++11 standard [24.2.3] providing access to values of a type
+        // convertible to 'value_type'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equal to the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this set contains no 'value_type' object equal to
+        // 'key', then the two returned iterators will have the same value,
+        // 'end()'.  Note that since a set maintains unique keys, the range
+        // will contain at most one element.
+
+    void rehash(size_type minCapacity);
+        // Change the capacity of this set to the smallest supported capacity
+        // that is at least the specified 'minCapacity' and that can hold
+        // 'size()' elements, and redistribute the elements into the new
+        // storage.  Note that this operation may reduce the capacity of this
+        // set, and that 'rehash(0)' releases all memory held by an empty set.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this set, if necessary, so that it can
+        // hold the specified 'numElements' without rehashing.  Note that this
+        // guarantees that, after the reserve, elements can be inserted to grow
+        // the container to 'size() == numElements' without any further
+        // allocation (unless the 'KEY' type itself, or the hash functor,
+        // allocates memory), and without invalidating iterators.
+
+    void swap(flat_hash_set& other);
+        // Exchange the value of this object as well as its hasher and
+        // key-equality functor with those of the specified 'other' object.
+        // This method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity, as long as the (template parameter)
+        // 'HASH' and (template parameter) 'EQUAL' do not throw when swapped.
+        // The behavior is undefined unless this object was created with the
+        // same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the sequence of 'value_type' objects
+        // maintained by this set.
+
+    size_type capacity() const;
+        // Return the number of slots in the table maintained by this set.
+        // Note that this set can hold 'capacity() * max_load_factor()'
+        // elements without rehashing.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects contained within this set
+        // that are equal to the specified 'key'.  Note that since a set
+        // maintains unique keys, the returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equal to the specified
+        // 'key', where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this set contains no 'value_type' object equal to
+        // 'key', then the two returned iterators will have the same value,
+        // 'end()'.  Note that since a set maintains unique keys, the range
+        // will contain at most one element.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equal to the specified 'key', if
+        // such an entry exists, and the past-the-end iterator ('end')
+        // otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    hasher hash_function() const;
+        // Return (a copy of) the unary hash functor used by this set to
+        // generate a hash value (of type 'std::size_t') for a 'key_type'
+        // object.
+
+    key_equal key_eq() const;
+        // Return (a copy of) the binary key-equality functor used by this set
+        // that returns 'true' if two 'key_type' objects have the same value,
+        // and 'false' otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the 'size' of this set and its
+        // 'capacity', or 0 if this set has no capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this set, 0.875.  Note that if an
+        // insert operation would cause the number of occupied and erased
+        // slots to exceed 'capacity() * max_load_factor()', that same insert
+        // operation will rehash the set (see 'rehash').
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size, without running out of resources.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator==(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_hash_set' objects have the
+    // same value if they have the same number of keys, and for each key that
+    // is contained in 'lhs' there is a key contained in 'rhs' having the same
+    // value, and vice versa.
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bool operator!=(const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_hash_set' objects do not
+    // have the same value if they do not have the same number of keys, or for
+    // some key that is contained in 'lhs' there is not a key in 'rhs' having
+    // the same value or vice-versa.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void swap(flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& a,
+          flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' object with those of the specified 'b' object.  This
+    // function provides the no-throw exception-safety guarantee and guarantees
+    // O[1] complexity, as long as the (template parameter) type 'HASH' and the
+    // (template parameter) type 'EQUAL' do not throw when swapped.  The
+    // behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                        // -------------------
+                        // class flat_hash_set
+                        // -------------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      size_type             initialNumElements,
+                                      const hasher&         hash,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& allocator)
+: d_impl(hash, keyEqual, initialNumElements, allocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                               const allocator_type& allocator)
+: d_impl(allocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                                 const flat_hash_set& original)
+: d_impl(original.d_impl)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                               const flat_hash_set&  original,
+                                               const allocator_type& allocator)
+: d_impl(original.d_impl, allocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::flat_hash_set(
+                                      INPUT_ITERATOR        first,
+                                      INPUT_ITERATOR        last,
+                                      size_type             initialNumElements,
+                                      const hasher&         hash,
+                                      const key_equal&      keyEqual,
+                                      const allocator_type& allocator)
+: d_impl(hash, keyEqual, initialNumElements, allocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::~flat_hash_set()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>&
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::operator=(const flat_hash_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
+                                                  const_iterator last)
+{
+    // Erasing an element does not move the other elements, so 'last' remains
+    // valid throughout.
+
+    while (first != last) {
+        first = this->erase(first);
+    }
+
+    return last;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator,
+                                                   const value_type& value)
+{
+    // The position of an element is determined by its hash, so the 'hint' is
+    // of no use.
+
+    return d_impl.insert(value).first;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    size_type maxInsertions =
+            ::BloombergLP::bslstl::IteratorUtil::insertDistance(first, last);
+    if (maxInsertions) {
+        this->reserve(this->size() + maxInsertions);
+    }
+
+    while (first != last) {
+        d_impl.insert(*first);
+        ++first;
+    }
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator,
+          typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(const key_type& key)
+{
+    typedef bsl::pair<iterator, iterator> ResultType;
+
+    iterator first = d_impl.find(key);
+    if (first == d_impl.end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::rehash(size_type minCapacity)
+{
+    d_impl.rehash(minCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::swap(flat_hash_set& other)
+{
+    BSLS_ASSERT_SAFE(this->get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
+          typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator>
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+    const_iterator first = d_impl.find(key);
+    if (first == d_impl.end()) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    const_iterator last = first;
+    return ResultType(first, ++last);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+ALLOCATOR flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+HASH flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+EQUAL flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::key_eq() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+float flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& lhs,
+                    const bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& a,
+               bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'flat_hash_set':
+//: o A 'flat_hash_set' defines STL iterators.
+//: o A 'flat_hash_set' is bit-wise moveable if both functors and the
+//:   allocator are bit-wise moveable.
+//: o A 'flat_hash_set' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_hash_set<KEY, HASH, EQUAL, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
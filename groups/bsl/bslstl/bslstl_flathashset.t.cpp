@@ -0,0 +1,553 @@
+// bslstl_flathashset.t.cpp                                           -*-C++-*-
+#include <bslstl_flathashset.h>
+
+#include <bslstl_unorderedset.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over
+// 'bslstl::FlatHashTable', which is tested thoroughly in its own component.
+// Accordingly, this test driver concentrates on the forwarding of each method
+// to the underlying table, and on the type traits.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_hash_set(size_type, const hasher&, const key_equal&, ALLOC);
+// [ 2] flat_hash_set(const allocator_type& allocator);
+// [ 3] flat_hash_set(const flat_hash_set& original);
+// [ 3] flat_hash_set(const flat_hash_set&, const allocator_type&);
+// [ 2] flat_hash_set(INPUT_ITERATOR, INPUT_ITERATOR, size_type, ...);
+// [ 2] ~flat_hash_set();
+//
+// MANIPULATORS
+// [ 3] flat_hash_set& operator=(const flat_hash_set& rhs);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] void clear();
+// [ 2] iterator erase(const_iterator position);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const key_type& key);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 2] void rehash(size_type minCapacity);
+// [ 2] void reserve(size_type numElements);
+// [ 3] void swap(flat_hash_set& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] size_type size() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_hash_set&, const flat_hash_set&);
+// [ 3] bool operator!=(const flat_hash_set&, const flat_hash_set&);
+// [ 3] void swap(flat_hash_set& a, flat_hash_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_set<int> Obj;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to determine the distinct values in a sequence of integers.
+// We can insert them into a 'flat_hash_set', which ignores duplicates:
+//..
+    static const int DATA[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    bslma::TestAllocator    oa("object");
+    bsl::flat_hash_set<int> distinct(DATA, DATA + NUM_DATA, 0,
+                                     bsl::hash<int>(), bsl::equal_to<int>(),
+                                     &oa);
+
+    ASSERT(7 == distinct.size());
+    ASSERT(1 == distinct.count(9));
+    ASSERT(0 == distinct.count(7));
+//..
+// Notice that the set reserved enough capacity for all of the input values
+// before inserting them, so that it allocated exactly once:
+//..
+    ASSERT(1 == oa.numBlocksTotal());
+//..
+// Finally, we remove the odd values:
+//..
+    for (bsl::flat_hash_set<int>::iterator it = distinct.begin();
+         it != distinct.end(); ) {
+        if (*it % 2) {
+            it = distinct.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    ASSERT(3 == distinct.size());
+    ASSERT(1 == distinct.count(2));
+    ASSERT(1 == distinct.count(4));
+    ASSERT(1 == distinct.count(6));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values, and do not change
+        //:   allocators.
+        //:
+        //: 3 Sets compare equal if and only if they have the same elements,
+        //:   regardless of insertion order and capacity.
+        //
+        // Plan:
+        //: 1 Create sets with various values, copy, assign, swap and compare
+        //:   them.  (C-1..3)
+        //
+        // Testing:
+        //   flat_hash_set(const flat_hash_set& original);
+        //   flat_hash_set(const flat_hash_set&, const allocator_type&);
+        //   flat_hash_set& operator=(const flat_hash_set& rhs);
+        //   void swap(flat_hash_set& other);
+        //   bool operator==(const flat_hash_set&, const flat_hash_set&);
+        //   bool operator!=(const flat_hash_set&, const flat_hash_set&);
+        //   void swap(flat_hash_set& a, flat_hash_set& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          "\n============================================\n");
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(i);
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            Obj mW(1000, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& W = mW;
+            for (int i = 49; 0 <= i; --i) {
+                mW.insert(i);
+            }
+            ASSERTV(X.capacity() != W.capacity());
+            ASSERTV(X == W);
+            ASSERTV(!(X != W));
+
+            mW.erase(3);
+            mW.insert(-3);
+            ASSERTV(X != W);
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW.insert(100);
+            mZ.swap(mW);
+            ASSERTV(51 == Z.size());
+            ASSERTV(50 == W.size());
+            ASSERTV(1 == Z.count(100));
+
+            bsl::swap(mZ, mW);
+            ASSERTV(50 == Z.size());
+            ASSERTV(51 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified allocator, and allocates
+        //:   only if an initial number of elements or a non-empty range is
+        //:   supplied.
+        //:
+        //: 2 Each 'insert' overload inserts an element only if it is absent,
+        //:   and returns the documented value.
+        //:
+        //: 3 The lookup methods find exactly the inserted elements.
+        //:
+        //: 4 Each 'erase' overload removes the specified elements and returns
+        //:   the documented value.
+        //:
+        //: 5 'clear', 'reserve', and 'rehash' forward to the table.
+        //:
+        //: 6 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct sets with each constructor, insert, look up, and erase
+        //:   elements, and verify the results and the memory used.  (C-1..5)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-6)
+        //
+        // Testing:
+        //   flat_hash_set(size_type, const hasher&, const key_equal&, ALLOC);
+        //   flat_hash_set(const allocator_type& allocator);
+        //   flat_hash_set(INPUT_ITERATOR, INPUT_ITERATOR, size_type, ...);
+        //   ~flat_hash_set();
+        //   iterator begin();
+        //   iterator end();
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const key_type& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   void rehash(size_type minCapacity);
+        //   void reserve(size_type numElements);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   size_type capacity() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   size_type size() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING PRIMARY MANIPULATORS AND ACCESSORS"
+                            "\n==========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Obj::iterator,
+                                   Obj::const_iterator>::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(0 == A.capacity());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            Obj mC(100, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& C = mC;
+            ASSERTV(100 <= static_cast<float>(C.capacity())
+                                                 * C.max_load_factor());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            static const int DATA[] = { 5, 3, 5, 7, 3, 1 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mD(DATA, DATA + NUM_DATA, 0, bsl::hash<int>(),
+                   bsl::equal_to<int>(), &oa);
+            const Obj& D = mD;
+            ASSERTV(4 == D.size());
+            ASSERTV(2 == oa.numBlocksInUse());
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion, lookup, and erasure.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 300; ++i) {
+                bsl::pair<Obj::iterator, bool> r = mX.insert(i);
+                ASSERTV(i, r.second);
+                ASSERTV(i, i == *r.first);
+
+                r = mX.insert(i);
+                ASSERTV(i, !r.second);
+                ASSERTV(i, i == *r.first);
+
+                ASSERTV(i, r.first == mX.insert(X.begin(), i));
+            }
+            ASSERTV(300 == X.size());
+
+            for (int i = -50; i < 350; ++i) {
+                const bool PRESENT = 0 <= i && i < 300;
+
+                ASSERTV(i, PRESENT == (1 == X.count(i)));
+                ASSERTV(i, PRESENT == (X.end() != X.find(i)));
+                ASSERTV(i, PRESENT == (mX.end() != mX.find(i)));
+
+                bsl::pair<Obj::iterator, Obj::iterator> r = mX.equal_range(i);
+                ASSERTV(i, PRESENT == (r.first != r.second));
+                ASSERTV(i, r == X.equal_range(i));
+            }
+
+            int sum = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                sum += *it;
+            }
+            ASSERTV(sum, 299 * 300 / 2 == sum);
+
+            int values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = 290 + i;
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(310 == X.size());
+
+            ASSERTV(1 == mX.erase(0));
+            ASSERTV(0 == mX.erase(0));
+
+            Obj::iterator it   = mX.find(1);
+            Obj::iterator next = it;
+            ++next;
+            ASSERTV(next == mX.erase(it));
+
+            Obj::const_iterator first = X.begin();
+            Obj::const_iterator last  = first;
+            for (int i = 0; i < 8; ++i) {
+                ++last;
+            }
+            ASSERTV(last == mX.erase(first, last));
+            ASSERTV(300 == X.size());
+
+            const Obj::size_type CAPACITY = X.capacity();
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(CAPACITY == X.capacity());
+
+            mX.rehash(0);
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == oa.numBlocksInUse());
+
+            mX.reserve(500);
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 500; ++i) {
+                mX.insert(i);
+            }
+            ASSERTV(oam.isTotalSame());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase elements, and compare the results with
+        //:   those of a 'bsl::unordered_set'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj                     mX(&oa);
+            bsl::unordered_set<int> mY(&oa);
+
+            unsigned int seed = 54321;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 2000);
+
+                switch (seed % 3) {
+                  case 0: {
+                    ASSERTV(i, mY.insert(KEY).second ==
+                                                      mX.insert(KEY).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
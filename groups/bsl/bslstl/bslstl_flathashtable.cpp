@@ -0,0 +1,71 @@
+// bslstl_flathashtable.cpp                                           -*-C++-*-
+#include <bslstl_flathashtable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslstl_equalto.h>                      // for testing only
+#include <bslstl_hash.h>                         // for testing only
+#include <bslstl_unorderedmapkeyconfiguration.h> // for testing only
+#include <bslstl_unorderedsetkeyconfiguration.h> // for testing only
+
+namespace BloombergLP {
+namespace bslstl {
+
+namespace {
+
+const signed char s_emptyControls = FlatHashTable_ImpUtil::SENTINEL;
+    // Control bytes of every table having no capacity.
+
+}  // close unnamed namespace
+
+                        // ----------------------------
+                        // struct FlatHashTable_ImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+std::size_t FlatHashTable_ImpUtil::capacityForSize(std::size_t numElements)
+{
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    std::size_t capacity = GROUP_SIZE;
+    while (growthForCapacity(capacity) < numElements) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+signed char *FlatHashTable_ImpUtil::emptyControls()
+{
+    // The returned control bytes are never modified: a table having no
+    // capacity allocates storage before inserting an element.
+
+    return const_cast<signed char *>(&s_emptyControls);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
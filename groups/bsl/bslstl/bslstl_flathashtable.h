@@ -0,0 +1,1792 @@
+// bslstl_flathashtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#define INCLUDED_BSLSTL_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressing hash table storing values inline.
+//
+//@CLASSES:
+//  bslstl::FlatHashTable: open-addressing hash table with unique keys
+//  bslstl::FlatHashTableIterator: forward iterator over a 'FlatHashTable'
+//  bslstl::FlatHashTable_Group: control bytes of a group of table slots
+//  bslstl::FlatHashTable_ImpUtil: namespace for implementation utilities
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashset, bslstl_hashtable
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslstl::FlatHashTable', implementing a hash table having unique keys that
+// stores its elements directly in a single contiguous array of "slots",
+// resolving collisions by open addressing.  'FlatHashTable' is the
+// implementation underlying 'bsl::flat_hash_map' and 'bsl::flat_hash_set', in
+// the same way that 'bslstl::HashTable' underlies 'bsl::unordered_map' and
+// 'bsl::unordered_set'.
+//
+// Unlike 'bslstl::HashTable', which allocates one node per element and links
+// all of the nodes into a list, a 'FlatHashTable' performs (at most) one
+// allocation per rehash and no allocations per element (other than those
+// performed by the elements themselves).  A successful lookup typically
+// touches one cache line of control bytes and one slot, rather than a bucket,
+// a chain of nodes, and the elements in those nodes.  The cost of this layout
+// is that inserting an element, and rehashing, may move other elements;
+// consequently, *all* iterators, pointers and references to the elements of a
+// 'FlatHashTable' are invalidated by any insertion that causes a rehash.
+// Erasing an element does not move the other elements of the table.
+//
+// The key of each element is extracted using the 'KEY_CONFIG' template
+// parameter, which has the same requirements as for 'bslstl::HashTable' (see
+// 'bslstl_unorderedmapkeyconfiguration' and
+// 'bslstl_unorderedsetkeyconfiguration').  Memory is supplied by the
+// 'ALLOCATOR' template parameter, which must meet the requirements of a
+// standard allocator; when 'ALLOCATOR' is 'bsl::allocator', the table and its
+// elements use the 'bslma::Allocator' protocol.
+//
+///Table Layout
+///------------
+// The table consists of 'capacity()' slots, where 'capacity()' is either 0 or
+// a power of two no smaller than 16, and, parallel to the slots, an array of
+// one-byte "control" values describing the state of each slot.  A control
+// byte is 'EMPTY' for a slot that has never been occupied since the last
+// rehash, 'DELETED' for a slot whose element was erased (a "tombstone"), and,
+// for an occupied slot, holds 7 bits (called "H2") of the hash of the
+// element's key.  The slots and control bytes are divided into groups of 16.
+// An additional 'SENTINEL' control byte follows the last group to terminate
+// iteration.
+//
+// The remaining bits of the hash (called "H1") select the first group in
+// which to look for a key.  Groups are visited according to a triangular
+// probe sequence (i.e., the groups at offsets 0, 1, 3, 6, 10, ... from the
+// first group, modulo the number of groups), which visits every group exactly
+// once because the number of groups is a power of two.  Within a group, the
+// 16 control bytes are compared against H2 in parallel (using a single SSE2
+// instruction on platforms that support it), and only the slots whose control
+// byte matches are compared against the key.  A lookup terminates at the
+// first group that contains an 'EMPTY' slot.
+//
+// The table is rehashed when an insertion would leave fewer than one eighth
+// of its slots 'EMPTY' (i.e., the maximum load factor is 0.875, counting
+// tombstones).  If at least 3/32 of the slots are tombstones, the table is
+// rehashed in place to the same capacity; otherwise, its capacity is doubled.
+// When an element is erased from a group that contains an 'EMPTY' slot, no
+// probe sequence can have passed through that group, and so its slot is
+// marked 'EMPTY' rather than 'DELETED'.
+//
+// Since the elements of the table are accessed by lookups only through the
+// H1 and H2 bits of their hashes, the hash values supplied by 'HASHER' are
+// first "mixed" (multiplied by a large odd constant and folded) so that hash
+// functions that are the identity (e.g., 'bsl::hash<int>') still distribute
+// keys well among groups and control bytes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Set of Integers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to implement a simple set of 'int' values with fast lookup.
+// We can use a 'FlatHashTable' configured to use the entire element as its
+// key:
+//..
+//  typedef bslstl::FlatHashTable<
+//                            bslstl::UnorderedSetKeyConfiguration<const int>,
+//                            bsl::hash<int>,
+//                            bsl::equal_to<int>,
+//                            bsl::allocator<int> > IntTable;
+//..
+// Next, we create a table, supplying a test allocator:
+//..
+//  bslma::TestAllocator oa("object");
+//  IntTable             table(&oa);
+//  assert(0 == table.size());
+//  assert(0 == table.capacity());
+//  assert(0 == oa.numBlocksInUse());
+//..
+// Notice that no memory is allocated until the first insertion.  Then, we
+// insert some values, noting that a value that is already present is not
+// inserted again:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      bsl::pair<IntTable::Iterator, bool> result = table.insert(i % 50);
+//      assert((i < 50) == result.second);
+//      assert(i % 50   == *result.first);
+//  }
+//  assert(50 == table.size());
+//  assert(1  == oa.numBlocksInUse());
+//..
+// Notice that all of the elements are held in a single block of memory.
+// Finally, we look up and erase some values:
+//..
+//  assert(table.end() != table.find(7));
+//  assert(table.end() == table.find(77));
+//
+//  assert(1 == table.erase(7));
+//  assert(0 == table.erase(7));
+//  assert(table.end() == table.find(7));
+//  assert(49 == table.size());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DESTRUCTORGUARD
+#include <bslma_destructorguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECVQ
+#include <bslmf_removecvq.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BSLSTL_FLATHASHTABLE_SSE2 1
+
+#ifndef INCLUDED_EMMINTRIN
+#include <emmintrin.h>
+#define INCLUDED_EMMINTRIN
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ============================
+                        // struct FlatHashTable_ImpUtil
+                        // ============================
+
+struct FlatHashTable_ImpUtil {
+    // This 'struct' provides a namespace for constants and utility functions
+    // used in the implementation of 'FlatHashTable' that do not depend on its
+    // template parameters.
+
+    // TYPES
+    enum {
+        GROUP_SIZE = 16    // number of slots (and control bytes) in a group
+    };
+
+    enum ControlValue {
+        // Values of a control byte other than those of an occupied slot, each
+        // of which is in the range '[0 .. 127]'.
+
+        EMPTY    = -128,   // slot has been empty since the last rehash
+        DELETED  =   -2,   // slot was emptied by erasing an element
+        SENTINEL =   -1    // marks the end of the control bytes
+    };
+
+    // CLASS METHODS
+    static std::size_t capacityForSize(std::size_t numElements);
+        // Return the smallest capacity (i.e., 0, or a power of two no smaller
+        // than 'GROUP_SIZE') of a table that can hold the specified
+        // 'numElements' without exceeding the maximum load factor.
+
+    static int countTrailingZeros(unsigned int mask);
+        // Return the index of the least significant bit set in the specified
+        // 'mask'.  The behavior is undefined unless '0 != mask'.
+
+    static signed char *emptyControls();
+        // Return the address of the control bytes shared by all tables having
+        // no capacity, which consist of a single 'SENTINEL' value.  The
+        // behavior is undefined if the returned control byte is modified.
+
+    static std::size_t growthForCapacity(std::size_t capacity);
+        // Return the number of elements that a table having the specified
+        // 'capacity', and no elements or tombstones, can hold without
+        // exceeding the maximum load factor.
+
+    static std::size_t mix(std::size_t hashValue);
+        // Return a value computed from the specified 'hashValue' such that
+        // each bit of the result depends on many bits of 'hashValue'.
+};
+
+                        // =========================
+                        // class FlatHashTable_Group
+                        // =========================
+
+class FlatHashTable_Group {
+    // This class provides a view of the control bytes of one group of
+    // 'FlatHashTable_ImpUtil::GROUP_SIZE' slots, and methods to find those
+    // control bytes having particular values.  Each method returns a mask in
+    // which bit 'i' is set if control byte 'i' of the group satisfies the
+    // condition.
+
+    // DATA
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    __m128i            d_controls;    // control bytes of the group
+#else
+    const signed char *d_controls_p;  // control bytes of the group
+#endif
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_Group(const signed char *controls);
+        // Create a view of the 'GROUP_SIZE' control bytes starting at the
+        // specified 'controls' address.
+
+    // ACCESSORS
+    unsigned int match(signed char h2) const;
+        // Return a mask of the control bytes in this group having the
+        // specified 'h2' value.
+
+    unsigned int matchAvailable() const;
+        // Return a mask of the control bytes in this group that are either
+        // 'EMPTY' or 'DELETED'.
+
+    unsigned int matchEmpty() const;
+        // Return a mask of the control bytes in this group that are 'EMPTY'.
+
+    unsigned int matchFull() const;
+        // Return a mask of the control bytes in this group that indicate an
+        // occupied slot.
+};
+
+                        // ===========================
+                        // class FlatHashTableIterator
+                        // ===========================
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+class FlatHashTableIterator {
+    // This class template implements an in-core value semantic type that is a
+    // standard-conforming forward iterator (see section 24.2.5
+    // [forward.iterators] of the C++11 standard) over the elements of a
+    // 'FlatHashTable'.  The (template parameter) 'DIFFERENCE_TYPE' determines
+    // the standard mandated 'difference_type' of the iterator.
+
+    // PRIVATE TYPES
+    typedef typename bslmf::RemoveCvq<VALUE_TYPE>::Type    NcType;
+    typedef FlatHashTableIterator<NcType, DIFFERENCE_TYPE> NcIter;
+
+  public:
+    // PUBLIC TYPES
+    typedef NcType                      value_type;
+    typedef DIFFERENCE_TYPE             difference_type;
+    typedef VALUE_TYPE                 *pointer;
+    typedef VALUE_TYPE&                 reference;
+    typedef bsl::forward_iterator_tag   iterator_category;
+        // Standard iterator defined types [24.4.2].
+
+  private:
+    // DATA
+    const signed char *d_control_p;  // control byte of the current slot
+    NcType            *d_slot_p;     // current slot
+
+  public:
+    // CREATORS
+    FlatHashTableIterator();
+        // Create a default-constructed iterator.  All default-constructed
+        // iterators are non-dereferenceable and compare equal.
+
+    FlatHashTableIterator(const signed char *control, NcType *slot);
+        // Create an iterator referring to the specified 'slot' having the
+        // specified 'control' byte.  The behavior is undefined unless
+        // 'control' refers to either the control byte of an occupied slot of
+        // a 'FlatHashTable', or the 'SENTINEL' following the control bytes of
+        // such a table.  Note that this constructor is an implementation
+        // detail and is not part of the C++ standard.
+
+    FlatHashTableIterator(const NcIter& original);                  // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // iterator.  Note that this constructor enables converting from
+        // modifiable to 'const' iterator types.
+
+    //! FlatHashTableIterator(const FlatHashTableIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.  Note that this operation is either defined by the
+        // constructor taking 'NcIter' (if 'NcType' is the same as
+        // 'VALUE_TYPE'), or generated automatically by the compiler.
+
+    //! ~FlatHashTableIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTableIterator& operator=(const FlatHashTableIterator&) =
+    //!                                                                default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    FlatHashTableIterator& operator++();
+        // Move this iterator to the next element in the table and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to an element in
+        // the table.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element in the table.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator refers
+        // to an element in the table.
+
+    const signed char *control() const;
+        // Return the address of the control byte of the slot at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+
+    NcType *slot() const;
+        // Return the address of the slot at which this iterator is
+        // positioned.  Note that this method is an implementation detail and
+        // is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+bool operator==(
+             const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+             const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators have the same
+    // value, and 'false' otherwise.  Two iterators have the same value if
+    // they refer to the same slot of the same table, or are both
+    // default-constructed.  The behavior is undefined unless 'VALUE_TYPE1'
+    // and 'VALUE_TYPE2' differ by at most their 'const' qualification.
+
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+bool operator!=(
+             const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+             const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not have
+    // the same value, and 'false' otherwise.  Two iterators do not have the
+    // same value if they refer to different slots, or exactly one of them is
+    // default-constructed.  The behavior is undefined unless 'VALUE_TYPE1'
+    // and 'VALUE_TYPE2' differ by at most their 'const' qualification.
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next element in the table and return
+    // the value of 'iter' prior to this call.  The behavior is undefined
+    // unless 'iter' refers to an element in the table.
+
+                        // ===================
+                        // class FlatHashTable
+                        // ===================
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+class FlatHashTable {
+    // This class template implements a value-semantic container holding
+    // elements of type 'KEY_CONFIG::ValueType' having unique keys (of type
+    // 'KEY_CONFIG::KeyType', extracted by 'KEY_CONFIG::extractKey'), stored
+    // inline in an open-addressing hash table as described in the component
+    // documentation.  Keys are hashed using the (template parameter) type
+    // 'HASHER' and compared using the (template parameter) type 'COMPARATOR'.
+    // Memory is supplied by the (template parameter) type 'ALLOCATOR'.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType                  KeyType;
+    typedef typename KEY_CONFIG::ValueType                ValueType;
+    typedef ALLOCATOR                                     AllocatorType;
+    typedef bsl::allocator_traits<ALLOCATOR>              AllocatorTraits;
+    typedef typename AllocatorTraits::size_type           SizeType;
+    typedef typename AllocatorTraits::difference_type     DifferenceType;
+
+    typedef typename bslmf::RemoveCvq<ValueType>::Type    StoredType;
+        // Type of the objects held in the slots of the table.  Note that
+        // 'ValueType' is 'const'-qualified when the elements of the table must
+        // not be modified through its iterators (e.g., by
+        // 'bsl::flat_hash_set').
+
+    typedef FlatHashTableIterator<ValueType, DifferenceType>
+                                                          Iterator;
+    typedef FlatHashTableIterator<const ValueType, DifferenceType>
+                                                          ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable_ImpUtil                         ImpUtil;
+    typedef FlatHashTable_Group                           Group;
+
+    typedef typename AllocatorTraits::template
+            rebind_traits<bsls::AlignmentUtil::MaxAlignedType>
+                                                          StorageTraits;
+    typedef typename StorageTraits::allocator_type        StorageAllocator;
+
+    // DATA
+    ALLOCATOR    d_allocator;     // allocator for elements and storage
+    HASHER       d_hasher;        // hash functor
+    COMPARATOR   d_comparator;    // key-equality functor
+    signed char *d_controls_p;    // 'd_capacity' control bytes, followed by
+                                  // a 'SENTINEL', at the start of the storage
+                                  // of this table (or 'emptyControls()')
+    StoredType  *d_slots_p;       // 'd_capacity' slots (or 0)
+    SizeType     d_capacity;      // number of slots
+    SizeType     d_size;          // number of elements
+    SizeType     d_growthLeft;    // number of 'EMPTY' slots that may be
+                                  // filled before a rehash is required
+
+  private:
+    // PRIVATE CLASS METHODS
+    static SizeType controlsSize(SizeType capacity);
+        // Return the number of bytes, rounded up to maximal alignment, of the
+        // control bytes of a table having the specified 'capacity'.
+
+    static SizeType storageSize(SizeType capacity);
+        // Return the number of 'bsls::AlignmentUtil::MaxAlignedType' objects
+        // in the storage of a table having the specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void allocateStorage(SizeType capacity);
+        // Allocate storage for the specified 'capacity' slots and their
+        // control bytes, and make it the (empty) storage of this table.  The
+        // behavior is undefined unless this table has no capacity and
+        // 'capacity' is a power of two no smaller than 'GROUP_SIZE'.
+
+    void commitInsert(SizeType index, std::size_t hash);
+        // Record that the slot at the specified 'index', which was prepared by
+        // 'prepareInsert' for an element having the specified 'hash', is now
+        // occupied.
+
+    void copyElements(const FlatHashTable& original);
+        // Make this table, which must have no capacity, a copy of the
+        // specified 'original' having the same capacity and layout.
+
+    void destroyElements();
+        // Destroy all of the elements of this table without modifying the
+        // control bytes.
+
+    void eraseAt(SizeType index);
+        // Destroy the element in the slot at the specified 'index' and mark
+        // that slot as no longer occupied.
+
+    SizeType prepareInsert(std::size_t hash);
+        // Return the index of a slot in which an element having the specified
+        // 'hash' can be inserted, rehashing this table if required.  The
+        // behavior is undefined unless no element having the key of the
+        // element to be inserted is in this table.  Note that the slot is not
+        // marked as occupied until 'commitInsert' is called.
+
+    void rehashImp(SizeType newCapacity);
+        // Move the elements of this table into new storage having the
+        // specified 'newCapacity'.  The behavior is undefined unless
+        // 'newCapacity' is a power of two no smaller than 'GROUP_SIZE' and
+        // large enough to hold 'size()' elements.
+
+    void swapStorage(FlatHashTable& other);
+        // Exchange the storage and elements (but not the functors or the
+        // allocator) of this table with those of the specified 'other' table.
+
+    // PRIVATE ACCESSORS
+    SizeType findAvailable(std::size_t hash) const;
+        // Return the index of the first 'EMPTY' or 'DELETED' slot in the
+        // probe sequence for the specified 'hash'.  The behavior is undefined
+        // unless this table has capacity.
+
+    SizeType findIndex(const KeyType& key, std::size_t hash) const;
+        // Return the index of the slot holding the element having the
+        // specified 'key', whose hash is the specified 'hash', or 'capacity()'
+        // if there is no such element.
+
+    std::size_t hashCode(const KeyType& key) const;
+        // Return the mixed hash of the specified 'key'.
+
+    SizeType nextFull(SizeType index) const;
+        // Return the index of the first occupied slot at or after the
+        // specified 'index', or 'capacity()' if there is no such slot.
+
+  public:
+    // CREATORS
+    explicit FlatHashTable(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty table having no capacity.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not
+        // specified, a default-constructed allocator is used.  Use
+        // default-constructed 'HASHER' and 'COMPARATOR' objects.
+
+    FlatHashTable(const HASHER&     hash,
+                  const COMPARATOR& compare,
+                  SizeType          initialNumElements,
+                  const ALLOCATOR&  allocator);
+        // Create an empty table that can hold at least the specified
+        // 'initialNumElements' without rehashing, using the specified 'hash'
+        // and 'compare' functors, and using the specified 'allocator' to
+        // supply memory.  If 'initialNumElements' is 0, no memory is
+        // allocated.
+
+    FlatHashTable(const FlatHashTable& original);
+        // Create a table having the same value and functors as the specified
+        // 'original', using the allocator returned by
+        // 'AllocatorTraits::select_on_container_copy_construction' applied to
+        // the allocator of 'original' to supply memory.  If 'original' is not
+        // empty, the new table has the same capacity as 'original'.
+
+    FlatHashTable(const FlatHashTable& original, const ALLOCATOR& allocator);
+        // Create a table having the same value and functors as the specified
+        // 'original', using the specified 'allocator' to supply memory.  If
+        // 'original' is not empty, the new table has the same capacity as
+        // 'original'.
+
+    ~FlatHashTable();
+        // Destroy this table and its elements.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value and functors of the specified 'rhs',
+        // and return a reference providing modifiable access to this table.
+        // The allocator of this table is not changed.  If an exception is
+        // thrown, this table is unchanged.
+
+    Iterator begin();
+        // Return an iterator referring to the first element of this table, or
+        // 'end()' if this table is empty.
+
+    Iterator end();
+        // Return an iterator referring to the past-the-end position of this
+        // table.
+
+    Iterator erase(ConstIterator position);
+        // Remove the element at the specified 'position' from this table, and
+        // return an iterator referring to the element following it (or
+        // 'end()').  The behavior is undefined unless 'position' refers to an
+        // element of this table.  Note that no other iterators are
+        // invalidated.
+
+    SizeType erase(const KeyType& key);
+        // Remove the element having the specified 'key' from this table, if
+        // such an element exists.  Return the number of elements removed
+        // (either 0 or 1).
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the element of this table having
+        // the specified 'key', or 'end()' if there is no such element.
+
+    bsl::pair<Iterator, bool> insert(const ValueType& value);
+        // Insert a copy of the specified 'value' into this table if no
+        // element having the same key is present.  Return a pair whose 'first'
+        // member refers to the element having the key of 'value', and whose
+        // 'second' member is 'true' if 'value' was inserted and 'false'
+        // otherwise.  If an exception is thrown, this table is unchanged.
+
+    template <class SOURCE_TYPE>
+    bsl::pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+        // Insert a 'ValueType' object created from the specified 'value' into
+        // this table if no element having the same key is present.  Return a
+        // pair whose 'first' member refers to the element having the key of
+        // the created object, and whose 'second' member is 'true' if it was
+        // inserted and 'false' otherwise.  If an exception is thrown, this
+        // table is unchanged.
+
+    Iterator insertIfMissing(const KeyType& key);
+        // Return an iterator referring to the element of this table having
+        // the specified 'key', first inserting an element created from 'key'
+        // and a default-constructed 'ValueType::second_type' if no such
+        // element is present.  If an exception is thrown, this table is
+        // unchanged.  Note that this method is available only if 'ValueType'
+        // is a pair.
+
+    void rehash(SizeType minCapacity);
+        // Rehash this table so that it has capacity of at least the specified
+        // 'minCapacity', and enough capacity to hold 'size()' elements, and
+        // remove all tombstones.  Note that the capacity of this table may be
+        // reduced by this call.
+
+    void removeAll();
+        // Destroy all elements of this table, leaving it empty.  Note that
+        // the capacity of this table is not changed.
+
+    void reserve(SizeType numElements);
+        // Increase the capacity of this table, if necessary, so that it can
+        // hold at least the specified 'numElements' without rehashing.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value and functors of this table with those of the
+        // specified 'other' table.  The behavior is undefined unless this
+        // table and 'other' use equal allocators.
+
+    // ACCESSORS
+    const ALLOCATOR& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // of this table.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first element of this table, or
+        // 'end()' if this table is empty.
+
+    SizeType capacity() const;
+        // Return the number of slots in this table.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // key-equality functor of this table.
+
+    ConstIterator end() const;
+        // Return an iterator referring to the past-the-end position of this
+        // table.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the element of this table having
+        // the specified 'key', or 'end()' if there is no such element.
+
+    const HASHER& hasher() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    float loadFactor() const;
+        // Return the ratio of the number of elements of this table to its
+        // capacity, or 0 if it has no capacity.
+
+    float maxLoadFactor() const;
+        // Return the maximum load factor of this table, 0.875.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of elements this
+        // table could hold.
+
+    SizeType size() const;
+        // Return the number of elements in this table.
+};
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator==(
+       const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+       const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of elements, and for each element of 'lhs' there
+    // is an element of 'rhs' having the same key that compares equal to it
+    // using 'operator=='.
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool operator!=(
+       const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+       const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void swap(FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& a,
+          FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and functors of the specified 'a' and 'b' tables.
+    // The behavior is undefined unless 'a' and 'b' use equal allocators.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashTable_ImpUtil
+                        // ----------------------------
+
+// CLASS METHODS
+inline
+int FlatHashTable_ImpUtil::countTrailingZeros(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int result = 0;
+    while (0 == (mask & 1)) {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+inline
+std::size_t FlatHashTable_ImpUtil::growthForCapacity(std::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+inline
+std::size_t FlatHashTable_ImpUtil::mix(std::size_t hashValue)
+{
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+    bsls::Types::Uint64 result = static_cast<bsls::Types::Uint64>(hashValue)
+                               * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(result ^ (result >> 32));
+#else
+    unsigned int result = static_cast<unsigned int>(hashValue) * 0x9E3779B9U;
+    return static_cast<std::size_t>(result ^ (result >> 16));
+#endif
+}
+
+                        // -------------------------
+                        // class FlatHashTable_Group
+                        // -------------------------
+
+// CREATORS
+inline
+FlatHashTable_Group::FlatHashTable_Group(const signed char *controls)
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+: d_controls(_mm_loadu_si128(reinterpret_cast<const __m128i *>(controls)))
+#else
+: d_controls_p(controls)
+#endif
+{
+    BSLS_ASSERT_SAFE(controls);
+}
+
+// ACCESSORS
+inline
+unsigned int FlatHashTable_Group::match(signed char h2) const
+{
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), d_controls));
+#else
+    unsigned int result = 0;
+    for (int i = 0; i < FlatHashTable_ImpUtil::GROUP_SIZE; ++i) {
+        result |= static_cast<unsigned int>(h2 == d_controls_p[i]) << i;
+    }
+    return result;
+#endif
+}
+
+inline
+unsigned int FlatHashTable_Group::matchAvailable() const
+{
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    return _mm_movemask_epi8(_mm_cmplt_epi8(
+                       d_controls,
+                       _mm_set1_epi8(static_cast<char>(
+                                         FlatHashTable_ImpUtil::SENTINEL))));
+#else
+    unsigned int result = 0;
+    for (int i = 0; i < FlatHashTable_ImpUtil::GROUP_SIZE; ++i) {
+        result |= static_cast<unsigned int>(
+                      d_controls_p[i] < FlatHashTable_ImpUtil::SENTINEL) << i;
+    }
+    return result;
+#endif
+}
+
+inline
+unsigned int FlatHashTable_Group::matchEmpty() const
+{
+    return match(static_cast<signed char>(FlatHashTable_ImpUtil::EMPTY));
+}
+
+inline
+unsigned int FlatHashTable_Group::matchFull() const
+{
+#if defined(BSLSTL_FLATHASHTABLE_SSE2)
+    return ~static_cast<unsigned int>(_mm_movemask_epi8(d_controls)) & 0xFFFF;
+#else
+    unsigned int result = 0;
+    for (int i = 0; i < FlatHashTable_ImpUtil::GROUP_SIZE; ++i) {
+        result |= static_cast<unsigned int>(0 <= d_controls_p[i]) << i;
+    }
+    return result;
+#endif
+}
+
+                        // ---------------------------
+                        // class FlatHashTableIterator
+                        // ---------------------------
+
+// CREATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator()
+: d_control_p(0)
+, d_slot_p(0)
+{
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                  const signed char *control,
+                                                  NcType            *slot)
+: d_control_p(control)
+, d_slot_p(slot)
+{
+    BSLS_ASSERT_SAFE(control);
+    BSLS_ASSERT_SAFE(0 <= *control
+                  || FlatHashTable_ImpUtil::SENTINEL == *control);
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::FlatHashTableIterator(
+                                                        const NcIter& original)
+: d_control_p(original.control())
+, d_slot_p(original.slot())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>&
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(0 <= *d_control_p);
+
+    do {
+        ++d_control_p;
+        ++d_slot_p;
+    } while (*d_control_p < FlatHashTable_ImpUtil::SENTINEL);
+
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::reference
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(0 <= *d_control_p);
+
+    return *d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::pointer
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_control_p);
+    BSLS_ASSERT_SAFE(0 <= *d_control_p);
+
+    return d_slot_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+const signed char *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::control() const
+{
+    return d_control_p;
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+typename FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::NcType *
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>::slot() const
+{
+    return d_slot_p;
+}
+
+// FREE OPERATORS
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+inline
+bool operator==(
+              const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() == rhs.control();
+}
+
+template <class VALUE_TYPE1, class VALUE_TYPE2, class DIFFERENCE_TYPE>
+inline
+bool operator!=(
+              const FlatHashTableIterator<VALUE_TYPE1, DIFFERENCE_TYPE>& lhs,
+              const FlatHashTableIterator<VALUE_TYPE2, DIFFERENCE_TYPE>& rhs)
+{
+    return lhs.control() != rhs.control();
+}
+
+template <class VALUE_TYPE, class DIFFERENCE_TYPE>
+inline
+FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>
+operator++(FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE>& iter, int)
+{
+    FlatHashTableIterator<VALUE_TYPE, DIFFERENCE_TYPE> temp(iter);
+    ++iter;
+    return temp;
+}
+
+                        // -------------------
+                        // class FlatHashTable
+                        // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::controlsSize(
+                                                             SizeType capacity)
+{
+    return static_cast<SizeType>(
+                bsls::AlignmentUtil::roundUpToMaximalAlignment(capacity + 1));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::storageSize(
+                                                             SizeType capacity)
+{
+    const SizeType numBytes = controlsSize(capacity)
+                            + capacity * sizeof(StoredType);
+
+    return (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+         / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocateStorage(
+                                                             SizeType capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_capacity);
+    BSLS_ASSERT_SAFE(ImpUtil::GROUP_SIZE <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    if (capacity > maxSize()) {
+        StdExceptUtil::throwLengthError(
+                                "FlatHashTable: capacity exceeds 'maxSize()'");
+    }
+
+    StorageAllocator storageAllocator(d_allocator);
+
+    char *storage = reinterpret_cast<char *>(
+             StorageTraits::allocate(storageAllocator, storageSize(capacity)));
+
+    std::memset(storage, ImpUtil::EMPTY, capacity);
+    storage[capacity] = static_cast<char>(ImpUtil::SENTINEL);
+
+    d_controls_p   = reinterpret_cast<signed char *>(storage);
+    d_slots_p      = reinterpret_cast<StoredType *>(storage
+                                                   + controlsSize(capacity));
+    d_capacity     = capacity;
+    d_growthLeft   = static_cast<SizeType>(
+                                      ImpUtil::growthForCapacity(capacity));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::commitInsert(
+                                                           SizeType    index,
+                                                           std::size_t hash)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(d_controls_p[index] < ImpUtil::SENTINEL);
+
+    if (ImpUtil::EMPTY == d_controls_p[index]) {
+        --d_growthLeft;
+    }
+    d_controls_p[index] = static_cast<signed char>(hash & 0x7F);
+    ++d_size;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyElements(
+                                                 const FlatHashTable& original)
+{
+    BSLS_ASSERT_SAFE(0 == d_capacity);
+
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    // Build the copy in a temporary table so that, if copying an element
+    // throws, the elements copied so far are destroyed.
+
+    FlatHashTable temp(d_allocator);
+    temp.allocateStorage(original.d_capacity);
+
+    for (SizeType i = 0; i < original.d_capacity; ++i) {
+        const signed char control = original.d_controls_p[i];
+        if (0 <= control) {
+            AllocatorTraits::construct(temp.d_allocator,
+                                       temp.d_slots_p + i,
+                                       original.d_slots_p[i]);
+            ++temp.d_size;
+        }
+        temp.d_controls_p[i] = control;
+    }
+    temp.d_growthLeft = original.d_growthLeft;
+
+    swapStorage(temp);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::destroyElements()
+{
+    SizeType remaining = d_size;
+    for (SizeType i = 0; 0 < remaining; ++i) {
+        BSLS_ASSERT_SAFE(i < d_capacity);
+
+        if (0 <= d_controls_p[i]) {
+            AllocatorTraits::destroy(d_allocator, d_slots_p + i);
+            --remaining;
+        }
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::eraseAt(
+                                                                SizeType index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 <= d_controls_p[index]);
+
+    AllocatorTraits::destroy(d_allocator, d_slots_p + index);
+    --d_size;
+
+    // If the group of the slot has an 'EMPTY' slot, no probe sequence has
+    // continued past it, and the slot can be made 'EMPTY' again.
+
+    const SizeType groupStart = index & ~SizeType(ImpUtil::GROUP_SIZE - 1);
+    if (Group(d_controls_p + groupStart).matchEmpty()) {
+        d_controls_p[index] = static_cast<signed char>(ImpUtil::EMPTY);
+        ++d_growthLeft;
+    }
+    else {
+        d_controls_p[index] = static_cast<signed char>(ImpUtil::DELETED);
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prepareInsert(
+                                                              std::size_t hash)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        allocateStorage(ImpUtil::GROUP_SIZE);
+        return findAvailable(hash);                                   // RETURN
+    }
+
+    SizeType   index      = findAvailable(hash);
+    const bool mustRehash = 0 == d_growthLeft
+                         && ImpUtil::EMPTY == d_controls_p[index];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(mustRehash)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Rehash in place if at least 3/32 of the slots are tombstones, and
+        // double the capacity otherwise.
+
+        if (d_size * 32 <= d_capacity * 25) {
+            rehashImp(d_capacity);
+        }
+        else {
+            rehashImp(d_capacity * 2);
+        }
+        index = findAvailable(hash);
+    }
+
+    return index;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashImp(
+                                                          SizeType newCapacity)
+{
+    BSLS_ASSERT_SAFE(ImpUtil::GROUP_SIZE <= newCapacity);
+    BSLS_ASSERT_SAFE(d_size <= ImpUtil::growthForCapacity(newCapacity));
+
+    FlatHashTable temp(d_allocator);
+    temp.allocateStorage(newCapacity);
+
+    SizeType remaining = d_size;
+    for (SizeType i = 0; 0 < remaining; ++i) {
+        if (d_controls_p[i] < 0) {
+            continue;
+        }
+        --remaining;
+
+        const std::size_t hash  =
+                       hashCode(KEY_CONFIG::extractKey(d_slots_p[i]));
+        const SizeType    index = temp.findAvailable(hash);
+
+        if (bslmf::IsBitwiseMoveable<StoredType>::value) {
+            std::memcpy(static_cast<void *>(temp.d_slots_p + index),
+                        d_slots_p + i,
+                        sizeof(StoredType));
+        }
+        else {
+            AllocatorTraits::construct(temp.d_allocator,
+                                       temp.d_slots_p + index,
+                                       d_slots_p[i]);
+        }
+        temp.commitInsert(index, hash);
+    }
+
+    if (bslmf::IsBitwiseMoveable<StoredType>::value) {
+        // The elements now belong to 'temp'; do not destroy them with the old
+        // storage.
+
+        d_size = 0;
+    }
+
+    swapStorage(temp);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::swapStorage(
+                                                          FlatHashTable& other)
+{
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_slots_p,    &other.d_slots_p);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other.d_growthLeft);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findAvailable(
+                                                        std::size_t hash) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    const SizeType mask  = d_capacity / ImpUtil::GROUP_SIZE - 1;
+    SizeType       group = static_cast<SizeType>(hash >> 7) & mask;
+
+    for (SizeType step = 1; ; ++step) {
+        const SizeType groupStart = group * ImpUtil::GROUP_SIZE;
+
+        const unsigned int available =
+                         Group(d_controls_p + groupStart).matchAvailable();
+        if (available) {
+            return groupStart                                         // RETURN
+                 + ImpUtil::countTrailingZeros(available);
+        }
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findIndex(
+                                                const KeyType&   key,
+                                                std::size_t      hash) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const signed char h2    = static_cast<signed char>(hash & 0x7F);
+    const SizeType    mask  = d_capacity / ImpUtil::GROUP_SIZE - 1;
+    SizeType          group = static_cast<SizeType>(hash >> 7) & mask;
+
+    for (SizeType step = 1; ; ++step) {
+        const SizeType groupStart = group * ImpUtil::GROUP_SIZE;
+        const Group    controls(d_controls_p + groupStart);
+
+        for (unsigned int matches = controls.match(h2);
+             matches;
+             matches &= matches - 1) {
+            const SizeType index = groupStart
+                                 + ImpUtil::countTrailingZeros(matches);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_comparator(
+                                  key,
+                                  KEY_CONFIG::extractKey(d_slots_p[index])))) {
+                return index;                                         // RETURN
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(controls.matchEmpty())) {
+            return d_capacity;                                        // RETURN
+        }
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+std::size_t
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCode(
+                                                     const KeyType& key) const
+{
+    return ImpUtil::mix(d_hasher(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::nextFull(
+                                                          SizeType index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_capacity);
+
+    while (d_controls_p[index] < ImpUtil::SENTINEL) {
+        ++index;
+    }
+    return index;
+}
+
+// CREATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                                    const ALLOCATOR& allocator)
+: d_allocator(allocator)
+, d_hasher()
+, d_comparator()
+, d_controls_p(ImpUtil::emptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                          const HASHER&     hash,
+                                          const COMPARATOR& compare,
+                                          SizeType          initialNumElements,
+                                          const ALLOCATOR&  allocator)
+: d_allocator(allocator)
+, d_hasher(hash)
+, d_comparator(compare)
+, d_controls_p(ImpUtil::emptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    if (0 < initialNumElements) {
+        allocateStorage(static_cast<SizeType>(
+                         ImpUtil::capacityForSize(initialNumElements)));
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                                 const FlatHashTable& original)
+: d_allocator(AllocatorTraits::select_on_container_copy_construction(
+                                                        original.d_allocator))
+, d_hasher(original.d_hasher)
+, d_comparator(original.d_comparator)
+, d_controls_p(ImpUtil::emptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    copyElements(original);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::FlatHashTable(
+                                          const FlatHashTable& original,
+                                          const ALLOCATOR&     allocator)
+: d_allocator(allocator)
+, d_hasher(original.d_hasher)
+, d_comparator(original.d_comparator)
+, d_controls_p(ImpUtil::emptyControls())
+, d_slots_p(0)
+, d_capacity(0)
+, d_size(0)
+, d_growthLeft(0)
+{
+    copyElements(original);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~FlatHashTable()
+{
+    BSLS_ASSERT_SAFE(d_size <= d_capacity);
+
+    if (d_capacity) {
+        destroyElements();
+
+        StorageAllocator storageAllocator(d_allocator);
+        StorageTraits::deallocate(
+                  storageAllocator,
+                  reinterpret_cast<bsls::AlignmentUtil::MaxAlignedType *>(
+                                                                d_controls_p),
+                  storageSize(d_capacity));
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::begin()
+{
+    const SizeType index = nextFull(0);
+    return Iterator(d_controls_p + index, d_slots_p + index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::end()
+{
+    return Iterator(d_controls_p + d_capacity, d_slots_p + d_capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::erase(
+                                                       ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    const SizeType index = static_cast<SizeType>(position.control()
+                                                 - d_controls_p);
+    eraseAt(index);
+
+    const SizeType next = nextFull(index + 1);
+    return Iterator(d_controls_p + next, d_slots_p + next);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::erase(
+                                                            const KeyType& key)
+{
+    const SizeType index = findIndex(key, hashCode(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+    eraseAt(index);
+    return 1;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                            const KeyType& key)
+{
+    const SizeType index = findIndex(key, hashCode(key));
+    return Iterator(d_controls_p + index, d_slots_p + index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatHashTable<KEY_CONFIG,
+                                 HASHER,
+                                 COMPARATOR,
+                                 ALLOCATOR>::Iterator,
+          bool>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
+                                                       const ValueType& value)
+{
+    const KeyType&    key   = KEY_CONFIG::extractKey(value);
+    const std::size_t hash  = hashCode(key);
+    SizeType          index = findIndex(key, hash);
+
+    if (index != d_capacity) {
+        return bsl::pair<Iterator, bool>(
+                       Iterator(d_controls_p + index, d_slots_p + index),
+                       false);                                        // RETURN
+    }
+
+    // Note that 'value' cannot refer to an element of this table, so it is
+    // not invalidated by a rehash.
+
+    index = prepareInsert(hash);
+    AllocatorTraits::construct(d_allocator, d_slots_p + index, value);
+    commitInsert(index, hash);
+
+    return bsl::pair<Iterator, bool>(
+                             Iterator(d_controls_p + index, d_slots_p + index),
+                             true);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+bsl::pair<typename FlatHashTable<KEY_CONFIG,
+                                 HASHER,
+                                 COMPARATOR,
+                                 ALLOCATOR>::Iterator,
+          bool>
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
+                                                     const SOURCE_TYPE& value)
+{
+    // Create the element (using the allocator of this table) in order to
+    // obtain its key.
+
+    bsls::ObjectBuffer<StoredType> buffer;
+    StoredType *address = reinterpret_cast<StoredType *>(buffer.buffer());
+    AllocatorTraits::construct(d_allocator, address, value);
+    bslma::DestructorGuard<StoredType> guard(address);
+
+    return insert(buffer.object());
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::Iterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                            const KeyType& key)
+{
+    const std::size_t hash  = hashCode(key);
+    SizeType          index = findIndex(key, hash);
+
+    if (index == d_capacity) {
+        index = prepareInsert(hash);
+        AllocatorTraits::construct(d_allocator,
+                                   d_slots_p + index,
+                                   key,
+                                   typename ValueType::second_type());
+        commitInsert(index, hash);
+    }
+
+    return Iterator(d_controls_p + index, d_slots_p + index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehash(
+                                                          SizeType minCapacity)
+{
+    SizeType newCapacity = static_cast<SizeType>(
+                                           ImpUtil::capacityForSize(d_size));
+    while (newCapacity < minCapacity) {
+        newCapacity = newCapacity ? newCapacity * 2
+                                  : static_cast<SizeType>(ImpUtil::GROUP_SIZE);
+    }
+
+    if (0 == newCapacity) {
+        // This table is empty; release its storage.
+
+        FlatHashTable temp(d_allocator);
+        swapStorage(temp);
+        return;                                                       // RETURN
+    }
+
+    rehashImp(newCapacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    if (0 == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    destroyElements();
+
+    std::memset(d_controls_p, ImpUtil::EMPTY, d_capacity);
+    d_size       = 0;
+    d_growthLeft = static_cast<SizeType>(
+                                      ImpUtil::growthForCapacity(d_capacity));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserve(
+                                                          SizeType numElements)
+{
+    const SizeType newCapacity = static_cast<SizeType>(
+                                      ImpUtil::capacityForSize(numElements));
+
+    if (newCapacity > d_capacity) {
+        if (0 == d_capacity) {
+            allocateStorage(newCapacity);
+        }
+        else {
+            rehashImp(newCapacity);
+        }
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator == other.d_allocator);
+
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    swapStorage(other);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const ALLOCATOR&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::begin() const
+{
+    const SizeType index = nextFull(0);
+    return ConstIterator(d_controls_p + index, d_slots_p + index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::end() const
+{
+    return ConstIterator(d_controls_p + d_capacity, d_slots_p + d_capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                      const KeyType& key) const
+{
+    const SizeType index = findIndex(key, hashCode(key));
+    return ConstIterator(d_controls_p + index, d_slots_p + index);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const HASHER&
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
+{
+    return d_hasher;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                      / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+float
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxLoadFactor() const
+{
+    return 0.875f;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    // The storage of a table of capacity 'n' occupies somewhat more than
+    // 'n * (sizeof(StoredType) + 1)' bytes.  Leave a factor of two so that
+    // the computation of the storage size cannot overflow.
+
+    return ~SizeType(0) / (sizeof(StoredType) + 1) / 2;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bool bslstl::operator==(
+        const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+        const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs)
+{
+    typedef typename FlatHashTable<KEY_CONFIG,
+                                   HASHER,
+                                   COMPARATOR,
+                                   ALLOCATOR>::ConstIterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator match = rhs.find(KEY_CONFIG::extractKey(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator!=(
+        const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& lhs,
+        const FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& a,
+                  FlatHashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'FlatHashTable':
+//: o A 'FlatHashTable' is bitwise moveable if its functors and allocator are
+//:   bitwise moveable (its storage does not refer back to the table).
+//: o A 'FlatHashTable' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace bslma {
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bslstl::FlatHashTable<KEY_CONFIG,
+                                                HASHER,
+                                                COMPARATOR,
+                                                ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<bslstl::FlatHashTable<KEY_CONFIG,
+                                               HASHER,
+                                               COMPARATOR,
+                                               ALLOCATOR> >
+: bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<HASHER>::value
+                            && bslmf::IsBitwiseMoveable<COMPARATOR>::value
+                            && bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
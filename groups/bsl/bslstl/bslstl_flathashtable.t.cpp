@@ -0,0 +1,1080 @@
+// bslstl_flathashtable.t.cpp                                         -*-C++-*-
+#include <bslstl_flathashtable.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_allocbitwisemoveabletesttype.h>
+#include <bsltf_alloctesttype.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements an open-addressing hash table, together
+// with an iterator over its elements and the utilities used to probe its
+// control bytes.  The main concerns are that each element can be found after
+// any sequence of insertions and erasures (in particular, in the presence of
+// collisions and tombstones), that the table allocates only when it must
+// rehash, that elements are correctly moved by a rehash (whether or not they
+// are bitwise moveable), and that no memory is leaked, including when an
+// exception is thrown.
+//-----------------------------------------------------------------------------
+// FlatHashTable_ImpUtil
+// [ 2] std::size_t capacityForSize(std::size_t numElements);
+// [ 2] int countTrailingZeros(unsigned int mask);
+// [ 2] signed char *emptyControls();
+// [ 2] std::size_t growthForCapacity(std::size_t capacity);
+// [ 2] std::size_t mix(std::size_t hashValue);
+//
+// FlatHashTable_Group
+// [ 2] unsigned int match(signed char h2) const;
+// [ 2] unsigned int matchAvailable() const;
+// [ 2] unsigned int matchEmpty() const;
+// [ 2] unsigned int matchFull() const;
+//
+// FlatHashTable
+// [ 3] FlatHashTable(const ALLOCATOR& allocator = ALLOCATOR());
+// [ 6] FlatHashTable(const HASHER&, const COMPARATOR&, SizeType, ALLOC);
+// [ 5] FlatHashTable(const FlatHashTable& original);
+// [ 5] FlatHashTable(const FlatHashTable& original, const ALLOCATOR&);
+// [ 3] ~FlatHashTable();
+// [ 5] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 3] Iterator begin();
+// [ 3] Iterator end();
+// [ 4] Iterator erase(ConstIterator position);
+// [ 4] SizeType erase(const KeyType& key);
+// [ 3] Iterator find(const KeyType& key);
+// [ 3] pair<Iterator, bool> insert(const ValueType& value);
+// [ 3] pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+// [ 3] Iterator insertIfMissing(const KeyType& key);
+// [ 6] void rehash(SizeType minCapacity);
+// [ 6] void removeAll();
+// [ 6] void reserve(SizeType numElements);
+// [ 5] void swap(FlatHashTable& other);
+// [ 3] const ALLOCATOR& allocator() const;
+// [ 3] ConstIterator begin() const;
+// [ 3] SizeType capacity() const;
+// [ 3] ConstIterator end() const;
+// [ 3] ConstIterator find(const KeyType& key) const;
+// [ 3] float loadFactor() const;
+// [ 3] float maxLoadFactor() const;
+// [ 3] SizeType size() const;
+//
+// [ 5] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 5] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 3] CONCERN: All keys are found when every key has the same hash.
+// [ 4] CONCERN: Reusing tombstones does not grow the table without bound.
+// [ 3] CONCERN: Insertion is exception neutral.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatHashTable_ImpUtil ImpUtil;
+typedef bslstl::FlatHashTable_Group   Group;
+
+typedef bslstl::FlatHashTable<bslstl::UnorderedSetKeyConfiguration<const int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > IntTable;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct ConstantHash {
+    // This 'struct' provides a hash functor that returns the same value for
+    // every key, so that every key collides with every other.
+
+    std::size_t operator()(int) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+template <class MAPPED>
+struct MapTable {
+    // This 'struct' provides a namespace for the type of a table mapping
+    // 'int' keys to objects of the (template parameter) type 'MAPPED'.
+
+    typedef bsl::pair<const int, MAPPED>                 ValueType;
+    typedef bslstl::FlatHashTable<
+                        bslstl::UnorderedMapKeyConfiguration<ValueType>,
+                        bsl::hash<int>,
+                        bsl::equal_to<int>,
+                        bsl::allocator<ValueType> >       Type;
+};
+
+template <class TABLE>
+bool verifyTable(const TABLE& table, int numElements)
+    // Return 'true' if the specified 'table' holds exactly the elements having
+    // the keys '[0 .. numElements)', each reachable by both iteration and
+    // 'find', and 'false' otherwise.
+{
+    if (static_cast<int>(table.size()) != numElements) {
+        return false;                                                 // RETURN
+    }
+
+    int count = 0;
+    for (typename TABLE::ConstIterator it = table.begin();
+         it != table.end();
+         ++it, ++count) {
+        if (table.find(it->first) != it) {
+            return false;                                             // RETURN
+        }
+    }
+    if (count != numElements) {
+        return false;                                                 // RETURN
+    }
+
+    for (int i = 0; i < numElements; ++i) {
+        typename TABLE::ConstIterator it = table.find(i);
+        if (it == table.end() || i != it->first || i != it->second.data()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class MAPPED>
+void testInsertAndRehash(int numElements)
+    // Insert elements having the keys '[0 .. numElements)' into a table
+    // mapping 'int' to the (template parameter) type 'MAPPED', verifying the
+    // state of the table after each insertion and that no memory is leaked.
+{
+    typedef typename MapTable<MAPPED>::Type      Obj;
+    typedef typename MapTable<MAPPED>::ValueType Value;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < numElements; ++i) {
+            const typename Obj::SizeType CAPACITY = X.capacity();
+
+            bsl::pair<typename Obj::Iterator, bool> result =
+                                                mX.insert(Value(i, MAPPED(i)));
+            ASSERTV(i, result.second);
+            ASSERTV(i, i == result.first->first);
+            ASSERTV(i, i == result.first->second.data());
+            ASSERTV(i, &oa == result.first->second.allocator());
+
+            // The capacity changes only when the load factor would be
+            // exceeded.
+
+            if (CAPACITY != X.capacity()) {
+                ASSERTV(i, CAPACITY, X.capacity(),
+                        ImpUtil::growthForCapacity(CAPACITY) ==
+                                                  static_cast<std::size_t>(i));
+            }
+            ASSERTV(i, X.loadFactor() <= X.maxLoadFactor());
+
+            result = mX.insert(Value(i, MAPPED(-1)));
+            ASSERTV(i, !result.second);
+            ASSERTV(i, i == result.first->second.data());
+
+            if (veryVeryVerbose) { P_(i) P(X.capacity()) }
+        }
+        ASSERTV(numElements, verifyTable(X, numElements));
+        ASSERTV(numElements == static_cast<int>(X.size()));
+        ASSERTV(0 == da.numBlocksInUse());
+    }
+    ASSERTV(0 == oa.numBlocksInUse());
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Implementing a Set of Integers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to implement a simple set of 'int' values with fast lookup.
+// We can use a 'FlatHashTable' configured to use the entire element as its
+// key:
+//..
+    typedef bslstl::FlatHashTable<
+                              bslstl::UnorderedSetKeyConfiguration<const int>,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<int> > IntTable;
+//..
+// Next, we create a table, supplying a test allocator:
+//..
+    bslma::TestAllocator oa("object");
+    IntTable             table(&oa);
+    ASSERT(0 == table.size());
+    ASSERT(0 == table.capacity());
+    ASSERT(0 == oa.numBlocksInUse());
+//..
+// Notice that no memory is allocated until the first insertion.  Then, we
+// insert some values, noting that a value that is already present is not
+// inserted again:
+//..
+    for (int i = 0; i < 100; ++i) {
+        bsl::pair<IntTable::Iterator, bool> result = table.insert(i % 50);
+        ASSERT((i < 50) == result.second);
+        ASSERT(i % 50   == *result.first);
+    }
+    ASSERT(50 == table.size());
+    ASSERT(1  == oa.numBlocksInUse());
+//..
+// Notice that all of the elements are held in a single block of memory.
+// Finally, we look up and erase some values:
+//..
+    ASSERT(table.end() != table.find(7));
+    ASSERT(table.end() == table.find(77));
+
+    ASSERT(1 == table.erase(7));
+    ASSERT(0 == table.erase(7));
+    ASSERT(table.end() == table.find(7));
+    ASSERT(49 == table.size());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING CAPACITY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 The value constructor allocates only if asked for capacity, and
+        //:   then allocates enough capacity for the requested number of
+        //:   elements.
+        //:
+        //: 2 'reserve' grows the table only if necessary, and the table can
+        //:   then hold the requested number of elements without allocating.
+        //:
+        //: 3 'rehash' shrinks or grows the table while preserving its value,
+        //:   and releases all memory when applied to an empty table with
+        //:   argument 0.
+        //:
+        //: 4 'removeAll' destroys all elements and retains the capacity.
+        //
+        // Plan:
+        //: 1 Create tables of various initial capacities, reserve and rehash
+        //:   them, and verify their capacity, value, and memory use.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable(const HASHER&, const COMPARATOR&, SizeType, ALLOC);
+        //   void rehash(SizeType minCapacity);
+        //   void removeAll();
+        //   void reserve(SizeType numElements);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CAPACITY MANIPULATORS"
+                            "\n=============================\n");
+
+        typedef MapTable<bsltf::AllocTestType>::Type      Obj;
+        typedef MapTable<bsltf::AllocTestType>::ValueType Value;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const int DATA[] = { 0, 1, 13, 14, 15, 28, 29, 100, 1000 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int N = DATA[ti];
+
+            {
+                Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), N, &oa);
+                const Obj& X = mX;
+
+                ASSERTV(N, (0 == N) == (0 == oa.numBlocksInUse()));
+                ASSERTV(N, X.capacity() == ImpUtil::capacityForSize(N));
+
+                bslma::TestAllocatorMonitor oam(&oa);
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(Value(i, bsltf::AllocTestType(i)));
+                }
+                ASSERTV(N, oam.numBlocksInUseChange() == N);
+                ASSERTV(N, oam.numBlocksTotalChange() == N);
+                ASSERTV(N, verifyTable(X, N));
+
+                const Obj::SizeType CAPACITY = X.capacity();
+
+                mX.reserve(N);
+                ASSERTV(N, CAPACITY == X.capacity());
+
+                mX.reserve(2 * N + 1);
+                ASSERTV(N,
+                        X.capacity() == ImpUtil::capacityForSize(2 * N + 1));
+                ASSERTV(N, verifyTable(X, N));
+
+                mX.rehash(0);
+                ASSERTV(N, X.capacity() == ImpUtil::capacityForSize(N));
+                ASSERTV(N, verifyTable(X, N));
+
+                mX.rehash(1000);
+                ASSERTV(N, X.capacity() >= 1000);
+                ASSERTV(N, verifyTable(X, N));
+
+                const Obj::SizeType BIG_CAPACITY = X.capacity();
+
+                mX.removeAll();
+                ASSERTV(N, 0 == X.size());
+                ASSERTV(N, BIG_CAPACITY == X.capacity());
+                ASSERTV(N, X.begin() == X.end());
+                ASSERTV(N, 1 == oa.numBlocksInUse());
+
+                mX.rehash(0);
+                ASSERTV(N, 0 == X.capacity());
+                ASSERTV(N, 0 == oa.numBlocksInUse());
+                ASSERTV(N, X.begin() == X.end());
+
+                mX.insert(Value(1, bsltf::AllocTestType(1)));
+                ASSERTV(N, ImpUtil::GROUP_SIZE == X.capacity());
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   specified allocator (or the default allocator, by default).
+        //:
+        //: 2 A copy has the same capacity as its non-empty original and
+        //:   allocates exactly once for its storage.
+        //:
+        //: 3 Assignment gives the target the value of the source without
+        //:   changing its allocator, and is exception neutral.
+        //:
+        //: 4 'swap' exchanges the values of two tables without allocating.
+        //:
+        //: 5 Two tables compare equal if they have the same elements,
+        //:   regardless of their capacity or insertion order.
+        //
+        // Plan:
+        //: 1 Create tables of various sizes, copy, assign and swap them,
+        //:   and compare the results.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original);
+        //   FlatHashTable(const FlatHashTable& original, const ALLOCATOR&);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          "\n============================================\n");
+
+        typedef MapTable<bsltf::AllocTestType>::Type      Obj;
+        typedef MapTable<bsltf::AllocTestType>::ValueType Value;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",   veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const int DATA[] = { 0, 1, 14, 15, 100 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int N = DATA[ti];
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = N - 1; 0 <= i; --i) {
+                mX.insert(Value(i, bsltf::AllocTestType(i)));
+            }
+
+            // Erase and re-insert an element so that 'X' has a different
+            // layout from a table built in another order.
+
+            if (N) {
+                mX.erase(0);
+                mX.insert(Value(0, bsltf::AllocTestType(0)));
+            }
+
+            {
+                const Obj Y(X);
+                ASSERTV(N, verifyTable(Y, N));
+                ASSERTV(N, X == Y);
+                ASSERTV(N, !(X != Y));
+                ASSERTV(N, &da == Y.allocator().mechanism());
+                ASSERTV(N, X.capacity() == Y.capacity() || 0 == N);
+            }
+            {
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                const Obj Y(X, &sa);
+                ASSERTV(N, verifyTable(Y, N));
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &sa == Y.allocator().mechanism());
+                ASSERTV(N, sam.numBlocksTotalChange() == (N ? N + 1 : 0));
+            }
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int M = DATA[tj];
+
+                Obj mY(&sa);  const Obj& Y = mY;
+                for (int i = 0; i < M; ++i) {
+                    mY.insert(Value(i, bsltf::AllocTestType(i)));
+                }
+                ASSERTV(N, M, (N == M) == (X == Y));
+                ASSERTV(N, M, (N != M) == (X != Y));
+
+                {
+                    Obj mZ(Y, &sa);  const Obj& Z = mZ;
+
+                    mZ.swap(mY);
+                    ASSERTV(N, M, verifyTable(Y, M));
+                    ASSERTV(N, M, verifyTable(Z, M));
+
+                    bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+                    bslstl::swap(mY, mZ);
+                    ASSERTV(N, M, numBlocks == sa.numBlocksTotal());
+                    ASSERTV(N, M, verifyTable(Y, M));
+                }
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    mY = X;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(N, M, verifyTable(Y, N));
+                ASSERTV(N, M, X == Y);
+                ASSERTV(N, M, &sa == Y.allocator().mechanism());
+
+                mY = Y;
+                ASSERTV(N, M, verifyTable(Y, N));
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'erase'
+        //
+        // Concerns:
+        //: 1 Erasing an element destroys it, removes it from the table, and
+        //:   leaves all other elements reachable.
+        //:
+        //: 2 'erase(position)' returns an iterator to the next element.
+        //:
+        //: 3 'erase(key)' returns the number of elements erased.
+        //:
+        //: 4 Repeatedly inserting and erasing elements does not grow the
+        //:   table without bound, even when tombstones are created.
+        //
+        // Plan:
+        //: 1 Erase elements from tables using both overloads, with a good hash
+        //:   and with a hash for which every key collides, verifying the table
+        //:   after each erasure.  (C-1..3)
+        //:
+        //: 2 Insert and erase a sliding window of keys many times, and verify
+        //:   that the capacity remains bounded.  (C-4)
+        //
+        // Testing:
+        //   Iterator erase(ConstIterator position);
+        //   SizeType erase(const KeyType& key);
+        //   CONCERN: Reusing tombstones does not grow the table without bound.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'erase'"
+                            "\n===============\n");
+
+        typedef MapTable<bsltf::AllocTestType>::Type      Obj;
+        typedef MapTable<bsltf::AllocTestType>::ValueType Value;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tErasing by key and by position.\n");
+        {
+            const int N = 200;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(Value(i, bsltf::AllocTestType(i)));
+            }
+
+            for (int i = N - 1; 0 <= i; i -= 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, X.end() == X.find(i));
+            }
+            ASSERTV(N / 2 == static_cast<int>(X.size()));
+            ASSERTV(N / 2 + 1 == oa.numBlocksInUse());
+
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, X.end() != X.find(i));
+            }
+
+            int count = 0;
+            for (Obj::Iterator it = mX.begin(); it != mX.end(); ++count) {
+                Obj::Iterator next = it;
+                ++next;
+
+                Obj::Iterator result = mX.erase(it);
+                ASSERTV(count, next == result);
+                it = result;
+            }
+            ASSERTV(N / 2 == count);
+            ASSERTV(0 == X.size());
+            ASSERTV(X.begin() == X.end());
+            ASSERTV(1 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tErasing colliding keys.\n");
+        {
+            typedef bslstl::FlatHashTable<
+                            bslstl::UnorderedSetKeyConfiguration<const int>,
+                            ConstantHash,
+                            bsl::equal_to<int>,
+                            bsl::allocator<int> > CollidingTable;
+
+            const int N = 100;
+
+            CollidingTable mX(&oa);  const CollidingTable& X = mX;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            for (int i = 0; i < N; i += 3) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, (0 == i % 3) == (X.end() == X.find(i)));
+            }
+            for (int i = 0; i < N; i += 3) {
+                ASSERTV(i, mX.insert(i).second);
+            }
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, X.end() != X.find(i));
+            }
+            ASSERTV(N == static_cast<int>(X.size()));
+        }
+
+        if (verbose) printf("\tInserting and erasing a sliding window.\n");
+        {
+            const int WINDOW = 100;
+
+            IntTable mX(&oa);  const IntTable& X = mX;
+            for (int i = 0; i < WINDOW; ++i) {
+                mX.insert(i);
+            }
+            const IntTable::SizeType CAPACITY = X.capacity();
+
+            for (int i = WINDOW; i < 100 * WINDOW; ++i) {
+                ASSERTV(i, 1 == mX.erase(i - WINDOW));
+                ASSERTV(i, mX.insert(i).second);
+                ASSERTV(i, CAPACITY == X.capacity());
+            }
+            for (int i = 99 * WINDOW; i < 100 * WINDOW; ++i) {
+                ASSERTV(i, X.end() != X.find(i));
+            }
+            ASSERTV(WINDOW == static_cast<int>(X.size()));
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING INSERTION AND LOOKUP
+        //
+        // Concerns:
+        //: 1 An element is inserted only if its key is not already present,
+        //:   and the returned iterator refers to the element having that key.
+        //:
+        //: 2 The table grows only when the maximum load factor would be
+        //:   exceeded, allocating a single block of storage.
+        //:
+        //: 3 Elements are correctly moved by a rehash, whether or not they
+        //:   are bitwise moveable, and use the allocator of the table.
+        //:
+        //: 4 All elements are found even when every key has the same hash.
+        //:
+        //: 5 'insertIfMissing' inserts a default value only if the key is not
+        //:   present.
+        //:
+        //: 6 If an allocation fails during insertion, the table is unchanged
+        //:   and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Insert elements of types that are, and are not, bitwise
+        //:   moveable, verifying the state of the table after each insertion.
+        //:   (C-1..3)
+        //:
+        //: 2 Insert and look up keys in a table whose hash functor returns a
+        //:   constant.  (C-4)
+        //:
+        //: 3 Call 'insertIfMissing' for present and absent keys.  (C-5)
+        //:
+        //: 4 Insert elements inside the exception test macros.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(const ALLOCATOR& allocator = ALLOCATOR());
+        //   ~FlatHashTable();
+        //   Iterator begin();
+        //   Iterator end();
+        //   Iterator find(const KeyType& key);
+        //   pair<Iterator, bool> insert(const ValueType& value);
+        //   pair<Iterator, bool> insert(const SOURCE_TYPE& value);
+        //   Iterator insertIfMissing(const KeyType& key);
+        //   const ALLOCATOR& allocator() const;
+        //   ConstIterator begin() const;
+        //   SizeType capacity() const;
+        //   ConstIterator end() const;
+        //   ConstIterator find(const KeyType& key) const;
+        //   float loadFactor() const;
+        //   float maxLoadFactor() const;
+        //   SizeType size() const;
+        //   CONCERN: All keys are found when every key has the same hash.
+        //   CONCERN: Insertion is exception neutral.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INSERTION AND LOOKUP"
+                            "\n============================\n");
+
+        ASSERT(!bslmf::IsBitwiseMoveable<
+                      MapTable<bsltf::AllocTestType>::ValueType>::value);
+        ASSERT( bslmf::IsBitwiseMoveable<
+                   MapTable<bsltf::AllocBitwiseMoveableTestType>::ValueType
+                                                                   >::value);
+
+        if (verbose) printf("\tInserting elements.\n");
+        {
+            static const int DATA[] = { 0, 1, 14, 15, 16, 29, 57, 1000 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                testInsertAndRehash<bsltf::AllocTestType>(DATA[ti]);
+                testInsertAndRehash<bsltf::AllocBitwiseMoveableTestType>(
+                                                                    DATA[ti]);
+            }
+        }
+
+        if (verbose) printf("\tAllocating on first insertion.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            IntTable mX(&oa);  const IntTable& X = mX;
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == X.size());
+            ASSERTV(0.0f == X.loadFactor());
+            ASSERTV(0.875f == X.maxLoadFactor());
+            ASSERTV(&oa == X.allocator().mechanism());
+            ASSERTV(X.begin() == X.end());
+            ASSERTV(mX.begin() == mX.end());
+            ASSERTV(X.end() == X.find(0));
+            ASSERTV(mX.end() == mX.find(0));
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            // Insert a value of a different type.
+
+            bsl::pair<IntTable::Iterator, bool> result = mX.insert('a');
+            ASSERTV(result.second);
+            ASSERTV('a' == *result.first);
+            ASSERTV(ImpUtil::GROUP_SIZE == X.capacity());
+            ASSERTV(1 == oa.numBlocksInUse());
+            ASSERTV(X.begin() == result.first);
+            ASSERTV(X.find('a') == result.first);
+        }
+
+        if (verbose) printf("\tInserting colliding keys.\n");
+        {
+            typedef bslstl::FlatHashTable<
+                            bslstl::UnorderedSetKeyConfiguration<const int>,
+                            ConstantHash,
+                            bsl::equal_to<int>,
+                            bsl::allocator<int> > CollidingTable;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const int N = 200;
+
+            CollidingTable mX(&oa);  const CollidingTable& X = mX;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i,  mX.insert(i).second);
+                ASSERTV(i, !mX.insert(i).second);
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, X.end() != X.find(j));
+                }
+                ASSERTV(i, X.end() == X.find(i + 1));
+            }
+        }
+
+        if (verbose) printf("\tTesting 'insertIfMissing'.\n");
+        {
+            typedef MapTable<bsltf::AllocTestType>::Type Obj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                Obj::Iterator it = mX.insertIfMissing(i);
+                ASSERTV(i, i == it->first);
+                ASSERTV(i, 0 == it->second.data());
+                ASSERTV(i, &oa == it->second.allocator());
+                it->second.setData(i);
+            }
+            for (int i = 0; i < 50; ++i) {
+                Obj::Iterator it = mX.insertIfMissing(i);
+                ASSERTV(i, i == it->second.data());
+            }
+            ASSERTV(50 == X.size());
+        }
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            typedef MapTable<bsltf::AllocTestType>::Type      Obj;
+            typedef MapTable<bsltf::AllocTestType>::ValueType Value;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 30; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, verifyTable(X, i));
+                    mX.insert(Value(i, bsltf::AllocTestType(i)));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(i, verifyTable(X, i + 1));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING UTILITIES
+        //
+        // Concerns:
+        //: 1 'capacityForSize' returns the smallest valid capacity that holds
+        //:   the requested number of elements within the maximum load factor.
+        //:
+        //: 2 'countTrailingZeros' returns the index of the lowest set bit.
+        //:
+        //: 3 'emptyControls' returns a single 'SENTINEL'.
+        //:
+        //: 4 'mix' changes the low bits of consecutive hash values.
+        //:
+        //: 5 The 'FlatHashTable_Group' match methods return a mask having a
+        //:   bit set for exactly each matching control byte.
+        //
+        // Plan:
+        //: 1 Compare the results of the utilities against brute-force
+        //:   computations.  (C-1..5)
+        //
+        // Testing:
+        //   std::size_t capacityForSize(std::size_t numElements);
+        //   int countTrailingZeros(unsigned int mask);
+        //   signed char *emptyControls();
+        //   std::size_t growthForCapacity(std::size_t capacity);
+        //   std::size_t mix(std::size_t hashValue);
+        //   unsigned int match(signed char h2) const;
+        //   unsigned int matchAvailable() const;
+        //   unsigned int matchEmpty() const;
+        //   unsigned int matchFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING UTILITIES"
+                            "\n=================\n");
+
+        if (verbose) printf("\tTesting 'capacityForSize'.\n");
+        {
+            ASSERTV(0 == ImpUtil::capacityForSize(0));
+            for (std::size_t n = 1; n < 5000; ++n) {
+                const std::size_t CAPACITY = ImpUtil::capacityForSize(n);
+
+                ASSERTV(n, ImpUtil::GROUP_SIZE <= CAPACITY);
+                ASSERTV(n, 0 == (CAPACITY & (CAPACITY - 1)));
+                ASSERTV(n, n <= ImpUtil::growthForCapacity(CAPACITY));
+                ASSERTV(n, ImpUtil::GROUP_SIZE == CAPACITY
+                        || n > ImpUtil::growthForCapacity(CAPACITY / 2));
+            }
+            ASSERTV(14 == ImpUtil::growthForCapacity(16));
+            ASSERTV(28 == ImpUtil::growthForCapacity(32));
+        }
+
+        if (verbose) printf("\tTesting 'countTrailingZeros'.\n");
+        {
+            for (int i = 0; i < 32; ++i) {
+                const unsigned int BIT = 1U << i;
+                ASSERTV(i, i == ImpUtil::countTrailingZeros(BIT));
+                ASSERTV(i, i == ImpUtil::countTrailingZeros(BIT | (BIT << 1)));
+                ASSERTV(i, i == ImpUtil::countTrailingZeros(~(BIT - 1)));
+            }
+        }
+
+        if (verbose) printf("\tTesting 'emptyControls'.\n");
+        {
+            ASSERTV(ImpUtil::SENTINEL == *ImpUtil::emptyControls());
+            ASSERTV(ImpUtil::emptyControls() == ImpUtil::emptyControls());
+        }
+
+        if (verbose) printf("\tTesting 'mix'.\n");
+        {
+            // The low 7 bits of the mixed hashes of 0 .. 127 should take many
+            // distinct values.
+
+            bool seen[128] = { false };
+            int  numDistinct = 0;
+            for (std::size_t h = 0; h < 128; ++h) {
+                const std::size_t MIXED = ImpUtil::mix(h);
+                if (!seen[MIXED & 0x7F]) {
+                    seen[MIXED & 0x7F] = true;
+                    ++numDistinct;
+                }
+                ASSERTV(h, h == 0 || ImpUtil::mix(h) != ImpUtil::mix(h - 1));
+            }
+            ASSERTV(numDistinct, 64 < numDistinct);
+        }
+
+        if (verbose) printf("\tTesting 'FlatHashTable_Group'.\n");
+        {
+            // Populate a group with every kind of control value, in each
+            // position, and compare the masks with brute-force results.
+
+            const signed char VALUES[] = {
+                ImpUtil::EMPTY, ImpUtil::DELETED, ImpUtil::SENTINEL,
+                0, 1, 42, 126, 127
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            signed char controls[ImpUtil::GROUP_SIZE + 1];
+            for (int offset = 0; offset < 2; ++offset) {
+            for (int vi = 0; vi < NUM_VALUES * ImpUtil::GROUP_SIZE; ++vi) {
+                signed char *group = controls + offset;
+                for (int i = 0; i < ImpUtil::GROUP_SIZE; ++i) {
+                    group[i] = VALUES[(vi + i * i) % NUM_VALUES];
+                }
+                const Group X(group);
+
+                unsigned int expEmpty = 0, expAvailable = 0, expFull = 0;
+                for (int i = 0; i < ImpUtil::GROUP_SIZE; ++i) {
+                    if (ImpUtil::EMPTY == group[i]) {
+                        expEmpty |= 1U << i;
+                    }
+                    if (group[i] < ImpUtil::SENTINEL) {
+                        expAvailable |= 1U << i;
+                    }
+                    if (0 <= group[i]) {
+                        expFull |= 1U << i;
+                    }
+                }
+                ASSERTV(offset, vi, expEmpty     == X.matchEmpty());
+                ASSERTV(offset, vi, expAvailable == X.matchAvailable());
+                ASSERTV(offset, vi, expFull      == X.matchFull());
+
+                for (int h2 = 0; h2 < 128; ++h2) {
+                    unsigned int expMatch = 0;
+                    for (int i = 0; i < ImpUtil::GROUP_SIZE; ++i) {
+                        if (h2 == group[i]) {
+                            expMatch |= 1U << i;
+                        }
+                    }
+                    ASSERTV(offset, vi, h2,
+                       expMatch == X.match(static_cast<signed char>(h2)));
+                }
+            }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, erase and iterate over a number of elements.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            IntTable mX(&oa);  const IntTable& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i,  mX.insert(i * 7).second);
+                ASSERTV(i, !mX.insert(i * 7).second);
+            }
+            ASSERTV(1000 == X.size());
+            ASSERTV(X.loadFactor() <= X.maxLoadFactor());
+
+            long long sum = 0;
+            int       count = 0;
+            for (IntTable::ConstIterator it = X.begin(); it != X.end(); ++it) {
+                sum += *it;
+                ++count;
+            }
+            ASSERTV(1000 == count);
+            ASSERTV(7LL * 999 * 1000 / 2 == sum);
+
+            for (int i = 0; i < 7000; ++i) {
+                ASSERTV(i, (0 == i % 7) == (X.end() != X.find(i)));
+            }
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i * 7));
+            }
+            ASSERTV(500 == X.size());
+
+            IntTable mY(X, &oa);  const IntTable& Y = mY;
+            ASSERTV(X == Y);
+            mY.insert(-1);
+            ASSERTV(X != Y);
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
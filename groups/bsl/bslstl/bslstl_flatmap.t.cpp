@@ -0,0 +1,1064 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_btreemap.h>
+#include <bslstl_map.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over 'bslstl::FlatTree',
+// which is tested thoroughly in its own component.  Accordingly, this test
+// driver concentrates on the forwarding of each method to the underlying
+// container, on the behavior specific to a map ('operator[]', 'at',
+// 'equal_range', reverse iteration, and the relational operators), and on the
+// type traits.  A benchmark comparing 'bsl::flat_map' with 'bsl::btree_map'
+// and 'bsl::map' is provided as a negative test case.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map(const COMPARATOR&, const allocator_type&);
+// [ 2] flat_map(const allocator_type& allocator);
+// [ 4] flat_map(const flat_map& original);
+// [ 4] flat_map(const flat_map&, const allocator_type&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 4] flat_map& operator=(const flat_map& rhs);
+// [ 3] mapped_type& operator[](const key_type& key);
+// [ 3] mapped_type& at(const key_type& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 5] void clear();
+// [ 5] void reserve(size_type numElements);
+// [ 5] void shrink_to_fit();
+// [ 5] iterator erase(const_iterator position);
+// [ 5] size_type erase(const key_type& key);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const key_type& key);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator lower_bound(const key_type& key);
+// [ 2] iterator upper_bound(const key_type& key);
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 4] void swap(flat_map& other);
+//
+// ACCESSORS
+// [ 3] const mapped_type& at(const key_type& key) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 5] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] const_iterator lower_bound(const key_type& key) const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 2] const_iterator upper_bound(const key_type& key) const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_map&, const flat_map&);
+// [ 4] bool operator!=(const flat_map&, const flat_map&);
+// [ 4] bool operator<(const flat_map&, const flat_map&);
+// [ 4] bool operator>(const flat_map&, const flat_map&);
+// [ 4] bool operator<=(const flat_map&, const flat_map&);
+// [ 4] bool operator>=(const flat_map&, const flat_map&);
+// [ 4] void swap(flat_map& a, flat_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::btree_map' AND 'bsl::map'
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>                  IntMap;
+typedef bsl::flat_map<int, bsltf::AllocTestType> Obj;
+typedef Obj::value_type                          Value;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Greater {
+    // This 'struct' defines a comparator that orders 'int' values in
+    // descending order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+unsigned int benchmarkKey(int index)
+    // Return a distinct key for each distinct value of the specified 'index'
+    // in the range '[0 .. 2^31)'.  Note that consecutive indices do not yield
+    // consecutive keys.
+{
+    return static_cast<unsigned int>(index) * 2654435761U;
+}
+
+int permutedIndex(int index, int size)
+    // Return the image of the specified 'index' under a permutation of the
+    // range '[0 .. size)' that scatters consecutive indices, for the specified
+    // 'size'.  The behavior is undefined unless '0 <= index < size' and 'size'
+    // is not a multiple of 7919.  Note that looking up keys in the order in
+    // which they were inserted would favor 'bsl::map', whose nodes are then
+    // visited in the order in which they were allocated.
+{
+    return static_cast<int>(static_cast<bsls::Types::Int64>(index) * 7919
+                                                                      % size);
+}
+
+template <class MAP>
+void benchmark(const char *name, int size, int numRounds)
+    // Print, for the container type 'MAP' identified by the specified 'name',
+    // the average time per element taken to build a map from an unordered
+    // array of the specified 'size' distinct keys, to look up each of them, to
+    // look up 'size' absent keys, and to visit each element in order,
+    // repeating each measurement the specified 'numRounds' times.  Keys are
+    // looked up in an order different from that of the array.  Note that
+    // erasure is not measured, since erasing each element of a 'flat_map' in
+    // turn takes quadratic time.
+{
+    typedef bsl::pair<unsigned int, int> Element;
+
+    bslma::NewDeleteAllocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+    bsl::vector<Element> elements(alloc);
+    elements.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        elements.push_back(Element(benchmarkKey(i), i));
+    }
+
+    double buildTime = 0, hitTime = 0, missTime = 0, scanTime = 0;
+    bsls::Types::Int64 checksum = 0;
+
+    for (int round = 0; round < numRounds; ++round) {
+        bsls::Stopwatch timer;
+
+        timer.start();
+        MAP mX(elements.begin(),
+               elements.end(),
+               typename MAP::key_compare(),
+               alloc);
+        timer.stop();
+        buildTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            checksum += mX.find(benchmarkKey(permutedIndex(i, size)))->second;
+        }
+        timer.stop();
+        hitTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = size; i < 2 * size; ++i) {
+            checksum += mX.count(benchmarkKey(i));
+        }
+        timer.stop();
+        missTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (typename MAP::const_iterator it = mX.begin();
+             it != mX.end();
+             ++it) {
+            checksum += it->second;
+        }
+        timer.stop();
+        scanTime += timer.elapsedTime();
+    }
+
+    const double NS = 1e9 / (static_cast<double>(size) * numRounds);
+
+    printf("%-10s %10d %9.1f %9.1f %9.1f %9.1f   (%lld)\n",
+           name,
+           size,
+           buildTime * NS,
+           hitTime   * NS,
+           missTime  * NS,
+           scanTime  * NS,
+           checksum);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Table of Exchange Rates
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a list of the exchange rates of some currencies, in no
+// particular order, and want to look up rates by currency code many times.
+// We first define a type for the entries of the list:
+//..
+    typedef bsl::pair<int, double> Rate;  // (ISO 4217 code, rate)
+
+    static const Rate RATES[] = {
+        Rate(978, 0.92),  // EUR
+        Rate(392, 151.3), // JPY
+        Rate(826, 0.79),  // GBP
+        Rate(756, 0.88),  // CHF
+        Rate(124, 1.36),  // CAD
+    };
+    const int NUM_RATES = sizeof RATES / sizeof *RATES;
+//..
+// Then, we build a 'flat_map' from the list in a single operation, which
+// sorts the entries once:
+//..
+    bslma::TestAllocator         oa("object");
+    bsl::flat_map<int, double>   rates(RATES, RATES + NUM_RATES,
+                                       std::less<int>(),
+                                       &oa);
+    ASSERT(5   == rates.size());
+    ASSERT(124 == rates.begin()->first);
+//..
+// Now, we look up some rates:
+//..
+    ASSERT(0.79 == rates.at(826));
+    ASSERT(rates.end() == rates.find(840));
+    ASSERT(756 == rates.lower_bound(500)->first);
+//..
+// Finally, we add a missing currency, and verify that the entries remain
+// ordered by code:
+//..
+    rates[840] = 1.0;
+    ASSERT(6 == rates.size());
+
+    for (bsl::flat_map<int, double>::const_iterator it = rates.begin() + 1;
+         it != rates.end();
+         ++it) {
+        ASSERT((it - 1)->first < it->first);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ERASURE AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes the specified elements, destroys
+        //:   them, and returns the documented value.
+        //:
+        //: 2 'clear' removes and destroys all elements, retaining the
+        //:   capacity, which 'shrink_to_fit' then releases.
+        //:
+        //: 3 After 'reserve', insertions up to the reserved capacity do not
+        //:   allocate storage for the elements.
+        //
+        // Plan:
+        //: 1 Populate maps, erase elements with each overload, and verify the
+        //:   remaining elements and the memory in use.  (C-1..2)
+        //:
+        //: 2 Reserve capacity, insert elements, and verify that the number of
+        //:   allocations is that of the elements alone.  (C-3)
+        //
+        // Testing:
+        //   void clear();
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ERASURE AND CAPACITY"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 500;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX[i].setData(i);
+            }
+
+            ASSERTV(1 == mX.erase(0));
+            ASSERTV(0 == mX.erase(0));
+            ASSERTV(N - 1 == static_cast<int>(X.size()));
+            ASSERTV(1 == X.begin()->first);
+
+            Obj::iterator it = mX.erase(mX.find(1));
+            ASSERTV(2 == it->first);
+            ASSERTV(0 == X.count(1));
+
+            it = mX.erase(mX.find(N - 1));
+            ASSERTV(X.end() == it);
+
+            // Erase a range of elements from the middle of the sequence.
+
+            it = mX.erase(X.find(100), X.find(300));
+            ASSERTV(300 == it->first);
+            ASSERTV(N - 203 == static_cast<int>(X.size()));
+            ASSERTV(X.end() == X.find(299));
+            ASSERTV(299 == X.find(99)->second.data() + 200);
+
+            int expected = 2;
+            for (Obj::const_iterator i = X.begin(); i != X.end(); ++i) {
+                ASSERTV(expected, expected == i->first);
+                ASSERTV(expected, expected == i->second.data());
+                expected = 99 == expected ? 300 : expected + 1;
+            }
+            ASSERTV(N - 1 == expected);
+
+            it = mX.erase(X.begin(), X.end());
+            ASSERTV(X.end() == it);
+            ASSERTV(X.empty());
+
+            for (int i = 0; i < N; ++i) {
+                mX[i].setData(i);
+            }
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(X.begin() == X.end());
+            ASSERTV(N <= static_cast<int>(X.capacity()));
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'reserve'.\n");
+        {
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(N);
+            ASSERTV(N <= static_cast<int>(X.capacity()));
+            ASSERTV(numBlocks + 1 == oa.numBlocksTotal());
+
+            for (int i = 0; i < N; ++i) {
+                mX[i].setData(i);
+            }
+            ASSERTV(N == static_cast<int>(X.size()));
+
+            // Each 'AllocTestType' element allocates one block; appending in
+            // order moves no elements, and the vector allocates only when
+            // reserving.
+
+            ASSERTV(oa.numBlocksTotal(),
+                    numBlocks + 1 + N == oa.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values and comparators, and do not
+        //:   change allocators.
+        //:
+        //: 3 Maps compare equal if and only if they have the same key-value
+        //:   pairs, regardless of insertion order.
+        //:
+        //: 4 The relational operators order maps lexicographically.
+        //
+        // Plan:
+        //: 1 Create maps with various values, copy, assign, swap and compare
+        //:   them.  (C-1..4)
+        //
+        // Testing:
+        //   flat_map(const flat_map& original);
+        //   flat_map(const flat_map&, const allocator_type&);
+        //   flat_map& operator=(const flat_map& rhs);
+        //   void swap(flat_map& other);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator<(const flat_map&, const flat_map&);
+        //   bool operator>(const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   void swap(flat_map& a, flat_map& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nTESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                        "\n==============================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 200; ++i) {
+                mX[i].setData(i);
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+            ASSERTV(&da == Y.find(7)->second.allocator());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+            ASSERTV(&sa == Z.find(7)->second.allocator());
+
+            // Build a map having the same value in the reverse order.
+
+            Obj mW(&sa);  const Obj& W = mW;
+            for (int i = 199; 0 <= i; --i) {
+                mW[i].setData(i);
+            }
+            ASSERTV(X == W);
+            ASSERTV(!(X != W));
+
+            mW[3].setData(-3);
+            ASSERTV(X != W);
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW[1000];
+            mZ.swap(mW);
+            ASSERTV(201 == Z.size());
+            ASSERTV(200 == W.size());
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            bsl::swap(mZ, mW);
+            ASSERTV(200 == Z.size());
+            ASSERTV(201 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            // Each map is lexicographically less than the next.  Each
+            // character of a specification is a key, mapped to 0 if the
+            // character is lower case, and to 1 (with the lower case key)
+            // otherwise.
+
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                { L_, ""     },
+                { L_, "a"    },
+                { L_, "ab"   },
+                { L_, "abc"  },
+                { L_, "aB"   },
+                { L_, "ac"   },
+                { L_, "A"    },
+                { L_, "b"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    IntMap mU(&oa);  const IntMap& U = mU;
+                    IntMap mV(&oa);  const IntMap& V = mV;
+
+                    for (const char *s = DATA[ti].d_spec; *s; ++s) {
+                        const bool UPPER = *s < 'a';
+                        mU[UPPER ? *s - 'A' : *s - 'a'] = UPPER;
+                    }
+                    for (const char *s = DATA[tj].d_spec; *s; ++s) {
+                        const bool UPPER = *s < 'a';
+                        mV[UPPER ? *s - 'A' : *s - 'a'] = UPPER;
+                    }
+
+                    if (veryVerbose) {
+                        T_ P_(DATA[ti].d_spec) P(DATA[tj].d_spec)
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (U == V));
+                    ASSERTV(ti, tj, (ti != tj) == (U != V));
+                    ASSERTV(ti, tj, (ti <  tj) == (U <  V));
+                    ASSERTV(ti, tj, (ti >  tj) == (U >  V));
+                    ASSERTV(ti, tj, (ti <= tj) == (U <= V));
+                    ASSERTV(ti, tj, (ti >= tj) == (U >= V));
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator[]' AND 'at'
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed mapped value, using
+        //:   the allocator of the map, only if the key is absent, and returns
+        //:   a reference to the mapped value.
+        //:
+        //: 2 'at' returns a reference to the mapped value, and throws
+        //:   'std::out_of_range' if the key is absent.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' and 'at' on present and absent keys.  (C-1..2)
+        //
+        // Testing:
+        //   mapped_type& operator[](const key_type& key);
+        //   mapped_type& at(const key_type& key);
+        //   const mapped_type& at(const key_type& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator[]' AND 'at'"
+                            "\n=============================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 300; ++i) {
+                const int KEY = (i * 7) % 300;
+
+                bsltf::AllocTestType& value = mX[KEY];
+                ASSERTV(i, 0 == value.data());
+                ASSERTV(i, &oa == value.allocator());
+                value.setData(KEY);
+
+                ASSERTV(i, KEY == mX[KEY].data());
+                ASSERTV(i, KEY == mX.at(KEY).data());
+                ASSERTV(i, KEY == X.at(KEY).data());
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+            ASSERTV(0 == da.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(300);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+
+            caught = false;
+            try {
+                X.at(-1);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+            ASSERTV(300 == X.size());
+#endif
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS, INSERTION, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified comparator and allocator,
+        //:   and allocates only if a non-empty range is supplied.
+        //:
+        //: 2 Each 'insert' overload inserts an element only if its key is
+        //:   absent, and returns the documented value.
+        //:
+        //: 3 The lookup methods find exactly the inserted keys, and the
+        //:   bounds are consistent with the order of the comparator.
+        //:
+        //: 4 Forward and reverse iteration visit the elements in order.
+        //:
+        //: 5 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct maps with each constructor, insert and look up keys,
+        //:   and verify the results and the memory used.  (C-1..4)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-5)
+        //
+        // Testing:
+        //   flat_map(const COMPARATOR&, const allocator_type&);
+        //   flat_map(const allocator_type& allocator);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   ~flat_map();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator find(const key_type& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTORS, INSERTION, AND LOOKUP"
+                            "\n===========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Value,
+                                   bsl::pair<int,
+                                             bsltf::AllocTestType> >::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::key_compare, std::less<int> >::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            IntMap mA;  const IntMap& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(0 < A.max_size());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(A.cbegin() == A.cend());
+            ASSERTV(A.rbegin() == A.rend());
+            ASSERTV(A.crbegin() == A.crend());
+            ASSERTV(mA.begin() == mA.end());
+            ASSERTV(mA.rbegin() == mA.rend());
+
+            IntMap mB(&oa);  const IntMap& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+
+            bsl::flat_map<int, int, Greater> mC(Greater(), &oa);
+            const bsl::flat_map<int, int, Greater>& C = mC;
+            ASSERTV(C.empty());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            static const int DATA[][2] = {
+                { 1, 10 }, { 2, 20 }, { 3, 30 }, { 2, 99 }, { 4, 40 }
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            bsl::pair<int, int> values[NUM_DATA];
+            for (int i = 0; i < NUM_DATA; ++i) {
+                values[i] = bsl::pair<int, int>(DATA[i][0], DATA[i][1]);
+            }
+
+            IntMap mD(values, values + NUM_DATA, std::less<int>(), &oa);
+            const IntMap& D = mD;
+            ASSERTV(4 == D.size());
+            ASSERTV(20 == D.at(2) || 99 == D.at(2));
+            ASSERTV(1 == D.begin()->first);
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            bsl::flat_map<int, int, Greater> mE(values,
+                                                values + NUM_DATA,
+                                                Greater(),
+                                                &oa);
+            const bsl::flat_map<int, int, Greater>& E = mE;
+            ASSERTV(4 == E.size());
+            ASSERTV(4 == E.begin()->first);
+            ASSERTV(1 == E.rbegin()->first);
+            ASSERTV(E.key_comp()(2, 1));
+            ASSERTV(E.value_comp()(*E.begin(), *E.rbegin()));
+            ASSERTV(3 == E.lower_bound(3)->first);
+            ASSERTV(2 == E.upper_bound(3)->first);
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion and lookup.\n");
+        {
+            IntMap mX(&oa);  const IntMap& X = mX;
+
+            // Insert the even keys in '[0 .. 1000)' in a scattered order.
+
+            for (int i = 0; i < 500; ++i) {
+                const int KEY = (i * 37 % 500) * 2;
+
+                bsl::pair<IntMap::iterator, bool> r =
+                                     mX.insert(bsl::pair<int, int>(KEY, KEY));
+                ASSERTV(i, r.second);
+                ASSERTV(i, KEY == r.first->first);
+
+                r = mX.insert(bsl::pair<int, int>(KEY, -KEY));
+                ASSERTV(i, !r.second);
+                ASSERTV(i, KEY == r.first->second);
+
+                IntMap::iterator it = mX.insert(X.begin(),
+                                                IntMap::value_type(KEY, 0));
+                ASSERTV(i, KEY == it->first);
+                ASSERTV(i, KEY == it->second);
+            }
+            ASSERTV(500 == X.size());
+            ASSERTV(X.key_comp()(1, 2));
+            ASSERTV(X.value_comp()(*X.begin(), *X.rbegin()));
+
+            for (int i = -10; i < 1010; ++i) {
+                const bool PRESENT = 0 <= i && i < 1000 && 0 == i % 2;
+
+                ASSERTV(i, PRESENT == (1 == X.count(i)));
+                ASSERTV(i, PRESENT == (X.end() != X.find(i)));
+                ASSERTV(i, PRESENT == (mX.end() != mX.find(i)));
+
+                const int LOWER = i < 0 ? 0 : i + i % 2;
+                const int UPPER = i < 0 ? 0 : i + 2 - i % 2;
+
+                IntMap::const_iterator lower = X.lower_bound(i);
+                IntMap::const_iterator upper = X.upper_bound(i);
+                ASSERTV(i, lower == mX.lower_bound(i));
+                ASSERTV(i, upper == mX.upper_bound(i));
+                if (LOWER < 1000) {
+                    ASSERTV(i, LOWER == lower->first);
+                }
+                else {
+                    ASSERTV(i, X.end() == lower);
+                }
+                if (UPPER < 1000) {
+                    ASSERTV(i, UPPER == upper->first);
+                }
+                else {
+                    ASSERTV(i, X.end() == upper);
+                }
+
+                bsl::pair<IntMap::const_iterator, IntMap::const_iterator> cr =
+                                                             X.equal_range(i);
+                bsl::pair<IntMap::iterator, IntMap::iterator> mr =
+                                                            mX.equal_range(i);
+                ASSERTV(i, cr.first == mr.first);
+                ASSERTV(i, cr.second == mr.second);
+                ASSERTV(i, lower == cr.first);
+                ASSERTV(i, upper == cr.second);
+                ASSERTV(i, PRESENT == (cr.first != cr.second));
+            }
+
+            int count = 0;
+            for (IntMap::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERTV(count, count * 2 == it->first);
+                it->second = it->first * 2;
+                ++count;
+            }
+            ASSERTV(500 == count);
+            for (IntMap::const_iterator it = X.cbegin();
+                 it != X.cend();
+                 ++it) {
+                ASSERTV(it->first, it->first * 2 == it->second);
+            }
+
+            for (IntMap::reverse_iterator it = mX.rbegin();
+                 it != mX.rend();
+                 ++it) {
+                --count;
+                ASSERTV(count, count * 2 == it->first);
+            }
+            ASSERTV(0 == count);
+            for (IntMap::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                ++count;
+            }
+            ASSERTV(500 == count);
+
+            // Insert a range, some of which are already present.
+
+            bsl::pair<int, int> values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = bsl::pair<int, int>(990 + i, 0);
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(515 == X.size());
+            ASSERTV(1980 == X.at(990));
+            ASSERTV(0 == X.at(1009));
+            ASSERTV(1009 == X.rbegin()->first);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase elements, and compare the results with
+        //:   those of a 'bsl::map'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            IntMap             mX(&oa);
+            bsl::map<int, int> mY(&oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 2000);
+
+                switch (seed % 3) {
+                  case 0: {
+                    mX[KEY] = i;
+                    mY[KEY] = i;
+                  } break;
+                  case 1: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+
+            IntMap::const_iterator it = mX.begin();
+            for (bsl::map<int, int>::const_iterator jt = mY.begin();
+                 jt != mY.end();
+                 ++jt, ++it) {
+                ASSERTV(jt->first, jt->first  == it->first);
+                ASSERTV(jt->first, jt->second == it->second);
+            }
+            ASSERTV(mX.end() == it);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::btree_map' AND 'bsl::map'
+        //
+        // Concerns:
+        //: 1 Compare the speed of 'bsl::flat_map' with that of
+        //:   'bsl::btree_map' and 'bsl::map' for maps from 1,000 elements up
+        //:   to a size that may be specified on the command line.
+        //
+        // Plan:
+        //: 1 For sizes increasing by factors of 10 from 1,000 to the maximum
+        //:   size given as the second argument (1,000,000 by default), time
+        //:   building a map from an unordered array of distinct keys,
+        //:   successful and unsuccessful lookups, and an in-order scan,
+        //:   repeating the measurements for small sizes so that each size
+        //:   performs approximately the same number of operations.  Print the
+        //:   average time per element (or per lookup) in nanoseconds.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::btree_map' AND 'bsl::map'
+        // --------------------------------------------------------------------
+
+        const int MAX_SIZE = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        printf("\nPERFORMANCE: COMPARISON WITH 'bsl::btree_map' AND 'bsl::map'"
+               "\n============================================================"
+               "\n");
+
+        printf("%-10s %10s %9s %9s %9s %9s   (ns/op)\n",
+               "container", "size", "build", "find hit", "find miss", "scan");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            const int NUM_ROUNDS = size < 1000000 ? 1000000 / size : 1;
+
+            benchmark<bsl::flat_map<unsigned int, int> >(
+                                                "flat_map", size, NUM_ROUNDS);
+            benchmark<bsl::btree_map<unsigned int, int> >(
+                                               "btree_map", size, NUM_ROUNDS);
+            benchmark<bsl::map<unsigned int, int> >(
+                                               "map", size, NUM_ROUNDS);
+
+            if (MAX_SIZE / 10 < size) {
+                break;
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,827 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_multimap.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over 'bslstl::FlatTree',
+// which is tested thoroughly in its own component.  Accordingly, this test
+// driver concentrates on the forwarding of each method to the underlying
+// container, on the behavior specific to a multimap (the placement of
+// elements having equivalent keys, 'count', and 'equal_range'), and on the
+// type traits.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap(const COMPARATOR&, const allocator_type&);
+// [ 2] flat_multimap(const allocator_type& allocator);
+// [ 3] flat_multimap(const flat_multimap& original);
+// [ 3] flat_multimap(const flat_multimap&, const allocator_type&);
+// [ 2] flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] ~flat_multimap();
+//
+// MANIPULATORS
+// [ 3] flat_multimap& operator=(const flat_multimap& rhs);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 4] void clear();
+// [ 4] void reserve(size_type numElements);
+// [ 4] void shrink_to_fit();
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const key_type& key);
+// [ 2] iterator insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator lower_bound(const key_type& key);
+// [ 2] iterator upper_bound(const key_type& key);
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 3] void swap(flat_multimap& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 4] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] const_iterator lower_bound(const key_type& key) const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 2] const_iterator upper_bound(const key_type& key) const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 3] bool operator!=(const flat_multimap&, const flat_multimap&);
+// [ 3] bool operator<(const flat_multimap&, const flat_multimap&);
+// [ 3] bool operator>(const flat_multimap&, const flat_multimap&);
+// [ 3] bool operator<=(const flat_multimap&, const flat_multimap&);
+// [ 3] bool operator>=(const flat_multimap&, const flat_multimap&);
+// [ 3] void swap(flat_multimap& a, flat_multimap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_multimap<int, int>                  IntMap;
+typedef bsl::flat_multimap<int, bsltf::AllocTestType> Obj;
+typedef Obj::value_type                               Value;
+typedef bsl::pair<int, int>                           IntPair;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Greater {
+    // This 'struct' defines a comparator that orders 'int' values in
+    // descending order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Instrument
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the trades of a day, in order of execution, and want to
+// look up all of the trades of a given instrument.  We first define the
+// trades as pairs of an instrument identifier and a quantity:
+//..
+    typedef bsl::pair<int, int> Trade;  // (instrument, quantity)
+
+    static const Trade TRADES[] = {
+        Trade(7, 100),
+        Trade(3, 250),
+        Trade(7, -40),
+        Trade(5,  10),
+        Trade(3,  75),
+        Trade(7,  60),
+    };
+    const int NUM_TRADES = sizeof TRADES / sizeof *TRADES;
+//..
+// Then, we build a 'flat_multimap' from the trades in a single operation:
+//..
+    bslma::TestAllocator         oa("object");
+    bsl::flat_multimap<int, int> index(TRADES, TRADES + NUM_TRADES,
+                                       std::less<int>(),
+                                       &oa);
+    ASSERT(6 == index.size());
+    ASSERT(3 == index.count(7));
+//..
+// Now, we sum the quantities traded of instrument 7, which are adjacent in
+// the multimap:
+//..
+    typedef bsl::flat_multimap<int, int>::const_iterator ConstIterator;
+
+    bsl::pair<ConstIterator, ConstIterator> range = index.equal_range(7);
+
+    int total = 0;
+    for (ConstIterator it = range.first; it != range.second; ++it) {
+        total += it->second;
+    }
+    ASSERT(120 == total);
+//..
+// Finally, we record a late trade of instrument 5, which is placed after the
+// existing trade of that instrument:
+//..
+    index.insert(Trade(5, 20));
+    ASSERT(2  == index.count(5));
+    ASSERT(20 == (index.upper_bound(5) - 1)->second);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ERASURE AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes the specified elements, destroys
+        //:   them, and returns the documented value; erasing by key removes
+        //:   every element having the key.
+        //:
+        //: 2 'clear' removes and destroys all elements, retaining the
+        //:   capacity, which 'shrink_to_fit' then releases.
+        //:
+        //: 3 'reserve' allocates the storage for the elements in advance.
+        //
+        // Plan:
+        //: 1 Populate multimaps having several elements per key, erase
+        //:   elements with each overload, and verify the remaining elements
+        //:   and the memory in use.  (C-1..3)
+        //
+        // Testing:
+        //   void clear();
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ERASURE AND CAPACITY"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 100;
+        {
+            // Each key in '[0 .. N)' appears three times, mapped to the
+            // values 'key', 'key + N', and 'key + 2 * N' in that order.
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(3 * N);
+            ASSERTV(3 * N <= static_cast<int>(X.capacity()));
+            for (int j = 0; j < 3; ++j) {
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(Value(i, bsltf::AllocTestType(i + j * N)));
+                }
+            }
+            ASSERTV(3 * N == static_cast<int>(X.size()));
+
+            ASSERTV(3 == mX.erase(0));
+            ASSERTV(0 == mX.erase(0));
+            ASSERTV(3 * N - 3 == static_cast<int>(X.size()));
+            ASSERTV(1 == X.begin()->first);
+
+            // 'find' returns the first of the elements having the key.
+
+            Obj::iterator it = mX.erase(mX.find(1));
+            ASSERTV(1 == it->first);
+            ASSERTV(1 + N == it->second.data());
+            ASSERTV(2 == X.count(1));
+
+            it = mX.erase(X.lower_bound(10), X.upper_bound(19));
+            ASSERTV(20 == it->first);
+            ASSERTV(20 == it->second.data());
+            ASSERTV(0 == X.count(15));
+            ASSERTV(3 * N - 3 - 1 - 30 == static_cast<int>(X.size()));
+
+            it = mX.erase(X.end() - 1);
+            ASSERTV(X.end() == it);
+            ASSERTV(N - 1 + N == (X.end() - 1)->second.data());
+
+            it = mX.erase(X.begin(), X.end());
+            ASSERTV(X.end() == it);
+            ASSERTV(X.empty());
+
+            for (int i = 0; i < N; ++i) {
+                mX.insert(Value(i % 10, bsltf::AllocTestType(i)));
+            }
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(N <= static_cast<int>(X.capacity()));
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values, and do not change
+        //:   allocators.
+        //:
+        //: 3 Multimaps compare equal if and only if they have the same
+        //:   sequence of key-value pairs, so that the order of elements having
+        //:   equivalent keys is salient.
+        //:
+        //: 4 The relational operators order multimaps lexicographically.
+        //
+        // Plan:
+        //: 1 Create multimaps with various values, copy, assign, swap and
+        //:   compare them.  (C-1..4)
+        //
+        // Testing:
+        //   flat_multimap(const flat_multimap& original);
+        //   flat_multimap(const flat_multimap&, const allocator_type&);
+        //   flat_multimap& operator=(const flat_multimap& rhs);
+        //   void swap(flat_multimap& other);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator!=(const flat_multimap&, const flat_multimap&);
+        //   bool operator<(const flat_multimap&, const flat_multimap&);
+        //   bool operator>(const flat_multimap&, const flat_multimap&);
+        //   bool operator<=(const flat_multimap&, const flat_multimap&);
+        //   bool operator>=(const flat_multimap&, const flat_multimap&);
+        //   void swap(flat_multimap& a, flat_multimap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nTESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                        "\n==============================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(Value(i % 20, bsltf::AllocTestType(i)));
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+            ASSERTV(&da == Y.find(7)->second.allocator());
+
+            Obj mZ(X, &sa);  const Obj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+            ASSERTV(&sa == Z.find(7)->second.allocator());
+
+            // Swapping the values of two elements having the same key changes
+            // the value of the multimap.
+
+            Obj mW(X, &sa);  const Obj& W = mW;
+            ASSERTV(X == W);
+            Obj::iterator it = mW.find(3);
+            it->second.setData(23);
+            (it + 1)->second.setData(3);
+            ASSERTV(X != W);
+            ASSERTV(!(X == W));
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW.insert(Value(3, bsltf::AllocTestType(0)));
+            mZ.swap(mW);
+            ASSERTV(201 == Z.size());
+            ASSERTV(200 == W.size());
+            ASSERTV(11  == Z.count(3));
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            bsl::swap(mZ, mW);
+            ASSERTV(200 == Z.size());
+            ASSERTV(201 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            // Each multimap is lexicographically less than the next.  Each
+            // character of a specification is a key, mapped to 0 if the
+            // character is lower case, and to 1 (with the lower case key)
+            // otherwise.
+
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                { L_, ""     },
+                { L_, "a"    },
+                { L_, "aa"   },
+                { L_, "aab"  },
+                { L_, "aA"   },
+                { L_, "ab"   },
+                { L_, "A"    },
+                { L_, "Aa"   },
+                { L_, "b"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    IntMap mU(&oa);  const IntMap& U = mU;
+                    IntMap mV(&oa);  const IntMap& V = mV;
+
+                    for (const char *s = DATA[ti].d_spec; *s; ++s) {
+                        const bool UPPER = *s < 'a';
+                        mU.insert(IntPair(UPPER ? *s - 'A' : *s - 'a', UPPER));
+                    }
+                    for (const char *s = DATA[tj].d_spec; *s; ++s) {
+                        const bool UPPER = *s < 'a';
+                        mV.insert(IntPair(UPPER ? *s - 'A' : *s - 'a', UPPER));
+                    }
+
+                    if (veryVerbose) {
+                        T_ P_(DATA[ti].d_spec) P(DATA[tj].d_spec)
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (U == V));
+                    ASSERTV(ti, tj, (ti != tj) == (U != V));
+                    ASSERTV(ti, tj, (ti <  tj) == (U <  V));
+                    ASSERTV(ti, tj, (ti >  tj) == (U >  V));
+                    ASSERTV(ti, tj, (ti <= tj) == (U <= V));
+                    ASSERTV(ti, tj, (ti >= tj) == (U >= V));
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS, INSERTION, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified comparator and allocator,
+        //:   and allocates only if a non-empty range is supplied.
+        //:
+        //: 2 Each 'insert' overload inserts every value, placing a value
+        //:   inserted singly after the elements having an equivalent key,
+        //:   and before the hint when the hint is a valid position.
+        //:
+        //: 3 The lookup methods find exactly the inserted keys, 'count'
+        //:   returns the number of elements having a key, and the bounds are
+        //:   consistent with the order of the comparator.
+        //:
+        //: 4 Forward and reverse iteration visit the elements in order.
+        //:
+        //: 5 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct multimaps with each constructor, insert and look up
+        //:   keys, and verify the results and the memory used.  (C-1..4)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-5)
+        //
+        // Testing:
+        //   flat_multimap(const COMPARATOR&, const allocator_type&);
+        //   flat_multimap(const allocator_type& allocator);
+        //   flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   ~flat_multimap();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator find(const key_type& key);
+        //   iterator insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTORS, INSERTION, AND LOOKUP"
+                            "\n===========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Value,
+                                   bsl::pair<int,
+                                             bsltf::AllocTestType> >::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::key_compare, std::less<int> >::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            IntMap mA;  const IntMap& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(0 < A.max_size());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(A.cbegin() == A.cend());
+            ASSERTV(A.rbegin() == A.rend());
+            ASSERTV(A.crbegin() == A.crend());
+            ASSERTV(mA.begin() == mA.end());
+            ASSERTV(mA.rbegin() == mA.rend());
+
+            IntMap mB(&oa);  const IntMap& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+
+            bsl::flat_multimap<int, int, Greater> mC(Greater(), &oa);
+            const bsl::flat_multimap<int, int, Greater>& C = mC;
+            ASSERTV(C.empty());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            static const int DATA[][2] = {
+                { 1, 10 }, { 2, 20 }, { 3, 30 }, { 2, 99 }, { 4, 40 }
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            IntPair values[NUM_DATA];
+            for (int i = 0; i < NUM_DATA; ++i) {
+                values[i] = IntPair(DATA[i][0], DATA[i][1]);
+            }
+
+            IntMap mD(values, values + NUM_DATA, std::less<int>(), &oa);
+            const IntMap& D = mD;
+            ASSERTV(5 == D.size());
+            ASSERTV(2 == D.count(2));
+            ASSERTV(1 == D.begin()->first);
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            bsl::flat_multimap<int, int, Greater> mE(values,
+                                                     values + NUM_DATA,
+                                                     Greater(),
+                                                     &oa);
+            const bsl::flat_multimap<int, int, Greater>& E = mE;
+            ASSERTV(5 == E.size());
+            ASSERTV(4 == E.begin()->first);
+            ASSERTV(1 == E.rbegin()->first);
+            ASSERTV(E.key_comp()(2, 1));
+            ASSERTV(E.value_comp()(*E.begin(), *E.rbegin()));
+            ASSERTV(3 == E.lower_bound(3)->first);
+            ASSERTV(2 == E.upper_bound(3)->first);
+            ASSERTV(1 == E.upper_bound(2)->first);
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion and lookup.\n");
+        {
+            IntMap mX(&oa);  const IntMap& X = mX;
+
+            // Insert each even key in '[0 .. 200)' 'key % 5' times, in a
+            // scattered order, each time mapped to the number of earlier
+            // insertions of the key.
+
+            for (int j = 0; j < 5; ++j) {
+                for (int i = 0; i < 100; ++i) {
+                    const int KEY = (i * 37 % 100) * 2;
+
+                    if (j < KEY % 5) {
+                        IntMap::iterator it = mX.insert(IntPair(KEY, j));
+                        ASSERTV(i, j, KEY == it->first);
+                        ASSERTV(i, j, j   == it->second);
+                        ASSERTV(i, j, X.upper_bound(KEY) == it + 1);
+                    }
+                }
+            }
+            ASSERTV(X.key_comp()(1, 2));
+            ASSERTV(X.value_comp()(*X.begin(), *X.rbegin()));
+
+            for (int i = -10; i < 210; ++i) {
+                const int COUNT = 0 <= i && i < 200 && 0 == i % 2 ? i % 5 : 0;
+
+                ASSERTV(i, COUNT == static_cast<int>(X.count(i)));
+                ASSERTV(i, (0 < COUNT) == (X.end() != X.find(i)));
+                ASSERTV(i, (0 < COUNT) == (mX.end() != mX.find(i)));
+                if (COUNT) {
+                    ASSERTV(i, X.find(i) == X.lower_bound(i));
+                    ASSERTV(i, 0 == X.find(i)->second);
+                }
+
+                bsl::pair<IntMap::const_iterator, IntMap::const_iterator> cr =
+                                                             X.equal_range(i);
+                bsl::pair<IntMap::iterator, IntMap::iterator> mr =
+                                                            mX.equal_range(i);
+                ASSERTV(i, cr.first == mr.first);
+                ASSERTV(i, cr.second == mr.second);
+                ASSERTV(i, X.lower_bound(i) == cr.first);
+                ASSERTV(i, X.upper_bound(i) == cr.second);
+                ASSERTV(i, mX.lower_bound(i) == mr.first);
+                ASSERTV(i, mX.upper_bound(i) == mr.second);
+                ASSERTV(i, COUNT == cr.second - cr.first);
+
+                int expected = 0;
+                for (IntMap::const_iterator it = cr.first;
+                     it != cr.second;
+                     ++it, ++expected) {
+                    ASSERTV(i, expected == it->second);
+                }
+            }
+
+            int count = 0;
+            for (IntMap::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++count;
+            }
+            ASSERTV(count == static_cast<int>(X.size()));
+            for (IntMap::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                --count;
+                if (it != X.crbegin()) {
+                    ASSERTV(count, !X.key_comp()((it - 1)->first, it->first));
+                }
+            }
+            ASSERTV(0 == count);
+            ASSERTV(mX.rbegin() + X.size() == mX.rend());
+            ASSERTV(X.rbegin() + X.size() == X.rend());
+
+            // A hint at a valid position places the value immediately before
+            // it, even among elements having an equivalent key.
+
+            const IntMap::const_iterator HINT = X.find(8) + 1;
+            IntMap::iterator it = mX.insert(HINT, IntPair(8, -1));
+            ASSERTV(8  == it->first);
+            ASSERTV(-1 == it->second);
+            ASSERTV(0  == (it - 1)->second);
+            ASSERTV(1  == (it + 1)->second);
+
+            // Otherwise, the value is placed as close to the hint as
+            // possible, here before the elements having an equivalent key.
+
+            it = mX.insert(X.begin(), IntPair(8, -2));
+            ASSERTV(-2 == it->second);
+            ASSERTV(it == X.find(8));
+            ASSERTV(5  == X.count(8));
+
+            // Insert a range, whose elements follow those already present.
+
+            const int SIZE = static_cast<int>(X.size());
+
+            IntPair values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = IntPair(190 + i / 2, 100 + i % 2);
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(SIZE + 20 == static_cast<int>(X.size()));
+            ASSERTV(6 == X.count(194));
+            ASSERTV(100 <= (X.upper_bound(194) - 1)->second);
+            ASSERTV(2 == X.count(199));
+            ASSERTV(199 == X.rbegin()->first);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, count, and erase elements, and compare the results with
+        //:   those of a 'bsl::multimap'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            IntMap                  mX(&oa);
+            bsl::multimap<int, int> mY(&oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 500);
+
+                switch (seed % 4) {
+                  case 0:
+                  case 1: {
+                    mX.insert(IntPair(KEY, i));
+                    mY.insert(IntPair(KEY, i));
+                  } break;
+                  case 2: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+
+            IntMap::const_iterator it = mX.begin();
+            for (bsl::multimap<int, int>::const_iterator jt = mY.begin();
+                 jt != mY.end();
+                 ++jt, ++it) {
+                ASSERTV(jt->first, jt->first  == it->first);
+                ASSERTV(jt->first, jt->second == it->second);
+            }
+            ASSERTV(mX.end() == it);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
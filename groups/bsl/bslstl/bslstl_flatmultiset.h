@@ -0,0 +1,947 @@
+// bslstl_flatmultiset.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTISET
+#define INCLUDED_BSLSTL_FLATMULTISET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multiset held contiguously in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multiset : sorted-vector-based ordered multiset container
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmultimap, bslstl_flattree,
+//           bslstl_multiset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multiset', implementing a container holding an ordered sequence
+// of keys, possibly with several equivalent keys.  The interface of
+// 'flat_multiset' is that of 'bsl::multiset', except that its keys are held in
+// a vector, so that insertion and erasure invalidate iterators.
+//
+// An instantiation of 'flat_multiset' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_multiset' contains.  Memory is supplied by the
+// (template parameter) type 'ALLOCATOR', which defaults to 'bsl::allocator',
+// and so uses the 'bslma::Allocator' protocol exactly as 'bsl::multiset'
+// does.
+//
+// 'flat_multiset' is implemented by 'bslstl::FlatTree', exactly as
+// 'bsl::flat_set' is, and has the same performance characteristics and
+// guarantees (see 'bslstl_flatmap').  Equivalent keys are held in the order
+// in which they were inserted one at a time, as for 'bsl::multiset'; keys
+// inserted together as a range follow any equivalent keys already in the
+// multiset, but their relative order is unspecified.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summarizing Sampled Latencies
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have sampled the latency, in milliseconds, of a number of
+// requests, and want to report their median and the number of slow requests.
+// Latencies recur, so we hold the samples in a 'flat_multiset', built in a
+// single operation from the unordered samples:
+//..
+//  static const int SAMPLES[] = { 12, 7, 30, 7, 15, 12, 7, 45, 20, 12, 9 };
+//  const int NUM_SAMPLES = sizeof SAMPLES / sizeof *SAMPLES;
+//
+//  bslma::TestAllocator    oa("object");
+//  bsl::flat_multiset<int> latencies(SAMPLES,
+//                                    SAMPLES + NUM_SAMPLES,
+//                                    std::less<int>(),
+//                                    &oa);
+//  assert(11 == latencies.size());
+//  assert( 3 == latencies.count(7));
+//..
+// Then, since the iterators of a 'flat_multiset' are random-access, we find
+// the median sample in constant time:
+//..
+//  assert(12 == *(latencies.begin() + latencies.size() / 2));
+//..
+// Finally, we count the requests slower than 20 milliseconds, and the
+// requests that took exactly 12 milliseconds:
+//..
+//  assert(2 == latencies.end() - latencies.upper_bound(20));
+//
+//  bsl::pair<bsl::flat_multiset<int>::const_iterator,
+//            bsl::flat_multiset<int>::const_iterator> range =
+//                                                  latencies.equal_range(12);
+//  assert(3 == range.second - range.first);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_flatmultiset.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#include <bslstl_flattree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                        // ===================
+                        // class flat_multiset
+                        // ===================
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class flat_multiset {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of possibly equivalent keys (of template parameter
+    // type 'KEY'), stored contiguously in a sorted vector.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY>
+                                                             TreeConfiguration;
+        // This 'typedef' is an alias for the policy used internally by this
+        // multiset to extract the 'KEY' value from the keys it maintains.
+
+    typedef BloombergLP::bslstl::FlatTree<TreeConfiguration,
+                                          COMPARATOR,
+                                          ALLOCATOR> Tree;
+        // This 'typedef' is an alias for the template instantiation of the
+        // underlying 'bslstl::FlatTree' used to implement this container.
+
+    // FRIENDS
+    template <class KEY2, class COMPARATOR2, class ALLOCATOR2>
+    friend bool operator==(
+                          const flat_multiset<KEY2, COMPARATOR2, ALLOCATOR2>&,
+                          const flat_multiset<KEY2, COMPARATOR2, ALLOCATOR2>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+                         flat_multiset,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable,
+                         ::BloombergLP::bslmf::IsBitwiseMoveable<Tree>::value);
+
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef typename allocator_type::reference         reference;
+    typedef typename allocator_type::const_reference   const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::ConstIterator               iterator;
+    typedef typename Tree::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_impl;  // underlying sorted vector used by this multiset
+
+  public:
+    // CREATORS
+    explicit flat_multiset(
+                          const COMPARATOR&     comparator = COMPARATOR(),
+                          const allocator_type& allocator  = allocator_type());
+        // Create an empty multiset.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify an 'allocator' used to supply memory.  If
+        // 'allocator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'allocator_type' is used.  If the
+        // 'allocator_type' is 'bsl::allocator' (the default), then 'allocator'
+        // shall be convertible to 'bslma::Allocator *', and if 'allocator' is
+        // not supplied, the currently installed default allocator is used.
+        // Note that no memory is allocated until a key is inserted.
+
+    explicit flat_multiset(const allocator_type& allocator);
+        // Create an empty multiset that uses the specified 'allocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order keys.  If the 'allocator_type'
+        // is 'bsl::allocator' (the default), then 'allocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_multiset(const flat_multiset& original);
+        // Create a multiset having the same value and comparator as the
+        // specified 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<allocator_type>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.  If the 'allocator_type' is 'bsl::allocator' (the
+        // default), the currently installed default allocator is used.
+
+    flat_multiset(const flat_multiset&  original,
+                  const allocator_type& allocator);
+        // Create a multiset having the same value and comparator as the
+        // specified 'original', and using the specified 'allocator' to supply
+        // memory.  If the 'allocator_type' is 'bsl::allocator' (the default),
+        // then 'allocator' shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const COMPARATOR&     comparator = COMPARATOR(),
+                  const allocator_type& allocator  = allocator_type());
+        // Create a multiset, and insert into it a 'value_type' object
+        // converted from each element in the range starting at the specified
+        // 'first' iterator and ending immediately before the specified 'last'
+        // iterator.  Optionally specify a 'comparator' and an 'allocator'
+        // having the same meaning as for the default constructor.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  Note that the relative order of equivalent
+        // elements is unspecified, and that the sequence is copied and sorted
+        // once, and is not sorted if it is already ordered.
+
+    ~flat_multiset();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    flat_multiset& operator=(const flat_multiset& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    void clear();
+        // Remove all keys from this multiset, retaining its capacity.
+
+    iterator erase(const_iterator position);
+        // Remove from this multiset the key at the specified 'position', and
+        // return an iterator referring to the key immediately following the
+        // removed key, or to the past-the-end position if the removed key was
+        // the last key in this multiset.  The behavior is undefined unless
+        // 'position' refers to a key in this multiset.  Note that an erasure
+        // invalidates all other iterators, pointers, and references to the
+        // elements of this multiset.
+
+    size_type erase(const key_type& key);
+        // Remove from this multiset all keys equivalent to the specified
+        // 'key', and return the number of keys removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multiset the keys starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the key that was at 'last' (or
+        // 'end()').  The behavior is undefined unless 'first' and 'last'
+        // either refer to keys in this multiset or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    iterator insert(const value_type& value);
+        // Insert the specified 'value' into this multiset, after any keys
+        // equivalent to 'value', and return an iterator referring to the
+        // newly inserted key.  Note that an insertion invalidates all
+        // iterators, pointers, and references to the elements of this
+        // multiset.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this multiset, as close as
+        // possible to the position immediately before the specified 'hint',
+        // and return an iterator referring to the newly inserted key.  If
+        // 'value' can be inserted immediately before 'hint' without violating
+        // the ordering of this multiset, no search is performed.  The
+        // behavior is undefined unless 'hint' is a valid iterator into this
+        // multiset.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create a 'value_type' object for each iterator in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator, and insert each such object into this multiset,
+        // after any keys already contained that are equivalent to it.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  Note that the relative order of the inserted keys
+        // that are equivalent is unspecified, and that the range is copied,
+        // sorted once, and merged with the keys of this multiset, so that
+        // inserting 'N' keys takes 'O[N * log(N) + size()]' time.
+
+    void reserve(size_type numElements);
+        // Ensure that this multiset can hold the specified 'numElements' keys
+        // without reallocating its storage.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multiset to its size, if possible.
+
+    void swap(flat_multiset& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee and guarantees O[1] complexity,
+        // as long as the (template parameter) type 'COMPARATOR' does not throw
+        // when swapped.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this multiset, or the 'end' iterator if
+        // this multiset is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this multiset.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last (i.e., ordered greatest) key in this multiset, or 'rend' if
+        // this multiset is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this multiset.
+
+    size_type capacity() const;
+        // Return the number of keys this multiset can hold without
+        // reallocating its storage.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys in this multiset equivalent to the
+        // specified 'key'.
+
+    bool empty() const;
+        // Return 'true' if this multiset contains no elements, and 'false'
+        // otherwise.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this multiset equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the
+        // sequence, and the second is positioned one past the end of the
+        // sequence.  If this multiset contains no key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // key in this multiset equivalent to the specified 'key', if such a
+        // key exists, and the past-the-end iterator ('end') otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multiset.
+
+    key_compare key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this multiset.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this multiset that is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // multiset does not contain such a key.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multiset could possibly hold.  Note that there is no
+        // guarantee that the multiset can successfully grow to the returned
+        // size, or even close to that size, without running out of resources.
+
+    size_type size() const;
+        // Return the number of elements in this multiset.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this multiset that is greater than the
+        // specified 'key', and the past-the-end iterator if this multiset does
+        // not contain such a key.
+
+    value_compare value_comp() const;
+        // Return (a copy of) the key-comparison functor used by this multiset.
+        // Note that the keys of a multiset are its values.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multiset' objects have the
+    // same value if they have the same number of keys, and each key that is
+    // contained in 'lhs' has the same value as the key at the same position
+    // in 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multiset' objects do not
+    // have the same value if they do not have the same number of keys, or
+    // some key that is contained in 'lhs' does not have the same value as the
+    // key at the same position in 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of multiset 'lhs' is lexicographically less than that of
+    // multiset 'rhs' if 'true == *i < *j' for the first pair of corresponding
+    // iterator positions where '*i' and '*j' differ, or if 'rhs' is longer
+    // than 'lhs' and every key of 'lhs' compares equal to the corresponding
+    // key of 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' object with
+    // those of the specified 'b' object.  This function provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity, as long as
+    // the (template parameter) type 'COMPARATOR' does not throw when swapped.
+    // The behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                        // -------------------
+                        // class flat_multiset
+                        // -------------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                              const COMPARATOR&     comparator,
+                                              const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                               const allocator_type& allocator)
+: d_impl(allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                                 const flat_multiset& original)
+: d_impl(original.d_impl)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                               const flat_multiset&  original,
+                                               const allocator_type& allocator)
+: d_impl(original.d_impl, allocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                              INPUT_ITERATOR        first,
+                                              INPUT_ITERATOR        last,
+                                              const COMPARATOR&     comparator,
+                                              const allocator_type& allocator)
+: d_impl(comparator, allocator)
+{
+    this->insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::~flat_multiset()
+{
+    // All memory management is handled by the base 'd_impl' member.
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multiset& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_impl.insertMulti(value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                  const value_type& value)
+{
+    return d_impl.insertMulti(hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    d_impl.insertMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reserve(
+                                                        size_type numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::swap(flat_multiset& other)
+{
+    BSLS_ASSERT_SAFE(this->get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multiset<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR flat_multiset<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_impl.comparator();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'flat_multiset':
+//: o A 'flat_multiset' defines STL iterators.
+//: o A 'flat_multiset' is bit-wise moveable if the comparator and the
+//:   allocator are bit-wise moveable.
+//: o A 'flat_multiset' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,781 @@
+// bslstl_flatmultiset.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultiset.h>
+
+#include <bslstl_multiset.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a container adapter over 'bslstl::FlatTree',
+// which is tested thoroughly in its own component.  Accordingly, this test
+// driver concentrates on the forwarding of each method to the underlying
+// container, on the behavior specific to a multiset (the placement of
+// equivalent keys, 'count', and 'equal_range'), and on the type traits.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multiset(const COMPARATOR&, const allocator_type&);
+// [ 2] flat_multiset(const allocator_type& allocator);
+// [ 3] flat_multiset(const flat_multiset& original);
+// [ 3] flat_multiset(const flat_multiset&, const allocator_type&);
+// [ 2] flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] ~flat_multiset();
+//
+// MANIPULATORS
+// [ 3] flat_multiset& operator=(const flat_multiset& rhs);
+// [ 4] void clear();
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void reserve(size_type numElements);
+// [ 4] void shrink_to_fit();
+// [ 3] void swap(flat_multiset& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 4] size_type capacity() const;
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const_iterator find(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] const_iterator lower_bound(const key_type& key) const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 2] const_iterator upper_bound(const key_type& key) const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const flat_multiset&, const flat_multiset&);
+// [ 3] bool operator!=(const flat_multiset&, const flat_multiset&);
+// [ 3] bool operator<(const flat_multiset&, const flat_multiset&);
+// [ 3] bool operator>(const flat_multiset&, const flat_multiset&);
+// [ 3] bool operator<=(const flat_multiset&, const flat_multiset&);
+// [ 3] bool operator>=(const flat_multiset&, const flat_multiset&);
+// [ 3] void swap(flat_multiset& a, flat_multiset& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: The type traits are correctly declared.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct TensLess {
+    // This 'struct' defines a comparator that orders 'int' values by their
+    // quotient by 10, so that, for example, 31 and 35 are equivalent but
+    // distinguishable.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the quotient by 10 of the specified 'lhs' is less
+        // than that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 10 < rhs / 10;
+    }
+};
+
+struct Greater {
+    // This 'struct' defines a comparator that orders 'int' values in
+    // descending order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_multiset<int>           Obj;
+typedef bsl::flat_multiset<int, TensLess> TensObj;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summarizing Sampled Latencies
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have sampled the latency, in milliseconds, of a number of
+// requests, and want to report their median and the number of slow requests.
+// Latencies recur, so we hold the samples in a 'flat_multiset', built in a
+// single operation from the unordered samples:
+//..
+    static const int SAMPLES[] = { 12, 7, 30, 7, 15, 12, 7, 45, 20, 12, 9 };
+    const int NUM_SAMPLES = sizeof SAMPLES / sizeof *SAMPLES;
+
+    bslma::TestAllocator    oa("object");
+    bsl::flat_multiset<int> latencies(SAMPLES,
+                                      SAMPLES + NUM_SAMPLES,
+                                      std::less<int>(),
+                                      &oa);
+    ASSERT(11 == latencies.size());
+    ASSERT( 3 == latencies.count(7));
+//..
+// Then, since the iterators of a 'flat_multiset' are random-access, we find
+// the median sample in constant time:
+//..
+    ASSERT(12 == *(latencies.begin() + latencies.size() / 2));
+//..
+// Finally, we count the requests slower than 20 milliseconds, and the
+// requests that took exactly 12 milliseconds:
+//..
+    ASSERT(2 == latencies.end() - latencies.upper_bound(20));
+
+    bsl::pair<bsl::flat_multiset<int>::const_iterator,
+              bsl::flat_multiset<int>::const_iterator> range =
+                                                    latencies.equal_range(12);
+    ASSERT(3 == range.second - range.first);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ERASURE AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes the specified keys and returns the
+        //:   documented value; erasing by key removes every equivalent key.
+        //:
+        //: 2 'clear' removes all keys, retaining the capacity, which
+        //:   'shrink_to_fit' then releases.
+        //:
+        //: 3 'reserve' allocates the storage for the keys in advance.
+        //
+        // Plan:
+        //: 1 Populate multisets having several equivalent keys, erase keys
+        //:   with each overload, and verify the remaining keys and the memory
+        //:   in use.  (C-1..3)
+        //
+        // Testing:
+        //   void clear();
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type capacity() const;
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ERASURE AND CAPACITY"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 100;
+        {
+            // Each class '[10 * i .. 10 * i + 10)' for 'i' in '[0 .. N)' holds
+            // the keys '10 * i', '10 * i + 1', and '10 * i + 2', inserted in
+            // that order.
+
+            TensObj mX(&oa);  const TensObj& X = mX;
+            mX.reserve(3 * N);
+            ASSERTV(3 * N <= static_cast<int>(X.capacity()));
+            ASSERTV(1 == oa.numBlocksTotal());
+            for (int j = 0; j < 3; ++j) {
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(10 * i + j);
+                }
+            }
+            ASSERTV(3 * N == static_cast<int>(X.size()));
+            ASSERTV(1 == oa.numBlocksTotal());
+
+            ASSERTV(3 == mX.erase(0));
+            ASSERTV(0 == mX.erase(5));
+            ASSERTV(3 * N - 3 == static_cast<int>(X.size()));
+            ASSERTV(10 == *X.begin());
+
+            // 'find' returns the first of the equivalent keys.
+
+            TensObj::iterator it = mX.erase(X.find(15));
+            ASSERTV(11 == *it);
+            ASSERTV(2  == X.count(10));
+
+            it = mX.erase(X.lower_bound(100), X.upper_bound(190));
+            ASSERTV(200 == *it);
+            ASSERTV(0 == X.count(150));
+            ASSERTV(3 * N - 3 - 1 - 30 == static_cast<int>(X.size()));
+
+            it = mX.erase(X.end() - 1);
+            ASSERTV(X.end() == it);
+            ASSERTV(10 * (N - 1) + 1 == *(X.end() - 1));
+
+            it = mX.erase(X.begin(), X.end());
+            ASSERTV(X.end() == it);
+            ASSERTV(X.empty());
+
+            for (int i = 0; i < N; ++i) {
+                mX.insert(i % 10);
+            }
+            mX.clear();
+            ASSERTV(X.empty());
+            ASSERTV(N <= static_cast<int>(X.capacity()));
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+            ASSERTV(0 == X.capacity());
+            ASSERTV(0 == oa.numBlocksInUse());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the same value as the original and use the expected
+        //:   allocator.
+        //:
+        //: 2 Assignment and 'swap' exchange values, and do not change
+        //:   allocators.
+        //:
+        //: 3 Multisets compare equal if and only if they have the same
+        //:   sequence of keys, so that the order of equivalent keys is
+        //:   salient.
+        //:
+        //: 4 The relational operators order multisets lexicographically.
+        //
+        // Plan:
+        //: 1 Create multisets with various values, copy, assign, swap and
+        //:   compare them.  (C-1..4)
+        //
+        // Testing:
+        //   flat_multiset(const flat_multiset& original);
+        //   flat_multiset(const flat_multiset&, const allocator_type&);
+        //   flat_multiset& operator=(const flat_multiset& rhs);
+        //   void swap(flat_multiset& other);
+        //   bool operator==(const flat_multiset&, const flat_multiset&);
+        //   bool operator!=(const flat_multiset&, const flat_multiset&);
+        //   bool operator<(const flat_multiset&, const flat_multiset&);
+        //   bool operator>(const flat_multiset&, const flat_multiset&);
+        //   bool operator<=(const flat_multiset&, const flat_multiset&);
+        //   bool operator>=(const flat_multiset&, const flat_multiset&);
+        //   void swap(flat_multiset& a, flat_multiset& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nTESTING COPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                        "\n==============================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            TensObj mX(&oa);  const TensObj& X = mX;
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(i % 20 * 10 + i / 20);
+            }
+
+            TensObj mY(X);  const TensObj& Y = mY;
+            ASSERTV(X == Y);
+            ASSERTV(&da == Y.get_allocator().mechanism());
+
+            TensObj mZ(X, &sa);  const TensObj& Z = mZ;
+            ASSERTV(X == Z);
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            // Inserting equivalent keys in a different order changes the
+            // value of the multiset.
+
+            TensObj mW(&sa);  const TensObj& W = mW;
+            for (int i = 199; 0 <= i; --i) {
+                mW.insert(i % 20 * 10 + i / 20);
+            }
+            ASSERTV(X.size() == W.size());
+            ASSERTV(X != W);
+            ASSERTV(!(X == W));
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(&sa == W.get_allocator().mechanism());
+
+            mW.insert(35);
+            mZ.swap(mW);
+            ASSERTV(201 == Z.size());
+            ASSERTV(200 == W.size());
+            ASSERTV(11  == Z.count(30));
+            ASSERTV(&sa == Z.get_allocator().mechanism());
+
+            bsl::swap(mZ, mW);
+            ASSERTV(200 == Z.size());
+            ASSERTV(201 == W.size());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            // Each multiset is lexicographically less than the next.  Each
+            // character of a specification is a key.
+
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                { L_, ""     },
+                { L_, "a"    },
+                { L_, "aa"   },
+                { L_, "aaa"  },
+                { L_, "aab"  },
+                { L_, "ab"   },
+                { L_, "abb"  },
+                { L_, "b"    },
+                { L_, "bb"   },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    Obj mU(&oa);  const Obj& U = mU;
+                    Obj mV(&oa);  const Obj& V = mV;
+
+                    for (const char *s = DATA[ti].d_spec; *s; ++s) {
+                        mU.insert(*s);
+                    }
+                    for (const char *s = DATA[tj].d_spec; *s; ++s) {
+                        mV.insert(*s);
+                    }
+
+                    if (veryVerbose) {
+                        T_ P_(DATA[ti].d_spec) P(DATA[tj].d_spec)
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (U == V));
+                    ASSERTV(ti, tj, (ti != tj) == (U != V));
+                    ASSERTV(ti, tj, (ti <  tj) == (U <  V));
+                    ASSERTV(ti, tj, (ti >  tj) == (U >  V));
+                    ASSERTV(ti, tj, (ti <= tj) == (U <= V));
+                    ASSERTV(ti, tj, (ti >= tj) == (U >= V));
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS, INSERTION, AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified comparator and allocator,
+        //:   and allocates only if a non-empty range is supplied.
+        //:
+        //: 2 Each 'insert' overload inserts every key, placing a key inserted
+        //:   singly after the equivalent keys, and before the hint when the
+        //:   hint is a valid position.
+        //:
+        //: 3 The lookup methods find exactly the inserted keys, 'count'
+        //:   returns the number of equivalent keys, and the bounds are
+        //:   consistent with the order of the comparator.
+        //:
+        //: 4 Forward and reverse iteration visit the keys in order.
+        //:
+        //: 5 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Construct multisets with each constructor, insert and look up
+        //:   keys, and verify the results and the memory used.  (C-1..4)
+        //:
+        //: 2 Verify the traits with 'BSLMF_ASSERT'.  (C-5)
+        //
+        // Testing:
+        //   flat_multiset(const COMPARATOR&, const allocator_type&);
+        //   flat_multiset(const allocator_type& allocator);
+        //   flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   ~flat_multiset();
+        //   iterator insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   size_type count(const key_type& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const key_type& key) const;
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   value_compare value_comp() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONSTRUCTORS, INSERTION, AND LOOKUP"
+                            "\n===========================================\n");
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Obj::value_type, int>::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::iterator,
+                                   Obj::const_iterator>::value));
+        BSLMF_ASSERT((bsl::is_same<Obj::key_compare, std::less<int> >::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting constructors.\n");
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERTV(&da == A.get_allocator().mechanism());
+            ASSERTV(A.empty());
+            ASSERTV(0 < A.max_size());
+            ASSERTV(A.begin() == A.end());
+            ASSERTV(A.cbegin() == A.cend());
+            ASSERTV(A.rbegin() == A.rend());
+            ASSERTV(A.crbegin() == A.crend());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERTV(&oa == B.get_allocator().mechanism());
+
+            bsl::flat_multiset<int, Greater> mC(Greater(), &oa);
+            const bsl::flat_multiset<int, Greater>& C = mC;
+            ASSERTV(C.empty());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            static const int DATA[] = { 1, 2, 3, 2, 4 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Obj mD(DATA, DATA + NUM_DATA, std::less<int>(), &oa);
+            const Obj& D = mD;
+            ASSERTV(5 == D.size());
+            ASSERTV(2 == D.count(2));
+            ASSERTV(1 == *D.begin());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            bsl::flat_multiset<int, Greater> mE(DATA,
+                                                DATA + NUM_DATA,
+                                                Greater(),
+                                                &oa);
+            const bsl::flat_multiset<int, Greater>& E = mE;
+            ASSERTV(5 == E.size());
+            ASSERTV(4 == *E.begin());
+            ASSERTV(1 == *E.rbegin());
+            ASSERTV(E.key_comp()(2, 1));
+            ASSERTV(E.value_comp()(2, 1));
+            ASSERTV(3 == *E.lower_bound(3));
+            ASSERTV(2 == *E.upper_bound(3));
+            ASSERTV(1 == *E.upper_bound(2));
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting insertion and lookup.\n");
+        {
+            TensObj mX(&oa);  const TensObj& X = mX;
+
+            // Insert 'i % 5' keys equivalent to '10 * i', for each 'i' in
+            // '[0 .. 100)', in a scattered order; the 'j'th key inserted in
+            // each class is '10 * i + j'.
+
+            for (int j = 0; j < 5; ++j) {
+                for (int i = 0; i < 100; ++i) {
+                    const int CLASS = i * 37 % 100;
+
+                    if (j < CLASS % 5) {
+                        TensObj::iterator it = mX.insert(10 * CLASS + j);
+                        ASSERTV(i, j, 10 * CLASS + j == *it);
+                        ASSERTV(i, j, X.upper_bound(10 * CLASS) == it + 1);
+                    }
+                }
+            }
+            ASSERTV(X.key_comp()(9, 10));
+            ASSERTV(!X.value_comp()(10, 19));
+
+            for (int i = -2; i < 102; ++i) {
+                const int COUNT = 0 <= i && i < 100 ? i % 5 : 0;
+                const int KEY   = 10 * i + 9;
+
+                ASSERTV(i, COUNT == static_cast<int>(X.count(KEY)));
+                ASSERTV(i, (0 < COUNT) == (X.end() != X.find(KEY)));
+                if (COUNT) {
+                    ASSERTV(i, X.find(KEY) == X.lower_bound(KEY));
+                    ASSERTV(i, 10 * i == *X.find(KEY));
+                }
+
+                bsl::pair<TensObj::const_iterator,
+                          TensObj::const_iterator> range = X.equal_range(KEY);
+                ASSERTV(i, X.lower_bound(KEY) == range.first);
+                ASSERTV(i, X.upper_bound(KEY) == range.second);
+                ASSERTV(i, COUNT == range.second - range.first);
+
+                int expected = 10 * i;
+                for (TensObj::const_iterator it = range.first;
+                     it != range.second;
+                     ++it, ++expected) {
+                    ASSERTV(i, expected == *it);
+                }
+            }
+
+            int count = 0;
+            for (TensObj::const_iterator it = X.cbegin(); it != X.cend(); ++it)
+            {
+                ++count;
+            }
+            ASSERTV(count == static_cast<int>(X.size()));
+            for (TensObj::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it) {
+                --count;
+                if (it != X.crbegin()) {
+                    ASSERTV(count, *it < *(it - 1));
+                }
+            }
+            ASSERTV(0 == count);
+            ASSERTV(X.rbegin() + X.size() == X.rend());
+
+            // A hint at a valid position places the key immediately before
+            // it, even among equivalent keys.
+
+            const TensObj::const_iterator HINT = X.find(80) + 1;
+            TensObj::iterator it = mX.insert(HINT, 89);
+            ASSERTV(89 == *it);
+            ASSERTV(80 == *(it - 1));
+            ASSERTV(81 == *(it + 1));
+
+            // Otherwise, the key is placed as close to the hint as possible,
+            // here before the equivalent keys.
+
+            it = mX.insert(X.begin(), 88);
+            ASSERTV(88 == *it);
+            ASSERTV(it == X.find(80));
+            ASSERTV(5  == X.count(80));
+
+            // Insert a range, whose keys follow those already present.
+
+            const int SIZE = static_cast<int>(X.size());
+
+            int values[20];
+            for (int i = 0; i < 20; ++i) {
+                values[i] = 940 + i / 2 * 10 + 5 + i % 2;
+            }
+            mX.insert(values, values + 20);
+            ASSERTV(SIZE + 20 == static_cast<int>(X.size()));
+            ASSERTV(6 == X.count(940));
+            ASSERTV(945 <= *(X.upper_bound(940) - 1));
+            ASSERTV(2 == X.count(1030));
+            ASSERTV(1036 == *X.rbegin() || 1035 == *X.rbegin());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, count, and erase keys, and compare the results with
+        //:   those of a 'bsl::multiset'.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj                mX(&oa);
+            bsl::multiset<int> mY(&oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245U + 12345U;
+                const int KEY = static_cast<int>((seed >> 8) % 500);
+
+                switch (seed % 4) {
+                  case 0:
+                  case 1: {
+                    mX.insert(KEY);
+                    mY.insert(KEY);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  default: {
+                    ASSERTV(i, mY.count(KEY) == mX.count(KEY));
+                  } break;
+                }
+                ASSERTV(i, mY.size() == mX.size());
+            }
+
+            Obj::const_iterator it = mX.begin();
+            for (bsl::multiset<int>::const_iterator jt = mY.begin();
+                 jt != mY.end();
+                 ++jt, ++it) {
+                ASSERTV(*jt, *jt == *it);
+            }
+            ASSERTV(mX.end() == it);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1300 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered container of values held in a sorted vector.
+//
+//@CLASSES:
+//  bslstl::FlatTree: ordered values, unique or equivalent keys, in a vector
+//  bslstl::FlatTree_SearchUtil: branch-free binary search of a sorted array
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset, bslstl_btree
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::FlatTree',
+// implementing an ordered container of values held contiguously, sorted by
+// key, in a 'bsl::vector'.  'FlatTree' is the implementation underlying
+// 'bsl::flat_map', 'bsl::flat_multimap', 'bsl::flat_set', and
+// 'bsl::flat_multiset'; each of its insertion methods comes in a *unique*
+// form, which does not insert a value whose key is equivalent to that of a
+// value already in the container, and a *multi* form, which does.  A given
+// 'FlatTree' object should be used consistently with one of the two forms.
+//
+// The key of each value is extracted using the 'KEY_CONFIG' template
+// parameter, which has the same requirements as for 'bslstl::HashTable' (see
+// 'bslstl_unorderedmapkeyconfiguration' and
+// 'bslstl_unorderedsetkeyconfiguration'), and keys are ordered using the
+// 'COMPARATOR' template parameter.  Memory is supplied by the 'ALLOCATOR'
+// template parameter, which is passed to the underlying 'bsl::vector', and so,
+// when 'ALLOCATOR' is 'bsl::allocator', the container and its values use the
+// 'bslma::Allocator' protocol.  Note that the values must be copy-assignable,
+// since they are moved within the vector by assignment; in particular, the
+// value type of a map is 'bsl::pair<KEY, VALUE>', rather than
+// 'bsl::pair<const KEY, VALUE>'.
+//
+///Performance Characteristics
+///---------------------------
+// Compared with a node-based tree, such as that underlying 'bsl::map', a
+// 'FlatTree' has no per-element memory overhead, allocates only when its
+// vector grows, and iterates over its values in memory order.  Lookup is a
+// binary search of the vector, which, for a large container, has the same
+// number of cache misses as a search of a balanced tree, but, since the
+// addresses of the elements probed next are known in advance, those misses
+// can be overlapped (see {Searching}).  In exchange, inserting or erasing a
+// single value moves, on average, half of the values, so that a 'FlatTree' is
+// best suited to tables that are built once (or rarely modified) and then
+// searched many times.
+//
+// Inserting a range of values ('insertUnique' or 'insertMulti' taking a pair
+// of iterators) copies the values into a new vector, sorts it once, and
+// merges it with the existing values, so that building a container of 'N'
+// values from an unordered range takes 'O[N * log(N)]' time, rather than the
+// 'O[N^2]' time of inserting each value separately.  If the range is already
+// ordered, it is not sorted.  If the range holds values having equivalent
+// keys, it is unspecified which of those values is inserted by the unique
+// form, and in which order they are inserted by the multi form.
+//
+// The values are sorted in place if they do not use a 'bslma' allocator;
+// otherwise, the addresses of the values are sorted, and the values are then
+// copied (using the allocator of the container) in sorted order, so that no
+// temporary copy of a value is created using the default allocator.
+//
+///Searching
+///---------
+// The lookup methods of 'FlatTree' are implemented by 'FlatTree_SearchUtil',
+// which performs a binary search that halves the range of candidate values
+// without branching on the result of each comparison: that result is
+// unpredictable, and a mispredicted branch costs more than the comparison of a
+// small key.  Once the range spans several cache lines, the search also
+// prefetches both of the values that might be probed next, so that the cache
+// miss of the next probe is overlapped with the current comparison.  Together,
+// these recover most of the benefit of an Eytzinger (breadth-first) layout
+// while keeping the values in order, which iteration and range erasure
+// require.
+//
+///Iterator Invalidation
+///---------------------
+// Iterators are pointers into the underlying vector.  Any insertion
+// invalidates all iterators, pointers, and references to the values of the
+// container if the vector reallocates, and those at or after the point of
+// insertion otherwise; any erasure invalidates those at or after the point of
+// erasure.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Lookup Table
+///- - - - - - - - - - - - - - - - -
+// Suppose we want to build a table of the codes of the valid currencies from
+// an unordered list that may contain duplicates, and then to look up codes in
+// it.  We can use a 'FlatTree' configured to use the entire value as its key:
+//..
+//  typedef bslstl::FlatTree<bslstl::UnorderedSetKeyConfiguration<int>,
+//                           std::less<int>,
+//                           bsl::allocator<int> > CodeTable;
+//
+//  static const int CODES[] = { 840, 978, 392, 826, 978, 756, 124, 840 };
+//  const int NUM_CODES = sizeof CODES / sizeof *CODES;
+//
+//  bslma::TestAllocator oa("object");
+//  CodeTable            table(&oa);
+//
+//  table.insertUnique(CODES, CODES + NUM_CODES);
+//  assert(6 == table.size());
+//..
+// Then, we verify that the codes are held in order, with each code once:
+//..
+//  assert(124 == *table.begin());
+//  assert(978 == *(table.end() - 1));
+//
+//  for (CodeTable::ConstIterator it = table.begin() + 1;
+//       it != table.end();
+//       ++it) {
+//      assert(*(it - 1) < *it);
+//  }
+//..
+// Finally, we look up some codes:
+//..
+//  assert(table.end() != table.find(826));
+//  assert(table.end() == table.find(999));
+//  assert(1 == table.count(392));
+//  assert(756 == *table.lowerBound(500));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ==========================
+                        // struct FlatTree_SearchUtil
+                        // ==========================
+
+struct FlatTree_SearchUtil {
+    // This 'struct' provides a namespace for functions that search a sorted
+    // array of values by binary search, without branching on the result of
+    // each comparison (see {Searching}).
+
+    // TYPES
+    enum {
+        k_PREFETCH_SIZE = 256  // minimum size (in bytes) of a range whose
+                               // next probes are prefetched
+    };
+
+    // CLASS METHODS
+    template <class KEY_CONFIG, class VALUE_TYPE, class KEY, class COMPARATOR>
+    static VALUE_TYPE *lowerBound(VALUE_TYPE        *first,
+                                  std::size_t        numValues,
+                                  const KEY&         key,
+                                  const COMPARATOR&  comparator);
+        // Return the address of the first of the specified 'numValues' values
+        // in the array at the specified 'first' address whose key (extracted
+        // using the (template parameter) 'KEY_CONFIG') is not ordered before
+        // the specified 'key' by the specified 'comparator', or
+        // 'first + numValues' if there is no such value.  The behavior is
+        // undefined unless the array is ordered by key.
+
+    template <class KEY_CONFIG, class VALUE_TYPE, class KEY, class COMPARATOR>
+    static VALUE_TYPE *upperBound(VALUE_TYPE        *first,
+                                  std::size_t        numValues,
+                                  const KEY&         key,
+                                  const COMPARATOR&  comparator);
+        // Return the address of the first of the specified 'numValues' values
+        // in the array at the specified 'first' address whose key (extracted
+        // using the (template parameter) 'KEY_CONFIG') is ordered after the
+        // specified 'key' by the specified 'comparator', or
+        // 'first + numValues' if there is no such value.  The behavior is
+        // undefined unless the array is ordered by key.
+};
+
+                        // ==============
+                        // class FlatTree
+                        // ==============
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class FlatTree {
+    // This class template implements a value-semantic container holding an
+    // ordered sequence of values in a 'bsl::vector'.  The values are ordered
+    // by their keys, extracted using the (template parameter) type
+    // 'KEY_CONFIG' and compared using the (template parameter) type
+    // 'COMPARATOR'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType              KeyType;
+    typedef typename KEY_CONFIG::ValueType            ValueType;
+    typedef ALLOCATOR                                 AllocatorType;
+    typedef bsl::vector<ValueType, ALLOCATOR>         Container;
+    typedef typename Container::size_type             SizeType;
+    typedef typename Container::difference_type       DifferenceType;
+    typedef typename Container::iterator              Iterator;
+    typedef typename Container::const_iterator        ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR>          AllocatorTraits;
+
+    typedef typename AllocatorTraits::template
+                        rebind_traits<const ValueType *>::allocator_type
+                                                      AddressAllocator;
+    typedef bsl::vector<const ValueType *, AddressAllocator>
+                                                      AddressContainer;
+
+    class AddressComparator {
+        // This class provides a functor ordering the addresses of values by
+        // the keys of the values, and then by address, so that sorting an
+        // array of addresses is stable.
+
+        // DATA
+        const COMPARATOR& d_comparator;  // key-ordering functor
+
+      public:
+        // CREATORS
+        explicit AddressComparator(const COMPARATOR& comparator)
+            // Create a functor ordering keys using the specified 'comparator'.
+        : d_comparator(comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const ValueType *lhs, const ValueType *rhs) const
+            // Return 'true' if the value at the specified 'lhs' address is
+            // ordered before that at the specified 'rhs' address, and 'false'
+            // otherwise.
+        {
+            if (d_comparator(KEY_CONFIG::extractKey(*lhs),
+                             KEY_CONFIG::extractKey(*rhs))) {
+                return true;                                          // RETURN
+            }
+            if (d_comparator(KEY_CONFIG::extractKey(*rhs),
+                             KEY_CONFIG::extractKey(*lhs))) {
+                return false;                                         // RETURN
+            }
+            return lhs < rhs;
+        }
+    };
+
+    class ValueComparator {
+        // This class provides a functor ordering values by their keys.
+
+        // DATA
+        const COMPARATOR& d_comparator;  // key-ordering functor
+
+      public:
+        // CREATORS
+        explicit ValueComparator(const COMPARATOR& comparator)
+            // Create a functor ordering keys using the specified 'comparator'.
+        : d_comparator(comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const ValueType& lhs, const ValueType& rhs) const
+            // Return 'true' if the key of the specified 'lhs' is ordered
+            // before that of the specified 'rhs', and 'false' otherwise.
+        {
+            return d_comparator(KEY_CONFIG::extractKey(lhs),
+                                KEY_CONFIG::extractKey(rhs));
+        }
+    };
+
+    // DATA
+    Container  d_values;      // values, ordered by key
+    COMPARATOR d_comparator;  // key-ordering functor
+
+    // PRIVATE MANIPULATORS
+    void merge(Container *values, bool unique);
+        // Merge the values of the specified 'values' into this container,
+        // ignoring those having a key equivalent to that of a value of this
+        // container if the specified 'unique' is 'true', and leave 'values' in
+        // a valid but unspecified state.  The behavior is undefined unless
+        // 'values' is ordered by key, and, if 'unique' is 'true', has no
+        // values having equivalent keys.
+
+    void prepare(Container *values, bool unique) const;
+        // Order the specified 'values' by key, and then, if the specified
+        // 'unique' is 'true', remove all but one of each set of values having
+        // equivalent keys.
+
+    void sort(Container *values, bsl::false_type) const;
+    void sort(Container *values, bsl::true_type) const;
+        // Order the specified 'values' by key: in place, if the second
+        // argument is 'false_type' (i.e., the values do not use a 'bslma'
+        // allocator); and by sorting the addresses of the values and copying
+        // the values in order, so that values are created only by the
+        // allocator of 'values', otherwise.
+
+    // PRIVATE ACCESSORS
+    bool isOrdered(const Container& values, bool strictly) const;
+        // Return 'true' if the keys of the specified 'values' are in
+        // non-descending order, or, if the specified 'strictly' is 'true', in
+        // ascending order, and 'false' otherwise.
+
+  public:
+    // CREATORS
+    explicit FlatTree(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty container.  Optionally specify an 'allocator' used
+        // to supply memory.  If 'allocator' is not specified, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order keys.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default), then 'allocator',
+        // if supplied, shall be convertible to 'bslma::Allocator *'.
+
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+        // Create an empty container that uses the specified 'comparator' to
+        // order keys, and the specified 'allocator' to supply memory.
+
+    FlatTree(const FlatTree& original);
+        // Create a container having the same value and comparator as the
+        // specified 'original'.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.allocator())' to
+        // supply memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+        // Create a container having the same value and comparator as the
+        // specified 'original', that uses the specified 'allocator' to supply
+        // memory.
+
+    //! ~FlatTree() = default;
+        // Destroy this object and each of its values.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If an exception is thrown, this object is left in a
+        // valid but unspecified state.
+
+    Iterator begin();
+        // Return an iterator referring to the first value (having the least
+        // key) in this container, or the 'end' iterator if it is empty.
+
+    Iterator end();
+        // Return the past-the-end iterator of this container.
+
+    void clear();
+        // Remove all values from this container, retaining its capacity.
+
+    Iterator erase(ConstIterator position);
+        // Remove the value at the specified 'position' from this container,
+        // and return an iterator referring to the value that followed it, or
+        // the 'end' iterator if it was the last value.  The behavior is
+        // undefined unless 'position' refers to a value in this container.
+
+    Iterator erase(ConstIterator first, ConstIterator last);
+        // Remove the values from the specified 'first' position up to, but
+        // not including, the specified 'last' position from this container,
+        // and return an iterator referring to the value that was at 'last'.
+        // The behavior is undefined unless '[first .. last)' is a valid range
+        // of this container.
+
+    SizeType erase(const KeyType& key);
+        // Remove the values having a key equivalent to the specified 'key'
+        // from this container, and return the number of values removed.
+
+    Iterator find(const KeyType& key);
+        // Return an iterator referring to the first value in this container
+        // having a key equivalent to the specified 'key', or the 'end'
+        // iterator if there is no such value.
+
+    Iterator insertIfMissing(const KeyType& key);
+        // Return an iterator referring to the value in this container having
+        // a key equivalent to the specified 'key', first inserting a value
+        // constructed from 'key' and a default-constructed
+        // 'ValueType::second_type' object if there is no such value.  This
+        // method requires that 'ValueType' be a 'pair' constructible from a
+        // key and a 'second_type' object.
+
+    bsl::pair<Iterator, bool> insertUnique(const ValueType& value);
+        // Insert the specified 'value' into this container if it has no value
+        // having a key equivalent to that of 'value'.  Return a 'pair' whose
+        // 'first' member refers to the value in this container having the key
+        // of 'value', and whose 'second' member is 'true' if 'value' was
+        // inserted, and 'false' otherwise.
+
+    Iterator insertUnique(ConstIterator hint, const ValueType& value);
+        // Insert the specified 'value' into this container if it has no value
+        // having a key equivalent to that of 'value', and return an iterator
+        // referring to the value in this container having the key of 'value'.
+        // If 'value' belongs immediately before the specified 'hint', no
+        // search is performed.  The behavior is undefined unless 'hint' is a
+        // valid iterator of this container.
+
+    template <class INPUT_ITERATOR>
+    void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this container a copy of each value in the range
+        // starting at the specified 'first' iterator and ending immediately
+        // before the specified 'last' iterator, whose key is not equivalent to
+        // that of a value already in this container.  If the range holds
+        // several values having equivalent keys, one of them (unspecified) is
+        // inserted.  The (template parameter) type 'INPUT_ITERATOR' shall meet
+        // the requirements of an input iterator providing access to values of
+        // a type convertible to 'ValueType'.  The behavior is undefined unless
+        // '[first .. last)' is a valid range.  Note that the range is copied
+        // and sorted once (see {Performance Characteristics}).
+
+    Iterator insertMulti(const ValueType& value);
+        // Insert the specified 'value' into this container after any values
+        // having a key equivalent to that of 'value', and return an iterator
+        // referring to the inserted value.
+
+    Iterator insertMulti(ConstIterator hint, const ValueType& value);
+        // Insert the specified 'value' into this container, as close as
+        // possible to the position immediately before the specified 'hint',
+        // and return an iterator referring to the inserted value.  If 'value'
+        // belongs immediately before 'hint', no search is performed.  The
+        // behavior is undefined unless 'hint' is a valid iterator of this
+        // container.
+
+    template <class INPUT_ITERATOR>
+    void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this container a copy of each value in the range
+        // starting at the specified 'first' iterator and ending immediately
+        // before the specified 'last' iterator, after any values already in
+        // this container having equivalent keys.  The relative order of values
+        // in the range having equivalent keys is unspecified.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator providing access to values of a type convertible to
+        // 'ValueType'.  The behavior is undefined unless '[first .. last)' is
+        // a valid range.  Note that the range is copied and sorted once (see
+        // {Performance Characteristics}).
+
+    Iterator lowerBound(const KeyType& key);
+        // Return an iterator referring to the first value in this container
+        // whose key is not ordered before the specified 'key', or the 'end'
+        // iterator if there is no such value.
+
+    void reserve(SizeType numValues);
+        // Ensure that the specified 'numValues' values can be held by this
+        // container without reallocating its vector.
+
+    void shrinkToFit();
+        // Reduce the capacity of this container to its size, if possible.
+
+    void swap(FlatTree& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    Iterator upperBound(const KeyType& key);
+        // Return an iterator referring to the first value in this container
+        // whose key is ordered after the specified 'key', or the 'end'
+        // iterator if there is no such value.
+
+    // ACCESSORS
+    AllocatorType allocator() const;
+        // Return (a copy of) the allocator used by this container.
+
+    ConstIterator begin() const;
+        // Return an iterator referring to the first value (having the least
+        // key) in this container, or the 'end' iterator if it is empty.
+
+    SizeType capacity() const;
+        // Return the number of values this container can hold without
+        // reallocating its vector.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the functor
+        // used by this container to order keys.
+
+    SizeType count(const KeyType& key) const;
+        // Return the number of values in this container having a key
+        // equivalent to the specified 'key'.
+
+    ConstIterator end() const;
+        // Return the past-the-end iterator of this container.
+
+    bsl::pair<ConstIterator, ConstIterator> equalRange(
+                                                    const KeyType& key) const;
+        // Return the range of values in this container having a key
+        // equivalent to the specified 'key', as a 'pair' of its first and
+        // past-the-end iterators.
+
+    ConstIterator find(const KeyType& key) const;
+        // Return an iterator referring to the first value in this container
+        // having a key equivalent to the specified 'key', or the 'end'
+        // iterator if there is no such value.
+
+    ConstIterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first value in this container
+        // whose key is not ordered before the specified 'key', or the 'end'
+        // iterator if there is no such value.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of values this
+        // container could hold.
+
+    SizeType size() const;
+        // Return the number of values in this container.
+
+    ConstIterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first value in this container
+        // whose key is ordered after the specified 'key', or the 'end'
+        // iterator if there is no such value.
+};
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool operator==(const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatTree' objects have the same
+    // value if they have the same number of values, and each value of 'lhs'
+    // compares equal to the value at the same position in 'rhs'.
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatTree' objects do not have
+    // the same value if they differ in size, or if some value of 'lhs' does
+    // not compare equal to the value at the same position in 'rhs'.
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void swap(FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& a,
+          FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the values and comparators of the specified 'a' and 'b'
+    // objects.  The behavior is undefined unless 'a' and 'b' were created with
+    // the same allocator.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // struct FlatTree_SearchUtil
+                        // --------------------------
+
+// CLASS METHODS
+template <class KEY_CONFIG, class VALUE_TYPE, class KEY, class COMPARATOR>
+inline
+VALUE_TYPE *FlatTree_SearchUtil::lowerBound(VALUE_TYPE        *first,
+                                            std::size_t        numValues,
+                                            const KEY&         key,
+                                            const COMPARATOR&  comparator)
+{
+    // The result is in '[first .. first + numValues]'.  Each step compares
+    // the last value of the lower half of the range, and selects a half by a
+    // conditional move rather than a branch.
+
+    while (numValues > 1) {
+        const std::size_t half = numValues / 2;
+        const std::size_t rest = numValues - half;
+
+        if (rest * sizeof(VALUE_TYPE) >= k_PREFETCH_SIZE) {
+            bsls::PerformanceHint::prefetchForReading(first + rest / 2);
+            bsls::PerformanceHint::prefetchForReading(first + half + rest / 2);
+        }
+        first = comparator(KEY_CONFIG::extractKey(first[half - 1]), key)
+              ? first + half
+              : first;
+        numValues = rest;
+    }
+    return numValues && comparator(KEY_CONFIG::extractKey(*first), key)
+           ? first + 1
+           : first;
+}
+
+template <class KEY_CONFIG, class VALUE_TYPE, class KEY, class COMPARATOR>
+inline
+VALUE_TYPE *FlatTree_SearchUtil::upperBound(VALUE_TYPE        *first,
+                                            std::size_t        numValues,
+                                            const KEY&         key,
+                                            const COMPARATOR&  comparator)
+{
+    // See 'lowerBound'.
+
+    while (numValues > 1) {
+        const std::size_t half = numValues / 2;
+        const std::size_t rest = numValues - half;
+
+        if (rest * sizeof(VALUE_TYPE) >= k_PREFETCH_SIZE) {
+            bsls::PerformanceHint::prefetchForReading(first + rest / 2);
+            bsls::PerformanceHint::prefetchForReading(first + half + rest / 2);
+        }
+        first = comparator(key, KEY_CONFIG::extractKey(first[half - 1]))
+              ? first
+              : first + half;
+        numValues = rest;
+    }
+    return numValues && !comparator(key, KEY_CONFIG::extractKey(*first))
+           ? first + 1
+           : first;
+}
+
+                        // --------------
+                        // class FlatTree
+                        // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::merge(Container *values,
+                                                        bool       unique)
+{
+    BSLS_ASSERT_SAFE(values);
+
+    if (values->empty()) {
+        return;                                                       // RETURN
+    }
+
+    if (d_values.empty()) {
+        d_values.swap(*values);
+        return;                                                       // RETURN
+    }
+
+    if (d_comparator(KEY_CONFIG::extractKey(d_values.back()),
+                     KEY_CONFIG::extractKey(values->front()))
+     || (!unique && !d_comparator(KEY_CONFIG::extractKey(values->front()),
+                                  KEY_CONFIG::extractKey(d_values.back())))) {
+        // All of the new values belong after the existing values.
+
+        d_values.insert(d_values.end(), values->begin(), values->end());
+        return;                                                       // RETURN
+    }
+
+    Container merged(d_values.get_allocator());
+    merged.reserve(d_values.size() + values->size());
+
+    ConstIterator       existing    = d_values.begin();
+    const ConstIterator existingEnd = d_values.end();
+    ConstIterator       added       = values->begin();
+    const ConstIterator addedEnd    = values->end();
+
+    while (existing != existingEnd && added != addedEnd) {
+        const KeyType& existingKey = KEY_CONFIG::extractKey(*existing);
+        const KeyType& addedKey    = KEY_CONFIG::extractKey(*added);
+
+        if (d_comparator(addedKey, existingKey)) {
+            merged.push_back(*added);
+            ++added;
+        }
+        else if (unique && !d_comparator(existingKey, addedKey)) {
+            ++added;  // the existing value is kept
+        }
+        else {
+            merged.push_back(*existing);
+            ++existing;
+        }
+    }
+    merged.insert(merged.end(), existing, existingEnd);
+    merged.insert(merged.end(), added, addedEnd);
+
+    d_values.swap(merged);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::prepare(Container *values,
+                                                          bool unique) const
+{
+    BSLS_ASSERT_SAFE(values);
+
+    if (isOrdered(*values, unique)) {
+        return;                                                       // RETURN
+    }
+
+    typedef bsl::integral_constant<bool,
+                                   bslma::UsesBslmaAllocator<ValueType>::value>
+                                                                     UsesBslma;
+
+    sort(values, UsesBslma());
+
+    if (unique) {
+        // Keep the first of each run of values having equivalent keys.
+
+        Iterator       last = values->begin();
+        const Iterator end  = values->end();
+        for (Iterator it = last + 1; it != end; ++it) {
+            if (d_comparator(KEY_CONFIG::extractKey(*last),
+                             KEY_CONFIG::extractKey(*it))) {
+                ++last;
+                if (last != it) {
+                    *last = *it;
+                }
+            }
+        }
+        values->erase(last + 1, end);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::sort(Container *values,
+                                                       bsl::false_type) const
+{
+    BSLS_ASSERT_SAFE(values);
+
+    std::sort(values->begin(), values->end(), ValueComparator(d_comparator));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::sort(Container *values,
+                                                       bsl::true_type) const
+{
+    BSLS_ASSERT_SAFE(values);
+
+    AddressContainer addresses(AddressAllocator(values->get_allocator()));
+    addresses.reserve(values->size());
+    for (ConstIterator it = values->begin(); it != values->end(); ++it) {
+        addresses.push_back(it);
+    }
+
+    std::sort(addresses.begin(),
+              addresses.end(),
+              AddressComparator(d_comparator));
+
+    Container sorted(values->get_allocator());
+    sorted.reserve(values->size());
+    for (typename AddressContainer::const_iterator it = addresses.begin();
+         it != addresses.end();
+         ++it) {
+        sorted.push_back(**it);
+    }
+    values->swap(sorted);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isOrdered(
+                                               const Container& values,
+                                               bool             strictly) const
+{
+    if (values.size() < 2) {
+        return true;                                                  // RETURN
+    }
+
+    const ConstIterator end = values.end();
+    for (ConstIterator it = values.begin() + 1; it != end; ++it) {
+        const KeyType& previous = KEY_CONFIG::extractKey(*(it - 1));
+        const KeyType& current  = KEY_CONFIG::extractKey(*it);
+
+        if (strictly ? !d_comparator(previous, current)
+                     : d_comparator(current, previous)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                   const ALLOCATOR& allocator)
+: d_values(allocator)
+, d_comparator()
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_values(allocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                     const FlatTree& original)
+: d_values(original.d_values)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                                 const FlatTree&  original,
+                                                 const ALLOCATOR& allocator)
+: d_values(original.d_values, allocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const FlatTree& rhs)
+{
+    if (this != &rhs) {
+        d_values     = rhs.d_values;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_values.clear();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_values.erase(position);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(ConstIterator first,
+                                                   ConstIterator last)
+{
+    return d_values.erase(first, last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(const KeyType& key)
+{
+    const bsl::pair<ConstIterator, ConstIterator> range = equalRange(key);
+    const SizeType numErased = range.second - range.first;
+
+    d_values.erase(range.first, range.second);
+    return numErased;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key)
+{
+    const Iterator it = lowerBound(key);
+
+    return it == end() || d_comparator(key, KEY_CONFIG::extractKey(*it))
+           ? end()
+           : it;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                                            const KeyType& key)
+{
+    typedef typename ValueType::second_type MappedType;
+
+    Iterator it = lowerBound(key);
+    if (it == end() || d_comparator(key, KEY_CONFIG::extractKey(*it))) {
+        it = d_values.emplace(it, key, MappedType());
+    }
+    return it;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator,
+          bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                       const ValueType& value)
+{
+    typedef bsl::pair<Iterator, bool> ResultType;
+
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    Iterator it = lowerBound(key);
+    if (it != end() && !d_comparator(key, KEY_CONFIG::extractKey(*it))) {
+        return ResultType(it, false);                                 // RETURN
+    }
+    return ResultType(d_values.insert(it, value), true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                      ConstIterator    hint,
+                                                      const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    if ((hint == end() || d_comparator(key, KEY_CONFIG::extractKey(*hint)))
+     && (hint == begin()
+      || d_comparator(KEY_CONFIG::extractKey(*(hint - 1)), key))) {
+        return d_values.insert(hint, value);                          // RETURN
+    }
+    return insertUnique(value).first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                        INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    Container values(d_values.get_allocator());
+    values.insert(values.end(), first, last);
+
+    prepare(&values, true);
+    merge(&values, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                       const ValueType& value)
+{
+    return d_values.insert(upperBound(KEY_CONFIG::extractKey(value)), value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                      ConstIterator    hint,
+                                                      const ValueType& value)
+{
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    Iterator position = begin() + (hint - begin());
+
+    if (hint != end() && d_comparator(KEY_CONFIG::extractKey(*hint), key)) {
+        // 'value' belongs after 'hint'; insert as early as possible.
+
+        position = FlatTree_SearchUtil::lowerBound<KEY_CONFIG>(
+                                                              position,
+                                                              end() - position,
+                                                              key,
+                                                              d_comparator);
+    }
+    else if (hint != begin()
+          && d_comparator(key, KEY_CONFIG::extractKey(*(hint - 1)))) {
+        // 'value' belongs before 'hint - 1'; insert as late as possible.
+
+        position = FlatTree_SearchUtil::upperBound<KEY_CONFIG>(
+                                                            begin(),
+                                                            position - begin(),
+                                                            key,
+                                                            d_comparator);
+    }
+    return d_values.insert(position, value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                        INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    Container values(d_values.get_allocator());
+    values.insert(values.end(), first, last);
+
+    prepare(&values, false);
+    merge(&values, false);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key)
+{
+    return FlatTree_SearchUtil::lowerBound<KEY_CONFIG>(d_values.begin(),
+                                                       d_values.size(),
+                                                       key,
+                                                       d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::reserve(SizeType numValues)
+{
+    d_values.reserve(numValues);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_values.shrink_to_fit();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(FlatTree& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    d_values.swap(other.d_values);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key)
+{
+    return FlatTree_SearchUtil::upperBound<KEY_CONFIG>(d_values.begin(),
+                                                       d_values.size(),
+                                                       key,
+                                                       d_comparator);
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_values.get_allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_values.capacity();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::count(const KeyType& key) const
+{
+    const bsl::pair<ConstIterator, ConstIterator> range = equalRange(key);
+
+    return range.second - range.first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator,
+          typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::equalRange(
+                                                      const KeyType& key) const
+{
+    typedef bsl::pair<ConstIterator, ConstIterator> ResultType;
+
+    const ConstIterator first = lowerBound(key);
+    if (first == end() || d_comparator(key, KEY_CONFIG::extractKey(*first))) {
+        return ResultType(first, first);                              // RETURN
+    }
+
+    // Search for the end of the range only among the values following
+    // 'first', which, for unique keys, is usually found immediately.
+
+    ConstIterator last = first + 1;
+    if (last != end() && !d_comparator(key, KEY_CONFIG::extractKey(*last))) {
+        last = FlatTree_SearchUtil::upperBound<KEY_CONFIG>(last,
+                                                           end() - last,
+                                                           key,
+                                                           d_comparator);
+    }
+    return ResultType(first, last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    const ConstIterator it = lowerBound(key);
+
+    return it == end() || d_comparator(key, KEY_CONFIG::extractKey(*it))
+           ? end()
+           : it;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                      const KeyType& key) const
+{
+    return FlatTree_SearchUtil::lowerBound<KEY_CONFIG>(d_values.begin(),
+                                                       d_values.size(),
+                                                       key,
+                                                       d_comparator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_values.max_size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_values.size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ConstIterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                      const KeyType& key) const
+{
+    return FlatTree_SearchUtil::upperBound<KEY_CONFIG>(d_values.begin(),
+                                                       d_values.size(),
+                                                       key,
+                                                       d_comparator);
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator==(const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                        const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator!=(const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& lhs,
+                        const FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& a,
+                  FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'FlatTree':
+//: o A 'FlatTree' is bitwise moveable if its comparator and allocator are
+//:   bitwise moveable (its vector does not refer back to the container).
+//: o A 'FlatTree' uses 'bslma' allocators if the (template parameter) type
+//:   'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace bslma {
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bslstl::FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<bslstl::FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR> >
+: bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<COMPARATOR>::value
+                            && bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
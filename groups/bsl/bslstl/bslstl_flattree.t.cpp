@@ -0,0 +1,1179 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements an ordered container of values held in
+// a sorted 'bsl::vector', together with the branch-free binary search used to
+// look up keys in it.  The main concerns are that the search agrees with a
+// linear search for every size of array (in particular, those straddling the
+// prefetch threshold) and every key, that each form of insertion places values
+// correctly (unique insertion rejecting equivalent keys, and multi insertion
+// placing new values after equivalent ones), that range insertion sorts and
+// deduplicates unordered input and merges it with existing values, and that
+// all memory (including that of values using 'bslma' allocators) is supplied
+// by the allocator of the container.  The state of a container is verified
+// against a simple model (an array of counts indexed by key).
+//-----------------------------------------------------------------------------
+// FlatTree_SearchUtil
+// [ 2] VALUE_TYPE *lowerBound(VALUE_TYPE *, size_t, const KEY&, const CMP&);
+// [ 2] VALUE_TYPE *upperBound(VALUE_TYPE *, size_t, const KEY&, const CMP&);
+//
+// FlatTree
+// [ 3] FlatTree(const ALLOCATOR& allocator = ALLOCATOR());
+// [ 5] FlatTree(const COMPARATOR& comparator, const ALLOCATOR& allocator);
+// [ 5] FlatTree(const FlatTree& original);
+// [ 5] FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+// [ 3] ~FlatTree();
+// [ 5] FlatTree& operator=(const FlatTree& rhs);
+// [ 3] Iterator begin();
+// [ 3] Iterator end();
+// [ 3] void clear();
+// [ 3] Iterator erase(ConstIterator position);
+// [ 3] Iterator erase(ConstIterator first, ConstIterator last);
+// [ 3] SizeType erase(const KeyType& key);
+// [ 3] Iterator find(const KeyType& key);
+// [ 5] Iterator insertIfMissing(const KeyType& key);
+// [ 3] pair<Iterator, bool> insertUnique(const ValueType& value);
+// [ 3] Iterator insertUnique(ConstIterator hint, const ValueType& value);
+// [ 4] void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] Iterator insertMulti(const ValueType& value);
+// [ 3] Iterator insertMulti(ConstIterator hint, const ValueType& value);
+// [ 4] void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] Iterator lowerBound(const KeyType& key);
+// [ 5] void reserve(SizeType numValues);
+// [ 5] void shrinkToFit();
+// [ 5] void swap(FlatTree& other);
+// [ 3] Iterator upperBound(const KeyType& key);
+// [ 3] AllocatorType allocator() const;
+// [ 3] ConstIterator begin() const;
+// [ 5] SizeType capacity() const;
+// [ 5] const COMPARATOR& comparator() const;
+// [ 3] SizeType count(const KeyType& key) const;
+// [ 3] ConstIterator end() const;
+// [ 3] pair<ConstIterator, ConstIterator> equalRange(const KeyType&) const;
+// [ 3] ConstIterator find(const KeyType& key) const;
+// [ 3] ConstIterator lowerBound(const KeyType& key) const;
+// [ 3] SizeType maxSize() const;
+// [ 3] SizeType size() const;
+// [ 3] ConstIterator upperBound(const KeyType& key) const;
+//
+// [ 5] bool operator==(const FlatTree&, const FlatTree&);
+// [ 5] bool operator!=(const FlatTree&, const FlatTree&);
+// [ 5] void swap(FlatTree& a, FlatTree& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: Range insertion uses only the allocator of the container.
+// [ 5] CONCERN: The type traits are correctly declared.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatTree<bslstl::UnorderedSetKeyConfiguration<int>,
+                         std::less<int>,
+                         bsl::allocator<int> > IntTree;
+
+typedef bsl::pair<int, int>                    IntPair;
+typedef bslstl::FlatTree<bslstl::UnorderedMapKeyConfiguration<IntPair>,
+                         std::less<int>,
+                         bsl::allocator<IntPair> > PairTree;
+    // The 'second' member of each value of a 'PairTree' records the order in
+    // which values having the same key were inserted.
+
+typedef bsltf::AllocTestType                     AllocType;
+typedef bsl::pair<int, AllocType>                AllocPair;
+typedef bslstl::FlatTree<bslstl::UnorderedMapKeyConfiguration<AllocPair>,
+                         std::less<int>,
+                         bsl::allocator<AllocPair> > AllocPairTree;
+
+//=============================================================================
+//                               TEST FACILITIES
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Greater {
+    // This 'struct' provides a stateful comparator ordering integers in
+    // descending order.
+
+    int d_id;  // identifies the object, to verify it is copied and swapped
+
+    BSLMF_NESTED_TRAIT_DECLARATION(Greater, bslmf::IsBitwiseMoveable);
+
+    explicit Greater(int id = 0) : d_id(id) {}
+        // Create a comparator having the optionally specified 'id'.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+class Random {
+    // This class provides a deterministic pseudo-random number generator.
+
+    // DATA
+    unsigned int d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int limit)
+        // Return a pseudo-random number in the range '[0 .. limit)'.
+    {
+        d_state = d_state * 1103515245U + 12345U;
+        return static_cast<int>((d_state >> 8) % limit);
+    }
+};
+
+template <class TREE>
+bool verifyTree(const TREE& tree,
+                const int  *counts,
+                int         numKeys,
+                int         numOrdered = INT_MAX)
+    // Return 'true' if the specified 'tree' holds exactly 'counts[k]' values
+    // having each key 'k' in the range '[0 .. numKeys)', in order of key and,
+    // for values having the same key whose 'second' member is less than the
+    // optionally specified 'numOrdered', in ascending order of 'second' and
+    // before any other values having that key, and if 'count', 'find',
+    // 'lowerBound', 'upperBound', and 'equalRange' agree for each key in the
+    // range and those just outside it; and 'false' otherwise.  The behavior
+    // is undefined unless the 'first' and 'second' members of the values of
+    // 'tree' are 'int'.
+{
+    typedef typename TREE::ConstIterator Iter;
+
+    int expectedSize = 0;
+    for (int k = 0; k < numKeys; ++k) {
+        expectedSize += counts[k];
+    }
+    if (static_cast<int>(tree.size()) != expectedSize
+     || tree.end() - tree.begin() != expectedSize) {
+        return false;                                                 // RETURN
+    }
+
+    for (Iter it = tree.begin(); it != tree.end(); ++it) {
+        if (it != tree.begin()
+         && ((it - 1)->first > it->first
+          || ((it - 1)->first == it->first
+           && it->second < numOrdered
+         && (it - 1)->second >= it->second))) {
+            return false;                                             // RETURN
+        }
+    }
+
+    Iter first = tree.begin();
+    for (int k = -1; k <= numKeys; ++k) {
+        const int count = 0 <= k && k < numKeys ? counts[k] : 0;
+        const Iter last = first + count;
+
+        if (static_cast<int>(tree.count(k)) != count
+         || tree.lowerBound(k) != first
+         || tree.upperBound(k) != last
+         || tree.equalRange(k).first != first
+         || tree.equalRange(k).second != last
+         || tree.find(k) != (count ? first : tree.end())) {
+            return false;                                             // RETURN
+        }
+        for (Iter it = first; it != last; ++it) {
+            if (it->first != k) {
+                return false;                                         // RETURN
+            }
+        }
+        first = last;
+    }
+    return first == tree.end();
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Lookup Table
+///- - - - - - - - - - - - - - - - -
+// Suppose we want to build a table of the codes of the valid currencies from
+// an unordered list that may contain duplicates, and then to look up codes in
+// it.  We can use a 'FlatTree' configured to use the entire value as its key:
+//..
+    typedef bslstl::FlatTree<bslstl::UnorderedSetKeyConfiguration<int>,
+                             std::less<int>,
+                             bsl::allocator<int> > CodeTable;
+
+    static const int CODES[] = { 840, 978, 392, 826, 978, 756, 124, 840 };
+    const int NUM_CODES = sizeof CODES / sizeof *CODES;
+
+    bslma::TestAllocator oa("object");
+    CodeTable            table(&oa);
+
+    table.insertUnique(CODES, CODES + NUM_CODES);
+    ASSERT(6 == table.size());
+//..
+// Then, we verify that the codes are held in order, with each code once:
+//..
+    ASSERT(124 == *table.begin());
+    ASSERT(978 == *(table.end() - 1));
+
+    for (CodeTable::ConstIterator it = table.begin() + 1;
+         it != table.end();
+         ++it) {
+        ASSERT(*(it - 1) < *it);
+    }
+//..
+// Finally, we look up some codes:
+//..
+    ASSERT(table.end() != table.find(826));
+    ASSERT(table.end() == table.find(999));
+    ASSERT(1 == table.count(392));
+    ASSERT(756 == *table.lowerBound(500));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value and comparator as the original, and
+        //:   uses the default allocator unless one is supplied.
+        //:
+        //: 2 Assignment copies the value and the comparator, and is alias
+        //:   safe.
+        //:
+        //: 3 Swapping exchanges the values and comparators without
+        //:   allocating.
+        //:
+        //: 4 Two containers are equal if and only if they hold equal values in
+        //:   the same order.
+        //:
+        //: 5 'insertIfMissing' inserts a value having a default-constructed
+        //:   mapped value only if the key is absent.
+        //:
+        //: 6 'reserve' and 'shrinkToFit' change the capacity without changing
+        //:   the value.
+        //:
+        //: 7 The type traits are correctly declared.
+        //
+        // Plan:
+        //: 1 Create containers using a stateful comparator, copy, assign, and
+        //:   swap them, verifying the values, comparators, and allocators.
+        //:   (C-1..3)
+        //:
+        //: 2 Compare containers differing in size, in a single value, and in
+        //:   order.  (C-4)
+        //:
+        //: 3 Call 'insertIfMissing' for present and absent keys.  (C-5)
+        //:
+        //: 4 Verify the capacity after 'reserve' and 'shrinkToFit'.  (C-6)
+        //:
+        //: 5 Verify the traits with compile-time assertions.  (C-7)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR& comparator, const ALLOCATOR& alloc);
+        //   FlatTree(const FlatTree& original);
+        //   FlatTree(const FlatTree& original, const ALLOCATOR& allocator);
+        //   FlatTree& operator=(const FlatTree& rhs);
+        //   Iterator insertIfMissing(const KeyType& key);
+        //   void reserve(SizeType numValues);
+        //   void shrinkToFit();
+        //   void swap(FlatTree& other);
+        //   SizeType capacity() const;
+        //   const COMPARATOR& comparator() const;
+        //   bool operator==(const FlatTree&, const FlatTree&);
+        //   bool operator!=(const FlatTree&, const FlatTree&);
+        //   void swap(FlatTree& a, FlatTree& b);
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          "\n============================================\n");
+
+        typedef bslstl::FlatTree<bslstl::UnorderedSetKeyConfiguration<int>,
+                                 Greater,
+                                 bsl::allocator<int> > Obj;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<AllocPairTree>::value);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tCopy construction and assignment.\n");
+        {
+            Obj mX(Greater(1), &oa);  const Obj& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                mX.insertUnique(i * 3 % 50);
+            }
+            ASSERTV(50 == X.size());
+            ASSERTV(49 == *X.begin());
+            ASSERTV(1  == X.comparator().d_id);
+
+            const Obj Y(X);
+            ASSERTV(X == Y);
+            ASSERTV(1 == Y.comparator().d_id);
+            ASSERTV(&da == Y.allocator().mechanism());
+
+            const Obj Z(X, &za);
+            ASSERTV(X == Z);
+            ASSERTV(1 == Z.comparator().d_id);
+            ASSERTV(&za == Z.allocator().mechanism());
+
+            Obj mW(Greater(2), &za);  const Obj& W = mW;
+            mW.insertUnique(100);
+            ASSERTV(X != W);
+
+            mW = X;
+            ASSERTV(X == W);
+            ASSERTV(1 == W.comparator().d_id);
+            ASSERTV(&za == W.allocator().mechanism());
+
+            mW = W;
+            ASSERTV(X == W);
+
+            if (veryVerbose) { T_ P_(X.size()) P(W.size()) }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == za.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(Greater(1), &oa);  const Obj& X = mX;
+            Obj mY(Greater(2), &oa);  const Obj& Y = mY;
+            for (int i = 0; i < 10; ++i) {
+                mX.insertUnique(i);
+            }
+            mY.insertUnique(99);
+
+            const Obj XX(X, &za);
+            const Obj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERTV(YY == X);
+            ASSERTV(XX == Y);
+            ASSERTV(2  == X.comparator().d_id);
+            ASSERTV(1  == Y.comparator().d_id);
+
+            swap(mX, mY);
+            ASSERTV(XX == X);
+            ASSERTV(YY == Y);
+            ASSERTV(1  == X.comparator().d_id);
+
+            ASSERTV(oam.isTotalSame());
+        }
+
+        if (verbose) printf("\tEquality.\n");
+        {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            IntTree mY(&oa);  const IntTree& Y = mY;
+            ASSERTV(  X == Y);
+            ASSERTV(!(X != Y));
+
+            mX.insertUnique(1);
+            ASSERTV(!(X == Y));
+            ASSERTV(  X != Y);
+
+            mY.insertUnique(2);
+            ASSERTV(X != Y);
+
+            mY.erase(2);
+            mY.insertUnique(1);
+            ASSERTV(X == Y);
+        }
+
+        if (verbose) printf("\tInsert if missing.\n");
+        {
+            bslma::TestAllocatorMonitor dam(&da);
+
+            AllocPairTree mX(&oa);  const AllocPairTree& X = mX;
+
+            AllocPairTree::Iterator it = mX.insertIfMissing(5);
+            ASSERTV(1 == X.size());
+            ASSERTV(5 == it->first);
+            ASSERTV(0 == it->second.data());
+            ASSERTV(&oa == it->second.allocator());
+
+            it->second.setData(50);
+            it = mX.insertIfMissing(5);
+            ASSERTV(1  == X.size());
+            ASSERTV(50 == it->second.data());
+
+            it = mX.insertIfMissing(3);
+            ASSERTV(2 == X.size());
+            ASSERTV(X.begin() == it);
+            ASSERTV(&oa == it->second.allocator());
+
+            ASSERTV(dam.isInUseSame());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tReserve and shrink to fit.\n");
+        {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERTV(0 == X.size());
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+            for (int i = 0; i < 100; ++i) {
+                mX.insertUnique(99 - i);
+            }
+            ASSERTV(numAllocations == oa.numAllocations());
+
+            mX.erase(X.begin() + 10, X.end());
+            ASSERTV(10 == X.size());
+            mX.shrinkToFit();
+            ASSERTV(X.capacity(), 10 == X.capacity());
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, i == X.begin()[i]);
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting an unordered range into an empty container sorts it,
+        //:   and, for unique insertion, keeps one value of each key.
+        //:
+        //: 2 Inserting a range into a non-empty container merges it with the
+        //:   existing values; unique insertion keeps the existing value of a
+        //:   key, and multi insertion places new values after existing values
+        //:   having the same key.
+        //:
+        //: 3 Ordered ranges, empty ranges, and ranges belonging entirely
+        //:   after the existing values are handled correctly.
+        //:
+        //: 4 If the values use a 'bslma' allocator, no memory is allocated
+        //:   from the default allocator, and the values of the container use
+        //:   its allocator.
+        //
+        // Plan:
+        //: 1 For a set of table-driven and pseudo-random ranges, insert the
+        //:   range into containers holding some initial values, and verify the
+        //:   result against a model.  (C-1..3)
+        //:
+        //: 2 Repeat with values using a 'bslma' allocator, with the default
+        //:   allocator replaced by a test allocator, verifying that it is not
+        //:   used and that each value uses the object allocator.  (C-4)
+        //
+        // Testing:
+        //   void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   CONCERN: Range insertion uses only the allocator of the container.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RANGE INSERTION"
+                            "\n=======================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_initial;   // keys initially in the container
+            const char *d_range;     // keys of the range to insert
+        } DATA[] = {
+            //LINE  INITIAL       RANGE
+            //----  ------------  ------------------
+            { L_,   "",           ""                 },
+            { L_,   "",           "a"                },
+            { L_,   "",           "abcde"            },
+            { L_,   "",           "edcba"            },
+            { L_,   "",           "aaaaa"            },
+            { L_,   "",           "aabbcc"           },
+            { L_,   "",           "cbacbacba"        },
+            { L_,   "",           "jhfdbigeca"       },
+            { L_,   "c",          ""                 },
+            { L_,   "c",          "c"                },
+            { L_,   "c",          "abde"             },
+            { L_,   "c",          "edcba"            },
+            { L_,   "abc",        "def"              },
+            { L_,   "abc",        "cde"              },
+            { L_,   "def",        "abc"              },
+            { L_,   "bdf",        "aceg"             },
+            { L_,   "bdf",        "gfedcbagfedcba"   },
+            { L_,   "aabbcc",     "cba"              },
+            { L_,   "acegi",      "ihgfedcbaihgfedc" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        enum { k_NUM_KEYS = 26 };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial;
+            const char *const RANGE   = DATA[ti].d_range;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(RANGE) }
+
+            for (int multi = 0; multi < 2; ++multi) {
+                int counts[k_NUM_KEYS] = { 0 };
+                int serial = 0;
+
+                PairTree mX(&oa);  const PairTree& X = mX;
+                for (const char *s = INITIAL; *s; ++s) {
+                    const int k = *s - 'a';
+                    if (multi) {
+                        mX.insertMulti(IntPair(k, serial++));
+                        ++counts[k];
+                    }
+                    else {
+                        mX.insertUnique(IntPair(k, serial++));
+                        counts[k] = 1;
+                    }
+                }
+
+                // The values of the range are numbered after the initial
+                // values, so that the model can verify that the initial
+                // values precede (or, for unique insertion, replace) those
+                // of the range having the same key.
+
+                IntPair range[32];
+                int     numRange = 0;
+                for (const char *s = RANGE; *s; ++s) {
+                    range[numRange] = IntPair(*s - 'a', serial + numRange);
+                    ++numRange;
+                }
+
+                bool isNew[k_NUM_KEYS];
+                for (int k = 0; k < k_NUM_KEYS; ++k) {
+                    isNew[k] = 0 == counts[k];
+                }
+
+                if (multi) {
+                    mX.insertMulti(range + 0, range + numRange);
+                    for (int i = 0; i < numRange; ++i) {
+                        ++counts[range[i].first];
+                    }
+                    ASSERTV(LINE, verifyTree(X, counts, k_NUM_KEYS, serial));
+                }
+                else {
+                    mX.insertUnique(range + 0, range + numRange);
+                    for (int i = 0; i < numRange; ++i) {
+                        counts[range[i].first] = 1;
+                    }
+                    ASSERTV(LINE, verifyTree(X, counts, k_NUM_KEYS, 0));
+
+                    for (int k = 0; k < k_NUM_KEYS; ++k) {
+                        if (counts[k] && !isNew[k]) {
+                            ASSERTV(LINE, k, X.find(k)->second < serial);
+                        }
+                    }
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tPseudo-random ranges.\n");
+        {
+            Random random(17);
+
+            for (int size = 0; size < 300; size += 1 + size / 4) {
+                enum { k_MAX_KEYS = 600 };
+
+                int     counts[k_MAX_KEYS] = { 0 };
+                IntPair range[600];
+                int     numRange = 0;
+
+                const int numKeys = 1 + size * 2;
+
+                PairTree mX(&oa);  const PairTree& X = mX;
+                PairTree mY(&oa);  const PairTree& Y = mY;
+
+                for (int i = 0; i < size; ++i) {
+                    const int k = random(numKeys);
+                    mX.insertMulti(IntPair(k, i));
+                    ++counts[k];
+                }
+                mY.insertMulti(X.begin(), X.end());
+                ASSERTV(size, X == Y);
+
+                for (int i = 0; i < size; ++i) {
+                    const int k = random(numKeys);
+                    range[numRange++] = IntPair(k, size + i);
+                    ++counts[k];
+                }
+
+                mX.insertMulti(range + 0, range + numRange);
+                ASSERTV(size, verifyTree(X, counts, numKeys, size));
+
+                // Insert the range again, in reverse order of key.
+
+                std::sort(range + 0, range + numRange);
+                std::reverse(range + 0, range + numRange);
+                mY.insertMulti(range + 0, range + numRange);
+                ASSERTV(size, verifyTree(Y, counts, numKeys, size));
+
+                IntTree mZ(&oa);  const IntTree& Z = mZ;
+                int keys[600];
+                for (int i = 0; i < numRange; ++i) {
+                    keys[i] = range[i].first;
+                }
+                mZ.insertUnique(keys + 0, keys + numRange);
+                mZ.insertUnique(keys + 0, keys + numRange);
+
+                for (IntTree::ConstIterator it = Z.begin();
+                     it != Z.end();
+                     ++it) {
+                    ASSERTV(size, *it, 1 == Z.count(*it));
+                    if (it != Z.begin()) {
+                        ASSERTV(size, *(it - 1) < *it);
+                    }
+                }
+                for (int i = 0; i < numRange; ++i) {
+                    ASSERTV(size, i, Z.end() != Z.find(keys[i]));
+                }
+
+                if (veryVerbose) { T_ P_(size) P_(X.size()) P(Z.size()) }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tValues using an allocator.\n");
+        {
+            bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+            bsl::vector<AllocPair> source(&sa);
+            for (int i = 0; i < 100; ++i) {
+                source.push_back(AllocPair(i * 37 % 50, AllocType(i, &sa)));
+            }
+
+            const bsls::Types::Int64 numDefault = da.numBlocksTotal();
+
+            AllocPairTree mX(&oa);  const AllocPairTree& X = mX;
+            mX.insertUnique(source.begin(), source.begin() + 50);
+            ASSERTV(50 == X.size());
+            mX.insertUnique(source.begin(), source.end());
+            ASSERTV(50 == X.size());
+
+            AllocPairTree mY(&oa);  const AllocPairTree& Y = mY;
+            mY.insertMulti(source.begin(), source.end());
+            mY.insertMulti(source.begin(), source.begin() + 10);
+            ASSERTV(110 == Y.size());
+
+            for (AllocPairTree::ConstIterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERTV(it->first, &oa == it->second.allocator());
+                ASSERTV(it->first, it->first == it->second.data() * 37 % 50);
+                if (it != X.begin()) {
+                    ASSERTV(it->first, (it - 1)->first < it->first);
+                }
+            }
+            for (AllocPairTree::ConstIterator it = Y.begin();
+                 it != Y.end();
+                 ++it) {
+                ASSERTV(it->first, &oa == it->second.allocator());
+                if (it != Y.begin()) {
+                    ASSERTV(it->first, (it - 1)->first <= it->first);
+                }
+            }
+            ASSERTV(numDefault == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING SINGLE-VALUE INSERTION, LOOKUP, AND ERASURE
+        //
+        // Concerns:
+        //: 1 'insertUnique' inserts a value only if its key is absent, and
+        //:   returns the value having the key.
+        //:
+        //: 2 'insertMulti' inserts a value after those having the same key,
+        //:   and, given a hint, as close as possible before the hint.
+        //:
+        //: 3 Hinted insertion is correct whether the hint is right or wrong.
+        //:
+        //: 4 Each form of erasure removes the specified values and returns
+        //:   the correct iterator or count.
+        //:
+        //: 5 The lookup methods agree with the model after each operation.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Perform pseudo-random sequences of insertions (of each form,
+        //:   with hints at the beginning, end, and correct and random
+        //:   positions) and erasures, verifying the container against a model
+        //:   after each operation.  (C-1..6)
+        //
+        // Testing:
+        //   FlatTree(const ALLOCATOR& allocator = ALLOCATOR());
+        //   ~FlatTree();
+        //   Iterator begin();
+        //   Iterator end();
+        //   void clear();
+        //   Iterator erase(ConstIterator position);
+        //   Iterator erase(ConstIterator first, ConstIterator last);
+        //   SizeType erase(const KeyType& key);
+        //   Iterator find(const KeyType& key);
+        //   pair<Iterator, bool> insertUnique(const ValueType& value);
+        //   Iterator insertUnique(ConstIterator hint, const ValueType& value);
+        //   Iterator insertMulti(const ValueType& value);
+        //   Iterator insertMulti(ConstIterator hint, const ValueType& value);
+        //   Iterator lowerBound(const KeyType& key);
+        //   Iterator upperBound(const KeyType& key);
+        //   AllocatorType allocator() const;
+        //   ConstIterator begin() const;
+        //   SizeType count(const KeyType& key) const;
+        //   ConstIterator end() const;
+        //   pair<ConstIterator, ConstIterator> equalRange(const KeyType&);
+        //   ConstIterator find(const KeyType& key) const;
+        //   ConstIterator lowerBound(const KeyType& key) const;
+        //   SizeType maxSize() const;
+        //   SizeType size() const;
+        //   ConstIterator upperBound(const KeyType& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                    "\nTESTING SINGLE-VALUE INSERTION, LOOKUP, AND ERASURE"
+                    "\n===================================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        enum { k_NUM_KEYS = 40 };
+
+        for (int multi = 0; multi < 2; ++multi) {
+            if (verbose) printf("\t%s insertion.\n", multi ? "Multi"
+                                                           : "Unique");
+            Random random(multi + 1);
+
+            int counts[k_NUM_KEYS] = { 0 };
+            int serial = 0;
+
+            PairTree mX(&oa);  const PairTree& X = mX;
+            ASSERTV(&oa == X.allocator().mechanism());
+            ASSERTV(0 < X.maxSize());
+            ASSERTV(verifyTree(X, counts, k_NUM_KEYS));
+
+            for (int i = 0; i < 2000; ++i) {
+                const int k  = random(k_NUM_KEYS);
+                const int op = random(10);
+
+                if (op < 6) {
+                    // Insert.
+
+                    const IntPair V(k, serial++);
+                    const int     form = random(5);
+
+                    PairTree::ConstIterator hint;
+                    switch (form) {
+                      case 0: hint = X.begin();                        break;
+                      case 1: hint = X.end();                          break;
+                      case 2: hint = X.upperBound(k);                  break;
+                      case 3: hint = X.lowerBound(k);                  break;
+                      default: hint = X.begin() + random(
+                                               static_cast<int>(X.size()) + 1);
+                    }
+
+                    if (multi) {
+                        // A hinted insertion before 'lowerBound(k)' would
+                        // place 'V' before equivalent values; the model
+                        // requires insertion after them, so the hints used
+                        // are the end of the equal range or unrelated.
+
+                        PairTree::Iterator it;
+                        if (form == 4 || form == 3) {
+                            it = mX.insertMulti(V);
+                        }
+                        else if (form == 2 || counts[k] == 0) {
+                            it = mX.insertMulti(hint, V);
+                        }
+                        else {
+                            it = mX.insertMulti(V);
+                        }
+                        ASSERTV(i, k == it->first);
+                        ASSERTV(i, V.second == it->second);
+                        ++counts[k];
+                    }
+                    else if (form < 2) {
+                        bsl::pair<PairTree::Iterator, bool> result =
+                                                          mX.insertUnique(V);
+                        ASSERTV(i, (0 == counts[k]) == result.second);
+                        ASSERTV(i, k == result.first->first);
+                        counts[k] = 1;
+                    }
+                    else {
+                        const int                expected = counts[k]
+                                                 ? X.find(k)->second
+                                                 : V.second;
+                        PairTree::Iterator it = mX.insertUnique(hint, V);
+                        ASSERTV(i, k == it->first);
+                        ASSERTV(i, expected == it->second);
+                        counts[k] = 1;
+                    }
+                }
+                else if (op < 8) {
+                    // Erase by key.
+
+                    ASSERTV(i, counts[k] == static_cast<int>(mX.erase(k)));
+                    counts[k] = 0;
+                }
+                else if (0 != X.size()) {
+                    // Erase by position.
+
+                    const int pos = random(static_cast<int>(X.size()));
+                    PairTree::ConstIterator it = X.begin() + pos;
+                    const int key = it->first;
+                    PairTree::Iterator next = mX.erase(it);
+                    ASSERTV(i, X.begin() + pos == next);
+                    --counts[key];
+
+                    // Values having the same key keep their order, so erasing
+                    // any one of them leaves the model valid.
+                }
+                ASSERTV(i, verifyTree(X, counts, k_NUM_KEYS));
+            }
+
+            if (veryVerbose) { T_ P_(X.size()) P(oa.numBlocksInUse()) }
+
+            // Erase a range, and then clear.
+
+            if (X.size() > 4) {
+                PairTree::ConstIterator first = X.begin() + 1;
+                PairTree::ConstIterator last  = X.end() - 1;
+                for (PairTree::ConstIterator it = first; it != last; ++it) {
+                    --counts[it->first];
+                }
+                PairTree::Iterator next = mX.erase(first, last);
+                ASSERTV(X.begin() + 1 == next);
+                ASSERTV(2 == X.size());
+                ASSERTV(verifyTree(X, counts, k_NUM_KEYS));
+            }
+
+            mX.clear();
+            ASSERTV(0 == X.size());
+            ASSERTV(X.begin() == X.end());
+        }
+
+        if (verbose) printf("\tMulti insertion with hints.\n");
+        {
+            PairTree mX(&oa);  const PairTree& X = mX;
+            for (int i = 0; i < 10; ++i) {
+                mX.insertMulti(IntPair(i, 0));
+            }
+
+            // A correct hint is used as is.
+
+            PairTree::Iterator it = mX.insertMulti(X.begin() + 5,
+                                                   IntPair(5, -1));
+            ASSERTV(X.begin() + 5 == it);
+
+            // A hint that is too early places the value as early as possible
+            // (at 'lowerBound'); one that is too late, as late as possible
+            // (at 'upperBound').
+
+            it = mX.insertMulti(X.begin(), IntPair(7, -1));
+            ASSERTV(X.lowerBound(7) == it);
+            ASSERTV(-1 == it->second);
+
+            it = mX.insertMulti(X.end(), IntPair(2, 1));
+            ASSERTV(X.upperBound(2) - 1 == it);
+            ASSERTV(1 == it->second);
+
+            ASSERTV(13 == X.size());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'FlatTree_SearchUtil'
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same result as a linear
+        //:   search for every size of array, every position of the key, and
+        //:   runs of equal keys.
+        //:
+        //: 2 The result is correct for arrays spanning the prefetch threshold
+        //:   and for 'const' value types.
+        //
+        // Plan:
+        //: 1 For each size up to 300, fill an array with (non-strictly)
+        //:   ascending keys and search for each key in and around the range,
+        //:   comparing with a linear search.  Repeat with an array of 'const'
+        //:   pairs.  (C-1..2)
+        //
+        // Testing:
+        //   VALUE_TYPE *lowerBound(VALUE_TYPE *, size_t, const KEY&, CMP&);
+        //   VALUE_TYPE *upperBound(VALUE_TYPE *, size_t, const KEY&, CMP&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'FlatTree_SearchUtil'"
+                            "\n=============================\n");
+
+        typedef bslstl::FlatTree_SearchUtil                   Util;
+        typedef bslstl::UnorderedSetKeyConfiguration<int>     IntConfig;
+        typedef bslstl::UnorderedMapKeyConfiguration<IntPair> PairConfig;
+
+        const std::less<int> less = std::less<int>();
+
+        for (int size = 0; size <= 300; ++size) {
+            for (int step = 1; step <= 3; ++step) {
+                int     keys[300];
+                IntPair pairs[300];
+                for (int i = 0; i < size; ++i) {
+                    keys[i]  = i / step * 2;
+                    pairs[i] = IntPair(keys[i], i);
+                }
+
+                const int maxKey = size ? keys[size - 1] + 2 : 1;
+                for (int k = -1; k <= maxKey; ++k) {
+                    int lower = 0;
+                    while (lower < size && keys[lower] < k) {
+                        ++lower;
+                    }
+                    int upper = lower;
+                    while (upper < size && keys[upper] <= k) {
+                        ++upper;
+                    }
+
+                    ASSERTV(size, step, k,
+                            keys + lower == Util::lowerBound<IntConfig>(
+                                                      keys, size, k, less));
+                    ASSERTV(size, step, k,
+                            keys + upper == Util::upperBound<IntConfig>(
+                                                      keys, size, k, less));
+
+                    const IntPair *cpairs = pairs;
+                    ASSERTV(size, step, k,
+                            cpairs + lower == Util::lowerBound<PairConfig>(
+                                                    cpairs, size, k, less));
+                    ASSERTV(size, step, k,
+                            cpairs + upper == Util::upperBound<PairConfig>(
+                                                    cpairs, size, k, less));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase some values, and copy a container.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+        {
+            IntTree mX(&oa);  const IntTree& X = mX;
+            ASSERTV(0 == X.size());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            for (int i = 999; i >= 0; --i) {
+                bsl::pair<IntTree::Iterator, bool> result =
+                                                 mX.insertUnique(i * 7 % 1000);
+                ASSERTV(i, result.second);
+            }
+            ASSERTV(1000 == X.size());
+            ASSERTV(0 == mX.insertUnique(0).second);
+
+            long long sum = 0;
+            for (IntTree::ConstIterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(*it, *it == it - X.begin());
+                sum += *it;
+            }
+            ASSERTV(999LL * 1000 / 2 == sum);
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERTV(500 == X.size());
+            ASSERTV(X.end() == X.find(2));
+            ASSERTV(3 == *X.find(3));
+
+            IntTree mY(X, &oa);  const IntTree& Y = mY;
+            ASSERTV(X == Y);
+            mY.insertUnique(-1);
+            ASSERTV(X != Y);
+
+            ASSERTV(0 == da.numBlocksTotal());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,13 +12,24 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bsl::hash: hash function for fundamental types
 //
-//@SEE_ALSO: bsl+stdhdrs
+//@SEE_ALSO: bsl+stdhdrs, bslh_hash
 //
 //@DESCRIPTION: This component provides a template unary functor, 'bsl::hash',
 // implementing the 'std::hash' functor.  'bsl::hash' applies a C++ standard
 // compliant, implementation defined, hash function to fundamental types
 // returning the result of such application.
 //
+// For any other type, 'bsl::hash' is implemented by 'bslh::Hash<>' (see
+// 'bslh_hash'), which hashes an object by supplying its salient attributes to
+// a hashing algorithm through the object's 'hashAppend' function.  A type may
+// therefore be hashed by 'bsl::hash' (and so used as the key of a
+// 'bsl::unordered_map', for example) either by providing a 'hashAppend'
+// overload, which is recommended, or by specializing 'bsl::hash' (as shown in
+// the usage example below).  Note that the
+// specializations of 'bsl::hash' for fundamental types do not use the
+// 'hashAppend' protocol, so that 'bsl::hash<int>()(x)' need not equal
+// 'bslh::Hash<>()(x)'.
+//
 /// Standard Hash Function
 // According to the C++ standard the requirements of a standard hash function
 // 'h' are:
@@ -386,6 +397,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_hashutil.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
 #include <bslmf_istriviallycopyable.h>
 #endif
@@ -415,11 +430,39 @@ namespace bsl {
                           // ==================
 
 template <class TYPE>
-struct hash;
-    // Empty base class for hashing.  No general hash struct defined, each type
-    // requires a specialization.  Leaving this struct declared but undefined
-    // will generate error messages that are more clear when someone tries to
-    // use a key that does not have a corresponding hash function.
+struct hash : ::BloombergLP::bslh::Hash<> {
+    // This class provides hashing functionality for types having no
+    // specialization of 'hash', by supplying the key to the default hashing
+    // algorithm using the 'hashAppend' protocol (see 'bslh_hash').  Use of
+    // this template for a type that provides neither a specialization of
+    // 'hash' nor a 'hashAppend' overload will fail to compile.
+
+    // STANDARD TYPEDEFS
+    typedef TYPE argument_type;
+    typedef std::size_t result_type;
+
+    //! hash() = default;
+        // Create a 'hash' object.
+
+    //! hash(const hash& original) = default;
+        // Create a 'hash' object.  Note that as 'hash' is an empty (stateless)
+        // type, this operation will have no observable effect.
+
+    //! ~hash() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! hash& operator=(const hash& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  Note
+        // that as 'hash' is an empty (stateless) type, this operation will
+        // have no observable effect.
+
+    // ACCESSORS
+    //! std::size_t operator()(const TYPE& x) const;
+        // Return a hash value computed using the specified 'x'.  Note that
+        // this operator is inherited from 'bslh::Hash<>'.
+};
 
 
 // ============================================================================
@@ -1,6 +1,8 @@
 // bslstl_hash.t.cpp                                                  -*-C++-*-
 #include <bslstl_hash.h>
 
+#include <bslh_hash.h>
+
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
@@ -37,7 +39,8 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] STRINGTHING
-// [ 8] USAGE EXAMPLE
+// [ 8] TYPES SUPPORTING 'hashAppend'
+// [ 9] USAGE EXAMPLE
 // [ 4] Standard typedefs
 // [ 5] Bitwise-movable trait
 // [ 5] IsPod trait
@@ -348,6 +351,41 @@ struct hash<StringThing> {
 
 }  // close namespace bsl
 
+namespace TestNs {
+
+class Employee {
+    // This class is a user-defined type that supports the 'hashAppend'
+    // protocol and does not specialize 'bsl::hash'.
+
+    // DATA
+    int    d_id;      // employee number
+    double d_salary;  // salary
+
+    // FRIENDS
+    template <class HASH_ALGORITHM>
+    friend void hashAppend(HASH_ALGORITHM& algorithm, const Employee& object)
+        // Supply the salient attributes of the specified 'object' to the
+        // specified 'algorithm'.
+    {
+        using BloombergLP::bslh::hashAppend;
+        hashAppend(algorithm, object.d_id);
+        hashAppend(algorithm, object.d_salary);
+    }
+
+  public:
+    // CREATORS
+    Employee(int id, double salary)
+        // Create an employee having the specified 'id' and 'salary'.
+    : d_id(id)
+    , d_salary(salary)
+    {
+    }
+};
+
+enum Fruit { e_APPLE, e_BANANA, e_CHERRY };
+
+}  // close namespace TestNs
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -368,7 +406,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -445,7 +483,7 @@ int main(int argc, char *argv[])
         strcpy(buffer, "steal");
         ASSERT(0 == hcrsts.count(buffer));
       } break;
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -492,6 +530,74 @@ int main(int argc, char *argv[])
         ASSERT(0 == hcri.count(37));
         ASSERT(0 == hcri.count(58));
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING TYPES SUPPORTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hash' can be instantiated for a type that has no specialization
+        //:   of 'hash' but provides a 'hashAppend' overload, and for an
+        //:   enumeration.
+        //:
+        //: 2 The value returned is that of 'bslh::Hash<>', so that equal
+        //:   objects have equal hash values.
+        //:
+        //: 3 The standard typedefs and traits are those of the other
+        //:   specializations, and the type is empty.
+        //
+        // Plan:
+        //: 1 Define a user-defined type, 'TestNs::Employee', having a
+        //:   'hashAppend' friend function, and an enumeration.  Compare the
+        //:   results of 'hash' with those of 'bslh::Hash<>' for several
+        //:   values.  (C-1..2)
+        //:
+        //: 2 Verify the typedefs using 'bsl::is_same', the traits using the
+        //:   trait meta-functions, and that the type is empty by deriving from
+        //:   it.  (C-3)
+        //
+        // Testing:
+        //   TYPES SUPPORTING 'hashAppend'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TYPES SUPPORTING 'hashAppend'"
+                            "\n=====================================\n");
+
+        typedef hash<TestNs::Employee> Obj;
+
+        ASSERT((bsl::is_same<TestNs::Employee, Obj::argument_type>::value));
+        ASSERT((bsl::is_same<size_t, Obj::result_type>::value));
+        ASSERT(bsl::is_trivially_copyable<Obj>::value);
+        ASSERT(bsl::is_trivially_default_constructible<Obj>::value);
+
+        struct Derived : Obj { int d_data; };
+        ASSERT(sizeof(int) == sizeof(Derived));
+
+        typedef BloombergLP::bslh::Hash<> DefaultHash;
+
+        const Obj         X = Obj();
+        const DefaultHash H = DefaultHash();
+
+        const TestNs::Employee A(1, 100.0);
+        const TestNs::Employee B(1, 100.0);
+        const TestNs::Employee C(2, 100.0);
+        const TestNs::Employee D(1, -0.0);
+        const TestNs::Employee E(1,  0.0);
+
+        ASSERT(H(A) == X(A));
+        ASSERT(H(C) == X(C));
+        ASSERT(X(A) == X(B));
+        ASSERT(X(A) != X(C));
+        ASSERT(X(D) == X(E));
+
+        typedef hash<const TestNs::Employee> ConstObj;
+
+        const ConstObj CX = ConstObj();
+        ASSERT(X(A) == CX(A));
+
+        const hash<TestNs::Fruit> F = hash<TestNs::Fruit>();
+        ASSERT(H(TestNs::e_BANANA) == F(TestNs::e_BANANA));
+        ASSERT(F(TestNs::e_APPLE)  != F(TestNs::e_CHERRY));
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING 'StringThing'
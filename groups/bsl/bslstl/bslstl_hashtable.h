@@ -1470,6 +1470,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_bidirectionalnodepool.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_ITERATORUTIL
+#include <bslstl_iteratorutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -1573,6 +1577,9 @@ class HashTable_ArrayProctor;
 template <class FACTORY>
 class HashTable_NodeProctor;
 
+template <class FACTORY>
+class HashTable_HashedNodeArray;
+
 template <class FUNCTOR>
 class HashTable_ComparatorWrapper;
 
@@ -2128,6 +2135,26 @@ class HashTable {
 
   private:
     // PRIVATE MANIPULATORS
+    void appendNodeIfMissing(
+            HashTable_HashedNodeArray<typename ImplParameters::NodeFactory>
+                                                                  *nodes,
+            const ValueType&                                       value);
+    template <class SOURCE_TYPE>
+    void appendNodeIfMissing(
+            HashTable_HashedNodeArray<typename ImplParameters::NodeFactory>
+                                                                  *nodes,
+            const SOURCE_TYPE&                                     value);
+        // Append to the specified 'nodes' a newly created node holding a copy
+        // of the specified 'value', together with the hash code of its key,
+        // unless this hash-table already contains an element whose key
+        // compares equal (according to this hash-table's 'comparator') to
+        // that of 'value'.  If 'value' is a 'ValueType', its key is hashed and
+        // looked up before any node is created; otherwise, the key cannot be
+        // obtained without creating a 'ValueType' object, and the node is
+        // destroyed if the look-up succeeds.  Note that the nodes in 'nodes'
+        // are not linked into this hash-table, and so are not considered by
+        // the look-up.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -2178,6 +2205,14 @@ class HashTable {
         // it is for a default constructed hashtable, then the bucket array is
         // not destroyed.
 
+    void reserveBucketsForNumElements(SizeType numElements);
+        // Re-organize this hash-table to have a sufficient number of buckets
+        // to accommodate at least the specified 'numElements' without
+        // exceeding the 'maxLoadFactor'.  Unlike 'reserveForNumElements', no
+        // nodes are reserved.  If this function tries to allocate a number of
+        // buckets larger than can be represented by this hash table's
+        // 'SizeType', a 'std::length_error' exception will be thrown.
+
     // PRIVATE ACCESSORS
     native_std::size_t hashCodeForNode(bslalg::BidirectionalLink *node) const;
         // Return the hash code for the element stored in the specified 'node'
@@ -2350,6 +2385,39 @@ class HashTable {
         // hash table's 'SizeType', a 'std::length_error' exception will be
         // thrown.
 
+    template <class INPUT_ITERATOR>
+    void insertRangeIfMissing(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this hash-table a copy of each element in the range
+        // starting at the specified 'first' iterator and ending immediately
+        // before the specified 'last' iterator, whose key does not compare
+        // equal (according to this hash-table's 'comparator') to that of an
+        // element already in this hash-table, or of an element earlier in the
+        // range.  The range is traversed once.  Elements are inserted in
+        // place, as by 'insertIfMissing', for as long as this hash-table has
+        // capacity for them without growing its bucket array (for a range
+        // whose length can be computed without traversing it, only if it has
+        // capacity for the whole range), so that no memory is allocated other
+        // than for the new nodes.  For each remaining element whose key is not
+        // already in this hash-table, a node is created and buffered together
+        // with the hash code of its key, so that the hash code of each element
+        // is computed exactly once.  The bucket array is then grown at most
+        // once, to accommodate all of the buffered nodes (so that the elements
+        // already in this hash-table are rehashed at most once), and the
+        // buffered nodes are sorted by bucket and linked in bucket by bucket,
+        // so that the bucket array is traversed sequentially rather than at
+        // random.  If the length of the range can be computed without
+        // traversing it, nodes and buffer space are reserved for that length
+        // up front.  Note that a key repeated within the range is detected
+        // only when the nodes are linked, so a node is created (and then
+        // destroyed) for each repetition.  If this function tries to allocate
+        // a number of buckets larger than can be represented by this hash
+        // table's 'SizeType', a 'std::length_error' exception will be thrown.
+        // If an exception is thrown, the elements inserted before the
+        // exception remain in this hash-table.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values
+        // of a type convertible to 'ValueType'.
+
     bslalg::BidirectionalLink *remove(bslalg::BidirectionalLink *node);
         // Remove the specified 'node' from this hash-table, and return the
         // address of the node immediately after 'node' this hash-table (prior
@@ -2497,6 +2565,30 @@ class HashTable {
         // hash-table ensures all elements having the same key form a
         // contiguous sequence.
 
+    template <class LOOKUP_KEY>
+    bslalg::BidirectionalLink *findTransparent(const LOOKUP_KEY& key) const;
+        // Return the address of a link whose key compares equal (according to
+        // this hash-table's 'comparator') to the specified 'key', and a null
+        // pointer value if no such link exists.  If this hash-table contains
+        // more than one such element, return the first one.  Unlike 'find',
+        // 'key' is not converted to 'KeyType', but is passed as is to the
+        // 'hasher' and 'comparator' of this hash-table, which must both
+        // accept it, and the 'hasher' must return for 'key' the same hash
+        // code as for any key comparing equal to it.
+
+    template <class LOOKUP_KEY>
+    void findRangeTransparent(bslalg::BidirectionalLink **first,
+                              bslalg::BidirectionalLink **last,
+                              const LOOKUP_KEY&           key) const;
+        // Load into the specified 'first' and 'last' pointers the respective
+        // addresses of the first and last link (in the list of elements owned
+        // by this hash table) where the contained elements have a key that
+        // compares equal to the specified 'key' using the 'comparator' of
+        // this hash-table, and null pointers values if there are no elements
+        // matching 'key'.  The 'key' is passed as is to the 'hasher' and
+        // 'comparator' of this hash-table, as for 'findTransparent'.  Note
+        // that the output values form a closed range, as for 'findRange'.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a
@@ -2660,6 +2752,115 @@ class HashTable_NodeProctor {
         // If no object is currently being managed, this method has no effect.
 };
 
+                    // ===============================
+                    // class HashTable_HashedNodeArray
+                    // ===============================
+
+template <class FACTORY>
+class HashTable_HashedNodeArray {
+    // This class implements a proctor for a growable array of nodes, each
+    // paired with the hash code of its key, that have been created but not yet
+    // linked into a hash table.  Upon destruction, each node that has not been
+    // released from management is deallocated by invoking the 'deleteNode'
+    // method of a supplied factory, and the memory for the array is returned
+    // to the allocator of that factory.  The (template parameter) type
+    // 'FACTORY' shall provide a type 'AllocatorType' and member functions that
+    // can be called as if they had the following signatures:
+    //..
+    //  AllocatorType& allocator();
+    //  void deleteNode(bslalg::BidirectionalLink *node);
+    //..
+
+    // PRIVATE TYPES
+    struct Entry {
+        // This 'struct' pairs a node with the hash code of its key.
+
+        native_std::size_t         d_hashCode;  // hash code of the key
+        bslalg::BidirectionalLink *d_node_p;    // node (owned)
+    };
+
+    typedef typename FACTORY::AllocatorType                 NodeAllocator;
+    typedef ::bsl::allocator_traits<NodeAllocator>          NodeAllocTraits;
+    typedef typename NodeAllocTraits::template
+                                   rebind_traits<Entry>     EntryAllocTraits;
+    typedef typename EntryAllocTraits::allocator_type       EntryAllocator;
+    typedef typename EntryAllocTraits::size_type            EntrySizeType;
+
+    // DATA
+    FACTORY            *d_factory;      // node factory (held, not owned)
+    Entry              *d_entries;      // array of entries, if allocated
+    native_std::size_t  d_capacity;     // number of entries allocated
+    native_std::size_t  d_size;         // number of entries appended
+    native_std::size_t  d_numReleased;  // number of leading entries whose
+                                        // nodes have been released
+
+  private:
+    // NOT IMPLEMENTED
+    HashTable_HashedNodeArray(const HashTable_HashedNodeArray&);
+    HashTable_HashedNodeArray& operator=(const HashTable_HashedNodeArray&);
+
+    // PRIVATE MANIPULATORS
+    Entry *allocateEntries(native_std::size_t numEntries);
+        // Return the address of an uninitialized array of the specified
+        // 'numEntries' entries, allocated from the allocator of the factory
+        // supplied at construction.  Throw 'std::bad_alloc' if 'numEntries'
+        // exceeds the maximum size supported by that allocator.
+
+    void deallocateEntries(Entry *entries, native_std::size_t numEntries);
+        // Return the specified array of 'numEntries' 'entries', obtained from
+        // 'allocateEntries', to the allocator of the factory supplied at
+        // construction.
+
+  public:
+    // CREATORS
+    explicit HashTable_HashedNodeArray(FACTORY *factory);
+        // Create a new proctor managing an empty array of nodes, that uses the
+        // specified 'factory' to destroy the nodes appended to the array (and
+        // not released from it) upon its destruction, and the allocator of
+        // 'factory' to supply memory for the array.
+
+    ~HashTable_HashedNodeArray();
+        // Destroy this proctor, delete each node in the array that has not
+        // been released by invoking the 'deleteNode' method of the factory
+        // supplied at construction, and deallocate the array.
+
+    // MANIPULATORS
+    void append(bslalg::BidirectionalLink *node, native_std::size_t hashCode);
+        // Add the specified 'node', whose key has the specified 'hashCode', to
+        // the end of the array managed by this proctor.  If an exception is
+        // thrown, 'node' is not managed by this proctor.  The behavior is
+        // undefined unless 'node' was created by the factory supplied at
+        // construction, is not linked into any list, and no node has been
+        // released from this proctor.
+
+    bslalg::BidirectionalLink *releaseFront(native_std::size_t *hashCode);
+        // Release from management the first node in the array managed by this
+        // proctor that has not already been released, load the hash code of
+        // its key into the specified 'hashCode', and return its address, or
+        // return a null pointer value (and leave 'hashCode' unchanged) if
+        // every node has been released.
+
+    void reserve(native_std::size_t numNodes);
+        // Allocate memory for the array managed by this proctor to hold at
+        // least the specified 'numNodes' nodes without further allocation.
+        // The behavior is undefined unless no node has been released from
+        // this proctor.
+
+    void sortByBucket(native_std::size_t numBuckets);
+        // Reorder the nodes in the array managed by this proctor by the index
+        // of the bucket, in an array of the specified 'numBuckets' buckets,
+        // that the hash code of each node selects (see
+        // 'bslalg::HashTableImpUtil::computeBucketIndex'), preserving the
+        // relative order of the nodes selecting the same bucket.  The
+        // behavior is undefined unless '0 < numBuckets' and no node has been
+        // released from this proctor.
+
+    // ACCESSORS
+    native_std::size_t size() const;
+        // Return the number of nodes in the array managed by this proctor that
+        // have not been released.
+};
+
                     // ==========================
                     // class HashTable_ImpDetails
                     // ==========================
@@ -2992,6 +3193,190 @@ void HashTable_NodeProctor<FACTORY>::release()
     d_node = 0;
 }
 
+                    // -------------------------------
+                    // class HashTable_HashedNodeArray
+                    // -------------------------------
+
+// CREATORS
+template <class FACTORY>
+inline
+HashTable_HashedNodeArray<FACTORY>::HashTable_HashedNodeArray(
+                                                              FACTORY *factory)
+: d_factory(factory)
+, d_entries(0)
+, d_capacity(0)
+, d_size(0)
+, d_numReleased(0)
+{
+    BSLS_ASSERT_SAFE(factory);
+}
+
+template <class FACTORY>
+HashTable_HashedNodeArray<FACTORY>::~HashTable_HashedNodeArray()
+{
+    for (native_std::size_t i = d_numReleased; i < d_size; ++i) {
+        d_factory->deleteNode(d_entries[i].d_node_p);
+    }
+    if (d_entries) {
+        this->deallocateEntries(d_entries, d_capacity);
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class FACTORY>
+typename HashTable_HashedNodeArray<FACTORY>::Entry *
+HashTable_HashedNodeArray<FACTORY>::allocateEntries(
+                                                 native_std::size_t numEntries)
+{
+    EntryAllocator entryAllocator(d_factory->allocator());
+
+    if (EntryAllocTraits::max_size(entryAllocator) < numEntries) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    return EntryAllocTraits::allocate(entryAllocator,
+                                      static_cast<EntrySizeType>(numEntries));
+}
+
+template <class FACTORY>
+inline
+void HashTable_HashedNodeArray<FACTORY>::deallocateEntries(
+                                          Entry              *entries,
+                                          native_std::size_t  numEntries)
+{
+    EntryAllocator entryAllocator(d_factory->allocator());
+    EntryAllocTraits::deallocate(entryAllocator,
+                                 entries,
+                                 static_cast<EntrySizeType>(numEntries));
+}
+
+// MANIPULATORS
+template <class FACTORY>
+inline
+void HashTable_HashedNodeArray<FACTORY>::append(
+                                   bslalg::BidirectionalLink *node,
+                                   native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(0 == d_numReleased);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_size == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        this->reserve(d_capacity ? 2 * d_capacity : 16);
+    }
+
+    d_entries[d_size].d_hashCode = hashCode;
+    d_entries[d_size].d_node_p   = node;
+    ++d_size;
+}
+
+template <class FACTORY>
+inline
+bslalg::BidirectionalLink *HashTable_HashedNodeArray<FACTORY>::releaseFront(
+                                                  native_std::size_t *hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode);
+
+    if (d_numReleased == d_size) {
+        return 0;                                                     // RETURN
+    }
+
+    // Prefetch a node that will be released shortly, as the nodes are
+    // typically released in an order unrelated to their addresses.
+
+    enum { k_PREFETCH_DISTANCE = 8 };
+
+    if (d_numReleased + k_PREFETCH_DISTANCE < d_size) {
+        bsls::PerformanceHint::prefetchForWriting(
+                d_entries[d_numReleased + k_PREFETCH_DISTANCE].d_node_p);
+    }
+
+    const Entry& entry = d_entries[d_numReleased];
+    ++d_numReleased;
+
+    *hashCode = entry.d_hashCode;
+    return entry.d_node_p;
+}
+
+template <class FACTORY>
+void HashTable_HashedNodeArray<FACTORY>::reserve(native_std::size_t numNodes)
+{
+    BSLS_ASSERT_SAFE(0 == d_numReleased);
+
+    if (numNodes <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    Entry *entries = this->allocateEntries(numNodes);
+
+    if (d_entries) {
+        native_std::copy(d_entries, d_entries + d_size, entries);
+        this->deallocateEntries(d_entries, d_capacity);
+    }
+    d_entries  = entries;
+    d_capacity = numNodes;
+}
+
+template <class FACTORY>
+void HashTable_HashedNodeArray<FACTORY>::sortByBucket(
+                                                 native_std::size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(0 < numBuckets);
+    BSLS_ASSERT_SAFE(0 == d_numReleased);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (d_size < 2 || 1 == numBuckets) {
+        return;                                                       // RETURN
+    }
+
+    // Perform a counting sort into a new array, whose tail also holds, for
+    // each bucket, the position in the new array of the next entry selecting
+    // that bucket.  Note that 'Entry' is at least as strictly aligned as
+    // 'size_t'.
+
+    const native_std::size_t numCountEntries =
+              (numBuckets * sizeof(native_std::size_t) + sizeof(Entry) - 1)
+                                                               / sizeof(Entry);
+    const native_std::size_t capacity = d_size + numCountEntries;
+
+    Entry *sorted = this->allocateEntries(capacity);
+
+    native_std::size_t *positions =
+                      reinterpret_cast<native_std::size_t *>(sorted + d_size);
+    native_std::fill_n(positions, numBuckets, native_std::size_t(0));
+
+    for (native_std::size_t i = 0; i < d_size; ++i) {
+        ++positions[ImpUtil::computeBucketIndex(d_entries[i].d_hashCode,
+                                                numBuckets)];
+    }
+
+    native_std::size_t position = 0;
+    for (native_std::size_t i = 0; i < numBuckets; ++i) {
+        const native_std::size_t count = positions[i];
+        positions[i] = position;
+        position    += count;
+    }
+
+    for (native_std::size_t i = 0; i < d_size; ++i) {
+        sorted[positions[ImpUtil::computeBucketIndex(d_entries[i].d_hashCode,
+                                                     numBuckets)]++] =
+                                                                 d_entries[i];
+    }
+
+    this->deallocateEntries(d_entries, d_capacity);
+    d_entries  = sorted;
+    d_capacity = capacity;
+}
+
+// ACCESSORS
+template <class FACTORY>
+inline
+native_std::size_t HashTable_HashedNodeArray<FACTORY>::size() const
+{
+    return d_size - d_numReleased;
+}
+
                     // ----------------------------
                     // class HashTable_ArrayProctor
                     // ----------------------------
@@ -3254,6 +3639,60 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::appendNodeIfMissing(
+            HashTable_HashedNodeArray<typename ImplParameters::NodeFactory>
+                                                                  *nodes,
+            const ValueType&                                       value)
+{
+    typedef typename ImplParameters::NodeFactory NodeFactory;
+
+    BSLS_ASSERT_SAFE(nodes);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                                KEY_CONFIG::extractKey(value));
+    if (this->find(KEY_CONFIG::extractKey(value), hashCode)) {
+        return;                                                       // RETURN
+    }
+
+    bslalg::BidirectionalLink *node =
+                                 d_parameters.nodeFactory().createNode(value);
+    HashTable_NodeProctor<NodeFactory> nodeProctor(
+                                                   &d_parameters.nodeFactory(),
+                                                   node);
+
+    nodes->append(node, hashCode);
+    nodeProctor.release();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_TYPE>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::appendNodeIfMissing(
+            HashTable_HashedNodeArray<typename ImplParameters::NodeFactory>
+                                                                  *nodes,
+            const SOURCE_TYPE&                                     value)
+{
+    typedef bslalg::HashTableImpUtil             ImpUtil;
+    typedef typename ImplParameters::NodeFactory NodeFactory;
+
+    BSLS_ASSERT_SAFE(nodes);
+
+    bslalg::BidirectionalLink *node =
+                                 d_parameters.nodeFactory().createNode(value);
+    HashTable_NodeProctor<NodeFactory> nodeProctor(
+                                                   &d_parameters.nodeFactory(),
+                                                   node);
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                        ImpUtil::extractKey<KEY_CONFIG>(node));
+    if (this->find(ImpUtil::extractKey<KEY_CONFIG>(node), hashCode)) {
+        return;                                                       // RETURN
+    }
+
+    nodes->append(node, hashCode);
+    nodeProctor.release();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -3444,6 +3883,28 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
                                        this->allocator());
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+                        reserveBucketsForNumElements(SizeType numElements)
+{
+    if (numElements > d_capacity) {
+        // Compute a "good" number of buckets, e.g., pick a prime number
+        // from a sorted array of exponentially increasing primes.
+
+        size_t capacity;
+        SizeType numBuckets = static_cast<SizeType>(
+                              HashTable_ImpDetails::growBucketsForLoadFactor(
+                                       &capacity,
+                                       numElements,
+                                       static_cast<size_t>(this->numBuckets()),
+                                       d_maxLoadFactor));
+
+        this->rehashIntoExactlyNumBuckets(numBuckets,
+                                          static_cast<SizeType>(capacity));
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
@@ -3736,6 +4197,72 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     return position;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertRangeIfMissing(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    typedef bslalg::HashTableImpUtil             ImpUtil;
+    typedef typename ImplParameters::NodeFactory NodeFactory;
+
+    const SizeType maxInsertions = static_cast<SizeType>(
+                                   IteratorUtil::insertDistance(first, last));
+
+    if (!maxInsertions || d_size + maxInsertions <= d_capacity) {
+        // Insert elements in place for as long as the bucket array need not
+        // grow, so that no memory other than for their nodes is allocated
+        // (e.g., after a call to 'reserve').  Note that a forward range either
+        // fits entirely or is skipped here, and that the length of a
+        // single-pass range is not known.
+
+        bool isInsertedFlag;  // not used
+        for (; first != last && d_size < d_capacity; ++first) {
+            this->insertIfMissing(&isInsertedFlag, *first);
+        }
+    }
+
+    HashTable_HashedNodeArray<NodeFactory> nodes(&d_parameters.nodeFactory());
+
+    if (first != last && maxInsertions) {
+        d_parameters.nodeFactory().reserveNodes(maxInsertions);
+        nodes.reserve(maxInsertions);
+    }
+
+    // Create a node for each remaining element whose key is not already
+    // present, and hash its key, before sizing the bucket array for all of
+    // them.
+
+    for (; first != last; ++first) {
+        this->appendNodeIfMissing(&nodes, *first);
+    }
+
+    if (!nodes.size()) {
+        return;                                                       // RETURN
+    }
+
+    this->reserveBucketsForNumElements(
+                               d_size + static_cast<SizeType>(nodes.size()));
+
+    // Link the nodes in bucket by bucket, skipping repeated keys.
+
+    nodes.sortByBucket(d_anchor.bucketArraySize());
+
+    size_t hashCode;
+    while (bslalg::BidirectionalLink *node = nodes.releaseFront(&hashCode)) {
+        HashTable_NodeProctor<NodeFactory> nodeProctor(
+                                                   &d_parameters.nodeFactory(),
+                                                   node);
+
+        if (!this->find(ImpUtil::extractKey<KEY_CONFIG>(node), hashCode)) {
+            ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+            nodeProctor.release();
+            ++d_size;
+        }
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -3769,21 +4296,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     }
 
     d_parameters.nodeFactory().reserveNodes(numElements);
-    if (numElements > d_capacity) {
-        // Compute a "good" number of buckets, e.g., pick a prime number
-        // from a sorted array of exponentially increasing primes.
-
-        size_t capacity;
-        SizeType numBuckets = static_cast<SizeType>(
-                              HashTable_ImpDetails::growBucketsForLoadFactor(
-                                       &capacity,
-                                       numElements,
-                                       static_cast<size_t>(this->numBuckets()),
-                                       d_maxLoadFactor));
-
-        this->rehashIntoExactlyNumBuckets(numBuckets,
-                                          static_cast<SizeType>(capacity));
-    }
+    this->reserveBucketsForNumElements(numElements);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3949,6 +4462,38 @@ HashTable< KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRange(
            : 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findTransparent(
+                                                  const LOOKUP_KEY& key) const
+{
+    return bslalg::HashTableImpUtil::findTransparent<KEY_CONFIG>(
+                                             d_anchor,
+                                             key,
+                                             d_parameters.comparator(),
+                                             d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRangeTransparent(
+                                      bslalg::BidirectionalLink **first,
+                                      bslalg::BidirectionalLink **last,
+                                      const LOOKUP_KEY&           key) const
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(last);
+
+    *first = this->findTransparent(key);
+    *last  = *first
+           ? this->findEndOfRange(*first)
+           : 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
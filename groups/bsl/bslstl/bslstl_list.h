@@ -507,6 +507,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -1673,6 +1677,14 @@ void swap(list<VALUE, ALLOCATOR>& lhs, list<VALUE, ALLOCATOR>& rhs);
     // the other list prior to this call.  Note that this function does not
     // throw if 'lhs.get_allocator()' and 'rhs.get_allocator()' are equal.
 
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE, class ALLOCATOR>
+void hashAppend(HASHALG& hashAlg, const list<VALUE, ALLOCATOR>& input);
+    // Pass the specified 'input' list to the specified 'hashAlg': its size
+    // (as a 'std::size_t'), followed by each of its elements in order.  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').
+
 }  // close namespace bsl
 
 // ===========================================================================
@@ -3225,6 +3237,20 @@ void bsl::swap(list<VALUE, ALLOCATOR>& lhs, list<VALUE, ALLOCATOR>& rhs)
     lhs.swap(rhs);
 }
 
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE, class ALLOCATOR>
+inline
+void bsl::hashAppend(HASHALG& hashAlg, const list<VALUE, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    typedef typename list<VALUE, ALLOCATOR>::const_iterator ci_t;
+
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
+    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
+        hashAppend(hashAlg, *b);
+    }
+}
+
 
 #endif
 
@@ -2,6 +2,8 @@
 #include <bslstl_list.h>
 #include <bslstl_iterator.h>
 
+#include <bslh_defaulthashalgorithm.h>     // for testing only
+#include <bslh_hash.h>                     // for testing only
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>   // for testing only
@@ -157,6 +159,7 @@ using namespace bsl;
 // [20] bool operator<=(const list<T,A>&, const list<T,A>&);
 // [20] bool operator>=(const list<T,A>&, const list<T,A>&);
 // [19] void swap(list<T,A>&, list<T,A>&);
+// [30] void hashAppend(HASHALG& hashAlg, const list<T,A>& input);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
@@ -8701,6 +8704,56 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the list (as a 'size_t'), and
+        //:   then each of its elements, in list order, to the hashing
+        //:   algorithm, regardless of the order in which the nodes were
+        //:   allocated.
+        //
+        // Plan:
+        //: 1 For several lengths, create a list of 'int' by pushing at the
+        //:   front, and compare the value computed by 'bslh::Hash' with that
+        //:   of a 'bslh::DefaultHashAlgorithm' to which the size and elements
+        //:   were supplied explicitly in list order.  Repeat after reversing
+        //:   the list, which relinks its nodes.  (C-1)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const list<T,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        typedef bsl::list<int>::const_iterator Iterator;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int length = 0; length <= 5; ++length) {
+            bsl::list<int> mX(&oa);  const bsl::list<int>& X = mX;
+            for (int i = 0; i < length; ++i) {
+                mX.push_front(i * i);
+            }
+
+            for (int pass = 0; pass < 2; ++pass) {
+                bslh::DefaultHashAlgorithm expected;
+                const size_t               SIZE = length;
+                expected(&SIZE, sizeof SIZE);
+                for (Iterator it = X.begin(); it != X.end(); ++it) {
+                    expected(&*it, sizeof *it);
+                }
+                LOOP2_ASSERT(length, pass,
+                             expected.computeHash() == hasher(X));
+
+                mX.reverse();
+            }
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -457,6 +457,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -856,6 +868,26 @@ class map {
         // object in this map having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  This method participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf::IsTransparentPredicate'),
+        // in which case 'key' is compared with the keys of this map without
+        // being converted to 'key_type'.
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     iterator lower_bound(const key_type& key);
         // Return an iterator providing modifiable access to the first (i.e.,
         // ordered least) 'value_type' object in this map whose key is
@@ -866,6 +898,25 @@ class map {
         // having 'key' could be inserted into the ordered sequence maintained
         // by this map, while preserving its ordering.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is not
+        // ordered before the specified 'key', and the past-the-end iterator
+        // if there is no such object.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent, in which case 'key'
+        // is not converted to 'key_type'.
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     iterator upper_bound(const key_type& key);
         // Return an iterator providing modifiable access to the first (i.e.,
         // ordered least) 'value_type' object in this map whose key is greater
@@ -876,6 +927,25 @@ class map {
         // ordered sequence maintained by this map, while preserving its
         // ordering.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is ordered
+        // after the specified 'key', and the past-the-end iterator if there
+        // is no such object.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent, in which case 'key'
+        // is not converted to 'key_type'.
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     bsl::pair<iterator,iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this map having the specified
@@ -887,6 +957,26 @@ class map {
         // returned iterators will have the same value.  Note that since a map
         // maintains unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // 'lower_bound(key)', and the second is 'upper_bound(key)'.  This
+        // method participates in overload resolution only if 'COMPARATOR' is
+        // transparent, in which case 'key' is not converted to 'key_type'.
+        // Note that, unlike for a 'key_type' argument, the range may contain
+        // more than one element, since a transparent comparator may consider
+        // several keys of this map equivalent to 'key'.
+    {
+        return bsl::pair<iterator, iterator>(lower_bound(key),
+                                             upper_bound(key));
+    }
+
     // ACCESSORS
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
@@ -970,11 +1060,50 @@ class map {
         // 'value_type' object in this map having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent (see
+        // 'bslmf::IsTransparentPredicate'), in which case 'key' is compared
+        // with the keys of this map without being converted to 'key_type'.
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this map having the
         // specified 'key'.  Note that since a map maintains unique keys,
         // the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map whose
+        // keys are equivalent to the specified 'key'.  This method
+        // participates in overload resolution only if 'COMPARATOR' is
+        // transparent, in which case 'key' is not converted to 'key_type'.
+    {
+        size_type            result = 0;
+        const const_iterator last   = upper_bound(key);
+        for (const_iterator it = lower_bound(key); it != last; ++it) {
+            ++result;
+        }
+        return result;
+    }
+
     const_iterator lower_bound(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // (i.e., ordered least) 'value_type' object in this map whose key is
@@ -985,6 +1114,25 @@ class map {
         // having 'key' could be inserted into the ordered sequence maintained
         // by this map, while preserving its ordering.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // not ordered before the specified 'key', and the past-the-end
+        // iterator if there is no such object.  This method participates in
+        // overload resolution only if 'COMPARATOR' is transparent, in which
+        // case 'key' is not converted to 'key_type'.
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     const_iterator upper_bound(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // (i.e., ordered least) 'value_type' object in this map whose key is
@@ -995,6 +1143,25 @@ class map {
         // inserted into the ordered sequence maintained by this map, while
         // preserving its ordering.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // ordered after the specified 'key', and the past-the-end iterator if
+        // there is no such object.  This method participates in overload
+        // resolution only if 'COMPARATOR' is transparent, in which case 'key'
+        // is not converted to 'key_type'.
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
     bsl::pair<const_iterator,const_iterator> equal_range(
                                                     const key_type& key) const;
         // Return a pair of iterators providing non-modifiable access to the
@@ -1008,6 +1175,24 @@ class map {
         // value.  Note that since a map maintains unique keys, the range will
         // contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // 'lower_bound(key)', and the second is 'upper_bound(key)'.  This
+        // method participates in overload resolution only if 'COMPARATOR' is
+        // transparent, in which case 'key' is not converted to 'key_type'.
+        // Note that the range may contain more than one element.
+    {
+        return bsl::pair<const_iterator, const_iterator>(lower_bound(key),
+                                                         upper_bound(key));
+    }
+
     // NOT IMPLEMENTED
         // The following methods are defined by the C++11 standard, but they
         // are not implemented as they require some level of C++11 compiler
@@ -1125,6 +1310,19 @@ void swap(map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
     // behavior is undefined is unless either this object was created with the
     // same allocator as 'other' or 'propagate_on_container_swap' is 'true'.
 
+// FREE FUNCTIONS
+template <class HASHALG,
+          class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR>
+void hashAppend(HASHALG&                                      hashAlg,
+                const map<KEY, VALUE, COMPARATOR, ALLOCATOR>& input);
+    // Pass the specified 'input' map to the specified 'hashAlg': its size
+    // (as a 'std::size_t'), followed by each of its elements in order.  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').
+
 
 // ===========================================================================
 //                      INLINE FUNCTION DEFINITIONS
@@ -1849,6 +2047,26 @@ void bsl::swap(bsl::map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
     a.swap(b);
 }
 
+// FREE FUNCTIONS
+template <class HASHALG,
+          class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void bsl::hashAppend(HASHALG&                                      hashAlg,
+                     const map<KEY, VALUE, COMPARATOR, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    typedef typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+                                                                          ci_t;
+
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
+    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
+        hashAppend(hashAlg, *b);
+    }
+}
+
 // ============================================================================
 //                                TYPE TRAITS
 // ============================================================================
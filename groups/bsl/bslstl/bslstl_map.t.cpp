@@ -1,10 +1,14 @@
 // bslstl_map.t.cpp                                                   -*-C++-*-
 #include <bslstl_map.h>
 
-#include <bslstl_vector.h>  // for testing only
+#include <bslstl_string.h>     // for testing only
+#include <bslstl_stringref.h>  // for testing only
+#include <bslstl_vector.h>     // for testing only
 
 #include <bslalg_rangecompare.h>
 
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
@@ -152,6 +156,15 @@ using namespace bsl;
 // [13] const_iterator upper_bound(const key_type& key) const;
 // [13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [29] iterator find(const LOOKUP_KEY& key);
+// [29] const_iterator find(const LOOKUP_KEY& key) const;
+// [29] size_type count(const LOOKUP_KEY& key) const;
+// [29] iterator lower_bound(const LOOKUP_KEY& key);
+// [29] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [29] iterator upper_bound(const LOOKUP_KEY& key);
+// [29] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [29] pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [29] pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
 //
 // [ 6] bool operator==(const map<K, C, A>& lhs, const map<K, C, A>& rhs);
 // [19] bool operator< (const map<K, C, A>& lhs, const map<K, C, A>& rhs);
@@ -162,6 +175,7 @@ using namespace bsl;
 //
 //// specialized algorithms:
 // [ 8] void swap(map<K, V, C, A>& a, map<K, V, C, A>& b);
+// [28] void hashAppend(HASHALG& hashAlg, const map<K,V,C,A>& input);
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -6555,6 +6569,30 @@ TradeMatcher::BuyOrdersConstIterator TradeMatcher::endBuyOrders() const
 
 }  // close namespace UsageExample
 
+namespace {
+
+                       // ============================
+                       // struct TransparentStringLess
+                       // ============================
+
+struct TransparentStringLess {
+    // This transparent comparator orders 'bsl::string', 'bslstl::StringRef',
+    // and null-terminated strings (in any combination) lexicographically,
+    // without creating a 'bsl::string' from its arguments.
+
+    typedef void is_transparent;
+
+    template <class LHS_TYPE, class RHS_TYPE>
+    bool operator()(const LHS_TYPE& lhs, const RHS_TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is lexicographically ordered
+        // before the specified 'rhs', and 'false' otherwise.
+    {
+        return bslstl::StringRef(lhs) < bslstl::StringRef(rhs);
+    }
+};
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -6579,6 +6617,249 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If the comparator is transparent, the lookup methods accept an
+        //:   argument of any type that the comparator accepts, and return the
+        //:   same results as for an equal 'key_type' argument.
+        //:
+        //: 2 Such lookups allocate no memory, neither from the object
+        //:   allocator nor from the default allocator.
+        //:
+        //: 3 If the comparator is not transparent, the argument is converted
+        //:   to 'key_type', as before.
+        //
+        // Plan:
+        //: 1 Create a map of 'bsl::string' keys, too long for the short
+        //:   string optimization, having a transparent comparator, and look
+        //:   up present and absent keys by 'bslstl::StringRef' and by
+        //:   null-terminated string, comparing the results with those of a
+        //:   lookup by 'bsl::string'.  (C-1)
+        //:
+        //: 2 Use test allocators to verify that no memory is allocated by the
+        //:   lookups in P-1.  (C-2)
+        //:
+        //: 3 Repeat a lookup by null-terminated string on a map having the
+        //:   default comparator, and verify that a temporary 'bsl::string' is
+        //:   created from the default allocator.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::map<bsl::string, int, TransparentStringLess> Obj;
+
+        static const char *const KEYS[] = {
+            "a key long enough not to fit in the short string buffer: 0",
+            "a key long enough not to fit in the short string buffer: 2",
+            "a key long enough not to fit in the short string buffer: 4",
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        static const char *const ABSENT[] = {
+            "a key",
+            "a key long enough not to fit in the short string buffer: 1",
+            "a key long enough not to fit in the short string buffer: 3",
+            "a key long enough not to fit in the short string buffer: 5",
+        };
+        const int NUM_ABSENT = static_cast<int>(sizeof ABSENT /
+                                                sizeof *ABSENT);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX[bsl::string(KEYS[i], &oa)] = i;
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        const bsls::Types::Int64 DA_TOTAL = da.numBlocksTotal();
+        const bsls::Types::Int64 OA_TOTAL = oa.numBlocksTotal();
+
+        if (verbose) printf("\tLooking up present keys.\n");
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const char              *CSTR = KEYS[i];
+            const bslstl::StringRef  REF(CSTR);
+
+            if (veryVerbose) { T_ P(CSTR) }
+
+            Obj::iterator       it  = mX.find(REF);
+            Obj::const_iterator cit = X.find(CSTR);
+
+            ASSERTV(i, X.end() != it);
+            ASSERTV(i, it      == cit);
+
+            Obj::iterator NEXT = it;
+            ++NEXT;
+            ASSERTV(i, i       == it->second);
+            ASSERTV(i, REF     == it->first);
+
+            ASSERTV(i, 1 == X.count(REF));
+            ASSERTV(i, 1 == X.count(CSTR));
+
+            ASSERTV(i, it   == mX.lower_bound(REF));
+            ASSERTV(i, it   == X.lower_bound(CSTR));
+            ASSERTV(i, NEXT == mX.upper_bound(REF));
+            ASSERTV(i, NEXT == X.upper_bound(CSTR));
+
+            bsl::pair<Obj::iterator, Obj::iterator> R = mX.equal_range(REF);
+            ASSERTV(i, it   == R.first);
+            ASSERTV(i, NEXT == R.second);
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                           X.equal_range(CSTR);
+            ASSERTV(i, it   == CR.first);
+            ASSERTV(i, NEXT == CR.second);
+        }
+
+        if (verbose) printf("\tLooking up absent keys.\n");
+
+        for (int i = 0; i < NUM_ABSENT; ++i) {
+            const char              *CSTR = ABSENT[i];
+            const bslstl::StringRef  REF(CSTR);
+
+            if (veryVerbose) { T_ P(CSTR) }
+
+            const bsl::string   KEY(CSTR, &sa);
+            Obj::const_iterator EXP = X.lower_bound(KEY);
+
+            ASSERTV(i, X.end() == mX.find(REF));
+            ASSERTV(i, X.end() == X.find(CSTR));
+            ASSERTV(i, 0       == X.count(REF));
+
+            ASSERTV(i, EXP == mX.lower_bound(REF));
+            ASSERTV(i, EXP == X.upper_bound(CSTR));
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                            X.equal_range(REF);
+            ASSERTV(i, EXP == CR.first);
+            ASSERTV(i, EXP == CR.second);
+        }
+
+        ASSERTV(da.numBlocksTotal(), DA_TOTAL == da.numBlocksTotal());
+        ASSERTV(oa.numBlocksTotal(), OA_TOTAL == oa.numBlocksTotal());
+
+        if (verbose) printf("\tLooking up with an opaque comparator.\n");
+        {
+            bsl::map<bsl::string, int> mY(&oa);
+            mY[bsl::string(KEYS[0], &oa)] = 0;
+
+            const bsls::Types::Int64 DA_BEFORE = da.numBlocksTotal();
+
+            ASSERT(mY.end() != mY.find(KEYS[0]));
+            ASSERTV(da.numBlocksTotal(), DA_BEFORE < da.numBlocksTotal());
+        }
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the map (as a 'size_t'), and
+        //:   then each of its elements, in order, to the hashing algorithm.
+        //:
+        //: 2 Maps having the same value have the same hash value, and
+        //:   maps having different values have distinct hash values.
+        //:
+        //: 3 The hash value of a map does not depend on the order in which
+        //:   its elements were inserted.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create maps of various
+        //:   lengths, inserting the elements of each in reverse order, and
+        //:   compare the value computed by 'bslh::Hash' with that of a
+        //:   'bslh::DefaultHashAlgorithm' to which the size and elements (in
+        //:   order) were supplied explicitly.  (C-1, 3)
+        //:
+        //: 2 Compare the hash values of each pair of maps in the table.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const map<K,V,C,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        typedef bsl::map<int, int> ObjMap;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_length;     // number of elements
+            int d_keys[3];    // keys, in order
+            int d_values[3];  // mapped values
+        } DATA[] = {
+            //LINE  LEN  KEYS          VALUES
+            //----  ---  ------------  ------------
+            { L_,     0, { 0       }, { 0          } },
+            { L_,     1, { 1       }, { 10         } },
+            { L_,     1, { 1       }, { 20         } },
+            { L_,     1, { 2       }, { 10         } },
+            { L_,     2, { 1, 2    }, { 10, 20     } },
+            { L_,     2, { 1, 2    }, { 20, 10     } },
+            { L_,     2, { 1, 3    }, { 10, 20     } },
+            { L_,     3, { 1, 2, 3 }, { 10, 20, 30 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int  LENGTH = DATA[ti].d_length;
+            const int *KEYS   = DATA[ti].d_keys;
+            const int *VALUES = DATA[ti].d_values;
+
+            ObjMap mX(&oa);  const ObjMap& X = mX;
+            for (int i = LENGTH - 1; 0 <= i; --i) {
+                mX.insert(bsl::pair<const int, int>(KEYS[i], VALUES[i]));
+            }
+
+            bslh::DefaultHashAlgorithm expected;
+            const size_t               SIZE = LENGTH;
+            expected(&SIZE, sizeof SIZE);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected(&KEYS[i], sizeof KEYS[i]);
+                expected(&VALUES[i], sizeof VALUES[i]);
+            }
+            ASSERTV(LINE, expected.computeHash() == hasher(X));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int  LINE2   = DATA[tj].d_line;
+                const int  LENGTH2 = DATA[tj].d_length;
+                const int *KEYS2   = DATA[tj].d_keys;
+                const int *VALUES2 = DATA[tj].d_values;
+
+                ObjMap mY(&oa);  const ObjMap& Y = mY;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mY.insert(bsl::pair<const int, int>(KEYS2[i], VALUES2[i]));
+                }
+
+                ASSERTV(LINE, LINE2, (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+        }
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
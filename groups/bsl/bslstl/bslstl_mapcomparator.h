@@ -22,6 +22,11 @@ BSLS_IDENT("$Id: $")
 // 'bslalg::RbTreeUtil', primarily for the purpose of implementing a 'map'
 // container using the utilities defined in 'bslalg::RbTreeUtil'.
 //
+// 'MapComparator' also provides function-call operator templates comparing a
+// node with an object of any type that 'COMPARATOR' accepts, so that a 'map'
+// having a transparent comparator (see 'bslmf_istransparentpredicate') can
+// look up keys without converting them to 'KEY'.
+//
 ///Usage
 ///-----
 ///Example 1: Create a Simple Tree of 'TreeNode' Objects
@@ -208,6 +213,28 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs);
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) 'value().first' of
+        // the specified 'rhs' after being cast to 'NodeType', and 'false'
+        // otherwise.  The behavior is undefined unless 'rhs' can be safely
+        // cast to 'NodeType'.  Note that this method is selected only for
+        // 'lhs' arguments of a type other than 'KEY', which the comparator
+        // must accept without conversion to 'KEY' to be useful; see
+        // 'bslmf::IsTransparentPredicate'.
+
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs);
+        // Return 'true' if 'value().first()' of the specified 'lhs' after
+        // being cast to 'NodeType' is less than (ordered before, according to
+        // the comparator held by this object) the specified 'rhs', and 'false'
+        // otherwise.  The behavior is undefined unless 'lhs' can be safely
+        // cast to 'NodeType'.  Note that this method is selected only for
+        // 'rhs' arguments of a type other than 'KEY'.
+
     void swap(MapComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -230,6 +257,26 @@ class MapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) 'value().first' of
+        // the specified 'rhs' after being cast to 'NodeType', and 'false'
+        // otherwise.  The behavior is undefined unless 'rhs' can be safely
+        // cast to 'NodeType'.  Note that this method is selected only for
+        // 'lhs' arguments of a type other than 'KEY'.
+
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs) const;
+        // Return 'true' if 'value().first()' of the specified 'lhs' after
+        // being cast to 'NodeType' is less than (ordered before, according to
+        // the comparator held by this object) the specified 'rhs', and 'false'
+        // otherwise.  The behavior is undefined unless 'lhs' can be safely
+        // cast to 'NodeType'.  Note that this method is selected only for
+        // 'rhs' arguments of a type other than 'KEY'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -326,6 +373,50 @@ bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
                            rhs);
 }
 
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                 const LOOKUP_KEY&         lhs,
+                                                 const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(lhs,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                           const LOOKUP_KEY&         lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(lhs,
+                           static_cast<const NodeType&>(rhs).value().first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                 const bslalg::RbTreeNode& lhs,
+                                                 const LOOKUP_KEY&         rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool MapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const LOOKUP_KEY&         rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value().first,
+                           rhs);
+}
+
 template <class KEY, class VALUE, class COMPARATOR>
 inline
 COMPARATOR&
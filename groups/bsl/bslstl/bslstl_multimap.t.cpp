@@ -3,6 +3,8 @@
 
 #include <bslalg_rangecompare.h>
 
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
@@ -154,6 +156,7 @@ using namespace bsl;
 //
 //// specialized algorithms:
 // [ 8] void swap(multimap<K, V, C, A>& a, multimap<K, V, C, A>& b);
+// [27] void hashAppend(HASHALG& hashAlg, const multimap<K,V,C,A>& input);
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -6514,6 +6517,100 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the multimap (as a 'size_t'),
+        //:   and then each of its elements, in order, to the hashing
+        //:   algorithm.
+        //:
+        //: 2 Multimaps having the same value have the same hash value, and
+        //:   multimaps having different values have distinct hash values.
+        //:
+        //: 3 Multimaps differing only in the order of the mapped values of
+        //:   elements having equivalent keys have distinct hash values.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create multimaps of various
+        //:   lengths, including multimaps having equivalent keys, and compare
+        //:   the value computed by 'bslh::Hash' with that of a
+        //:   'bslh::DefaultHashAlgorithm' to which the size and elements (in
+        //:   order) were supplied explicitly.  (C-1)
+        //:
+        //: 2 Compare the hash values of each pair of multimaps in the table.
+        //:   (C-2, 3)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const multimap<K,V,C,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        typedef bsl::multimap<int, int> ObjMultimap;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_length;     // number of elements
+            int d_keys[3];    // keys, in order
+            int d_values[3];  // mapped values
+        } DATA[] = {
+            //LINE  LEN  KEYS          VALUES
+            //----  ---  ------------  ------------
+            { L_,     0, { 0       }, { 0          } },
+            { L_,     1, { 1       }, { 10         } },
+            { L_,     1, { 1       }, { 20         } },
+            { L_,     1, { 2       }, { 10         } },
+            { L_,     2, { 1, 2    }, { 10, 20     } },
+            { L_,     2, { 1, 2    }, { 20, 10     } },
+            { L_,     2, { 1, 3    }, { 10, 20     } },
+            { L_,     3, { 1, 2, 3 }, { 10, 20, 30 } },
+            { L_,     2, { 1, 1    }, { 10, 20     } },
+            { L_,     3, { 1, 1, 1 }, { 10, 20, 30 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int  LENGTH = DATA[ti].d_length;
+            const int *KEYS   = DATA[ti].d_keys;
+            const int *VALUES = DATA[ti].d_values;
+
+            ObjMultimap mX(&oa);  const ObjMultimap& X = mX;
+            for (int i = 0; i < LENGTH; ++i) {
+                mX.insert(bsl::pair<const int, int>(KEYS[i], VALUES[i]));
+            }
+
+            bslh::DefaultHashAlgorithm expected;
+            const size_t               SIZE = LENGTH;
+            expected(&SIZE, sizeof SIZE);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected(&KEYS[i], sizeof KEYS[i]);
+                expected(&VALUES[i], sizeof VALUES[i]);
+            }
+            ASSERTV(LINE, expected.computeHash() == hasher(X));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int  LINE2   = DATA[tj].d_line;
+                const int  LENGTH2 = DATA[tj].d_length;
+                const int *KEYS2   = DATA[tj].d_keys;
+                const int *VALUES2 = DATA[tj].d_values;
+
+                ObjMultimap mY(&oa);  const ObjMultimap& Y = mY;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mY.insert(bsl::pair<const int, int>(KEYS2[i], VALUES2[i]));
+                }
+
+                ASSERTV(LINE, LINE2, (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -250,6 +250,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -635,6 +639,13 @@ void swap(pair<T1, T2>& a, pair<T1, T2>& b);
     // each of the 'first' and 'second' pair fields.  Note that this method is
     // no-throw only if 'swap' on each field is no-throw.
 
+template <class HASHALG, class T1, class T2>
+void hashAppend(HASHALG& hashAlg, const pair<T1, T2>& input);
+    // Pass the specified 'input' to the specified 'hashAlg' by passing its
+    // 'first' and then its 'second' member to 'hashAppend'.  This function
+    // is found by argument-dependent lookup, and is used by 'bslh::Hash' (see
+    // 'bslh_hash').
+
 }  // close namespace bsl
 
 // ===========================================================================
@@ -979,6 +990,15 @@ void swap(pair<T1, T2>& a, pair<T1, T2>& b)
     a.swap(b);
 }
 
+template <class HASHALG, class T1, class T2>
+inline
+void hashAppend(HASHALG& hashAlg, const pair<T1, T2>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAppend(hashAlg, input.first);
+    hashAppend(hashAlg, input.second);
+}
+
 }  // close namespace bsl
 
 // ===========================================================================
@@ -2,6 +2,8 @@
 
 #include <bslstl_pair.h>
 
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isbitwiseequalitycomparable.h>
@@ -68,6 +70,7 @@ using namespace BloombergLP;
 // [5] void pair::swap(pair& rhs);
 // [5] void swap(pair& lhs, pair& rhs);
 // [7] Pointer to member test
+// [8] void hashAppend(HASHALG& hashAlg, const pair<T1, T2>& input);
 //-----------------------------------------------------------------------------
 // [1] BREATHING TEST
 // [6] USAGE EXAMPLE
@@ -611,6 +614,56 @@ int main(int argc, char *argv[])
     std::printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies 'first', and then 'second', to the hashing
+        //:   algorithm, each by way of its own 'hashAppend'.
+        //:
+        //: 2 Pairs having the same value have the same hash value, and pairs
+        //:   having different values (including pairs whose members are
+        //:   exchanged) have distinct hash values.
+        //
+        // Plan:
+        //: 1 Compare the value computed by 'bslh::Hash' for a pair of 'int'
+        //:   and 'double' with that of a 'bslh::DefaultHashAlgorithm' to which
+        //:   'first' and 'second' were supplied explicitly.  (C-1)
+        //:
+        //: 2 Verify that pairs holding '0.0' and '-0.0', which are equal,
+        //:   have the same hash value.  (C-1, 2)
+        //:
+        //: 3 Compare the hash values of several distinct pairs.  (C-2)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const pair<T1, T2>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) std::printf("\nTESTING 'hashAppend'"
+                                 "\n====================\n");
+
+        typedef bsl::pair<int, double> Obj;
+
+        const bslh::Hash<> hasher;
+
+        const Obj X(1, 2.0);
+
+        const int    FIRST  = 1;
+        const double SECOND = 2.0;
+
+        bslh::DefaultHashAlgorithm expected;
+        expected(&FIRST,  sizeof FIRST);
+        expected(&SECOND, sizeof SECOND);
+        ASSERT(expected.computeHash() == hasher(X));
+
+        ASSERT(hasher(Obj(1, 0.0)) == hasher(Obj(1, -0.0)));
+
+        ASSERT(hasher(X) == hasher(Obj(1, 2.0)));
+        ASSERT(hasher(X) != hasher(Obj(2, 1.0)));
+        ASSERT(hasher(X) != hasher(Obj(1, 3.0)));
+        ASSERT(hasher(X) != hasher(Obj(0, 2.0)));
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // Pointer to member
@@ -12,8 +12,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   bslstl::priority_queue: template of highest-priority-first data structure
+//   bslstl::PriorityQueueHeapArity: arity of the heap of a 'priority_queue'
 //
-//@SEE_ALSO: bslstl_queue, bslstl_stack
+//@SEE_ALSO: bslstl_queue, bslstl_stack, bslalg_daryheaputil, bslstl_radixheap
 //
 //@DESCRIPTION: This component defines a class template, 'bsl::priority_queue',
 // holding a container (of a parameterized type 'CONTAINER' containing elements
@@ -67,6 +68,40 @@ BSLS_IDENT("$Id: $")
 //  | const_reference top() const;         | c.front();                |
 //  +--------------------------------------+---------------------------+
 //
+///Heap Arity
+///----------
+// The elements of the held container are arranged as a heap (see
+// 'bslalg_daryheaputil') in which each element has up to four children,
+// rather than the two children of the heap maintained by 'std::push_heap' and
+// 'std::pop_heap'.  A 4-ary heap has half the depth of a binary heap, and the
+// children of an element are adjacent, so that 'pop' visits half as many
+// cache lines of a large queue as it would with a binary heap, while
+// performing a similar number of comparisons, and 'push' performs half as
+// many comparisons.
+//
+// The arity of the heap used for a particular 'VALUE' type is given by the
+// 'ARITY' enumerator of 'bslstl::PriorityQueueHeapArity<VALUE>', which may be
+// specialized.  For example, a value type whose comparison is so expensive
+// that the number of comparisons performed by 'pop' dominates its cost may
+// select a binary heap:
+//..
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct PriorityQueueHeapArity<MyExpensiveValue> {
+//      enum { ARITY = 2 };
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Note that a client deriving from 'priority_queue' must not apply the
+// standard heap algorithms to the protected 'c' member unless the arity is 2.
+// A queue of unsigned integer keys that are removed in non-decreasing order
+// (such as the expiry times of a timer queue) may instead use
+// 'bslstl::RadixHeap' (see 'bslstl_radixheap').
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -316,6 +351,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_vector.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_DARYHEAPUTIL
+#include <bslalg_daryheaputil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_SWAPUTIL
 #include <bslalg_swaputil.h>
 #endif
@@ -333,6 +372,22 @@ namespace BloombergLP {
 
 namespace bslstl {
 
+                       // =============================
+                       // struct PriorityQueueHeapArity
+                       // =============================
+
+template <class VALUE_TYPE>
+struct PriorityQueueHeapArity {
+    // This 'struct' template provides the number of children of each element
+    // of the heap maintained by a 'bsl::priority_queue' of elements of the
+    // (template parameter) 'VALUE_TYPE'.  Clients may specialize this
+    // template, for their own 'VALUE_TYPE', to select another arity of at
+    // least 2; an arity of 2 arranges the elements as the standard heap
+    // algorithms do.
+
+    enum { ARITY = 4 };  // number of children of each heap element
+};
+
 template <class CONTAINER, class ALLOCATOR>
 struct PriorityQueue_HasAllocatorType {
   private:
@@ -377,6 +432,14 @@ class priority_queue
     COMPARATOR comp;    // comparator that defines the priority order of
                         // elements in the 'priority_queue'
 
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::PriorityQueueHeapArity<
+                                     typename CONTAINER::value_type> HeapArity;
+
+    typedef BloombergLP::bslalg::DAryHeapUtil<HeapArity::ARITY>     HeapUtil;
+        // algorithms maintaining the heap order of 'c'
+
   public:
     // PUBLIC TYPES
     typedef typename CONTAINER::value_type      value_type;
@@ -549,7 +612,7 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 : c(container)
 , comp(comparator)
 {
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
 }
 
 template <class VALUE, class CONTAINER, class COMPARATOR>
@@ -574,7 +637,7 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
                                                        INPUT_ITERATOR    last)
 {
     c.insert(c.end(), first, last);
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
 }
 
 template <class VALUE, class CONTAINER, class COMPARATOR>
@@ -589,7 +652,7 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 , comp(comparator)
 {
     c.insert(c.end(), first, last);
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
 }
 
 template <class VALUE, class CONTAINER, class COMPARATOR>
@@ -644,7 +707,7 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 : c(container, allocator)
 , comp(comparator)
 {
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HeapUtil::makeHeap(c.begin(), c.end(), comp);
 }
 
 
@@ -671,14 +734,14 @@ void priority_queue<VALUE, CONTAINER, COMPARATOR>::push(
                                                        const value_type& value)
 {
     c.push_back(value);
-    native_std::push_heap(c.begin(), c.end(), comp);
+    HeapUtil::pushHeap(c.begin(), c.end(), comp);
 }
 
 template <class VALUE, class CONTAINER, class COMPARATOR>
 inline
 void priority_queue<VALUE, CONTAINER, COMPARATOR>::pop()
 {
-    native_std::pop_heap(c.begin(), c.end(), comp);
+    HeapUtil::popHeap(c.begin(), c.end(), comp);
     c.pop_back();
 }
 
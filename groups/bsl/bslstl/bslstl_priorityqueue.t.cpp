@@ -24,7 +24,11 @@
 #include <bsls_stopwatch.h>                // for testing only
 #include <bsls_util.h>
 
+#include <bslalg_daryheaputil.h>
+
 #include <algorithm>
+#include <queue>
+#include <vector>
 
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -111,6 +115,8 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [14] TESTING NON ALLOCATOR SUPPORTING TYPE
 // [15] USAGE EXAMPLE
+// [16] CONCERN: The heap arity is selected by 'PriorityQueueHeapArity'.
+// [-1] PERFORMANCE: COMPARISON WITH A BINARY HEAP
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] ggg(queue<V,C> *object, const char *spec, int verbose = 1);
@@ -3047,6 +3053,109 @@ void taskFunction2(int taskId, int priority, int verbose)
 
 }  // close namespace UsageExample
 
+// ============================================================================
+//                       HEAP ARITY AND BENCHMARK HELPERS
+// ----------------------------------------------------------------------------
+
+struct BinaryHeapValue {
+    // This 'struct' is a value type for which 'bsl::priority_queue' is
+    // configured (below) to maintain a binary heap.
+
+    int d_value;
+};
+
+bool operator<(const BinaryHeapValue& lhs, const BinaryHeapValue& rhs)
+    // Return 'true' if the specified 'lhs' has a lesser value than the
+    // specified 'rhs', and 'false' otherwise.
+{
+    return lhs.d_value < rhs.d_value;
+}
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct PriorityQueueHeapArity<BinaryHeapValue> {
+    enum { ARITY = 2 };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class VALUE>
+class HeapInspector : public priority_queue<VALUE> {
+    // This class template exposes the container held by a 'priority_queue' of
+    // the (template parameter) 'VALUE' type, so that the arrangement of its
+    // elements can be verified.
+
+  public:
+    const vector<VALUE>& container() const
+        // Return a reference providing non-modifiable access to the container
+        // held by this object.
+    {
+        return this->c;
+    }
+};
+
+unsigned int nextBenchmarkKey(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value in the
+    // range '[1, 65536]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return ((*seed >> 8) & 0xFFFF) + 1;
+}
+
+template <class QUEUE>
+void benchmarkQueue(const char *name, int size, int numRounds)
+    // Print, for the priority queue type 'QUEUE', ordering 'unsigned int'
+    // values from least to greatest and identified by the specified 'name',
+    // the average time per operation taken, on a queue holding the specified
+    // 'size' pseudo-random keys, to pop the least key and push a greater one
+    // (as a timer queue does), and then to pop every key, repeating each
+    // measurement the specified 'numRounds' times.
+{
+    double holdTime = 0, popTime = 0;
+    bsls::Types::Int64 checksum = 0;
+
+    for (int round = 0; round < numRounds; ++round) {
+        QUEUE mX;
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < size; ++i) {
+            mX.push(nextBenchmarkKey(&seed));
+        }
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            const unsigned int key = mX.top();
+            mX.pop();
+            mX.push(key + nextBenchmarkKey(&seed));
+        }
+        timer.stop();
+        holdTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        while (!mX.empty()) {
+            checksum += mX.top();
+            mX.pop();
+        }
+        timer.stop();
+        popTime += timer.elapsedTime();
+    }
+
+    const double NUM_OPS = static_cast<double>(size) * numRounds;
+
+    printf("%-24s %10d %9.1f %9.1f   (%lld)\n",
+           name,
+           size,
+           holdTime * 1e9 / NUM_OPS,
+           popTime  * 1e9 / NUM_OPS,
+           checksum);
+}
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -3072,6 +3181,101 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta(veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // CONCERN: THE HEAP ARITY IS SELECTED BY 'PriorityQueueHeapArity'
+        //
+        // Concerns:
+        //: 1 By default, the held container is arranged as a 4-ary heap.
+        //:
+        //: 2 A specialization of 'bslstl::PriorityQueueHeapArity' selects the
+        //:   arity for its value type; an arity of 2 arranges the container
+        //:   as the standard heap algorithms do.
+        //:
+        //: 3 Elements are removed in priority order for either arity.
+        //
+        // Plan:
+        //: 1 Push pseudo-random values into queues of 'int' and of a value
+        //:   type specialized to use a binary heap, and verify after each
+        //:   push and pop that the held container is a heap of the expected
+        //:   arity.  (C-1..2)
+        //:
+        //: 2 Verify that the container of the binary queue can be drained by
+        //:   'std::pop_heap'.  (C-2)
+        //:
+        //: 3 Verify that 'top' is non-increasing as the queues are drained.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: The heap arity is selected by 'PriorityQueueHeapArity'.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING HEAP ARITY"
+                            "\n==================\n");
+
+        typedef bslalg::DAryHeapUtil<2> BinaryUtil;
+        typedef bslalg::DAryHeapUtil<4> QuaternaryUtil;
+
+        ASSERT(4 == bslstl::PriorityQueueHeapArity<int>::ARITY);
+        ASSERT(2 == bslstl::PriorityQueueHeapArity<BinaryHeapValue>::ARITY);
+
+        const int NUM_VALUES = 500;
+
+        HeapInspector<int>             mX;
+        const HeapInspector<int>&      X = mX;
+        HeapInspector<BinaryHeapValue> mY;
+        const HeapInspector<BinaryHeapValue>& Y = mY;
+
+        std::less<int>             intLess;
+        std::less<BinaryHeapValue> valueLess;
+
+        bool isBinaryHeap = true;
+        unsigned int seed = 7;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const int            VALUE = nextBenchmarkKey(&seed) % 1000;
+            const BinaryHeapValue BV   = { VALUE };
+
+            mX.push(VALUE);
+            mY.push(BV);
+
+            const vector<int>& XC = X.container();
+            ASSERTV(i, QuaternaryUtil::isHeap(XC.begin(), XC.end(), intLess));
+            isBinaryHeap = isBinaryHeap
+                        && BinaryUtil::isHeap(XC.begin(), XC.end(), intLess);
+
+            const vector<BinaryHeapValue>& YC = Y.container();
+            ASSERTV(i, BinaryUtil::isHeap(YC.begin(), YC.end(), valueLess));
+        }
+        ASSERT(!isBinaryHeap);
+
+        vector<BinaryHeapValue> binary(Y.container());
+        for (int end = NUM_VALUES; 1 < end; --end) {
+            std::pop_heap(binary.begin(), binary.begin() + end, valueLess);
+            ASSERTV(end,
+                    !(binary[end - 1].d_value < binary[end - 2].d_value));
+        }
+
+        int previousX = X.top();
+        int previousY = Y.top().d_value;
+        ASSERT(previousX == previousY);
+        while (!X.empty()) {
+            ASSERT(X.top() <= previousX);
+            ASSERT(Y.top().d_value <= previousY);
+            ASSERT(X.top() == Y.top().d_value);
+            previousX = X.top();
+            previousY = Y.top().d_value;
+
+            mX.pop();
+            mY.pop();
+
+            const vector<int>& XC = X.container();
+            ASSERT(QuaternaryUtil::isHeap(XC.begin(), XC.end(), intLess));
+
+            const vector<BinaryHeapValue>& YC = Y.container();
+            ASSERT(BinaryUtil::isHeap(YC.begin(), YC.end(), valueLess));
+        }
+        ASSERT(Y.empty());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -3292,6 +3496,57 @@ int main(int argc, char *argv[])
                                                        SPECIAL_INT_VALUES,
                                                        NUM_SPECIAL_INT_VALUES);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH A BINARY HEAP
+        //
+        // Concerns:
+        //: 1 Compare the speed of 'bsl::priority_queue', which maintains a
+        //:   4-ary heap, with that of the binary heap of 'std::priority_queue'
+        //:   for queues from 1,000 elements up to a size that may be
+        //:   specified on the command line.
+        //
+        // Plan:
+        //: 1 For sizes increasing by factors of 10 from 1,000 to the maximum
+        //:   size given as the second argument (10,000,000 by default), time
+        //:   popping the least element and pushing a greater one (the steady
+        //:   state of a timer queue) once per element, and then popping every
+        //:   element, repeating the measurements for small sizes so that each
+        //:   size performs approximately the same number of operations.  Print
+        //:   the average time per operation in nanoseconds.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH A BINARY HEAP
+        // --------------------------------------------------------------------
+
+        const int MAX_SIZE = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        printf("\nPERFORMANCE: COMPARISON WITH A BINARY HEAP"
+               "\n==========================================\n");
+
+        typedef std::greater<unsigned int> Greater;
+
+        typedef bsl::priority_queue<unsigned int,
+                                    bsl::vector<unsigned int>,
+                                    Greater> BslQueue;
+        typedef native_std::priority_queue<unsigned int,
+                                           native_std::vector<unsigned int>,
+                                           Greater> StdQueue;
+
+        printf("%-24s %10s %9s %9s   (ns/op)\n",
+               "queue", "size", "pop+push", "pop");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            const int NUM_ROUNDS = size < 1000000 ? 1000000 / size : 1;
+
+            benchmarkQueue<BslQueue>("bsl (4-ary heap)", size, NUM_ROUNDS);
+            benchmarkQueue<StdQueue>("std (binary heap)", size, NUM_ROUNDS);
+
+            if (MAX_SIZE / 10 < size) {
+                break;
+            }
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
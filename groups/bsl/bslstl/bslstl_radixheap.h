@@ -0,0 +1,591 @@
+// bslstl_radixheap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RADIXHEAP
+#define INCLUDED_BSLSTL_RADIXHEAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a monotone priority queue for unsigned integral keys.
+//
+//@CLASSES:
+//  bslstl::RadixHeap: monotone min-priority queue of key-value pairs
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslalg_daryheaputil
+//
+//@DESCRIPTION: This component defines a class template, 'bslstl::RadixHeap',
+// holding pairs of a key of an unsigned integral type, 'KEY', and a value of
+// an arbitrary type, 'VALUE', from which a pair having the least key is
+// removed first.  A 'RadixHeap' is *monotone*: no key less than the key of the
+// most recently accessed (or removed) least pair may be added.  Many priority
+// queues are used this way: a timer queue is ordered by expiry times, and a
+// timer set while processing an expired timer does not expire before it;
+// similarly, Dijkstra's shortest-path algorithm, and event-driven simulations,
+// only ever add items having a priority no less than that of the item being
+// processed.  For such uses, 'RadixHeap' provides the operations of a priority
+// queue at a lower cost than a comparison-based heap such as
+// 'bsl::priority_queue'.
+//
+///Implementation
+///--------------
+// A 'RadixHeap' keeps a lower bound, 'L', on the keys it holds, and holds its
+// pairs in one unordered bucket per bit of 'KEY', plus one: a pair having the
+// key 'K' is held in bucket 0 if 'K == L', and otherwise in the bucket whose
+// index is the position (counting from 1) of the most significant bit in which
+// 'K' differs from 'L'.  Adding a pair therefore appends it to a bucket,
+// computing the bucket index with a single "count leading zeros" instruction
+// on most platforms, and never compares it with another pair.
+//
+// When the least pair is requested and bucket 0 is empty, the first non-empty
+// bucket is scanned for its least key, which becomes the new lower bound, and
+// each of its pairs is moved to a lower bucket.  Since every key held in
+// bucket 'i' agrees with the new lower bound in all bits above bit 'i', each
+// pair is moved down at most once per bit of 'KEY' over its lifetime, and the
+// cost of redistribution amortized over each pair is 'O[log(U)]', where 'U' is
+// the range of the keys held, rather than 'O[log(N)]', where 'N' is the number
+// of pairs held, with a small constant factor.  Accesses to each bucket are
+// sequential, and buckets retain their capacity when emptied, so that a heap
+// in a steady state performs no memory allocation.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Timer Queue
+/// - - - - - - - - - - - -
+// Suppose we are implementing the timer queue of an event loop.  Timers are
+// registered with an absolute expiry time, measured in ticks of a monotonic
+// clock, and a timer callback may register further timers, which expire no
+// earlier than the current time.
+//
+// First, we define the type of the clock ticks and a simple identifier for
+// the timers:
+//..
+//  typedef bsls::Types::Uint64 Tick;
+//  typedef int                 TimerId;
+//..
+// Then, we create a radix heap of timers, keyed by their expiry time, and
+// register three timers:
+//..
+//  bslstl::RadixHeap<Tick, TimerId> timers;
+//
+//  timers.push(1500, 1);
+//  timers.push(1000, 2);
+//  timers.push(2500, 3);
+//  assert(3 == timers.size());
+//..
+// Next, suppose the clock reads 2000 ticks.  We dispatch each timer whose
+// expiry time has been reached; the callback of timer 2 registers timer 4, to
+// expire 300 ticks later:
+//..
+//  const Tick now = 2000;
+//
+//  assert(2    == timers.top().second);
+//  assert(1000 == timers.top().first);
+//  timers.pop();
+//  timers.push(now + 300, 4);
+//
+//  assert(1    == timers.top().second);
+//  timers.pop();
+//..
+// Then, the callback of timer 1 registers timer 5, to expire immediately.
+// The expiry time of timer 5 is earlier than that of any timer in the heap,
+// but is no less than 'keyLowerBound()', the expiry time of the timer most
+// recently dispatched, and so may be added:
+//..
+//  assert(1500 == timers.keyLowerBound());
+//  timers.push(now, 5);
+//
+//  assert(5    == timers.top().second);
+//  timers.pop();
+//..
+// Finally, we observe that the next timer, timer 4, has not yet expired:
+//..
+//  assert(4    == timers.top().second);
+//  assert(now  <  timers.top().first);
+//  assert(2    == timers.size());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISINTEGRAL
+#include <bslmf_isintegral.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                           // =====================
+                           // struct RadixHeap_Util
+                           // =====================
+
+struct RadixHeap_Util {
+    // This component-private 'struct' provides a namespace for the bit
+    // operations underlying 'RadixHeap'.
+
+    // CLASS METHODS
+    static int numSignificantBits(bsls::Types::Uint64 value);
+        // Return the number of bits of the specified 'value' up to and
+        // including its most significant set bit, or 0 if 'value' is 0.
+
+    static int numSignificantBitsPortable(bsls::Types::Uint64 value);
+        // Return the number of bits of the specified 'value' up to and
+        // including its most significant set bit, or 0 if 'value' is 0,
+        // without using compiler intrinsics.  Note that 'numSignificantBits'
+        // uses this function on platforms lacking a suitable intrinsic.
+};
+
+                              // ===============
+                              // class RadixHeap
+                              // ===============
+
+template <class KEY,
+          class VALUE,
+          class ALLOCATOR = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class RadixHeap {
+    // This class template implements a monotone min-priority queue of pairs of
+    // a key of the (template parameter) unsigned integral type 'KEY' and a
+    // value of the (template parameter) type 'VALUE', using memory supplied by
+    // an allocator of the (template parameter) type 'ALLOCATOR'.  A key may be
+    // added only if it is no less than 'keyLowerBound()', which is the key of
+    // the pair most recently returned by 'top' or removed by 'pop' (or 0
+    // initially).  'VALUE' must be copy-constructible, and its copy
+    // constructor must not throw while pairs are redistributed among the
+    // buckets by 'top' or 'pop' (see {Implementation}).
+
+    BSLMF_ASSERT(bsl::is_integral<KEY>::value);
+    BSLMF_ASSERT(static_cast<KEY>(0) < static_cast<KEY>(-1));  // unsigned
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                    key_type;
+    typedef VALUE                                  mapped_type;
+    typedef bsl::pair<KEY, VALUE>                  value_type;
+    typedef ALLOCATOR                              allocator_type;
+    typedef typename bsl::allocator_traits<ALLOCATOR>::size_type
+                                                   size_type;
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_BUCKETS = sizeof(KEY) * 8 + 1  // one per bit of 'KEY', plus one
+                                             // for keys equal to the bound
+    };
+
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                 rebind_traits<value_type>::allocator_type
+                                                                ElementAlloc;
+
+    typedef bsl::vector<value_type, ElementAlloc>               Bucket;
+
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                 rebind_traits<Bucket>::allocator_type
+                                                                BucketAlloc;
+
+    // DATA
+    bsl::vector<Bucket, BucketAlloc> d_buckets;   // 'k_NUM_BUCKETS' buckets of
+                                                  // pairs, unordered within
+                                                  // each bucket
+
+    KEY                              d_bound;     // least key that may be
+                                                  // added; least key held in
+                                                  // bucket 0
+
+    size_type                        d_size;      // number of pairs held
+
+    // PRIVATE CLASS METHODS
+    static int bucketIndex(KEY key, KEY bound);
+        // Return the index of the bucket holding a pair having the specified
+        // 'key' when the lower bound of the keys held is the specified
+        // 'bound'.  The behavior is undefined unless 'bound <= key'.
+
+    // PRIVATE MANIPULATORS
+    void redistribute();
+        // Make the least key held the lower bound, and move each pair of the
+        // first non-empty bucket to the bucket appropriate for that bound, so
+        // that bucket 0 holds the pairs having the least key.  The behavior
+        // is undefined unless bucket 0 is empty and this heap is not empty.
+
+  public:
+    // CREATORS
+    explicit RadixHeap(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty radix heap whose lower bound on keys is 0.
+        // Optionally specify an 'allocator' used to supply memory.  If
+        // 'allocator' is not specified, a default-constructed allocator is
+        // used.  Note that, if 'ALLOCATOR' is 'bsl::allocator' (the default),
+        // a 'bslma::Allocator *' may be supplied, and the currently
+        // installed default allocator is used if it is not.
+
+    RadixHeap(const RadixHeap& original,
+              const ALLOCATOR& allocator = ALLOCATOR());
+        // Create a radix heap holding the same pairs, and having the same
+        // lower bound on keys, as the specified 'original' heap.  Optionally
+        // specify an 'allocator' used to supply memory.  If 'allocator' is
+        // not specified, a default-constructed allocator is used.
+
+    // ~RadixHeap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    RadixHeap& operator=(const RadixHeap& rhs);
+        // Assign to this object the pairs, and the lower bound on keys, of
+        // the specified 'rhs' heap, and return a reference providing
+        // modifiable access to this object.  This method provides the strong
+        // exception-safety guarantee.
+
+    void clear();
+        // Remove all pairs from this heap, retaining the memory of its
+        // buckets for reuse.  Note that the lower bound on keys is unchanged.
+
+    void pop();
+        // Remove from this heap a pair having the least key held, which is
+        // the pair that 'top' would return, and set the lower bound on keys
+        // that may subsequently be added to that key.  The behavior is
+        // undefined if this heap is empty.
+
+    void push(const KEY& key, const VALUE& value);
+        // Add to this heap a pair of the specified 'key' and 'value'.  If an
+        // exception is thrown, this heap is unchanged.  The behavior is
+        // undefined unless 'keyLowerBound() <= key'.
+
+    void swap(RadixHeap& other);
+        // Exchange the pairs and lower bound of this heap with those of the
+        // specified 'other' heap.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // heap and 'other' use the same allocator.
+
+    const value_type& top();
+        // Return a reference providing non-modifiable access to a pair having
+        // the least key held by this heap, and set the lower bound on keys
+        // that may subsequently be added to that key.  The behavior is
+        // undefined if this heap is empty.  Note that this method is not
+        // 'const' because it may redistribute the pairs among the buckets of
+        // this heap; a 'top' that finds bucket 0 non-empty takes constant
+        // time.
+
+    // ACCESSORS
+    bool empty() const;
+        // Return 'true' if this heap holds no pairs, and 'false' otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this heap to supply
+        // memory.
+
+    KEY keyLowerBound() const;
+        // Return the least key that may be added to this heap, which is the
+        // key of the pair most recently returned by 'top' or removed by
+        // 'pop', or else the lower bound of the heap from which this heap was
+        // copied or assigned, or else 0.
+
+    size_type size() const;
+        // Return the number of pairs held by this heap.
+};
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class ALLOCATOR>
+void swap(RadixHeap<KEY, VALUE, ALLOCATOR>& a,
+          RadixHeap<KEY, VALUE, ALLOCATOR>& b);
+    // Exchange the pairs and lower bounds of the specified 'a' and 'b' heaps.
+    // The behavior is undefined unless 'a' and 'b' use the same allocator.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // struct RadixHeap_Util
+                           // ---------------------
+
+// CLASS METHODS
+inline
+int RadixHeap_Util::numSignificantBits(bsls::Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return value ? 64 - __builtin_clzll(value) : 0;
+#else
+    return numSignificantBitsPortable(value);
+#endif
+}
+
+                              // ---------------
+                              // class RadixHeap
+                              // ---------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+int RadixHeap<KEY, VALUE, ALLOCATOR>::bucketIndex(KEY key, KEY bound)
+{
+    BSLS_ASSERT_SAFE(bound <= key);
+
+    const bsls::Types::Uint64 difference = key ^ bound;
+    return RadixHeap_Util::numSignificantBits(difference);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class ALLOCATOR>
+void RadixHeap<KEY, VALUE, ALLOCATOR>::redistribute()
+{
+    BSLS_ASSERT_SAFE(d_buckets[0].empty());
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    int index = 1;
+    while (d_buckets[index].empty()) {
+        ++index;
+    }
+    Bucket& source = d_buckets[index];
+
+    KEY bound = source.front().first;
+    for (typename Bucket::const_iterator it = source.begin();
+         it != source.end();
+         ++it) {
+        if (it->first < bound) {
+            bound = it->first;
+        }
+    }
+
+    // Reserve the capacity needed in each destination bucket before moving
+    // any pair, so that a failure to allocate leaves this heap unchanged.
+    // Capacity is at least doubled when it must grow, so that the number of
+    // allocations made by a bucket is logarithmic in its greatest size.
+
+    size_type counts[k_NUM_BUCKETS] = { 0 };
+    for (typename Bucket::const_iterator it = source.begin();
+         it != source.end();
+         ++it) {
+        ++counts[bucketIndex(it->first, bound)];
+    }
+    for (int i = 0; i < index; ++i) {
+        Bucket&         bucket   = d_buckets[i];
+        const size_type required = bucket.size() + counts[i];
+        if (bucket.capacity() < required) {
+            bucket.reserve(required < 2 * bucket.capacity()
+                           ? 2 * bucket.capacity()
+                           : required);
+        }
+    }
+
+    d_bound = bound;
+    for (typename Bucket::const_iterator it = source.begin();
+         it != source.end();
+         ++it) {
+        d_buckets[bucketIndex(it->first, bound)].push_back(*it);
+    }
+    source.clear();
+}
+
+// CREATORS
+template <class KEY, class VALUE, class ALLOCATOR>
+RadixHeap<KEY, VALUE, ALLOCATOR>::RadixHeap(const ALLOCATOR& allocator)
+: d_buckets(k_NUM_BUCKETS, Bucket(ElementAlloc(allocator)),
+            BucketAlloc(allocator))
+, d_bound(0)
+, d_size(0)
+{
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+RadixHeap<KEY, VALUE, ALLOCATOR>::RadixHeap(const RadixHeap& original,
+                                            const ALLOCATOR& allocator)
+: d_buckets(original.d_buckets, BucketAlloc(allocator))
+, d_bound(original.d_bound)
+, d_size(original.d_size)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class ALLOCATOR>
+RadixHeap<KEY, VALUE, ALLOCATOR>&
+RadixHeap<KEY, VALUE, ALLOCATOR>::operator=(const RadixHeap& rhs)
+{
+    if (this != &rhs) {
+        RadixHeap(rhs, get_allocator()).swap(*this);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+void RadixHeap<KEY, VALUE, ALLOCATOR>::clear()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].clear();
+    }
+    d_size = 0;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+void RadixHeap<KEY, VALUE, ALLOCATOR>::pop()
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    if (d_buckets[0].empty()) {
+        redistribute();
+    }
+    d_buckets[0].pop_back();
+    --d_size;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+void RadixHeap<KEY, VALUE, ALLOCATOR>::push(const KEY& key, const VALUE& value)
+{
+    BSLS_ASSERT_SAFE(d_bound <= key);
+
+    d_buckets[bucketIndex(key, d_bound)].push_back(value_type(key, value));
+    ++d_size;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+void RadixHeap<KEY, VALUE, ALLOCATOR>::swap(RadixHeap& other)
+{
+    BSLS_ASSERT_SAFE(get_allocator() == other.get_allocator());
+
+    d_buckets.swap(other.d_buckets);
+
+    const KEY bound = d_bound;
+    d_bound         = other.d_bound;
+    other.d_bound   = bound;
+
+    const size_type size = d_size;
+    d_size               = other.d_size;
+    other.d_size         = size;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+const typename RadixHeap<KEY, VALUE, ALLOCATOR>::value_type&
+RadixHeap<KEY, VALUE, ALLOCATOR>::top()
+{
+    BSLS_ASSERT_SAFE(0 < d_size);
+
+    if (d_buckets[0].empty()) {
+        redistribute();
+    }
+    return d_buckets[0].back();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+bool RadixHeap<KEY, VALUE, ALLOCATOR>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+typename RadixHeap<KEY, VALUE, ALLOCATOR>::allocator_type
+RadixHeap<KEY, VALUE, ALLOCATOR>::get_allocator() const
+{
+    return ALLOCATOR(d_buckets.get_allocator());
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+KEY RadixHeap<KEY, VALUE, ALLOCATOR>::keyLowerBound() const
+{
+    return d_bound;
+}
+
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+typename RadixHeap<KEY, VALUE, ALLOCATOR>::size_type
+RadixHeap<KEY, VALUE, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class ALLOCATOR>
+inline
+void bslstl::swap(RadixHeap<KEY, VALUE, ALLOCATOR>& a,
+                  RadixHeap<KEY, VALUE, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslma {
+
+template <class KEY, class VALUE, class ALLOCATOR>
+struct UsesBslmaAllocator<bslstl::RadixHeap<KEY, VALUE, ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,974 @@
+// bslstl_radixheap.t.cpp                                             -*-C++-*-
+#include <bslstl_radixheap.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_priorityqueue.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a monotone priority queue whose pairs are held
+// in buckets selected by the bits of their keys.  Its observable behavior is
+// that of a min-priority queue, so the tests drive it with pseudo-random
+// monotone sequences of operations, for each width of key, and compare each
+// pair it yields with a reference model (a 'std::multimap' from key to pair
+// identifier).  Memory use is verified with test allocators, including the
+// absence of allocation in a steady state and the exception safety of the
+// operations that allocate.  A benchmark comparing 'bslstl::RadixHeap' with
+// 'bsl::priority_queue' and 'std::priority_queue' is provided as a negative
+// test case.
+//-----------------------------------------------------------------------------
+// CLASS METHODS ('RadixHeap_Util')
+// [ 2] int numSignificantBits(bsls::Types::Uint64 value);
+// [ 2] int numSignificantBitsPortable(bsls::Types::Uint64 value);
+//
+// CREATORS
+// [ 3] explicit RadixHeap(const ALLOCATOR& allocator = ALLOCATOR());
+// [ 4] RadixHeap(const RadixHeap& original, const ALLOCATOR& allocator);
+//
+// MANIPULATORS
+// [ 4] RadixHeap& operator=(const RadixHeap& rhs);
+// [ 4] void clear();
+// [ 3] void pop();
+// [ 3] void push(const KEY& key, const VALUE& value);
+// [ 4] void swap(RadixHeap& other);
+// [ 3] const value_type& top();
+//
+// ACCESSORS
+// [ 3] bool empty() const;
+// [ 4] allocator_type get_allocator() const;
+// [ 3] KEY keyLowerBound() const;
+// [ 3] size_type size() const;
+//
+// FREE FUNCTIONS
+// [ 4] void swap(RadixHeap& a, RadixHeap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: The type traits are correctly declared.
+// [ 5] CONCERN: Allocations are bounded for a heap of bounded size.
+// [ 5] CONCERN: Allocation failures leave the heap unchanged.
+// [ 6] CONCERN: Precondition violations are detected when enabled.
+// [-1] PERFORMANCE: COMPARISON WITH COMPARISON-BASED HEAPS
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Uint64                   Uint64;
+typedef bslstl::RadixHeap<Uint64, int>        Obj;
+typedef bslstl::RadixHeap_Util                Util;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *seed)
+    // Advance the specified 'seed' and return a pseudo-random 64-bit value.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed ^ (*seed >> 29);
+}
+
+template <class KEY>
+void testPushPop(Uint64 seed, Uint64 maxIncrement)
+    // Apply a pseudo-random monotone sequence of 'push', 'top', and 'pop'
+    // operations, generated from the specified 'seed', to a radix heap having
+    // the (template parameter) 'KEY' type, adding keys that exceed the lower
+    // bound by at most the specified 'maxIncrement' (and never exceed the
+    // maximum value of 'KEY'), and verify each result against a reference
+    // model.
+{
+    typedef bslstl::RadixHeap<KEY, int>   Heap;
+    typedef std::multimap<KEY, int>       Model;
+
+    const KEY MAX_KEY = static_cast<KEY>(-1);
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    Heap mX(&oa);  Heap& X = mX;
+    Model model;
+
+    std::vector<KEY> keyOfId;
+
+    ASSERTV(X.empty());
+    ASSERTV(0 == X.size());
+    ASSERTV(0 == X.keyLowerBound());
+
+    const int NUM_OPERATIONS = 20000;
+    for (int i = 0; i < NUM_OPERATIONS; ++i) {
+        const Uint64 r = nextRandom(&seed);
+
+        // Push more often than pop in the first half, and less often in the
+        // second, so that the heap grows, shrinks, and becomes empty.
+
+        const bool doPush = model.empty()
+                         || (r % 8) < (i < NUM_OPERATIONS / 2 ? 5u : 3u);
+
+        if (doPush) {
+            const KEY    bound     = X.keyLowerBound();
+            const Uint64 headroom  = static_cast<Uint64>(MAX_KEY - bound);
+            Uint64       increment = ~0ULL == maxIncrement
+                                     ? nextRandom(&seed)
+                                     : (r >> 8) % (maxIncrement + 1);
+            if (increment > headroom) {
+                increment = headroom;
+            }
+            if (0 == (r >> 4) % 16) {
+                increment = 0;                            // equal to the bound
+            }
+            const KEY key = static_cast<KEY>(bound + increment);
+            const int id  = static_cast<int>(keyOfId.size());
+
+            mX.push(key, id);
+            keyOfId.push_back(key);
+            model.insert(typename Model::value_type(key, id));
+        }
+        else {
+            const typename Heap::value_type& TOP = mX.top();
+
+            const KEY LEAST = model.begin()->first;
+            ASSERTV(i, LEAST == TOP.first);
+            ASSERTV(i, 0 <= TOP.second);
+            ASSERTV(i, TOP.second < static_cast<int>(keyOfId.size()));
+            ASSERTV(i, keyOfId[TOP.second] == TOP.first);
+            ASSERTV(i, LEAST == X.keyLowerBound());
+
+            // Remove the identified pair from the model.
+
+            typename Model::iterator it = model.lower_bound(TOP.first);
+            while (it != model.end() && it->second != TOP.second) {
+                ++it;
+            }
+            ASSERTV(i, it != model.end());
+            if (it != model.end()) {
+                model.erase(it);
+            }
+            if (r & 1) {
+                mX.pop();
+            }
+            else {
+                // Pop without an intervening 'top'.
+
+                mX.pop();
+                if (!model.empty()) {
+                    const typename Heap::value_type& NEXT = mX.top();
+                    ASSERTV(i, model.begin()->first == NEXT.first);
+                }
+            }
+        }
+        ASSERTV(i, model.size() == X.size());
+        ASSERTV(i, model.empty() == X.empty());
+    }
+
+    while (!X.empty()) {
+        const KEY LEAST = model.begin()->first;
+        ASSERTV(LEAST == mX.top().first);
+        model.erase(model.begin());
+        mX.pop();
+    }
+    ASSERTV(model.empty());
+}
+
+unsigned int nextBenchmarkKey(unsigned int *seed)
+    // Advance the specified 'seed' and return a pseudo-random value in the
+    // range '[1, 65536]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return ((*seed >> 8) & 0xFFFF) + 1;
+}
+
+template <class QUEUE>
+struct BenchmarkAdapter {
+    // This 'struct' template provides a uniform interface to a comparison-
+    // based priority queue, of the (template parameter) 'QUEUE' type, holding
+    // 'unsigned int' keys ordered from least to greatest.
+
+    QUEUE d_queue;
+
+    void push(unsigned int key) { d_queue.push(key); }
+    unsigned int top() { return d_queue.top(); }
+    void pop() { d_queue.pop(); }
+    bool empty() const { return d_queue.empty(); }
+};
+
+template <>
+struct BenchmarkAdapter<bslstl::RadixHeap<unsigned int, int> > {
+    // This specialization provides the uniform benchmark interface to a radix
+    // heap.
+
+    bslstl::RadixHeap<unsigned int, int> d_queue;
+
+    void push(unsigned int key) { d_queue.push(key, 0); }
+    unsigned int top() { return d_queue.top().first; }
+    void pop() { d_queue.pop(); }
+    bool empty() const { return d_queue.empty(); }
+};
+
+template <class QUEUE>
+void benchmark(const char *name, int size, int numRounds)
+    // Print, for the priority queue type 'QUEUE', identified by the specified
+    // 'name', the average time per operation taken, on a queue holding the
+    // specified 'size' pseudo-random keys, to pop the least key and push a
+    // greater one (as a timer queue does), and then to pop every key,
+    // repeating each measurement the specified 'numRounds' times.
+{
+    double holdTime = 0, popTime = 0;
+    bsls::Types::Int64 checksum = 0;
+
+    for (int round = 0; round < numRounds; ++round) {
+        BenchmarkAdapter<QUEUE> mX;
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < size; ++i) {
+            mX.push(nextBenchmarkKey(&seed));
+        }
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < size; ++i) {
+            const unsigned int key = mX.top();
+            mX.pop();
+            mX.push(key + nextBenchmarkKey(&seed));
+        }
+        timer.stop();
+        holdTime += timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        while (!mX.empty()) {
+            checksum += mX.top();
+            mX.pop();
+        }
+        timer.stop();
+        popTime += timer.elapsedTime();
+    }
+
+    const double NUM_OPS = static_cast<double>(size) * numRounds;
+
+    printf("%-24s %10d %9.1f %9.1f   (%lld)\n",
+           name,
+           size,
+           holdTime * 1e9 / NUM_OPS,
+           popTime  * 1e9 / NUM_OPS,
+           checksum);
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Timer Queue
+/// - - - - - - - - - - - -
+// Suppose we are implementing the timer queue of an event loop.  Timers are
+// registered with an absolute expiry time, measured in ticks of a monotonic
+// clock, and a timer callback may register further timers, which expire no
+// earlier than the current time.
+//
+// First, we define the type of the clock ticks and a simple identifier for
+// the timers:
+//..
+    typedef bsls::Types::Uint64 Tick;
+    typedef int                 TimerId;
+//..
+// Then, we create a radix heap of timers, keyed by their expiry time, and
+// register three timers:
+//..
+    bslstl::RadixHeap<Tick, TimerId> timers;
+
+    timers.push(1500, 1);
+    timers.push(1000, 2);
+    timers.push(2500, 3);
+    ASSERT(3 == timers.size());
+//..
+// Next, suppose the clock reads 2000 ticks.  We dispatch each timer whose
+// expiry time has been reached; the callback of timer 2 registers timer 4, to
+// expire 300 ticks later:
+//..
+    const Tick now = 2000;
+
+    ASSERT(2    == timers.top().second);
+    ASSERT(1000 == timers.top().first);
+    timers.pop();
+    timers.push(now + 300, 4);
+
+    ASSERT(1    == timers.top().second);
+    timers.pop();
+//..
+// Then, the callback of timer 1 registers timer 5, to expire immediately.
+// The expiry time of timer 5 is earlier than that of any timer in the heap,
+// but is no less than 'keyLowerBound()', the expiry time of the timer most
+// recently dispatched, and so may be added:
+//..
+    ASSERT(1500 == timers.keyLowerBound());
+    timers.push(now, 5);
+
+    ASSERT(5    == timers.top().second);
+    timers.pop();
+//..
+// Finally, we observe that the next timer, timer 4, has not yet expired:
+//..
+    ASSERT(4    == timers.top().second);
+    ASSERT(now  <  timers.top().first);
+    ASSERT(2    == timers.size());
+//..
+
+        (void) sizeof(TimerId);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // NEGATIVE TESTING
+        //
+        // Concerns:
+        //: 1 Adding a key less than the lower bound, and accessing or removing
+        //:   the least pair of an empty heap, are detected in "safe" mode.
+        //
+        // Plan:
+        //: 1 Use 'bsls::AssertTest' to verify that each precondition violation
+        //:   is detected, and that the boundary cases are not.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Precondition violations are detected when enabled.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nNEGATIVE TESTING"
+                            "\n================\n");
+
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT_SAFE_FAIL(mX.top());
+        ASSERT_SAFE_FAIL(mX.pop());
+
+        mX.push(10, 1);
+        mX.push(20, 2);
+        ASSERT(10 == mX.top().first);
+        ASSERT(10 == X.keyLowerBound());
+
+        ASSERT_SAFE_FAIL(mX.push( 9, 3));
+        ASSERT_SAFE_PASS(mX.push(10, 4));
+
+        ASSERT_SAFE_PASS(mX.pop());
+        ASSERT_SAFE_PASS(mX.pop());
+        ASSERT_SAFE_PASS(mX.pop());
+        ASSERT(X.empty());
+        ASSERT_SAFE_FAIL(mX.pop());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MEMORY ALLOCATION AND EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 The number of allocations made by a heap whose size is bounded
+        //:   is bounded independently of the number of operations applied.
+        //:
+        //: 2 If 'push' fails to allocate, the heap is unchanged.
+        //:
+        //: 3 If 'top' or 'pop' fails to allocate while redistributing pairs,
+        //:   the heap is unchanged.
+        //:
+        //: 4 All memory is supplied by the object allocator, and is released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Apply a long timer-like workload to a heap of 1000 pairs, and
+        //:   verify that the number of allocations does not exceed that of
+        //:   growing each bucket geometrically to 1000 pairs.  (C-1)
+        //:
+        //: 2 Push pairs, and remove them, under the test allocator exception
+        //:   test macros, verifying the contents of the heap after each
+        //:   (possibly failed) attempt against a reference.  (C-2..3)
+        //:
+        //: 3 Verify that the default allocator is not used, and that all
+        //:   memory is returned to the object allocator.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Allocations are bounded for a heap of bounded size.
+        //   CONCERN: Allocation failures leave the heap unchanged.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMEMORY ALLOCATION AND EXCEPTION SAFETY"
+                            "\n======================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tBounded allocation.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Uint64 seed = 1;
+            for (int i = 0; i < 1000; ++i) {
+                mX.push(nextRandom(&seed) % 100000, i);
+            }
+
+            for (int i = 0; i < 1000000; ++i) {
+                const Uint64 key = mX.top().first;
+                mX.pop();
+                mX.push(key + nextRandom(&seed) % 100000, i);
+            }
+
+            // One allocation for the array of buckets, and at most 12 for
+            // each bucket (one for each doubling of its capacity from 1 to
+            // 1024, plus the reservation made by the first redistribution).
+
+            const bsls::Types::Int64 MAX_ALLOCATIONS = 1 + 65 * 12;
+            ASSERTV(oa.numAllocations(),
+                    MAX_ALLOCATIONS >= oa.numAllocations());
+            ASSERT(1000 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tException safety.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int NUM_PAIRS = 200;
+            Uint64    seed      = 3;
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                const Uint64 key = nextRandom(&seed) % 1000000;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, static_cast<Obj::size_type>(i) == X.size());
+                    mX.push(key, i);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+            ASSERT(NUM_PAIRS == X.size());
+
+            Uint64 previous = 0;
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                Uint64 key = 0;
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, static_cast<Obj::size_type>(NUM_PAIRS - i) ==
+                                                                    X.size());
+                    key = mX.top().first;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(i, previous <= key);
+                previous = key;
+
+                // A redistribution was performed, if needed, by 'top' (above)
+                // and 'pop' does not allocate.
+
+                mX.pop();
+            }
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, CLEAR, AND ALLOCATOR
+        //
+        // Concerns:
+        //: 1 A copy holds the same pairs and lower bound as the original, uses
+        //:   the supplied allocator (or the default allocator), and is
+        //:   independent of the original.
+        //:
+        //: 2 Assignment gives the target the pairs and lower bound of the
+        //:   source, and self-assignment has no effect.
+        //:
+        //: 3 'swap' (member and free) exchanges the pairs and lower bounds,
+        //:   and does not allocate.
+        //:
+        //: 4 'clear' removes all pairs, retains the lower bound, and releases
+        //:   no memory.
+        //:
+        //: 5 'get_allocator' returns the allocator supplied at construction,
+        //:   and 'bslma::UsesBslmaAllocator' is true for 'bsl::allocator'.
+        //
+        // Plan:
+        //: 1 Create heaps holding pairs, copy and assign them, and drain the
+        //:   results, comparing the sequences of pairs yielded.  (C-1..2)
+        //:
+        //: 2 Swap heaps with a test allocator monitor in place.  (C-3)
+        //:
+        //: 3 Clear a heap and verify its state and its memory use.  (C-4)
+        //:
+        //: 4 Check 'get_allocator' and the trait directly.  (C-5)
+        //
+        // Testing:
+        //   RadixHeap(const RadixHeap& original, const ALLOCATOR& allocator);
+        //   RadixHeap& operator=(const RadixHeap& rhs);
+        //   void clear();
+        //   void swap(RadixHeap& other);
+        //   allocator_type get_allocator() const;
+        //   void swap(RadixHeap& a, RadixHeap& b);
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, CLEAR, AND ALLOCATOR"
+                          "\n============================================\n");
+
+        BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+        BSLMF_ASSERT((!bslma::UsesBslmaAllocator<
+                          bslstl::RadixHeap<Uint64,
+                                            int,
+                                            std::allocator<bsl::pair<Uint64,
+                                                                     int> > >
+                                                                   >::value));
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(&oa == X.get_allocator().mechanism());
+
+        const Uint64 KEYS[] = { 40, 7, 19, 7, 1000000, 3, 250, 65536 };
+        const int    NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.push(KEYS[i], i);
+        }
+        ASSERT(3 == mX.top().first);
+        ASSERT(3 == X.keyLowerBound());
+
+        {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(&sa == Y.get_allocator().mechanism());
+            ASSERT(X.size() == Y.size());
+            ASSERT(3 == Y.keyLowerBound());
+
+            Obj mZ(X);  const Obj& Z = mZ;
+            ASSERT(&defaultAllocator == Z.get_allocator().mechanism());
+
+            Obj mW(&sa);  const Obj& W = mW;
+            mW.push(1, -1);
+            mW = X;
+            ASSERT(X.size() == W.size());
+            ASSERT(3 == W.keyLowerBound());
+            ASSERT(&sa == W.get_allocator().mechanism());
+
+            mW = W;
+            ASSERT(X.size() == W.size());
+
+            // Drain the copies together with the original.
+
+            Obj mO(X, &sa);
+            while (!mO.empty()) {
+                const bsl::pair<Uint64, int> EXP = mO.top();
+                ASSERTV(EXP.first == mY.top().first);
+                ASSERTV(EXP.first == mZ.top().first);
+                ASSERTV(EXP.first == mW.top().first);
+                mO.pop();  mY.pop();  mZ.pop();  mW.pop();
+            }
+            ASSERT(Y.empty());
+            ASSERT(Z.empty());
+            ASSERT(W.empty());
+            ASSERT(NUM_KEYS == X.size());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        {
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.push(5, 100);
+            mY.push(9, 101);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(2        == X.size());
+            ASSERT(0        == X.keyLowerBound());
+            ASSERT(NUM_KEYS == Y.size());
+            ASSERT(3        == Y.keyLowerBound());
+
+            swap(mX, mY);
+            ASSERT(NUM_KEYS == X.size());
+            ASSERT(2        == Y.size());
+
+            ASSERT(oam.isTotalSame());
+        }
+
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(3 == X.keyLowerBound());
+            ASSERT(oam.isInUseSame());
+
+            mX.push(3, 0);
+            ASSERT(3 == mX.top().first);
+            ASSERT(oam.isTotalSame());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PUSH, TOP, AND POP
+        //
+        // Concerns:
+        //: 1 'top' returns a pair having the least key held, and 'pop'
+        //:   removes a pair having the least key held, whether or not 'top'
+        //:   was called first.
+        //:
+        //: 2 Every pair added is yielded exactly once, with the value it was
+        //:   added with.
+        //:
+        //: 3 Keys equal to the lower bound, keys differing from it in the most
+        //:   significant bit of 'KEY', and the greatest value of 'KEY' are
+        //:   handled correctly.
+        //:
+        //: 4 'keyLowerBound' is the key of the least pair most recently
+        //:   accessed, and 'size' and 'empty' reflect the number of pairs.
+        //:
+        //: 5 The above hold for each unsigned integral type of key.
+        //
+        // Plan:
+        //: 1 For each unsigned key type, apply pseudo-random monotone
+        //:   sequences of operations, with keys drawn from ranges of various
+        //:   widths (including the full range of the type), and compare each
+        //:   result with a reference 'std::multimap'.  (C-1..5)
+        //:
+        //: 2 Add keys that differ from the lower bound only in the most
+        //:   significant bit, and the greatest key, and remove them.  (C-3)
+        //
+        // Testing:
+        //   explicit RadixHeap(const ALLOCATOR& allocator = ALLOCATOR());
+        //   void pop();
+        //   void push(const KEY& key, const VALUE& value);
+        //   const value_type& top();
+        //   bool empty() const;
+        //   KEY keyLowerBound() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPUSH, TOP, AND POP"
+                            "\n==================\n");
+
+        const Uint64 INCREMENTS[] = { 0, 1, 15, 1000, 1 << 20, ~0ULL };
+        const int    NUM_INCREMENTS = sizeof INCREMENTS / sizeof *INCREMENTS;
+
+        for (int ti = 0; ti < NUM_INCREMENTS; ++ti) {
+            const Uint64 INCREMENT = INCREMENTS[ti];
+            if (veryVerbose) { T_ P(INCREMENT) }
+
+            testPushPop<unsigned char>(ti + 1, INCREMENT);
+            testPushPop<unsigned short>(ti + 1, INCREMENT);
+            testPushPop<unsigned int>(ti + 1, INCREMENT);
+            testPushPop<unsigned long>(ti + 1, INCREMENT);
+            testPushPop<Uint64>(ti + 1, INCREMENT);
+        }
+
+        if (verbose) printf("\tExtreme keys.\n");
+        {
+            const Uint64 HIGH_BIT = 1ULL << 63;
+            const Uint64 MAX      = ~0ULL;
+
+            Obj mX;  const Obj& X = mX;
+            mX.push(MAX,          1);
+            mX.push(HIGH_BIT,     2);
+            mX.push(HIGH_BIT - 1, 3);
+            mX.push(0,            4);
+            mX.push(MAX,          5);
+            ASSERT(5 == X.size());
+
+            ASSERT(4 == mX.top().second);  mX.pop();
+            ASSERT(3 == mX.top().second);  mX.pop();
+            ASSERT(HIGH_BIT - 1 == X.keyLowerBound());
+            ASSERT(2 == mX.top().second);  mX.pop();
+            ASSERT(HIGH_BIT == X.keyLowerBound());
+            ASSERT(MAX == mX.top().first);  mX.pop();
+            ASSERT(MAX == mX.top().first);  mX.pop();
+            ASSERT(MAX == X.keyLowerBound());
+            ASSERT(X.empty());
+
+            mX.push(MAX, 6);
+            ASSERT(6 == mX.top().second);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'RadixHeap_Util'
+        //
+        // Concerns:
+        //: 1 'numSignificantBits' returns 0 for 0, and the position of the
+        //:   most significant set bit otherwise, for every bit position.
+        //:
+        //: 2 'numSignificantBitsPortable' agrees with 'numSignificantBits'.
+        //
+        // Plan:
+        //: 1 For each bit position, verify the result for the power of two,
+        //:   for that value minus one, and for that value with all lower bits
+        //:   set, and for pseudo-random values.  (C-1..2)
+        //
+        // Testing:
+        //   int numSignificantBits(bsls::Types::Uint64 value);
+        //   int numSignificantBitsPortable(bsls::Types::Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'RadixHeap_Util'"
+                            "\n================\n");
+
+        ASSERT(0 == Util::numSignificantBits(0));
+        ASSERT(0 == Util::numSignificantBitsPortable(0));
+
+        for (int bit = 0; bit < 64; ++bit) {
+            const Uint64 POWER = 1ULL << bit;
+            const Uint64 FILLED = POWER | (POWER - 1);
+
+            ASSERTV(bit, bit + 1 == Util::numSignificantBits(POWER));
+            ASSERTV(bit, bit + 1 == Util::numSignificantBitsPortable(POWER));
+            ASSERTV(bit, bit + 1 == Util::numSignificantBits(FILLED));
+            ASSERTV(bit, bit + 1 == Util::numSignificantBitsPortable(FILLED));
+            ASSERTV(bit, bit == Util::numSignificantBits(POWER - 1));
+            ASSERTV(bit, bit == Util::numSignificantBitsPortable(POWER - 1));
+        }
+
+        Uint64 seed = 5;
+        for (int i = 0; i < 10000; ++i) {
+            const Uint64 VALUE = nextRandom(&seed) >> (i % 64);
+            ASSERTV(VALUE, Util::numSignificantBits(VALUE) ==
+                                     Util::numSignificantBitsPortable(VALUE));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add pairs, and remove them in order of their keys, adding further
+        //:   pairs as the heap is drained.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX.push(30, 3);
+        mX.push(10, 1);
+        mX.push(20, 2);
+        ASSERT(3 == X.size());
+
+        ASSERT(1  == mX.top().second);
+        ASSERT(10 == X.keyLowerBound());
+        mX.pop();
+
+        mX.push(15, 4);
+        ASSERT(4 == mX.top().second);  mX.pop();
+        ASSERT(2 == mX.top().second);  mX.pop();
+        ASSERT(3 == mX.top().second);  mX.pop();
+        ASSERT(X.empty());
+        ASSERT(30 == X.keyLowerBound());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH COMPARISON-BASED HEAPS
+        //
+        // Concerns:
+        //: 1 Compare the speed of 'bslstl::RadixHeap' with that of
+        //:   'bsl::priority_queue' (a 4-ary heap) and 'std::priority_queue' (a
+        //:   binary heap) for queues from 1,000 elements up to a size that may
+        //:   be specified on the command line.
+        //
+        // Plan:
+        //: 1 For sizes increasing by factors of 10 from 1,000 to the maximum
+        //:   size given as the second argument (10,000,000 by default), time
+        //:   popping the least key and pushing a greater one (the steady
+        //:   state of a timer queue) once per element, and then popping every
+        //:   element, repeating the measurements for small sizes so that each
+        //:   size performs approximately the same number of operations.  Print
+        //:   the average time per operation in nanoseconds.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH COMPARISON-BASED HEAPS
+        // --------------------------------------------------------------------
+
+        const int MAX_SIZE = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        printf("\nPERFORMANCE: COMPARISON WITH COMPARISON-BASED HEAPS"
+               "\n===================================================\n");
+
+        typedef std::greater<unsigned int> Greater;
+
+        typedef bslstl::RadixHeap<unsigned int, int> RadixQueue;
+        typedef bsl::priority_queue<unsigned int,
+                                    bsl::vector<unsigned int>,
+                                    Greater>         BslQueue;
+        typedef std::priority_queue<unsigned int,
+                                    std::vector<unsigned int>,
+                                    Greater>         StdQueue;
+
+        printf("%-24s %10s %9s %9s   (ns/op)\n",
+               "queue", "size", "pop+push", "pop");
+
+        for (int size = 1000; size <= MAX_SIZE; size *= 10) {
+            const int NUM_ROUNDS = size < 1000000 ? 1000000 / size : 1;
+
+            benchmark<RadixQueue>("RadixHeap", size, NUM_ROUNDS);
+            benchmark<BslQueue>("bsl::priority_queue", size, NUM_ROUNDS);
+            benchmark<StdQueue>("std::priority_queue", size, NUM_ROUNDS);
+
+            if (MAX_SIZE / 10 < size) {
+                break;
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
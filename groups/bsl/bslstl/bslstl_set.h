@@ -517,6 +517,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -1090,6 +1094,15 @@ void swap(set<KEY, COMPARATOR, ALLOCATOR>& a,
     // behavior is undefined is unless either this object was created with the
     // same allocator as 'other' or 'propagate_on_container_swap' is 'true'.
 
+// FREE FUNCTIONS
+template <class HASHALG, class KEY, class COMPARATOR, class ALLOCATOR>
+void hashAppend(HASHALG&                               hashAlg,
+                const set<KEY, COMPARATOR, ALLOCATOR>& input);
+    // Pass the specified 'input' set to the specified 'hashAlg': its size
+    // (as a 'std::size_t'), followed by each of its elements in order.  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').
+
 // ===========================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
@@ -1745,6 +1758,21 @@ void bsl::swap(bsl::set<KEY, COMPARATOR, ALLOCATOR>& a,
     a.swap(b);
 }
 
+// FREE FUNCTIONS
+template <class HASHALG, class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::hashAppend(HASHALG&                               hashAlg,
+                     const set<KEY, COMPARATOR, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    typedef typename set<KEY, COMPARATOR, ALLOCATOR>::const_iterator ci_t;
+
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
+    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
+        hashAppend(hashAlg, *b);
+    }
+}
+
 // ============================================================================
 //                                TYPE TRAITS
 // ============================================================================
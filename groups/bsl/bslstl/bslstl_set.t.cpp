@@ -3,6 +3,8 @@
 
 #include <bslalg_rangecompare.h>
 
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
 #include <bslma_default.h>
 #include <bslma_allocator.h>
 #include <bslma_testallocator.h>
@@ -147,6 +149,7 @@ using namespace bsl;
 //
 //// specialized algorithms:
 // [ 8] void swap(set<K, C, A>& a, set<K, C, A>& b);
+// [27] void hashAppend(HASHALG& hashAlg, const set<K,C,A>& input);
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -6340,6 +6343,91 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the set (as a 'size_t'), and
+        //:   then each of its elements, in order, to the hashing algorithm.
+        //:
+        //: 2 Sets having the same value have the same hash value, and
+        //:   sets having different values have distinct hash values.
+        //:
+        //: 3 The hash value of a set does not depend on the order in which
+        //:   its elements were inserted.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create sets of various
+        //:   lengths, inserting the elements of each in reverse order, and
+        //:   compare the value computed by 'bslh::Hash' with that of a
+        //:   'bslh::DefaultHashAlgorithm' to which the size and elements (in
+        //:   order) were supplied explicitly.  (C-1, 3)
+        //:
+        //: 2 Compare the hash values of each pair of sets in the table.
+        //:   (C-2)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const set<K,C,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        typedef bsl::set<int> ObjSet;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_length;     // number of elements
+            int d_keys[3];    // keys, in order
+        } DATA[] = {
+            //LINE  LEN  KEYS
+            //----  ---  ------------
+            { L_,     0, { 0       } },
+            { L_,     1, { 1       } },
+            { L_,     1, { 2       } },
+            { L_,     2, { 1, 2    } },
+            { L_,     2, { 1, 3    } },
+            { L_,     3, { 1, 2, 3 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int  LENGTH = DATA[ti].d_length;
+            const int *KEYS   = DATA[ti].d_keys;
+
+            ObjSet mX(&oa);  const ObjSet& X = mX;
+            for (int i = LENGTH - 1; 0 <= i; --i) {
+                mX.insert(KEYS[i]);
+            }
+
+            bslh::DefaultHashAlgorithm expected;
+            const size_t               SIZE = LENGTH;
+            expected(&SIZE, sizeof SIZE);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected(&KEYS[i], sizeof KEYS[i]);
+            }
+            ASSERTV(LINE, expected.computeHash() == hasher(X));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int  LINE2   = DATA[tj].d_line;
+                const int  LENGTH2 = DATA[tj].d_length;
+                const int *KEYS2   = DATA[tj].d_keys;
+
+                ObjSet mY(&oa);  const ObjSet& Y = mY;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mY.insert(KEYS2[i]);
+                }
+
+                ASSERTV(LINE, LINE2, (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
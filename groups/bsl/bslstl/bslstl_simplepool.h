@@ -271,6 +271,8 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     // PRIVATE TYPES
     typedef SimplePool_Type<ALLOCATOR> Types;
 
+    typedef typename Types::AllocatorTraits::size_type SizeType;
+
     union Block {
         // This 'union' implements a link data structure with the size no
         // smaller than 'VALUE' that stores the address of the next link.
@@ -290,9 +292,17 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // This 'union' prepends to the beginning of each managed block of
         // allocated memory, implementing a singly-linked list of managed
         // chunks, and thereby enabling constant-time additions to the list of
-        // chunks.
+        // chunks.  Each chunk also records its own size so that it can be
+        // returned to the allocator with the same size that was requested.
+
+        struct Header {
+            Chunk    *d_next_p;           // pointer to next Chunk
+
+            SizeType  d_numMaxAlignedType;  // size of this chunk, in units
+                                          // of 'MaxAlignedType'
+        };
 
-        Chunk *d_next_p;  // pointer to next Chunk
+        Header d_header;  // link and size of this chunk
 
         typename bsls::AlignmentFromType<Block>::Type d_alignment;
                           // ensure each block is correctly aligned
@@ -422,11 +432,12 @@ SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
     Chunk *chunkPtr = reinterpret_cast<Chunk *>(
                     AllocatorTraits::allocate(allocator(), numMaxAlignedType));
 
-    BSLS_ASSERT_SAFE(0 ==
-             reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
+    BSLS_ASSERT_SAFE(0 == reinterpret_cast<bsls::Types::UintPtr>(chunkPtr)
+                                      % bsls::AlignmentFromType<Chunk>::VALUE);
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    chunkPtr->d_header.d_next_p            = d_chunkList_p;
+    chunkPtr->d_header.d_numMaxAlignedType = numMaxAlignedType;
+    d_chunkList_p                          = chunkPtr;
 
     return reinterpret_cast<Block *>(chunkPtr + 1);
 }
@@ -555,8 +566,10 @@ void SimplePool<VALUE, ALLOCATOR>::release()
         typename AllocatorTraits::value_type *lastChunk =
                       reinterpret_cast<typename AllocatorTraits::value_type *>(
                                                                 d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+        size_type numMaxAlignedType =
+                                   d_chunkList_p->d_header.d_numMaxAlignedType;
+        d_chunkList_p = d_chunkList_p->d_header.d_next_p;
+        AllocatorTraits::deallocate(allocator(), lastChunk, numMaxAlignedType);
     }
     d_freeList_p = 0;
 }
@@ -222,6 +222,65 @@ class Stack {
     }
 };
 
+class SizeCheckingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol by forwarding to
+    // a test allocator, and tallies the number of bytes allocated and the
+    // number of bytes returned through 'sizedDeallocate'.
+
+    // DATA
+    bslma::TestAllocator d_imp;                // supplies memory
+    size_type            d_numBytesAllocated;  // total bytes allocated
+    size_type            d_numBytesReturned;   // total bytes returned to
+                                               // 'sizedDeallocate'
+    int                  d_numUnsized;         // number of calls to
+                                               // 'deallocate'
+
+  public:
+    // CREATORS
+    SizeCheckingAllocator()
+    : d_imp("sizeChecking", veryVeryVeryVerbose)
+    , d_numBytesAllocated(0)
+    , d_numBytesReturned(0)
+    , d_numUnsized(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        d_numBytesAllocated += size;
+        return d_imp.allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        ++d_numUnsized;
+        d_imp.deallocate(address);
+    }
+
+    virtual void sizedDeallocate(void *address, size_type size)
+    {
+        d_numBytesReturned += size;
+        d_imp.deallocate(address);
+    }
+
+    // ACCESSORS
+    size_type numBytesAllocated() const { return d_numBytesAllocated; }
+        // Return the total number of bytes allocated.
+
+    size_type numBytesReturned() const { return d_numBytesReturned; }
+        // Return the total number of bytes passed to 'sizedDeallocate'.
+
+    int numUnsized() const { return d_numUnsized; }
+        // Return the number of calls to the unsized 'deallocate'.
+
+    bsls::Types::Int64 numBlocksInUse() const
+        // Return the number of blocks currently allocated.
+    {
+        return d_imp.numBlocksInUse();
+    }
+};
+
 template <class VALUE>
 class TestDriver {
     // This templatized struct provide a namespace for testing the 'map'
@@ -589,6 +648,9 @@ void TestDriver<VALUE>::testCase7()
     //:
     //: 3 No free memory blocks is available after a 'release'.  i.e.,
     //:   subsequent 'allocate' will need to allocate memory from the heap.
+    //:
+    //: 4 Each chunk is returned to the allocator with the size with which it
+    //:   was allocated.
     //
     // Plan:
     //: 1 Invoke 'allocate' and 'deallocate' various number of time.
@@ -597,6 +659,10 @@ void TestDriver<VALUE>::testCase7()
     //:
     //:   2 Call 'allocate' and verify memory is allocated from the heap.
     //:     (C-3)
+    //:
+    //: 2 Using an allocator that tallies the sizes passed to 'allocate' and
+    //:   'sizedDeallocate', allocate blocks from the pool, call 'release', and
+    //:   verify that the tallies are equal.  (C-4)
     //
     // Testing:
     //   void release();
@@ -660,6 +726,23 @@ void TestDriver<VALUE>::testCase7()
 
     }
 
+    for (int ti = 0; ti < 100; ti += 7) {
+        SizeCheckingAllocator oa;
+
+        Obj mX(&oa);
+        for (int i = 0; i < ti; ++i) {
+            mX.allocate();
+        }
+        mX.reserve(ti + 1);
+
+        mX.release();
+
+        ASSERTV(ti, 0 == oa.numBlocksInUse());
+        ASSERTV(ti, 0 == oa.numUnsized());
+        ASSERTV(ti, oa.numBytesAllocated(), oa.numBytesReturned(),
+                oa.numBytesAllocated() == oa.numBytesReturned());
+    }
+
     // Verify no memory is allocated from the default allocator.
 
     ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
@@ -0,0 +1,1662 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector holding a few elements without allocating.
+//
+//@CLASSES:
+//   bsl::small_vector: vector with inline storage for 'N' elements
+//
+//@SEE_ALSO: bslstl_vector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a dynamic array whose first 'N' elements
+// (for a template parameter 'N') are held in a buffer embedded in the
+// 'small_vector' object itself.  Memory is obtained from the allocator only
+// when the vector grows beyond 'N' elements, at which point all elements are
+// moved to an allocated buffer that grows geometrically, exactly as that of
+// 'bsl::vector' does.
+//
+// An instantiation of 'small_vector' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of elements) and the
+// sequence of values the 'small_vector' contains.  The inline capacity 'N' is
+// not a salient attribute, but two 'small_vector' objects can be compared
+// only if they have the same type, and hence the same 'N'.  Memory is
+// supplied by the (template parameter) type 'ALLOCATOR', which defaults to
+// 'bsl::allocator', and whose object is passed to each element, exactly as
+// for 'bsl::vector'.
+//
+///Comparison with 'bsl::vector'
+///-----------------------------
+// The interface of 'small_vector' is that of 'bsl::vector', and elements are
+// inserted, moved, and destroyed by the same 'bslalg::ArrayPrimitives'
+// functions, so that elements of a bit-wise moveable type are relocated by
+// 'memcpy'.  The differences follow from the inline buffer:
+//
+//: o A vector holding at most 'N' elements performs no allocation, and its
+//:   elements share cache lines with the object itself.
+//:
+//: o The capacity of an empty 'small_vector' is 'N', and 'shrink_to_fit'
+//:   moves the elements back into the inline buffer if there are at most 'N'
+//:   of them.
+//:
+//: o 'swap' exchanges buffers in constant time only if neither vector holds
+//:   its elements inline; otherwise it copies elements, and takes linear time.
+//:
+//: o A 'small_vector' is larger than a 'bsl::vector' by the size of the
+//:   inline buffer, and, since it refers to its own buffer, is not bit-wise
+//:   moveable.  'N' should therefore be chosen to cover the common case, not
+//:   the largest one.
+//
+// As for 'bsl::vector', any operation that may increase the size of a
+// 'small_vector' beyond its capacity invalidates all iterators, pointers, and
+// references to its elements.  In addition, every 'swap' that is not done in
+// constant time invalidates them.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Tags of a Message
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we decode messages made of tagged fields, and need the list of the
+// tags of each message, which is rarely longer than eight.  We collect the
+// tags in a 'small_vector' with an inline capacity of 8, so that the common
+// case performs no allocation.
+//
+// First, we define a function that appends to a 'small_vector' the tags of a
+// message, given as a string of comma-separated numbers:
+//..
+//  typedef bsl::small_vector<int, 8> TagList;
+//
+//  void collectTags(TagList *tags, const char *message)
+//      // Append to the specified 'tags' the numbers in the specified
+//      // comma-separated 'message'.
+//  {
+//      int tag = 0;
+//      for (const char *p = message; ; ++p) {
+//          if (',' == *p || 0 == *p) {
+//              tags->push_back(tag);
+//              tag = 0;
+//              if (0 == *p) {
+//                  break;
+//              }
+//          }
+//          else {
+//              tag = tag * 10 + (*p - '0');
+//          }
+//      }
+//  }
+//..
+// Then, we collect the tags of a short message, and observe that no memory
+// is allocated:
+//..
+//  bslma::TestAllocator oa("object");
+//
+//  TagList tags(&oa);
+//  collectTags(&tags, "8,9,35,49,56,34,52,10");
+//
+//  assert(8  == tags.size());
+//  assert(35 == tags[2]);
+//  assert(0  == oa.numBlocksTotal());
+//..
+// Finally, we collect the tags of a longer message, which spill to a buffer
+// obtained from the allocator:
+//..
+//  collectTags(&tags, "11,55,54,38");
+//
+//  assert(12 == tags.size());
+//  assert(38 == tags.back());
+//  assert(1  == oa.numBlocksInUse());
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_smallvector.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHANYTYPE
+#include <bslmf_matchanytype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHARITHMETICTYPE
+#include <bslmf_matcharithmetictype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NIL
+#include <bslmf_nil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t N,
+          class ALLOCATOR = bsl::allocator<VALUE_TYPE> >
+class small_vector : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements a value-semantic container type holding
+    // a dynamic array of elements of the (template parameter) type
+    // 'VALUE_TYPE', the first 'N' of which are held in a buffer embedded in
+    // the object.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    BSLMF_ASSERT(0 < N);
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> ContainerBase;
+        // This 'typedef' is an alias for the base class providing the
+        // allocator of this container.
+
+    typedef bsl::allocator_traits<ALLOCATOR>              AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+                 N * sizeof(VALUE_TYPE),
+                 BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE>
+                                                          InlineBuffer;
+        // This 'typedef' is an alias for the type of the buffer embedded in
+        // this container.
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                 value_type;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef VALUE_TYPE&                                reference;
+    typedef const VALUE_TYPE&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef VALUE_TYPE                                *iterator;
+    typedef const VALUE_TYPE                          *const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // PRIVATE TYPES
+    class Guard {
+        // This class provides a proctor for deallocating a buffer of
+        // 'VALUE_TYPE' objects obtained from the allocator of a
+        // 'small_vector'.
+
+        // DATA
+        VALUE_TYPE    *d_data_p;       // buffer (held, not owned)
+        size_type      d_capacity;     // capacity of the buffer
+        small_vector  *d_container_p;  // container that allocated the buffer
+
+      private:
+        // NOT IMPLEMENTED
+        Guard(const Guard&);
+        Guard& operator=(const Guard&);
+
+      public:
+        // CREATORS
+        Guard(VALUE_TYPE *data, size_type capacity, small_vector *container);
+            // Create a proctor for the specified 'data' buffer of the
+            // specified 'capacity', that returns 'data' to the allocator of
+            // the specified 'container' upon destruction, unless 'release' is
+            // called prior.
+
+        ~Guard();
+            // Destroy this proctor, deallocating any buffer under management.
+
+        // MANIPULATORS
+        void release();
+            // Release the buffer from management by this proctor.
+    };
+
+    // DATA
+    VALUE_TYPE   *d_dataBegin_p;  // first element
+    VALUE_TYPE   *d_dataEnd_p;    // one past the last element
+    size_type     d_capacity;     // number of elements the storage can hold
+    InlineBuffer  d_buffer;       // inline storage for 'N' elements
+
+    // FRIENDS
+    friend class Guard;
+
+    // PRIVATE CLASS METHODS
+    static size_type growCapacity(size_type newSize,
+                                  size_type capacity,
+                                  size_type maxSize);
+        // Return the capacity to allocate for a vector of the specified
+        // 'newSize' elements whose current storage has the specified
+        // 'capacity': the smallest power-of-two multiple of 'capacity' no
+        // less than 'newSize', limited to the specified 'maxSize'.  The
+        // behavior is undefined unless 'capacity < newSize <= maxSize'.
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline buffer of this vector.
+
+    void privateAdopt(VALUE_TYPE *data, size_type size, size_type capacity);
+        // Release the storage of this vector, which must hold no elements
+        // (having been moved from), and make the specified 'data', holding
+        // the specified 'size' elements and having the specified 'capacity',
+        // the storage of this vector.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 );
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator                   position,
+                               INPUT_ITER                       first,
+                               INPUT_ITER                       last,
+                               BloombergLP::bslmf::MatchAnyType ,
+                               BloombergLP::bslmf::MatchAnyType );
+        // Insert into this vector before the specified 'position' the
+        // elements in the range starting at the specified 'first' and ending
+        // immediately before the specified 'last' iterators, or, if
+        // 'INPUT_ITER' is an arithmetic type, 'first' copies of 'last'.
+
+    template <class INPUT_ITER>
+    void privateInsert(const_iterator                  position,
+                       INPUT_ITER                      first,
+                       INPUT_ITER                      last,
+                       const std::input_iterator_tag&);
+    template <class FWD_ITER>
+    void privateInsert(const_iterator                    position,
+                       FWD_ITER                          first,
+                       FWD_ITER                          last,
+                       const std::forward_iterator_tag&);
+        // Insert into this vector before the specified 'position' the
+        // elements in the range starting at the specified 'first' and ending
+        // immediately before the specified 'last' iterators.  The third
+        // argument selects the overload according to the category of the
+        // iterators.
+
+    void privateReallocate(size_type newCapacity);
+        // Move the elements of this vector into storage for the specified
+        // 'newCapacity' elements: the inline buffer if 'N == newCapacity',
+        // and a buffer obtained from the allocator otherwise; then release
+        // the previous storage.  The behavior is undefined unless
+        // 'size() <= newCapacity' and 'N <= newCapacity'.
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the inline buffer of this vector.
+
+  public:
+    // CREATORS
+    explicit small_vector(const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty vector.  Optionally specify an 'allocator' used to
+        // supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'allocator' shall be convertible to
+        // 'bslma::Allocator *', and if 'allocator' is not supplied, the
+        // currently installed default allocator is used.  Note that no memory
+        // is allocated.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& allocator = ALLOCATOR());
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  allocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' elements, each of
+        // which is a copy of the specified 'value', or is default-constructed
+        // if 'value' is not specified.  Optionally specify an 'allocator'
+        // having the same meaning as for the default constructor.  Throw
+        // 'std::length_error' if 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& allocator = ALLOCATOR());
+        // Create a vector holding a copy of each element in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last' iterators.  Optionally specify an 'allocator'
+        // having the same meaning as for the default constructor.  The
+        // (template parameter) type 'INPUT_ITER' shall meet the requirements
+        // of an input iterator defined in the C++11 standard [24.2.3]
+        // providing access to values of a type convertible to 'VALUE_TYPE'.
+        // The behavior is undefined unless '[first .. last)' is a valid
+        // range.
+
+    small_vector(const small_vector& original);
+    small_vector(const small_vector& original, const ALLOCATOR& allocator);
+        // Create a vector having the same value as the specified 'original'.
+        // Use the specified 'allocator' to supply memory, or, if 'allocator'
+        // is not specified, the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())'.
+
+    ~small_vector();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Make this vector hold the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'std::length_error' if
+        // 'numElements > max_size()'.
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Make this vector hold a copy of each element in the range starting
+        // at the specified 'first' and ending immediately before the
+        // specified 'last' iterators.  The behavior is undefined unless
+        // '[first .. last)' is a valid range that does not refer to elements
+        // of this vector.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this vector,
+        // or the 'end' iterator if this vector is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last element of this
+        // vector, or 'rend' if this vector is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator of this vector.
+
+    reference operator[](size_type position);
+        // Return a reference to the element at the specified 'position' in
+        // this vector.  The behavior is undefined unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the element at the specified 'position' in
+        // this vector.  Throw 'std::out_of_range' if 'position >= size()'.
+
+    reference front();
+        // Return a reference to the first element of this vector.  The
+        // behavior is undefined unless this vector is not empty.
+
+    reference back();
+        // Return a reference to the last element of this vector.  The
+        // behavior is undefined unless this vector is not empty.
+
+    VALUE_TYPE *data();
+        // Return the address of the first element of this vector, which is
+        // the address of the inline buffer if the elements are held inline.
+
+    void clear();
+        // Remove all elements from this vector, retaining its storage.
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position' from this vector,
+        // and return an iterator referring to the element that followed it,
+        // or 'end()'.  The behavior is undefined unless 'position' refers to
+        // an element of this vector.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements starting at the specified 'first' position up
+        // to, but not including, the specified 'last' position from this
+        // vector, and return an iterator referring to the element that was
+        // at 'last', or 'end()'.  The behavior is undefined unless
+        // 'begin() <= first <= last <= end()'.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert a copy of the specified 'value' into this vector before the
+        // specified 'position', and return an iterator referring to the
+        // inserted element.  Throw 'std::length_error' if
+        // 'size() == max_size()'.  The behavior is undefined unless
+        // 'position' is a valid iterator of this vector.  Note that 'value'
+        // may refer to an element of this vector.
+
+    void insert(const_iterator    position,
+                size_type         numElements,
+                const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // into this vector before the specified 'position'.  Throw
+        // 'std::length_error' if 'size() + numElements > max_size()'.  The
+        // behavior is undefined unless 'position' is a valid iterator of this
+        // vector.  Note that 'value' may refer to an element of this vector.
+
+    template <class INPUT_ITER>
+    void insert(const_iterator position, INPUT_ITER first, INPUT_ITER last);
+        // Insert into this vector before the specified 'position' a copy of
+        // each element in the range starting at the specified 'first' and
+        // ending immediately before the specified 'last' iterators.  Throw
+        // 'std::length_error' if the resulting size would exceed
+        // 'max_size()'.  The behavior is undefined unless 'position' is a
+        // valid iterator of this vector, and '[first .. last)' is a valid
+        // range that does not refer to elements of this vector.
+
+    void pop_back();
+        // Remove the last element of this vector.  The behavior is undefined
+        // unless this vector is not empty.
+
+    void push_back(const VALUE_TYPE& value);
+        // Append a copy of the specified 'value' to this vector.  Throw
+        // 'std::length_error' if 'size() == max_size()'.  Note that 'value'
+        // may refer to an element of this vector.
+
+    void reserve(size_type numElements);
+        // Ensure that this vector can hold the specified 'numElements'
+        // elements without reallocating its storage.  Throw
+        // 'std::length_error' if 'numElements > max_size()'.
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', removing
+        // elements at the end if 'newSize < size()', and otherwise appending
+        // copies of the specified 'value', or default-constructed elements if
+        // 'value' is not specified.  Throw 'std::length_error' if
+        // 'newSize > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the storage of this vector to fit its elements: if it holds
+        // at most 'N' elements, move them into the inline buffer, and
+        // otherwise move them to a buffer of exactly 'size()' elements.
+
+    void swap(small_vector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  If neither vector holds its elements inline, this
+        // method exchanges buffers, does not throw, and takes constant time;
+        // otherwise, elements are copied, and this method provides only the
+        // basic exception-safety guarantee.  The behavior is undefined unless
+        // this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this vector, or the 'end' iterator if this vector is
+        // empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // the elements of this vector.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this vector, or 'rend' if this vector is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to the elements of this vector.
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  Throw
+        // 'std::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const VALUE_TYPE *data() const;
+        // Return the address providing non-modifiable access to the first
+        // element of this vector.
+
+    size_type capacity() const;
+        // Return the number of elements this vector can hold without
+        // reallocating its storage, which is at least 'N'.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this vector.
+
+    bool is_inline() const;
+        // Return 'true' if the elements of this vector are held in its inline
+        // buffer, and 'false' if they are held in a buffer obtained from the
+        // allocator.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the number of elements this
+        // vector could hold.
+
+    size_type size() const;
+        // Return the number of elements in this vector.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator==(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects have the same
+    // value if they have the same size, and each element of 'lhs' has the same
+    // value as the element at the same position in 'rhs'.
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator!=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'small_vector' objects do not
+    // have the same value if they do not have the same size, or some element
+    // of 'lhs' does not have the same value as the element at the same
+    // position in 'rhs'.
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator<(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than that of the specified 'rhs' vector, and
+    // 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator>(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than that of the specified 'rhs' vector, and
+    // 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator<=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+bool operator>=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, N, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, N, ALLOCATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  See the
+    // 'swap' method for the complexity and exception-safety guarantees.  The
+    // behavior is undefined unless 'a' and 'b' were created with the same
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace bsl {
+
+                     // ---------------------------------
+                     // class small_vector<...>::Guard
+                     // ---------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::Guard::Guard(
+                                                VALUE_TYPE   *data,
+                                                size_type     capacity,
+                                                small_vector *container)
+: d_data_p(data)
+, d_capacity(capacity)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::Guard::~Guard()
+{
+    if (d_data_p) {
+        d_container_p->deallocateN(d_data_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::Guard::release()
+{
+    d_data_p = 0;
+}
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::growCapacity(size_type newSize,
+                                                     size_type capacity,
+                                                     size_type maxSize)
+{
+    BSLS_ASSERT_SAFE(capacity < newSize);
+    BSLS_ASSERT_SAFE(newSize  <= maxSize);
+
+    while (capacity < newSize) {
+        if (capacity > maxSize / 2) {
+            return maxSize;                                           // RETURN
+        }
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateAdopt(VALUE_TYPE *data,
+                                                          size_type   size,
+                                                          size_type   capacity)
+{
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+    d_dataBegin_p = data;
+    d_dataEnd_p   = data + size;
+    d_capacity    = capacity;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 )
+{
+    // 'count' and 'value' are integral types that just happen to be the same.
+    // They are not iterators, so we call 'insert(position, count, value)'.
+
+    insert(position,
+           static_cast<size_type>(count),
+           static_cast<VALUE_TYPE>(value));
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsertDispatch(
+                                        const_iterator                   first,
+                                        INPUT_ITER                       from,
+                                        INPUT_ITER                       to,
+                                        BloombergLP::bslmf::MatchAnyType ,
+                                        BloombergLP::bslmf::MatchAnyType )
+{
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+    privateInsert(first, from, to, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsert(
+                                      const_iterator                  position,
+                                      INPUT_ITER                      first,
+                                      INPUT_ITER                      last,
+                                      const std::input_iterator_tag&)
+{
+    // The number of elements is not known in advance, so they are first
+    // copied into a temporary vector, from which they are then inserted as a
+    // forward range.
+
+    if (position == end()) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(get_allocator());
+    for (; first != last; ++first) {
+        temp.push_back(*first);
+    }
+    privateInsert(position,
+                  temp.begin(),
+                  temp.end(),
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsert(
+                                    const_iterator                    position,
+                                    FWD_ITER                          first,
+                                    FWD_ITER                          last,
+                                    const std::forward_iterator_tag&)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(position);
+
+    const size_type maxSize     = max_size();
+    const size_type numElements = bsl::distance(first, last);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       numElements > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                "small_vector<...>::insert(pos,first,last): vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+    if (newSize > d_capacity) {
+        const size_type newCapacity = growCapacity(newSize,
+                                                   d_capacity,
+                                                   maxSize);
+        VALUE_TYPE *data = this->allocateN((VALUE_TYPE *)0, newCapacity);
+        Guard guard(data, newCapacity, this);
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       data,
+                                                       &d_dataEnd_p,
+                                                       d_dataBegin_p,
+                                                       pos,
+                                                       d_dataEnd_p,
+                                                       first,
+                                                       last,
+                                                       numElements,
+                                                       this->bslmaAllocator());
+        guard.release();
+        d_dataEnd_p = d_dataBegin_p;
+        privateAdopt(data, newSize, newCapacity);
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd_p,
+                                                     first,
+                                                     last,
+                                                     numElements,
+                                                     this->bslmaAllocator());
+        d_dataEnd_p += numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateReallocate(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(size() <= newCapacity);
+    BSLS_ASSERT_SAFE(N      <= newCapacity);
+
+    const size_type numElements = size();
+
+    VALUE_TYPE *data = N == newCapacity
+                       ? inlineData()
+                       : this->allocateN((VALUE_TYPE *)0, newCapacity);
+    Guard guard(N == newCapacity ? 0 : data, newCapacity, this);
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       data,
+                                                       d_dataBegin_p,
+                                                       d_dataEnd_p,
+                                                       this->bslmaAllocator());
+    guard.release();
+    d_dataEnd_p = d_dataBegin_p;
+    privateAdopt(data, numElements, newCapacity);
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+const VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_buffer.buffer());
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                    const ALLOCATOR& allocator)
+: ContainerBase(allocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                  size_type        initialSize,
+                                                  const ALLOCATOR& allocator)
+: ContainerBase(allocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                 size_type         initialSize,
+                                                 const VALUE_TYPE& value,
+                                                 const ALLOCATOR&  allocator)
+: ContainerBase(allocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    insert(end(), initialSize, value);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                    INPUT_ITER       first,
+                                                    INPUT_ITER       last,
+                                                    const ALLOCATOR& allocator)
+: ContainerBase(allocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    insert(end(), first, last);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                 const small_vector& original)
+: ContainerBase(original)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    privateInsert(end(),
+                  original.begin(),
+                  original.end(),
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                 const small_vector& original,
+                                                 const ALLOCATOR&    allocator)
+: ContainerBase(allocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    privateInsert(end(),
+                  original.begin(),
+                  original.end(),
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::~small_vector()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin_p,
+                                                             d_dataEnd_p);
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>&
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator=(const small_vector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        privateInsert(end(),
+                      rhs.begin(),
+                      rhs.end(),
+                      std::forward_iterator_tag());
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    if (d_dataBegin_p <= &value && &value < d_dataEnd_p) {
+        // 'value' is an element of this vector, and would be destroyed by
+        // 'clear'.
+
+        small_vector temp(numElements, value, get_allocator());
+        swap(temp);
+        return;                                                       // RETURN
+    }
+    clear();
+    insert(end(), numElements, value);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::assign(INPUT_ITER first,
+                                                    INPUT_ITER last)
+{
+    clear();
+    insert(end(), first, last);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::begin()
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::end()
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                               "small_vector<...>::at(n): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::data()
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::clear()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin_p,
+                                                             d_dataEnd_p);
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::erase(const_iterator first,
+                                              const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first   <= last);
+    BSLS_ASSERT_SAFE(last    <= end());
+
+    VALUE_TYPE *from = const_cast<VALUE_TYPE *>(first);
+    VALUE_TYPE *to   = const_cast<VALUE_TYPE *>(last);
+
+    BloombergLP::bslalg::ArrayPrimitives::erase(from,
+                                                to,
+                                                d_dataEnd_p,
+                                                this->bslmaAllocator());
+    d_dataEnd_p -= to - from;
+    return from;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(const_iterator    position,
+                                               const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const size_type index = position - begin();
+    insert(position, size_type(1), value);
+    return begin() + index;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(
+                                                const_iterator    position,
+                                                size_type         numElements,
+                                                const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(position);
+
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                            numElements > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                        "small_vector<...>::insert(pos,n,v): vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+    if (newSize > d_capacity) {
+        const size_type newCapacity = growCapacity(newSize,
+                                                   d_capacity,
+                                                   maxSize);
+        VALUE_TYPE *data = this->allocateN((VALUE_TYPE *)0, newCapacity);
+        Guard guard(data, newCapacity, this);
+
+        // 'destructiveMoveAndInsert' copies 'value' before moving any
+        // element, so 'value' may refer to an element of this vector.
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       data,
+                                                       &d_dataEnd_p,
+                                                       d_dataBegin_p,
+                                                       pos,
+                                                       d_dataEnd_p,
+                                                       value,
+                                                       numElements,
+                                                       this->bslmaAllocator());
+        guard.release();
+        d_dataEnd_p = d_dataBegin_p;
+        privateAdopt(data, newSize, newCapacity);
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd_p,
+                                                     value,
+                                                     numElements,
+                                                     this->bslmaAllocator());
+        d_dataEnd_p += numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(const_iterator position,
+                                                    INPUT_ITER     first,
+                                                    INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    // If 'first' and 'last' are integral, then they are not iterators, but a
+    // count and a value.  The 'bslmf::Nil' argument makes the overload taking
+    // 'bslmf::MatchArithmeticType' the better match in that case.
+
+    privateInsertDispatch(position,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(--d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::push_back(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       d_dataEnd_p,
+                                                       value,
+                                                       this->bslmaAllocator());
+        ++d_dataEnd_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        insert(end(), size_type(1), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::reserve(size_type numElements)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                          "small_vector<...>::reserve(n): vector too long");
+    }
+    if (numElements > d_capacity) {
+        privateReallocate(numElements);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::resize(size_type newSize)
+{
+    const size_type oldSize = size();
+    if (newSize <= oldSize) {
+        erase(d_dataBegin_p + newSize, d_dataEnd_p);
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        reserve(newSize > 2 * d_capacity ? newSize : 2 * d_capacity);
+    }
+    BloombergLP::bslalg::ArrayPrimitives::defaultConstruct(
+                                                       d_dataEnd_p,
+                                                       newSize - oldSize,
+                                                       this->bslmaAllocator());
+    d_dataEnd_p = d_dataBegin_p + newSize;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::resize(size_type         newSize,
+                                                    const VALUE_TYPE& value)
+{
+    const size_type oldSize = size();
+    if (newSize <= oldSize) {
+        erase(d_dataBegin_p + newSize, d_dataEnd_p);
+    }
+    else {
+        insert(end(), newSize - oldSize, value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::shrink_to_fit()
+{
+    if (is_inline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+    privateReallocate(size() <= N ? N : size());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::swap(small_vector& other)
+{
+    BSLS_ASSERT_SAFE(get_allocator() == other.get_allocator());
+
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    if (!is_inline() && !other.is_inline()) {
+        VALUE_TYPE *dataBegin = d_dataBegin_p;
+        VALUE_TYPE *dataEnd   = d_dataEnd_p;
+        size_type   capacity  = d_capacity;
+
+        d_dataBegin_p = other.d_dataBegin_p;
+        d_dataEnd_p   = other.d_dataEnd_p;
+        d_capacity    = other.d_capacity;
+
+        other.d_dataBegin_p = dataBegin;
+        other.d_dataEnd_p   = dataEnd;
+        other.d_capacity    = capacity;
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(*this, get_allocator());
+    *this = other;
+    other = temp;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::begin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::cbegin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::end() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::cend() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                         "small_vector<...>::at(n) const: invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+const VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::data() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, N, ALLOCATOR>::empty() const
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::get_allocator() const
+{
+    return ContainerBase::allocator();
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, N, ALLOCATOR>::is_inline() const
+{
+    return inlineData() == d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::max_size() const
+{
+    return AllocatorTraits::max_size(ContainerBase::allocator());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::size() const
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                    const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                    const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+inline
+void bsl::swap(bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& a,
+               bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'small_vector':
+//: o A 'small_vector' defines STL iterators.
+//: o A 'small_vector' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+//: o A 'small_vector' is *not* bit-wise moveable, since it may refer to its
+//:   own inline buffer.
+
+namespace BloombergLP {
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+struct HasStlIterators<bsl::small_vector<VALUE_TYPE, N, ALLOCATOR> >
+     : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t N, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::small_vector<VALUE_TYPE, N, ALLOCATOR> >
+     : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1288 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a sequence container whose first 'N' elements
+// are held in an inline buffer.  The elements are manipulated by the
+// 'bslalg::ArrayPrimitives' functions, which are tested in their own
+// component, so this test driver concentrates on the management of the two
+// kinds of storage: that no memory is allocated while the elements fit
+// inline, that elements are moved correctly between the inline buffer and
+// allocated buffers, and that every buffer is released, also when an
+// exception is thrown.  'bsl::vector' serves as an oracle for the values.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit small_vector(const ALLOCATOR& allocator);
+// [ 2] explicit small_vector(size_type initialSize, const ALLOCATOR&);
+// [ 2] small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+// [ 2] small_vector(INPUT_ITER first, INPUT_ITER last, const ALLOCATOR&);
+// [ 4] small_vector(const small_vector& original);
+// [ 4] small_vector(const small_vector&, const ALLOCATOR&);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 4] small_vector& operator=(const small_vector& rhs);
+// [ 4] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 4] void assign(INPUT_ITER first, INPUT_ITER last);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] reference operator[](size_type position);
+// [ 2] reference at(size_type position);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+// [ 3] void clear();
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 3] void insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 3] void insert(const_iterator, INPUT_ITER, INPUT_ITER);
+// [ 3] void pop_back();
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 5] void reserve(size_type numElements);
+// [ 5] void resize(size_type newSize);
+// [ 5] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 5] void shrink_to_fit();
+// [ 4] void swap(small_vector& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] const_reference operator[](size_type position) const;
+// [ 2] const_reference at(size_type position) const;
+// [ 2] const_reference front() const;
+// [ 2] const_reference back() const;
+// [ 2] const VALUE_TYPE *data() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] bool is_inline() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const small_vector&, const small_vector&);
+// [ 4] bool operator!=(const small_vector&, const small_vector&);
+// [ 4] bool operator<(const small_vector&, const small_vector&);
+// [ 4] bool operator>(const small_vector&, const small_vector&);
+// [ 4] bool operator<=(const small_vector&, const small_vector&);
+// [ 4] bool operator>=(const small_vector&, const small_vector&);
+// [ 4] void swap(small_vector& a, small_vector& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'small_vector' vs. 'vector'
+// [ 2] CONCERN: The type traits are correctly declared.
+// [ 3] CONCERN: Inserting an element of the vector itself is supported.
+// [ 3] CONCERN: No memory is leaked when an exception is thrown.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::small_vector<int, 4>         Obj;
+typedef bsl::small_vector<bsl::string, 3> StrObj;
+
+static const char *const LONG_STRINGS[] = {
+    // Strings too long for the short-string buffer of 'bsl::string', so that
+    // each copy allocates from the allocator of its container.
+
+    "zero: a string that does not fit in the short buffer",
+    "one: a string that does not fit in the short buffer",
+    "two: a string that does not fit in the short buffer",
+    "three: a string that does not fit in the short buffer",
+    "four: a string that does not fit in the short buffer",
+    "five: a string that does not fit in the short buffer",
+    "six: a string that does not fit in the short buffer",
+    "seven: a string that does not fit in the short buffer",
+};
+const int NUM_LONG_STRINGS = sizeof LONG_STRINGS / sizeof *LONG_STRINGS;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class SMALL_VECTOR, class VECTOR>
+bool isEqual(const SMALL_VECTOR& x, const VECTOR& y)
+    // Return 'true' if the specified 'x' and 'y' hold the same sequence of
+    // values, and 'false' otherwise.
+{
+    if (x.size() != y.size()) {
+        return false;                                                 // RETURN
+    }
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (!(x[i] == y[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class SMALL_VECTOR>
+bool usesAllocator(const SMALL_VECTOR& x, bslma::Allocator *allocator)
+    // Return 'true' if each element of the specified 'x' uses the specified
+    // 'allocator', and 'false' otherwise.
+{
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (x[i].get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+class InputIterator {
+    // This class provides an iterator over an array of 'int' that declares
+    // the input iterator category, so as to exercise the code paths for
+    // single-pass ranges.
+
+    // DATA
+    const int *d_current_p;  // current position
+
+  public:
+    // TYPES
+    typedef std::input_iterator_tag  iterator_category;
+    typedef int                      value_type;
+    typedef std::ptrdiff_t           difference_type;
+    typedef const int               *pointer;
+    typedef const int&               reference;
+
+    // CREATORS
+    explicit InputIterator(const int *current)
+        // Create an iterator referring to the specified 'current' element.
+    : d_current_p(current)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator, and return a reference to it.
+    {
+        ++d_current_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    const int& operator*() const
+        // Return a reference to the element this iterator refers to.
+    {
+        return *d_current_p;
+    }
+
+    bool operator!=(const InputIterator& other) const
+        // Return 'true' if this iterator and the specified 'other' refer to
+        // different elements, and 'false' otherwise.
+    {
+        return d_current_p != other.d_current_p;
+    }
+};
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Tags of a Message
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we decode messages made of tagged fields, and need the list of the
+// tags of each message, which is rarely longer than eight.  We collect the
+// tags in a 'small_vector' with an inline capacity of 8, so that the common
+// case performs no allocation.
+//
+// First, we define a function that appends to a 'small_vector' the tags of a
+// message, given as a string of comma-separated numbers:
+//..
+    typedef bsl::small_vector<int, 8> TagList;
+
+    void collectTags(TagList *tags, const char *message)
+        // Append to the specified 'tags' the numbers in the specified
+        // comma-separated 'message'.
+    {
+        int tag = 0;
+        for (const char *p = message; ; ++p) {
+            if (',' == *p || 0 == *p) {
+                tags->push_back(tag);
+                tag = 0;
+                if (0 == *p) {
+                    break;
+                }
+            }
+            else {
+                tag = tag * 10 + (*p - '0');
+            }
+        }
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we collect the tags of a short message, and observe that no memory
+// is allocated:
+//..
+    bslma::TestAllocator oa("object");
+
+    TagList tags(&oa);
+    collectTags(&tags, "8,9,35,49,56,34,52,10");
+
+    ASSERT(8  == tags.size());
+    ASSERT(35 == tags[2]);
+    ASSERT(0  == oa.numBlocksTotal());
+//..
+// Finally, we collect the tags of a longer message, which spill to a buffer
+// obtained from the allocator:
+//..
+    collectTags(&tags, "11,55,54,38");
+
+    ASSERT(12 == tags.size());
+    ASSERT(38 == tags.back());
+    ASSERT(1  == oa.numBlocksInUse());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RESERVE, RESIZE, AND SHRINK_TO_FIT
+        //
+        // Concerns:
+        //: 1 'reserve' of at most 'N' elements does not allocate, and
+        //:   'reserve' of more moves the elements to an allocated buffer of
+        //:   at least the requested capacity.
+        //:
+        //: 2 'reserve' throws 'std::length_error' if the requested capacity
+        //:   exceeds 'max_size()'.
+        //:
+        //: 3 'resize' appends default-constructed elements or copies of the
+        //:   supplied value, or removes elements at the end.
+        //:
+        //: 4 'shrink_to_fit' moves the elements back into the inline buffer
+        //:   if they fit, and otherwise to a buffer of exactly 'size()'
+        //:   elements, releasing the previous buffer.
+        //
+        // Plan:
+        //: 1 Exercise each method on vectors of 'bsl::string' holding their
+        //:   elements inline and in allocated buffers, and verify the size,
+        //:   the capacity, the values, the allocator of each element, and the
+        //:   memory in use.  (C-1..4)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   void resize(size_type newSize);
+        //   void resize(size_type newSize, const VALUE_TYPE& value);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRESERVE, RESIZE, AND SHRINK_TO_FIT"
+                            "\n==================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\t'reserve'.\n");
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+            mX.push_back(LONG_STRINGS[0]);
+            mX.push_back(LONG_STRINGS[1]);
+
+            const bsls::Types::Int64 B = oa.numBlocksInUse();
+            mX.reserve(3);
+            ASSERTV(X.is_inline());
+            ASSERTV(3 == X.capacity());
+            ASSERTV(B == oa.numBlocksInUse());
+
+            mX.reserve(10);
+            ASSERTV(!X.is_inline());
+            ASSERTV(10 == X.capacity());
+            ASSERTV(B + 1 == oa.numBlocksInUse());
+            ASSERTV(2 == X.size());
+            ASSERTV(LONG_STRINGS[0] == X[0]);
+            ASSERTV(LONG_STRINGS[1] == X[1]);
+            ASSERTV(usesAllocator(X, &oa));
+
+            mX.reserve(5);
+            ASSERTV(10 == X.capacity());
+
+            bool caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+            ASSERTV(2 == X.size());
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'resize'.\n");
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+            bsl::vector<bsl::string> exp;
+
+            for (int n = 0; n < 12; ++n) {
+                if (veryVerbose) { T_ P(n) }
+
+                const bsl::string value(LONG_STRINGS[n % NUM_LONG_STRINGS]);
+                const std::size_t size = (n * 5) % 9;
+
+                mX.resize(size, value);
+                exp.resize(size, value);
+                ASSERTV(n, isEqual(X, exp));
+                ASSERTV(n, usesAllocator(X, &oa));
+
+                mX.resize(size + 1);
+                exp.resize(size + 1);
+                ASSERTV(n, isEqual(X, exp));
+                ASSERTV(n, X.back().empty());
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'shrink_to_fit'.\n");
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+            mX.shrink_to_fit();
+            ASSERTV(X.is_inline());
+            ASSERTV(3 == X.capacity());
+
+            for (int i = 0; i < 6; ++i) {
+                mX.push_back(LONG_STRINGS[i]);
+            }
+            ASSERTV(!X.is_inline());
+            ASSERTV(6 <= X.capacity());
+
+            mX.reserve(20);
+            mX.shrink_to_fit();
+            ASSERTV(!X.is_inline());
+            ASSERTV(6 == X.capacity());
+            ASSERTV(6 == X.size());
+
+            mX.erase(X.begin() + 1, X.end() - 1);
+            ASSERTV(2 == X.size());
+
+            const bsls::Types::Int64 B = oa.numBlocksInUse();
+            mX.shrink_to_fit();
+            ASSERTV(X.is_inline());
+            ASSERTV(3 == X.capacity());
+            ASSERTV(B - 1 == oa.numBlocksInUse());
+            ASSERTV(LONG_STRINGS[0] == X[0]);
+            ASSERTV(LONG_STRINGS[5] == X[1]);
+            ASSERTV(usesAllocator(X, &oa));
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original, and holds its elements
+        //:   inline exactly if they fit.  The copy uses the default allocator
+        //:   unless another is supplied.
+        //:
+        //: 2 Assignment and 'assign' give the target the expected value, for
+        //:   each combination of inline and allocated storage, and also when
+        //:   the value to assign is an element of the target.
+        //:
+        //: 3 'swap' exchanges values for each combination of inline and
+        //:   allocated storage, and exchanges buffers without allocating when
+        //:   neither vector is inline.
+        //:
+        //: 4 The comparison operators implement lexicographic comparison.
+        //
+        // Plan:
+        //: 1 For vectors of 'bsl::string' of each size from 0 to 6 (the
+        //:   inline capacity being 3), copy, assign, and swap each pair, and
+        //:   verify the values and the allocator of each element against
+        //:   'bsl::vector'.  (C-1..3)
+        //:
+        //: 2 Compare vectors of 'int' of each pair of values in a table
+        //:   against the result for 'bsl::vector'.  (C-4)
+        //
+        // Testing:
+        //   small_vector(const small_vector& original);
+        //   small_vector(const small_vector&, const ALLOCATOR&);
+        //   small_vector& operator=(const small_vector& rhs);
+        //   void assign(size_type numElements, const VALUE_TYPE& value);
+        //   void assign(INPUT_ITER first, INPUT_ITER last);
+        //   void swap(small_vector& other);
+        //   bool operator==(const small_vector&, const small_vector&);
+        //   bool operator!=(const small_vector&, const small_vector&);
+        //   bool operator<(const small_vector&, const small_vector&);
+        //   bool operator>(const small_vector&, const small_vector&);
+        //   bool operator<=(const small_vector&, const small_vector&);
+        //   bool operator>=(const small_vector&, const small_vector&);
+        //   void swap(small_vector& a, small_vector& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n======================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int MAX_SIZE = 6;
+
+        if (verbose) printf("\tCopy construction.\n");
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            const bsl::vector<bsl::string> EXP(LONG_STRINGS,
+                                               LONG_STRINGS + i,
+                                               &oa);
+            const StrObj X(EXP.begin(), EXP.end(), &oa);
+
+            {
+                const StrObj Y(X);
+                ASSERTV(i, isEqual(Y, EXP));
+                ASSERTV(i, (i <= 3) == Y.is_inline());
+                ASSERTV(i, &da == Y.get_allocator().mechanism());
+                ASSERTV(i, usesAllocator(Y, &da));
+            }
+            {
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                const StrObj Y(X, &sa);
+                ASSERTV(i, isEqual(Y, EXP));
+                ASSERTV(i, usesAllocator(Y, &sa));
+                ASSERTV(i, (0 == i) == (0 == sa.numBlocksTotal()));
+            }
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tAssignment and swap.\n");
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            const bsl::vector<bsl::string> EXPI(LONG_STRINGS,
+                                                LONG_STRINGS + i,
+                                                &oa);
+            for (int j = 0; j <= MAX_SIZE; ++j) {
+                if (veryVerbose) { T_ P_(i) P(j) }
+
+                const bsl::vector<bsl::string> EXPJ(
+                                                LONG_STRINGS + MAX_SIZE - j,
+                                                LONG_STRINGS + MAX_SIZE,
+                                                &oa);
+                {
+                    StrObj mX(EXPI.begin(), EXPI.end(), &oa);
+                    const StrObj& X = mX;
+                    const StrObj Y(EXPJ.begin(), EXPJ.end(), &oa);
+
+                    StrObj *mR = &(mX = Y);
+                    ASSERTV(i, j, mR == &mX);
+                    ASSERTV(i, j, isEqual(X, EXPJ));
+                    ASSERTV(i, j, usesAllocator(X, &oa));
+
+                    mX = X;
+                    ASSERTV(i, j, isEqual(X, EXPJ));
+                }
+                {
+                    StrObj mX(EXPI.begin(), EXPI.end(), &oa);
+                    const StrObj& X = mX;
+
+                    mX.assign(EXPJ.begin(), EXPJ.end());
+                    ASSERTV(i, j, isEqual(X, EXPJ));
+                    ASSERTV(i, j, usesAllocator(X, &oa));
+
+                    mX.assign(j, LONG_STRINGS[7]);
+                    ASSERTV(i, j, isEqual(X, bsl::vector<bsl::string>(
+                                                         j, LONG_STRINGS[7])));
+                    if (j) {
+                        mX.assign(i, X.back());
+                        ASSERTV(i, j, isEqual(X, bsl::vector<bsl::string>(
+                                                         i, LONG_STRINGS[7])));
+                    }
+                }
+                {
+                    StrObj mX(EXPI.begin(), EXPI.end(), &oa);
+                    const StrObj& X = mX;
+                    StrObj mY(EXPJ.begin(), EXPJ.end(), &oa);
+                    const StrObj& Y = mY;
+
+                    const bool inlineX = X.is_inline();
+                    const bool inlineY = Y.is_inline();
+                    const bsls::Types::Int64 B = oa.numBlocksTotal();
+
+                    mX.swap(mY);
+                    ASSERTV(i, j, isEqual(X, EXPJ));
+                    ASSERTV(i, j, isEqual(Y, EXPI));
+                    ASSERTV(i, j, usesAllocator(X, &oa));
+                    ASSERTV(i, j, usesAllocator(Y, &oa));
+                    if (!inlineX && !inlineY) {
+                        ASSERTV(i, j, B == oa.numBlocksTotal());
+                    }
+
+                    swap(mX, mY);
+                    ASSERTV(i, j, isEqual(X, EXPI));
+                    ASSERTV(i, j, isEqual(Y, EXPJ));
+
+                    mX.swap(mX);
+                    ASSERTV(i, j, isEqual(X, EXPI));
+                }
+            }
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                { L_, ""        },
+                { L_, "A"       },
+                { L_, "AA"      },
+                { L_, "AB"      },
+                { L_, "ABC"     },
+                { L_, "ABCD"    },
+                { L_, "ABCDE"   },
+                { L_, "ABCDF"   },
+                { L_, "B"       },
+                { L_, "BAAAAAA" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *const SPECI = DATA[ti].d_spec;
+                const Obj X(SPECI, SPECI + strlen(SPECI), &oa);
+                const bsl::vector<int> EXPX(SPECI, SPECI + strlen(SPECI));
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const SPECJ = DATA[tj].d_spec;
+                    const Obj Y(SPECJ, SPECJ + strlen(SPECJ), &oa);
+                    const bsl::vector<int> EXPY(SPECJ, SPECJ + strlen(SPECJ));
+
+                    ASSERTV(ti, tj, (EXPX == EXPY) == (X == Y));
+                    ASSERTV(ti, tj, (EXPX != EXPY) == (X != Y));
+                    ASSERTV(ti, tj, (EXPX <  EXPY) == (X <  Y));
+                    ASSERTV(ti, tj, (EXPX >  EXPY) == (X >  Y));
+                    ASSERTV(ti, tj, (EXPX <= EXPY) == (X <= Y));
+                    ASSERTV(ti, tj, (EXPX >= EXPY) == (X >= Y));
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT AND ERASE
+        //
+        // Concerns:
+        //: 1 Each form of 'insert' and 'erase' gives the same sequence as the
+        //:   same operation on 'bsl::vector', at each position, and both while
+        //:   the elements are inline and once they have spilled.
+        //:
+        //: 2 Inserting an element of the vector itself is supported, also
+        //:   when the insertion moves the elements to a new buffer.
+        //:
+        //: 3 Inserting a range of input iterators is supported.
+        //:
+        //: 4 Each element uses the allocator of the vector.
+        //:
+        //: 5 No memory is leaked when an exception is thrown, and the vector
+        //:   is left in a valid state.
+        //
+        // Plan:
+        //: 1 For vectors of 'bsl::string' of each size from 0 to 6, insert and
+        //:   erase at each position, and compare with 'bsl::vector'.
+        //:   (C-1, 4)
+        //:
+        //: 2 Insert copies of each element of the vector into itself.  (C-2)
+        //:
+        //: 3 Insert and construct from ranges of an iterator type declaring
+        //:   the input iterator category.  (C-3)
+        //:
+        //: 4 Repeat the insertions in the 'bslma' exception test loop, and
+        //:   verify that no memory is in use afterwards.  (C-5)
+        //
+        // Testing:
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+        //   void insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   void insert(const_iterator, INPUT_ITER, INPUT_ITER);
+        //   void pop_back();
+        //   CONCERN: Inserting an element of the vector itself is supported.
+        //   CONCERN: No memory is leaked when an exception is thrown.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT AND ERASE"
+                            "\n================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int MAX_SIZE = 6;
+
+        if (verbose) printf("\tInsert and erase at each position.\n");
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            for (int pos = 0; pos <= i; ++pos) {
+                for (int n = 0; n <= 4; ++n) {
+                    if (veryVerbose) { T_ P_(i) P_(pos) P(n) }
+
+                    const bsl::string VALUE(LONG_STRINGS[7]);
+
+                    bsl::vector<bsl::string> exp(LONG_STRINGS,
+                                                 LONG_STRINGS + i,
+                                                 &oa);
+                    StrObj mX(exp.begin(), exp.end(), &oa);
+                    const StrObj& X = mX;
+
+                    mX.insert(X.begin() + pos, n, VALUE);
+                    exp.insert(exp.begin() + pos, n, VALUE);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+                    ASSERTV(i, pos, n, usesAllocator(X, &oa));
+                    ASSERTV(i, pos, n, (i + n <= 3) == X.is_inline());
+
+                    StrObj::iterator it = mX.insert(X.begin() + pos, VALUE);
+                    exp.insert(exp.begin() + pos, VALUE);
+                    ASSERTV(i, pos, n, X.begin() + pos == it);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+
+                    mX.insert(X.begin() + pos,
+                              LONG_STRINGS,
+                              LONG_STRINGS + n);
+                    exp.insert(exp.begin() + pos,
+                               LONG_STRINGS,
+                               LONG_STRINGS + n);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+                    ASSERTV(i, pos, n, usesAllocator(X, &oa));
+
+                    it = mX.erase(X.begin() + pos);
+                    exp.erase(exp.begin() + pos);
+                    ASSERTV(i, pos, n, X.begin() + pos == it);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+
+                    const int numErase = n <= i - pos ? n : i - pos;
+                    it = mX.erase(X.begin() + pos,
+                                  X.begin() + pos + numErase);
+                    exp.erase(exp.begin() + pos,
+                              exp.begin() + pos + numErase);
+                    ASSERTV(i, pos, n, X.begin() + pos == it);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+
+                    if (!X.empty()) {
+                        mX.pop_back();
+                        exp.pop_back();
+                        ASSERTV(i, pos, n, isEqual(X, exp));
+                    }
+
+                    const std::size_t CAPACITY = X.capacity();
+                    mX.clear();
+                    ASSERTV(i, pos, n, X.empty());
+                    ASSERTV(i, pos, n, CAPACITY == X.capacity());
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tInsert an element of the vector itself.\n");
+        for (int i = 1; i <= MAX_SIZE; ++i) {
+            for (int src = 0; src < i; ++src) {
+                for (int pos = 0; pos <= i; ++pos) {
+                    for (int n = 1; n <= 4; ++n) {
+                        if (veryVerbose) { T_ P_(i) P_(src) P_(pos) P(n) }
+
+                        bsl::vector<bsl::string> exp(LONG_STRINGS,
+                                                     LONG_STRINGS + i,
+                                                     &oa);
+                        StrObj mX(exp.begin(), exp.end(), &oa);
+                        const StrObj& X = mX;
+
+                        mX.insert(X.begin() + pos, n, X[src]);
+                        exp.insert(exp.begin() + pos, n, exp[src]);
+                        ASSERTV(i, src, pos, n, isEqual(X, exp));
+
+                        mX.insert(X.begin() + pos, X[src]);
+                        exp.insert(exp.begin() + pos, exp[src]);
+                        ASSERTV(i, src, pos, n, isEqual(X, exp));
+
+                        mX.push_back(X[src]);
+                        exp.push_back(exp[src]);
+                        ASSERTV(i, src, pos, n, isEqual(X, exp));
+                    }
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tInsert a range of input iterators.\n");
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            for (int pos = 0; pos <= i; ++pos) {
+                for (int n = 0; n <= 6; ++n) {
+                    if (veryVerbose) { T_ P_(i) P_(pos) P(n) }
+
+                    static const int VALUES[] = { 0, 1, 2, 3, 4, 5 };
+
+                    bsl::vector<int> exp(i, -1);
+                    Obj mX(exp.begin(), exp.end(), &oa);  const Obj& X = mX;
+
+                    mX.insert(X.begin() + pos,
+                              InputIterator(VALUES),
+                              InputIterator(VALUES + n));
+                    exp.insert(exp.begin() + pos, VALUES, VALUES + n);
+                    ASSERTV(i, pos, n, isEqual(X, exp));
+
+                    const Obj Y(InputIterator(VALUES),
+                                InputIterator(VALUES + n),
+                                &oa);
+                    ASSERTV(i, pos, n, isEqual(Y, bsl::vector<int>(
+                                                           VALUES,
+                                                           VALUES + n)));
+                }
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tException safety.\n");
+        for (int i = 0; i <= MAX_SIZE; ++i) {
+            for (int n = 1; n <= 4; ++n) {
+                if (veryVerbose) { T_ P_(i) P(n) }
+
+                StrObj mX(LONG_STRINGS, LONG_STRINGS + i, &oa);
+                const StrObj& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX.insert(X.begin() + i / 2,
+                              LONG_STRINGS,
+                              LONG_STRINGS + n);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, n, (std::size_t)(i + n) == X.size());
+                ASSERTV(i, n, usesAllocator(X, &oa));
+            }
+            ASSERTV(i, 0 == oa.numBlocksInUse());
+        }
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, ACCESSORS, AND INLINE STORAGE
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector of the expected value, using
+        //:   the supplied allocator, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 No memory is allocated while the vector holds at most 'N'
+        //:   elements, and the elements are held in the object itself.
+        //:
+        //: 3 Growing beyond 'N' elements moves them to a single allocated
+        //:   buffer, whose capacity grows geometrically, and the destructor
+        //:   releases it.
+        //:
+        //: 4 The range constructor given two integers creates that number of
+        //:   copies of a value.
+        //:
+        //: 5 The accessors and iterators refer to the elements, and 'at'
+        //:   throws 'std::out_of_range' for an invalid position.
+        //:
+        //: 6 The type traits are correctly declared; in particular, the type
+        //:   is not bit-wise moveable.
+        //
+        // Plan:
+        //: 1 Create vectors with each constructor and verify their value,
+        //:   allocator, and memory use.  (C-1, 4)
+        //:
+        //: 2 Append elements one by one, verifying after each that memory is
+        //:   allocated only when the size exceeds 'N', and that the number of
+        //:   reallocations is logarithmic.  (C-2..3)
+        //:
+        //: 3 Verify each accessor against the expected values.  (C-5)
+        //:
+        //: 4 Verify the type traits with 'BSLMF_ASSERT'.  (C-6)
+        //
+        // Testing:
+        //   explicit small_vector(const ALLOCATOR& allocator);
+        //   explicit small_vector(size_type initialSize, const ALLOCATOR&);
+        //   small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+        //   small_vector(INPUT_ITER first, INPUT_ITER last, const ALLOCATOR&);
+        //   ~small_vector();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_type position);
+        //   reference at(size_type position);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   void push_back(const VALUE_TYPE& value);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   const_reference operator[](size_type position) const;
+        //   const_reference at(size_type position) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   const VALUE_TYPE *data() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   allocator_type get_allocator() const;
+        //   bool is_inline() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   CONCERN: The type traits are correctly declared.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS, ACCESSORS, AND INLINE STORAGE"
+                            "\n===========================================\n");
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<int *, Obj::iterator>::value));
+        BSLMF_ASSERT((bsl::is_same<const int *, Obj::const_iterator>::value));
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tDefault constructor.\n");
+        {
+            const Obj X;
+            ASSERTV(X.empty());
+            ASSERTV(0 == X.size());
+            ASSERTV(4 == X.capacity());
+            ASSERTV(X.is_inline());
+            ASSERTV(X.begin() == X.end());
+            ASSERTV(&da == X.get_allocator().mechanism());
+            ASSERTV((const void *)X.data() >= (const void *)&X);
+            ASSERTV((const void *)X.data() <  (const void *)(&X + 1));
+            ASSERTV(0 < X.max_size());
+
+            const Obj Y(&oa);
+            ASSERTV(&oa == Y.get_allocator().mechanism());
+        }
+        ASSERTV(0 == da.numBlocksTotal());
+        ASSERTV(0 == oa.numBlocksTotal());
+
+        if (verbose) printf("\tValue constructors.\n");
+        {
+            const Obj X(3, &oa);
+            ASSERTV(isEqual(X, bsl::vector<int>(3)));
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            const Obj Y(4, 7, &oa);
+            ASSERTV(isEqual(Y, bsl::vector<int>(4, 7)));
+            ASSERTV(Y.is_inline());
+            ASSERTV(0 == oa.numBlocksTotal());
+
+            const Obj Z(9, 7, &oa);
+            ASSERTV(isEqual(Z, bsl::vector<int>(9, 7)));
+            ASSERTV(!Z.is_inline());
+            ASSERTV(1 == oa.numBlocksInUse());
+
+            // Two integers select the count-and-value overload.
+
+            const Obj W(5, 2);
+            ASSERTV(isEqual(W, bsl::vector<int>(5, 2)));
+
+            const StrObj S(2, LONG_STRINGS[0], &oa);
+            ASSERTV(2 == S.size());
+            ASSERTV(usesAllocator(S, &oa));
+
+            bool caught = false;
+            try {
+                const StrObj T(S.max_size() + 1, LONG_STRINGS[0], &oa);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERTV(caught);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tInline storage and growth.\n");
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+            bsl::vector<bsl::string> exp;
+
+            int numBuffers = 0;
+            for (int i = 0; i < 64; ++i) {
+                const std::size_t CAPACITY = X.capacity();
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+
+                mX.push_back(LONG_STRINGS[i % NUM_LONG_STRINGS]);
+                exp.push_back(LONG_STRINGS[i % NUM_LONG_STRINGS]);
+
+                // One block for the string, and one if the buffer grew.
+
+                const bsls::Types::Int64 NUM_NEW = oa.numBlocksTotal() - B;
+                ASSERTV(i, isEqual(X, exp));
+                ASSERTV(i, (i < 3) == X.is_inline());
+                if (i < 3) {
+                    ASSERTV(i, 1 == NUM_NEW);
+                    ASSERTV(i, 3 == X.capacity());
+                }
+                else if (CAPACITY == X.capacity()) {
+                    ASSERTV(i, 1 == NUM_NEW);
+                }
+                else {
+                    ++numBuffers;
+                    ASSERTV(i, 2 == NUM_NEW);
+                    ASSERTV(i, 2 * CAPACITY == X.capacity());
+                }
+                ASSERTV(i, i + 1 + !X.is_inline() == oa.numBlocksInUse());
+            }
+            ASSERTV(numBuffers, 5 == numBuffers);
+            ASSERTV(usesAllocator(X, &oa));
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tRange constructor.\n");
+        for (int i = 0; i <= NUM_LONG_STRINGS; ++i) {
+            const bsls::Types::Int64 B = oa.numBlocksTotal();
+            {
+                const StrObj X(LONG_STRINGS, LONG_STRINGS + i, &oa);
+                ASSERTV(i, i == (int)X.size());
+                ASSERTV(i, (i <= 3) == X.is_inline());
+                ASSERTV(i, i + (i > 3) == oa.numBlocksTotal() - B);
+                for (int j = 0; j < i; ++j) {
+                    ASSERTV(i, j, LONG_STRINGS[j] == X[j]);
+                }
+            }
+            ASSERTV(i, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAccessors.\n");
+        for (int i = 1; i <= 8; ++i) {
+            int values[8] = { 10, 11, 12, 13, 14, 15, 16, 17 };
+
+            Obj mX(values, values + i, &oa);  const Obj& X = mX;
+
+            ASSERTV(i, 10 == X.front());
+            ASSERTV(i, 9 + i == X.back());
+            ASSERTV(i, X.data() == &X[0]);
+            ASSERTV(i, X.data() == X.begin());
+            ASSERTV(i, X.begin() == X.cbegin());
+            ASSERTV(i, X.end() == X.cend());
+            ASSERTV(i, i == X.end() - X.begin());
+            ASSERTV(i, X.rbegin() == X.crbegin());
+            ASSERTV(i, X.rend() == X.crend());
+            ASSERTV(i, 9 + i == *X.rbegin());
+            ASSERTV(i, 10 == *(X.rend() - 1));
+
+            for (int j = 0; j < i; ++j) {
+                ASSERTV(i, j, values[j] == X[j]);
+                ASSERTV(i, j, values[j] == X.at(j));
+                mX[j] += 10;
+                mX.at(j) += 10;
+            }
+            ASSERTV(i, 30 == X[0]);
+
+            mX.front() = 1;
+            mX.back()  = 2;
+            *mX.data() += 1;
+            *mX.begin() += 1;
+            *(mX.end() - 1) += 1;
+            *mX.rbegin() += 1;
+            *(mX.rend() - 1) += 1;
+            ASSERTV(i, (1 == i ? 7 : 4) == X.front());
+            ASSERTV(i, (1 == i ? 7 : 4) == X.back());
+
+            bool caught = false;
+            try {
+                X.at(i);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(i, caught);
+
+            caught = false;
+            try {
+                mX.at(i);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERTV(i, caught);
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Apply a sequence of operations to a 'small_vector' and a
+        //:   'bsl::vector', and compare their values after each.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        bsl::vector<int> exp;
+
+        for (int i = 0; i < 4; ++i) {
+            mX.push_back(i);
+            exp.push_back(i);
+        }
+        ASSERTV(isEqual(X, exp));
+        ASSERTV(X.is_inline());
+        ASSERTV(0 == oa.numBlocksTotal());
+
+        mX.insert(X.begin() + 1, 3, 9);
+        exp.insert(exp.begin() + 1, 3, 9);
+        ASSERTV(isEqual(X, exp));
+        ASSERTV(!X.is_inline());
+        ASSERTV(1 == oa.numBlocksInUse());
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERTV(X == Y);
+
+        mX.erase(X.begin(), X.begin() + 5);
+        exp.erase(exp.begin(), exp.begin() + 5);
+        ASSERTV(isEqual(X, exp));
+        ASSERTV(X != Y);
+
+        mX.shrink_to_fit();
+        ASSERTV(X.is_inline());
+        ASSERTV(isEqual(X, exp));
+
+        mX.swap(mY);
+        ASSERTV(7 == X.size());
+        ASSERTV(2 == Y.size());
+
+        if (veryVerbose) {
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                T_ P(*it)
+            }
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'small_vector' vs. 'vector'
+        //
+        // Concerns:
+        //: 1 Building many short sequences is faster with 'small_vector' than
+        //:   with 'bsl::vector', since no memory is allocated.
+        //
+        // Plan:
+        //: 1 Time the creation, filling, and destruction of many short
+        //:   sequences of 'int' with each container, using the default
+        //:   allocator, and report the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'small_vector' vs. 'vector'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'small_vector' vs. 'vector'"
+                            "\n========================================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        for (int length = 2; length <= 32; length *= 2) {
+            bsls::Stopwatch timer;
+            int             sum = 0;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bsl::vector<int> v;
+                for (int j = 0; j < length; ++j) {
+                    v.push_back(i + j);
+                }
+                sum += v.back();
+            }
+            timer.stop();
+            const double vectorTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bsl::small_vector<int, 16> v;
+                for (int j = 0; j < length; ++j) {
+                    v.push_back(i + j);
+                }
+                sum -= v.back();
+            }
+            timer.stop();
+            const double smallVectorTime = timer.elapsedTime();
+
+            ASSERTV(0 == sum);
+            printf("length %2d: vector %.3fs, small_vector<int, 16> %.3fs\n",
+                   length,
+                   vectorTime,
+                   smallVectorTime);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2016 Bloomberg Finance L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -573,10 +573,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BYTEHASHUTIL
+#include <bslalg_bytehashutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONTAINERBASE
 #include <bslalg_containerbase.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_HASH
 #include <bslstl_hash.h>
 #endif
@@ -597,6 +605,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_scalarprimitives.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_STRINGSEARCHUTIL
+#include <bslalg_stringsearchutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
 #include <bslalg_typetraithasstliterators.h>
 #endif
@@ -692,75 +704,6 @@ namespace bsl {
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
 class basic_string;
 
-#if defined(BSLS_PLATFORM_CMP_SUN) || defined(BSLS_PLATFORM_CMP_HP)
-template <class ORIGINAL_TRAITS>
-class String_Traits {
-    // This 'class' provides an implementation of the 'find' function for the
-    // parameterized 'ORIGINAL_TRAITS' type.  This is an alternate
-    // representation for Sun's 'char_traits::find' that returns an incorrect
-    // result for character types other than 'char' (such as 'wchar').
-
-    // PRIVATE TYPES
-    typedef typename ORIGINAL_TRAITS::char_type char_type;
-    typedef native_std::size_t                  size_type;
-
-  public:
-    // CLASS METHODS
-    static const char_type *find(const char_type  *s,
-                                 size_type         n,
-                                 const char_type&  a);
-        // Return an address providing non-modifiable access to the first
-        // character that matches the specified character 'a' in the specified
-        // 'n' characters of the specified 's' string.
-};
-
-template <>
-class String_Traits<native_std::char_traits<char> > {
-    // Sun implemented 'find' for 'char' properly, so this specialization
-    // simply forwards the call to Sun.
-
-    // PRIVATE TYPES
-    typedef native_std::size_t size_type;
-
-  public:
-    // CLASS METHODS
-    static const char *find(const char *s, size_type n, const char& a);
-        // Return an address providing non-modifiable access to the first
-        // character that matches the specified character 'a' in the specified
-        // 'n' characters of the specified 's' string.
-};
-
-// CLASS METHODS
-template <class ORIGINAL_TRAITS>
-const typename ORIGINAL_TRAITS::char_type *
-String_Traits<ORIGINAL_TRAITS>::find(const char_type  *s,
-                                     size_type         n,
-                                     const char_type&  a)
-{
-    while (n > 0 && !ORIGINAL_TRAITS::eq(*s, a)) {
-        --n;
-        ++s;
-    }
-    return n > 0 ? s : 0;
-}
-
-inline
-const char *
-String_Traits<native_std::char_traits<char> >::find(const char  *s,
-                                                    size_type    n,
-                                                    const char&  a)
-{
-    return native_std::char_traits<char>::find(s, n, a);
-}
-
-#define BSLSTL_CHAR_TRAITS String_Traits<CHAR_TRAITS>
-
-#else
-
-#define BSLSTL_CHAR_TRAITS CHAR_TRAITS
-
-#endif
-
                         // ================
                         // class String_Imp
                         // ================
@@ -2340,7 +2283,10 @@ getline(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&     is,
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::size_t
 hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str);
-    // Return a hash value for the specified 'str'.
+    // Return a hash value for the specified 'str', computed from the bytes
+    // of its characters by 'bslalg::ByteHashUtil::hash'.  Note that a
+    // 'bslstl::StringRef' bound to the same characters has the same hash
+    // value.
 
 std::size_t hashBasicString(const string& str);
     // Return a hash value for the specified 'str'.
@@ -2348,6 +2294,15 @@ std::size_t hashBasicString(const string& str);
 std::size_t hashBasicString(const wstring& str);
     // Return a hash value for the specified 'str'.
 
+template <class HASHALG, class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+void hashAppend(HASHALG&                                               hashAlg,
+                const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& input);
+    // Pass the specified 'input' string to the specified 'hashAlg': the bytes
+    // of its characters, followed by its length (as a 'std::size_t').  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').  Note that 'hashAppend' for a
+    // 'bslstl::StringRef' bound to the same characters passes the same bytes.
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 struct hash<basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR> >
     // Specialization of 'hash' for 'basic_string'.
@@ -4473,26 +4428,16 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(
 {
     BSLS_ASSERT_SAFE(string);
 
-    size_type remChars = length() - position;
-    if (position > length() || numChars > remChars) {
+    if (position > length() || numChars > length() - position) {
         return npos;                                                  // RETURN
     }
-    if (0 == numChars) {
-        return position;                                              // RETURN
-    }
-    const CHAR_TYPE *thisString = this->dataPtr() + position;
-    const CHAR_TYPE *nextString;
-    for (remChars -= numChars - 1;
-         0 != (nextString = BSLSTL_CHAR_TRAITS::find(thisString,
-                                                     remChars,
-                                                     *string));
-         remChars -= ++nextString - thisString, thisString = nextString)
-    {
-        if (0 == CHAR_TRAITS::compare(nextString, string, numChars)) {
-            return nextString - this->dataPtr();                      // RETURN
-        }
-    }
-    return npos;
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::find(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   string,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4515,9 +4460,11 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(CHAR_TYPE character,
         return npos;                                                  // RETURN
     }
     const CHAR_TYPE *result =
-        BSLSTL_CHAR_TRAITS::find(this->dataPtr() + position,
-                                 length() - position,
-                                 character);
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::find(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   &character,
+                                                   size_type(1));
     return result ? result - this->dataPtr() : npos;
 }
 
@@ -4542,20 +4489,23 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::rfind(
     if (0 == numChars) {
         return position > length() ? length() : position;             // RETURN
     }
-    if (numChars <= length()) {
-        if (position > length() - numChars) {
-            position = length() - numChars;
-        }
-        const CHAR_TYPE *thisString = this->dataPtr() + position;
-        for (; position != npos; --thisString, --position) {
-            if (0 == CHAR_TRAITS::compare(thisString,
-                                          characterString,
-                                          numChars)) {
-                return position;                                      // RETURN
-            }
-        }
+    if (numChars > length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    if (position > length() - numChars) {
+        position = length() - numChars;
+    }
+
+    // Search the characters in which an occurrence starting at or before
+    // 'position' may lie.
+
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::findLast(
+                                                        this->dataPtr(),
+                                                        position + numChars,
+                                                        characterString,
+                                                        numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4597,18 +4547,16 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < numChars && position < length()) {
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != this->dataPtr() + length();
-             ++current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(characterString, numChars, *current)
-                != 0) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (position >= length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::findFirstOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4651,22 +4599,18 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < numChars && 0 < length()) {
-        size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             ;
-             --current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-            if (current == this->dataPtr()) {
-                break;
-            }
-        }
+    if (0 == length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const size_type numSearched = position < length() ? position + 1
+                                                      : length();
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::findLastOf(
+                                                              this->dataPtr(),
+                                                              numSearched,
+                                                              characterString,
+                                                              numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4709,19 +4653,16 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_not_of(
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (position < length()) {
-        const CHAR_TYPE *last = this->dataPtr() + length();
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != last;
-             ++current)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (position >= length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::findFirstNotOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -4764,19 +4705,18 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_not_of (
 {
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
-    if (0 < length()) {
-        size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             remChars != npos;
-             --current, --remChars)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-        }
+    if (0 == length()) {
+        return npos;                                                  // RETURN
     }
-    return npos;
+    const size_type numSearched = position < length() ? position + 1
+                                                      : length();
+    const CHAR_TYPE *result =
+          BloombergLP::bslalg::StringSearchUtil<CHAR_TRAITS>::findLastNotOf(
+                                                              this->dataPtr(),
+                                                              numSearched,
+                                                              characterString,
+                                                              numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <typename CHAR_TYPE, typename CHAR_TRAITS, typename ALLOCATOR>
@@ -5497,18 +5437,20 @@ template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::size_t
 hashBasicString(const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str)
 {
-    unsigned long hashValue = 0;
-    typedef typename basic_string<CHAR_TYPE,
-                              CHAR_TRAITS, ALLOCATOR>::const_pointer const_ptr;
-
-    std::size_t  len  = str.size();
-    const_ptr    data = str.data();
-
-    for (std::size_t i = 0; i < len; ++i) {
-        hashValue = 5 * hashValue + data[i];
-    }
+    return static_cast<std::size_t>(
+                 BloombergLP::bslalg::ByteHashUtil::hash(
+                                              str.data(),
+                                              str.size() * sizeof(CHAR_TYPE)));
+}
 
-    return std::size_t(hashValue);
+template <class HASHALG, class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+void hashAppend(HASHALG&                                               hashAlg,
+                const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAlg(input.data(), sizeof(CHAR_TYPE) * input.size());
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
 }
 
 }  // close namespace bsl
@@ -5555,8 +5497,6 @@ struct UsesBslmaAllocator<bsl::basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOC> >
 
 }  // close enterprise namespace
 
-#undef BSLSTL_CHAR_TRAITS
-
 #ifdef BSLS_COMPILERFEATURES_SUPPORT_EXTERN_TEMPLATE
 extern template class bsl::String_Imp<char, bsl::string::size_type>;
 extern template class bsl::String_Imp<wchar_t, bsl::wstring::size_type>;
@@ -5,6 +5,8 @@
 #include <bslstl_allocator.h>
 #include <bslstl_forwarditerator.h>
 
+#include <bslh_defaulthashalgorithm.h>     // for testing only
+#include <bslh_hash.h>                     // for testing only
 #include <bslma_allocator.h>               // for testing only
 #include <bslma_default.h>                 // for testing only
 #include <bslma_defaultallocatorguard.h>   // for testing only
@@ -242,6 +244,7 @@ using namespace std;
 // [24] bool operator>=(const C *, const string&);
 // [24] bool operator>=(const string&, const C *);
 // [21] void swap(string&, string&);
+// [30] void hashAppend(HASHALG& hashAlg, const string& input);
 // [ 5] basic_ostream<C,CT>& operator<<(basic_ostream<C,CT>& stream,
 //                                      const string& str);
 // [ 5] basic_istream<C,CT>& operator>>(basic_istream<C,CT>& stream,
@@ -13893,6 +13896,118 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the characters of the string as a single
+        //:   contiguous sequence of bytes, followed by its length (as a
+        //:   'size_t'), to the hashing algorithm.
+        //:
+        //: 2 Strings having the same value have the same hash value, and
+        //:   strings having different values have distinct hash values.
+        //:
+        //: 3 Sequences of strings having the same characters in total, but
+        //:   divided differently among the strings, have distinct hash values.
+        //:
+        //: 4 'hashAppend' supports strings of both 'char' and 'wchar_t'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create strings of 'char' and
+        //:   of 'wchar_t' of various lengths, and compare the value computed
+        //:   by 'bslh::Hash' with that of a 'bslh::DefaultHashAlgorithm' to
+        //:   which the characters and length were supplied explicitly.
+        //:   (C-1, 4)
+        //:
+        //: 2 Compare the hash values of each pair of strings in the table.
+        //:   (C-2)
+        //:
+        //: 3 Compare the hash values computed by supplying '"ab"' and then
+        //:   '"c"', and '"a"' and then '"bc"', to a hashing algorithm.  (C-3)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const basic_string& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_string_p;  // string value
+        } DATA[] = {
+            //LINE  STRING
+            //----  ------------------------------------------------------
+            { L_,   ""                                                     },
+            { L_,   "a"                                                    },
+            { L_,   "b"                                                    },
+            { L_,   "ab"                                                   },
+            { L_,   "ba"                                                   },
+            { L_,   "abc"                                                  },
+            { L_,   "abcdefghijklmnop"                                     },
+            { L_,   "abcdefghijklmnopq"                                    },
+            { L_,   "abcdefghijklmnopqrstuvwxyz0123456789"                 },
+            { L_,   "abcdefghijklmnopqrstuvwxyz0123456789"
+                    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const STRING = DATA[ti].d_string_p;
+            const size_t      LENGTH = strlen(STRING);
+
+            const bsl::string X(STRING, &oa);
+
+            bsl::wstring mW(&oa);  const bsl::wstring& W = mW;
+            for (size_t i = 0; i < LENGTH; ++i) {
+                mW.push_back(static_cast<wchar_t>(STRING[i]));
+            }
+
+            bslh::DefaultHashAlgorithm expected;
+            expected(STRING, LENGTH);
+            expected(&LENGTH, sizeof LENGTH);
+            LOOP_ASSERT(LINE, expected.computeHash() == hasher(X));
+
+            bslh::DefaultHashAlgorithm expectedWide;
+            expectedWide(W.data(), LENGTH * sizeof(wchar_t));
+            expectedWide(&LENGTH, sizeof LENGTH);
+            LOOP_ASSERT(LINE, expectedWide.computeHash() == hasher(W));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2   = DATA[tj].d_line;
+                const char *const STRING2 = DATA[tj].d_string_p;
+
+                const bsl::string Y(STRING2, &oa);
+
+                LOOP2_ASSERT(LINE, LINE2,
+                             (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+        }
+
+        if (verbose) printf("\nTesting sequences of strings.\n");
+        {
+            const bsl::string AB("ab", &oa);
+            const bsl::string C( "c",  &oa);
+            const bsl::string A( "a",  &oa);
+            const bsl::string BC("bc", &oa);
+
+            bslh::DefaultHashAlgorithm hashAlgX;
+            hashAppend(hashAlgX, AB);
+            hashAppend(hashAlgX, C);
+
+            bslh::DefaultHashAlgorithm hashAlgY;
+            hashAppend(hashAlgY, A);
+            hashAppend(hashAlgY, BC);
+
+            ASSERT(hashAlgX.computeHash() != hashAlgY.computeHash());
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
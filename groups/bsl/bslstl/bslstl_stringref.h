@@ -55,6 +55,14 @@ BSLS_IDENT("$Id: $")
 // 'operator[]' is also provided for direct by-index access to individual
 // characters in the string.
 //
+// The 'find', 'rfind', 'find_first_of', 'find_last_of', 'find_first_not_of'
+// and 'find_last_not_of' accessors search the referenced string with the
+// semantics of the 'std::string' functions of the same names, returning
+// 'npos' if the search fails.  These accessors (like those of 'bsl::string')
+// are implemented using 'bslalg::StringSearchUtil', which examines many
+// characters at a time for 'bslstl::StringRef' on platforms supporting SSE2
+// or AVX2 instructions.
+//
 // Several overloaded free operators are provided for 'bslstl::StringRef'
 // objects (as well as variants for all combinations involving
 // 'bslstl::StringRef' and 'std::string', and 'bslstl::StringRef' and 'char *')
@@ -65,7 +73,10 @@ BSLS_IDENT("$Id: $")
 //
 // The 'bsl::hash' template class is specialized for 'bslstl::StringRef' to
 // enable the use of 'bslstl::StringRef' with STL hash containers (e.g.,
-// 'bsl::unordered_set' and 'bsl::unordered_map').
+// 'bsl::unordered_set' and 'bsl::unordered_map').  A 'hashAppend' free
+// function is also provided, so that 'bslstl::StringRef' (like 'bsl::string')
+// can be hashed by 'bslh::Hash', and used as an attribute of types hashed
+// using the 'hashAppend' protocol (see 'bslh_hash').
 //
 ///Efficiency and Usage Considerations
 ///-----------------------------------
@@ -252,6 +263,18 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_BYTEHASHUTIL
+#include <bslalg_bytehashutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_STRINGSEARCHUTIL
+#include <bslalg_stringsearchutil.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -335,6 +358,21 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
     typedef std::size_t         size_type;
         // Standard Library general container requirements.
 
+    // CLASS DATA
+    static const size_type npos = ~size_type(0);
+        // Value used to denote "not-a-position", returned by the search
+        // accessors when the search fails.
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::StringSearchUtil<
+                                  native_std::char_traits<CHAR_TYPE> > Search;
+
+    // PRIVATE ACCESSORS
+    size_type positionOf(const CHAR_TYPE *result) const;
+        // Return the position of the specified 'result' of a search in the
+        // string bound to this string reference, or 'npos' if 'result' is 0.
+
   public:
     // CREATORS
     StringRefImp();
@@ -503,6 +541,57 @@ class StringRefImp : public StringRefData<CHAR_TYPE> {
         // comparison and return a negative value if this string is less than
         // 'other' string, a positive value if this string is greater than
         // 'other' string, and 0 if this string is equal to 'other' string.
+
+    size_type find(const StringRefImp& substring,
+                   size_type           position = 0) const;
+    size_type find(CHAR_TYPE character, size_type position = 0) const;
+        // Return the starting position of the first occurrence of the
+        // specified 'substring' (or 'character') in the string bound to this
+        // string reference that starts at or after the optionally specified
+        // 'position', and 'npos' if there is no such occurrence.  If
+        // 'position' is not specified, 0 is used.
+
+    size_type rfind(const StringRefImp& substring,
+                    size_type           position = npos) const;
+    size_type rfind(CHAR_TYPE character, size_type position = npos) const;
+        // Return the starting position of the last occurrence of the
+        // specified 'substring' (or 'character') in the string bound to this
+        // string reference that starts at or before the optionally specified
+        // 'position', and 'npos' if there is no such occurrence.  If
+        // 'position' is not specified, 'npos' is used (i.e., the whole string
+        // is searched).
+
+    size_type find_first_of(const StringRefImp& characters,
+                            size_type           position = 0) const;
+        // Return the position of the first character at or after the
+        // optionally specified 'position' in the string bound to this string
+        // reference that is equal to any character in the specified
+        // 'characters', and 'npos' if there is no such character.  If
+        // 'position' is not specified, 0 is used.
+
+    size_type find_last_of(const StringRefImp& characters,
+                           size_type           position = npos) const;
+        // Return the position of the last character at or before the
+        // optionally specified 'position' in the string bound to this string
+        // reference that is equal to any character in the specified
+        // 'characters', and 'npos' if there is no such character.  If
+        // 'position' is not specified, 'npos' is used.
+
+    size_type find_first_not_of(const StringRefImp& characters,
+                                size_type           position = 0) const;
+        // Return the position of the first character at or after the
+        // optionally specified 'position' in the string bound to this string
+        // reference that is not equal to any character in the specified
+        // 'characters', and 'npos' if there is no such character.  If
+        // 'position' is not specified, 0 is used.
+
+    size_type find_last_not_of(const StringRefImp& characters,
+                               size_type           position = npos) const;
+        // Return the position of the last character at or before the
+        // optionally specified 'position' in the string bound to this string
+        // reference that is not equal to any character in the specified
+        // 'characters', and 'npos' if there is no such character.  If
+        // 'position' is not specified, 'npos' is used.
 };
 
 // FREE OPERATORS
@@ -698,6 +787,16 @@ std::basic_ostream<CHAR_TYPE>&
     // specified output 'stream' and return a reference to the modifiable
     // 'stream'.
 
+// FREE FUNCTIONS
+template <class HASHALG, class CHAR_TYPE>
+void hashAppend(HASHALG& hashAlg, const StringRefImp<CHAR_TYPE>& input);
+    // Pass the string bound to the specified 'input' to the specified
+    // 'hashAlg': the bytes of its characters, followed by its length (as a
+    // 'std::size_t').  This function is found by argument-dependent lookup,
+    // and is used by 'bslh::Hash' (see 'bslh_hash').  Note that 'hashAppend'
+    // for a 'bsl::basic_string' having the same characters passes the same
+    // bytes.
+
 // ===========================================================================
 //                                  TYPEDEFS
 // ===========================================================================
@@ -713,6 +812,11 @@ typedef StringRefImp<wchar_t>    StringRefWide;
                           // class StringRefImp
                           // ------------------
 
+// CLASS DATA
+template <typename CHAR_TYPE>
+const typename StringRefImp<CHAR_TYPE>::size_type
+StringRefImp<CHAR_TYPE>::npos;
+
 // PRIVATE ACCESSORS
 template <typename CHAR_TYPE>
 inline
@@ -727,6 +831,14 @@ void StringRefImp<CHAR_TYPE>::write(
     }
 }
 
+template <typename CHAR_TYPE>
+inline
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::positionOf(const CHAR_TYPE *result) const
+{
+    return result ? static_cast<size_type>(result - data()) : npos;
+}
+
 // CREATORS
 template <typename CHAR_TYPE>
 inline
@@ -936,6 +1048,117 @@ int StringRefImp<CHAR_TYPE>::compare(
     return result != 0 ? result : this->length() - other.length();
 }
 
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find(const StringRefImp& substring,
+                                  size_type           position) const
+{
+    if (position > length() || substring.length() > length() - position) {
+        return npos;                                                  // RETURN
+    }
+    if (substring.isEmpty()) {
+        return position;                                              // RETURN
+    }
+    return positionOf(Search::find(data() + position,
+                                   length() - position,
+                                   substring.data(),
+                                   substring.length()));
+}
+
+template <typename CHAR_TYPE>
+inline
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find(CHAR_TYPE character,
+                                  size_type position) const
+{
+    return find(StringRefImp(&character, 1), position);
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::rfind(const StringRefImp& substring,
+                                   size_type           position) const
+{
+    if (substring.length() > length()) {
+        return npos;                                                  // RETURN
+    }
+    if (position > length() - substring.length()) {
+        position = length() - substring.length();
+    }
+    if (substring.isEmpty()) {
+        return position;                                              // RETURN
+    }
+    return positionOf(Search::findLast(data(),
+                                       position + substring.length(),
+                                       substring.data(),
+                                       substring.length()));
+}
+
+template <typename CHAR_TYPE>
+inline
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::rfind(CHAR_TYPE character,
+                                   size_type position) const
+{
+    return rfind(StringRefImp(&character, 1), position);
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find_first_of(
+                                         const StringRefImp& characters,
+                                         size_type           position) const
+{
+    if (position >= length()) {
+        return npos;                                                  // RETURN
+    }
+    return positionOf(Search::findFirstOf(data() + position,
+                                          length() - position,
+                                          characters.data(),
+                                          characters.length()));
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find_last_of(
+                                         const StringRefImp& characters,
+                                         size_type           position) const
+{
+    return positionOf(Search::findLastOf(
+                            data(),
+                            position < length() ? position + 1 : length(),
+                            characters.data(),
+                            characters.length()));
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find_first_not_of(
+                                         const StringRefImp& characters,
+                                         size_type           position) const
+{
+    if (position >= length()) {
+        return npos;                                                  // RETURN
+    }
+    return positionOf(Search::findFirstNotOf(data() + position,
+                                             length() - position,
+                                             characters.data(),
+                                             characters.length()));
+}
+
+template <typename CHAR_TYPE>
+typename StringRefImp<CHAR_TYPE>::size_type
+    StringRefImp<CHAR_TYPE>::find_last_not_of(
+                                         const StringRefImp& characters,
+                                         size_type           position) const
+{
+    return positionOf(Search::findLastNotOf(
+                            data(),
+                            position < length() ? position + 1 : length(),
+                            characters.data(),
+                            characters.length()));
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -1380,6 +1603,15 @@ bslstl::operator<<(std::basic_ostream<CHAR_TYPE>& stream,
     return stream;
 }
 
+// FREE FUNCTIONS
+template <class HASHALG, class CHAR_TYPE>
+inline
+void bslstl::hashAppend(HASHALG& hashAlg, const StringRefImp<CHAR_TYPE>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAlg(input.data(), sizeof(CHAR_TYPE) * input.length());
+    hashAppend(hashAlg, static_cast<std::size_t>(input.length()));
+}
 
 }  // close enterprise namespace
 
@@ -1401,7 +1633,8 @@ struct hash<BloombergLP::bslstl::StringRefImp<CHAR_TYPE> > {
     operator()(const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>&
                                                               stringRef) const;
         // Return a hash corresponding to the string bound to the specified
-        // 'stringRef'.
+        // 'stringRef'.  Note that the result is the same as the hash of a
+        // 'bsl::basic_string' having the same characters.
 };
 
 // ACCESSORS
@@ -1409,29 +1642,10 @@ template <typename CHAR_TYPE>
 std::size_t hash<BloombergLP::bslstl::StringRefImp<CHAR_TYPE> >::
 operator()(const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& stringRef) const
 {
-    const CHAR_TYPE *string = stringRef.begin();
-    const CHAR_TYPE *end    = stringRef.end();
-
-    const unsigned int ADDEND       = 1013904223U;
-    const unsigned int MULTIPLICAND =    1664525U;
-    const unsigned int MASK         = 4294967295U;
-
-    std::size_t r = 0;
-
-    if (4 == sizeof(int)) {
-        while (string != end) {
-            r ^= *string++;
-            r = r * MULTIPLICAND + ADDEND;
-        }
-    }
-    else {
-        while (string != end) {
-            r ^= *string++;
-            r = (r * MULTIPLICAND + ADDEND) & MASK;
-        }
-    }
-
-    return r;
+    return static_cast<std::size_t>(
+            BloombergLP::bslalg::ByteHashUtil::hash(
+                                  stringRef.data(),
+                                  stringRef.length() * sizeof(CHAR_TYPE)));
 }
 
 }  // close namespace bsl
@@ -2,6 +2,9 @@
 
 #include <bslstl_stringref.h>
 
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_nativestd.h>
@@ -109,6 +112,15 @@ using namespace bsl;  // automatically added by script
 // [ 7] operator+(const char *lhs, const StringRef& rhs);
 // [ 7] operator+(const StringRef& lhs, const char *rhs);
 // [ 8] bsl::hash<BloombergLP::bslstl::StringRef>
+// [11] void hashAppend(HASHALG& hashAlg, const StringRef& input);
+// [12] size_type find(const StringRef& substring, size_type position) const;
+// [12] size_type find(char character, size_type position) const;
+// [12] size_type rfind(const StringRef& substring, size_type position) const;
+// [12] size_type rfind(char character, size_type position) const;
+// [12] size_type find_first_of(const StringRef& chars, size_type pos) const;
+// [12] size_type find_last_of(const StringRef& chars, size_type pos) const;
+// [12] size_type find_first_not_of(const StringRef& cs, size_type p) const;
+// [12] size_type find_last_not_of(const StringRef& cs, size_type p) const;
 //--------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [10] USAGE
@@ -607,6 +619,202 @@ int main(int argc, char *argv[])
     std::cout << "TEST " << __FILE__ << " CASE " << test << std::endl;
 
     switch (test) { case 0:
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING SEARCH ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each search accessor returns the same position as the
+        //:   'std::string' function of the same name, for every starting
+        //:   position (including positions beyond the end of the string and
+        //:   'npos').
+        //:
+        //: 2 Empty strings, empty patterns and empty sets are handled as by
+        //:   'std::string'.
+        //:
+        //: 3 Long strings (searched a block of characters at a time) give the
+        //:   same results as short ones.
+        //:
+        //: 4 The accessors are available for 'StringRefWide'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, for a set of strings and a set
+        //:   of patterns (used both as substrings and as sets of characters),
+        //:   including strings longer than 32 characters, compare the result
+        //:   of each accessor with that of the corresponding
+        //:   'native_std::string' function, for every position from 0 to two
+        //:   beyond the length of the string, and for 'npos'.  (C-1..3)
+        //:
+        //: 2 Perform a few searches on a 'StringRefWide'.  (C-4)
+        //
+        // Testing:
+        //   size_type find(const StringRef& substring, size_type pos) const;
+        //   size_type find(char character, size_type position) const;
+        //   size_type rfind(const StringRef& substring, size_type pos) const;
+        //   size_type rfind(char character, size_type position) const;
+        //   size_type find_first_of(const StringRef& cs, size_type p) const;
+        //   size_type find_last_of(const StringRef& cs, size_type p) const;
+        //   size_type find_first_not_of(const StringRef&, size_type) const;
+        //   size_type find_last_not_of(const StringRef&, size_type) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEARCH ACCESSORS"
+                            "\n========================\n");
+
+        static const char *const STRINGS[] = {
+            "",
+            "a",
+            "ab",
+            "abcabc",
+            "aaaaaaaa",
+            "8=FIX.4.2|35=D|49=SENDER|56=TARGET|55=IBM|54=1|38=100|",
+            "the quick brown fox jumps over the lazy dog; THE QUICK BROWN FOX",
+        };
+        const int NUM_STRINGS = sizeof STRINGS / sizeof *STRINGS;
+
+        static const char *const PATTERNS[] = {
+            "", "a", "b", "ab", "ca", "aaa", "|", "|55=", "=|", "IBM|",
+            "xyz", "abcdefghijklmnopqrstuvwxyz", " ;", "8=FIX"
+        };
+        const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+        typedef Obj::size_type size_type;
+
+        for (int si = 0; si < NUM_STRINGS; ++si) {
+            const native_std::string S(STRINGS[si]);
+            const Obj                X(STRINGS[si]);
+
+            for (int pi = 0; pi < NUM_PATTERNS; ++pi) {
+                const native_std::string T(PATTERNS[pi]);
+                const Obj                Y(PATTERNS[pi]);
+
+                if (veryVerbose) {
+                    printf("\t\"%s\" \"%s\"\n", S.c_str(), T.c_str());
+                }
+
+                for (size_type pos = 0; pos <= S.length() + 3; ++pos) {
+                    const size_type POS = pos == S.length() + 3
+                                          ? Obj::npos
+                                          : pos;
+
+                    ASSERTV(si, pi, POS, S.find(T, POS) == X.find(Y, POS));
+                    ASSERTV(si, pi, POS, S.rfind(T, POS) == X.rfind(Y, POS));
+                    ASSERTV(si, pi, POS, S.find_first_of(T, POS) ==
+                                                     X.find_first_of(Y, POS));
+                    ASSERTV(si, pi, POS, S.find_last_of(T, POS) ==
+                                                      X.find_last_of(Y, POS));
+                    ASSERTV(si, pi, POS, S.find_first_not_of(T, POS) ==
+                                                 X.find_first_not_of(Y, POS));
+                    ASSERTV(si, pi, POS, S.find_last_not_of(T, POS) ==
+                                                  X.find_last_not_of(Y, POS));
+
+                    if (!T.empty()) {
+                        ASSERTV(si, pi, POS, S.find(T[0], POS) ==
+                                                         X.find(Y[0], POS));
+                        ASSERTV(si, pi, POS, S.rfind(T[0], POS) ==
+                                                        X.rfind(Y[0], POS));
+                    }
+                }
+            }
+
+            // The default positions search the whole string.
+
+            ASSERTV(si, S.find("b")  == X.find("b"));
+            ASSERTV(si, S.rfind("b") == X.rfind("b"));
+            ASSERTV(si, S.find_first_of("b|") == X.find_first_of("b|"));
+            ASSERTV(si, S.find_last_of("b|")  == X.find_last_of("b|"));
+            ASSERTV(si, S.find_first_not_of("a") == X.find_first_not_of("a"));
+            ASSERTV(si, S.find_last_not_of("a")  == X.find_last_not_of("a"));
+        }
+
+        if (verbose) printf("\tTesting 'StringRefWide'.\n");
+        {
+            const bslstl::StringRefWide X(L"wide string");
+
+            ASSERT(5 == X.find(L"string"));
+            ASSERT(5 == X.find(L's'));
+            ASSERT(6 == X.rfind(L"t"));
+            ASSERT(3 == X.find_first_of(L"ex"));
+            ASSERT(9 == X.find_last_of(L"in"));
+            ASSERT(1 == X.find_first_not_of(L"w"));
+            ASSERT(bslstl::StringRefWide::npos ==
+                                            X.find_last_not_of(L"wide strng"));
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the characters of the string reference
+        //:   as a single contiguous sequence of bytes, followed by its length
+        //:   (as a 'size_t'), to the hashing algorithm.
+        //:
+        //: 2 A string reference has the same hash value as a 'bsl::string'
+        //:   having the same characters.
+        //:
+        //: 3 String references to different strings have distinct hash
+        //:   values.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create string references of
+        //:   various lengths, and compare the value computed by 'bslh::Hash'
+        //:   with that of a 'bslh::DefaultHashAlgorithm' to which the
+        //:   characters and length were supplied explicitly, and with that of
+        //:   a 'bsl::string' having the same value.  (C-1, 2)
+        //:
+        //: 2 Compare the hash values of each pair of string references in the
+        //:   table.  (C-3)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const StringRefImp& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_string_p;  // string value
+        } DATA[] = {
+            //LINE  STRING
+            //----  ------------------------------------------
+            { L_,   ""                                         },
+            { L_,   "a"                                        },
+            { L_,   "b"                                        },
+            { L_,   "ab"                                       },
+            { L_,   "ba"                                       },
+            { L_,   "abc"                                      },
+            { L_,   "abcdefghijklmnopqrstuvwxyz0123456789"     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const STRING = DATA[ti].d_string_p;
+            const size_t      LENGTH = strlen(STRING);
+
+            const Obj         X(STRING);
+            const bsl::string S(STRING);
+
+            bslh::DefaultHashAlgorithm expected;
+            expected(STRING, LENGTH);
+            expected(&LENGTH, sizeof LENGTH);
+            ASSERTV(LINE, expected.computeHash() == hasher(X));
+            ASSERTV(LINE, hasher(S)              == hasher(X));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE2   = DATA[tj].d_line;
+                const char *const STRING2 = DATA[tj].d_string_p;
+
+                const Obj Y(STRING2);
+
+                ASSERTV(LINE, LINE2, (ti == tj) == (hasher(X) == hasher(Y)));
+            }
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -762,6 +970,9 @@ int main(int argc, char *argv[])
         //   representative, this at least allows us to make sure that our hash
         //   performs in a reasonable manner.
         //
+        //   Finally, verify that the hash of each string is the same as that
+        //   of a 'bsl::string' having the same value.
+        //
         // Testing:
         //   bsl::hash<BloombergLP::bslstl::StringRef>
         // --------------------------------------------------------------------
@@ -1971,6 +2182,12 @@ int main(int argc, char *argv[])
 
             std::size_t hash_value = hash_function(o);
             LOOP_ASSERT(LINE, hash_results[o] == hash_value);
+
+            // A 'bsl::string' having the same value has the same hash.
+
+            LOOP_ASSERT(LINE,
+                        bsl::hash<bsl::string>()(bsl::string(STR)) ==
+                                                                  hash_value);
         }
 
         // Make sure that no particular hash value occurred more than twice.
@@ -875,10 +875,6 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_hashtableiterator.h>
 #endif
 
-#ifndef INCLUDED_BSLSTL_ITERATORUTIL
-#include <bslstl_iteratorutil.h>
-#endif
-
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -903,10 +899,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -1206,6 +1210,25 @@ class unordered_map {
         // object in this unordered map having the specified 'key', if such an
         // entry exists, and the past-the-end iterator ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this unordered map whose key compares equal to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // 'bslmf::IsTransparentPredicate'), in which case 'key' is passed to
+        // them without being converted to 'key_type'.  The behavior is
+        // undefined unless 'HASH' returns for 'key' the same value as for any
+        // 'key_type' object comparing equal to 'key'.
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     template <class SOURCE_TYPE>
     pair<iterator, bool> insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this unordered map if the key (the
@@ -1248,6 +1271,9 @@ class unordered_map {
         // a type convertible to 'value_type'.  This method requires that the
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+        // Note that the buckets of this unordered map are grown at most once,
+        // for the length of the range, even if 'INPUT_ITERATOR' is not a
+        // forward iterator.
 
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
@@ -1259,6 +1285,31 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered map whose key
+        // compares equal to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  This method
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent, in which case 'key' is not converted to
+        // 'key_type'.  The behavior is undefined unless 'HASH' returns for
+        // 'key' the same value as for any 'key_type' object comparing equal
+        // to 'key'.
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(iterator(0),     iterator(0));
+    }
+
     void max_load_factor(float newMaxLoadFactor);
         // Set the maximum load factor of this unordered map to the specified
         // 'newMaxLoadFactor'.  If 'newMaxLoadFactor < loadFactor()', this
@@ -1366,6 +1417,21 @@ class unordered_map {
         // unordered map maintains unique keys, the returned value will be
         // either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered map whose key compares equal to the specified 'key'.
+        // This method participates in overload resolution only if both 'HASH'
+        // and 'EQUAL' are transparent, in which case 'key' is not converted
+        // to 'key_type'.
+    {
+        return d_impl.findTransparent(key) != 0;
+    }
+
     bool empty() const;
         // Return 'true' if this unordered map contains no elements, and
         // 'false' otherwise.
@@ -1381,12 +1447,52 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered map whose key
+        // compares equal to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  This method
+        // participates in overload resolution only if both 'HASH' and 'EQUAL'
+        // are transparent, in which case 'key' is not converted to
+        // 'key_type'.
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(const_iterator(0), const_iterator(0));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this unordered map having the specified
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map whose key compares equal
+        // to the specified 'key', if such an entry exists, and the
+        // past-the-end iterator ('end') otherwise.  This method participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent, in which case 'key' is not converted to 'key_type'.
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1720,17 +1826,7 @@ void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
                                                           INPUT_ITERATOR first,
                                                           INPUT_ITERATOR last)
 {
-    size_type maxInsertions =
-            ::BloombergLP::bslstl::IteratorUtil::insertDistance(first, last);
-    if (maxInsertions) {
-        this->reserve(this->size() + maxInsertions);
-    }
-
-    bool isInsertedFlag;  // not used
-    while (first != last) {
-        d_impl.insertIfMissing(&isInsertedFlag, *first);
-        ++first;
-    }
+    d_impl.insertRangeIfMissing(first, last);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
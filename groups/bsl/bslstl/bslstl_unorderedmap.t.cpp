@@ -4,6 +4,7 @@
 #include <bslstl_hash.h>
 #include <bslstl_pair.h>
 #include <bslstl_string.h>
+#include <bslstl_stringref.h>
 #include <bslstl_vector.h>
 
 #include <bslalg_swaputil.h>
@@ -12,6 +13,7 @@
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_mallocfreeallocator.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
@@ -26,6 +28,7 @@
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_util.h>
 
 #include <bsltf_stdtestallocator.h>
@@ -57,6 +60,14 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 // [ ]
 //-----------------------------------------------------------------------------
+// [18] iterator find(const LOOKUP_KEY& key);
+// [18] const_iterator find(const LOOKUP_KEY& key) const;
+// [18] size_type count(const LOOKUP_KEY& key) const;
+// [18] pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [18] pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+// [19] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [19] unordered_map(ITER first, ITER last, size_type, ...);
+//-----------------------------------------------------------------------------
 // [1] BREATHING TEST
 // [2] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -5465,6 +5476,138 @@ const char *testTypeName<bsltf::NonTypicalOverloadsTestType>()
     return "NonTypicalOverloadTestType";
 };
 
+                       // ============================
+                       // struct TransparentStringHash
+                       // ============================
+
+struct TransparentStringHash {
+    // This transparent hash functor returns the same hash value for a
+    // 'bsl::string', a 'bslstl::StringRef', and a null-terminated string
+    // having the same characters, without creating a 'bsl::string' from its
+    // argument.
+
+    typedef void is_transparent;
+
+    template <class STRING_TYPE>
+    std::size_t operator()(const STRING_TYPE& key) const
+        // Return the FNV-1a hash of the characters of the specified 'key'.
+    {
+        const bslstl::StringRef ref(key);
+
+        std::size_t hash = 2166136261u;
+        for (std::size_t i = 0; i < ref.length(); ++i) {
+            hash = (hash ^ static_cast<unsigned char>(ref.data()[i]))
+                 * 16777619u;
+        }
+        return hash;
+    }
+};
+
+                       // =============================
+                       // struct TransparentStringEqual
+                       // =============================
+
+struct TransparentStringEqual {
+    // This transparent equality predicate compares 'bsl::string',
+    // 'bslstl::StringRef', and null-terminated strings (in any combination)
+    // without creating a 'bsl::string' from its arguments.
+
+    typedef void is_transparent;
+
+    template <class LHS_TYPE, class RHS_TYPE>
+    bool operator()(const LHS_TYPE& lhs, const RHS_TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same
+        // characters, and 'false' otherwise.
+    {
+        return bslstl::StringRef(lhs) == bslstl::StringRef(rhs);
+    }
+};
+
+                          // ======================
+                          // struct CountingIntHash
+                          // ======================
+
+struct CountingIntHash {
+    // This hash functor counts the number of times it is invoked.
+
+    static int s_numCalls;  // number of invocations since the last reset
+
+    std::size_t operator()(int key) const
+        // Increment 's_numCalls', and return the hash value of the specified
+        // 'key'.
+    {
+        ++s_numCalls;
+        return bsl::hash<int>()(key);
+    }
+};
+
+int CountingIntHash::s_numCalls = 0;
+
+                         // ========================
+                         // class SinglePassIterator
+                         // ========================
+
+template <class TYPE>
+class SinglePassIterator {
+    // This class adapts a pointer into an iterator advertising only the
+    // input iterator category, so that containers cannot compute the length
+    // of a range of such iterators in advance.
+
+    // DATA
+    const TYPE *d_ptr;  // current position
+
+  public:
+    // TYPES
+    typedef std::input_iterator_tag iterator_category;
+    typedef TYPE                    value_type;
+    typedef std::ptrdiff_t          difference_type;
+    typedef const TYPE             *pointer;
+    typedef const TYPE&             reference;
+
+    // CREATORS
+    explicit SinglePassIterator(const TYPE *ptr)
+        // Create an iterator referring to the specified 'ptr'.
+    : d_ptr(ptr)
+    {
+    }
+
+    // MANIPULATORS
+    SinglePassIterator& operator++()
+        // Advance this iterator to the next element, and return a reference
+        // providing modifiable access to this iterator.
+    {
+        ++d_ptr;
+        return *this;
+    }
+
+    // ACCESSORS
+    const TYPE& operator*() const
+        // Return a reference to the element this iterator refers to.
+    {
+        return *d_ptr;
+    }
+
+    const TYPE *operator->() const
+        // Return the address of the element this iterator refers to.
+    {
+        return d_ptr;
+    }
+
+    bool operator==(const SinglePassIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same element, and 'false' otherwise.
+    {
+        return d_ptr == rhs.d_ptr;
+    }
+
+    bool operator!=(const SinglePassIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to
+        // different elements, and 'false' otherwise.
+    {
+        return d_ptr != rhs.d_ptr;
+    }
+};
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -9568,6 +9711,297 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING BULK INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting a range inserts each element whose key is not already
+        //:   present, either in the map or earlier in the range.
+        //:
+        //: 2 The hash code of each element of the range is computed exactly
+        //:   once, and the elements already in the map are rehashed at most
+        //:   once, whether or not the length of the range can be computed in
+        //:   advance.
+        //:
+        //: 3 A map constructed from a range with enough initial buckets for
+        //:   its elements is not rehashed.
+        //:
+        //: 4 If an allocation fails, no memory is leaked, and the elements
+        //:   inserted so far remain in the map.
+        //
+        // Plan:
+        //: 1 Insert ranges having duplicate keys, by forward and by input
+        //:   iterators, into empty and non-empty maps, and compare the result
+        //:   with the expected contents.  (C-1)
+        //:
+        //: 2 Count the invocations of the hasher during each insertion in
+        //:   P-1.  (C-2..3)
+        //:
+        //: 3 Repeat P-1 in the presence of injected exceptions, and verify
+        //:   that the map is valid after each exception.  (C-4)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   unordered_map(ITER first, ITER last, size_type, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BULK INSERTION"
+                            "\n======================\n");
+
+        typedef bsl::unordered_map<int, int, CountingIntHash> Obj;
+        typedef bsl::pair<int, int>                           Value;
+        typedef SinglePassIterator<Value>                     InputIter;
+
+        enum { NUM_VALUES = 200 };
+
+        Value values[NUM_VALUES];
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            values[i] = Value(i % (NUM_VALUES / 2), i);  // each key twice
+        }
+        const Value *const VALUES = values;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tInserting into an empty map.\n");
+
+        for (int numValues = 0; numValues <= NUM_VALUES; numValues += 25) {
+            const int NUM_KEYS = numValues < NUM_VALUES / 2
+                               ? numValues
+                               : NUM_VALUES / 2;
+
+            if (veryVerbose) { T_ P_(numValues) P(NUM_KEYS) }
+
+            for (int useInput = 0; useInput < 2; ++useInput) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                CountingIntHash::s_numCalls = 0;
+                if (useInput) {
+                    mX.insert(InputIter(VALUES),
+                              InputIter(VALUES + numValues));
+                }
+                else {
+                    mX.insert(VALUES, VALUES + numValues);
+                }
+
+                ASSERTV(useInput, numValues, CountingIntHash::s_numCalls,
+                        numValues == CountingIntHash::s_numCalls);
+                ASSERTV(useInput, numValues, X.size(),
+                        NUM_KEYS == static_cast<int>(X.size()));
+                ASSERTV(X.load_factor() <= X.max_load_factor());
+
+                for (int k = 0; k < NUM_KEYS; ++k) {
+                    Obj::const_iterator it = X.find(k);
+                    ASSERTV(useInput, numValues, k, X.end() != it);
+                    ASSERTV(useInput, numValues, k, it->second,
+                            k == it->second);  // first occurrence is kept
+                }
+            }
+        }
+
+        if (verbose) printf("\tInserting into a non-empty map.\n");
+
+        for (int useInput = 0; useInput < 2; ++useInput) {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(VALUES, VALUES + 10);
+
+            const int NUM_BUCKETS = static_cast<int>(X.bucket_count());
+            const int SIZE        = static_cast<int>(X.size());
+            const int CAPACITY    = static_cast<int>(X.max_load_factor()
+                                                               * NUM_BUCKETS);
+
+            CountingIntHash::s_numCalls = 0;
+            if (useInput) {
+                mX.insert(InputIter(VALUES), InputIter(VALUES + NUM_VALUES));
+            }
+            else {
+                mX.insert(VALUES, VALUES + NUM_VALUES);
+            }
+
+            // The range holds 'NUM_VALUES' elements, and the elements in the
+            // map when the bucket array grows are rehashed exactly once.  A
+            // forward range does not fit in the map, so none of its elements
+            // is inserted before the bucket array grows; the elements of a
+            // single-pass range are inserted in place until the map is full.
+
+            ASSERTV(useInput, X.bucket_count(),
+                    NUM_BUCKETS < static_cast<int>(X.bucket_count()));
+            if (useInput) {
+                ASSERTV(CountingIntHash::s_numCalls,
+                        NUM_VALUES + SIZE <= CountingIntHash::s_numCalls);
+                ASSERTV(CAPACITY, CountingIntHash::s_numCalls,
+                        NUM_VALUES + CAPACITY >= CountingIntHash::s_numCalls);
+            }
+            else {
+                ASSERTV(CountingIntHash::s_numCalls,
+                        NUM_VALUES + SIZE == CountingIntHash::s_numCalls);
+            }
+            ASSERTV(useInput, X.size(), NUM_VALUES / 2 == X.size());
+        }
+
+        if (verbose) printf("\tConstructing from a range.\n");
+        {
+            CountingIntHash::s_numCalls = 0;
+
+            Obj mX(InputIter(VALUES),
+                   InputIter(VALUES + NUM_VALUES),
+                   NUM_VALUES,
+                   CountingIntHash(),
+                   bsl::equal_to<int>(),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERTV(CountingIntHash::s_numCalls,
+                    NUM_VALUES == CountingIntHash::s_numCalls);
+            ASSERTV(X.size(), NUM_VALUES / 2 == X.size());
+        }
+
+        if (verbose) printf("\tInserting with injected exceptions.\n");
+
+        for (int useInput = 0; useInput < 2; ++useInput) {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(VALUES, VALUES + 10);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                if (useInput) {
+                    mX.insert(InputIter(VALUES),
+                              InputIter(VALUES + NUM_VALUES));
+                }
+                else {
+                    mX.insert(VALUES, VALUES + NUM_VALUES);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(useInput, X.size(), NUM_VALUES / 2 == X.size());
+            for (int k = 0; k < NUM_VALUES / 2; ++k) {
+                ASSERTV(useInput, k, X.end() != X.find(k));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both the hasher and the equality predicate are transparent,
+        //:   the lookup methods accept an argument of any type that both
+        //:   accept, and return the same results as for an equal 'key_type'
+        //:   argument.
+        //:
+        //: 2 Such lookups allocate no memory, neither from the object
+        //:   allocator nor from the default allocator.
+        //
+        // Plan:
+        //: 1 Create an unordered map of 'bsl::string' keys, too long for the
+        //:   short string optimization, having a transparent hasher and
+        //:   equality predicate, and look up present and absent keys by
+        //:   'bslstl::StringRef' and by null-terminated string, comparing
+        //:   the results with those of a lookup by 'bsl::string'.  (C-1)
+        //:
+        //: 2 Use test allocators to verify that no memory is allocated by the
+        //:   lookups in P-1.  (C-2)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_map<bsl::string,
+                                   int,
+                                   TransparentStringHash,
+                                   TransparentStringEqual> Obj;
+
+        static const char *const KEYS[] = {
+            "a key long enough not to fit in the short string buffer: 0",
+            "a key long enough not to fit in the short string buffer: 2",
+            "a key long enough not to fit in the short string buffer: 4",
+            "a key long enough not to fit in the short string buffer: 6",
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        static const char *const ABSENT[] = {
+            "",
+            "a key",
+            "a key long enough not to fit in the short string buffer: 1",
+            "a key long enough not to fit in the short string buffer: 3",
+        };
+        const int NUM_ABSENT = static_cast<int>(sizeof ABSENT /
+                                                sizeof *ABSENT);
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX[bsl::string(KEYS[i], &oa)] = i;
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        const bsls::Types::Int64 DA_TOTAL = da.numBlocksTotal();
+        const bsls::Types::Int64 OA_TOTAL = oa.numBlocksTotal();
+
+        if (verbose) printf("\tLooking up present keys.\n");
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const char              *CSTR = KEYS[i];
+            const bslstl::StringRef  REF(CSTR);
+
+            if (veryVerbose) { T_ P(CSTR) }
+
+            Obj::iterator       it  = mX.find(REF);
+            Obj::const_iterator cit = X.find(CSTR);
+
+            ASSERTV(i, X.end() != it);
+            ASSERTV(i, it      == cit);
+            ASSERTV(i, i       == it->second);
+            ASSERTV(i, REF     == it->first);
+
+            ASSERTV(i, 1 == X.count(REF));
+            ASSERTV(i, 1 == X.count(CSTR));
+
+            Obj::iterator NEXT = it;
+            ++NEXT;
+
+            bsl::pair<Obj::iterator, Obj::iterator> R = mX.equal_range(REF);
+            ASSERTV(i, it   == R.first);
+            ASSERTV(i, NEXT == R.second);
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                           X.equal_range(CSTR);
+            ASSERTV(i, it   == CR.first);
+            ASSERTV(i, NEXT == CR.second);
+        }
+
+        if (verbose) printf("\tLooking up absent keys.\n");
+
+        for (int i = 0; i < NUM_ABSENT; ++i) {
+            const char              *CSTR = ABSENT[i];
+            const bslstl::StringRef  REF(CSTR);
+
+            if (veryVerbose) { T_ P(CSTR) }
+
+            ASSERTV(i, X.end() == mX.find(REF));
+            ASSERTV(i, X.end() == X.find(CSTR));
+            ASSERTV(i, 0       == X.count(REF));
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                            X.equal_range(REF);
+            ASSERTV(i, X.end() == CR.first);
+            ASSERTV(i, X.end() == CR.second);
+        }
+
+        ASSERTV(da.numBlocksTotal(), DA_TOTAL == da.numBlocksTotal());
+        ASSERTV(oa.numBlocksTotal(), OA_TOTAL == oa.numBlocksTotal());
+      } break;
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
         case 17: {
         // --------------------------------------------------------------------
@@ -10014,6 +10448,123 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BULK INSERTION
+        //
+        // Concerns:
+        //: 1 Loading a map from a forward range is faster than inserting its
+        //:   elements one by one into a map that has reserved space for them
+        //:   (which is what range insertion used to do).
+        //:
+        //: 2 Loading a map from a single-pass range is faster than inserting
+        //:   its elements one by one.
+        //
+        // Plan:
+        //: 1 For a number of elements optionally specified on the command line
+        //:   (10 million by default), time the loading of a map by inserting
+        //:   the elements of a 'bsl::vector' one by one, with and without
+        //:   first reserving space for them, and by range insertion from the
+        //:   iterators of the vector and from a range of single-pass
+        //:   iterators over the same elements.  Verify that each map has the
+        //:   same size.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: BULK INSERTION"
+                            "\n===========================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+        typedef bsl::pair<int, int>          Value;
+        typedef SinglePassIterator<Value>    InputIter;
+
+        // Time the containers, not the bookkeeping of the test allocator.
+
+        bslma::DefaultAllocatorGuard dag(
+                                      &bslma::NewDeleteAllocator::singleton());
+
+        const int NUM_VALUES = argc > 2 && atoi(argv[2]) > 0
+                             ? atoi(argv[2])
+                             : 10000000;
+
+        bsl::vector<Value> values;
+        values.reserve(NUM_VALUES);
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            values.push_back(Value(static_cast<int>(seed >> 1), i));
+        }
+        const Value *const BEGIN = &values[0];
+        const Value *const END   = BEGIN + NUM_VALUES;
+
+        bsls::Stopwatch timer;
+
+        Obj::size_type expectedSize;
+        double         oneByOne;
+        {
+            timer.reset();
+            timer.start();
+            Obj mX;
+            for (const Value *it = BEGIN; it != END; ++it) {
+                mX.insert(*it);
+            }
+            timer.stop();
+            oneByOne     = timer.elapsedTime();
+            expectedSize = mX.size();
+            ASSERT(0 < expectedSize);
+        }
+
+        double reserved;
+        {
+            timer.reset();
+            timer.start();
+            Obj mX;
+            mX.reserve(NUM_VALUES);
+            for (const Value *it = BEGIN; it != END; ++it) {
+                mX.insert(*it);
+            }
+            timer.stop();
+            reserved = timer.elapsedTime();
+            ASSERTV(expectedSize, mX.size(), expectedSize == mX.size());
+        }
+
+        double forward;
+        {
+            timer.reset();
+            timer.start();
+            Obj mX;
+            mX.insert(values.begin(), values.end());
+            timer.stop();
+            forward = timer.elapsedTime();
+            ASSERTV(expectedSize, mX.size(), expectedSize == mX.size());
+        }
+
+        double singlePass;
+        {
+            timer.reset();
+            timer.start();
+            Obj mX;
+            mX.insert(InputIter(BEGIN), InputIter(END));
+            timer.stop();
+            singlePass = timer.elapsedTime();
+            ASSERTV(expectedSize, mX.size(), expectedSize == mX.size());
+        }
+
+        printf("%d elements:\n"
+               "  one by one               %.3fs\n"
+               "  reserve, then one by one %.3fs\n"
+               "  forward range            %.3fs (%.2fx vs. reserve)\n"
+               "  single-pass range        %.3fs (%.2fx vs. one by one)\n",
+               NUM_VALUES,
+               oneByOne,
+               reserved,
+               forward,
+               forward > 0 ? reserved / forward : 0.0,
+               singlePass,
+               singlePass > 0 ? oneByOne / singlePass : 0.0);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
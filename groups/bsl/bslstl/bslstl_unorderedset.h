@@ -534,10 +534,6 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_hashtableiterator.h>
 #endif
 
-#ifndef INCLUDED_BSLSTL_ITERATORUTIL
-#include <bslstl_iteratorutil.h>
-#endif
-
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #endif
@@ -871,7 +867,9 @@ class unordered_set
         // defined in the C++11 standard [24.2.3] providing access to values of
         // a type convertible to 'value_type'.  This method requires that
         // the (template parameter) type 'KEY' be "copy-constructible" (see
-        // {Requirements on 'KEY'}).
+        // {Requirements on 'KEY'}).  Note that the buckets of this set are
+        // grown at most once, for the length of the range, even if
+        // 'INPUT_ITERATOR' is not a forward iterator.
 
     void max_load_factor(float newLoadFactor);
         // Set the maximum load factor of this container to the specified
@@ -1289,17 +1287,7 @@ inline
 void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                         INPUT_ITERATOR last)
 {
-    if (size_type maxInsertions =
-            ::BloombergLP::bslstl::IteratorUtil::insertDistance(first, last)) {
-        this->reserve(this->size() + maxInsertions);
-    }
-
-    bool isInsertedFlag;  // value is not used
-
-    while (first != last) {
-        d_impl.insertIfMissing(&isInsertedFlag, *first);
-        ++first;
-    }
+    d_impl.insertRangeIfMissing(first, last);
 }
 
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
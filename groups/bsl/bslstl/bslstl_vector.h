@@ -536,10 +536,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_enableif.h>
 #endif
 
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISFUNDAMENTAL
 #include <bslmf_isfundamental.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISINTEGRAL
+#include <bslmf_isintegral.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISSAME
 #include <bslmf_issame.h>
 #endif
@@ -1863,6 +1871,16 @@ template <class VALUE_TYPE, class ALLOCATOR>
 void swap(vector<const VALUE_TYPE *, ALLOCATOR>& a,
           vector<const VALUE_TYPE *, ALLOCATOR>& b);
 
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE_TYPE, class ALLOCATOR>
+void hashAppend(HASHALG& hashAlg, const vector<VALUE_TYPE, ALLOCATOR>& input);
+    // Pass the specified 'input' vector to the specified 'hashAlg': its size
+    // (as a 'std::size_t'), followed by each of its elements in order.  This
+    // function is found by argument-dependent lookup, and is used by
+    // 'bslh::Hash' (see 'bslh_hash').  Note that the elements of a vector of
+    // integral type are passed to 'hashAlg' in a single call, which (by the
+    // 'hashAppend' protocol for integral types) passes the same bytes.
+
                           // =======================
                           // class Vector_RangeCheck
                           // =======================
@@ -4148,6 +4166,30 @@ void swap(vector<const VALUE_TYPE *, ALLOCATOR>& a,
     static_cast<Base&>(a).swap(static_cast<Base&>(b));
 }
 
+                       // --------------------------
+                       // hashAppend for all vectors
+                       // --------------------------
+
+// FREE FUNCTIONS
+template <class HASHALG, class VALUE_TYPE, class ALLOCATOR>
+inline
+void hashAppend(HASHALG& hashAlg, const vector<VALUE_TYPE, ALLOCATOR>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    typedef typename vector<VALUE_TYPE, ALLOCATOR>::const_iterator ci_t;
+
+    hashAppend(hashAlg, static_cast<std::size_t>(input.size()));
+
+    if (is_integral<VALUE_TYPE>::value) {
+        hashAlg(input.data(), sizeof(VALUE_TYPE) * input.size());
+    }
+    else {
+        for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
+            hashAppend(hashAlg, *b);
+        }
+    }
+}
+
 }  // close namespace bsl
 
 // ============================================================================
@@ -6,6 +6,8 @@
 #include <bslstl_forwarditerator.h>
 #include <bslstl_iterator.h>
 
+#include <bslh_defaulthashalgorithm.h>     // for testing only
+#include <bslh_hash.h>                     // for testing only
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>   // for testing only
@@ -153,6 +155,7 @@ using namespace bsl;
 // [19] void swap(vector<T,A>&, vector<T,A>&);
 // [19] void swap(vector<T,A>&, vector<T,A>&&);
 // [19] void swap(vector<T,A>&&, vector<T,A>&);
+// [25] void hashAppend(HASHALG& hashAlg, const vector<T,A>& input);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
@@ -9229,6 +9232,113 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 25: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppend'
+        //
+        // Concerns:
+        //: 1 'hashAppend' supplies the size of the vector (as a 'size_t'), and
+        //:   then each of its elements, in order, to the hashing algorithm;
+        //:   passing the elements of a vector of integral type in a single
+        //:   call supplies the same bytes as passing them one by one.
+        //:
+        //: 2 The elements of a vector of non-integral type are each hashed by
+        //:   their own 'hashAppend' (e.g., '0.0' and '-0.0' hash the same),
+        //:   so that vectors of vectors having the same elements in total,
+        //:   but divided differently among the inner vectors, have distinct
+        //:   hash values.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, create vectors of 'int' of
+        //:   various lengths, and compare the value computed by 'bslh::Hash'
+        //:   with that of a 'bslh::DefaultHashAlgorithm' to which the size and
+        //:   elements were supplied explicitly, one by one.  (C-1)
+        //:
+        //: 2 Compare the hash values of vectors of 'double' holding '0.0' and
+        //:   '-0.0', and of the vectors of vectors '[[1, 2], [3]]' and
+        //:   '[[1], [2, 3]]'.  (C-2)
+        //
+        // Testing:
+        //   void hashAppend(HASHALG& hashAlg, const vector<T,A>& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'hashAppend'"
+                            "\n====================\n");
+
+        typedef bsl::vector<int> IntVector;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_length;     // number of elements
+            int d_values[4];  // elements
+        } DATA[] = {
+            //LINE  LEN  VALUES
+            //----  ---  --------------
+            { L_,     0, { 0          } },
+            { L_,     1, { 0          } },
+            { L_,     1, { 1          } },
+            { L_,     2, { 0, 0       } },
+            { L_,     2, { 1, 2       } },
+            { L_,     2, { 2, 1       } },
+            { L_,     3, { 1, 2, 3    } },
+            { L_,     4, { 1, 2, 3, 4 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int  LENGTH = DATA[ti].d_length;
+            const int *VALUES = DATA[ti].d_values;
+
+            const IntVector X(VALUES, VALUES + LENGTH, &oa);
+
+            bslh::DefaultHashAlgorithm expected;
+            const size_t               SIZE = LENGTH;
+            expected(&SIZE, sizeof SIZE);
+            for (int i = 0; i < LENGTH; ++i) {
+                expected(&VALUES[i], sizeof VALUES[i]);
+            }
+            LOOP_ASSERT(LINE, expected.computeHash() == hasher(X));
+        }
+
+        if (verbose) printf("\nTesting nested vectors.\n");
+        {
+            const int VALUES[] = { 1, 2, 3 };
+
+            bsl::vector<IntVector>        mA(&oa);
+            const bsl::vector<IntVector>& A = mA;
+            mA.push_back(IntVector(VALUES,     VALUES + 2, &oa));
+            mA.push_back(IntVector(VALUES + 2, VALUES + 3, &oa));
+
+            bsl::vector<IntVector>        mB(&oa);
+            const bsl::vector<IntVector>& B = mB;
+            mB.push_back(IntVector(VALUES,     VALUES + 1, &oa));
+            mB.push_back(IntVector(VALUES + 1, VALUES + 3, &oa));
+
+            ASSERT(hasher(A) != hasher(B));
+        }
+
+        if (verbose) printf("\nTesting vectors of non-integral type.\n");
+        {
+            bsl::vector<double> mA(&oa);  const bsl::vector<double>& A = mA;
+            mA.push_back(1.0);
+            mA.push_back(0.0);
+
+            bsl::vector<double> mB(&oa);  const bsl::vector<double>& B = mB;
+            mB.push_back(1.0);
+            mB.push_back(-0.0);
+
+            ASSERT(hasher(A) == hasher(B));
+
+            mB.push_back(0.0);
+
+            ASSERT(hasher(A) != hasher(B));
+        }
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE